@@ -22,15 +22,28 @@
  * of memory benchmarks. It handles configuration parsing, mode-specific buffer
  * preparation, benchmark execution, and results output in both console and JSON formats.
  *
- * The program supports five benchmark modes:
+ * The program supports sixteen benchmark modes:
  * - Standard benchmarks: Memory bandwidth and latency tests for different cache levels
  * - Pattern benchmarks: Access pattern-specific tests (forward, reverse, strided, random)
  * - TLB analysis: Page-native paired locality measurements and boundary analysis
  * - Core-to-core analysis: Best-effort inter-core round-trip latency measurements
  * - GPU bandwidth: Standalone Metal GPU memory read/write/copy measurements
+ * - Kernel autotune: Per-machine selection of the fastest sequential kernels
+ * - Noisy neighbor: Victim slowdown under duty-cycled aggressor traffic
+ * - Core scan: Per-slot L1/L2 latency and bandwidth with class outlier flags
+ * - Partition compare: Bandwidth under contiguous, interleaved, and random worker layouts
+ * - Multi-process: Thread versus forked-process scaling over the same worker chunks
+ * - IPC bandwidth: Inter-process transfer throughput, latency, and CPU cost per mechanism
+ * - File I/O: Page-cache read paths versus anonymous memory
+ * - Row buffer: DRAM row-hit, row-miss, and row-conflict pair latencies
+ * - Linked structures: List, tree, and hash-probe traversal latency per operation
+ * - Workload: Weighted mixes of access streams per thread group, described in a file
+ * - Trace replay: Captured address traces replayed per thread against a shuffled control
  *
  * Standard, pattern, TLB, and core-to-core modes also support validated parameter sweeps.
- * GPU bandwidth is intentionally standalone and does not participate in sweeps.
+ * GPU bandwidth, kernel autotune, noisy neighbor, core scan, partition compare,
+ * multi-process, IPC bandwidth, file I/O, row buffer, linked structures, workload, and
+ * trace replay are intentionally standalone and do not participate in sweeps.
  *
  * @author Timo Heimonen
  * @date 2026
@@ -46,9 +59,20 @@
 #include "core/config/mode_selector.h"
 #include "core/memory/buffer_allocator.h"
 #include "benchmark/benchmark_runner.h"
+#include "benchmark/core_scan.h"
 #include "benchmark/core_to_core_latency.h"
+#include "benchmark/file_io.h"
+#include "benchmark/ipc_bandwidth.h"
+#include "benchmark/kernel_autotune.h"
+#include "benchmark/linked_structures.h"
+#include "benchmark/multi_process.h"
+#include "benchmark/noisy_neighbor.h"
+#include "benchmark/partition_compare.h"
+#include "benchmark/row_buffer.h"
 #include "benchmark/sweep_runner.h"
 #include "benchmark/tlb_analysis.h"
+#include "benchmark/trace_replay.h"
+#include "benchmark/workload.h"
 #include "output/console/messages/messages_api.h"
 #include "core/config/constants.h"
 #include "output/json/json_output/json_output_api.h"
@@ -130,6 +154,39 @@ int main(int argc, char *argv[]) {
   if (mode_selection.mode == PrimaryBenchmarkMode::AnalyzeCoreToCore) {
     return run_core_to_core_latency_mode(argc, argv);
   }
+  if (mode_selection.mode == PrimaryBenchmarkMode::AutotuneKernels) {
+    return run_kernel_autotune_mode(argc, argv);
+  }
+  if (mode_selection.mode == PrimaryBenchmarkMode::NoisyNeighbor) {
+    return run_noisy_neighbor_mode(argc, argv);
+  }
+  if (mode_selection.mode == PrimaryBenchmarkMode::CoreScan) {
+    return run_core_scan_mode(argc, argv);
+  }
+  if (mode_selection.mode == PrimaryBenchmarkMode::PartitionCompare) {
+    return run_partition_compare_mode(argc, argv);
+  }
+  if (mode_selection.mode == PrimaryBenchmarkMode::MultiProcess) {
+    return run_multi_process_mode(argc, argv);
+  }
+  if (mode_selection.mode == PrimaryBenchmarkMode::IpcBandwidth) {
+    return run_ipc_bandwidth_mode(argc, argv);
+  }
+  if (mode_selection.mode == PrimaryBenchmarkMode::FileIo) {
+    return run_file_io_mode(argc, argv);
+  }
+  if (mode_selection.mode == PrimaryBenchmarkMode::RowBuffer) {
+    return run_row_buffer_mode(argc, argv);
+  }
+  if (mode_selection.mode == PrimaryBenchmarkMode::LinkedStructures) {
+    return run_linked_structures_mode(argc, argv);
+  }
+  if (mode_selection.mode == PrimaryBenchmarkMode::Workload) {
+    return run_workload_mode(argc, argv);
+  }
+  if (mode_selection.mode == PrimaryBenchmarkMode::TraceReplay) {
+    return run_trace_replay_mode(argc, argv);
+  }
 
   // Start total execution timer
   auto timer_opt = HighResTimer::create();
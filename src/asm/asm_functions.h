@@ -113,6 +113,13 @@ extern "C" {
                                                 size_t round_trips,
                                                 uint32_t responder_turn,
                                                 uint32_t initiator_turn);
+
+    /**
+     * @brief Dependent integer add chain for core frequency estimation (assembly)
+     * @param groups Number of 16-add groups; every add depends on the previous one
+     * @return Final accumulator (sink to prevent elimination)
+     */
+    uint64_t core_frequency_add_chain_asm(uint64_t groups);
      
     // Pattern-specific assembly functions
     // Reverse sequential
@@ -190,6 +197,62 @@ extern "C" {
      * @param num_accesses Number of random accesses to perform
      */
     void memory_copy_random_loop_asm(void* dst, const void* src, const size_t* indices, size_t num_accesses);
+
+    // Indexed gather/scatter (8-byte elements, num_accesses a multiple of 8)
+    /**
+     * @brief Scalar gather baseline: one general-purpose load per index
+     * @param src Source buffer pointer
+     * @param indices Array of byte offsets for indexed access
+     * @param num_accesses Number of elements; must be a multiple of 8
+     * @return Checksum of gathered data
+     */
+    uint64_t memory_gather_scalar_loop_asm(const void* src, const size_t* indices, size_t num_accesses);
+
+    /**
+     * @brief NEON gather: register-offset element loads into SIMD registers
+     * @param src Source buffer pointer
+     * @param indices Array of byte offsets for indexed access
+     * @param num_accesses Number of elements; must be a multiple of 8
+     * @return Checksum of gathered data
+     */
+    uint64_t memory_gather_neon_loop_asm(const void* src, const size_t* indices, size_t num_accesses);
+
+    /**
+     * @brief Scalar scatter baseline: one general-purpose store per index
+     * @param dst Destination buffer pointer
+     * @param indices Array of byte offsets for indexed access
+     * @param num_accesses Number of elements; must be a multiple of 8
+     */
+    void memory_scatter_scalar_loop_asm(void* dst, const size_t* indices, size_t num_accesses);
+
+    /**
+     * @brief NEON scatter: register-offset element stores from a SIMD register
+     * @param dst Destination buffer pointer
+     * @param indices Array of byte offsets for indexed access
+     * @param num_accesses Number of elements; must be a multiple of 8
+     */
+    void memory_scatter_neon_loop_asm(void* dst, const size_t* indices, size_t num_accesses);
+
+    /**
+     * @brief Scalar indexed copy baseline: `dst[indices[i]] = src[indices[i]]`
+     * @param dst Destination buffer pointer
+     * @param src Source buffer pointer
+     * @param indices Array of byte offsets shared by both buffers
+     * @param num_accesses Number of elements; must be a multiple of 8
+     */
+    void memory_gather_scatter_scalar_loop_asm(void* dst, const void* src, const size_t* indices,
+                                               size_t num_accesses);
+
+    /**
+     * @brief NEON indexed copy: register-offset SIMD loads from src, stores to dst
+     * @param dst Destination buffer pointer
+     * @param src Source buffer pointer
+     * @param indices Array of byte offsets shared by both buffers
+     * @param num_accesses Number of elements; must be a multiple of 8
+     */
+    void memory_gather_scatter_neon_loop_asm(void* dst, const void* src, const size_t* indices,
+                                             size_t num_accesses);
+
 }
 /** @} */
 
@@ -0,0 +1,70 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// -----------------------------------------------------------------------------
+// core_frequency_add_chain_asm
+// -----------------------------------------------------------------------------
+// C++ Prototype:
+//   extern "C" uint64_t core_frequency_add_chain_asm(uint64_t groups);
+// Purpose:
+//   Execute a serial chain of 16 * groups integer adds. Each add consumes the
+//   previous result, so the chain retires one add per core clock on cores with
+//   single-cycle ALU latency (every Apple Silicon P- and E-core), and elapsed
+//   time divided into the add count estimates the effective core frequency.
+// Arguments:
+//   x0 = groups (number of 16-add groups)
+// Returns:
+//   x0 = final accumulator value (acts as a sink to prevent DCE)
+// Clobbers:
+//   x1 (group counter)
+// Implementation Notes:
+//   * The loop counter lives in its own register, so subs/b.ne issue in
+//     parallel with the add chain and do not lengthen it.
+//   * No memory accesses: the probe measures the core clock only and leaves
+//     the caches untouched around the memory measurement it brackets.
+// Timing Contract:
+//   Caller reads timestamps through HighResTimer, which emits `dsb ish; isb`
+//   around each timestamp read.
+// -----------------------------------------------------------------------------
+
+.global _core_frequency_add_chain_asm
+.align 4
+_core_frequency_add_chain_asm:
+    mov x1, x0                  // x1 = remaining groups
+    mov x0, #0                  // x0 = accumulator (chain head)
+    cbz x1, frequency_end       // No groups requested
+
+    .p2align 6
+frequency_loop:                 // 16 dependent adds per iteration
+    add x0, x0, #1
+    add x0, x0, #1
+    add x0, x0, #1
+    add x0, x0, #1
+    add x0, x0, #1
+    add x0, x0, #1
+    add x0, x0, #1
+    add x0, x0, #1
+    add x0, x0, #1
+    add x0, x0, #1
+    add x0, x0, #1
+    add x0, x0, #1
+    add x0, x0, #1
+    add x0, x0, #1
+    add x0, x0, #1
+    add x0, x0, #1
+    subs x1, x1, #1             // Independent of the chain
+    b.ne frequency_loop
+
+frequency_end:
+    ret
@@ -0,0 +1,159 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// -----------------------------------------------------------------------------
+// memory_gather_scalar_loop_asm
+// -----------------------------------------------------------------------------
+// C++ Prototype:
+//   extern "C" uint64_t memory_gather_scalar_loop_asm(const void* src, const size_t* indices, size_t num_accesses);
+// Purpose:
+//   Scalar baseline for the gather pattern: loads one 8-byte element per index
+//   from the random index stream with an independent general-purpose load.
+// Arguments:
+//   x0 = src (const void*)
+//   x1 = indices (const size_t*) - array of byte offsets into src
+//   x2 = num_accesses (size_t) - multiple of 8
+// Returns:
+//   x0 = 64-bit XOR checksum
+// Clobbers:
+//   x3-x7, x9-x15
+// Implementation Notes:
+//   * Consumes the index stream in groups of eight, exactly like the NEON
+//     gather kernel, so both kernels retire the same index loads, element
+//     loads, and loop-control instructions per group.
+//   * Two XOR accumulators keep the element loads architecturally visible.
+// Timing Contract:
+//   Caller must emit `dsb ish; isb` before reading the start-of-measurement
+//   timestamp and another `dsb ish; isb` before reading the end-of-measurement
+//   timestamp. This kernel emits no internal fences; barrier discipline is the
+//   caller's responsibility for reproducible timing.
+// -----------------------------------------------------------------------------
+
+.global _memory_gather_scalar_loop_asm
+.align 4
+_memory_gather_scalar_loop_asm:
+    mov x3, xzr                 // i = 0 (index counter)
+    mov x9, xzr                 // Accumulator 0
+    mov x10, xzr                // Accumulator 1
+
+gather_scalar_loop:
+    cmp x3, x2                  // i >= num_accesses?
+    b.hs gather_scalar_end
+    add x11, x1, x3, lsl #3     // &indices[i]
+
+    ldp x4, x5, [x11]           // indices[i..i+1]
+    ldp x6, x7, [x11, #16]      // indices[i+2..i+3]
+    ldr x12, [x0, x4]           // Four independent 8-byte element loads
+    ldr x13, [x0, x5]
+    ldr x14, [x0, x6]
+    ldr x15, [x0, x7]
+    eor x9, x9, x12
+    eor x10, x10, x13
+    eor x9, x9, x14
+    eor x10, x10, x15
+
+    ldp x4, x5, [x11, #32]      // indices[i+4..i+5]
+    ldp x6, x7, [x11, #48]      // indices[i+6..i+7]
+    ldr x12, [x0, x4]
+    ldr x13, [x0, x5]
+    ldr x14, [x0, x6]
+    ldr x15, [x0, x7]
+    eor x9, x9, x12
+    eor x10, x10, x13
+    eor x9, x9, x14
+    eor x10, x10, x15
+
+    add x3, x3, #8              // i += 8
+    b gather_scalar_loop
+
+gather_scalar_end:
+    eor x0, x9, x10             // Combine accumulators
+    ret
+
+// -----------------------------------------------------------------------------
+// memory_gather_neon_loop_asm
+// -----------------------------------------------------------------------------
+// C++ Prototype:
+//   extern "C" uint64_t memory_gather_neon_loop_asm(const void* src, const size_t* indices, size_t num_accesses);
+// Purpose:
+//   Gather eight 8-byte elements per group into NEON registers. AArch64 NEON
+//   has no gather instruction, so each element is loaded with a
+//   register-offset SIMD load (`ldr dN, [src, index]`) and pairs are packed
+//   into 128-bit vectors with `zip1`.
+// Arguments:
+//   x0 = src (const void*)
+//   x1 = indices (const size_t*) - array of byte offsets into src
+//   x2 = num_accesses (size_t) - multiple of 8
+// Returns:
+//   x0 = 64-bit XOR checksum
+// Clobbers:
+//   x3-x7, x11-x15, q0-q7, q16-q17 (avoiding q8-q15 per AAPCS64)
+// Implementation Notes:
+//   * Addresses are formed by the load's register-offset addressing mode in
+//     the integer pipeline, exactly as in the scalar kernel; only the element
+//     data travels through NEON registers. The two kernels therefore retire
+//     the same index loads and element loads per group and differ only in the
+//     data path.
+//   * Each element load writes a whole D register, so no load merges into a
+//     previously loaded lane.
+// Timing Contract:
+//   Caller must emit `dsb ish; isb` before reading the start-of-measurement
+//   timestamp and another `dsb ish; isb` before reading the end-of-measurement
+//   timestamp. This kernel emits no internal fences; barrier discipline is the
+//   caller's responsibility for reproducible timing.
+// -----------------------------------------------------------------------------
+
+.global _memory_gather_neon_loop_asm
+.align 4
+_memory_gather_neon_loop_asm:
+    mov x3, xzr                 // i = 0 (index counter)
+    eor v0.16b, v0.16b, v0.16b  // Accumulator 0
+    eor v1.16b, v1.16b, v1.16b  // Accumulator 1
+
+gather_neon_loop:
+    cmp x3, x2                  // i >= num_accesses?
+    b.hs gather_neon_end
+    add x11, x1, x3, lsl #3     // &indices[i]
+
+    ldp x4, x5, [x11]           // indices[i..i+1]
+    ldp x6, x7, [x11, #16]      // indices[i+2..i+3]
+    ldp x12, x13, [x11, #32]    // indices[i+4..i+5]
+    ldp x14, x15, [x11, #48]    // indices[i+6..i+7]
+
+    ldr d2, [x0, x4]            // Eight independent element loads into NEON
+    ldr d3, [x0, x5]
+    ldr d4, [x0, x6]
+    ldr d5, [x0, x7]
+    ldr d6, [x0, x12]
+    ldr d7, [x0, x13]
+    ldr d16, [x0, x14]
+    ldr d17, [x0, x15]
+    zip1 v2.2d, v2.2d, v3.2d    // Pack element pairs into gathered vectors
+    zip1 v4.2d, v4.2d, v5.2d
+    zip1 v6.2d, v6.2d, v7.2d
+    zip1 v16.2d, v16.2d, v17.2d
+    eor v0.16b, v0.16b, v2.16b
+    eor v1.16b, v1.16b, v4.16b
+    eor v0.16b, v0.16b, v6.16b
+    eor v1.16b, v1.16b, v16.16b
+
+    add x3, x3, #8              // i += 8
+    b gather_neon_loop
+
+gather_neon_end:
+    eor v0.16b, v0.16b, v1.16b  // Combine accumulators
+    umov x12, v0.d[0]
+    umov x13, v0.d[1]
+    eor x0, x12, x13
+    ret
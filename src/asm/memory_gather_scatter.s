@@ -0,0 +1,145 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// -----------------------------------------------------------------------------
+// memory_gather_scatter_scalar_loop_asm
+// -----------------------------------------------------------------------------
+// C++ Prototype:
+//   extern "C" void memory_gather_scatter_scalar_loop_asm(void* dst, const void* src, const size_t* indices, size_t num_accesses);
+// Purpose:
+//   Scalar baseline for indexed copy: `dst[indices[i]] = src[indices[i]]` for
+//   8-byte elements, one general-purpose load and store per index.
+// Arguments:
+//   x0 = dst (void*)
+//   x1 = src (const void*)
+//   x2 = indices (const size_t*) - byte offsets shared by src and dst
+//   x3 = num_accesses (size_t) - multiple of 8
+// Returns:
+//   (none)
+// Clobbers:
+//   x4-x7, x9, x11-x15
+// Implementation Notes:
+//   * Consumes the index stream in groups of eight to match the NEON
+//     gather-scatter kernel per group.
+// Timing Contract:
+//   Caller must emit `dsb ish; isb` before reading the start-of-measurement
+//   timestamp and another `dsb ish; isb` before reading the end-of-measurement
+//   timestamp. This kernel emits no internal fences; barrier discipline is the
+//   caller's responsibility for reproducible timing.
+// -----------------------------------------------------------------------------
+
+.global _memory_gather_scatter_scalar_loop_asm
+.align 4
+_memory_gather_scatter_scalar_loop_asm:
+    mov x9, xzr                 // i = 0 (index counter)
+
+gather_scatter_scalar_loop:
+    cmp x9, x3                  // i >= num_accesses?
+    b.hs gather_scatter_scalar_end
+    add x11, x2, x9, lsl #3     // &indices[i]
+
+    ldp x4, x5, [x11]           // indices[i..i+3]
+    ldp x6, x7, [x11, #16]
+    ldr x12, [x1, x4]           // Four element loads
+    ldr x13, [x1, x5]
+    ldr x14, [x1, x6]
+    ldr x15, [x1, x7]
+    str x12, [x0, x4]           // Four element stores at the same offsets
+    str x13, [x0, x5]
+    str x14, [x0, x6]
+    str x15, [x0, x7]
+
+    ldp x4, x5, [x11, #32]      // indices[i+4..i+7]
+    ldp x6, x7, [x11, #48]
+    ldr x12, [x1, x4]
+    ldr x13, [x1, x5]
+    ldr x14, [x1, x6]
+    ldr x15, [x1, x7]
+    str x12, [x0, x4]
+    str x13, [x0, x5]
+    str x14, [x0, x6]
+    str x15, [x0, x7]
+
+    add x9, x9, #8              // i += 8
+    b gather_scatter_scalar_loop
+
+gather_scatter_scalar_end:
+    ret
+
+// -----------------------------------------------------------------------------
+// memory_gather_scatter_neon_loop_asm
+// -----------------------------------------------------------------------------
+// C++ Prototype:
+//   extern "C" void memory_gather_scatter_neon_loop_asm(void* dst, const void* src, const size_t* indices, size_t num_accesses);
+// Purpose:
+//   Indexed copy through NEON registers: register-offset SIMD loads from src,
+//   then register-offset SIMD stores to the same offsets in dst.
+// Arguments:
+//   x0 = dst (void*)
+//   x1 = src (const void*)
+//   x2 = indices (const size_t*) - byte offsets shared by src and dst
+//   x3 = num_accesses (size_t) - multiple of 8
+// Returns:
+//   (none)
+// Clobbers:
+//   x4-x7, x9, x11-x15, q2-q7, q16-q17 (avoiding q8-q15 per AAPCS64)
+// Implementation Notes:
+//   * Addresses are formed by the addressing mode in the integer pipeline, as
+//     in the scalar kernel; only the copied data travels through NEON
+//     registers. Each offset is used once for the load and once for the
+//     store, so no per-lane address moves are needed.
+// Timing Contract:
+//   Caller must emit `dsb ish; isb` before reading the start-of-measurement
+//   timestamp and another `dsb ish; isb` before reading the end-of-measurement
+//   timestamp. This kernel emits no internal fences; barrier discipline is the
+//   caller's responsibility for reproducible timing.
+// -----------------------------------------------------------------------------
+
+.global _memory_gather_scatter_neon_loop_asm
+.align 4
+_memory_gather_scatter_neon_loop_asm:
+    mov x9, xzr                 // i = 0 (index counter)
+
+gather_scatter_neon_loop:
+    cmp x9, x3                  // i >= num_accesses?
+    b.hs gather_scatter_neon_end
+    add x11, x2, x9, lsl #3     // &indices[i]
+
+    ldp x4, x5, [x11]           // indices[i..i+1]
+    ldp x6, x7, [x11, #16]      // indices[i+2..i+3]
+    ldp x12, x13, [x11, #32]    // indices[i+4..i+5]
+    ldp x14, x15, [x11, #48]    // indices[i+6..i+7]
+
+    ldr d2, [x1, x4]            // Gather eight elements into NEON
+    ldr d3, [x1, x5]
+    ldr d4, [x1, x6]
+    ldr d5, [x1, x7]
+    ldr d6, [x1, x12]
+    ldr d7, [x1, x13]
+    ldr d16, [x1, x14]
+    ldr d17, [x1, x15]
+    str d2, [x0, x4]            // Scatter them to the same offsets
+    str d3, [x0, x5]
+    str d4, [x0, x6]
+    str d5, [x0, x7]
+    str d6, [x0, x12]
+    str d7, [x0, x13]
+    str d16, [x0, x14]
+    str d17, [x0, x15]
+
+    add x9, x9, #8              // i += 8
+    b gather_scatter_neon_loop
+
+gather_scatter_neon_end:
+    ret
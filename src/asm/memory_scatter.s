@@ -0,0 +1,128 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+// -----------------------------------------------------------------------------
+// memory_scatter_scalar_loop_asm
+// -----------------------------------------------------------------------------
+// C++ Prototype:
+//   extern "C" void memory_scatter_scalar_loop_asm(void* dst, const size_t* indices, size_t num_accesses);
+// Purpose:
+//   Scalar baseline for the scatter pattern: stores one 8-byte zero element
+//   per index from the random index stream with a general-purpose store.
+// Arguments:
+//   x0 = dst (void*)
+//   x1 = indices (const size_t*) - array of byte offsets into dst
+//   x2 = num_accesses (size_t) - multiple of 8
+// Returns:
+//   (none)
+// Clobbers:
+//   x3-x7, x11
+// Implementation Notes:
+//   * Consumes the index stream in groups of eight to match the NEON scatter
+//     kernel's index loads and loop control per group.
+// Timing Contract:
+//   Caller must emit `dsb ish; isb` before reading the start-of-measurement
+//   timestamp and another `dsb ish; isb` before reading the end-of-measurement
+//   timestamp. This kernel emits no internal fences; barrier discipline is the
+//   caller's responsibility for reproducible timing.
+// -----------------------------------------------------------------------------
+
+.global _memory_scatter_scalar_loop_asm
+.align 4
+_memory_scatter_scalar_loop_asm:
+    mov x3, xzr                 // i = 0 (index counter)
+
+scatter_scalar_loop:
+    cmp x3, x2                  // i >= num_accesses?
+    b.hs scatter_scalar_end
+    add x11, x1, x3, lsl #3     // &indices[i]
+
+    ldp x4, x5, [x11]           // indices[i..i+3]
+    ldp x6, x7, [x11, #16]
+    str xzr, [x0, x4]           // Four independent 8-byte element stores
+    str xzr, [x0, x5]
+    str xzr, [x0, x6]
+    str xzr, [x0, x7]
+
+    ldp x4, x5, [x11, #32]      // indices[i+4..i+7]
+    ldp x6, x7, [x11, #48]
+    str xzr, [x0, x4]
+    str xzr, [x0, x5]
+    str xzr, [x0, x6]
+    str xzr, [x0, x7]
+
+    add x3, x3, #8              // i += 8
+    b scatter_scalar_loop
+
+scatter_scalar_end:
+    ret
+
+// -----------------------------------------------------------------------------
+// memory_scatter_neon_loop_asm
+// -----------------------------------------------------------------------------
+// C++ Prototype:
+//   extern "C" void memory_scatter_neon_loop_asm(void* dst, const size_t* indices, size_t num_accesses);
+// Purpose:
+//   Scatter eight 8-byte zero elements per group from a NEON register. NEON
+//   has no scatter instruction, so each element leaves through a
+//   register-offset SIMD store (`str dN, [dst, index]`).
+// Arguments:
+//   x0 = dst (void*)
+//   x1 = indices (const size_t*) - array of byte offsets into dst
+//   x2 = num_accesses (size_t) - multiple of 8
+// Returns:
+//   (none)
+// Clobbers:
+//   x3-x7, x11-x15, q2 (avoiding q8-q15 per AAPCS64)
+// Implementation Notes:
+//   * Addresses are formed by the store's register-offset addressing mode in
+//     the integer pipeline, as in the scalar kernel; only the stored data
+//     comes from a NEON register.
+// Timing Contract:
+//   Caller must emit `dsb ish; isb` before reading the start-of-measurement
+//   timestamp and another `dsb ish; isb` before reading the end-of-measurement
+//   timestamp. This kernel emits no internal fences; barrier discipline is the
+//   caller's responsibility for reproducible timing.
+// -----------------------------------------------------------------------------
+
+.global _memory_scatter_neon_loop_asm
+.align 4
+_memory_scatter_neon_loop_asm:
+    mov x3, xzr                 // i = 0 (index counter)
+    movi v2.16b, #0             // Zero element source
+
+scatter_neon_loop:
+    cmp x3, x2                  // i >= num_accesses?
+    b.hs scatter_neon_end
+    add x11, x1, x3, lsl #3     // &indices[i]
+
+    ldp x4, x5, [x11]           // indices[i..i+1]
+    ldp x6, x7, [x11, #16]      // indices[i+2..i+3]
+    ldp x12, x13, [x11, #32]    // indices[i+4..i+5]
+    ldp x14, x15, [x11, #48]    // indices[i+6..i+7]
+
+    str d2, [x0, x4]            // Eight independent element stores from NEON
+    str d2, [x0, x5]
+    str d2, [x0, x6]
+    str d2, [x0, x7]
+    str d2, [x0, x12]
+    str d2, [x0, x13]
+    str d2, [x0, x14]
+    str d2, [x0, x15]
+
+    add x3, x3, #8              // i += 8
+    b scatter_neon_loop
+
+scatter_neon_end:
+    ret
@@ -29,11 +29,17 @@
  * - High-resolution timing via HighResTimer
  */
 
+#include <algorithm>             // For std::min
+#include <atomic>
+#include <chrono>
 #include <cstdint>               // For uint64_t
 #include <limits>
 #include <vector>
 
+#include "benchmark/bandwidth_timeline.h"
+#include "benchmark/core_frequency_probe.h"
 #include "benchmark/benchmark_tests.h"  // Function declarations
+#include "core/config/constants.h"
 #include "core/timing/timer.h"  // HighResTimer
 #include "asm/asm_functions.h"  // Assembly function declarations
 #include "benchmark/parallel_test_framework.h"
@@ -71,6 +77,61 @@ double run_copy_test_impl(void* dst,
   return run_parallel_test_copy(dst, src, size, iterations, num_threads, timer, copy_work, "copy");
 }
 
+// Timeline runs split every pass into progress blocks and publish the running
+// payload total after each one. Blocks are whole 32-byte granules, so read
+// checksums match the unsplit pass.
+template <typename BlockFunction>
+void run_blocks_with_progress(size_t chunk_size, int iterations,
+                              size_t payload_multiplier,
+                              std::atomic<uint64_t>& progress,
+                              BlockFunction block) {
+  uint64_t completed_bytes = 0;
+  for (int iteration = 0; iteration < iterations; ++iteration) {
+    for (size_t offset = 0; offset < chunk_size;) {
+      const size_t length = std::min(Constants::BANDWIDTH_TIMELINE_PROGRESS_BLOCK_BYTES,
+                                     chunk_size - offset);
+      block(offset, length);
+      offset += length;
+      completed_bytes += length * payload_multiplier;
+      progress.store(completed_bytes, std::memory_order_relaxed);
+    }
+  }
+}
+
+ParallelProgressSampler make_timeline_sampler(BandwidthTimelineRecorder& timeline) {
+  ParallelProgressSampler sampler;
+  sampler.interval = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::duration<double>(Constants::BANDWIDTH_TIMELINE_SAMPLE_INTERVAL_SECONDS));
+  sampler.sample = [&timeline](double elapsed_seconds) {
+    record_bandwidth_timeline_sample(timeline, elapsed_seconds);
+  };
+  return sampler;
+}
+
+// Closes the series with the exact end of the timed run; joined workers have
+// published their final totals by now.
+void finish_timeline(BandwidthTimelineRecorder* timeline, double elapsed_seconds) {
+  if (timeline != nullptr && elapsed_seconds > 0.0) {
+    record_bandwidth_timeline_sample(*timeline, elapsed_seconds);
+  }
+}
+
+// Each worker times the add chain with a private copy of the shared timer,
+// outside the start gate and after its completion has been published.
+ParallelWorkerBracket make_frequency_bracket(CoreFrequencyProbeRecord& frequency,
+                                             const HighResTimer& timer) {
+  ParallelWorkerBracket bracket;
+  bracket.before_start = [&frequency, timer](size_t worker_index) {
+    HighResTimer probe_timer = timer;
+    frequency.before_ghz[worker_index] = measure_core_frequency_ghz(probe_timer);
+  };
+  bracket.after_finish = [&frequency, timer](size_t worker_index) {
+    HighResTimer probe_timer = timer;
+    frequency.after_ghz[worker_index] = measure_core_frequency_ghz(probe_timer);
+  };
+  return bracket;
+}
+
 }  // namespace
 
 double run_read_test_with_plan(void* buffer,
@@ -78,7 +139,9 @@ double run_read_test_with_plan(void* buffer,
                                uint64_t& checksum,
                                HighResTimer& timer,
                                uint64_t (*read_func)(const void*, size_t),
-                               ParallelExecutionMetadata* execution_metadata) {
+                               ParallelExecutionMetadata* execution_metadata,
+                               BandwidthTimelineRecorder* timeline,
+                               CoreFrequencyProbeRecord* frequency) {
   if (plan.status != BenchmarkMeasurementStatus::Measured ||
       plan.operation != BenchmarkOperation::Read || plan.passes == 0 ||
       plan.passes > static_cast<size_t>(std::numeric_limits<int>::max())) {
@@ -86,18 +149,38 @@ double run_read_test_with_plan(void* buffer,
   }
 
   std::vector<uint64_t> worker_checksums(plan.workers.size(), 0);
+  ParallelProgressSampler sampler;
+  if (timeline != nullptr) {
+    reset_bandwidth_timeline_recorder(*timeline, plan.workers.size());
+    sampler = make_timeline_sampler(*timeline);
+  }
+  ParallelWorkerBracket bracket;
+  if (frequency != nullptr) {
+    reset_core_frequency_probe_record(*frequency, plan.workers.size());
+    bracket = make_frequency_bracket(*frequency, timer);
+  }
   const double elapsed = run_parallel_test_indexed_with_boundaries(
       buffer, plan.buffer_size_bytes, static_cast<int>(plan.passes), timer,
       plan.boundaries,
-      [read_func, &worker_checksums](char* chunk_start, size_t chunk_size,
-                                    int iterations, size_t worker_index) {
+      [read_func, &worker_checksums, timeline](char* chunk_start, size_t chunk_size,
+                                               int iterations, size_t worker_index) {
         uint64_t local_checksum = 0;
-        for (int iteration = 0; iteration < iterations; ++iteration) {
-          local_checksum ^= read_func(chunk_start, chunk_size);
+        if (timeline == nullptr) {
+          for (int iteration = 0; iteration < iterations; ++iteration) {
+            local_checksum ^= read_func(chunk_start, chunk_size);
+          }
+        } else {
+          run_blocks_with_progress(
+              chunk_size, iterations, 1, timeline->slots[worker_index].completed_bytes,
+              [read_func, chunk_start, &local_checksum](size_t offset, size_t length) {
+                local_checksum ^= read_func(chunk_start + offset, length);
+              });
         }
         worker_checksums[worker_index] = local_checksum;
       },
-      "read", execution_metadata);
+      "read", execution_metadata, timeline != nullptr ? &sampler : nullptr,
+      frequency != nullptr ? &bracket : nullptr);
+  finish_timeline(timeline, elapsed);
 
   checksum = 0;
   for (const uint64_t worker_checksum : worker_checksums) {
@@ -142,22 +225,45 @@ double run_write_test_with_plan(void* buffer,
                                 const BenchmarkWorkPlan& plan,
                                 HighResTimer& timer,
                                 void (*write_func)(void*, size_t),
-                                ParallelExecutionMetadata* execution_metadata) {
+                                ParallelExecutionMetadata* execution_metadata,
+                                BandwidthTimelineRecorder* timeline,
+                                CoreFrequencyProbeRecord* frequency) {
   if (plan.status != BenchmarkMeasurementStatus::Measured ||
       plan.operation != BenchmarkOperation::Write || plan.passes == 0 ||
       plan.passes > static_cast<size_t>(std::numeric_limits<int>::max())) {
     return 0.0;
   }
-  return run_parallel_test_indexed_with_boundaries(
+  ParallelProgressSampler sampler;
+  if (timeline != nullptr) {
+    reset_bandwidth_timeline_recorder(*timeline, plan.workers.size());
+    sampler = make_timeline_sampler(*timeline);
+  }
+  ParallelWorkerBracket bracket;
+  if (frequency != nullptr) {
+    reset_core_frequency_probe_record(*frequency, plan.workers.size());
+    bracket = make_frequency_bracket(*frequency, timer);
+  }
+  const double elapsed = run_parallel_test_indexed_with_boundaries(
       buffer, plan.buffer_size_bytes, static_cast<int>(plan.passes), timer,
       plan.boundaries,
-      [write_func](char* chunk_start, size_t chunk_size, int iterations,
-                   size_t) {
-        for (int iteration = 0; iteration < iterations; ++iteration) {
-          write_func(chunk_start, chunk_size);
+      [write_func, timeline](char* chunk_start, size_t chunk_size, int iterations,
+                             size_t worker_index) {
+        if (timeline == nullptr) {
+          for (int iteration = 0; iteration < iterations; ++iteration) {
+            write_func(chunk_start, chunk_size);
+          }
+          return;
         }
+        run_blocks_with_progress(
+            chunk_size, iterations, 1, timeline->slots[worker_index].completed_bytes,
+            [write_func, chunk_start](size_t offset, size_t length) {
+              write_func(chunk_start + offset, length);
+            });
       },
-      "write", execution_metadata);
+      "write", execution_metadata, timeline != nullptr ? &sampler : nullptr,
+      frequency != nullptr ? &bracket : nullptr);
+  finish_timeline(timeline, elapsed);
+  return elapsed;
 }
 
 /**
@@ -203,20 +309,44 @@ double run_copy_test_with_plan(void* dst,
                                const BenchmarkWorkPlan& plan,
                                HighResTimer& timer,
                                void (*copy_func)(void*, const void*, size_t),
-                               ParallelExecutionMetadata* execution_metadata) {
+                               ParallelExecutionMetadata* execution_metadata,
+                               BandwidthTimelineRecorder* timeline,
+                               CoreFrequencyProbeRecord* frequency) {
   if (plan.status != BenchmarkMeasurementStatus::Measured ||
       plan.operation != BenchmarkOperation::Copy || plan.passes == 0 ||
       plan.passes > static_cast<size_t>(std::numeric_limits<int>::max())) {
     return 0.0;
   }
-  return run_parallel_test_copy_indexed_with_boundaries(
+  ParallelProgressSampler sampler;
+  if (timeline != nullptr) {
+    reset_bandwidth_timeline_recorder(*timeline, plan.workers.size());
+    sampler = make_timeline_sampler(*timeline);
+  }
+  ParallelWorkerBracket bracket;
+  if (frequency != nullptr) {
+    reset_core_frequency_probe_record(*frequency, plan.workers.size());
+    bracket = make_frequency_bracket(*frequency, timer);
+  }
+  const double elapsed = run_parallel_test_copy_indexed_with_boundaries(
       dst, src, plan.buffer_size_bytes, static_cast<int>(plan.passes), timer,
       plan.boundaries,
-      [copy_func](char* dst_chunk, char* src_chunk, size_t chunk_size,
-                  int iterations, size_t) {
-        for (int iteration = 0; iteration < iterations; ++iteration) {
-          copy_func(dst_chunk, src_chunk, chunk_size);
+      [copy_func, timeline](char* dst_chunk, char* src_chunk, size_t chunk_size,
+                            int iterations, size_t worker_index) {
+        if (timeline == nullptr) {
+          for (int iteration = 0; iteration < iterations; ++iteration) {
+            copy_func(dst_chunk, src_chunk, chunk_size);
+          }
+          return;
         }
+        run_blocks_with_progress(
+            chunk_size, iterations, Constants::COPY_OPERATION_MULTIPLIER,
+            timeline->slots[worker_index].completed_bytes,
+            [copy_func, dst_chunk, src_chunk](size_t offset, size_t length) {
+              copy_func(dst_chunk + offset, src_chunk + offset, length);
+            });
       },
-      "copy", execution_metadata);
+      "copy", execution_metadata, timeline != nullptr ? &sampler : nullptr,
+      frequency != nullptr ? &bracket : nullptr);
+  finish_timeline(timeline, elapsed);
+  return elapsed;
 }
@@ -0,0 +1,152 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file bandwidth_timeline.cpp
+ * @brief Progress sampling and phase analysis for bandwidth timelines
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include "benchmark/bandwidth_timeline.h"
+
+#include <cmath>
+
+#include "utils/descriptive_statistics.h"
+
+namespace {
+
+// Enough for the calibrated run window at the default interval without
+// reallocating on the sampling thread.
+constexpr size_t kReservedSamples = 512;
+
+}  // namespace
+
+const char* bandwidth_timeline_phase_to_string(BandwidthTimelinePhase phase) {
+  switch (phase) {
+    case BandwidthTimelinePhase::RampUp:
+      return "ramp-up";
+    case BandwidthTimelinePhase::Steady:
+      return "steady";
+    case BandwidthTimelinePhase::Tail:
+      return "tail";
+  }
+  return "steady";
+}
+
+void reset_bandwidth_timeline_recorder(BandwidthTimelineRecorder& recorder,
+                                       size_t worker_count) {
+  if (recorder.slot_count != worker_count || recorder.slots == nullptr) {
+    recorder.slots = std::make_unique<BandwidthProgressSlot[]>(worker_count);
+    recorder.slot_count = worker_count;
+  }
+  for (size_t index = 0; index < recorder.slot_count; ++index) {
+    recorder.slots[index].completed_bytes.store(0, std::memory_order_relaxed);
+  }
+  recorder.samples.clear();
+  recorder.samples.reserve(kReservedSamples);
+  recorder.samples.push_back({0.0, 0});
+}
+
+void record_bandwidth_timeline_sample(BandwidthTimelineRecorder& recorder,
+                                      double elapsed_seconds) {
+  uint64_t completed_bytes = 0;
+  for (size_t index = 0; index < recorder.slot_count; ++index) {
+    completed_bytes +=
+        recorder.slots[index].completed_bytes.load(std::memory_order_relaxed);
+  }
+  recorder.samples.push_back({elapsed_seconds, completed_bytes});
+}
+
+BandwidthTimelineSummary analyze_bandwidth_timeline(
+    const std::vector<BandwidthTimelineSample>& samples) {
+  BandwidthTimelineSummary summary;
+  // Sample index at the start of each window, plus the final end sample.
+  std::vector<size_t> boundaries;
+  for (size_t index = 0; index < samples.size(); ++index) {
+    if (!boundaries.empty()) {
+      const BandwidthTimelineSample& start = samples[boundaries.back()];
+      const double seconds = samples[index].elapsed_seconds - start.elapsed_seconds;
+      if (!(seconds > 0.0) || samples[index].completed_bytes < start.completed_bytes) {
+        continue;
+      }
+      BandwidthTimelineWindow window;
+      window.start_seconds = start.elapsed_seconds;
+      window.end_seconds = samples[index].elapsed_seconds;
+      window.bandwidth_gb_s =
+          static_cast<double>(samples[index].completed_bytes - start.completed_bytes) /
+          seconds / Constants::NANOSECONDS_PER_SECOND;
+      summary.windows.push_back(window);
+    }
+    boundaries.push_back(index);
+  }
+  if (summary.windows.size() < Constants::BANDWIDTH_TIMELINE_MIN_WINDOWS) {
+    return summary;
+  }
+
+  std::vector<double> rates;
+  rates.reserve(summary.windows.size());
+  for (const BandwidthTimelineWindow& window : summary.windows) {
+    rates.push_back(window.bandwidth_gb_s);
+  }
+  const double median = calculate_descriptive_statistics(rates).median;
+  if (!(median > 0.0)) {
+    return summary;
+  }
+  const double phase_floor =
+      median * (1.0 - Constants::BANDWIDTH_TIMELINE_PHASE_TOLERANCE);
+
+  // The median bounds both scans, so at least half the windows stay steady.
+  size_t steady_begin = 0;
+  while (steady_begin < summary.windows.size() &&
+         summary.windows[steady_begin].bandwidth_gb_s < phase_floor) {
+    summary.windows[steady_begin].phase = BandwidthTimelinePhase::RampUp;
+    ++steady_begin;
+  }
+  size_t steady_end = summary.windows.size();
+  while (steady_end > steady_begin &&
+         summary.windows[steady_end - 1].bandwidth_gb_s < phase_floor) {
+    summary.windows[steady_end - 1].phase = BandwidthTimelinePhase::Tail;
+    --steady_end;
+  }
+
+  const BandwidthTimelineSample& steady_start = samples[boundaries[steady_begin]];
+  const BandwidthTimelineSample& steady_stop = samples[boundaries[steady_end]];
+  summary.steady_state_bandwidth_gb_s =
+      static_cast<double>(steady_stop.completed_bytes - steady_start.completed_bytes) /
+      (steady_stop.elapsed_seconds - steady_start.elapsed_seconds) /
+      Constants::NANOSECONDS_PER_SECOND;
+  summary.ramp_up_seconds = steady_start.elapsed_seconds - samples[boundaries[0]].elapsed_seconds;
+  if (steady_begin > 0) {
+    const BandwidthTimelineSample& first = samples[boundaries[0]];
+    summary.ramp_up_bandwidth_gb_s =
+        static_cast<double>(steady_start.completed_bytes - first.completed_bytes) /
+        summary.ramp_up_seconds / Constants::NANOSECONDS_PER_SECOND;
+  }
+
+  const double step_limit =
+      *summary.steady_state_bandwidth_gb_s * Constants::BANDWIDTH_TIMELINE_TRANSITION_TOLERANCE;
+  for (size_t index = steady_begin + 1; index < steady_end; ++index) {
+    BandwidthTimelineWindow& window = summary.windows[index];
+    if (std::fabs(window.bandwidth_gb_s - summary.windows[index - 1].bandwidth_gb_s) >
+        step_limit) {
+      window.frequency_transition = true;
+      ++summary.transition_window_count;
+    }
+  }
+  summary.analyzed = true;
+  return summary;
+}
@@ -0,0 +1,109 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file bandwidth_timeline.h
+ * @brief Intra-pass bandwidth timeline recording and analysis
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * `--bandwidth-timeline` turns one timed bandwidth run into a bandwidth-vs-time
+ * series. Workers publish cumulative payload bytes into private cache lines
+ * with relaxed stores; the coordinating thread snapshots the sum at a fixed
+ * interval. Analysis separates the ramp-up and tail from the steady state and
+ * flags steady-state windows whose rate steps away from the previous window,
+ * which is how a frequency transition or throttling event shows up.
+ */
+
+#ifndef BANDWIDTH_TIMELINE_H
+#define BANDWIDTH_TIMELINE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "core/config/constants.h"
+
+/** @brief Cumulative payload bytes completed by all workers at one instant. */
+struct BandwidthTimelineSample {
+  double elapsed_seconds = 0.0;
+  uint64_t completed_bytes = 0;
+};
+
+/** @brief One worker's progress counter, isolated on its own cache line. */
+struct alignas(Constants::BANDWIDTH_TIMELINE_SLOT_ISOLATION_BYTES) BandwidthProgressSlot {
+  std::atomic<uint64_t> completed_bytes{0};
+};
+
+/** @brief Per-run progress slots and the samples taken from them. */
+struct BandwidthTimelineRecorder {
+  std::unique_ptr<BandwidthProgressSlot[]> slots;
+  size_t slot_count = 0;
+  std::vector<BandwidthTimelineSample> samples;
+};
+
+enum class BandwidthTimelinePhase {
+  RampUp,
+  Steady,
+  Tail,
+};
+
+/** @brief Bandwidth between two consecutive samples. */
+struct BandwidthTimelineWindow {
+  double start_seconds = 0.0;
+  double end_seconds = 0.0;
+  double bandwidth_gb_s = 0.0;
+  BandwidthTimelinePhase phase = BandwidthTimelinePhase::Steady;
+  bool frequency_transition = false;  ///< Steady window stepping >10% from its predecessor
+};
+
+struct BandwidthTimelineSummary {
+  std::vector<BandwidthTimelineWindow> windows;
+  bool analyzed = false;  ///< False when there were too few windows to split phases
+  double ramp_up_seconds = 0.0;
+  std::optional<double> ramp_up_bandwidth_gb_s;  ///< Empty when no ramp-up was detected
+  std::optional<double> steady_state_bandwidth_gb_s;
+  size_t transition_window_count = 0;
+};
+
+const char* bandwidth_timeline_phase_to_string(BandwidthTimelinePhase phase);
+
+/**
+ * @brief Zero `worker_count` progress slots and seed the series with t = 0.
+ *
+ * Called before the timed run so that slot allocation stays outside it.
+ */
+void reset_bandwidth_timeline_recorder(BandwidthTimelineRecorder& recorder,
+                                       size_t worker_count);
+
+/** @brief Append the current sum of all progress slots at `elapsed_seconds`. */
+void record_bandwidth_timeline_sample(BandwidthTimelineRecorder& recorder,
+                                      double elapsed_seconds);
+
+/**
+ * @brief Turn cumulative samples into windows and split ramp/steady/tail.
+ *
+ * Leading and trailing windows more than 5% below the median window are the
+ * ramp-up and tail; steady-state bandwidth is the byte rate between them.
+ * Samples with no elapsed time since their predecessor are skipped.
+ */
+BandwidthTimelineSummary analyze_bandwidth_timeline(
+    const std::vector<BandwidthTimelineSample>& samples);
+
+#endif  // BANDWIDTH_TIMELINE_H
@@ -42,6 +42,10 @@
  */
  
 #include "benchmark/benchmark_executor.h"
+#include "benchmark/bandwidth_timeline.h"
+#include "benchmark/buffer_residency.h"
+#include "benchmark/core_frequency_probe.h"
+#include "benchmark/memory_kernels.h"
 #include "benchmark/benchmark_work_plan.h"
 #include "benchmark/parallel_test_framework.h"
 #include "core/memory/buffer_manager.h"  // BenchmarkBuffers
@@ -57,7 +61,9 @@
 #include <array>
 #include <atomic>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <optional>
 #include <stdexcept>
 #include <vector>
 
@@ -166,13 +172,30 @@ void finalize_loop_results(BenchmarkResults& results,
  * Standard benchmark execution allocates buffers immediately before a phase and
  * releases them when the local `BenchmarkBuffers` owner goes out of scope.
  * This helper centralizes the mode switch between regular mappings and the
- * best-effort cache-discouraging allocation path.
+ * best-effort cache-discouraging allocation path. With `--lock-buffers` the
+ * mapping is also wired with mlock(); a failure is folded into `lock` and the
+ * phase continues unlocked.
  */
-MmapPtr allocate_phase_buffer(const BenchmarkConfig& config, size_t size, const char* buffer_name) {
-  if (config.use_non_cacheable) {
-    return allocate_buffer_non_cacheable(size, buffer_name);
+MmapPtr allocate_phase_buffer(const BenchmarkConfig& config, size_t size, const char* buffer_name,
+                              BufferLockState& lock) {
+  MmapPtr buffer = config.use_non_cacheable ? allocate_buffer_non_cacheable(size, buffer_name)
+                                            : allocate_buffer(size, buffer_name);
+  if (buffer) {
+    lock_phase_buffer(buffer.get(), size, lock);
   }
-  return allocate_buffer(size, buffer_name);
+  return buffer;
+}
+
+// One warning per run: every later phase would fail for the same reason.
+void report_buffer_lock_failure(const BufferLockState& lock, BenchmarkExecutionState& state) {
+  if (!lock.requested || lock.locked || state.buffer_lock_failure_reported) {
+    return;
+  }
+  state.buffer_lock_failure_reported = true;
+  std::cerr << Messages::warning_prefix()
+            << Messages::warning_buffer_lock_failed(lock.error, std::strerror(lock.error),
+                                                    lock.memlock_limit_bytes)
+            << std::endl;
 }
 
 /**
@@ -183,17 +206,18 @@ MmapPtr allocate_phase_buffer(const BenchmarkConfig& config, size_t size, const
  * present at the same time, so this phase intentionally uses a 2x main-buffer
  * footprint.
  */
-int prepare_main_memory_bandwidth_buffers(const BenchmarkConfig& config, BenchmarkBuffers& buffers) {
+int prepare_main_memory_bandwidth_buffers(const BenchmarkConfig& config, BenchmarkBuffers& buffers,
+                                          BufferLockState& lock) {
   if (config.buffer_size == 0) {
     return EXIT_SUCCESS;
   }
 
-  buffers.src_buffer_ptr = allocate_phase_buffer(config, config.buffer_size, "src_buffer");
+  buffers.src_buffer_ptr = allocate_phase_buffer(config, config.buffer_size, "src_buffer", lock);
   if (!buffers.src_buffer_ptr) {
     return EXIT_FAILURE;
   }
 
-  buffers.dst_buffer_ptr = allocate_phase_buffer(config, config.buffer_size, "dst_buffer");
+  buffers.dst_buffer_ptr = allocate_phase_buffer(config, config.buffer_size, "dst_buffer", lock);
   if (!buffers.dst_buffer_ptr) {
     return EXIT_FAILURE;
   }
@@ -208,20 +232,21 @@ int prepare_main_memory_bandwidth_buffers(const BenchmarkConfig& config, Benchma
  * prepares L1 and L2 src/dst pairs. All initialization happens before measured
  * cache bandwidth kernels run.
  */
-int prepare_cache_bandwidth_buffers(const BenchmarkConfig& config, BenchmarkBuffers& buffers) {
+int prepare_cache_bandwidth_buffers(const BenchmarkConfig& config, BenchmarkBuffers& buffers,
+                                    BufferLockState& lock) {
   if (config.use_custom_cache_size) {
     if (config.custom_buffer_size == 0) {
       return EXIT_SUCCESS;
     }
 
     buffers.custom_bw_src_ptr =
-        allocate_phase_buffer(config, config.custom_buffer_size, "custom_bw_src_buffer");
+        allocate_phase_buffer(config, config.custom_buffer_size, "custom_bw_src_buffer", lock);
     if (!buffers.custom_bw_src_ptr) {
       return EXIT_FAILURE;
     }
 
     buffers.custom_bw_dst_ptr =
-        allocate_phase_buffer(config, config.custom_buffer_size, "custom_bw_dst_buffer");
+        allocate_phase_buffer(config, config.custom_buffer_size, "custom_bw_dst_buffer", lock);
     if (!buffers.custom_bw_dst_ptr) {
       return EXIT_FAILURE;
     }
@@ -231,12 +256,12 @@ int prepare_cache_bandwidth_buffers(const BenchmarkConfig& config, BenchmarkBuff
   }
 
   if (config.l1_buffer_size > 0) {
-    buffers.l1_bw_src_ptr = allocate_phase_buffer(config, config.l1_buffer_size, "l1_bw_src_buffer");
+    buffers.l1_bw_src_ptr = allocate_phase_buffer(config, config.l1_buffer_size, "l1_bw_src_buffer", lock);
     if (!buffers.l1_bw_src_ptr) {
       return EXIT_FAILURE;
     }
 
-    buffers.l1_bw_dst_ptr = allocate_phase_buffer(config, config.l1_buffer_size, "l1_bw_dst_buffer");
+    buffers.l1_bw_dst_ptr = allocate_phase_buffer(config, config.l1_buffer_size, "l1_bw_dst_buffer", lock);
     if (!buffers.l1_bw_dst_ptr) {
       return EXIT_FAILURE;
     }
@@ -248,12 +273,12 @@ int prepare_cache_bandwidth_buffers(const BenchmarkConfig& config, BenchmarkBuff
   }
 
   if (config.l2_buffer_size > 0) {
-    buffers.l2_bw_src_ptr = allocate_phase_buffer(config, config.l2_buffer_size, "l2_bw_src_buffer");
+    buffers.l2_bw_src_ptr = allocate_phase_buffer(config, config.l2_buffer_size, "l2_bw_src_buffer", lock);
     if (!buffers.l2_bw_src_ptr) {
       return EXIT_FAILURE;
     }
 
-    buffers.l2_bw_dst_ptr = allocate_phase_buffer(config, config.l2_buffer_size, "l2_bw_dst_buffer");
+    buffers.l2_bw_dst_ptr = allocate_phase_buffer(config, config.l2_buffer_size, "l2_bw_dst_buffer", lock);
     if (!buffers.l2_bw_dst_ptr) {
       return EXIT_FAILURE;
     }
@@ -272,13 +297,14 @@ int prepare_cache_bandwidth_buffers(const BenchmarkConfig& config, BenchmarkBuff
  *
  * Builds latency chains using current stride/locality settings.
  */
-int prepare_cache_latency_buffers(BenchmarkConfig& config, BenchmarkBuffers& buffers) {
+int prepare_cache_latency_buffers(BenchmarkConfig& config, BenchmarkBuffers& buffers,
+                                  BufferLockState& lock) {
   if (config.use_custom_cache_size) {
     if (config.custom_buffer_size == 0) {
       return EXIT_SUCCESS;
     }
 
-    buffers.custom_buffer_ptr = allocate_phase_buffer(config, config.custom_buffer_size, "custom_buffer");
+    buffers.custom_buffer_ptr = allocate_phase_buffer(config, config.custom_buffer_size, "custom_buffer", lock);
     if (!buffers.custom_buffer_ptr) {
       return EXIT_FAILURE;
     }
@@ -294,7 +320,7 @@ int prepare_cache_latency_buffers(BenchmarkConfig& config, BenchmarkBuffers& buf
   }
 
   if (config.l1_buffer_size > 0) {
-    buffers.l1_buffer_ptr = allocate_phase_buffer(config, config.l1_buffer_size, "l1_buffer");
+    buffers.l1_buffer_ptr = allocate_phase_buffer(config, config.l1_buffer_size, "l1_buffer", lock);
     if (!buffers.l1_buffer_ptr) {
       return EXIT_FAILURE;
     }
@@ -312,7 +338,7 @@ int prepare_cache_latency_buffers(BenchmarkConfig& config, BenchmarkBuffers& buf
   }
 
   if (config.l2_buffer_size > 0) {
-    buffers.l2_buffer_ptr = allocate_phase_buffer(config, config.l2_buffer_size, "l2_buffer");
+    buffers.l2_buffer_ptr = allocate_phase_buffer(config, config.l2_buffer_size, "l2_buffer", lock);
     if (!buffers.l2_buffer_ptr) {
       return EXIT_FAILURE;
     }
@@ -338,12 +364,13 @@ int prepare_cache_latency_buffers(BenchmarkConfig& config, BenchmarkBuffers& buf
  * This path is skipped when main latency is disabled (zero main buffer or zero
  * configured accesses). Chain setup is completed before timing starts.
  */
-int prepare_main_memory_latency_buffer(BenchmarkConfig& config, BenchmarkBuffers& buffers) {
+int prepare_main_memory_latency_buffer(BenchmarkConfig& config, BenchmarkBuffers& buffers,
+                                       BufferLockState& lock) {
   if (config.buffer_size == 0 || config.lat_num_accesses == 0) {
     return EXIT_SUCCESS;
   }
 
-  buffers.lat_buffer_ptr = allocate_phase_buffer(config, config.buffer_size, "lat_buffer");
+  buffers.lat_buffer_ptr = allocate_phase_buffer(config, config.buffer_size, "lat_buffer", lock);
   if (!buffers.lat_buffer_ptr) {
     return EXIT_FAILURE;
   }
@@ -528,32 +555,51 @@ double execute_bandwidth_plan(void* src_buffer,
                               void* dst_buffer,
                               const BenchmarkWorkPlan& plan,
                               HighResTimer& timer,
-                              ParallelExecutionMetadata* execution_metadata) {
+                              ParallelExecutionMetadata* execution_metadata,
+                              BandwidthTimelineRecorder* timeline = nullptr,
+                              CoreFrequencyProbeRecord* frequency = nullptr) {
   const bool cache_target = plan.target != BenchmarkTarget::MainMemory;
+  const MemoryKernelSet& kernels =
+      plan.kernels != nullptr ? *plan.kernels : memory_kernel_set(MemoryKernelVariant::Neon);
   switch (plan.operation) {
     case BenchmarkOperation::Read: {
       uint64_t checksum = 0;
       return run_read_test_with_plan(
           src_buffer, plan, checksum, timer,
-          cache_target ? memory_read_cache_loop_asm : memory_read_loop_asm,
-          execution_metadata);
+          cache_target ? memory_read_cache_loop_asm : kernels.read,
+          execution_metadata, timeline, frequency);
     }
     case BenchmarkOperation::Write:
       return run_write_test_with_plan(
           dst_buffer, plan, timer,
-          cache_target ? memory_write_cache_loop_asm : memory_write_loop_asm,
-          execution_metadata);
+          cache_target ? memory_write_cache_loop_asm : kernels.write,
+          execution_metadata, timeline, frequency);
     case BenchmarkOperation::Copy:
       return run_copy_test_with_plan(
           dst_buffer, src_buffer, plan, timer,
-          cache_target ? memory_copy_cache_loop_asm : memory_copy_loop_asm,
-          execution_metadata);
+          cache_target ? memory_copy_cache_loop_asm : kernels.copy,
+          execution_metadata, timeline, frequency);
     case BenchmarkOperation::Latency:
       return 0.0;
   }
   return 0.0;
 }
 
+// Read touches only the source, write only the destination, copy both.
+std::vector<BufferRange> bandwidth_residency_ranges(const void* src_buffer,
+                                                    const void* dst_buffer,
+                                                    size_t buffer_size,
+                                                    BenchmarkOperation operation) {
+  std::vector<BufferRange> ranges;
+  if (operation != BenchmarkOperation::Write) {
+    ranges.push_back({src_buffer, buffer_size});
+  }
+  if (operation != BenchmarkOperation::Read) {
+    ranges.push_back({dst_buffer, buffer_size});
+  }
+  return ranges;
+}
+
 void populate_parallel_execution_metadata(
     BenchmarkMeasurement& measurement,
     const ParallelExecutionMetadata& execution_metadata) {
@@ -582,6 +628,9 @@ void populate_bandwidth_metadata(BenchmarkMeasurement& measurement,
   const BenchmarkWorkPlan& plan = state.plan;
   measurement.target = benchmark_target_to_string(plan.target);
   measurement.operation = benchmark_operation_to_string(plan.operation);
+  measurement.kernel_variant =
+      plan.kernels != nullptr ? plan.kernels->name
+                              : memory_kernel_variant_to_string(MemoryKernelVariant::Neon);
   measurement.buffer_size_bytes = plan.buffer_size_bytes;
   measurement.passes = plan.passes;
   measurement.exact_payload_bytes = plan.total_payload_bytes;
@@ -597,10 +646,15 @@ void populate_bandwidth_metadata(BenchmarkMeasurement& measurement,
 void run_calibrated_bandwidth_measurement(
     void* src_buffer, void* dst_buffer, size_t buffer_size, int requested_threads,
     BenchmarkTarget target, BenchmarkOperation operation,
+    const MemoryKernelSet& main_kernels,
     bool explicit_iterations, size_t explicit_passes,
     BenchmarkBandwidthExecutionState& state, BenchmarkMeasurement& measurement,
-    HighResTimer& timer, size_t phase_order_index, size_t operation_order_index) {
+    HighResTimer& timer, size_t phase_order_index, size_t operation_order_index,
+    bool record_timeline, const BufferLockState& buffer_lock) {
   const bool first_execution = !state.initialized;
+  // Cache-resident targets keep their dedicated NEON kernels on every host.
+  const MemoryKernelSet* kernels =
+      target == BenchmarkTarget::MainMemory ? &main_kernels : nullptr;
   measurement.automatic_calibration = !explicit_iterations;
   measurement.work_policy = explicit_iterations ? "explicit-iterations"
                                                 : "automatic-duration-calibration";
@@ -617,6 +671,7 @@ void run_calibrated_bandwidth_measurement(
     }
     BenchmarkWorkPlan initial_plan = build_benchmark_bandwidth_work_plan(
         buffer_size, requested_threads, initial_passes, target, operation);
+    initial_plan.kernels = kernels;
     if (initial_plan.status != BenchmarkMeasurementStatus::Measured) {
       set_measurement_unavailable(measurement, initial_plan.status,
                                   initial_plan.status_reason);
@@ -647,6 +702,7 @@ void run_calibrated_bandwidth_measurement(
       }
       state.plan = build_benchmark_bandwidth_work_plan(
           buffer_size, requested_threads, calibrated_passes, target, operation);
+      state.plan.kernels = kernels;
     } else {
       state.plan = std::move(initial_plan);
       state.duration_quality = "explicit-work-policy";
@@ -660,11 +716,21 @@ void run_calibrated_bandwidth_measurement(
 
   double elapsed_seconds = 0.0;
   ParallelExecutionMetadata execution_metadata;
+  // Only the accepted attempt's series survives; earlier attempts reset it.
+  BandwidthTimelineRecorder timeline_recorder;
+  CoreFrequencyProbeRecord frequency_record;
+  const std::vector<BufferRange> residency_ranges =
+      bandwidth_residency_ranges(src_buffer, dst_buffer, buffer_size, operation);
+  std::optional<size_t> resident_pages_before;
+  std::optional<size_t> resident_pages_after;
   for (size_t attempt = 0;; ++attempt) {
     show_progress();
     warmup_bandwidth_operation(src_buffer, dst_buffer, state.plan);
-    elapsed_seconds = execute_bandwidth_plan(src_buffer, dst_buffer, state.plan,
-                                             timer, &execution_metadata);
+    resident_pages_before = count_resident_pages(residency_ranges);
+    elapsed_seconds = execute_bandwidth_plan(
+        src_buffer, dst_buffer, state.plan, timer, &execution_metadata,
+        record_timeline ? &timeline_recorder : nullptr, &frequency_record);
+    resident_pages_after = count_resident_pages(residency_ranges);
     if (signal_received()) {
       populate_bandwidth_metadata(measurement, state, phase_order_index,
                                   operation_order_index);
@@ -704,6 +770,9 @@ void run_calibrated_bandwidth_measurement(
   populate_bandwidth_metadata(measurement, state, phase_order_index,
                               operation_order_index);
   populate_parallel_execution_metadata(measurement, execution_metadata);
+  measurement.residency = make_buffer_residency(
+      buffer_lock, count_buffer_pages(residency_ranges), resident_pages_before,
+      resident_pages_after, execution_metadata.timed_page_faults);
   measurement.duration_within_target =
       explicit_iterations ||
       benchmark_duration_in_window(
@@ -725,6 +794,10 @@ void run_calibrated_bandwidth_measurement(
     return;
   }
   set_measurement_value(measurement, bandwidth_gb_s, elapsed_seconds);
+  if (record_timeline) {
+    measurement.timeline = analyze_bandwidth_timeline(timeline_recorder.samples);
+  }
+  measurement.core_frequency = summarize_core_frequency_probes(frequency_record);
 }
 
 void populate_latency_metadata(BenchmarkMeasurement& measurement,
@@ -752,7 +825,8 @@ void run_calibrated_latency_measurement(
     void* buffer, size_t buffer_size, size_t stride_bytes,
     size_t fallback_access_count, BenchmarkTarget target, uint64_t seed,
     BenchmarkLatencyExecutionState& state, BenchmarkMeasurement& measurement,
-    HighResTimer& timer, int sample_count, size_t phase_order_index) {
+    HighResTimer& timer, int sample_count, size_t phase_order_index,
+    const BufferLockState& buffer_lock) {
   const bool first_execution = !state.initialized;
   const size_t node_count = stride_bytes == 0 ? 0 : buffer_size / stride_bytes;
   if (first_execution) {
@@ -801,11 +875,23 @@ void run_calibrated_latency_measurement(
   }
 
   double elapsed_ns = 0.0;
+  CoreFrequencyProbeRecord frequency_record;
+  const std::vector<BufferRange> residency_ranges = {{buffer, buffer_size}};
+  std::optional<size_t> resident_pages_before;
+  std::optional<size_t> resident_pages_after;
+  PageFaultCounts timed_faults;
   for (size_t attempt = 0;; ++attempt) {
     show_progress();
     warmup_latency(buffer, buffer_size);
+    resident_pages_before = count_resident_pages(residency_ranges);
+    reset_core_frequency_probe_record(frequency_record, 1);
+    frequency_record.before_ghz[0] = measure_core_frequency_ghz(timer);
+    const PageFaultCounts faults_before = read_process_page_faults();
     elapsed_ns = run_latency_test(buffer, state.plan.access_count, timer,
                                   nullptr, 0);
+    timed_faults = page_faults_between(faults_before, read_process_page_faults());
+    frequency_record.after_ghz[0] = measure_core_frequency_ghz(timer);
+    resident_pages_after = count_resident_pages(residency_ranges);
     const double elapsed_seconds = elapsed_ns / Constants::NANOSECONDS_PER_SECOND;
     if (signal_received()) {
       populate_latency_metadata(measurement, state, phase_order_index);
@@ -855,6 +941,9 @@ void run_calibrated_latency_measurement(
       minimum_cycles_limit_duration);
   state.initialized = true;
   populate_latency_metadata(measurement, state, phase_order_index);
+  measurement.residency = make_buffer_residency(
+      buffer_lock, count_buffer_pages(residency_ranges), resident_pages_before,
+      resident_pages_after, timed_faults);
   measurement.duration_within_target = benchmark_duration_in_window(
       elapsed_seconds, Constants::BENCHMARK_LATENCY_CALIBRATION_MIN_SECONDS,
       Constants::BENCHMARK_LATENCY_CALIBRATION_MAX_SECONDS);
@@ -868,6 +957,7 @@ void run_calibrated_latency_measurement(
   set_measurement_value(measurement,
                         elapsed_ns / static_cast<double>(state.plan.access_count),
                         elapsed_seconds);
+  measurement.core_frequency = summarize_core_frequency_probes(frequency_record);
   if (sample_count > 0) {
     (void)run_latency_test(buffer, state.plan.access_count, timer,
                            &measurement.samples, sample_count);
@@ -969,6 +1059,8 @@ BenchmarkResults run_single_benchmark_loop(BenchmarkConfig& config,
       BenchmarkOperation::Copy};
   const std::vector<size_t> operation_order =
       build_benchmark_cyclic_order(operations.size(), results.loop_index);
+  const MemoryKernelSet& main_kernels = resolve_memory_kernel_set(
+      config.memory_kernel_name, config.memory_kernel_variant);
 
   auto measurement_for_operation = [](BenchmarkOperation operation,
                                       BenchmarkMeasurement& read,
@@ -980,6 +1072,9 @@ BenchmarkResults run_single_benchmark_loop(BenchmarkConfig& config,
     return copy;
   };
 
+  // Lock outcome of the phase currently executing; read by the target lambdas.
+  BufferLockState phase_lock;
+
   auto run_bandwidth_target = [&](void* src_buffer, void* dst_buffer,
                                   size_t buffer_size, int requested_threads,
                                   BenchmarkTarget target,
@@ -997,9 +1092,10 @@ BenchmarkResults run_single_benchmark_loop(BenchmarkConfig& config,
           operation, read, write, copy);
       run_calibrated_bandwidth_measurement(
           src_buffer, dst_buffer, buffer_size, requested_threads, target,
-          operation, config.user_specified_iterations,
+          operation, main_kernels, config.user_specified_iterations,
           static_cast<size_t>(config.iterations), operation_state, measurement,
-          test_timer, phase_position, operation_position);
+          test_timer, phase_position, operation_position,
+          config.bandwidth_timeline, phase_lock);
       if (signal_received()) return;
     }
   };
@@ -1022,7 +1118,8 @@ BenchmarkResults run_single_benchmark_loop(BenchmarkConfig& config,
         buffer, buffer_size, config.latency_stride_bytes,
         fallback_access_count, target,
         derive_benchmark_seed(config.benchmark_seed, domain), latency_state,
-        measurement, test_timer, config.latency_sample_count, phase_position);
+        measurement, test_timer, config.latency_sample_count, phase_position,
+        phase_lock);
     measurement.qos_successful_workers = config.main_thread_qos_applied ? 1 : 0;
     measurement.qos_failed_workers =
         config.main_thread_qos_requested && !config.main_thread_qos_applied ? 1 : 0;
@@ -1058,12 +1155,14 @@ BenchmarkResults run_single_benchmark_loop(BenchmarkConfig& config,
       switch (enabled_phase.phase) {
         case Phase::MainBandwidth: {
           BenchmarkBuffers phase_buffers;
-          if (prepare_main_memory_bandwidth_buffers(config, phase_buffers) !=
+          phase_lock = make_buffer_lock_state(config.lock_buffers);
+          if (prepare_main_memory_bandwidth_buffers(config, phase_buffers, phase_lock) !=
               EXIT_SUCCESS) {
             throw std::runtime_error(
                 Messages::benchmark_reason_prepare_failed(
                     "main-memory bandwidth"));
           }
+          report_buffer_lock_failure(phase_lock, state);
           run_bandwidth_target(
               phase_buffers.src_buffer(), phase_buffers.dst_buffer(),
               config.buffer_size, config.num_threads,
@@ -1074,11 +1173,13 @@ BenchmarkResults run_single_benchmark_loop(BenchmarkConfig& config,
         }
         case Phase::CacheBandwidth: {
           BenchmarkBuffers phase_buffers;
-          if (prepare_cache_bandwidth_buffers(config, phase_buffers) !=
+          phase_lock = make_buffer_lock_state(config.lock_buffers);
+          if (prepare_cache_bandwidth_buffers(config, phase_buffers, phase_lock) !=
               EXIT_SUCCESS) {
             throw std::runtime_error(Messages::benchmark_reason_prepare_failed(
                 "cache bandwidth"));
           }
+          report_buffer_lock_failure(phase_lock, state);
           const int cache_threads = config.user_specified_threads
                                         ? config.num_threads
                                         : Constants::SINGLE_THREAD;
@@ -1109,11 +1210,13 @@ BenchmarkResults run_single_benchmark_loop(BenchmarkConfig& config,
         }
         case Phase::CacheLatency: {
           BenchmarkBuffers phase_buffers;
-          if (prepare_cache_latency_buffers(config, phase_buffers) !=
+          phase_lock = make_buffer_lock_state(config.lock_buffers);
+          if (prepare_cache_latency_buffers(config, phase_buffers, phase_lock) !=
               EXIT_SUCCESS) {
             throw std::runtime_error(Messages::benchmark_reason_prepare_failed(
                 "cache latency"));
           }
+          report_buffer_lock_failure(phase_lock, state);
           if (config.use_custom_cache_size) {
             run_latency_target(
                 phase_buffers.custom_buffer(), config.custom_buffer_size,
@@ -1137,12 +1240,14 @@ BenchmarkResults run_single_benchmark_loop(BenchmarkConfig& config,
         }
         case Phase::MainLatency: {
           BenchmarkBuffers phase_buffers;
-          if (prepare_main_memory_latency_buffer(config, phase_buffers) !=
+          phase_lock = make_buffer_lock_state(config.lock_buffers);
+          if (prepare_main_memory_latency_buffer(config, phase_buffers, phase_lock) !=
               EXIT_SUCCESS) {
             throw std::runtime_error(
                 Messages::benchmark_reason_prepare_failed(
                     "main-memory latency"));
           }
+          report_buffer_lock_failure(phase_lock, state);
           run_latency_target(phase_buffers.lat_buffer(), config.buffer_size,
                              config.lat_num_accesses,
                              BenchmarkTarget::MainMemory,
@@ -27,6 +27,10 @@
 #include <string>
 #include <vector>
 
+#include "benchmark/bandwidth_timeline.h"
+#include "benchmark/buffer_residency.h"
+#include "benchmark/core_frequency_probe.h"
+
 enum class BenchmarkMeasurementStatus {
   NotRun,
   Measured,
@@ -97,6 +101,7 @@ struct BenchmarkMeasurement {
   std::string work_policy;
   std::string target;
   std::string operation;
+  std::string kernel_variant;
   std::string qos_outcome = "best-effort-request-not-observed";
   int created_workers = 0;
   size_t qos_successful_workers = 0;
@@ -116,6 +121,9 @@ struct BenchmarkMeasurement {
   size_t operation_order_index = 0;
   std::vector<double> samples;
   std::vector<uint64_t> sample_seeds;
+  std::optional<BandwidthTimelineSummary> timeline;  ///< Set by --bandwidth-timeline
+  std::optional<CoreFrequencySummary> core_frequency;  ///< Add-chain probes around the accepted run
+  std::optional<BufferResidency> residency;  ///< Resident pages and faults around the accepted run
 
   bool is_measured() const {
     return status == BenchmarkMeasurementStatus::Measured && value.has_value();
@@ -36,8 +36,13 @@
 
 #include "benchmark/benchmark_statistics_collector.h"
 #include "benchmark/benchmark_runner.h"  // BenchmarkStatistics, BenchmarkResults
+#include "benchmark/core_frequency_probe.h"  // core_frequency_drift_pct
 #include "core/config/config.h"           // BenchmarkConfig
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 namespace {
 
 void append_measured_value(std::vector<double>& values,
@@ -268,3 +273,58 @@ void collect_loop_results(BenchmarkStatistics& stats, const BenchmarkResults& lo
     }
   }
 }
+
+/**
+ * @brief Find the measurement whose probed core frequency varied most across loops.
+ *
+ * Compares each measured loop's effective frequency (mean of the before and
+ * after probe medians) for the same measurement slot. A large spread means the
+ * loops ran at different clocks, so their memory results differ for reasons
+ * other than the memory subsystem.
+ *
+ * @param[in] stats Statistics holding every loop's results
+ * @return The largest drift, or nullopt when no measurement was probed in two or more loops
+ */
+std::optional<CoreFrequencyLoopDrift> find_largest_core_frequency_drift(
+    const BenchmarkStatistics& stats) {
+  using MeasurementMember = BenchmarkMeasurement BenchmarkResults::*;
+  static const std::pair<const char*, MeasurementMember> kMeasurements[] = {
+      {"main_read_bandwidth", &BenchmarkResults::main_read_bandwidth},
+      {"main_write_bandwidth", &BenchmarkResults::main_write_bandwidth},
+      {"main_copy_bandwidth", &BenchmarkResults::main_copy_bandwidth},
+      {"main_latency", &BenchmarkResults::main_latency},
+      {"l1_read_bandwidth", &BenchmarkResults::l1_read_bandwidth},
+      {"l1_write_bandwidth", &BenchmarkResults::l1_write_bandwidth},
+      {"l1_copy_bandwidth", &BenchmarkResults::l1_copy_bandwidth},
+      {"l1_latency", &BenchmarkResults::l1_latency},
+      {"l2_read_bandwidth", &BenchmarkResults::l2_read_bandwidth},
+      {"l2_write_bandwidth", &BenchmarkResults::l2_write_bandwidth},
+      {"l2_copy_bandwidth", &BenchmarkResults::l2_copy_bandwidth},
+      {"l2_latency", &BenchmarkResults::l2_latency},
+      {"custom_read_bandwidth", &BenchmarkResults::custom_read_bandwidth},
+      {"custom_write_bandwidth", &BenchmarkResults::custom_write_bandwidth},
+      {"custom_copy_bandwidth", &BenchmarkResults::custom_copy_bandwidth},
+      {"custom_latency", &BenchmarkResults::custom_latency},
+  };
+
+  std::optional<CoreFrequencyLoopDrift> largest;
+  for (const auto& [name, member] : kMeasurements) {
+    std::vector<double> frequencies;
+    for (const BenchmarkResults& loop : stats.loop_results) {
+      const BenchmarkMeasurement& measurement = loop.*member;
+      if (measurement.is_measured() && measurement.core_frequency.has_value()) {
+        frequencies.push_back(measurement.core_frequency->effective_ghz);
+      }
+    }
+    if (frequencies.size() < 2) {
+      continue;
+    }
+    const double drift_pct = core_frequency_drift_pct(frequencies);
+    if (!largest.has_value() || drift_pct > largest->drift_pct) {
+      const auto [minimum, maximum] =
+          std::minmax_element(frequencies.begin(), frequencies.end());
+      largest = CoreFrequencyLoopDrift{name, *minimum, *maximum, drift_pct};
+    }
+  }
+  return largest;
+}
@@ -25,6 +25,9 @@
 #ifndef BENCHMARK_STATISTICS_COLLECTOR_H
 #define BENCHMARK_STATISTICS_COLLECTOR_H
 
+#include <optional>
+#include <string>
+
 // Forward declarations
 struct BenchmarkStatistics;
 struct BenchmarkConfig;
@@ -51,5 +54,23 @@ void initialize_statistics(BenchmarkStatistics& stats, const BenchmarkConfig& co
  */
 void collect_loop_results(BenchmarkStatistics& stats, const BenchmarkResults& loop_results, const BenchmarkConfig& config);
 
+/**
+ * @brief Largest cross-loop spread of one measurement's effective core frequency
+ */
+struct CoreFrequencyLoopDrift {
+  std::string measurement_name;  ///< JSON measurement key, e.g. "main_read_bandwidth"
+  double min_ghz = 0.0;
+  double max_ghz = 0.0;
+  double drift_pct = 0.0;
+};
+
+/**
+ * @brief Find the measurement whose probed core frequency varied most across loops
+ * @param stats Statistics holding every loop's results
+ * @return The largest drift, or nullopt when no measurement was probed in two or more loops
+ */
+std::optional<CoreFrequencyLoopDrift> find_largest_core_frequency_drift(
+    const BenchmarkStatistics& stats);
+
 #endif // BENCHMARK_STATISTICS_COLLECTOR_H
 
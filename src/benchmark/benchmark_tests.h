@@ -35,6 +35,8 @@
 // Forward declaration
 struct HighResTimer;
 struct ParallelExecutionMetadata;
+struct BandwidthTimelineRecorder;
+struct CoreFrequencyProbeRecord;
 
 /** Optional kernel seam for deterministic latency sampling tests. */
 struct LatencyMeasurementTestHooks {
@@ -47,7 +49,9 @@ double run_read_test_with_plan(void* buffer,
                                uint64_t& checksum,
                                HighResTimer& timer,
                                uint64_t (*read_func)(const void*, size_t),
-                               ParallelExecutionMetadata* execution_metadata = nullptr);
+                               ParallelExecutionMetadata* execution_metadata = nullptr,
+                               BandwidthTimelineRecorder* timeline = nullptr,
+                               CoreFrequencyProbeRecord* frequency = nullptr);
 
 /**
  * @brief Run write benchmark test
@@ -64,7 +68,9 @@ double run_write_test_with_plan(void* buffer,
                                 const BenchmarkWorkPlan& plan,
                                 HighResTimer& timer,
                                 void (*write_func)(void*, size_t),
-                                ParallelExecutionMetadata* execution_metadata = nullptr);
+                                ParallelExecutionMetadata* execution_metadata = nullptr,
+                                BandwidthTimelineRecorder* timeline = nullptr,
+                                CoreFrequencyProbeRecord* frequency = nullptr);
 
 /**
  * @brief Run copy benchmark test
@@ -83,7 +89,9 @@ double run_copy_test_with_plan(void* dst,
                                const BenchmarkWorkPlan& plan,
                                HighResTimer& timer,
                                void (*copy_func)(void*, const void*, size_t),
-                               ParallelExecutionMetadata* execution_metadata = nullptr);
+                               ParallelExecutionMetadata* execution_metadata = nullptr,
+                               BandwidthTimelineRecorder* timeline = nullptr,
+                               CoreFrequencyProbeRecord* frequency = nullptr);
 
 /**
  * @brief Run latency benchmark test
@@ -30,6 +30,8 @@
 
 #include "benchmark/benchmark_measurement.h"
 
+struct MemoryKernelSet;
+
 enum class BenchmarkTarget {
   MainMemory,
   L1,
@@ -54,6 +56,7 @@ struct BenchmarkWorkPlan {
   std::string status_reason;
   BenchmarkTarget target = BenchmarkTarget::MainMemory;
   BenchmarkOperation operation = BenchmarkOperation::Read;
+  const MemoryKernelSet* kernels = nullptr;  ///< Main-memory kernels; nullptr uses NEON
   size_t buffer_size_bytes = 0;
   int requested_threads = 0;
   int effective_threads = 0;
@@ -96,6 +99,7 @@ struct BenchmarkLatencyExecutionState {
 struct BenchmarkExecutionState {
   std::array<BenchmarkBandwidthExecutionState, 12> bandwidth;
   std::array<BenchmarkLatencyExecutionState, 4> latency;
+  bool buffer_lock_failure_reported = false;  ///< --lock-buffers warning already printed
 };
 
 /** @brief Result of executing a cold-path phase schedule with stop checks. */
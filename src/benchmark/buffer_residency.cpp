@@ -0,0 +1,150 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file buffer_residency.cpp
+ * @brief Buffer locking, page residency, and page-fault accounting
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include "benchmark/buffer_residency.h"
+
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+
+namespace {
+
+// mincore() fills char on macOS and unsigned char on Linux.
+#if defined(__APPLE__)
+using MincoreEntry = char;
+#else
+using MincoreEntry = unsigned char;
+#endif
+
+size_t vm_page_size() {
+  return static_cast<size_t>(getpagesize());
+}
+
+// Page-aligned start and page count of one range.
+void page_span(const BufferRange& range, uintptr_t& start, size_t& pages) {
+  const size_t page_size = vm_page_size();
+  const uintptr_t address = reinterpret_cast<uintptr_t>(range.data);
+  start = address & ~(static_cast<uintptr_t>(page_size) - 1);
+  const size_t span = static_cast<size_t>(address - start) + range.bytes;
+  pages = range.bytes == 0 ? 0 : (span + page_size - 1) / page_size;
+}
+
+}  // namespace
+
+PageFaultCounts read_process_page_faults() {
+  PageFaultCounts counts;
+  struct rusage usage {};
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+    counts.minor = static_cast<uint64_t>(usage.ru_minflt);
+    counts.major = static_cast<uint64_t>(usage.ru_majflt);
+  }
+  return counts;
+}
+
+PageFaultCounts page_faults_between(const PageFaultCounts& before, const PageFaultCounts& after) {
+  PageFaultCounts delta;
+  delta.minor = after.minor > before.minor ? after.minor - before.minor : 0;
+  delta.major = after.major > before.major ? after.major - before.major : 0;
+  return delta;
+}
+
+size_t count_buffer_pages(const std::vector<BufferRange>& ranges) {
+  size_t total = 0;
+  for (const BufferRange& range : ranges) {
+    uintptr_t start = 0;
+    size_t pages = 0;
+    page_span(range, start, pages);
+    total += pages;
+  }
+  return total;
+}
+
+std::optional<size_t> count_resident_pages(const std::vector<BufferRange>& ranges) {
+  size_t resident = 0;
+  std::vector<MincoreEntry> entries;
+  for (const BufferRange& range : ranges) {
+    uintptr_t start = 0;
+    size_t pages = 0;
+    page_span(range, start, pages);
+    if (pages == 0) {
+      continue;
+    }
+    entries.assign(pages, 0);
+    if (mincore(reinterpret_cast<void*>(start), pages * vm_page_size(), entries.data()) != 0) {
+      return std::nullopt;
+    }
+    for (const MincoreEntry entry : entries) {
+      // Bit 0 is MINCORE_INCORE on macOS and the residency bit on Linux.
+      resident += (static_cast<unsigned>(entry) & 0x1u) != 0 ? 1 : 0;
+    }
+  }
+  return resident;
+}
+
+BufferLockState make_buffer_lock_state(bool requested) {
+  BufferLockState state;
+  state.requested = requested;
+  state.locked = requested;
+  return state;
+}
+
+void lock_phase_buffer(void* data, size_t bytes, BufferLockState& state) {
+  if (!state.requested || data == nullptr || bytes == 0) {
+    return;
+  }
+  if (mlock(data, bytes) == 0) {
+    return;
+  }
+  if (state.error == 0) {
+    state.error = errno;
+    struct rlimit limit {};
+    if (getrlimit(RLIMIT_MEMLOCK, &limit) == 0 && limit.rlim_cur != RLIM_INFINITY) {
+      state.memlock_limit_bytes = static_cast<uint64_t>(limit.rlim_cur);
+    }
+  }
+  state.locked = false;
+}
+
+BufferResidency make_buffer_residency(const BufferLockState& lock,
+                                      size_t buffer_pages,
+                                      const std::optional<size_t>& resident_pages_before,
+                                      const std::optional<size_t>& resident_pages_after,
+                                      const PageFaultCounts& timed_faults) {
+  BufferResidency residency;
+  residency.lock_requested = lock.requested;
+  residency.locked = lock.locked;
+  residency.lock_error = lock.error;
+  residency.buffer_pages = buffer_pages;
+  residency.resident_pages_before = resident_pages_before;
+  residency.resident_pages_after = resident_pages_after;
+  residency.minor_faults = timed_faults.minor;
+  residency.major_faults = timed_faults.major;
+  return residency;
+}
+
+bool buffer_residency_took_faults(const BufferResidency& residency) {
+  return residency.minor_faults > 0 || residency.major_faults > 0;
+}
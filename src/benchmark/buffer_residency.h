@@ -0,0 +1,104 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file buffer_residency.h
+ * @brief Buffer locking, page residency, and page-fault accounting
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Buffer size alone does not prove that a measured buffer stays resident:
+ * under memory pressure its pages can be compressed or reclaimed between
+ * loops and silently fault back in inside the timed region. Standard
+ * benchmark measurements therefore count resident pages with mincore()
+ * before and after the accepted timed run and record the process page
+ * faults taken while the timer ran. `--lock-buffers` additionally wires
+ * each phase buffer with mlock().
+ */
+
+#ifndef BUFFER_RESIDENCY_H
+#define BUFFER_RESIDENCY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+/** @brief Process-wide page-fault counters from getrusage(RUSAGE_SELF). */
+struct PageFaultCounts {
+  uint64_t minor = 0;  ///< Faults served without I/O (including decompression)
+  uint64_t major = 0;  ///< Faults that required I/O
+};
+
+/** @brief One measured mapping. */
+struct BufferRange {
+  const void* data = nullptr;
+  size_t bytes = 0;
+};
+
+/** @brief mlock() outcome across every buffer of one phase. */
+struct BufferLockState {
+  bool requested = false;
+  bool locked = false;  ///< True only when every buffer of the phase was locked
+  int error = 0;        ///< errno of the first failed mlock()
+  std::optional<uint64_t> memlock_limit_bytes;  ///< RLIMIT_MEMLOCK soft limit; nullopt when unlimited
+};
+
+/** @brief Residency and faults of the measured buffers around one timed run. */
+struct BufferResidency {
+  bool lock_requested = false;
+  bool locked = false;
+  int lock_error = 0;
+  size_t buffer_pages = 0;
+  std::optional<size_t> resident_pages_before;  ///< nullopt when mincore() failed
+  std::optional<size_t> resident_pages_after;
+  uint64_t minor_faults = 0;
+  uint64_t major_faults = 0;
+};
+
+PageFaultCounts read_process_page_faults();
+
+/** @brief `after - before` per counter, clamped at zero. */
+PageFaultCounts page_faults_between(const PageFaultCounts& before, const PageFaultCounts& after);
+
+/** @brief VM pages spanned by `ranges`, counting each range from its page start. */
+size_t count_buffer_pages(const std::vector<BufferRange>& ranges);
+
+/** @brief Resident VM pages of `ranges` per mincore(); nullopt when any call fails. */
+std::optional<size_t> count_resident_pages(const std::vector<BufferRange>& ranges);
+
+/**
+ * @brief Begin a phase's lock state; `requested` false leaves it unlocked.
+ *
+ * A requested state starts locked and is cleared by the first failing
+ * lock_phase_buffer() call.
+ */
+BufferLockState make_buffer_lock_state(bool requested);
+
+/** @brief mlock() one phase buffer and fold the outcome into `state`. */
+void lock_phase_buffer(void* data, size_t bytes, BufferLockState& state);
+
+/** @brief Combine a phase lock state with residency counts and timed-run faults. */
+BufferResidency make_buffer_residency(const BufferLockState& lock,
+                                      size_t buffer_pages,
+                                      const std::optional<size_t>& resident_pages_before,
+                                      const std::optional<size_t>& resident_pages_after,
+                                      const PageFaultCounts& timed_faults);
+
+/** @brief True when the timed run took any minor or major page fault. */
+bool buffer_residency_took_faults(const BufferResidency& residency);
+
+#endif  // BUFFER_RESIDENCY_H
@@ -0,0 +1,99 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file core_frequency_probe.cpp
+ * @brief Core frequency probe timing and summaries
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include "benchmark/core_frequency_probe.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "asm/asm_functions.h"
+#include "core/config/constants.h"
+#include "core/timing/timer.h"
+#include "utils/descriptive_statistics.h"
+
+double estimate_core_frequency_ghz(uint64_t dependent_adds, double elapsed_seconds) {
+  if (!(elapsed_seconds > 0.0) || !std::isfinite(elapsed_seconds)) {
+    return 0.0;
+  }
+  return static_cast<double>(dependent_adds) /
+         Constants::CORE_FREQUENCY_PROBE_ADDS_PER_CYCLE / elapsed_seconds /
+         Constants::NANOSECONDS_PER_SECOND;
+}
+
+double measure_core_frequency_ghz(HighResTimer& timer) {
+  timer.start();
+  volatile uint64_t sink =
+      core_frequency_add_chain_asm(Constants::CORE_FREQUENCY_PROBE_ADD_GROUPS);
+  const double elapsed_seconds = timer.stop();
+  (void)sink;
+  return estimate_core_frequency_ghz(
+      Constants::CORE_FREQUENCY_PROBE_ADD_GROUPS *
+          Constants::CORE_FREQUENCY_PROBE_ADDS_PER_GROUP,
+      elapsed_seconds);
+}
+
+void reset_core_frequency_probe_record(CoreFrequencyProbeRecord& record,
+                                       size_t worker_count) {
+  record.before_ghz.assign(worker_count, 0.0);
+  record.after_ghz.assign(worker_count, 0.0);
+}
+
+std::optional<CoreFrequencySummary> summarize_core_frequency_probes(
+    const CoreFrequencyProbeRecord& record) {
+  if (record.before_ghz.empty() || record.before_ghz.size() != record.after_ghz.size()) {
+    return std::nullopt;
+  }
+  auto all_positive = [](const std::vector<double>& values) {
+    return std::all_of(values.begin(), values.end(),
+                       [](double value) { return value > 0.0; });
+  };
+  if (!all_positive(record.before_ghz) || !all_positive(record.after_ghz)) {
+    return std::nullopt;
+  }
+
+  CoreFrequencySummary summary;
+  summary.before_ghz = calculate_descriptive_statistics(record.before_ghz).median;
+  summary.after_ghz = calculate_descriptive_statistics(record.after_ghz).median;
+  const auto [before_min, before_max] =
+      std::minmax_element(record.before_ghz.begin(), record.before_ghz.end());
+  const auto [after_min, after_max] =
+      std::minmax_element(record.after_ghz.begin(), record.after_ghz.end());
+  summary.min_ghz = std::min(*before_min, *after_min);
+  summary.max_ghz = std::max(*before_max, *after_max);
+  summary.effective_ghz = (summary.before_ghz + summary.after_ghz) / 2.0;
+  summary.within_measurement_drift_pct =
+      (summary.after_ghz - summary.before_ghz) / summary.before_ghz * 100.0;
+  return summary;
+}
+
+double core_frequency_drift_pct(const std::vector<double>& frequencies_ghz) {
+  if (frequencies_ghz.size() < 2) {
+    return 0.0;
+  }
+  const auto [minimum, maximum] =
+      std::minmax_element(frequencies_ghz.begin(), frequencies_ghz.end());
+  if (!(*minimum > 0.0)) {
+    return 0.0;
+  }
+  return (*maximum - *minimum) / *minimum * 100.0;
+}
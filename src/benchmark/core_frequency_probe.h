@@ -0,0 +1,80 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file core_frequency_probe.h
+ * @brief Dependent-add core frequency sentinel around timed regions
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Standard benchmark measurements run a short dependent integer add chain on
+ * every worker immediately before and after the timed region. The estimate
+ * assumes one dependent add retires per core clock
+ * (Constants::CORE_FREQUENCY_PROBE_ADDS_PER_CYCLE); it is not calibrated
+ * against a reference clock, and JSON output records the assumption. The
+ * rate estimates the effective core frequency the memory measurement ran at
+ * and lets loops that differ only in power management be told apart from
+ * memory regressions.
+ */
+
+#ifndef CORE_FREQUENCY_PROBE_H
+#define CORE_FREQUENCY_PROBE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+struct HighResTimer;
+
+/** @brief Per-worker probe results for one timed region (0.0 = not measured). */
+struct CoreFrequencyProbeRecord {
+  std::vector<double> before_ghz;
+  std::vector<double> after_ghz;
+};
+
+/** @brief Effective core frequency around one measurement. */
+struct CoreFrequencySummary {
+  double before_ghz = 0.0;     ///< Median across workers before the timed region
+  double after_ghz = 0.0;      ///< Median across workers after the timed region
+  double min_ghz = 0.0;        ///< Slowest single probe
+  double max_ghz = 0.0;        ///< Fastest single probe
+  double effective_ghz = 0.0;  ///< Mean of before and after
+  double within_measurement_drift_pct = 0.0;  ///< (after - before) / before
+};
+
+/** @brief Adds per second in GHz; 0.0 for a non-positive or non-finite duration. */
+double estimate_core_frequency_ghz(uint64_t dependent_adds, double elapsed_seconds);
+
+/**
+ * @brief Time one dependent add chain with `timer` and return the estimate.
+ *
+ * The probe restarts `timer`; callers that share a timer across threads pass
+ * a private copy.
+ */
+double measure_core_frequency_ghz(HighResTimer& timer);
+
+void reset_core_frequency_probe_record(CoreFrequencyProbeRecord& record,
+                                       size_t worker_count);
+
+/** @brief Summarize a complete record; nullopt when any probe is missing. */
+std::optional<CoreFrequencySummary> summarize_core_frequency_probes(
+    const CoreFrequencyProbeRecord& record);
+
+/** @brief Spread of `frequencies_ghz` as (max - min) / min in percent; 0 below two values. */
+double core_frequency_drift_pct(const std::vector<double>& frequencies_ghz);
+
+#endif  // CORE_FREQUENCY_PROBE_H
@@ -0,0 +1,251 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file core_scan.cpp
+ * @brief Slot planning, outlier classification, and JSON for core-scan mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Everything here is measurement-free so it can be unit tested; hinted
+ * workers and timed cache loops live in core_scan_runner.cpp.
+ */
+
+#include "benchmark/core_scan.h"
+
+#include <algorithm>
+
+#include "utils/descriptive_statistics.h"
+
+namespace {
+
+constexpr CoreScanMetric kMetrics[CORE_SCAN_METRIC_COUNT] = {
+    CoreScanMetric::L1Latency, CoreScanMetric::L2Latency, CoreScanMetric::L1Read,
+    CoreScanMetric::L1Write,   CoreScanMetric::L2Read,    CoreScanMetric::L2Write};
+
+constexpr CoreScanClass kClasses[] = {CoreScanClass::Performance, CoreScanClass::Efficiency};
+
+void append_slots(std::vector<CoreScanSlot>& slots, int count, CoreScanClass core_class,
+                  size_t l1_bytes, size_t l2_bytes) {
+  for (int i = 0; i < count; ++i) {
+    CoreScanSlot slot;
+    slot.index = static_cast<int>(slots.size());
+    slot.core_class = core_class;
+    // Affinity tag 0 means "no tag", so tags start at 1.
+    slot.affinity_tag = slot.index + 1;
+    slot.l1_bytes = l1_bytes;
+    slot.l2_bytes = l2_bytes;
+    slots.push_back(slot);
+  }
+}
+
+}  // namespace
+
+const char* core_scan_class_to_string(CoreScanClass core_class) {
+  return core_class == CoreScanClass::Efficiency ? "efficiency" : "performance";
+}
+
+const char* core_scan_metric_to_string(CoreScanMetric metric) {
+  switch (metric) {
+    case CoreScanMetric::L1Latency:
+      return "l1_latency_ns";
+    case CoreScanMetric::L2Latency:
+      return "l2_latency_ns";
+    case CoreScanMetric::L1Read:
+      return "l1_read_gb_s";
+    case CoreScanMetric::L1Write:
+      return "l1_write_gb_s";
+    case CoreScanMetric::L2Read:
+      return "l2_read_gb_s";
+    case CoreScanMetric::L2Write:
+      return "l2_write_gb_s";
+  }
+  return "unknown";
+}
+
+bool core_scan_metric_is_latency(CoreScanMetric metric) {
+  return metric == CoreScanMetric::L1Latency || metric == CoreScanMetric::L2Latency;
+}
+
+std::vector<CoreScanSlot> build_core_scan_slots(int performance_cores,
+                                                int efficiency_cores,
+                                                int logical_cores,
+                                                size_t performance_l1_bytes,
+                                                size_t performance_l2_bytes,
+                                                size_t efficiency_l1_bytes,
+                                                size_t efficiency_l2_bytes) {
+  std::vector<CoreScanSlot> slots;
+  if (performance_cores <= 0 && efficiency_cores <= 0) {
+    append_slots(slots, std::max(logical_cores, 1), CoreScanClass::Performance,
+                 performance_l1_bytes, performance_l2_bytes);
+    return slots;
+  }
+  append_slots(slots, std::max(performance_cores, 0), CoreScanClass::Performance,
+               performance_l1_bytes, performance_l2_bytes);
+  append_slots(slots, std::max(efficiency_cores, 0), CoreScanClass::Efficiency,
+               efficiency_l1_bytes > 0 ? efficiency_l1_bytes : performance_l1_bytes,
+               efficiency_l2_bytes > 0 ? efficiency_l2_bytes : performance_l2_bytes);
+  return slots;
+}
+
+std::vector<std::vector<size_t>> build_core_scan_batches(const std::vector<CoreScanSlot>& slots,
+                                                         int concurrency) {
+  const size_t batch_limit = static_cast<size_t>(std::max(concurrency, 1));
+  std::vector<std::vector<size_t>> batches;
+  for (size_t slot_index = 0; slot_index < slots.size(); ++slot_index) {
+    if (batches.empty() || batches.back().size() >= batch_limit ||
+        slots[batches.back().front()].core_class != slots[slot_index].core_class) {
+      batches.emplace_back();
+    }
+    batches.back().push_back(slot_index);
+  }
+  return batches;
+}
+
+void finalize_core_scan_result(CoreScanResult& result) {
+  for (CoreScanSlotResult& slot : result.slots) {
+    slot.measured = std::all_of(slot.samples.begin(), slot.samples.end(),
+                                [](const std::vector<double>& values) { return !values.empty(); });
+    for (size_t metric = 0; metric < CORE_SCAN_METRIC_COUNT; ++metric) {
+      slot.median[metric] =
+          slot.samples[metric].empty() ? 0.0
+                                       : calculate_descriptive_statistics(slot.samples[metric]).median;
+    }
+  }
+
+  result.classes.clear();
+  for (CoreScanClass core_class : kClasses) {
+    CoreScanClassSummary summary;
+    summary.core_class = core_class;
+    std::array<std::vector<double>, CORE_SCAN_METRIC_COUNT> class_values;
+    for (const CoreScanSlotResult& slot : result.slots) {
+      if (slot.slot.core_class != core_class || !slot.measured) {
+        continue;
+      }
+      ++summary.measured_slots;
+      for (size_t metric = 0; metric < CORE_SCAN_METRIC_COUNT; ++metric) {
+        class_values[metric].push_back(slot.median[metric]);
+      }
+    }
+    if (summary.measured_slots == 0) {
+      continue;
+    }
+    summary.comparable = summary.measured_slots >= Constants::CORE_SCAN_MIN_CLASS_SLOTS;
+    for (size_t metric = 0; metric < CORE_SCAN_METRIC_COUNT; ++metric) {
+      summary.median[metric] = calculate_descriptive_statistics(class_values[metric]).median;
+    }
+    result.classes.push_back(summary);
+  }
+
+  for (CoreScanSlotResult& slot : result.slots) {
+    slot.deviation_pct.fill(0.0);
+    slot.outlier.fill(false);
+    slot.any_outlier = false;
+    const auto summary =
+        std::find_if(result.classes.begin(), result.classes.end(),
+                     [&slot](const CoreScanClassSummary& candidate) {
+                       return candidate.core_class == slot.slot.core_class;
+                     });
+    if (!slot.measured || summary == result.classes.end()) {
+      continue;
+    }
+    for (size_t metric = 0; metric < CORE_SCAN_METRIC_COUNT; ++metric) {
+      const double reference = summary->median[metric];
+      if (reference <= 0.0) {
+        continue;
+      }
+      const double delta = core_scan_metric_is_latency(kMetrics[metric])
+                               ? slot.median[metric] - reference
+                               : reference - slot.median[metric];
+      slot.deviation_pct[metric] = delta / reference * 100.0;
+      slot.outlier[metric] =
+          summary->comparable && slot.deviation_pct[metric] > Constants::CORE_SCAN_OUTLIER_PCT;
+      slot.any_outlier = slot.any_outlier || slot.outlier[metric];
+    }
+  }
+}
+
+nlohmann::ordered_json build_core_scan_json(const CoreScanConfig& config,
+                                            const CoreScanResult& result,
+                                            const std::string& cpu_name,
+                                            double total_execution_time_sec) {
+  nlohmann::ordered_json result_json;
+  result_json["mode"] = Constants::CORE_SCAN_JSON_MODE_NAME;
+  result_json["schema_version"] = Constants::CORE_SCAN_JSON_SCHEMA_VERSION;
+  result_json["methodology_version"] = Constants::CORE_SCAN_METHODOLOGY_VERSION;
+  result_json["status"] = result.interrupted ? "interrupted" : "complete";
+  result_json["cpu_name"] = cpu_name;
+
+  nlohmann::ordered_json configuration;
+  configuration["rounds"] = config.rounds;
+  configuration["concurrency"] = result.concurrency;
+  configuration["slots"] = result.slots.size();
+  configuration["performance_cores"] = result.performance_cores;
+  configuration["efficiency_cores"] = result.efficiency_cores;
+  configuration["latency_accesses"] = Constants::CORE_SCAN_LATENCY_ACCESSES;
+  configuration["bandwidth_bytes"] = Constants::CORE_SCAN_BANDWIDTH_BYTES;
+  configuration["outlier_threshold_pct"] = Constants::CORE_SCAN_OUTLIER_PCT;
+  configuration["min_class_slots"] = Constants::CORE_SCAN_MIN_CLASS_SLOTS;
+  configuration["placement"] = "qos-class-and-affinity-tag-hint";
+  result_json["configuration"] = std::move(configuration);
+
+  nlohmann::ordered_json classes = nlohmann::ordered_json::array();
+  for (const CoreScanClassSummary& summary : result.classes) {
+    nlohmann::ordered_json class_json;
+    class_json["core_class"] = core_scan_class_to_string(summary.core_class);
+    class_json["measured_slots"] = summary.measured_slots;
+    class_json["comparable"] = summary.comparable;
+    nlohmann::ordered_json medians;
+    for (size_t metric = 0; metric < CORE_SCAN_METRIC_COUNT; ++metric) {
+      medians[core_scan_metric_to_string(kMetrics[metric])] = summary.median[metric];
+    }
+    class_json["median"] = std::move(medians);
+    classes.push_back(std::move(class_json));
+  }
+  result_json["classes"] = std::move(classes);
+
+  nlohmann::ordered_json slots = nlohmann::ordered_json::array();
+  nlohmann::ordered_json outlier_slots = nlohmann::ordered_json::array();
+  for (const CoreScanSlotResult& slot : result.slots) {
+    nlohmann::ordered_json slot_json;
+    slot_json["slot"] = slot.slot.index;
+    slot_json["core_class"] = core_scan_class_to_string(slot.slot.core_class);
+    slot_json["affinity_tag"] = slot.slot.affinity_tag;
+    slot_json["qos_applied"] = slot.qos_applied;
+    slot_json["affinity_applied"] = slot.affinity_applied;
+    slot_json["l1_buffer_bytes"] = slot.slot.l1_bytes;
+    slot_json["l2_buffer_bytes"] = slot.slot.l2_bytes;
+    slot_json["measured"] = slot.measured;
+    slot_json["outlier"] = slot.any_outlier;
+    nlohmann::ordered_json metrics;
+    for (size_t metric = 0; metric < CORE_SCAN_METRIC_COUNT; ++metric) {
+      metrics[core_scan_metric_to_string(kMetrics[metric])] = {
+          {"median", slot.median[metric]},
+          {"deviation_pct", slot.deviation_pct[metric]},
+          {"outlier", slot.outlier[metric]},
+          {"rounds", slot.samples[metric]}};
+    }
+    slot_json["metrics"] = std::move(metrics);
+    if (slot.any_outlier) {
+      outlier_slots.push_back(slot.slot.index);
+    }
+    slots.push_back(std::move(slot_json));
+  }
+  result_json["slots"] = std::move(slots);
+  result_json["outlier_slots"] = std::move(outlier_slots);
+  result_json["total_execution_time_sec"] = total_execution_time_sec;
+  return result_json;
+}
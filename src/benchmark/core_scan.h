@@ -0,0 +1,164 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file core_scan.h
+ * @brief Standalone per-core uniformity scan interfaces
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * `-U, --core-scan` gives every logical CPU its own measurement slot and runs
+ * L1/L2 pointer-chase latency and L1/L2 read/write cache bandwidth on a
+ * worker hinted toward that slot's core class. Slots whose medians are worse
+ * than their class median by more than CORE_SCAN_OUTLIER_PCT are flagged.
+ *
+ * macOS offers no thread pinning: a slot is a QoS class (user-interactive for
+ * performance slots, background for efficiency slots) plus a distinct affinity
+ * tag, not a guaranteed physical core. Running all slots of a class
+ * concurrently is what forces the scheduler onto distinct cores.
+ */
+
+#ifndef CORE_SCAN_H
+#define CORE_SCAN_H
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "core/config/constants.h"
+#include "third_party/nlohmann/json.hpp"
+
+enum class CoreScanClass {
+  Performance,
+  Efficiency,
+};
+
+enum class CoreScanMetric {
+  L1Latency,
+  L2Latency,
+  L1Read,
+  L1Write,
+  L2Read,
+  L2Write,
+};
+
+constexpr size_t CORE_SCAN_METRIC_COUNT = 6;
+
+struct CoreScanConfig {
+  int rounds = Constants::CORE_SCAN_DEFAULT_ROUNDS;
+  int concurrency = Constants::CORE_SCAN_DEFAULT_CONCURRENCY;
+  std::string output_file;
+  bool help_requested = false;
+};
+
+/** @brief One logical-CPU measurement slot and the cache sizes of its class. */
+struct CoreScanSlot {
+  int index = 0;
+  CoreScanClass core_class = CoreScanClass::Performance;
+  int affinity_tag = 0;
+  size_t l1_bytes = 0;
+  size_t l2_bytes = 0;
+};
+
+struct CoreScanSlotResult {
+  CoreScanSlot slot;
+  bool qos_applied = false;
+  bool affinity_applied = false;
+  bool measured = false;
+  std::array<std::vector<double>, CORE_SCAN_METRIC_COUNT> samples;  ///< One per round
+  std::array<double, CORE_SCAN_METRIC_COUNT> median{};
+  std::array<double, CORE_SCAN_METRIC_COUNT> deviation_pct{};  ///< Positive is worse than the class
+  std::array<bool, CORE_SCAN_METRIC_COUNT> outlier{};
+  bool any_outlier = false;
+};
+
+/** @brief Class-median reference for one core class. */
+struct CoreScanClassSummary {
+  CoreScanClass core_class = CoreScanClass::Performance;
+  size_t measured_slots = 0;
+  bool comparable = false;  ///< At least CORE_SCAN_MIN_CLASS_SLOTS measured slots
+  std::array<double, CORE_SCAN_METRIC_COUNT> median{};
+};
+
+struct CoreScanResult {
+  int performance_cores = 0;
+  int efficiency_cores = 0;
+  int concurrency = 1;
+  std::vector<CoreScanSlotResult> slots;
+  std::vector<CoreScanClassSummary> classes;
+  bool interrupted = false;
+};
+
+const char* core_scan_class_to_string(CoreScanClass core_class);
+const char* core_scan_metric_to_string(CoreScanMetric metric);
+bool core_scan_metric_is_latency(CoreScanMetric metric);
+
+/**
+ * @brief One slot per logical CPU, performance slots first.
+ *
+ * Hosts that report no performance levels (both counts zero) get
+ * `logical_cores` performance slots. Efficiency slots fall back to the
+ * performance cache sizes when the host reports none for them.
+ */
+std::vector<CoreScanSlot> build_core_scan_slots(int performance_cores,
+                                                int efficiency_cores,
+                                                int logical_cores,
+                                                size_t performance_l1_bytes,
+                                                size_t performance_l2_bytes,
+                                                size_t efficiency_l1_bytes,
+                                                size_t efficiency_l2_bytes);
+
+/**
+ * @brief Contiguous groups of at most `concurrency` slot indices.
+ *
+ * Slots of one class stay together where possible so that concurrent workers
+ * share a QoS class and the scheduler spreads them over that class's cores.
+ */
+std::vector<std::vector<size_t>> build_core_scan_batches(const std::vector<CoreScanSlot>& slots,
+                                                         int concurrency);
+
+/**
+ * @brief Reduce samples to medians, build class summaries, and flag outliers.
+ *
+ * Deviation is oriented so positive is worse: above the class median for
+ * latency and below it for bandwidth.
+ */
+void finalize_core_scan_result(CoreScanResult& result);
+
+nlohmann::ordered_json build_core_scan_json(const CoreScanConfig& config,
+                                            const CoreScanResult& result,
+                                            const std::string& cpu_name,
+                                            double total_execution_time_sec);
+
+/**
+ * @brief Parse CLI args for standalone core-scan mode.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on parse/validation error.
+ */
+int parse_core_scan_mode_arguments(int argc, char* argv[], CoreScanConfig& config);
+
+/**
+ * @brief Measure every slot, report the per-core table, and save JSON.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on runtime/IO error.
+ */
+int run_core_scan(const CoreScanConfig& config);
+
+/**
+ * @brief Parse and run standalone core-scan mode from main().
+ */
+int run_core_scan_mode(int argc, char* argv[]);
+
+#endif  // CORE_SCAN_H
@@ -0,0 +1,137 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file core_scan_cli.cpp
+ * @brief CLI parsing for standalone core-scan mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Parses and validates mode-specific command line options for
+ * `-U, --core-scan`. Like the other standalone modes, only an explicit
+ * option set is accepted.
+ */
+
+#include "benchmark/core_scan.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+
+#include "core/config/cli_options.h"
+#include "core/config/config.h"
+#include "core/config/constants.h"
+#include "core/signal/signal_handler.h"
+#include "output/console/messages/messages_api.h"
+#include "output/console/output_printer.h"
+
+namespace {
+
+constexpr const char* OPT_CORE_SCAN_SHORT = "-U";
+constexpr const char* OPT_CORE_SCAN_LONG = "--core-scan";
+constexpr const char* OPT_SCAN_CONCURRENCY_LONG = "--scan-concurrency";
+constexpr const char* OPT_COUNT_SHORT = "-r";
+constexpr const char* OPT_COUNT_LONG = "--count";
+constexpr const char* OPT_HELP_SHORT = "-h";
+constexpr const char* OPT_HELP_LONG = "--help";
+constexpr const char* OPT_OUTPUT_SHORT = "-o";
+constexpr const char* OPT_OUTPUT_LONG = "--output";
+
+}  // namespace
+
+int parse_core_scan_mode_arguments(int argc, char* argv[], CoreScanConfig& config) {
+  config.rounds = Constants::CORE_SCAN_DEFAULT_ROUNDS;
+  config.concurrency = Constants::CORE_SCAN_DEFAULT_CONCURRENCY;
+
+  bool mode_seen = false;
+  bool output_seen = false;
+  bool count_seen = false;
+  bool concurrency_seen = false;
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+
+    if (is_option(arg, OPT_CORE_SCAN_SHORT, OPT_CORE_SCAN_LONG)) {
+      mode_seen = true;
+      continue;
+    }
+
+    if (is_option(arg, OPT_HELP_SHORT, OPT_HELP_LONG)) {
+      print_help(argv[0]);
+      config.help_requested = true;
+      return EXIT_SUCCESS;
+    }
+
+    if (is_option(arg, OPT_OUTPUT_SHORT, OPT_OUTPUT_LONG)) {
+      if (!take_option_value(argc, argv, i, output_seen, OPT_OUTPUT_LONG)) {
+        return EXIT_FAILURE;
+      }
+      config.output_file = argv[i];
+      continue;
+    }
+
+    if (is_option(arg, OPT_COUNT_SHORT, OPT_COUNT_LONG)) {
+      if (!take_option_value(argc, argv, i, count_seen, OPT_COUNT_LONG)) {
+        return EXIT_FAILURE;
+      }
+      if (!parse_positive_int_option(OPT_COUNT_LONG, argv[i], config.rounds, argv[0])) {
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (arg == OPT_SCAN_CONCURRENCY_LONG) {
+      if (!take_option_value(argc, argv, i, concurrency_seen, OPT_SCAN_CONCURRENCY_LONG)) {
+        return EXIT_FAILURE;
+      }
+      if (!parse_positive_int_option(OPT_SCAN_CONCURRENCY_LONG, argv[i], config.concurrency,
+                                     argv[0])) {
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    std::cerr << Messages::error_prefix()
+              << Messages::error_core_scan_must_be_used_alone()
+              << std::endl;
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  if (!mode_seen) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_core_scan_must_be_used_alone()
+              << std::endl;
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+int run_core_scan_mode(int argc, char* argv[]) {
+  CoreScanConfig config;
+  if (parse_core_scan_mode_arguments(argc, argv, config) != EXIT_SUCCESS) {
+    return EXIT_FAILURE;
+  }
+  if (config.help_requested) {
+    return EXIT_SUCCESS;
+  }
+
+  BenchmarkSignalMaskGuard signal_guard;
+  return run_core_scan(config);
+}
@@ -0,0 +1,348 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file core_scan_runner.cpp
+ * @brief Hinted per-slot workers and timed cache loops for core-scan mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Each batch prepares private latency chains and bandwidth buffers for its
+ * slots on the main thread, then starts one worker per slot. A worker applies
+ * its class QoS and affinity tag, waits for every worker in the batch, and
+ * runs all metrics for every round itself, so every value of a slot comes from
+ * the same hinted thread. Work is fixed rather than calibrated so that slots
+ * of one class are compared on identical work.
+ */
+
+#include "benchmark/core_scan.h"
+
+#include <mach/mach.h>
+#include <mach/thread_policy.h>
+#include <pthread.h>
+#include <pthread/qos.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "asm/asm_functions.h"
+#include "benchmark/benchmark_tests.h"
+#include "benchmark/benchmark_work_plan.h"
+#include "core/config/constants.h"
+#include "core/memory/memory_manager.h"
+#include "core/memory/memory_utils.h"
+#include "core/signal/signal_handler.h"
+#include "core/system/system_info.h"
+#include "core/timing/timer.h"
+#include "output/console/messages/messages_api.h"
+#include "output/console/output_printer.h"
+#include "output/json/json_output/json_output_api.h"
+
+namespace {
+
+constexpr CoreScanMetric kMetrics[CORE_SCAN_METRIC_COUNT] = {
+    CoreScanMetric::L1Latency, CoreScanMetric::L2Latency, CoreScanMetric::L1Read,
+    CoreScanMetric::L1Write,   CoreScanMetric::L2Read,    CoreScanMetric::L2Write};
+
+struct SlotBuffers {
+  MmapPtr l1_chain;
+  MmapPtr l2_chain;
+  MmapPtr l1_data;
+  MmapPtr l2_data;
+};
+
+struct BatchStart {
+  std::atomic<size_t> ready{0};
+  std::atomic<bool> go{false};
+  std::atomic<bool> interrupted{false};
+};
+
+bool prepare_slot_buffers(const CoreScanSlot& slot, SlotBuffers& buffers) {
+  buffers.l1_chain = allocate_buffer(slot.l1_bytes, "core-scan L1 chain");
+  buffers.l2_chain = allocate_buffer(slot.l2_bytes, "core-scan L2 chain");
+  buffers.l1_data = allocate_buffer(slot.l1_bytes, "core-scan L1 data");
+  buffers.l2_data = allocate_buffer(slot.l2_bytes, "core-scan L2 data");
+  if (!buffers.l1_chain || !buffers.l2_chain || !buffers.l1_data || !buffers.l2_data) {
+    return false;
+  }
+  // Writing the data buffers once backs every page before any read pass.
+  memory_write_cache_loop_asm(buffers.l1_data.get(), slot.l1_bytes);
+  memory_write_cache_loop_asm(buffers.l2_data.get(), slot.l2_bytes);
+  return setup_latency_chain(buffers.l1_chain.get(), slot.l1_bytes,
+                             Constants::LATENCY_STRIDE_BYTES) == EXIT_SUCCESS &&
+         setup_latency_chain(buffers.l2_chain.get(), slot.l2_bytes,
+                             Constants::LATENCY_STRIDE_BYTES) == EXIT_SUCCESS;
+}
+
+// Efficiency slots use background QoS, which Apple Silicon schedules on the
+// efficiency cores; the per-slot affinity tag asks for distinct cores.
+void apply_slot_hints(const CoreScanSlot& slot, CoreScanSlotResult& result) {
+  const qos_class_t qos_class = slot.core_class == CoreScanClass::Efficiency
+                                    ? QOS_CLASS_BACKGROUND
+                                    : QOS_CLASS_USER_INTERACTIVE;
+  result.qos_applied = pthread_set_qos_class_self_np(qos_class, 0) == KERN_SUCCESS;
+
+  thread_affinity_policy_data_t affinity_policy = {slot.affinity_tag};
+  const thread_port_t mach_thread = pthread_mach_thread_np(pthread_self());
+  result.affinity_applied =
+      thread_policy_set(mach_thread, THREAD_AFFINITY_POLICY,
+                        reinterpret_cast<thread_policy_t>(&affinity_policy),
+                        THREAD_AFFINITY_POLICY_COUNT) == KERN_SUCCESS;
+}
+
+double measure_cache_bandwidth(bool write, void* buffer, size_t size, HighResTimer& timer) {
+  const size_t passes = std::max<size_t>(1, Constants::CORE_SCAN_BANDWIDTH_BYTES / size);
+  uint64_t checksum = 0;
+  timer.start();
+  for (size_t pass = 0; pass < passes; ++pass) {
+    if (write) {
+      memory_write_cache_loop_asm(buffer, size);
+    } else {
+      checksum ^= memory_read_cache_loop_asm(buffer, size);
+    }
+  }
+  const double elapsed = timer.stop();
+  asm volatile("" : : "r"(checksum) : "memory");
+  if (!benchmark_elapsed_is_valid(elapsed)) {
+    return 0.0;
+  }
+  return static_cast<double>(passes * size) / elapsed / Constants::NANOSECONDS_PER_SECOND;
+}
+
+double measure_metric(CoreScanMetric metric,
+                      const CoreScanSlot& slot,
+                      SlotBuffers& buffers,
+                      HighResTimer& timer) {
+  switch (metric) {
+    case CoreScanMetric::L1Latency:
+      return run_latency_test(buffers.l1_chain.get(), Constants::CORE_SCAN_LATENCY_ACCESSES, timer);
+    case CoreScanMetric::L2Latency:
+      return run_latency_test(buffers.l2_chain.get(), Constants::CORE_SCAN_LATENCY_ACCESSES, timer);
+    case CoreScanMetric::L1Read:
+      return measure_cache_bandwidth(false, buffers.l1_data.get(), slot.l1_bytes, timer);
+    case CoreScanMetric::L1Write:
+      return measure_cache_bandwidth(true, buffers.l1_data.get(), slot.l1_bytes, timer);
+    case CoreScanMetric::L2Read:
+      return measure_cache_bandwidth(false, buffers.l2_data.get(), slot.l2_bytes, timer);
+    case CoreScanMetric::L2Write:
+      return measure_cache_bandwidth(true, buffers.l2_data.get(), slot.l2_bytes, timer);
+  }
+  return 0.0;
+}
+
+void run_slot_worker(const CoreScanSlot& slot,
+                     SlotBuffers& buffers,
+                     int rounds,
+                     HighResTimer timer,
+                     BatchStart& start,
+                     CoreScanSlotResult& result) {
+  apply_slot_hints(slot, result);
+  start.ready.fetch_add(1, std::memory_order_acq_rel);
+  while (!start.go.load(std::memory_order_acquire)) {
+    std::this_thread::yield();
+  }
+
+  // One untimed pass per metric brings the buffers into this core's caches.
+  for (CoreScanMetric metric : kMetrics) {
+    measure_metric(metric, slot, buffers, timer);
+  }
+  for (int round = 0; round < rounds; ++round) {
+    for (size_t metric_index :
+         build_benchmark_cyclic_order(CORE_SCAN_METRIC_COUNT, static_cast<size_t>(round))) {
+      const double value = measure_metric(kMetrics[metric_index], slot, buffers, timer);
+      if (value > 0.0) {
+        result.samples[metric_index].push_back(value);
+      }
+    }
+    if (signal_received()) {
+      start.interrupted.store(true, std::memory_order_release);
+      return;
+    }
+  }
+}
+
+// Runs one batch of slots concurrently. Returns false on interruption or when
+// a worker thread cannot be created; `out_start_failed` tells them apart.
+bool run_batch(const std::vector<size_t>& batch,
+               const std::vector<CoreScanSlot>& slots,
+               int rounds,
+               const HighResTimer& timer,
+               CoreScanResult& result,
+               bool& out_start_failed) {
+  std::vector<SlotBuffers> buffers(batch.size());
+  for (size_t i = 0; i < batch.size(); ++i) {
+    if (!prepare_slot_buffers(slots[batch[i]], buffers[i])) {
+      out_start_failed = true;
+      return false;
+    }
+  }
+
+  BatchStart start;
+  std::vector<std::thread> workers;
+  try {
+    for (size_t i = 0; i < batch.size(); ++i) {
+      workers.emplace_back(run_slot_worker, std::cref(slots[batch[i]]), std::ref(buffers[i]),
+                           rounds, timer, std::ref(start),
+                           std::ref(result.slots[batch[i]]));
+    }
+  } catch (const std::system_error&) {
+    out_start_failed = true;
+  }
+  if (!out_start_failed) {
+    while (start.ready.load(std::memory_order_acquire) < batch.size()) {
+      std::this_thread::yield();
+    }
+  }
+  // Released even after a failed start so that already running workers finish.
+  start.go.store(true, std::memory_order_release);
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+  return !out_start_failed && !start.interrupted.load(std::memory_order_acquire);
+}
+
+void print_core_scan_report(const CoreScanResult& result) {
+  std::cout << std::endl << Messages::report_core_scan_header() << std::endl;
+  std::cout << Messages::report_core_scan_placement_note(Constants::CORE_SCAN_OUTLIER_PCT)
+            << std::endl;
+  std::cout << Messages::report_core_scan_table_header() << std::endl;
+  for (const CoreScanSlotResult& slot : result.slots) {
+    const std::string core_class = core_scan_class_to_string(slot.slot.core_class);
+    std::cout << Messages::report_core_scan_slot_label(slot.slot.index, core_class);
+    if (!slot.measured) {
+      std::cout << Messages::report_core_scan_unmeasured_cells() << std::endl;
+      continue;
+    }
+    for (size_t metric = 0; metric < CORE_SCAN_METRIC_COUNT; ++metric) {
+      std::cout << Messages::report_core_scan_cell(slot.median[metric], slot.outlier[metric]);
+    }
+    std::cout << std::endl;
+  }
+  for (const CoreScanClassSummary& summary : result.classes) {
+    std::cout << Messages::report_core_scan_class_label(core_scan_class_to_string(summary.core_class));
+    for (size_t metric = 0; metric < CORE_SCAN_METRIC_COUNT; ++metric) {
+      std::cout << Messages::report_core_scan_cell(summary.median[metric], false);
+    }
+    std::cout << std::endl;
+  }
+  for (const CoreScanClassSummary& summary : result.classes) {
+    if (!summary.comparable) {
+      std::cout << Messages::report_core_scan_class_not_comparable(
+                       core_scan_class_to_string(summary.core_class), summary.measured_slots)
+                << std::endl;
+    }
+  }
+
+  bool any_outlier = false;
+  for (const CoreScanSlotResult& slot : result.slots) {
+    for (size_t metric = 0; metric < CORE_SCAN_METRIC_COUNT; ++metric) {
+      if (!slot.outlier[metric]) {
+        continue;
+      }
+      any_outlier = true;
+      std::cout << Messages::report_core_scan_outlier(
+                       slot.slot.index, core_scan_class_to_string(slot.slot.core_class),
+                       core_scan_metric_to_string(kMetrics[metric]), slot.deviation_pct[metric])
+                << std::endl;
+    }
+  }
+  if (!any_outlier) {
+    std::cout << Messages::report_core_scan_no_outliers() << std::endl;
+  }
+}
+
+}  // namespace
+
+int run_core_scan(const CoreScanConfig& config) {
+  print_runtime_banner();
+  std::cout << Messages::msg_running_core_scan() << std::endl;
+  const auto run_start = std::chrono::steady_clock::now();
+
+  CoreScanResult result;
+  result.performance_cores = get_performance_cores();
+  result.efficiency_cores = get_efficiency_cores();
+  const int logical_cores = get_total_logical_cores();
+  const size_t efficiency_l1 = result.efficiency_cores > 0 ? get_efficiency_l1_cache_size() : 0;
+  const size_t efficiency_l2 = result.efficiency_cores > 0 ? get_efficiency_l2_cache_size() : 0;
+  const std::vector<CoreScanSlot> slots = build_core_scan_slots(
+      result.performance_cores, result.efficiency_cores, logical_cores,
+      static_cast<size_t>(get_l1_cache_size() * Constants::L1_BUFFER_SIZE_FACTOR),
+      static_cast<size_t>(get_l2_cache_size() * Constants::L2_BUFFER_SIZE_FACTOR),
+      static_cast<size_t>(efficiency_l1 * Constants::L1_BUFFER_SIZE_FACTOR),
+      static_cast<size_t>(efficiency_l2 * Constants::L2_BUFFER_SIZE_FACTOR));
+  result.concurrency = std::min(config.concurrency, static_cast<int>(slots.size()));
+  for (const CoreScanSlot& slot : slots) {
+    CoreScanSlotResult slot_result;
+    slot_result.slot = slot;
+    result.slots.push_back(std::move(slot_result));
+  }
+  const std::vector<std::vector<size_t>> batches = build_core_scan_batches(slots, result.concurrency);
+
+  auto timer_optional = HighResTimer::create();
+  if (!timer_optional) {
+    std::cerr << Messages::error_prefix() << Messages::error_timer_creation_failed() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << Messages::msg_core_scan_plan(slots.size(), batches.size(), result.concurrency,
+                                            config.rounds)
+            << std::endl;
+  for (size_t batch_index = 0; batch_index < batches.size(); ++batch_index) {
+    const std::vector<size_t>& batch = batches[batch_index];
+    std::cout << Messages::msg_core_scan_batch(
+                     batch_index + 1, batches.size(),
+                     core_scan_class_to_string(slots[batch.front()].core_class), batch.size())
+              << std::endl;
+    bool start_failed = false;
+    if (!run_batch(batch, slots, config.rounds, *timer_optional, result, start_failed)) {
+      if (start_failed) {
+        std::cerr << Messages::error_prefix()
+                  << Messages::error_core_scan_failed("slot buffer or worker setup") << std::endl;
+        return EXIT_FAILURE;
+      }
+      result.interrupted = true;
+      std::cout << std::endl << Messages::msg_interrupted_by_user() << std::endl;
+      break;
+    }
+  }
+
+  finalize_core_scan_result(result);
+  print_core_scan_report(result);
+
+  if (!config.output_file.empty()) {
+    const double total_execution_time_sec =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - run_start).count();
+    std::filesystem::path file_path(config.output_file);
+    if (file_path.is_relative()) {
+      file_path = std::filesystem::current_path() / file_path;
+    }
+    if (write_json_to_file(file_path, build_core_scan_json(config, result, get_processor_name(),
+                                                           total_execution_time_sec)) !=
+        EXIT_SUCCESS) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
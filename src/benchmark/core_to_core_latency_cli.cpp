@@ -34,6 +34,7 @@
 #include <stdexcept>
 #include <string>
 
+#include "core/config/cli_options.h"
 #include "core/config/config.h"
 #include "core/config/constants.h"
 #include "core/config/sweep_utils.h"
@@ -58,43 +59,6 @@ constexpr const char* OPT_SWEEP_LONG = "--sweep";
 constexpr const char* OPT_SWEEP_MAX_RUNS_SHORT = "-X";
 constexpr const char* OPT_SWEEP_MAX_RUNS_LONG = "--sweep-max-runs";
 
-bool is_option(const std::string& arg, const char* short_option, const char* long_option) {
-  return arg == short_option || arg == long_option;
-}
-
-// Shared validator for positive integer options used by standalone mode flags.
-bool parse_positive_int_option(const std::string& option,
-                               const std::string& value,
-                               int& out_value,
-                               const char* prog_name) {
-  long long parsed = 0;
-  const StrictIntegerParseStatus parse_status =
-      parse_strict_signed_decimal(value, parsed);
-  if (parse_status != StrictIntegerParseStatus::Success) {
-    std::cerr << Messages::error_prefix()
-              << Messages::error_invalid_value(
-                     option, value,
-                     strict_signed_decimal_error_reason(parse_status))
-              << std::endl;
-    print_usage(prog_name);
-    return false;
-  }
-
-  if (parsed <= 0 || parsed > std::numeric_limits<int>::max()) {
-    std::cerr << Messages::error_prefix()
-              << Messages::error_invalid_value(
-                     option,
-                     value,
-                     "must be between 1 and " + std::to_string(std::numeric_limits<int>::max()))
-              << std::endl;
-    print_usage(prog_name);
-    return false;
-  }
-
-  out_value = static_cast<int>(parsed);
-  return true;
-}
-
 bool core_to_core_sweep_parameter_from_string(const std::string& key,
                                               CoreToCoreSweepParameter& out_parameter,
                                               std::string& out_name) {
@@ -77,6 +77,9 @@ std::vector<size_t> build_core_to_core_scenario_order(size_t scenario_count, siz
 void append_core_to_core_loop_record(CoreToCoreLatencyScenarioResult& scenario_result, size_t loop_index,
                                      size_t order_position, const ScenarioMeasurement& measurement);
 
+/** @brief Fixed-size plan used to time the calibration pilot of one scenario. */
+CoreToCoreWorkPlan build_core_to_core_calibration_pilot_plan();
+
 bool build_core_to_core_work_plan(double pilot_elapsed_seconds, CoreToCoreWorkPlan& out_plan);
 
 bool execute_single_scenario(const ScenarioDescriptor& scenario, const CoreToCoreWorkPlan& work_plan, int sample_count,
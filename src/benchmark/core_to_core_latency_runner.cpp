@@ -191,14 +191,6 @@ std::vector<ScenarioDescriptor> build_scenarios() {
   };
 }
 
-CoreToCoreWorkPlan build_calibration_pilot_plan() {
-  CoreToCoreWorkPlan plan;
-  plan.warmup_round_trips = Constants::CORE_TO_CORE_CALIBRATION_WARMUP_ROUND_TRIPS;
-  plan.headline_round_trips = Constants::CORE_TO_CORE_CALIBRATION_ROUND_TRIPS;
-  plan.sample_window_round_trips = Constants::CORE_TO_CORE_SAMPLE_WINDOW_ROUND_TRIPS;
-  return plan;
-}
-
 void print_statistics(const CoreToCoreSummaryStats& stats) {
   StatisticsSummaryRenderOptions options;
   options.precision = Constants::LATENCY_PRECISION;
@@ -266,6 +258,14 @@ void print_scenario_report(const CoreToCoreLatencyScenarioResult& scenario_resul
 
 }  // namespace
 
+CoreToCoreWorkPlan build_core_to_core_calibration_pilot_plan() {
+  CoreToCoreWorkPlan plan;
+  plan.warmup_round_trips = Constants::CORE_TO_CORE_CALIBRATION_WARMUP_ROUND_TRIPS;
+  plan.headline_round_trips = Constants::CORE_TO_CORE_CALIBRATION_ROUND_TRIPS;
+  plan.sample_window_round_trips = Constants::CORE_TO_CORE_SAMPLE_WINDOW_ROUND_TRIPS;
+  return plan;
+}
+
 size_t calculate_core_to_core_calibrated_round_trips(double pilot_elapsed_seconds, size_t pilot_round_trips,
                                                      double target_duration_seconds, size_t minimum_round_trips,
                                                      size_t maximum_round_trips) {
@@ -489,7 +489,7 @@ int run_core_to_core_latency_collect(const CoreToCoreLatencyConfig& config, nloh
 
   bool run_failed = false;
   bool interrupted = false;
-  const CoreToCoreWorkPlan pilot_plan = build_calibration_pilot_plan();
+  const CoreToCoreWorkPlan pilot_plan = build_core_to_core_calibration_pilot_plan();
   for (size_t scenario_index = 0; scenario_index < scenarios.size(); ++scenario_index) {
     if (signal_received()) {
       interrupted = true;
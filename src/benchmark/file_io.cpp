@@ -0,0 +1,166 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file file_io.cpp
+ * @brief Block ordering, result reduction, and JSON for file I/O mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Everything here is measurement-free so it can be unit tested; the file,
+ * the mappings, and the read paths live in file_io_runner.cpp.
+ */
+
+#include "benchmark/file_io.h"
+
+#include "pattern_benchmark/pattern_work_plan.h"
+#include "utils/descriptive_statistics.h"
+
+namespace {
+
+constexpr FileIoMethod kMethods[FILE_IO_METHOD_COUNT] = {
+    FileIoMethod::Memory, FileIoMethod::Mmap, FileIoMethod::MmapFresh, FileIoMethod::Pread,
+    FileIoMethod::Readv};
+
+constexpr FileIoAccess kAccesses[FILE_IO_ACCESS_COUNT] = {FileIoAccess::Sequential,
+                                                          FileIoAccess::Random};
+
+}  // namespace
+
+const char* file_io_method_to_string(FileIoMethod method) {
+  switch (method) {
+    case FileIoMethod::Mmap:
+      return "mmap";
+    case FileIoMethod::MmapFresh:
+      return "mmap-fresh";
+    case FileIoMethod::Pread:
+      return "pread";
+    case FileIoMethod::Readv:
+      return "readv";
+    case FileIoMethod::Memory:
+    default:
+      return "memory";
+  }
+}
+
+const char* file_io_access_to_string(FileIoAccess access) {
+  return access == FileIoAccess::Random ? "random" : "sequential";
+}
+
+bool file_io_block_is_valid(size_t block_kb, unsigned long file_size_mb) {
+  return block_kb >= Constants::FILE_IO_MIN_BLOCK_KB &&
+         block_kb <= Constants::FILE_IO_MAX_BLOCK_KB && (block_kb & (block_kb - 1)) == 0 &&
+         block_kb * Constants::BYTES_PER_KB <=
+             static_cast<size_t>(file_size_mb) * Constants::BYTES_PER_MB;
+}
+
+std::vector<size_t> build_file_io_block_order(size_t block_count, uint64_t seed) {
+  // The generator permutes PATTERN_ACCESS_SIZE_BYTES slots; one slot per block
+  // turns its offsets into block indices.
+  std::vector<size_t> order =
+      generate_random_indices(block_count * Constants::PATTERN_ACCESS_SIZE_BYTES, block_count, seed);
+  for (size_t& index : order) {
+    index /= Constants::PATTERN_ACCESS_SIZE_BYTES;
+  }
+  return order;
+}
+
+double calculate_file_io_overhead_ns_per_byte(double path_gb_s, double memory_gb_s) {
+  if (path_gb_s <= 0.0 || memory_gb_s <= 0.0) {
+    return 0.0;
+  }
+  // GB/s is bytes per nanosecond, so the reciprocal is nanoseconds per byte.
+  return 1.0 / path_gb_s - 1.0 / memory_gb_s;
+}
+
+FileIoResult make_file_io_result(const FileIoConfig& config) {
+  FileIoResult result;
+  result.file_bytes = static_cast<size_t>(config.file_size_mb) * Constants::BYTES_PER_MB;
+  result.block_bytes = config.block_kb * Constants::BYTES_PER_KB;
+  for (FileIoAccess access : kAccesses) {
+    for (FileIoMethod method : kMethods) {
+      FileIoRow row;
+      row.method = method;
+      row.access = access;
+      result.rows.push_back(std::move(row));
+    }
+  }
+  return result;
+}
+
+void finalize_file_io_result(FileIoResult& result) {
+  for (FileIoRow& row : result.rows) {
+    row.median_gb_s = row.samples_gb_s.empty()
+                          ? 0.0
+                          : calculate_descriptive_statistics(row.samples_gb_s).median;
+  }
+  for (FileIoRow& row : result.rows) {
+    double memory_gb_s = 0.0;
+    for (const FileIoRow& baseline : result.rows) {
+      if (baseline.method == FileIoMethod::Memory && baseline.access == row.access) {
+        memory_gb_s = baseline.median_gb_s;
+      }
+    }
+    row.overhead_ns_per_byte = calculate_file_io_overhead_ns_per_byte(row.median_gb_s, memory_gb_s);
+    row.vs_memory_pct = row.median_gb_s > 0.0 && memory_gb_s > 0.0
+                            ? (row.median_gb_s / memory_gb_s - 1.0) * 100.0
+                            : 0.0;
+  }
+}
+
+nlohmann::ordered_json build_file_io_json(const FileIoConfig& config,
+                                          const FileIoResult& result,
+                                          const std::string& file_directory,
+                                          const std::string& cpu_name,
+                                          double total_execution_time_sec) {
+  nlohmann::ordered_json result_json;
+  result_json["mode"] = Constants::FILE_IO_JSON_MODE_NAME;
+  result_json["schema_version"] = Constants::FILE_IO_JSON_SCHEMA_VERSION;
+  result_json["methodology_version"] = Constants::FILE_IO_METHODOLOGY_VERSION;
+  result_json["status"] = result.interrupted ? "interrupted" : "complete";
+  result_json["cpu_name"] = cpu_name;
+
+  nlohmann::ordered_json configuration;
+  configuration["file_directory"] = file_directory;
+  configuration["file_size_mb"] = config.file_size_mb;
+  configuration["block_bytes"] = result.block_bytes;
+  configuration["readv_segments"] = Constants::FILE_IO_READV_SEGMENTS;
+  configuration["rounds"] = config.rounds;
+  configuration["unavailable_methods"] = nlohmann::ordered_json::array(
+      {{{"method", "io_uring"}, {"reason", "Linux-only interface"}}});
+  result_json["configuration"] = std::move(configuration);
+
+  nlohmann::ordered_json rows = nlohmann::ordered_json::array();
+  for (const FileIoRow& row : result.rows) {
+    nlohmann::ordered_json row_json;
+    row_json["method"] = file_io_method_to_string(row.method);
+    row_json["access"] = file_io_access_to_string(row.access);
+    row_json["passes"] = row.passes;
+    row_json["median_gb_s"] = row.median_gb_s;
+    row_json["rounds_gb_s"] = row.samples_gb_s;
+    if (row.method == FileIoMethod::Memory || row.median_gb_s <= 0.0) {
+      row_json["overhead_ns_per_byte"] = nullptr;
+      row_json["vs_memory_pct"] = nullptr;
+    } else {
+      row_json["overhead_ns_per_byte"] = row.overhead_ns_per_byte;
+      row_json["vs_memory_pct"] = row.vs_memory_pct;
+    }
+    rows.push_back(std::move(row_json));
+  }
+  result_json["results"] = std::move(rows);
+  result_json["total_execution_time_sec"] = total_execution_time_sec;
+  return result_json;
+}
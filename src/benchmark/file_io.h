@@ -0,0 +1,135 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file file_io.h
+ * @brief Standalone page-cache file I/O mode interfaces
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * `-R, --file-io` writes a temporary file, warms it into the unified buffer
+ * cache, and reads it sequentially and in random block order through mmap
+ * and through pread()/readv() into a reused buffer. The same read kernels on
+ * an anonymous buffer of the same size are the memory baseline, so each path
+ * is reported as its per-byte overhead over raw memory bandwidth.
+ */
+#ifndef FILE_IO_H
+#define FILE_IO_H
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "core/config/constants.h"
+#include "third_party/nlohmann/json.hpp"
+
+enum class FileIoMethod {
+  Memory,     ///< Read kernels on anonymous memory; the baseline
+  Mmap,       ///< Read kernels on a warm MAP_SHARED file mapping
+  MmapFresh,  ///< mmap(), read kernels, and munmap() inside every pass
+  Pread,      ///< pread() of one block into a reused buffer
+  Readv,      ///< readv() of one block split into equal iovecs
+};
+
+enum class FileIoAccess {
+  Sequential,
+  Random,  ///< Every block once per pass, in a fixed shuffled order
+};
+
+constexpr size_t FILE_IO_METHOD_COUNT = 5;
+constexpr size_t FILE_IO_ACCESS_COUNT = 2;
+
+struct FileIoConfig {
+  std::string directory;  ///< Empty uses $TMPDIR, then /tmp
+  unsigned long file_size_mb = Constants::FILE_IO_DEFAULT_FILE_SIZE_MB;
+  size_t block_kb = Constants::FILE_IO_DEFAULT_BLOCK_KB;
+  int rounds = Constants::FILE_IO_DEFAULT_ROUNDS;
+  std::string output_file;
+  bool help_requested = false;
+};
+
+/** @brief One method and access order. */
+struct FileIoRow {
+  FileIoMethod method = FileIoMethod::Memory;
+  FileIoAccess access = FileIoAccess::Sequential;
+  size_t passes = 0;                ///< Calibrated whole-file passes per round
+  std::vector<double> samples_gb_s;  ///< One per round
+  double median_gb_s = 0.0;
+  double overhead_ns_per_byte = 0.0;  ///< Extra time per byte over the memory row of the same access
+  double vs_memory_pct = 0.0;         ///< Signed bandwidth difference; negative is slower
+};
+
+struct FileIoResult {
+  size_t file_bytes = 0;
+  size_t block_bytes = 0;
+  std::vector<FileIoRow> rows;  ///< Access-major, methods in enum order
+  bool interrupted = false;
+};
+
+const char* file_io_method_to_string(FileIoMethod method);
+const char* file_io_access_to_string(FileIoAccess access);
+
+/**
+ * @brief Whether a block size fits the file.
+ *
+ * Blocks are powers of two from FILE_IO_MIN_BLOCK_KB to FILE_IO_MAX_BLOCK_KB
+ * and no larger than the file.
+ */
+bool file_io_block_is_valid(size_t block_kb, unsigned long file_size_mb);
+
+/**
+ * @brief Random block order: every block index once, shuffled with `seed`.
+ *
+ * Uses the pattern-mode no-replacement generator at block granularity.
+ */
+std::vector<size_t> build_file_io_block_order(size_t block_count, uint64_t seed);
+
+/**
+ * @brief Extra nanoseconds per byte of a path over the memory baseline.
+ * @return 0.0 when either bandwidth is not positive.
+ */
+double calculate_file_io_overhead_ns_per_byte(double path_gb_s, double memory_gb_s);
+
+/** @brief Every method for both access orders with no samples. */
+FileIoResult make_file_io_result(const FileIoConfig& config);
+
+/** @brief Reduce samples to medians and compare each path with memory. */
+void finalize_file_io_result(FileIoResult& result);
+
+nlohmann::ordered_json build_file_io_json(const FileIoConfig& config,
+                                          const FileIoResult& result,
+                                          const std::string& file_directory,
+                                          const std::string& cpu_name,
+                                          double total_execution_time_sec);
+
+/**
+ * @brief Parse CLI args for standalone file I/O mode.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on parse/validation error.
+ */
+int parse_file_io_mode_arguments(int argc, char* argv[], FileIoConfig& config);
+
+/**
+ * @brief Measure every path and access order, report, and save JSON.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on runtime/IO error.
+ */
+int run_file_io(const FileIoConfig& config);
+
+/**
+ * @brief Parse and run standalone file I/O mode from main().
+ */
+int run_file_io_mode(int argc, char* argv[]);
+
+#endif  // FILE_IO_H
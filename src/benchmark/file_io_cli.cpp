@@ -0,0 +1,181 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file file_io_cli.cpp
+ * @brief CLI parsing for standalone file I/O mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Parses and validates mode-specific command line options for
+ * `-R, --file-io`. Like the other standalone modes, only an explicit
+ * option set is accepted.
+ */
+
+#include "benchmark/file_io.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+
+#include "core/config/cli_options.h"
+#include "core/config/config.h"
+#include "core/config/constants.h"
+#include "core/signal/signal_handler.h"
+#include "output/console/messages/messages_api.h"
+#include "output/console/output_printer.h"
+
+namespace {
+
+constexpr const char* OPT_FILE_IO_SHORT = "-R";
+constexpr const char* OPT_FILE_IO_LONG = "--file-io";
+constexpr const char* OPT_FILE_DIR_LONG = "--file-dir";
+constexpr const char* OPT_IO_BLOCK_LONG = "--io-block";
+constexpr const char* OPT_BUFFER_SIZE_SHORT = "-b";
+constexpr const char* OPT_BUFFER_SIZE_LONG = "--buffer-size";
+constexpr const char* OPT_COUNT_SHORT = "-r";
+constexpr const char* OPT_COUNT_LONG = "--count";
+constexpr const char* OPT_HELP_SHORT = "-h";
+constexpr const char* OPT_HELP_LONG = "--help";
+constexpr const char* OPT_OUTPUT_SHORT = "-o";
+constexpr const char* OPT_OUTPUT_LONG = "--output";
+
+}  // namespace
+
+int parse_file_io_mode_arguments(int argc, char* argv[], FileIoConfig& config) {
+  config.rounds = Constants::FILE_IO_DEFAULT_ROUNDS;
+  config.file_size_mb = Constants::FILE_IO_DEFAULT_FILE_SIZE_MB;
+  config.block_kb = Constants::FILE_IO_DEFAULT_BLOCK_KB;
+
+  bool mode_seen = false;
+  bool output_seen = false;
+  bool buffer_size_seen = false;
+  bool count_seen = false;
+  bool directory_seen = false;
+  bool block_seen = false;
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+
+    if (is_option(arg, OPT_FILE_IO_SHORT, OPT_FILE_IO_LONG)) {
+      mode_seen = true;
+      continue;
+    }
+
+    if (is_option(arg, OPT_HELP_SHORT, OPT_HELP_LONG)) {
+      print_help(argv[0]);
+      config.help_requested = true;
+      return EXIT_SUCCESS;
+    }
+
+    if (is_option(arg, OPT_OUTPUT_SHORT, OPT_OUTPUT_LONG)) {
+      if (!take_option_value(argc, argv, i, output_seen, OPT_OUTPUT_LONG)) {
+        return EXIT_FAILURE;
+      }
+      config.output_file = argv[i];
+      continue;
+    }
+
+    if (is_option(arg, OPT_BUFFER_SIZE_SHORT, OPT_BUFFER_SIZE_LONG)) {
+      if (!take_option_value(argc, argv, i, buffer_size_seen, OPT_BUFFER_SIZE_LONG)) {
+        return EXIT_FAILURE;
+      }
+      int parsed = 0;
+      if (!parse_positive_int_option(OPT_BUFFER_SIZE_LONG, argv[i], parsed, argv[0])) {
+        return EXIT_FAILURE;
+      }
+      config.file_size_mb = static_cast<unsigned long>(parsed);
+      continue;
+    }
+
+    if (is_option(arg, OPT_COUNT_SHORT, OPT_COUNT_LONG)) {
+      if (!take_option_value(argc, argv, i, count_seen, OPT_COUNT_LONG)) {
+        return EXIT_FAILURE;
+      }
+      if (!parse_positive_int_option(OPT_COUNT_LONG, argv[i], config.rounds, argv[0])) {
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (arg == OPT_FILE_DIR_LONG) {
+      if (!take_option_value(argc, argv, i, directory_seen, OPT_FILE_DIR_LONG)) {
+        return EXIT_FAILURE;
+      }
+      config.directory = argv[i];
+      if (config.directory.empty()) {
+        std::cerr << Messages::error_prefix()
+                  << Messages::error_invalid_value(OPT_FILE_DIR_LONG, argv[i],
+                                                   "must name a directory")
+                  << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (arg == OPT_IO_BLOCK_LONG) {
+      if (!take_option_value(argc, argv, i, block_seen, OPT_IO_BLOCK_LONG)) {
+        return EXIT_FAILURE;
+      }
+      int parsed = 0;
+      if (!parse_positive_int_option(OPT_IO_BLOCK_LONG, argv[i], parsed, argv[0])) {
+        return EXIT_FAILURE;
+      }
+      config.block_kb = static_cast<size_t>(parsed);
+      continue;
+    }
+
+    std::cerr << Messages::error_prefix()
+              << Messages::error_file_io_must_be_used_alone()
+              << std::endl;
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  if (!mode_seen) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_file_io_must_be_used_alone()
+              << std::endl;
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  // Checked after parsing so --io-block and --buffer-size may come in any order.
+  if (!file_io_block_is_valid(config.block_kb, config.file_size_mb)) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_file_io_block_invalid(config.block_kb, config.file_size_mb)
+              << std::endl;
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+int run_file_io_mode(int argc, char* argv[]) {
+  FileIoConfig config;
+  if (parse_file_io_mode_arguments(argc, argv, config) != EXIT_SUCCESS) {
+    return EXIT_FAILURE;
+  }
+  if (config.help_requested) {
+    return EXIT_SUCCESS;
+  }
+
+  BenchmarkSignalMaskGuard signal_guard;
+  return run_file_io(config);
+}
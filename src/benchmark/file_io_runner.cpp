@@ -0,0 +1,342 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file file_io_runner.cpp
+ * @brief Temporary file, warm-up, and read paths for file I/O mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * The file is created with mkstemp() and unlinked at once, so only the open
+ * descriptor keeps it alive and no file is left behind on any exit path. It
+ * is written, fsync()ed so write-back cannot overlap the measurements, and
+ * read once to warm the unified buffer cache. Every pass then reads each
+ * block exactly once, so all paths move the same bytes.
+ */
+
+#include "benchmark/file_io.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark_work_plan.h"
+#include "benchmark/memory_kernels.h"
+#include "core/config/constants.h"
+#include "core/memory/memory_manager.h"
+#include "core/memory/memory_utils.h"
+#include "core/signal/signal_handler.h"
+#include "core/system/system_info.h"
+#include "core/timing/timer.h"
+#include "output/console/messages/messages_api.h"
+#include "output/console/output_printer.h"
+#include "output/json/json_output/json_output_api.h"
+
+namespace {
+
+class FileDescriptor {
+ public:
+  FileDescriptor() = default;
+  ~FileDescriptor() { reset(); }
+  FileDescriptor(const FileDescriptor&) = delete;
+  FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+  int get() const { return fd_; }
+  void reset(int fd = -1) {
+    if (fd_ >= 0) {
+      close(fd_);
+    }
+    fd_ = fd;
+  }
+
+ private:
+  int fd_ = -1;
+};
+
+struct FileIoContext {
+  int fd = -1;
+  size_t file_bytes = 0;
+  size_t block_bytes = 0;
+  size_t block_count = 0;
+  const char* memory = nullptr;   ///< Anonymous baseline buffer
+  const char* mapping = nullptr;  ///< Warm MAP_SHARED mapping of the file
+  char* block_buffer = nullptr;   ///< Reused pread()/readv() destination
+  const std::vector<size_t>* random_order = nullptr;
+  const MemoryKernelSet* kernels = nullptr;
+};
+
+std::string resolve_file_io_directory(const FileIoConfig& config) {
+  if (!config.directory.empty()) {
+    return config.directory;
+  }
+  const char* tmpdir = std::getenv("TMPDIR");
+  return tmpdir != nullptr && tmpdir[0] != '\0' ? tmpdir : "/tmp";
+}
+
+bool write_all(int fd, const char* data, size_t bytes) {
+  while (bytes > 0) {
+    const ssize_t written = write(fd, data, bytes);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    data += written;
+    bytes -= static_cast<size_t>(written);
+  }
+  return true;
+}
+
+bool read_block(const FileIoContext& context, FileIoMethod method, size_t offset,
+                bool seek_first) {
+  if (method == FileIoMethod::Pread) {
+    return pread(context.fd, context.block_buffer, context.block_bytes,
+                 static_cast<off_t>(offset)) == static_cast<ssize_t>(context.block_bytes);
+  }
+  // readv() has no offset argument; random order pays one lseek() per block.
+  if (seek_first && lseek(context.fd, static_cast<off_t>(offset), SEEK_SET) < 0) {
+    return false;
+  }
+  std::array<iovec, Constants::FILE_IO_READV_SEGMENTS> segments{};
+  const size_t segment_bytes = context.block_bytes / segments.size();
+  for (size_t segment = 0; segment < segments.size(); ++segment) {
+    segments[segment].iov_base = context.block_buffer + segment * segment_bytes;
+    segments[segment].iov_len = segment_bytes;
+  }
+  return readv(context.fd, segments.data(), static_cast<int>(segments.size())) ==
+         static_cast<ssize_t>(context.block_bytes);
+}
+
+// One whole-file pass in the row's block order.
+bool run_file_io_pass(const FileIoContext& context, FileIoMethod method, FileIoAccess access,
+                      uint64_t& checksum) {
+  const char* base = method == FileIoMethod::Memory ? context.memory : context.mapping;
+  void* fresh_mapping = MAP_FAILED;
+  if (method == FileIoMethod::MmapFresh) {
+    fresh_mapping = mmap(nullptr, context.file_bytes, PROT_READ, MAP_SHARED, context.fd, 0);
+    if (fresh_mapping == MAP_FAILED) {
+      return false;
+    }
+    base = static_cast<const char*>(fresh_mapping);
+  }
+
+  bool ok = true;
+  for (size_t index = 0; ok && index < context.block_count; ++index) {
+    const size_t block =
+        access == FileIoAccess::Random ? (*context.random_order)[index] : index;
+    const size_t offset = block * context.block_bytes;
+    switch (method) {
+      case FileIoMethod::Pread:
+      case FileIoMethod::Readv:
+        ok = read_block(context, method, offset, access == FileIoAccess::Random || index == 0);
+        break;
+      case FileIoMethod::Memory:
+      case FileIoMethod::Mmap:
+      case FileIoMethod::MmapFresh:
+        checksum ^= context.kernels->read(base + offset, context.block_bytes);
+        break;
+    }
+  }
+
+  if (fresh_mapping != MAP_FAILED) {
+    munmap(fresh_mapping, context.file_bytes);
+  }
+  return ok;
+}
+
+double time_file_io_passes(const FileIoContext& context, FileIoMethod method, FileIoAccess access,
+                           size_t passes, HighResTimer& timer, uint64_t& checksum) {
+  timer.start();
+  for (size_t pass = 0; pass < passes; ++pass) {
+    if (!run_file_io_pass(context, method, access, checksum)) {
+      return -1.0;
+    }
+  }
+  return timer.stop();
+}
+
+// Whole-file passes for one row, calibrated like --benchmark passes.
+size_t calibrate_file_io_row(const FileIoContext& context, const FileIoRow& row,
+                             HighResTimer& timer, uint64_t& checksum) {
+  const size_t pilot_passes = calculate_benchmark_pilot_passes(
+      context.file_bytes, Constants::BENCHMARK_CALIBRATION_MIN_PILOT_BYTES,
+      Constants::BENCHMARK_CALIBRATION_MAX_PASSES);
+  const double pilot_elapsed =
+      time_file_io_passes(context, row.method, row.access, pilot_passes, timer, checksum);
+  if (!benchmark_elapsed_is_valid(pilot_elapsed)) {
+    return 0;
+  }
+  return calculate_benchmark_calibrated_count(pilot_elapsed, pilot_passes,
+                                              Constants::BENCHMARK_CALIBRATION_TARGET_SECONDS, 1,
+                                              Constants::BENCHMARK_CALIBRATION_MAX_PASSES);
+}
+
+void print_file_io_report(const FileIoResult& result) {
+  std::cout << std::endl << Messages::report_file_io_header() << std::endl;
+  std::cout << Messages::report_file_io_note() << std::endl;
+  std::cout << Messages::report_file_io_table_header() << std::endl;
+  for (const FileIoRow& row : result.rows) {
+    if (row.samples_gb_s.empty()) {
+      continue;
+    }
+    std::cout << Messages::report_file_io_row(
+                     file_io_method_to_string(row.method), file_io_access_to_string(row.access),
+                     row.median_gb_s, row.overhead_ns_per_byte, row.vs_memory_pct,
+                     row.method == FileIoMethod::Memory)
+              << std::endl;
+  }
+}
+
+int fail_file_io(const std::string& reason) {
+  std::cerr << Messages::error_prefix() << Messages::error_file_io_failed(reason) << std::endl;
+  return EXIT_FAILURE;
+}
+
+}  // namespace
+
+int run_file_io(const FileIoConfig& config) {
+  print_runtime_banner();
+  FileIoResult result = make_file_io_result(config);
+  const std::string directory = resolve_file_io_directory(config);
+  std::string file_path = (std::filesystem::path(directory) / "membench-file-io-XXXXXX").string();
+  std::vector<char> path_template(file_path.begin(), file_path.end());
+  path_template.push_back('\0');
+
+  FileDescriptor file;
+  file.reset(mkstemp(path_template.data()));
+  if (file.get() < 0) {
+    return fail_file_io("cannot create a file in " + directory + ": " + strerror(errno));
+  }
+  file_path = path_template.data();
+  unlink(file_path.c_str());
+  std::cout << Messages::msg_running_file_io(file_path, config.file_size_mb, result.block_bytes)
+            << std::endl;
+  const auto run_start = std::chrono::steady_clock::now();
+
+  const MemoryKernelSet& kernels =
+      memory_kernel_set(MemoryKernelVariant::Neon);
+  MmapPtr memory = allocate_buffer(result.file_bytes, "file I/O memory baseline");
+  MmapPtr block_buffer = allocate_buffer(result.block_bytes, "file I/O block buffer");
+  if (!memory || !block_buffer) {
+    return fail_file_io("buffer allocation");
+  }
+  kernels.write(memory.get(), result.file_bytes);
+  kernels.write(block_buffer.get(), result.block_bytes);
+  if (!write_all(file.get(), static_cast<const char*>(memory.get()), result.file_bytes) ||
+      fsync(file.get()) != 0) {
+    return fail_file_io(std::string("writing the file: ") + strerror(errno));
+  }
+
+  void* mapping = mmap(nullptr, result.file_bytes, PROT_READ, MAP_SHARED, file.get(), 0);
+  if (mapping == MAP_FAILED) {
+    return fail_file_io(std::string("mapping the file: ") + strerror(errno));
+  }
+  MmapPtr mapping_owner(mapping, MmapDeleter{result.file_bytes});
+
+  const std::vector<size_t> random_order = build_file_io_block_order(
+      result.file_bytes / result.block_bytes, Constants::FILE_IO_RANDOM_SEED);
+  FileIoContext context;
+  context.fd = file.get();
+  context.file_bytes = result.file_bytes;
+  context.block_bytes = result.block_bytes;
+  context.block_count = result.file_bytes / result.block_bytes;
+  context.memory = static_cast<const char*>(memory.get());
+  context.mapping = static_cast<const char*>(mapping);
+  context.block_buffer = static_cast<char*>(block_buffer.get());
+  context.random_order = &random_order;
+  context.kernels = &kernels;
+
+  // Warm the page cache and the long-lived mapping's page tables.
+  uint64_t checksum = 0;
+  if (!run_file_io_pass(context, FileIoMethod::Pread, FileIoAccess::Sequential, checksum) ||
+      !run_file_io_pass(context, FileIoMethod::Mmap, FileIoAccess::Sequential, checksum)) {
+    return fail_file_io(std::string("warming the page cache: ") + strerror(errno));
+  }
+
+  auto timer_optional = HighResTimer::create();
+  if (!timer_optional) {
+    std::cerr << Messages::error_prefix() << Messages::error_timer_creation_failed() << std::endl;
+    return EXIT_FAILURE;
+  }
+  HighResTimer& timer = *timer_optional;
+
+  for (FileIoRow& row : result.rows) {
+    row.passes = calibrate_file_io_row(context, row, timer, checksum);
+    if (row.passes == 0) {
+      return fail_file_io(std::string(file_io_method_to_string(row.method)) + " calibration");
+    }
+    std::cout << Messages::msg_file_io_plan(file_io_method_to_string(row.method),
+                                            file_io_access_to_string(row.access), row.passes)
+              << std::endl;
+    if (signal_received()) {
+      result.interrupted = true;
+      break;
+    }
+  }
+
+  for (int round = 0; round < config.rounds && !result.interrupted; ++round) {
+    for (size_t index :
+         build_benchmark_cyclic_order(result.rows.size(), static_cast<size_t>(round))) {
+      FileIoRow& row = result.rows[index];
+      const double elapsed =
+          time_file_io_passes(context, row.method, row.access, row.passes, timer, checksum);
+      if (!benchmark_elapsed_is_valid(elapsed)) {
+        return fail_file_io(std::string(file_io_method_to_string(row.method)) + " read");
+      }
+      row.samples_gb_s.push_back(static_cast<double>(result.file_bytes) *
+                                 static_cast<double>(row.passes) / elapsed /
+                                 Constants::NANOSECONDS_PER_SECOND);
+      if (signal_received()) {
+        result.interrupted = true;
+        break;
+      }
+    }
+  }
+  if (result.interrupted) {
+    std::cout << std::endl << Messages::msg_interrupted_by_user() << std::endl;
+  }
+
+  finalize_file_io_result(result);
+  print_file_io_report(result);
+
+  if (!config.output_file.empty()) {
+    const double total_execution_time_sec =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - run_start).count();
+    std::filesystem::path output_path(config.output_file);
+    if (output_path.is_relative()) {
+      output_path = std::filesystem::current_path() / output_path;
+    }
+    if (write_json_to_file(output_path,
+                           build_file_io_json(config, result, directory, get_processor_name(),
+                                              total_execution_time_sec)) != EXIT_SUCCESS) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
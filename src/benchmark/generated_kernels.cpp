@@ -0,0 +1,235 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+/**
+ * @file generated_kernels.cpp
+ * @brief Template-generated sequential read/write/copy kernel matrix
+ *
+ * Each kernel walks the buffer in three tiers that mirror the hand-written
+ * asm kernels: an unrolled block loop, a 32-byte granule loop, and a byte
+ * tail. Keeping the 32-byte granule boundary identical is what makes the
+ * checksum of every generated read kernel equal to `memory_read_loop_asm`
+ * for any size, independent of unroll and access width.
+ */
+
+#include "benchmark/generated_kernels.h"
+
+#include <array>
+#include <utility>
+
+namespace {
+
+using GeneratedVector = uint64_t __attribute__((vector_size(16)));
+
+// Vector granule shared with the asm kernels; bytes past the last full
+// granule are handled one at a time and folded into the checksum unshifted.
+constexpr size_t kGranuleBytes = 32;
+
+constexpr std::array<size_t, 3> kUnrolls = {2, 4, 8};
+constexpr std::array<size_t, 2> kAccessWidths = {16, 32};
+constexpr std::array<GeneratedStoreHint, 2> kStoreHints = {
+    GeneratedStoreHint::Temporal, GeneratedStoreHint::NonTemporal};
+constexpr std::array<size_t, 2> kPrefetchDistances = {0, 512};
+constexpr size_t kMatrixSize = kUnrolls.size() * kAccessWidths.size() *
+                               kStoreHints.size() * kPrefetchDistances.size();
+
+template <size_t Width>
+inline void load_granule(const unsigned char* source, GeneratedVector& low,
+                         GeneratedVector& high) {
+  if constexpr (Width == 32) {
+    asm volatile("ldp %q0, %q1, [%2]" : "=w"(low), "=w"(high) : "r"(source) : "memory");
+  } else {
+    asm volatile("ldr %q0, [%1]" : "=w"(low) : "r"(source) : "memory");
+    asm volatile("ldr %q0, [%1, #16]" : "=w"(high) : "r"(source) : "memory");
+  }
+}
+
+// AArch64 has no single-register STNP, so 16-byte non-temporal accesses are
+// issued as one STNP pair per granule.
+template <size_t Width, GeneratedStoreHint Hint>
+inline void store_granule(unsigned char* destination, GeneratedVector low,
+                          GeneratedVector high) {
+  if constexpr (Hint == GeneratedStoreHint::NonTemporal) {
+    asm volatile("stnp %q0, %q1, [%2]" : : "w"(low), "w"(high), "r"(destination) : "memory");
+  } else if constexpr (Width == 32) {
+    asm volatile("stp %q0, %q1, [%2]" : : "w"(low), "w"(high), "r"(destination) : "memory");
+  } else {
+    asm volatile("str %q0, [%1]" : : "w"(low), "r"(destination) : "memory");
+    asm volatile("str %q0, [%1, #16]" : : "w"(high), "r"(destination) : "memory");
+  }
+}
+
+template <size_t Distance>
+inline void prefetch_for_load(const unsigned char* address) {
+  if constexpr (Distance != 0) {
+    asm volatile("prfm pldl1strm, [%0]" : : "r"(address + Distance));
+  }
+}
+
+template <size_t Distance>
+inline void prefetch_for_store(const unsigned char* address) {
+  if constexpr (Distance != 0) {
+    asm volatile("prfm pstl1strm, [%0]" : : "r"(address + Distance));
+  }
+}
+
+template <typename Body, size_t... Granule>
+inline void for_each_granule(std::index_sequence<Granule...>, Body&& body) {
+  (body(Granule), ...);
+}
+
+template <size_t Unroll, size_t Width, GeneratedStoreHint Hint, size_t Prefetch>
+struct GeneratedKernelBody {
+  static_assert(Width == 16 || Width == 32, "access width must be 16 or 32 bytes");
+  static constexpr size_t kBlockBytes = Unroll * Width;
+  static_assert(kBlockBytes % kGranuleBytes == 0,
+                "block must be a whole number of 32-byte granules");
+  static constexpr size_t kGranulesPerBlock = kBlockBytes / kGranuleBytes;
+  using Granules = std::make_index_sequence<kGranulesPerBlock>;
+
+  [[gnu::noinline]] static uint64_t read(const void* src, size_t byte_count) {
+    const unsigned char* cursor = static_cast<const unsigned char*>(src);
+    size_t remaining = byte_count;
+    GeneratedVector accumulators[kGranulesPerBlock] = {};
+    while (remaining >= kBlockBytes) {
+      prefetch_for_load<Prefetch>(cursor);
+      for_each_granule(Granules{}, [&](size_t granule) {
+        GeneratedVector low;
+        GeneratedVector high;
+        load_granule<Width>(cursor + granule * kGranuleBytes, low, high);
+        accumulators[granule] ^= low ^ high;
+      });
+      cursor += kBlockBytes;
+      remaining -= kBlockBytes;
+    }
+    while (remaining >= kGranuleBytes) {
+      GeneratedVector low;
+      GeneratedVector high;
+      load_granule<Width>(cursor, low, high);
+      accumulators[0] ^= low ^ high;
+      cursor += kGranuleBytes;
+      remaining -= kGranuleBytes;
+    }
+    GeneratedVector folded = {};
+    for (const GeneratedVector& accumulator : accumulators) {
+      folded ^= accumulator;
+    }
+    uint64_t checksum = folded[0] ^ folded[1];
+    for (; remaining != 0; --remaining) {
+      checksum ^= *cursor++;
+    }
+    return checksum;
+  }
+
+  [[gnu::noinline]] static void write(void* dst, size_t byte_count) {
+    unsigned char* cursor = static_cast<unsigned char*>(dst);
+    size_t remaining = byte_count;
+    const GeneratedVector zero = {};
+    while (remaining >= kBlockBytes) {
+      prefetch_for_store<Prefetch>(cursor);
+      for_each_granule(Granules{}, [&](size_t granule) {
+        store_granule<Width, Hint>(cursor + granule * kGranuleBytes, zero, zero);
+      });
+      cursor += kBlockBytes;
+      remaining -= kBlockBytes;
+    }
+    while (remaining >= kGranuleBytes) {
+      store_granule<Width, Hint>(cursor, zero, zero);
+      cursor += kGranuleBytes;
+      remaining -= kGranuleBytes;
+    }
+    for (; remaining != 0; --remaining) {
+      *cursor++ = 0;
+    }
+  }
+
+  [[gnu::noinline]] static void copy(void* dst, const void* src, size_t byte_count) {
+    unsigned char* destination = static_cast<unsigned char*>(dst);
+    const unsigned char* source = static_cast<const unsigned char*>(src);
+    size_t remaining = byte_count;
+    while (remaining >= kBlockBytes) {
+      prefetch_for_load<Prefetch>(source);
+      prefetch_for_store<Prefetch>(destination);
+      for_each_granule(Granules{}, [&](size_t granule) {
+        GeneratedVector low;
+        GeneratedVector high;
+        load_granule<Width>(source + granule * kGranuleBytes, low, high);
+        store_granule<Width, Hint>(destination + granule * kGranuleBytes, low, high);
+      });
+      source += kBlockBytes;
+      destination += kBlockBytes;
+      remaining -= kBlockBytes;
+    }
+    while (remaining >= kGranuleBytes) {
+      GeneratedVector low;
+      GeneratedVector high;
+      load_granule<Width>(source, low, high);
+      store_granule<Width, Hint>(destination, low, high);
+      source += kGranuleBytes;
+      destination += kGranuleBytes;
+      remaining -= kGranuleBytes;
+    }
+    for (; remaining != 0; --remaining) {
+      *destination++ = *source++;
+    }
+  }
+};
+
+// Matrix index layout: prefetch varies fastest, then store hint, access
+// width, and unroll, so registry order groups kernels by unroll factor.
+template <size_t Index>
+GeneratedKernel make_generated_kernel() {
+  constexpr size_t prefetch_count = kPrefetchDistances.size();
+  constexpr size_t hint_count = kStoreHints.size();
+  constexpr size_t width_count = kAccessWidths.size();
+  constexpr size_t prefetch = kPrefetchDistances[Index % prefetch_count];
+  constexpr GeneratedStoreHint hint = kStoreHints[(Index / prefetch_count) % hint_count];
+  constexpr size_t width =
+      kAccessWidths[(Index / (prefetch_count * hint_count)) % width_count];
+  constexpr size_t unroll =
+      kUnrolls[Index / (prefetch_count * hint_count * width_count)];
+  using Body = GeneratedKernelBody<unroll, width, hint, prefetch>;
+
+  GeneratedKernel kernel;
+  kernel.shape.unroll = unroll;
+  kernel.shape.access_width_bytes = width;
+  kernel.shape.store_hint = hint;
+  kernel.shape.prefetch_distance_bytes = prefetch;
+  kernel.name = generated_kernel_name(kernel.shape);
+  kernel.read = &Body::read;
+  kernel.write = &Body::write;
+  kernel.copy = &Body::copy;
+  return kernel;
+}
+
+template <size_t... Index>
+std::vector<GeneratedKernel> make_generated_kernels(std::index_sequence<Index...>) {
+  return {make_generated_kernel<Index>()...};
+}
+
+}  // namespace
+
+std::string generated_kernel_name(const GeneratedKernelShape& shape) {
+  return "generated-u" + std::to_string(shape.unroll) + "-w" +
+         std::to_string(shape.access_width_bytes) +
+         (shape.store_hint == GeneratedStoreHint::NonTemporal ? "-nt" : "-t") +
+         "-pf" + std::to_string(shape.prefetch_distance_bytes);
+}
+
+const std::vector<GeneratedKernel>& generated_kernels() {
+  static const std::vector<GeneratedKernel> kernels =
+      make_generated_kernels(std::make_index_sequence<kMatrixSize>{});
+  return kernels;
+}
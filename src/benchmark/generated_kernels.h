@@ -0,0 +1,79 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+/**
+ * @file generated_kernels.h
+ * @brief Template-generated sequential read/write/copy kernel matrix
+ *
+ * The hand-written kernels in src/asm remain the defaults. This matrix stamps
+ * out additional sequential kernels over unroll, access width, store hint, and
+ * prefetch distance from one C++ template so new shapes do not require a new
+ * assembly file. Every load and store is an inline-asm NEON instruction, so
+ * the compiler cannot elide, merge, or vectorize them differently.
+ */
+
+#ifndef GENERATED_KERNELS_H
+#define GENERATED_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @enum GeneratedStoreHint
+ * @brief Store instruction family used by generated write and copy kernels
+ */
+enum class GeneratedStoreHint {
+  Temporal = 0,  ///< STR/STP
+  NonTemporal,   ///< STNP (16-byte accesses are paired into one STNP)
+};
+
+/**
+ * @brief One point of the generated kernel matrix.
+ */
+struct GeneratedKernelShape {
+  size_t unroll = 0;                   ///< Accesses per block-loop iteration
+  size_t access_width_bytes = 0;       ///< 16 (LDR/STR q) or 32 (LDP/STP q)
+  GeneratedStoreHint store_hint = GeneratedStoreHint::Temporal;
+  size_t prefetch_distance_bytes = 0;  ///< 0 disables PRFM in the block loop
+};
+
+/**
+ * @brief Generated kernel entry points for one matrix point.
+ *
+ * Prototypes and payload semantics match `memory_read_loop_asm`,
+ * `memory_write_loop_asm`, and `memory_copy_loop_asm`: exact byte coverage,
+ * zero stores, and the same XOR checksum for any size.
+ */
+struct GeneratedKernel {
+  GeneratedKernelShape shape;
+  std::string name;  ///< e.g. "generated-u4-w32-nt-pf512"
+  uint64_t (*read)(const void*, size_t) = nullptr;
+  void (*write)(void*, size_t) = nullptr;
+  void (*copy)(void*, const void*, size_t) = nullptr;
+};
+
+/**
+ * @brief Build the canonical registry name for a matrix point.
+ */
+std::string generated_kernel_name(const GeneratedKernelShape& shape);
+
+/**
+ * @brief Return every generated kernel in deterministic matrix order.
+ */
+const std::vector<GeneratedKernel>& generated_kernels();
+
+#endif  // GENERATED_KERNELS_H
@@ -0,0 +1,228 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file ipc_bandwidth.cpp
+ * @brief Method parsing, metric conversion, result reduction, and JSON for IPC bandwidth mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Everything here is measurement-free so it can be unit tested; fork(), the
+ * transfer mechanisms, and CPU accounting live in ipc_bandwidth_runner.cpp.
+ */
+
+#include "benchmark/ipc_bandwidth.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include "core/config/config.h"
+#include "utils/descriptive_statistics.h"
+
+namespace {
+
+constexpr IpcMethod kMethods[IPC_METHOD_COUNT] = {IpcMethod::ShmRing, IpcMethod::Pipe,
+                                                  IpcMethod::UnixSocket, IpcMethod::MmapHandoff};
+
+constexpr IpcMetric kMetrics[IPC_METRIC_COUNT] = {
+    IpcMetric::Bandwidth, IpcMetric::Latency, IpcMetric::CpuPerByte, IpcMetric::SenderCpuPerByte,
+    IpcMetric::ReceiverCpuPerByte};
+
+}  // namespace
+
+const char* ipc_method_to_string(IpcMethod method) {
+  switch (method) {
+    case IpcMethod::Pipe:
+      return "pipe";
+    case IpcMethod::UnixSocket:
+      return "unix-socket";
+    case IpcMethod::MmapHandoff:
+      return "mmap-handoff";
+    case IpcMethod::ShmRing:
+    default:
+      return "shm-ring";
+  }
+}
+
+const char* ipc_metric_to_string(IpcMetric metric) {
+  switch (metric) {
+    case IpcMetric::Latency:
+      return "latency_us";
+    case IpcMetric::CpuPerByte:
+      return "cpu_ns_per_byte";
+    case IpcMetric::SenderCpuPerByte:
+      return "sender_cpu_ns_per_byte";
+    case IpcMetric::ReceiverCpuPerByte:
+      return "receiver_cpu_ns_per_byte";
+    case IpcMetric::Bandwidth:
+    default:
+      return "gb_s";
+  }
+}
+
+bool parse_ipc_methods(const std::string& text, std::vector<IpcMethod>& out_methods) {
+  std::vector<IpcMethod> methods;
+  std::stringstream stream(text);
+  std::string token;
+  while (std::getline(stream, token, ',')) {
+    const IpcMethod* match = std::find_if(std::begin(kMethods), std::end(kMethods),
+                                          [&token](IpcMethod method) {
+                                            return token == ipc_method_to_string(method);
+                                          });
+    if (match == std::end(kMethods) ||
+        std::find(methods.begin(), methods.end(), *match) != methods.end()) {
+      return false;
+    }
+    methods.push_back(*match);
+  }
+  // getline drops a trailing empty field, so "pipe," would otherwise pass.
+  if (methods.empty() || text.back() == ',') {
+    return false;
+  }
+  out_methods = std::move(methods);
+  return true;
+}
+
+bool parse_ipc_message_sizes(const std::string& text, std::vector<size_t>& out_sizes_kb) {
+  std::vector<size_t> sizes;
+  std::stringstream stream(text);
+  std::string token;
+  while (std::getline(stream, token, ',')) {
+    long long parsed = 0;
+    if (parse_strict_signed_decimal(token, parsed) != StrictIntegerParseStatus::Success ||
+        parsed < 1 ||
+        parsed > static_cast<long long>(Constants::IPC_BANDWIDTH_MAX_MESSAGE_SIZE_KB)) {
+      return false;
+    }
+    const size_t size = static_cast<size_t>(parsed);
+    if (std::find(sizes.begin(), sizes.end(), size) != sizes.end()) {
+      return false;
+    }
+    sizes.push_back(size);
+  }
+  if (sizes.empty() || text.back() == ',') {
+    return false;
+  }
+  out_sizes_kb = std::move(sizes);
+  return true;
+}
+
+std::vector<IpcMethod> resolve_ipc_methods(const std::vector<IpcMethod>& requested) {
+  if (!requested.empty()) {
+    return requested;
+  }
+  return std::vector<IpcMethod>(std::begin(kMethods), std::end(kMethods));
+}
+
+size_t calculate_ipc_latency_messages(size_t stream_messages) {
+  return std::clamp(stream_messages, Constants::IPC_BANDWIDTH_MIN_LATENCY_MESSAGES,
+                    Constants::IPC_BANDWIDTH_MAX_LATENCY_MESSAGES);
+}
+
+std::array<double, IPC_METRIC_COUNT> calculate_ipc_metrics(size_t payload_bytes,
+                                                           double stream_seconds,
+                                                           double sender_cpu_seconds,
+                                                           double receiver_cpu_seconds,
+                                                           double latency_seconds,
+                                                           size_t latency_messages) {
+  std::array<double, IPC_METRIC_COUNT> values{};
+  if (payload_bytes == 0) {
+    return values;
+  }
+  const double bytes = static_cast<double>(payload_bytes);
+  if (stream_seconds > 0.0) {
+    values[static_cast<size_t>(IpcMetric::Bandwidth)] =
+        bytes / stream_seconds / Constants::NANOSECONDS_PER_SECOND;
+  }
+  if (latency_seconds > 0.0 && latency_messages > 0) {
+    values[static_cast<size_t>(IpcMetric::Latency)] =
+        latency_seconds * Constants::MICROSECONDS_PER_SECOND /
+        static_cast<double>(latency_messages);
+  }
+  const double sender = std::max(0.0, sender_cpu_seconds) * Constants::NANOSECONDS_PER_SECOND / bytes;
+  const double receiver =
+      std::max(0.0, receiver_cpu_seconds) * Constants::NANOSECONDS_PER_SECOND / bytes;
+  values[static_cast<size_t>(IpcMetric::SenderCpuPerByte)] = sender;
+  values[static_cast<size_t>(IpcMetric::ReceiverCpuPerByte)] = receiver;
+  values[static_cast<size_t>(IpcMetric::CpuPerByte)] = sender + receiver;
+  return values;
+}
+
+IpcBandwidthResult make_ipc_bandwidth_result(const IpcBandwidthConfig& config) {
+  std::vector<size_t> sizes_kb = config.message_sizes_kb;
+  std::sort(sizes_kb.begin(), sizes_kb.end());
+
+  IpcBandwidthResult result;
+  for (IpcMethod method : resolve_ipc_methods(config.methods)) {
+    for (size_t size_kb : sizes_kb) {
+      IpcBandwidthRow row;
+      row.method = method;
+      row.message_bytes = size_kb * Constants::BYTES_PER_KB;
+      result.rows.push_back(std::move(row));
+    }
+  }
+  return result;
+}
+
+void finalize_ipc_bandwidth_result(IpcBandwidthResult& result) {
+  for (IpcBandwidthRow& row : result.rows) {
+    for (size_t metric = 0; metric < IPC_METRIC_COUNT; ++metric) {
+      row.median[metric] = row.samples[metric].empty()
+                               ? 0.0
+                               : calculate_descriptive_statistics(row.samples[metric]).median;
+    }
+  }
+}
+
+nlohmann::ordered_json build_ipc_bandwidth_json(const IpcBandwidthConfig& config,
+                                                const IpcBandwidthResult& result,
+                                                const std::string& cpu_name,
+                                                double total_execution_time_sec) {
+  nlohmann::ordered_json result_json;
+  result_json["mode"] = Constants::IPC_BANDWIDTH_JSON_MODE_NAME;
+  result_json["schema_version"] = Constants::IPC_BANDWIDTH_JSON_SCHEMA_VERSION;
+  result_json["methodology_version"] = Constants::IPC_BANDWIDTH_METHODOLOGY_VERSION;
+  result_json["status"] = result.interrupted ? "interrupted" : "complete";
+  result_json["cpu_name"] = cpu_name;
+
+  nlohmann::ordered_json configuration;
+  nlohmann::ordered_json methods = nlohmann::ordered_json::array();
+  for (IpcMethod method : resolve_ipc_methods(config.methods)) {
+    methods.push_back(ipc_method_to_string(method));
+  }
+  configuration["methods"] = std::move(methods);
+  configuration["message_sizes_kb"] = config.message_sizes_kb;
+  configuration["rounds"] = config.rounds;
+  configuration["shm_ring_bytes"] = Constants::IPC_BANDWIDTH_SHM_RING_BYTES;
+  result_json["configuration"] = std::move(configuration);
+
+  nlohmann::ordered_json rows = nlohmann::ordered_json::array();
+  for (const IpcBandwidthRow& row : result.rows) {
+    nlohmann::ordered_json row_json;
+    row_json["method"] = ipc_method_to_string(row.method);
+    row_json["message_bytes"] = row.message_bytes;
+    row_json["messages"] = row.messages;
+    row_json["latency_messages"] = row.latency_messages;
+    for (size_t metric = 0; metric < IPC_METRIC_COUNT; ++metric) {
+      row_json[ipc_metric_to_string(kMetrics[metric])] = {{"median", row.median[metric]},
+                                                           {"rounds", row.samples[metric]}};
+    }
+    rows.push_back(std::move(row_json));
+  }
+  result_json["results"] = std::move(rows);
+  result_json["total_execution_time_sec"] = total_execution_time_sec;
+  return result_json;
+}
@@ -0,0 +1,142 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file ipc_bandwidth.h
+ * @brief Standalone inter-process transfer suite interfaces
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * `-E, --ipc-bandwidth` streams calibrated runs of equal-size messages from
+ * the parent process to a forked receiver over each mechanism, then
+ * measures per-message round trips. Throughput, latency, and the CPU time
+ * both sides consumed per byte are reported per mechanism and message size.
+ */
+#ifndef IPC_BANDWIDTH_H
+#define IPC_BANDWIDTH_H
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "core/config/constants.h"
+#include "third_party/nlohmann/json.hpp"
+
+enum class IpcMethod {
+  ShmRing,      ///< Byte ring in a shm_open() mapping; one copy in, one copy out
+  Pipe,         ///< pipe() with write()/read()
+  UnixSocket,   ///< AF_UNIX SOCK_STREAM socketpair()
+  MmapHandoff,  ///< Sender fills a shared slot, receiver reads it in place and drops it
+};
+
+enum class IpcMetric {
+  Bandwidth,          ///< GB/s of message payload
+  Latency,            ///< Microseconds per message round trip
+  CpuPerByte,         ///< Sender plus receiver CPU nanoseconds per payload byte
+  SenderCpuPerByte,   ///< Sender CPU nanoseconds per payload byte
+  ReceiverCpuPerByte, ///< Receiver CPU nanoseconds per payload byte
+};
+
+constexpr size_t IPC_METHOD_COUNT = 4;
+constexpr size_t IPC_METRIC_COUNT = 5;
+
+struct IpcBandwidthConfig {
+  std::vector<IpcMethod> methods;  ///< Empty measures every method
+  std::vector<size_t> message_sizes_kb = {4, 64, 1024, 16384};
+  int rounds = Constants::IPC_BANDWIDTH_DEFAULT_ROUNDS;
+  std::string output_file;
+  bool help_requested = false;
+};
+
+/** @brief One method and message size. */
+struct IpcBandwidthRow {
+  IpcMethod method = IpcMethod::ShmRing;
+  size_t message_bytes = 0;
+  size_t messages = 0;          ///< Calibrated stream length per round
+  size_t latency_messages = 0;  ///< Round trips per round
+  std::array<std::vector<double>, IPC_METRIC_COUNT> samples;  ///< Indexed by IpcMetric, one per round
+  std::array<double, IPC_METRIC_COUNT> median{};
+};
+
+struct IpcBandwidthResult {
+  std::vector<IpcBandwidthRow> rows;  ///< Method-major, message size ascending within a method
+  bool interrupted = false;
+};
+
+const char* ipc_method_to_string(IpcMethod method);
+const char* ipc_metric_to_string(IpcMetric metric);
+
+/**
+ * @brief Parse a comma-separated method list such as "pipe,shm-ring".
+ *
+ * Names are shm-ring, pipe, unix-socket, and mmap-handoff; each may appear once.
+ */
+bool parse_ipc_methods(const std::string& text, std::vector<IpcMethod>& out_methods);
+
+/**
+ * @brief Parse comma-separated message sizes in KB.
+ *
+ * Every entry must be a distinct integer from 1 to IPC_BANDWIDTH_MAX_MESSAGE_SIZE_KB.
+ */
+bool parse_ipc_message_sizes(const std::string& text, std::vector<size_t>& out_sizes_kb);
+
+/** @brief Configured methods, or every method in enum order when none were given. */
+std::vector<IpcMethod> resolve_ipc_methods(const std::vector<IpcMethod>& requested);
+
+/** @brief Round trips per latency phase: the stream length clamped to the latency bounds. */
+size_t calculate_ipc_latency_messages(size_t stream_messages);
+
+/**
+ * @brief Convert one stream run into per-round metric values.
+ * @param payload_bytes Message bytes times messages.
+ * @return Values indexed by IpcMetric; zero where the input cannot define one.
+ */
+std::array<double, IPC_METRIC_COUNT> calculate_ipc_metrics(size_t payload_bytes,
+                                                           double stream_seconds,
+                                                           double sender_cpu_seconds,
+                                                           double receiver_cpu_seconds,
+                                                           double latency_seconds,
+                                                           size_t latency_messages);
+
+/** @brief One row per method and size with no samples; sizes are sorted ascending. */
+IpcBandwidthResult make_ipc_bandwidth_result(const IpcBandwidthConfig& config);
+
+/** @brief Reduce samples to medians. */
+void finalize_ipc_bandwidth_result(IpcBandwidthResult& result);
+
+nlohmann::ordered_json build_ipc_bandwidth_json(const IpcBandwidthConfig& config,
+                                                const IpcBandwidthResult& result,
+                                                const std::string& cpu_name,
+                                                double total_execution_time_sec);
+
+/**
+ * @brief Parse CLI args for standalone IPC bandwidth mode.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on parse/validation error.
+ */
+int parse_ipc_bandwidth_mode_arguments(int argc, char* argv[], IpcBandwidthConfig& config);
+
+/**
+ * @brief Measure every method and message size, report, and save JSON.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on runtime/IO error.
+ */
+int run_ipc_bandwidth(const IpcBandwidthConfig& config);
+
+/**
+ * @brief Parse and run standalone IPC bandwidth mode from main().
+ */
+int run_ipc_bandwidth_mode(int argc, char* argv[]);
+
+#endif  // IPC_BANDWIDTH_H
@@ -0,0 +1,154 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file ipc_bandwidth_cli.cpp
+ * @brief CLI parsing for standalone IPC bandwidth mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Parses and validates mode-specific command line options for
+ * `-E, --ipc-bandwidth`. Like the other standalone modes, only an explicit
+ * option set is accepted.
+ */
+
+#include "benchmark/ipc_bandwidth.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+
+#include "core/config/cli_options.h"
+#include "core/config/config.h"
+#include "core/config/constants.h"
+#include "core/signal/signal_handler.h"
+#include "output/console/messages/messages_api.h"
+#include "output/console/output_printer.h"
+
+namespace {
+
+constexpr const char* OPT_IPC_BANDWIDTH_SHORT = "-E";
+constexpr const char* OPT_IPC_BANDWIDTH_LONG = "--ipc-bandwidth";
+constexpr const char* OPT_IPC_METHODS_LONG = "--ipc-methods";
+constexpr const char* OPT_MESSAGE_SIZE_LONG = "--message-size";
+constexpr const char* OPT_COUNT_SHORT = "-r";
+constexpr const char* OPT_COUNT_LONG = "--count";
+constexpr const char* OPT_HELP_SHORT = "-h";
+constexpr const char* OPT_HELP_LONG = "--help";
+constexpr const char* OPT_OUTPUT_SHORT = "-o";
+constexpr const char* OPT_OUTPUT_LONG = "--output";
+
+}  // namespace
+
+int parse_ipc_bandwidth_mode_arguments(int argc, char* argv[], IpcBandwidthConfig& config) {
+  config.rounds = Constants::IPC_BANDWIDTH_DEFAULT_ROUNDS;
+
+  bool mode_seen = false;
+  bool output_seen = false;
+  bool count_seen = false;
+  bool methods_seen = false;
+  bool sizes_seen = false;
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+
+    if (is_option(arg, OPT_IPC_BANDWIDTH_SHORT, OPT_IPC_BANDWIDTH_LONG)) {
+      mode_seen = true;
+      continue;
+    }
+
+    if (is_option(arg, OPT_HELP_SHORT, OPT_HELP_LONG)) {
+      print_help(argv[0]);
+      config.help_requested = true;
+      return EXIT_SUCCESS;
+    }
+
+    if (is_option(arg, OPT_OUTPUT_SHORT, OPT_OUTPUT_LONG)) {
+      if (!take_option_value(argc, argv, i, output_seen, OPT_OUTPUT_LONG)) {
+        return EXIT_FAILURE;
+      }
+      config.output_file = argv[i];
+      continue;
+    }
+
+    if (is_option(arg, OPT_COUNT_SHORT, OPT_COUNT_LONG)) {
+      if (!take_option_value(argc, argv, i, count_seen, OPT_COUNT_LONG)) {
+        return EXIT_FAILURE;
+      }
+      if (!parse_positive_int_option(OPT_COUNT_LONG, argv[i], config.rounds, argv[0])) {
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (arg == OPT_IPC_METHODS_LONG) {
+      if (!take_option_value(argc, argv, i, methods_seen, OPT_IPC_METHODS_LONG)) {
+        return EXIT_FAILURE;
+      }
+      if (!parse_ipc_methods(argv[i], config.methods)) {
+        std::cerr << Messages::error_prefix()
+                  << Messages::error_ipc_methods_invalid(argv[i]) << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (arg == OPT_MESSAGE_SIZE_LONG) {
+      if (!take_option_value(argc, argv, i, sizes_seen, OPT_MESSAGE_SIZE_LONG)) {
+        return EXIT_FAILURE;
+      }
+      if (!parse_ipc_message_sizes(argv[i], config.message_sizes_kb)) {
+        std::cerr << Messages::error_prefix()
+                  << Messages::error_ipc_message_sizes_invalid(argv[i]) << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    std::cerr << Messages::error_prefix()
+              << Messages::error_ipc_bandwidth_must_be_used_alone()
+              << std::endl;
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  if (!mode_seen) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_ipc_bandwidth_must_be_used_alone()
+              << std::endl;
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+int run_ipc_bandwidth_mode(int argc, char* argv[]) {
+  IpcBandwidthConfig config;
+  if (parse_ipc_bandwidth_mode_arguments(argc, argv, config) != EXIT_SUCCESS) {
+    return EXIT_FAILURE;
+  }
+  if (config.help_requested) {
+    return EXIT_SUCCESS;
+  }
+
+  // The forked receiver inherits the blocked mask.
+  BenchmarkSignalMaskGuard signal_guard;
+  return run_ipc_bandwidth(config);
+}
@@ -0,0 +1,673 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file ipc_bandwidth_runner.cpp
+ * @brief Transfer mechanisms, forked receiver, and CPU accounting for IPC bandwidth mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Every run forks a fresh receiver and builds a fresh channel, so no
+ * mechanism inherits buffered state from the one before it. The parent is
+ * always the sender. Both sides meet through a small MAP_SHARED control
+ * area: the receiver flags readiness, the end of the stream, and each
+ * latency acknowledgement there, and leaves its CPU time for the parent.
+ *
+ * Spin-waits check the peer every IPC_BANDWIDTH_PEER_CHECK_SPINS iterations
+ * so a receiver that dies (or a parent that disappears) cannot hang the run.
+ */
+
+#include "benchmark/ipc_bandwidth.h"
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark_work_plan.h"
+#include "benchmark/memory_kernels.h"
+#include "core/config/constants.h"
+#include "core/memory/memory_manager.h"
+#include "core/memory/memory_utils.h"
+#include "core/signal/signal_handler.h"
+#include "core/system/system_info.h"
+#include "core/timing/timer.h"
+#include "output/console/messages/messages_api.h"
+#include "output/console/output_printer.h"
+#include "output/json/json_output/json_output_api.h"
+
+namespace {
+
+constexpr size_t kHandoffSlots = 2;  // Sender fills one slot while the receiver drains the other
+
+// The control area lives in memory shared across fork(), so its atomics must
+// not depend on process-local lock tables.
+static_assert(std::atomic<uint64_t>::is_always_lock_free &&
+                  std::atomic<bool>::is_always_lock_free,
+              "process-shared control needs address-free atomics");
+
+struct alignas(128) IpcCursor {
+  std::atomic<uint64_t> value{0};
+};
+
+struct IpcControl {
+  std::atomic<bool> receiver_ready{false};
+  std::atomic<bool> stream_done{false};
+  std::atomic<bool> latency_ready{false};
+  std::atomic<uint64_t> acknowledged{0};
+  IpcCursor ring_head;        ///< Bytes the sender has produced
+  IpcCursor ring_tail;        ///< Bytes the receiver has consumed
+  IpcCursor slots_published;  ///< Handoff messages the sender has filled
+  IpcCursor slots_released;   ///< Handoff messages the receiver has dropped
+  double receiver_cpu_seconds = 0.0;
+};
+
+class FileDescriptor {
+ public:
+  FileDescriptor() = default;
+  ~FileDescriptor() { reset(); }
+  FileDescriptor(const FileDescriptor&) = delete;
+  FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+  int get() const { return fd_; }
+  void reset(int fd = -1) {
+    if (fd_ >= 0) {
+      close(fd_);
+    }
+    fd_ = fd;
+  }
+
+ private:
+  int fd_ = -1;
+};
+
+struct IpcChannel {
+  IpcMethod method = IpcMethod::ShmRing;
+  size_t message_bytes = 0;
+  uint64_t expected_checksum = 0;  ///< Read-kernel checksum of one message
+  const MemoryKernelSet* kernels = nullptr;
+  IpcControl* control = nullptr;
+  MmapPtr control_area{nullptr, MmapDeleter{0}};
+  MmapPtr ring{nullptr, MmapDeleter{0}};
+  MmapPtr slots{nullptr, MmapDeleter{0}};
+  FileDescriptor sender_fd;    ///< Pipe write end or the parent's socket
+  FileDescriptor receiver_fd;  ///< Pipe read end or the receiver's socket
+};
+
+struct IpcPeer {
+  pid_t child = 0;   ///< Receiver pid, watched by the parent
+  pid_t parent = 0;  ///< Parent pid, watched by the receiver
+  bool child_exited = false;
+  int child_status = 0;
+};
+
+struct IpcRunTimes {
+  double stream_seconds = 0.0;
+  double sender_cpu_seconds = 0.0;
+  double receiver_cpu_seconds = 0.0;
+  double latency_seconds = 0.0;
+};
+
+// SIGPIPE would kill the sender when a receiver dies mid-stream; write()
+// reports EPIPE instead while this guard is alive.
+class SigpipeIgnoreGuard {
+ public:
+  SigpipeIgnoreGuard() {
+    struct sigaction ignore {};
+    ignore.sa_handler = SIG_IGN;
+    sigemptyset(&ignore.sa_mask);
+    installed_ = sigaction(SIGPIPE, &ignore, &previous_) == 0;
+  }
+  ~SigpipeIgnoreGuard() {
+    if (installed_) {
+      sigaction(SIGPIPE, &previous_, nullptr);
+    }
+  }
+  SigpipeIgnoreGuard(const SigpipeIgnoreGuard&) = delete;
+  SigpipeIgnoreGuard& operator=(const SigpipeIgnoreGuard&) = delete;
+
+ private:
+  struct sigaction previous_ {};
+  bool installed_ = false;
+};
+
+double process_cpu_seconds() {
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+  const auto to_seconds = [](const timeval& value) {
+    return static_cast<double>(value.tv_sec) + static_cast<double>(value.tv_usec) / 1e6;
+  };
+  return to_seconds(usage.ru_utime) + to_seconds(usage.ru_stime);
+}
+
+bool peer_alive(IpcPeer& peer) {
+  if (peer.child > 0) {
+    if (!peer.child_exited && waitpid(peer.child, &peer.child_status, WNOHANG) == peer.child) {
+      peer.child_exited = true;
+    }
+    return !peer.child_exited;
+  }
+  return getppid() == peer.parent;
+}
+
+template <typename Ready>
+bool spin_until(Ready ready, IpcPeer& peer) {
+  size_t spins = 0;
+  while (!ready()) {
+    if (++spins % Constants::IPC_BANDWIDTH_PEER_CHECK_SPINS == 0 && !peer_alive(peer)) {
+      return false;
+    }
+    std::this_thread::yield();
+  }
+  return true;
+}
+
+bool write_all(int fd, const char* data, size_t bytes) {
+  while (bytes > 0) {
+    const ssize_t written = write(fd, data, bytes);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    data += written;
+    bytes -= static_cast<size_t>(written);
+  }
+  return true;
+}
+
+bool read_all(int fd, char* data, size_t bytes) {
+  while (bytes > 0) {
+    const ssize_t received = read(fd, data, bytes);
+    if (received < 0 && errno == EINTR) {
+      continue;
+    }
+    if (received <= 0) {
+      return false;
+    }
+    data += received;
+    bytes -= static_cast<size_t>(received);
+  }
+  return true;
+}
+
+bool ring_send(IpcChannel& channel, const char* data, IpcPeer& peer) {
+  IpcControl& control = *channel.control;
+  const size_t capacity = Constants::IPC_BANDWIDTH_SHM_RING_BYTES;
+  uint64_t head = control.ring_head.value.load(std::memory_order_relaxed);
+  size_t remaining = channel.message_bytes;
+  while (remaining > 0) {
+    uint64_t tail = 0;
+    if (!spin_until(
+            [&] {
+              tail = control.ring_tail.value.load(std::memory_order_acquire);
+              return head - tail < capacity;
+            },
+            peer)) {
+      return false;
+    }
+    const size_t offset = static_cast<size_t>(head % capacity);
+    const size_t chunk = std::min({remaining, capacity - static_cast<size_t>(head - tail),
+                                   capacity - offset});
+    std::memcpy(static_cast<char*>(channel.ring.get()) + offset, data, chunk);
+    head += chunk;
+    data += chunk;
+    remaining -= chunk;
+    control.ring_head.value.store(head, std::memory_order_release);
+  }
+  return true;
+}
+
+bool ring_receive(IpcChannel& channel, char* data, IpcPeer& peer) {
+  IpcControl& control = *channel.control;
+  const size_t capacity = Constants::IPC_BANDWIDTH_SHM_RING_BYTES;
+  uint64_t tail = control.ring_tail.value.load(std::memory_order_relaxed);
+  size_t remaining = channel.message_bytes;
+  while (remaining > 0) {
+    uint64_t head = 0;
+    if (!spin_until(
+            [&] {
+              head = control.ring_head.value.load(std::memory_order_acquire);
+              return head != tail;
+            },
+            peer)) {
+      return false;
+    }
+    const size_t offset = static_cast<size_t>(tail % capacity);
+    const size_t chunk =
+        std::min({remaining, static_cast<size_t>(head - tail), capacity - offset});
+    std::memcpy(data, static_cast<const char*>(channel.ring.get()) + offset, chunk);
+    tail += chunk;
+    data += chunk;
+    remaining -= chunk;
+    control.ring_tail.value.store(tail, std::memory_order_release);
+  }
+  return true;
+}
+
+char* handoff_slot(IpcChannel& channel, uint64_t sequence) {
+  return static_cast<char*>(channel.slots.get()) +
+         static_cast<size_t>(sequence % kHandoffSlots) * channel.message_bytes;
+}
+
+bool handoff_send(IpcChannel& channel, const char* data, IpcPeer& peer) {
+  IpcControl& control = *channel.control;
+  const uint64_t sequence = control.slots_published.value.load(std::memory_order_relaxed);
+  if (!spin_until(
+          [&] {
+            return sequence - control.slots_released.value.load(std::memory_order_acquire) <
+                   kHandoffSlots;
+          },
+          peer)) {
+    return false;
+  }
+  std::memcpy(handoff_slot(channel, sequence), data, channel.message_bytes);
+  control.slots_published.value.store(sequence + 1, std::memory_order_release);
+  return true;
+}
+
+// The receiver consumes the message in place and drops its pages, the way a
+// handed-off mapping is retired. MADV_DONTNEED is advisory on shared memory;
+// its cost, not a guaranteed release, is what gets measured.
+bool handoff_receive(IpcChannel& channel, IpcPeer& peer) {
+  IpcControl& control = *channel.control;
+  const uint64_t sequence = control.slots_released.value.load(std::memory_order_relaxed);
+  if (!spin_until(
+          [&] {
+            return control.slots_published.value.load(std::memory_order_acquire) > sequence;
+          },
+          peer)) {
+    return false;
+  }
+  char* slot = handoff_slot(channel, sequence);
+  if (channel.kernels->read(slot, channel.message_bytes) != channel.expected_checksum) {
+    return false;
+  }
+  madvise(slot, channel.message_bytes, MADV_DONTNEED);
+  control.slots_released.value.store(sequence + 1, std::memory_order_release);
+  return true;
+}
+
+bool send_message(IpcChannel& channel, const char* data, IpcPeer& peer) {
+  switch (channel.method) {
+    case IpcMethod::Pipe:
+    case IpcMethod::UnixSocket:
+      return write_all(channel.sender_fd.get(), data, channel.message_bytes);
+    case IpcMethod::MmapHandoff:
+      return handoff_send(channel, data, peer);
+    case IpcMethod::ShmRing:
+    default:
+      return ring_send(channel, data, peer);
+  }
+}
+
+bool receive_message(IpcChannel& channel, char* data, IpcPeer& peer) {
+  switch (channel.method) {
+    case IpcMethod::Pipe:
+    case IpcMethod::UnixSocket:
+      return read_all(channel.receiver_fd.get(), data, channel.message_bytes);
+    case IpcMethod::MmapHandoff:
+      return handoff_receive(channel, peer);
+    case IpcMethod::ShmRing:
+    default:
+      return ring_receive(channel, data, peer);
+  }
+}
+
+// shm_open() names are limited to 31 characters on macOS; the object is
+// unlinked as soon as it is mapped, so only the mapping keeps it alive.
+MmapPtr map_shm_ring() {
+  const std::string name = "/membench-ipc-" + std::to_string(getpid());
+  const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0) {
+    return MmapPtr(nullptr, MmapDeleter{0});
+  }
+  shm_unlink(name.c_str());
+  FileDescriptor owner;
+  owner.reset(fd);
+  const size_t size = Constants::IPC_BANDWIDTH_SHM_RING_BYTES;
+  if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+    return MmapPtr(nullptr, MmapDeleter{0});
+  }
+  void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (ptr == MAP_FAILED) {
+    return MmapPtr(nullptr, MmapDeleter{0});
+  }
+  std::memset(ptr, 0, size);
+  return MmapPtr(ptr, MmapDeleter{size});
+}
+
+void set_socket_buffers(int fd) {
+  const int bytes = Constants::IPC_BANDWIDTH_SOCKET_BUFFER_BYTES;
+  // Best effort: the kernel clamps to kern.ipc.maxsockbuf.
+  setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &bytes, sizeof(bytes));
+  setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &bytes, sizeof(bytes));
+}
+
+bool open_ipc_channel(IpcChannel& channel) {
+  channel.control_area = allocate_shared_buffer(sizeof(IpcControl), "IPC control");
+  if (!channel.control_area) {
+    return false;
+  }
+  channel.control = new (channel.control_area.get()) IpcControl();
+
+  int fds[2] = {-1, -1};
+  switch (channel.method) {
+    case IpcMethod::ShmRing:
+      channel.ring = map_shm_ring();
+      return static_cast<bool>(channel.ring);
+    case IpcMethod::MmapHandoff:
+      channel.slots = allocate_shared_buffer(kHandoffSlots * channel.message_bytes, "IPC handoff");
+      if (!channel.slots) {
+        return false;
+      }
+      std::memset(channel.slots.get(), 0, kHandoffSlots * channel.message_bytes);
+      return true;
+    case IpcMethod::Pipe:
+      if (pipe(fds) != 0) {
+        return false;
+      }
+      channel.receiver_fd.reset(fds[0]);
+      channel.sender_fd.reset(fds[1]);
+      return true;
+    case IpcMethod::UnixSocket:
+      if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+        return false;
+      }
+      channel.sender_fd.reset(fds[0]);
+      channel.receiver_fd.reset(fds[1]);
+      set_socket_buffers(fds[0]);
+      set_socket_buffers(fds[1]);
+      return true;
+  }
+  return false;
+}
+
+// Body of the forked receiver; the return value becomes its exit status.
+int run_ipc_receiver(IpcChannel& channel, size_t messages, size_t latency_messages,
+                     pid_t parent) {
+  channel.sender_fd.reset();
+  IpcPeer peer;
+  peer.parent = parent;
+  IpcControl& control = *channel.control;
+
+  MmapPtr buffer = allocate_buffer(channel.message_bytes, "IPC receive");
+  if (!buffer) {
+    return EXIT_FAILURE;
+  }
+  char* data = static_cast<char*>(buffer.get());
+  channel.kernels->write(data, channel.message_bytes);
+
+  const double cpu_start = process_cpu_seconds();
+  control.receiver_ready.store(true, std::memory_order_release);
+  for (size_t message = 0; message < messages; ++message) {
+    if (!receive_message(channel, data, peer)) {
+      return EXIT_FAILURE;
+    }
+  }
+  control.receiver_cpu_seconds = process_cpu_seconds() - cpu_start;
+  control.stream_done.store(true, std::memory_order_release);
+
+  // Copying mechanisms are verified once, outside the timed stream; handoff
+  // checks every message because it reads them anyway.
+  if (channel.method != IpcMethod::MmapHandoff &&
+      channel.kernels->read(data, channel.message_bytes) != channel.expected_checksum) {
+    return EXIT_FAILURE;
+  }
+  control.latency_ready.store(true, std::memory_order_release);
+  for (size_t message = 0; message < latency_messages; ++message) {
+    if (!receive_message(channel, data, peer)) {
+      return EXIT_FAILURE;
+    }
+    control.acknowledged.store(message + 1, std::memory_order_release);
+  }
+  return EXIT_SUCCESS;
+}
+
+bool run_ipc_transfer(IpcMethod method,
+                      size_t message_bytes,
+                      size_t messages,
+                      size_t latency_messages,
+                      const char* source,
+                      const MemoryKernelSet& kernels,
+                      HighResTimer& timer,
+                      IpcRunTimes& out_times) {
+  IpcChannel channel;
+  channel.method = method;
+  channel.message_bytes = message_bytes;
+  channel.kernels = &kernels;
+  channel.expected_checksum = kernels.read(source, message_bytes);
+  if (!open_ipc_channel(channel)) {
+    return false;
+  }
+  IpcControl& control = *channel.control;
+
+  std::cout.flush();
+  std::cerr.flush();
+  const pid_t parent = getpid();
+  const pid_t child = fork();
+  if (child == 0) {
+    _exit(run_ipc_receiver(channel, messages, latency_messages, parent));
+  }
+  channel.receiver_fd.reset();
+  if (child < 0) {
+    return false;
+  }
+
+  IpcPeer peer;
+  peer.child = child;
+  bool ok = spin_until(
+      [&control] { return control.receiver_ready.load(std::memory_order_acquire); }, peer);
+  if (ok) {
+    const double cpu_start = process_cpu_seconds();
+    timer.start();
+    for (size_t message = 0; ok && message < messages; ++message) {
+      ok = send_message(channel, source, peer);
+    }
+    ok = ok && spin_until(
+                   [&control] { return control.stream_done.load(std::memory_order_acquire); },
+                   peer);
+    out_times.stream_seconds = timer.stop();
+    out_times.sender_cpu_seconds = process_cpu_seconds() - cpu_start;
+  }
+  ok = ok && spin_until(
+                 [&control] { return control.latency_ready.load(std::memory_order_acquire); },
+                 peer);
+  if (ok) {
+    timer.start();
+    for (size_t message = 0; ok && message < latency_messages; ++message) {
+      ok = send_message(channel, source, peer) &&
+           spin_until(
+               [&control, message] {
+                 return control.acknowledged.load(std::memory_order_acquire) == message + 1;
+               },
+               peer);
+    }
+    out_times.latency_seconds = timer.stop();
+  }
+
+  if (!peer.child_exited) {
+    if (!ok) {
+      kill(child, SIGKILL);
+    }
+    if (waitpid(child, &peer.child_status, 0) != child) {
+      return false;
+    }
+  }
+  out_times.receiver_cpu_seconds = control.receiver_cpu_seconds;
+  return ok && WIFEXITED(peer.child_status) && WEXITSTATUS(peer.child_status) == EXIT_SUCCESS;
+}
+
+void fill_ipc_payload(char* data, size_t bytes) {
+  for (size_t index = 0; index < bytes; ++index) {
+    data[index] = static_cast<char>((index * 131 + 7) & 0xff);
+  }
+}
+
+// Stream length for one row, calibrated like --benchmark passes.
+bool calibrate_ipc_row(IpcBandwidthRow& row, const char* source, const MemoryKernelSet& kernels,
+                       HighResTimer& timer) {
+  const size_t pilot_messages = calculate_benchmark_pilot_passes(
+      row.message_bytes, Constants::BENCHMARK_CALIBRATION_MIN_PILOT_BYTES,
+      Constants::IPC_BANDWIDTH_MAX_MESSAGES);
+  IpcRunTimes pilot;
+  if (!run_ipc_transfer(row.method, row.message_bytes, pilot_messages,
+                        Constants::IPC_BANDWIDTH_MIN_LATENCY_MESSAGES, source, kernels, timer,
+                        pilot) ||
+      !benchmark_elapsed_is_valid(pilot.stream_seconds)) {
+    return false;
+  }
+  row.messages = calculate_benchmark_calibrated_count(
+      pilot.stream_seconds, pilot_messages, Constants::BENCHMARK_CALIBRATION_TARGET_SECONDS, 1,
+      Constants::IPC_BANDWIDTH_MAX_MESSAGES);
+  row.latency_messages = calculate_ipc_latency_messages(row.messages);
+  return true;
+}
+
+void print_ipc_bandwidth_report(const IpcBandwidthResult& result) {
+  std::cout << std::endl << Messages::report_ipc_bandwidth_header() << std::endl;
+  std::cout << Messages::report_ipc_bandwidth_note() << std::endl;
+  std::cout << Messages::report_ipc_bandwidth_table_header() << std::endl;
+  for (const IpcBandwidthRow& row : result.rows) {
+    if (row.samples[static_cast<size_t>(IpcMetric::Bandwidth)].empty()) {
+      continue;
+    }
+    std::cout << Messages::report_ipc_bandwidth_row(
+                     ipc_method_to_string(row.method), row.message_bytes,
+                     row.median[static_cast<size_t>(IpcMetric::Bandwidth)],
+                     row.median[static_cast<size_t>(IpcMetric::Latency)],
+                     row.median[static_cast<size_t>(IpcMetric::CpuPerByte)],
+                     row.median[static_cast<size_t>(IpcMetric::SenderCpuPerByte)],
+                     row.median[static_cast<size_t>(IpcMetric::ReceiverCpuPerByte)])
+              << std::endl;
+  }
+}
+
+}  // namespace
+
+int run_ipc_bandwidth(const IpcBandwidthConfig& config) {
+  print_runtime_banner();
+  IpcBandwidthResult result = make_ipc_bandwidth_result(config);
+  std::cout << Messages::msg_running_ipc_bandwidth(result.rows.size(), config.rounds)
+            << std::endl;
+  const auto run_start = std::chrono::steady_clock::now();
+
+  size_t largest_message = 0;
+  for (const IpcBandwidthRow& row : result.rows) {
+    largest_message = std::max(largest_message, row.message_bytes);
+  }
+  MmapPtr source = allocate_buffer(largest_message, "IPC source");
+  if (!source) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_ipc_bandwidth_failed("source allocation") << std::endl;
+    return EXIT_FAILURE;
+  }
+  char* source_data = static_cast<char*>(source.get());
+  fill_ipc_payload(source_data, largest_message);
+
+  const MemoryKernelSet& kernels =
+      memory_kernel_set(MemoryKernelVariant::Neon);
+  auto timer_optional = HighResTimer::create();
+  if (!timer_optional) {
+    std::cerr << Messages::error_prefix() << Messages::error_timer_creation_failed() << std::endl;
+    return EXIT_FAILURE;
+  }
+  HighResTimer& timer = *timer_optional;
+  SigpipeIgnoreGuard sigpipe_guard;
+
+  for (IpcBandwidthRow& row : result.rows) {
+    if (!calibrate_ipc_row(row, source_data, kernels, timer)) {
+      std::cerr << Messages::error_prefix()
+                << Messages::error_ipc_bandwidth_failed(
+                       std::string(ipc_method_to_string(row.method)) + " calibration")
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+    std::cout << Messages::msg_ipc_bandwidth_plan(ipc_method_to_string(row.method),
+                                                  row.message_bytes, row.messages,
+                                                  row.latency_messages)
+              << std::endl;
+    if (signal_received()) {
+      result.interrupted = true;
+      break;
+    }
+  }
+
+  for (int round = 0; round < config.rounds && !result.interrupted; ++round) {
+    for (size_t index :
+         build_benchmark_cyclic_order(result.rows.size(), static_cast<size_t>(round))) {
+      IpcBandwidthRow& row = result.rows[index];
+      IpcRunTimes times;
+      if (!run_ipc_transfer(row.method, row.message_bytes, row.messages, row.latency_messages,
+                            source_data, kernels, timer, times)) {
+        std::cerr << Messages::error_prefix()
+                  << Messages::error_ipc_bandwidth_failed(
+                         std::string(ipc_method_to_string(row.method)) + " transfer")
+                  << std::endl;
+        return EXIT_FAILURE;
+      }
+      const std::array<double, IPC_METRIC_COUNT> values = calculate_ipc_metrics(
+          row.message_bytes * row.messages, times.stream_seconds, times.sender_cpu_seconds,
+          times.receiver_cpu_seconds, times.latency_seconds, row.latency_messages);
+      for (size_t metric = 0; metric < IPC_METRIC_COUNT; ++metric) {
+        row.samples[metric].push_back(values[metric]);
+      }
+      if (signal_received()) {
+        result.interrupted = true;
+        break;
+      }
+    }
+  }
+  if (result.interrupted) {
+    std::cout << std::endl << Messages::msg_interrupted_by_user() << std::endl;
+  }
+
+  finalize_ipc_bandwidth_result(result);
+  print_ipc_bandwidth_report(result);
+
+  if (!config.output_file.empty()) {
+    const double total_execution_time_sec =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - run_start).count();
+    std::filesystem::path file_path(config.output_file);
+    if (file_path.is_relative()) {
+      file_path = std::filesystem::current_path() / file_path;
+    }
+    if (write_json_to_file(file_path, build_ipc_bandwidth_json(config, result, get_processor_name(),
+                                                               total_execution_time_sec)) !=
+        EXIT_SUCCESS) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,188 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file kernel_autotune.cpp
+ * @brief Candidate selection and cache persistence for kernel autotune mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Everything here is measurement-free so selection and cache handling can be
+ * unit tested; the timed candidate loop lives in kernel_autotune_runner.cpp.
+ */
+
+#include "benchmark/kernel_autotune.h"
+
+#include <cstdlib>
+#include <filesystem>
+#include <sstream>
+
+#include "output/console/messages/messages_api.h"
+#include "utils/descriptive_statistics.h"
+#include "utils/json_utils.h"
+
+namespace {
+
+constexpr const char* kCacheVersionKey = "kernel_autotune_cache_version";
+constexpr const char* kMachinesKey = "machines";
+constexpr const char* kChoicesKey = "choices";
+
+// The cache document is parsed back as nlohmann::json while the mode output is
+// ordered, so one field list serves both.
+template <typename Json>
+Json build_choice_json(const KernelAutotuneChoice& choice) {
+  Json choice_json;
+  choice_json["target"] = benchmark_target_to_string(choice.target);
+  choice_json["operation"] = benchmark_operation_to_string(choice.operation);
+  choice_json["buffer_size_bytes"] = choice.buffer_size_bytes;
+  choice_json["threads"] = choice.effective_threads;
+  choice_json["passes"] = choice.passes;
+  choice_json["measured"] = choice.measured;
+  choice_json["default_kernel"] = choice.default_kernel;
+  choice_json["best_kernel"] = choice.best_kernel;
+  choice_json["default_bandwidth_gb_s"] = choice.default_bandwidth_gb_s;
+  choice_json["best_bandwidth_gb_s"] = choice.best_bandwidth_gb_s;
+  choice_json["default_shortfall_pct"] = choice.default_shortfall_pct;
+  return choice_json;
+}
+
+}  // namespace
+
+std::string build_kernel_autotune_cpu_identity(const std::string& cpu_name,
+                                               int performance_cores,
+                                               int efficiency_cores) {
+  std::ostringstream oss;
+  oss << (cpu_name.empty() ? "unknown-cpu" : cpu_name) << "|p" << performance_cores
+      << "|e" << efficiency_cores;
+  return oss.str();
+}
+
+bool finalize_kernel_autotune_choice(KernelAutotuneChoice& choice) {
+  choice.measured = false;
+  const KernelAutotuneCandidateResult* best = nullptr;
+  const KernelAutotuneCandidateResult* default_candidate = nullptr;
+  for (KernelAutotuneCandidateResult& candidate : choice.candidates) {
+    if (candidate.round_bandwidth_gb_s.empty()) {
+      continue;
+    }
+    candidate.median_bandwidth_gb_s =
+        calculate_descriptive_statistics(candidate.round_bandwidth_gb_s).median;
+    if (best == nullptr || candidate.median_bandwidth_gb_s > best->median_bandwidth_gb_s) {
+      best = &candidate;
+    }
+    if (candidate.kernel == choice.default_kernel) {
+      default_candidate = &candidate;
+    }
+  }
+  if (best == nullptr || default_candidate == nullptr || best->median_bandwidth_gb_s <= 0.0) {
+    return false;
+  }
+
+  choice.best_kernel = best->kernel;
+  choice.best_bandwidth_gb_s = best->median_bandwidth_gb_s;
+  choice.default_bandwidth_gb_s = default_candidate->median_bandwidth_gb_s;
+  choice.default_shortfall_pct =
+      (choice.best_bandwidth_gb_s - choice.default_bandwidth_gb_s) / choice.best_bandwidth_gb_s * 100.0;
+  choice.measured = true;
+  return true;
+}
+
+std::string default_kernel_autotune_cache_path() {
+  const char* home = std::getenv("HOME");
+  if (home == nullptr || home[0] == '\0') {
+    return std::string();
+  }
+  return (std::filesystem::path(home) / Constants::KERNEL_AUTOTUNE_CACHE_RELATIVE_PATH).string();
+}
+
+nlohmann::ordered_json build_kernel_autotune_choice_json(const KernelAutotuneChoice& choice) {
+  return build_choice_json<nlohmann::ordered_json>(choice);
+}
+
+void merge_kernel_autotune_cache(nlohmann::json& cache,
+                                 const std::string& cpu_identity,
+                                 const std::vector<KernelAutotuneChoice>& choices,
+                                 const std::string& updated_utc) {
+  const bool compatible = cache.is_object() && cache.contains(kCacheVersionKey) &&
+                          cache[kCacheVersionKey] == Constants::KERNEL_AUTOTUNE_CACHE_VERSION &&
+                          cache.contains(kMachinesKey) && cache[kMachinesKey].is_object();
+  if (!compatible) {
+    cache = nlohmann::json::object();
+    cache[kCacheVersionKey] = Constants::KERNEL_AUTOTUNE_CACHE_VERSION;
+    cache[kMachinesKey] = nlohmann::json::object();
+  }
+
+  nlohmann::json machine;
+  machine["updated_utc"] = updated_utc;
+  machine[kChoicesKey] = nlohmann::json::array();
+  for (const KernelAutotuneChoice& choice : choices) {
+    if (choice.measured) {
+      machine[kChoicesKey].push_back(build_choice_json<nlohmann::json>(choice));
+    }
+  }
+  cache[kMachinesKey][cpu_identity] = std::move(machine);
+}
+
+bool find_tuned_memory_kernel_names(const nlohmann::json& cache,
+                                    const std::string& cpu_identity,
+                                    TunedMemoryKernelNames& out_names) {
+  if (!cache.is_object() || !cache.contains(kMachinesKey) || !cache[kMachinesKey].is_object() ||
+      !cache[kMachinesKey].contains(cpu_identity)) {
+    return false;
+  }
+  const nlohmann::json& machine = cache[kMachinesKey][cpu_identity];
+  if (!machine.is_object() || !machine.contains(kChoicesKey) || !machine[kChoicesKey].is_array()) {
+    return false;
+  }
+
+  const std::string main_memory = benchmark_target_to_string(BenchmarkTarget::MainMemory);
+  TunedMemoryKernelNames names;
+  for (const nlohmann::json& choice : machine[kChoicesKey]) {
+    if (!choice.is_object() || choice.value("target", "") != main_memory ||
+        !choice.value("measured", false)) {
+      continue;
+    }
+    const std::string operation = choice.value("operation", "");
+    const std::string kernel = choice.value("best_kernel", "");
+    if (operation == benchmark_operation_to_string(BenchmarkOperation::Read)) {
+      names.read = kernel;
+    } else if (operation == benchmark_operation_to_string(BenchmarkOperation::Write)) {
+      names.write = kernel;
+    } else if (operation == benchmark_operation_to_string(BenchmarkOperation::Copy)) {
+      names.copy = kernel;
+    }
+  }
+  if (names.read.empty() || names.write.empty() || names.copy.empty()) {
+    return false;
+  }
+  out_names = std::move(names);
+  return true;
+}
+
+bool load_tuned_memory_kernel_names(const std::string& cache_path,
+                                    const std::string& cpu_identity,
+                                    TunedMemoryKernelNames& out_names,
+                                    std::string& error_message) {
+  nlohmann::json cache;
+  if (!parse_json_from_file(cache_path, cache, error_message)) {
+    return false;
+  }
+  if (!find_tuned_memory_kernel_names(cache, cpu_identity, out_names)) {
+    error_message = Messages::error_kernel_autotune_cache_missing_winners(cpu_identity, cache_path);
+    return false;
+  }
+  return true;
+}
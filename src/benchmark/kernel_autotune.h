@@ -0,0 +1,160 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file kernel_autotune.h
+ * @brief Standalone sequential-kernel autotune mode interfaces
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * `-A, --autotune-kernels` measures every registered sequential kernel shape
+ * against the default kernel on one calibrated work plan per target and
+ * operation, reports the fastest kernel and how far the default falls short
+ * of it, and persists the winners keyed by CPU identity so that
+ * `--kernel tuned` can reuse them for main-memory bandwidth.
+ */
+
+#ifndef KERNEL_AUTOTUNE_H
+#define KERNEL_AUTOTUNE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark_work_plan.h"
+#include "core/config/constants.h"
+#include "third_party/nlohmann/json.hpp"
+
+struct KernelAutotuneConfig {
+  int rounds = Constants::KERNEL_AUTOTUNE_DEFAULT_ROUNDS;
+  unsigned long buffer_size_mb = Constants::DEFAULT_BUFFER_SIZE_MB;
+  int requested_threads = 0;  ///< 0 uses every logical core for main memory
+  std::string output_file;
+  std::string cache_file;     ///< Empty uses default_kernel_autotune_cache_path()
+  bool help_requested = false;
+};
+
+/** @brief Sequential entry points for one candidate kernel. */
+struct KernelAutotuneCandidate {
+  std::string name;
+  uint64_t (*read)(const void*, size_t) = nullptr;
+  void (*write)(void*, size_t) = nullptr;
+  void (*copy)(void*, const void*, size_t) = nullptr;
+};
+
+struct KernelAutotuneCandidateResult {
+  std::string kernel;
+  std::vector<double> round_bandwidth_gb_s;
+  double median_bandwidth_gb_s = 0.0;
+};
+
+/** @brief Tuning outcome for one target/operation pair. */
+struct KernelAutotuneChoice {
+  BenchmarkTarget target = BenchmarkTarget::MainMemory;
+  BenchmarkOperation operation = BenchmarkOperation::Read;
+  size_t buffer_size_bytes = 0;
+  int effective_threads = 0;
+  size_t passes = 0;
+  std::string default_kernel;
+  std::string best_kernel;
+  double default_bandwidth_gb_s = 0.0;
+  double best_bandwidth_gb_s = 0.0;
+  double default_shortfall_pct = 0.0;  ///< (best - default) / best * 100
+  bool measured = false;
+  std::vector<KernelAutotuneCandidateResult> candidates;
+};
+
+/** @brief Main-memory winners loaded from the autotune cache. */
+struct TunedMemoryKernelNames {
+  std::string read;
+  std::string write;
+  std::string copy;
+};
+
+/**
+ * @brief Build the cache key identifying one machine configuration.
+ *
+ * Core counts are part of the key because they change the thread count used
+ * for main-memory tuning.
+ */
+std::string build_kernel_autotune_cpu_identity(const std::string& cpu_name,
+                                               int performance_cores,
+                                               int efficiency_cores);
+
+/**
+ * @brief Reduce per-round samples to medians and pick the fastest candidate.
+ *
+ * Ties keep the earlier candidate, so the default kernel (listed first) wins
+ * unless another kernel is strictly faster.
+ * @return false when no candidate has samples or the default is missing.
+ */
+bool finalize_kernel_autotune_choice(KernelAutotuneChoice& choice);
+
+/**
+ * @brief Default cache location under `$HOME`.
+ * @return Empty string when `HOME` is unset.
+ */
+std::string default_kernel_autotune_cache_path();
+
+/**
+ * @brief Replace one machine's entry in a cache document with new choices.
+ *
+ * Other machines' entries are preserved; a malformed document is replaced.
+ */
+void merge_kernel_autotune_cache(nlohmann::json& cache,
+                                 const std::string& cpu_identity,
+                                 const std::vector<KernelAutotuneChoice>& choices,
+                                 const std::string& updated_utc);
+
+/**
+ * @brief Extract main-memory read/write/copy winners for one machine.
+ * @return false unless all three operations have a cached winner.
+ */
+bool find_tuned_memory_kernel_names(const nlohmann::json& cache,
+                                    const std::string& cpu_identity,
+                                    TunedMemoryKernelNames& out_names);
+
+/**
+ * @brief Load main-memory winners from a cache file.
+ * @param[out] error_message Populated on failure.
+ */
+bool load_tuned_memory_kernel_names(const std::string& cache_path,
+                                    const std::string& cpu_identity,
+                                    TunedMemoryKernelNames& out_names,
+                                    std::string& error_message);
+
+/** @brief Serialize one choice for the cache and the mode's JSON output. */
+nlohmann::ordered_json build_kernel_autotune_choice_json(const KernelAutotuneChoice& choice);
+
+/**
+ * @brief Parse CLI args for standalone kernel autotune mode.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on parse/validation error.
+ */
+int parse_kernel_autotune_mode_arguments(int argc, char* argv[], KernelAutotuneConfig& config);
+
+/**
+ * @brief Measure all candidates, report, and persist the winners.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on runtime/IO error.
+ */
+int run_kernel_autotune(const KernelAutotuneConfig& config);
+
+/**
+ * @brief Parse and run standalone kernel autotune mode from main().
+ */
+int run_kernel_autotune_mode(int argc, char* argv[]);
+
+#endif  // KERNEL_AUTOTUNE_H
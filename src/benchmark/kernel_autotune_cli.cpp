@@ -0,0 +1,162 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file kernel_autotune_cli.cpp
+ * @brief CLI parsing for standalone kernel autotune mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Parses and validates mode-specific command line options for
+ * `-A, --autotune-kernels`. Like the other standalone modes, only an explicit
+ * option set is accepted.
+ */
+
+#include "benchmark/kernel_autotune.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+
+#include "core/config/cli_options.h"
+#include "core/config/config.h"
+#include "core/config/constants.h"
+#include "core/signal/signal_handler.h"
+#include "output/console/messages/messages_api.h"
+#include "output/console/output_printer.h"
+
+namespace {
+
+constexpr const char* OPT_AUTOTUNE_KERNELS_SHORT = "-A";
+constexpr const char* OPT_AUTOTUNE_KERNELS_LONG = "--autotune-kernels";
+constexpr const char* OPT_AUTOTUNE_CACHE_LONG = "--autotune-cache";
+constexpr const char* OPT_BUFFER_SIZE_SHORT = "-b";
+constexpr const char* OPT_BUFFER_SIZE_LONG = "--buffer-size";
+constexpr const char* OPT_COUNT_SHORT = "-r";
+constexpr const char* OPT_COUNT_LONG = "--count";
+constexpr const char* OPT_HELP_SHORT = "-h";
+constexpr const char* OPT_HELP_LONG = "--help";
+constexpr const char* OPT_OUTPUT_SHORT = "-o";
+constexpr const char* OPT_OUTPUT_LONG = "--output";
+constexpr const char* OPT_THREADS_SHORT = "-t";
+constexpr const char* OPT_THREADS_LONG = "--threads";
+
+}  // namespace
+
+int parse_kernel_autotune_mode_arguments(int argc, char* argv[], KernelAutotuneConfig& config) {
+  config.rounds = Constants::KERNEL_AUTOTUNE_DEFAULT_ROUNDS;
+  config.buffer_size_mb = Constants::DEFAULT_BUFFER_SIZE_MB;
+
+  bool mode_seen = false;
+  bool output_seen = false;
+  bool cache_seen = false;
+  bool buffer_size_seen = false;
+  bool threads_seen = false;
+  bool count_seen = false;
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+
+    if (is_option(arg, OPT_AUTOTUNE_KERNELS_SHORT, OPT_AUTOTUNE_KERNELS_LONG)) {
+      mode_seen = true;
+      continue;
+    }
+
+    if (is_option(arg, OPT_HELP_SHORT, OPT_HELP_LONG)) {
+      print_help(argv[0]);
+      config.help_requested = true;
+      return EXIT_SUCCESS;
+    }
+
+    if (is_option(arg, OPT_OUTPUT_SHORT, OPT_OUTPUT_LONG)) {
+      if (!take_option_value(argc, argv, i, output_seen, OPT_OUTPUT_LONG)) {
+        return EXIT_FAILURE;
+      }
+      config.output_file = argv[i];
+      continue;
+    }
+
+    if (arg == OPT_AUTOTUNE_CACHE_LONG) {
+      if (!take_option_value(argc, argv, i, cache_seen, OPT_AUTOTUNE_CACHE_LONG)) {
+        return EXIT_FAILURE;
+      }
+      config.cache_file = argv[i];
+      continue;
+    }
+
+    if (is_option(arg, OPT_BUFFER_SIZE_SHORT, OPT_BUFFER_SIZE_LONG)) {
+      if (!take_option_value(argc, argv, i, buffer_size_seen, OPT_BUFFER_SIZE_LONG)) {
+        return EXIT_FAILURE;
+      }
+      int parsed = 0;
+      if (!parse_positive_int_option(OPT_BUFFER_SIZE_LONG, argv[i], parsed, argv[0])) {
+        return EXIT_FAILURE;
+      }
+      config.buffer_size_mb = static_cast<unsigned long>(parsed);
+      continue;
+    }
+
+    if (is_option(arg, OPT_THREADS_SHORT, OPT_THREADS_LONG)) {
+      if (!take_option_value(argc, argv, i, threads_seen, OPT_THREADS_LONG)) {
+        return EXIT_FAILURE;
+      }
+      if (!parse_positive_int_option(OPT_THREADS_LONG, argv[i], config.requested_threads, argv[0])) {
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (is_option(arg, OPT_COUNT_SHORT, OPT_COUNT_LONG)) {
+      if (!take_option_value(argc, argv, i, count_seen, OPT_COUNT_LONG)) {
+        return EXIT_FAILURE;
+      }
+      if (!parse_positive_int_option(OPT_COUNT_LONG, argv[i], config.rounds, argv[0])) {
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    std::cerr << Messages::error_prefix()
+              << Messages::error_autotune_kernels_must_be_used_alone()
+              << std::endl;
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  if (!mode_seen) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_autotune_kernels_must_be_used_alone()
+              << std::endl;
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+int run_kernel_autotune_mode(int argc, char* argv[]) {
+  KernelAutotuneConfig config;
+  if (parse_kernel_autotune_mode_arguments(argc, argv, config) != EXIT_SUCCESS) {
+    return EXIT_FAILURE;
+  }
+  if (config.help_requested) {
+    return EXIT_SUCCESS;
+  }
+
+  BenchmarkSignalMaskGuard signal_guard;
+  return run_kernel_autotune(config);
+}
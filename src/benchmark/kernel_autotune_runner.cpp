@@ -0,0 +1,344 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file kernel_autotune_runner.cpp
+ * @brief Timed candidate execution for standalone kernel autotune mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * For each target and operation, one work plan is calibrated with the default
+ * kernel and then shared by every candidate, so a candidate's median reflects
+ * only its instruction shape. Candidate order rotates every round to spread
+ * thermal and frequency drift evenly across the candidate set.
+ */
+
+#include "benchmark/kernel_autotune.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "asm/asm_functions.h"
+#include "benchmark/benchmark_tests.h"
+#include "benchmark/memory_kernels.h"
+#include "core/config/constants.h"
+#include "core/memory/memory_manager.h"
+#include "core/memory/memory_utils.h"
+#include "core/signal/signal_handler.h"
+#include "core/system/system_info.h"
+#include "core/timing/timer.h"
+#include "output/console/messages/messages_api.h"
+#include "output/console/output_printer.h"
+#include "output/json/json_output/json_output_api.h"
+#include "utils/json_utils.h"
+
+namespace {
+
+struct AutotuneTarget {
+  BenchmarkTarget target;
+  size_t buffer_size_bytes;
+  int threads;
+};
+
+KernelAutotuneCandidate make_candidate(const MemoryKernelSet& kernels) {
+  KernelAutotuneCandidate candidate;
+  candidate.name = kernels.name;
+  candidate.read = kernels.read;
+  candidate.write = kernels.write;
+  candidate.copy = kernels.copy;
+  return candidate;
+}
+
+// The default kernel is listed first so that ties resolve to it.
+std::vector<KernelAutotuneCandidate> build_candidates(BenchmarkTarget target) {
+  std::vector<KernelAutotuneCandidate> candidates;
+  std::string default_name;
+  if (target == BenchmarkTarget::MainMemory) {
+    const MemoryKernelSet& host_kernels =
+        memory_kernel_set(MemoryKernelVariant::Neon);
+    candidates.push_back(make_candidate(host_kernels));
+    default_name = host_kernels.name;
+  } else {
+    KernelAutotuneCandidate cache_kernels;
+    cache_kernels.name = Constants::KERNEL_AUTOTUNE_CACHE_KERNEL_NAME;
+    cache_kernels.read = memory_read_cache_loop_asm;
+    cache_kernels.write = memory_write_cache_loop_asm;
+    cache_kernels.copy = memory_copy_cache_loop_asm;
+    candidates.push_back(cache_kernels);
+  }
+
+  for (const MemoryKernelSet& kernels : memory_kernel_registry()) {
+    if (kernels.name == default_name) {
+      continue;
+    }
+    candidates.push_back(make_candidate(kernels));
+  }
+  return candidates;
+}
+
+double run_candidate(const KernelAutotuneCandidate& candidate,
+                     const BenchmarkWorkPlan& plan,
+                     void* src_buffer,
+                     void* dst_buffer,
+                     HighResTimer& timer) {
+  switch (plan.operation) {
+    case BenchmarkOperation::Read: {
+      uint64_t checksum = 0;
+      return run_read_test_with_plan(src_buffer, plan, checksum, timer, candidate.read);
+    }
+    case BenchmarkOperation::Write:
+      return run_write_test_with_plan(dst_buffer, plan, timer, candidate.write);
+    case BenchmarkOperation::Copy:
+      return run_copy_test_with_plan(dst_buffer, src_buffer, plan, timer, candidate.copy);
+    case BenchmarkOperation::Latency:
+      return 0.0;
+  }
+  return 0.0;
+}
+
+// Calibrates one plan with the default candidate, then measures every
+// candidate `rounds` times on it. Returns false only when interrupted.
+bool tune_target_operation(const AutotuneTarget& target,
+                           BenchmarkOperation operation,
+                           const std::vector<KernelAutotuneCandidate>& candidates,
+                           int rounds,
+                           void* src_buffer,
+                           void* dst_buffer,
+                           HighResTimer& timer,
+                           KernelAutotuneChoice& choice) {
+  choice.target = target.target;
+  choice.operation = operation;
+  choice.buffer_size_bytes = target.buffer_size_bytes;
+  choice.default_kernel = candidates.front().name;
+  choice.candidates.clear();
+  for (const KernelAutotuneCandidate& candidate : candidates) {
+    choice.candidates.push_back(KernelAutotuneCandidateResult{candidate.name, {}, 0.0});
+  }
+
+  const size_t bytes_per_pass = operation == BenchmarkOperation::Copy
+                                    ? target.buffer_size_bytes * Constants::COPY_OPERATION_MULTIPLIER
+                                    : target.buffer_size_bytes;
+  const size_t pilot_passes = calculate_benchmark_pilot_passes(
+      bytes_per_pass, Constants::BENCHMARK_CALIBRATION_MIN_PILOT_BYTES,
+      Constants::BENCHMARK_CALIBRATION_MAX_PASSES);
+  BenchmarkWorkPlan plan = build_benchmark_bandwidth_work_plan(
+      target.buffer_size_bytes, target.threads, pilot_passes, target.target, operation);
+  if (plan.status != BenchmarkMeasurementStatus::Measured) {
+    return true;
+  }
+
+  run_candidate(candidates.front(), plan, src_buffer, dst_buffer, timer);
+  const double pilot_elapsed = run_candidate(candidates.front(), plan, src_buffer, dst_buffer, timer);
+  const size_t calibrated_passes = calculate_benchmark_calibrated_count(
+      pilot_elapsed, plan.passes, Constants::KERNEL_AUTOTUNE_TARGET_SECONDS, 1,
+      Constants::BENCHMARK_CALIBRATION_MAX_PASSES);
+  if (calibrated_passes == 0 || !set_benchmark_work_plan_passes(plan, calibrated_passes)) {
+    return true;
+  }
+  choice.effective_threads = plan.effective_threads;
+  choice.passes = plan.passes;
+
+  // One untimed pass per candidate settles page state and branch history.
+  for (const KernelAutotuneCandidate& candidate : candidates) {
+    run_candidate(candidate, plan, src_buffer, dst_buffer, timer);
+    if (signal_received()) {
+      return false;
+    }
+  }
+
+  for (int round = 0; round < rounds; ++round) {
+    for (size_t candidate_index :
+         build_benchmark_cyclic_order(candidates.size(), static_cast<size_t>(round))) {
+      const double elapsed =
+          run_candidate(candidates[candidate_index], plan, src_buffer, dst_buffer, timer);
+      if (signal_received()) {
+        return false;
+      }
+      if (benchmark_elapsed_is_valid(elapsed)) {
+        choice.candidates[candidate_index].round_bandwidth_gb_s.push_back(
+            static_cast<double>(plan.total_payload_bytes) / elapsed /
+            Constants::NANOSECONDS_PER_SECOND);
+      }
+    }
+  }
+  finalize_kernel_autotune_choice(choice);
+  return true;
+}
+
+void persist_tuned_kernels(const std::string& cache_path,
+                           const std::string& cpu_identity,
+                           const std::vector<KernelAutotuneChoice>& choices) {
+  nlohmann::json cache;
+  std::string ignored_error;
+  if (std::filesystem::exists(cache_path)) {
+    parse_json_from_file(cache_path, cache, ignored_error);
+  }
+  merge_kernel_autotune_cache(cache, cpu_identity, choices, build_utc_timestamp());
+  if (write_json_to_file(cache_path, nlohmann::ordered_json::parse(cache.dump()), false) ==
+      EXIT_SUCCESS) {
+    std::cout << Messages::msg_kernel_autotune_cache_saved(cache_path) << std::endl;
+  }
+}
+
+}  // namespace
+
+int run_kernel_autotune(const KernelAutotuneConfig& config) {
+  print_runtime_banner();
+  std::cout << Messages::msg_running_kernel_autotune() << std::endl;
+  const auto autotune_start = std::chrono::steady_clock::now();
+
+  const std::string cpu_name = get_processor_name();
+  const int performance_cores = get_performance_cores();
+  const int efficiency_cores = get_efficiency_cores();
+  const std::string cpu_identity =
+      build_kernel_autotune_cpu_identity(cpu_name, performance_cores, efficiency_cores);
+
+  // macOS exposes no shared last-level cache size, so the tuned targets are
+  // L1, L2, and main memory; cache targets run one worker as in --benchmark.
+  const std::array<AutotuneTarget, 3> targets{{
+      {BenchmarkTarget::L1,
+       static_cast<size_t>(get_l1_cache_size() * Constants::L1_BUFFER_SIZE_FACTOR),
+       Constants::SINGLE_THREAD},
+      {BenchmarkTarget::L2,
+       static_cast<size_t>(get_l2_cache_size() * Constants::L2_BUFFER_SIZE_FACTOR),
+       Constants::SINGLE_THREAD},
+      {BenchmarkTarget::MainMemory, config.buffer_size_mb * Constants::BYTES_PER_MB,
+       config.requested_threads > 0 ? config.requested_threads : get_total_logical_cores()},
+  }};
+  size_t buffer_size = 0;
+  for (const AutotuneTarget& target : targets) {
+    buffer_size = std::max(buffer_size, target.buffer_size_bytes);
+  }
+
+  MmapPtr src_buffer = allocate_buffer(buffer_size, "autotune source");
+  MmapPtr dst_buffer = allocate_buffer(buffer_size, "autotune destination");
+  if (!src_buffer || !dst_buffer ||
+      initialize_buffers(src_buffer.get(), dst_buffer.get(), buffer_size) != EXIT_SUCCESS) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_kernel_autotune_failed("buffer allocation or initialization")
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  auto timer_optional = HighResTimer::create();
+  if (!timer_optional) {
+    std::cerr << Messages::error_prefix() << Messages::error_timer_creation_failed() << std::endl;
+    return EXIT_FAILURE;
+  }
+  HighResTimer& timer = *timer_optional;
+
+  constexpr std::array<BenchmarkOperation, 3> kOperations{
+      BenchmarkOperation::Read, BenchmarkOperation::Write, BenchmarkOperation::Copy};
+  std::vector<KernelAutotuneChoice> choices;
+  bool interrupted = false;
+  for (const AutotuneTarget& target : targets) {
+    const std::vector<KernelAutotuneCandidate> candidates = build_candidates(target.target);
+    for (BenchmarkOperation operation : kOperations) {
+      std::cout << Messages::msg_kernel_autotune_progress(
+                       benchmark_target_to_string(target.target),
+                       benchmark_operation_to_string(operation), candidates.size(),
+                       config.rounds)
+                << std::endl;
+      KernelAutotuneChoice choice;
+      interrupted = !tune_target_operation(target, operation, candidates, config.rounds,
+                                           src_buffer.get(), dst_buffer.get(), timer, choice);
+      choices.push_back(std::move(choice));
+      if (interrupted) {
+        break;
+      }
+    }
+    if (interrupted) {
+      break;
+    }
+  }
+
+  if (interrupted) {
+    std::cout << std::endl << Messages::msg_interrupted_by_user() << std::endl;
+  }
+
+  std::cout << std::endl << Messages::report_kernel_autotune_header() << std::endl;
+  std::cout << Messages::report_kernel_autotune_identity(cpu_identity) << std::endl;
+  std::cout << Messages::report_kernel_autotune_peak_note() << std::endl;
+  for (const KernelAutotuneChoice& choice : choices) {
+    const std::string target = benchmark_target_to_string(choice.target);
+    const std::string operation = benchmark_operation_to_string(choice.operation);
+    if (!choice.measured) {
+      std::cout << Messages::report_kernel_autotune_unmeasured(target, operation) << std::endl;
+      continue;
+    }
+    std::cout << Messages::report_kernel_autotune_choice(
+                     target, operation, choice.effective_threads, choice.best_kernel,
+                     choice.best_bandwidth_gb_s, choice.default_kernel,
+                     choice.default_bandwidth_gb_s, choice.default_shortfall_pct)
+              << std::endl;
+  }
+
+  // A partial run would overwrite complete winners with a subset, so only
+  // uninterrupted runs are persisted.
+  const std::string cache_path =
+      config.cache_file.empty() ? default_kernel_autotune_cache_path() : config.cache_file;
+  if (!interrupted) {
+    if (cache_path.empty()) {
+      std::cerr << Messages::warning_prefix()
+                << Messages::warning_kernel_autotune_cache_path_unavailable() << std::endl;
+    } else {
+      persist_tuned_kernels(cache_path, cpu_identity, choices);
+    }
+  }
+
+  if (!config.output_file.empty()) {
+    nlohmann::ordered_json result_json;
+    result_json["mode"] = Constants::KERNEL_AUTOTUNE_JSON_MODE_NAME;
+    result_json["schema_version"] = Constants::KERNEL_AUTOTUNE_JSON_SCHEMA_VERSION;
+    result_json["methodology_version"] = Constants::KERNEL_AUTOTUNE_METHODOLOGY_VERSION;
+    result_json["status"] = interrupted ? "interrupted" : "complete";
+    result_json["cpu_identity"] = cpu_identity;
+    result_json["cpu_name"] = cpu_name;
+    result_json["rounds"] = config.rounds;
+    result_json["target_seconds"] = Constants::KERNEL_AUTOTUNE_TARGET_SECONDS;
+    result_json["cache_file"] = cache_path;
+    result_json["total_execution_time_sec"] =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - autotune_start).count();
+    nlohmann::ordered_json results = nlohmann::ordered_json::array();
+    for (const KernelAutotuneChoice& choice : choices) {
+      nlohmann::ordered_json choice_json = build_kernel_autotune_choice_json(choice);
+      nlohmann::ordered_json candidates_json = nlohmann::ordered_json::array();
+      for (const KernelAutotuneCandidateResult& candidate : choice.candidates) {
+        candidates_json.push_back({{"kernel", candidate.kernel},
+                                   {"median_bandwidth_gb_s", candidate.median_bandwidth_gb_s},
+                                   {"round_bandwidth_gb_s", candidate.round_bandwidth_gb_s}});
+      }
+      choice_json["candidates"] = std::move(candidates_json);
+      results.push_back(std::move(choice_json));
+    }
+    result_json["results"] = std::move(results);
+
+    std::filesystem::path file_path(config.output_file);
+    if (file_path.is_relative()) {
+      file_path = std::filesystem::current_path() / file_path;
+    }
+    if (write_json_to_file(file_path, result_json) != EXIT_SUCCESS) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,447 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+
+/**
+ * @file linked_structures.cpp
+ * @brief Builders, traversal kernels, and JSON for linked-structures mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Node placement and operation order both come from
+ * build_latency_chain_order(), so a given seed reproduces the same layout
+ * the pointer-chain builder would produce. The builders also total the
+ * exact bytes each operation reads over one full chain cycle. Timing lives
+ * in linked_structures_runner.cpp.
+ */
+
+#include "benchmark/linked_structures.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "core/memory/memory_utils.h"
+#include "utils/descriptive_statistics.h"
+#include "utils/seed_utils.h"
+
+namespace {
+
+constexpr size_t kWordBytes = sizeof(uint64_t);
+constexpr uint64_t kTreeLeafFlag = 1ULL << 32;
+constexpr uint64_t kTreeCountMask = kTreeLeafFlag - 1;
+
+// Seeded 64-bit finalizer (SplitMix64 constants) giving each key its home slot.
+inline uint64_t mix_hash_key(uint64_t key, uint64_t seed) {
+  uint64_t x = key ^ seed;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+std::vector<size_t> chain_order(size_t count, uint64_t seed) {
+  if (count == 1) {
+    return {0};
+  }
+  return build_latency_chain_order(count, 0, LatencyChainMode::GlobalRandom, seed);
+}
+
+size_t tree_node_total(size_t leaves, size_t fanout) {
+  size_t total = leaves;
+  size_t level = leaves;
+  while (level > 1) {
+    level = (level + fanout - 1) / fanout;
+    total += level;
+  }
+  return total;
+}
+
+uint64_t traverse_list(uint64_t state, size_t operations, size_t payload_words,
+                       uint64_t& checksum) {
+  const uint64_t* node = reinterpret_cast<const uint64_t*>(state);
+  uint64_t sum = 0;
+  for (size_t operation = 0; operation < operations; ++operation) {
+    for (size_t word = 1; word <= payload_words; ++word) {
+      sum ^= node[word];
+    }
+    node = reinterpret_cast<const uint64_t*>(node[0]);
+  }
+  checksum ^= sum;
+  return reinterpret_cast<uintptr_t>(node);
+}
+
+uint64_t lookup_tree(const LinkedStructureLayout& layout, uint64_t key, size_t operations) {
+  const uint64_t* root = static_cast<const uint64_t*>(layout.base);
+  const size_t fanout = layout.fanout;
+  for (size_t operation = 0; operation < operations; ++operation) {
+    const uint64_t* node = root;
+    for (;;) {
+      const uint64_t header = node[0];
+      const uint64_t* keys = node + 1;
+      const uint64_t* links = keys + fanout;
+      if ((header & kTreeLeafFlag) != 0) {
+        size_t index = 0;
+        while (keys[index] != key) {
+          ++index;
+        }
+        key = links[index];
+        break;
+      }
+      const size_t count = static_cast<size_t>(header & kTreeCountMask);
+      size_t index = 1;
+      while (index < count && keys[index] <= key) {
+        ++index;
+      }
+      node = reinterpret_cast<const uint64_t*>(links[index - 1]);
+    }
+  }
+  return key;
+}
+
+template <bool Quadratic>
+uint64_t lookup_hash(const LinkedStructureLayout& layout, uint64_t key, size_t operations) {
+  const uint64_t* slots = static_cast<const uint64_t*>(layout.base);
+  const size_t mask = layout.slot_count - 1;
+  for (size_t operation = 0; operation < operations; ++operation) {
+    size_t slot = static_cast<size_t>(mix_hash_key(key, layout.hash_seed) >> layout.hash_shift);
+    size_t step = 0;
+    while (slots[2 * slot] != key) {
+      step = Quadratic ? step + 1 : 1;
+      slot = (slot + step) & mask;
+    }
+    key = slots[2 * slot + 1];
+  }
+  return key;
+}
+
+}  // namespace
+
+const char* linked_structure_kind_to_string(LinkedStructureKind kind) {
+  switch (kind) {
+    case LinkedStructureKind::PointerChase:
+      return "pointer_chase";
+    case LinkedStructureKind::LinkedList:
+      return "linked_list";
+    case LinkedStructureKind::TreeLookup:
+      return "tree_lookup";
+    case LinkedStructureKind::HashLinear:
+      return "hash_linear_probe";
+    case LinkedStructureKind::HashQuadratic:
+      return "hash_quadratic_probe";
+  }
+  return "unknown";
+}
+
+size_t linked_list_node_bytes(size_t payload_bytes) {
+  const size_t alignment = Constants::LINKED_NODE_ALIGNMENT_BYTES;
+  return (kWordBytes + payload_bytes + alignment - 1) / alignment * alignment;
+}
+
+size_t linked_tree_min_node_bytes(size_t fanout) {
+  return kWordBytes * (1 + 2 * fanout);
+}
+
+bool build_linked_list(void* buffer, size_t buffer_bytes, size_t payload_bytes, uint64_t seed,
+                       LinkedStructureLayout& layout) {
+  const size_t node_bytes = linked_list_node_bytes(payload_bytes);
+  const size_t node_count = buffer_bytes / node_bytes;
+  if (buffer == nullptr || payload_bytes % kWordBytes != 0 || node_count < 2) {
+    return false;
+  }
+  const std::vector<size_t> order = chain_order(node_count, seed);
+  char* base = static_cast<char*>(buffer);
+  const size_t payload_words = payload_bytes / kWordBytes;
+  for (size_t position = 0; position < node_count; ++position) {
+    uint64_t* node = reinterpret_cast<uint64_t*>(base + order[position] * node_bytes);
+    const size_t next = order[(position + 1) % node_count];
+    node[0] = reinterpret_cast<uintptr_t>(base + next * node_bytes);
+    for (size_t word = 1; word <= payload_words; ++word) {
+      node[word] = order[position] + word;
+    }
+  }
+
+  layout = LinkedStructureLayout{};
+  layout.kind = LinkedStructureKind::LinkedList;
+  layout.base = buffer;
+  layout.footprint_bytes = node_count * node_bytes;
+  layout.node_bytes = node_bytes;
+  layout.element_count = node_count;
+  layout.payload_bytes = payload_bytes;
+  layout.start = reinterpret_cast<uintptr_t>(base + order[0] * node_bytes);
+  layout.bytes_per_operation = static_cast<double>(kWordBytes + payload_bytes);
+  layout.steps_per_operation = 1.0;
+  return true;
+}
+
+bool build_linked_tree(void* buffer, size_t buffer_bytes, size_t fanout, size_t node_bytes,
+                       uint64_t seed, LinkedStructureLayout& layout) {
+  if (buffer == nullptr || fanout < 2 || node_bytes < linked_tree_min_node_bytes(fanout) ||
+      node_bytes % kWordBytes != 0) {
+    return false;
+  }
+  const size_t capacity = buffer_bytes / node_bytes;
+  if (capacity == 0) {
+    return false;
+  }
+  // Most full leaves whose tree still fits; the estimate is within a few of it.
+  size_t leaves = std::max<size_t>(1, capacity - capacity / fanout);
+  while (leaves > 1 && tree_node_total(leaves, fanout) > capacity) {
+    --leaves;
+  }
+  while (tree_node_total(leaves + 1, fanout) <= capacity) {
+    ++leaves;
+  }
+  if (tree_node_total(leaves, fanout) > capacity) {
+    return false;
+  }
+
+  // Level sizes and leaves spanned per node, bottom (leaves) first.
+  std::vector<size_t> sizes{leaves};
+  std::vector<size_t> spans{1};
+  while (sizes.back() > 1) {
+    sizes.push_back((sizes.back() + fanout - 1) / fanout);
+    spans.push_back(spans.back() * fanout);
+  }
+  const size_t heights = sizes.size();
+  // Breadth-first node ids: the root is 0 and each level follows the one above.
+  std::vector<size_t> first_id(heights, 0);
+  for (size_t height = heights - 1; height-- > 0;) {
+    first_id[height] = first_id[height + 1] + sizes[height + 1];
+  }
+  const size_t node_total = first_id[0] + sizes[0];
+  const std::vector<size_t> placement = chain_order(node_total, seed);
+  char* base = static_cast<char*>(buffer);
+  auto node_at = [&](size_t height, size_t position) {
+    return reinterpret_cast<uint64_t*>(base + placement[first_id[height] + position] * node_bytes);
+  };
+
+  const size_t key_count = leaves * fanout;
+  double total_bytes = 0.0;
+  for (size_t position = 0; position < leaves; ++position) {
+    uint64_t* node = node_at(0, position);
+    node[0] = kTreeLeafFlag | fanout;
+    for (size_t index = 0; index < fanout; ++index) {
+      node[1 + index] = position * fanout + index;
+    }
+  }
+  // Header, keys up to the match, and the value.
+  total_bytes += static_cast<double>(leaves) * kWordBytes *
+                 static_cast<double>(fanout * (fanout - 1) / 2 + 3 * fanout);
+  for (size_t height = 1; height < heights; ++height) {
+    for (size_t position = 0; position < sizes[height]; ++position) {
+      uint64_t* node = node_at(height, position);
+      const size_t first_child = position * fanout;
+      const size_t count = std::min(fanout, sizes[height - 1] - first_child);
+      node[0] = count;
+      for (size_t index = 0; index < count; ++index) {
+        const size_t child = first_child + index;
+        node[1 + index] = child * spans[height - 1] * fanout;
+        node[1 + fanout + index] = reinterpret_cast<uintptr_t>(node_at(height - 1, child));
+        const size_t child_leaves =
+            std::min((child + 1) * spans[height - 1], leaves) - child * spans[height - 1];
+        // Header, separators read by the scan, and the child link.
+        const size_t words = 2 + std::min(index + 1, count - 1);
+        total_bytes += static_cast<double>(child_leaves * fanout * words * kWordBytes);
+      }
+    }
+  }
+
+  const std::vector<size_t> lookups = chain_order(key_count, SeedUtils::splitmix64(seed));
+  for (size_t position = 0; position < key_count; ++position) {
+    const size_t key = lookups[position];
+    uint64_t* leaf = node_at(0, key / fanout);
+    leaf[1 + fanout + key % fanout] = lookups[(position + 1) % key_count];
+  }
+
+  layout = LinkedStructureLayout{};
+  layout.kind = LinkedStructureKind::TreeLookup;
+  layout.base = node_at(heights - 1, 0);
+  layout.footprint_bytes = node_total * node_bytes;
+  layout.node_bytes = node_bytes;
+  layout.element_count = key_count;
+  layout.fanout = fanout;
+  layout.levels = heights;
+  layout.start = lookups[0];
+  layout.bytes_per_operation = total_bytes / static_cast<double>(key_count);
+  layout.steps_per_operation = static_cast<double>(heights);
+  return true;
+}
+
+bool build_linked_hash_table(void* buffer, size_t buffer_bytes, double load_factor,
+                             bool quadratic, uint64_t seed, LinkedStructureLayout& layout) {
+  if (buffer == nullptr || !(load_factor > 0.0) || !(load_factor < 1.0)) {
+    return false;
+  }
+  const size_t slot_bytes = Constants::LINKED_HASH_SLOT_BYTES;
+  size_t slot_count = 1;
+  unsigned slot_bits = 0;
+  while (slot_count * 2 <= buffer_bytes / slot_bytes) {
+    slot_count *= 2;
+    ++slot_bits;
+  }
+  const size_t key_count =
+      static_cast<size_t>(load_factor * static_cast<double>(slot_count));
+  if (slot_bits < 2 || key_count < 2 || key_count >= slot_count) {
+    return false;
+  }
+  uint64_t* slots = static_cast<uint64_t*>(buffer);
+  std::memset(slots, 0, slot_count * slot_bytes);
+
+  // Keys are 1..n so that zero marks an empty slot.
+  const uint64_t hash_seed = SeedUtils::splitmix64(seed);
+  const unsigned shift = 64 - slot_bits;
+  const size_t mask = slot_count - 1;
+  const std::vector<size_t> lookups = chain_order(key_count, seed);
+  size_t total_probes = 0;
+  for (size_t position = 0; position < key_count; ++position) {
+    const uint64_t key = lookups[position] + 1;
+    size_t slot = static_cast<size_t>(mix_hash_key(key, hash_seed) >> shift);
+    size_t step = 0;
+    size_t probes = 1;
+    while (slots[2 * slot] != 0) {
+      step = quadratic ? step + 1 : 1;
+      slot = (slot + step) & mask;
+      ++probes;
+    }
+    slots[2 * slot] = key;
+    slots[2 * slot + 1] = lookups[(position + 1) % key_count] + 1;
+    // Slots before a key on its probe path stay occupied, so its lookup repeats these probes.
+    total_probes += probes;
+  }
+
+  layout = LinkedStructureLayout{};
+  layout.kind = quadratic ? LinkedStructureKind::HashQuadratic : LinkedStructureKind::HashLinear;
+  layout.base = buffer;
+  layout.footprint_bytes = slot_count * slot_bytes;
+  layout.node_bytes = slot_bytes;
+  layout.element_count = key_count;
+  layout.slot_count = slot_count;
+  layout.hash_shift = shift;
+  layout.hash_seed = hash_seed;
+  layout.load_factor = static_cast<double>(key_count) / static_cast<double>(slot_count);
+  layout.start = lookups[0] + 1;
+  layout.steps_per_operation =
+      static_cast<double>(total_probes) / static_cast<double>(key_count);
+  // One key per probe, then the value.
+  layout.bytes_per_operation = (layout.steps_per_operation + 1.0) * kWordBytes;
+  return true;
+}
+
+uint64_t run_linked_structure_operations(const LinkedStructureLayout& layout, uint64_t state,
+                                         size_t operations, uint64_t& checksum) {
+  switch (layout.kind) {
+    case LinkedStructureKind::PointerChase:
+      return traverse_list(state, operations, 0, checksum);
+    case LinkedStructureKind::LinkedList:
+      return traverse_list(state, operations, layout.payload_bytes / kWordBytes, checksum);
+    case LinkedStructureKind::TreeLookup:
+      return lookup_tree(layout, state, operations);
+    case LinkedStructureKind::HashLinear:
+      return lookup_hash<false>(layout, state, operations);
+    case LinkedStructureKind::HashQuadratic:
+      return lookup_hash<true>(layout, state, operations);
+  }
+  return state;
+}
+
+void finalize_linked_structures_result(LinkedStructuresResult& result) {
+  for (LinkedStructureMeasurement& measurement : result.structures) {
+    if (measurement.samples_ns.empty()) {
+      continue;
+    }
+    const DescriptiveStatistics statistics =
+        calculate_descriptive_statistics(measurement.samples_ns);
+    measurement.median_ns = statistics.median;
+    measurement.cv_pct = statistics.coefficient_of_variation_pct;
+  }
+}
+
+nlohmann::ordered_json build_linked_structures_json(const LinkedStructuresConfig& config,
+                                                    const LinkedStructuresResult& result,
+                                                    const std::string& cpu_name,
+                                                    double total_execution_time_sec) {
+  nlohmann::ordered_json result_json;
+  result_json["mode"] = Constants::LINKED_JSON_MODE_NAME;
+  result_json["schema_version"] = Constants::LINKED_JSON_SCHEMA_VERSION;
+  result_json["methodology_version"] = Constants::LINKED_METHODOLOGY_VERSION;
+  result_json["status"] = result.interrupted ? "interrupted" : "complete";
+  result_json["cpu_name"] = cpu_name;
+
+  nlohmann::ordered_json configuration;
+  configuration["buffer_size_mb"] = config.buffer_size_mb;
+  configuration["operations_per_sample"] = config.operations;
+  configuration["rounds"] = config.rounds;
+  configuration["payload_bytes"] = config.payload_bytes;
+  configuration["tree_fanout"] = config.tree_fanout;
+  configuration["tree_node_bytes"] = config.tree_node_bytes;
+  configuration["load_factor"] = config.load_factor;
+  configuration["layout"] = latency_chain_mode_to_string(LatencyChainMode::GlobalRandom);
+  configuration["base_seed_uint64_decimal"] = std::to_string(config.seed);
+  configuration["seed_source"] = config.user_specified_seed ? "user" : "generated";
+  result_json["configuration"] = std::move(configuration);
+
+  double reference_ns = 0.0;
+  for (const LinkedStructureMeasurement& measurement : result.structures) {
+    if (measurement.layout.kind == LinkedStructureKind::PointerChase) {
+      reference_ns = measurement.median_ns;
+    }
+  }
+
+  nlohmann::ordered_json structures = nlohmann::ordered_json::array();
+  for (const LinkedStructureMeasurement& measurement : result.structures) {
+    const LinkedStructureLayout& layout = measurement.layout;
+    const bool measured = !measurement.samples_ns.empty() && measurement.median_ns > 0.0;
+    nlohmann::ordered_json structure;
+    structure["name"] = linked_structure_kind_to_string(layout.kind);
+    structure["footprint_bytes"] = layout.footprint_bytes;
+    structure["node_bytes"] = layout.node_bytes;
+    structure["elements"] = layout.element_count;
+    switch (layout.kind) {
+      case LinkedStructureKind::PointerChase:
+      case LinkedStructureKind::LinkedList:
+        structure["payload_bytes"] = layout.payload_bytes;
+        structure["nodes_per_operation"] = layout.steps_per_operation;
+        break;
+      case LinkedStructureKind::TreeLookup:
+        structure["fanout"] = layout.fanout;
+        structure["levels"] = layout.levels;
+        structure["nodes_per_operation"] = layout.steps_per_operation;
+        break;
+      case LinkedStructureKind::HashLinear:
+      case LinkedStructureKind::HashQuadratic:
+        structure["slots"] = layout.slot_count;
+        structure["load_factor"] = layout.load_factor;
+        structure["probes_per_operation"] = layout.steps_per_operation;
+        break;
+    }
+    structure["bytes_per_operation"] = layout.bytes_per_operation;
+    structure["ns_per_operation"] =
+        measured ? nlohmann::ordered_json(measurement.median_ns) : nlohmann::ordered_json(nullptr);
+    structure["ns_per_operation_cv_pct"] =
+        measured ? nlohmann::ordered_json(measurement.cv_pct) : nlohmann::ordered_json(nullptr);
+    structure["effective_gb_s"] =
+        measured ? nlohmann::ordered_json(layout.bytes_per_operation / measurement.median_ns)
+                 : nlohmann::ordered_json(nullptr);
+    structure["vs_pointer_chase"] =
+        measured && reference_ns > 0.0
+            ? nlohmann::ordered_json(measurement.median_ns / reference_ns)
+            : nlohmann::ordered_json(nullptr);
+    structure["samples_ns_per_operation"] = measurement.samples_ns;
+    structures.push_back(std::move(structure));
+  }
+  result_json["structures"] = std::move(structures);
+  result_json["total_execution_time_sec"] = total_execution_time_sec;
+  return result_json;
+}
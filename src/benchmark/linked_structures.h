@@ -0,0 +1,174 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+
+/**
+ * @file linked_structures.h
+ * @brief Standalone linked-data-structure traversal mode interfaces
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * `-K, --linked-structures` times dependent operations over structures whose
+ * layout comes from the latency chain builder's seeded node order: a linked
+ * list whose nodes carry a payload that is read, a B+-tree lookup with a
+ * configurable fanout and node size, and open-addressing hash lookups with
+ * linear and quadratic probing. Each operation's result is the next
+ * operation's input, so the reported time is latency per operation. A bare
+ * `memory_latency_chase_asm` walk over the list's next pointers is the
+ * reference.
+ */
+#ifndef LINKED_STRUCTURES_H
+#define LINKED_STRUCTURES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "core/config/constants.h"
+#include "third_party/nlohmann/json.hpp"
+
+enum class LinkedStructureKind {
+  PointerChase,   ///< List next pointers only, no payload read
+  LinkedList,     ///< Next pointer plus every payload word
+  TreeLookup,     ///< Root-to-leaf B+-tree descent with linear key scans
+  HashLinear,     ///< Open addressing, probe step 1
+  HashQuadratic,  ///< Open addressing, triangular probe steps
+};
+
+struct LinkedStructuresConfig {
+  unsigned long buffer_size_mb = Constants::LINKED_DEFAULT_BUFFER_SIZE_MB;
+  int operations = Constants::LINKED_DEFAULT_OPERATIONS;
+  int rounds = Constants::LINKED_DEFAULT_ROUNDS;
+  size_t payload_bytes = Constants::LINKED_DEFAULT_PAYLOAD_BYTES;
+  size_t tree_fanout = Constants::LINKED_DEFAULT_TREE_FANOUT;
+  size_t tree_node_bytes = Constants::LINKED_DEFAULT_TREE_NODE_BYTES;
+  double load_factor = Constants::LINKED_DEFAULT_LOAD_FACTOR;
+  uint64_t seed = 0;
+  bool user_specified_seed = false;
+  std::string output_file;
+  bool help_requested = false;
+};
+
+/**
+ * @brief One built structure and its exact per-operation accounting.
+ *
+ * `start` is a node address for the list kinds and a key for the lookup
+ * kinds. `bytes_per_operation` and `steps_per_operation` (nodes visited, or
+ * slots probed) are averaged over one full cycle of the operation chain,
+ * which the timed samples traverse.
+ */
+struct LinkedStructureLayout {
+  LinkedStructureKind kind = LinkedStructureKind::PointerChase;
+  const void* base = nullptr;
+  size_t footprint_bytes = 0;
+  size_t node_bytes = 0;     ///< List node, tree node, or hash slot
+  size_t element_count = 0;  ///< List nodes or stored keys
+  size_t payload_bytes = 0;
+  size_t fanout = 0;
+  size_t levels = 0;
+  size_t slot_count = 0;
+  unsigned hash_shift = 0;
+  uint64_t hash_seed = 0;
+  double load_factor = 0.0;
+  uint64_t start = 0;
+  double bytes_per_operation = 0.0;
+  double steps_per_operation = 0.0;
+};
+
+struct LinkedStructureMeasurement {
+  LinkedStructureLayout layout;
+  std::vector<double> samples_ns;  ///< Nanoseconds per operation, one per round
+  double median_ns = 0.0;
+  double cv_pct = 0.0;
+};
+
+struct LinkedStructuresResult {
+  size_t buffer_bytes = 0;
+  std::vector<LinkedStructureMeasurement> structures;
+  bool interrupted = false;
+};
+
+const char* linked_structure_kind_to_string(LinkedStructureKind kind);
+
+/** @brief List node size: next pointer plus payload, rounded to the node alignment. */
+size_t linked_list_node_bytes(size_t payload_bytes);
+
+/** @brief Bytes a tree node needs for its header, `fanout` keys, and `fanout` links. */
+size_t linked_tree_min_node_bytes(size_t fanout);
+
+/**
+ * @brief Link list nodes in the seeded chain order and fill their payloads.
+ * @return false when fewer than two nodes fit.
+ */
+bool build_linked_list(void* buffer, size_t buffer_bytes, size_t payload_bytes, uint64_t seed,
+                       LinkedStructureLayout& layout);
+
+/**
+ * @brief Build a full-leaf B+-tree of keys `0..n-1` with nodes placed in seeded chain order.
+ *
+ * Each leaf's values link every key to the next key of a seeded lookup
+ * chain. `node_bytes` must hold linked_tree_min_node_bytes(fanout).
+ * @return false when the parameters do not fit or fewer than two keys fit.
+ */
+bool build_linked_tree(void* buffer, size_t buffer_bytes, size_t fanout, size_t node_bytes,
+                       uint64_t seed, LinkedStructureLayout& layout);
+
+/**
+ * @brief Insert keys into a power-of-two open-addressing table at `load_factor`.
+ *
+ * Keys are inserted in seeded chain order; each key's value is the next key
+ * of that chain. The home slot comes from a seeded 64-bit mix of the key.
+ * @return false for a load factor outside (0, 1) or fewer than two keys.
+ */
+bool build_linked_hash_table(void* buffer, size_t buffer_bytes, double load_factor,
+                             bool quadratic, uint64_t seed, LinkedStructureLayout& layout);
+
+/**
+ * @brief Run `operations` dependent operations from `state`.
+ * @param checksum XOR of payload words read by the list kind.
+ * @return The state after the last operation, to continue the chain.
+ */
+uint64_t run_linked_structure_operations(const LinkedStructureLayout& layout, uint64_t state,
+                                         size_t operations, uint64_t& checksum);
+
+/** @brief Median and CV of each structure's samples. */
+void finalize_linked_structures_result(LinkedStructuresResult& result);
+
+nlohmann::ordered_json build_linked_structures_json(const LinkedStructuresConfig& config,
+                                                    const LinkedStructuresResult& result,
+                                                    const std::string& cpu_name,
+                                                    double total_execution_time_sec);
+
+/**
+ * @brief Parse CLI args for standalone linked-structures mode.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on parse/validation error.
+ */
+int parse_linked_structures_mode_arguments(int argc, char* argv[],
+                                           LinkedStructuresConfig& config);
+
+/**
+ * @brief Build every structure, time it, report, and save JSON.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on runtime/IO error.
+ */
+int run_linked_structures(const LinkedStructuresConfig& config);
+
+/**
+ * @brief Parse and run standalone linked-structures mode from main().
+ */
+int run_linked_structures_mode(int argc, char* argv[]);
+
+#endif  // LINKED_STRUCTURES_H
@@ -0,0 +1,304 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+
+/**
+ * @file linked_structures_cli.cpp
+ * @brief CLI parsing for standalone linked-structures mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Parses and validates mode-specific command line options for
+ * `-K, --linked-structures`. Like the other standalone modes, only an
+ * explicit option set is accepted.
+ */
+
+#include "benchmark/linked_structures.h"
+
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+
+#include "core/config/cli_options.h"
+#include "core/config/config.h"
+#include "core/config/constants.h"
+#include "core/signal/signal_handler.h"
+#include "output/console/messages/messages_api.h"
+#include "output/console/output_printer.h"
+#include "utils/seed_utils.h"
+
+namespace {
+
+constexpr const char* OPT_LINKED_SHORT = "-K";
+constexpr const char* OPT_LINKED_LONG = "--linked-structures";
+constexpr const char* OPT_PAYLOAD_BYTES_LONG = "--payload-bytes";
+constexpr const char* OPT_TREE_FANOUT_LONG = "--tree-fanout";
+constexpr const char* OPT_TREE_NODE_BYTES_LONG = "--tree-node-bytes";
+constexpr const char* OPT_LOAD_FACTOR_LONG = "--load-factor";
+constexpr const char* OPT_SEED_LONG = "--seed";
+constexpr const char* OPT_BUFFER_SIZE_SHORT = "-b";
+constexpr const char* OPT_BUFFER_SIZE_LONG = "--buffer-size";
+constexpr const char* OPT_ITERATIONS_SHORT = "-i";
+constexpr const char* OPT_ITERATIONS_LONG = "--iterations";
+constexpr const char* OPT_COUNT_SHORT = "-r";
+constexpr const char* OPT_COUNT_LONG = "--count";
+constexpr const char* OPT_HELP_SHORT = "-h";
+constexpr const char* OPT_HELP_LONG = "--help";
+constexpr const char* OPT_OUTPUT_SHORT = "-o";
+constexpr const char* OPT_OUTPUT_LONG = "--output";
+
+// Byte counts are multiples of 8 in [minimum, maximum].
+bool parse_word_multiple_option(const std::string& option,
+                                const std::string& value,
+                                size_t minimum,
+                                size_t maximum,
+                                size_t& out_value,
+                                const char* prog_name) {
+  int parsed = 0;
+  if (!parse_positive_int_option(option, value, parsed, prog_name)) {
+    return false;
+  }
+  const size_t bytes = static_cast<size_t>(parsed);
+  if (bytes < minimum || bytes > maximum || bytes % sizeof(uint64_t) != 0) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_invalid_value(
+                     option, value,
+                     "must be a multiple of 8 between " + std::to_string(minimum) + " and " +
+                         std::to_string(maximum))
+              << std::endl;
+    print_usage(prog_name);
+    return false;
+  }
+  out_value = bytes;
+  return true;
+}
+
+bool parse_load_factor_option(const std::string& value, double& out_value,
+                              const char* prog_name) {
+  char* end = nullptr;
+  errno = 0;
+  const bool leading_space =
+      value.empty() || std::isspace(static_cast<unsigned char>(value.front())) != 0;
+  const double parsed = leading_space ? 0.0 : std::strtod(value.c_str(), &end);
+  const bool complete = !leading_space && *end == '\0' && errno == 0;
+  if (!complete || !std::isfinite(parsed) || parsed <= 0.0 ||
+      parsed > Constants::LINKED_MAX_LOAD_FACTOR) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_invalid_value(
+                     OPT_LOAD_FACTOR_LONG, value,
+                     Messages::error_linked_load_factor_range(Constants::LINKED_MAX_LOAD_FACTOR))
+              << std::endl;
+    print_usage(prog_name);
+    return false;
+  }
+  out_value = parsed;
+  return true;
+}
+
+}  // namespace
+
+int parse_linked_structures_mode_arguments(int argc, char* argv[],
+                                           LinkedStructuresConfig& config) {
+  config.rounds = Constants::LINKED_DEFAULT_ROUNDS;
+  config.buffer_size_mb = Constants::LINKED_DEFAULT_BUFFER_SIZE_MB;
+  config.operations = Constants::LINKED_DEFAULT_OPERATIONS;
+  config.payload_bytes = Constants::LINKED_DEFAULT_PAYLOAD_BYTES;
+  config.tree_fanout = Constants::LINKED_DEFAULT_TREE_FANOUT;
+  config.tree_node_bytes = Constants::LINKED_DEFAULT_TREE_NODE_BYTES;
+  config.load_factor = Constants::LINKED_DEFAULT_LOAD_FACTOR;
+  config.user_specified_seed = false;
+
+  bool mode_seen = false;
+  bool output_seen = false;
+  bool buffer_size_seen = false;
+  bool iterations_seen = false;
+  bool count_seen = false;
+  bool payload_seen = false;
+  bool fanout_seen = false;
+  bool node_bytes_seen = false;
+  bool load_factor_seen = false;
+  bool seed_seen = false;
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+
+    if (is_option(arg, OPT_LINKED_SHORT, OPT_LINKED_LONG)) {
+      mode_seen = true;
+      continue;
+    }
+
+    if (is_option(arg, OPT_HELP_SHORT, OPT_HELP_LONG)) {
+      print_help(argv[0]);
+      config.help_requested = true;
+      return EXIT_SUCCESS;
+    }
+
+    if (is_option(arg, OPT_OUTPUT_SHORT, OPT_OUTPUT_LONG)) {
+      if (!take_option_value(argc, argv, i, output_seen, OPT_OUTPUT_LONG)) {
+        return EXIT_FAILURE;
+      }
+      config.output_file = argv[i];
+      continue;
+    }
+
+    if (is_option(arg, OPT_BUFFER_SIZE_SHORT, OPT_BUFFER_SIZE_LONG)) {
+      if (!take_option_value(argc, argv, i, buffer_size_seen, OPT_BUFFER_SIZE_LONG)) {
+        return EXIT_FAILURE;
+      }
+      int parsed = 0;
+      if (!parse_positive_int_option(OPT_BUFFER_SIZE_LONG, argv[i], parsed, argv[0])) {
+        return EXIT_FAILURE;
+      }
+      config.buffer_size_mb = static_cast<unsigned long>(parsed);
+      continue;
+    }
+
+    if (is_option(arg, OPT_ITERATIONS_SHORT, OPT_ITERATIONS_LONG)) {
+      if (!take_option_value(argc, argv, i, iterations_seen, OPT_ITERATIONS_LONG)) {
+        return EXIT_FAILURE;
+      }
+      if (!parse_positive_int_option(OPT_ITERATIONS_LONG, argv[i], config.operations, argv[0])) {
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (is_option(arg, OPT_COUNT_SHORT, OPT_COUNT_LONG)) {
+      if (!take_option_value(argc, argv, i, count_seen, OPT_COUNT_LONG)) {
+        return EXIT_FAILURE;
+      }
+      if (!parse_positive_int_option(OPT_COUNT_LONG, argv[i], config.rounds, argv[0])) {
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (arg == OPT_PAYLOAD_BYTES_LONG) {
+      if (!take_option_value(argc, argv, i, payload_seen, OPT_PAYLOAD_BYTES_LONG) ||
+          !parse_word_multiple_option(OPT_PAYLOAD_BYTES_LONG, argv[i], sizeof(uint64_t),
+                                      Constants::LINKED_MAX_PAYLOAD_BYTES, config.payload_bytes,
+                                      argv[0])) {
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (arg == OPT_TREE_FANOUT_LONG) {
+      if (!take_option_value(argc, argv, i, fanout_seen, OPT_TREE_FANOUT_LONG)) {
+        return EXIT_FAILURE;
+      }
+      int parsed = 0;
+      if (!parse_positive_int_option(OPT_TREE_FANOUT_LONG, argv[i], parsed, argv[0])) {
+        return EXIT_FAILURE;
+      }
+      if (parsed < 2 || static_cast<size_t>(parsed) > Constants::LINKED_MAX_TREE_FANOUT) {
+        std::cerr << Messages::error_prefix()
+                  << Messages::error_invalid_value(
+                         OPT_TREE_FANOUT_LONG, argv[i],
+                         "must be between 2 and " +
+                             std::to_string(Constants::LINKED_MAX_TREE_FANOUT))
+                  << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      config.tree_fanout = static_cast<size_t>(parsed);
+      continue;
+    }
+
+    if (arg == OPT_TREE_NODE_BYTES_LONG) {
+      if (!take_option_value(argc, argv, i, node_bytes_seen, OPT_TREE_NODE_BYTES_LONG) ||
+          !parse_word_multiple_option(OPT_TREE_NODE_BYTES_LONG, argv[i],
+                                      linked_tree_min_node_bytes(2),
+                                      Constants::LINKED_MAX_TREE_NODE_BYTES,
+                                      config.tree_node_bytes, argv[0])) {
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (arg == OPT_LOAD_FACTOR_LONG) {
+      if (!take_option_value(argc, argv, i, load_factor_seen, OPT_LOAD_FACTOR_LONG) ||
+          !parse_load_factor_option(argv[i], config.load_factor, argv[0])) {
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (arg == OPT_SEED_LONG) {
+      if (!take_option_value(argc, argv, i, seed_seen, OPT_SEED_LONG)) {
+        return EXIT_FAILURE;
+      }
+      const StrictIntegerParseStatus status =
+          parse_strict_unsigned_decimal(argv[i], config.seed);
+      if (status != StrictIntegerParseStatus::Success) {
+        std::cerr << Messages::error_prefix()
+                  << Messages::error_invalid_value(OPT_SEED_LONG, argv[i],
+                                                   strict_unsigned_decimal_error_reason(status))
+                  << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      config.user_specified_seed = true;
+      continue;
+    }
+
+    std::cerr << Messages::error_prefix()
+              << Messages::error_linked_structures_must_be_used_alone()
+              << std::endl;
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  if (!mode_seen) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_linked_structures_must_be_used_alone()
+              << std::endl;
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  if (config.tree_node_bytes < linked_tree_min_node_bytes(config.tree_fanout)) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_linked_tree_node_too_small(
+                     config.tree_fanout, config.tree_node_bytes,
+                     linked_tree_min_node_bytes(config.tree_fanout))
+              << std::endl;
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  if (!config.user_specified_seed) {
+    config.seed = SeedUtils::generate_seed();
+  }
+  return EXIT_SUCCESS;
+}
+
+int run_linked_structures_mode(int argc, char* argv[]) {
+  LinkedStructuresConfig config;
+  if (parse_linked_structures_mode_arguments(argc, argv, config) != EXIT_SUCCESS) {
+    return EXIT_FAILURE;
+  }
+  if (config.help_requested) {
+    return EXIT_SUCCESS;
+  }
+
+  BenchmarkSignalMaskGuard signal_guard;
+  return run_linked_structures(config);
+}
@@ -0,0 +1,213 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+
+/**
+ * @file linked_structures_runner.cpp
+ * @brief Dependent-operation timing for linked-structures mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Every structure gets its own buffer. Samples continue the operation chain
+ * from where the previous sample stopped, so repeated samples keep walking
+ * new nodes instead of re-timing a cached prefix. The reference walks the
+ * list's next pointers with memory_latency_chase_asm.
+ */
+
+#include "benchmark/linked_structures.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "asm/asm_functions.h"
+#include "benchmark/benchmark_work_plan.h"
+#include "core/config/constants.h"
+#include "core/memory/memory_manager.h"
+#include "core/signal/signal_handler.h"
+#include "core/system/system_info.h"
+#include "core/timing/timer.h"
+#include "output/console/messages/messages_api.h"
+#include "output/console/output_printer.h"
+#include "output/json/json_output/json_output_api.h"
+#include "utils/seed_utils.h"
+
+namespace {
+
+// Nanoseconds per operation for one sample; advances `state` along the chain.
+double time_linked_sample(const LinkedStructureLayout& layout, uint64_t& state,
+                          size_t operations, HighResTimer& timer, uint64_t& checksum) {
+  timer.start();
+  if (layout.kind == LinkedStructureKind::PointerChase) {
+    state = reinterpret_cast<uintptr_t>(
+        memory_latency_chase_asm(reinterpret_cast<uintptr_t*>(state), operations));
+  } else {
+    state = run_linked_structure_operations(layout, state, operations, checksum);
+  }
+  const double elapsed_ns = timer.stop_ns();
+  return elapsed_ns / static_cast<double>(operations);
+}
+
+void print_linked_structures_report(const LinkedStructuresResult& result) {
+  std::cout << std::endl << Messages::report_linked_structures_header() << std::endl;
+  std::cout << Messages::report_linked_structures_note() << std::endl;
+  std::cout << Messages::report_linked_structures_table_header() << std::endl;
+  double reference_ns = 0.0;
+  for (const LinkedStructureMeasurement& measurement : result.structures) {
+    if (measurement.layout.kind == LinkedStructureKind::PointerChase) {
+      reference_ns = measurement.median_ns;
+    }
+  }
+  for (const LinkedStructureMeasurement& measurement : result.structures) {
+    if (measurement.samples_ns.empty()) {
+      continue;
+    }
+    const LinkedStructureLayout& layout = measurement.layout;
+    const bool hashed = layout.kind == LinkedStructureKind::HashLinear ||
+                        layout.kind == LinkedStructureKind::HashQuadratic;
+    std::cout << Messages::report_linked_structures_row(
+                     linked_structure_kind_to_string(layout.kind), measurement.median_ns,
+                     layout.bytes_per_operation, layout.steps_per_operation,
+                     hashed ? "probes" : "nodes", reference_ns, measurement.cv_pct)
+              << std::endl;
+  }
+}
+
+int fail_linked_structures(const std::string& reason) {
+  std::cerr << Messages::error_prefix() << Messages::error_linked_structures_failed(reason)
+            << std::endl;
+  return EXIT_FAILURE;
+}
+
+uint64_t structure_seed(uint64_t base_seed, LinkedStructureKind kind) {
+  return SeedUtils::splitmix64(base_seed + static_cast<uint64_t>(kind));
+}
+
+}  // namespace
+
+int run_linked_structures(const LinkedStructuresConfig& config) {
+  print_runtime_banner();
+  LinkedStructuresResult result;
+  result.buffer_bytes = static_cast<size_t>(config.buffer_size_mb) * Constants::BYTES_PER_MB;
+  std::cout << Messages::msg_running_linked_structures(
+                   config.buffer_size_mb, config.operations, config.payload_bytes,
+                   config.tree_fanout, config.tree_node_bytes, config.load_factor)
+            << std::endl;
+  const auto run_start = std::chrono::steady_clock::now();
+
+  MmapPtr list_buffer = allocate_buffer(result.buffer_bytes, "linked list");
+  MmapPtr tree_buffer = allocate_buffer(result.buffer_bytes, "tree");
+  MmapPtr linear_buffer = allocate_buffer(result.buffer_bytes, "linear-probe table");
+  MmapPtr quadratic_buffer = allocate_buffer(result.buffer_bytes, "quadratic-probe table");
+  if (!list_buffer || !tree_buffer || !linear_buffer || !quadratic_buffer) {
+    return fail_linked_structures("buffer allocation");
+  }
+  // Zero fill faults every page in before the structures are linked.
+  for (void* buffer : {list_buffer.get(), tree_buffer.get(), linear_buffer.get(),
+                       quadratic_buffer.get()}) {
+    std::memset(buffer, 0, result.buffer_bytes);
+  }
+
+  LinkedStructureLayout list;
+  if (!build_linked_list(list_buffer.get(), result.buffer_bytes, config.payload_bytes,
+                         structure_seed(config.seed, LinkedStructureKind::LinkedList), list)) {
+    return fail_linked_structures("the buffer holds fewer than two list nodes");
+  }
+  LinkedStructureLayout chase = list;
+  chase.kind = LinkedStructureKind::PointerChase;
+  chase.payload_bytes = 0;
+  chase.bytes_per_operation = static_cast<double>(sizeof(uintptr_t));
+  LinkedStructureLayout tree;
+  if (!build_linked_tree(tree_buffer.get(), result.buffer_bytes, config.tree_fanout,
+                         config.tree_node_bytes,
+                         structure_seed(config.seed, LinkedStructureKind::TreeLookup), tree)) {
+    return fail_linked_structures("the buffer holds no tree node");
+  }
+  LinkedStructureLayout linear;
+  LinkedStructureLayout quadratic;
+  if (!build_linked_hash_table(linear_buffer.get(), result.buffer_bytes, config.load_factor,
+                               false, structure_seed(config.seed, LinkedStructureKind::HashLinear),
+                               linear) ||
+      !build_linked_hash_table(quadratic_buffer.get(), result.buffer_bytes, config.load_factor,
+                               true,
+                               structure_seed(config.seed, LinkedStructureKind::HashQuadratic),
+                               quadratic)) {
+    return fail_linked_structures("the load factor leaves fewer than two keys in the table");
+  }
+  for (const LinkedStructureLayout& layout : {chase, list, tree, linear, quadratic}) {
+    LinkedStructureMeasurement measurement;
+    measurement.layout = layout;
+    result.structures.push_back(measurement);
+  }
+
+  auto timer_optional = HighResTimer::create();
+  if (!timer_optional) {
+    std::cerr << Messages::error_prefix() << Messages::error_timer_creation_failed() << std::endl;
+    return EXIT_FAILURE;
+  }
+  HighResTimer& timer = *timer_optional;
+
+  const size_t operations = static_cast<size_t>(config.operations);
+  std::vector<uint64_t> states;
+  for (const LinkedStructureMeasurement& measurement : result.structures) {
+    states.push_back(measurement.layout.start);
+  }
+  uint64_t checksum = 0;
+  // One untimed sample per structure settles the TLB and frequency before round one.
+  for (size_t index = 0; index < result.structures.size(); ++index) {
+    time_linked_sample(result.structures[index].layout, states[index], operations, timer,
+                       checksum);
+  }
+  for (int round = 0; round < config.rounds && !result.interrupted; ++round) {
+    for (size_t index :
+         build_benchmark_cyclic_order(result.structures.size(), static_cast<size_t>(round))) {
+      LinkedStructureMeasurement& measurement = result.structures[index];
+      measurement.samples_ns.push_back(
+          time_linked_sample(measurement.layout, states[index], operations, timer, checksum));
+      if (signal_received()) {
+        result.interrupted = true;
+        break;
+      }
+    }
+  }
+  if (result.interrupted) {
+    std::cout << std::endl << Messages::msg_interrupted_by_user() << std::endl;
+  }
+
+  finalize_linked_structures_result(result);
+  print_linked_structures_report(result);
+
+  if (!config.output_file.empty()) {
+    const double total_execution_time_sec =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - run_start).count();
+    std::filesystem::path output_path(config.output_file);
+    if (output_path.is_relative()) {
+      output_path = std::filesystem::current_path() / output_path;
+    }
+    if (write_json_to_file(output_path,
+                           build_linked_structures_json(config, result, get_processor_name(),
+                                                        total_execution_time_sec)) !=
+        EXIT_SUCCESS) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
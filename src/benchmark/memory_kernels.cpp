@@ -0,0 +1,116 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+/**
+ * @file memory_kernels.cpp
+ * @brief Runtime-selected main-memory bandwidth kernel table
+ */
+
+#include "benchmark/memory_kernels.h"
+
+#include "asm/asm_functions.h"
+#include "benchmark/generated_kernels.h"
+
+namespace {
+
+MemoryKernelSet make_neon_kernel_set() {
+  MemoryKernelSet kernels;
+  kernels.variant = MemoryKernelVariant::Neon;
+  kernels.name = memory_kernel_variant_to_string(MemoryKernelVariant::Neon);
+  kernels.indexed_name = kernels.name;
+  kernels.read = memory_read_loop_asm;
+  kernels.write = memory_write_loop_asm;
+  kernels.copy = memory_copy_loop_asm;
+  kernels.read_strided = memory_read_strided_phased_loop_asm;
+  kernels.write_strided = memory_write_strided_phased_loop_asm;
+  kernels.copy_strided = memory_copy_strided_phased_loop_asm;
+  kernels.read_random = memory_read_random_loop_asm;
+  kernels.write_random = memory_write_random_loop_asm;
+  kernels.copy_random = memory_copy_random_loop_asm;
+  return kernels;
+}
+
+MemoryKernelSet make_generated_kernel_set(const GeneratedKernel& generated) {
+  MemoryKernelSet kernels = make_neon_kernel_set();
+  kernels.variant = MemoryKernelVariant::Generated;
+  kernels.name = generated.name;
+  kernels.read = generated.read;
+  kernels.write = generated.write;
+  kernels.copy = generated.copy;
+  return kernels;
+}
+
+// Written only while parsing arguments, before any benchmark thread exists.
+MemoryKernelSet g_tuned_kernels;
+bool g_tuned_kernels_installed = false;
+
+const MemoryKernelSet* find_registry_kernel_set(const std::string& name) {
+  for (const MemoryKernelSet& kernels : memory_kernel_registry()) {
+    if (kernels.name == name) return &kernels;
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+// Generated and tuned sets are found by name, so every variant maps to the
+// NEON table here.
+const MemoryKernelSet& memory_kernel_set(MemoryKernelVariant /*variant*/) {
+  static const MemoryKernelSet neon_kernels = make_neon_kernel_set();
+  return neon_kernels;
+}
+
+const std::vector<MemoryKernelSet>& memory_kernel_registry() {
+  static const std::vector<MemoryKernelSet> registry = [] {
+    std::vector<MemoryKernelSet> kernels = {memory_kernel_set(MemoryKernelVariant::Neon)};
+    for (const GeneratedKernel& generated : generated_kernels()) {
+      kernels.push_back(make_generated_kernel_set(generated));
+    }
+    return kernels;
+  }();
+  return registry;
+}
+
+const MemoryKernelSet* install_tuned_memory_kernel_set(const std::string& read_name,
+                                                       const std::string& write_name,
+                                                       const std::string& copy_name) {
+  const MemoryKernelSet* read_kernels = find_registry_kernel_set(read_name);
+  const MemoryKernelSet* write_kernels = find_registry_kernel_set(write_name);
+  const MemoryKernelSet* copy_kernels = find_registry_kernel_set(copy_name);
+  if (read_kernels == nullptr || write_kernels == nullptr || copy_kernels == nullptr) {
+    return nullptr;
+  }
+  g_tuned_kernels = make_neon_kernel_set();
+  g_tuned_kernels.variant = MemoryKernelVariant::Tuned;
+  g_tuned_kernels.name = memory_kernel_variant_to_string(MemoryKernelVariant::Tuned);
+  g_tuned_kernels.read = read_kernels->read;
+  g_tuned_kernels.write = write_kernels->write;
+  g_tuned_kernels.copy = copy_kernels->copy;
+  g_tuned_kernels_installed = true;
+  return &g_tuned_kernels;
+}
+
+const MemoryKernelSet* find_memory_kernel_set(const std::string& name) {
+  if (g_tuned_kernels_installed && name == g_tuned_kernels.name) {
+    return &g_tuned_kernels;
+  }
+  return find_registry_kernel_set(name);
+}
+
+const MemoryKernelSet& resolve_memory_kernel_set(const std::string& name,
+                                                 MemoryKernelVariant variant) {
+  const MemoryKernelSet* named = name.empty() ? nullptr : find_memory_kernel_set(name);
+  return named != nullptr ? *named : memory_kernel_set(variant);
+}
@@ -0,0 +1,92 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+/**
+ * @file memory_kernels.h
+ * @brief Runtime-selected main-memory bandwidth kernel table
+ */
+
+#ifndef MEMORY_KERNELS_H
+#define MEMORY_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "core/memory/memory_utils.h"
+
+/**
+ * @brief Function pointers for one kernel family.
+ *
+ * Every variant shares the NEON prototypes and payload semantics, so callers
+ * swap the table without changing work planning or byte accounting. Cache-
+ * resident, reverse, and gather/scatter kernels are not part of the table and
+ * remain NEON on every host. Generated sets only replace the sequential
+ * kernels; their strided and random entries are the NEON asm kernels.
+ */
+struct MemoryKernelSet {
+  MemoryKernelVariant variant = MemoryKernelVariant::Neon;
+  std::string name;          ///< Registry name reported for sequential kernels
+  std::string indexed_name;  ///< Name reported for strided and random kernels
+  uint64_t (*read)(const void*, size_t) = nullptr;
+  void (*write)(void*, size_t) = nullptr;
+  void (*copy)(void*, const void*, size_t) = nullptr;
+  uint64_t (*read_strided)(const void*, size_t, size_t, size_t, size_t) = nullptr;
+  void (*write_strided)(void*, size_t, size_t, size_t, size_t) = nullptr;
+  void (*copy_strided)(void*, const void*, size_t, size_t, size_t, size_t) = nullptr;
+  uint64_t (*read_random)(const void*, const size_t*, size_t) = nullptr;
+  void (*write_random)(void*, const size_t*, size_t) = nullptr;
+  void (*copy_random)(void*, const void*, const size_t*, size_t) = nullptr;
+};
+
+/**
+ * @brief Return the kernel table for a variant.
+ * @param variant Kernel family; generated and tuned sets are looked up by name instead.
+ * @return Static NEON table.
+ */
+const MemoryKernelSet& memory_kernel_set(MemoryKernelVariant variant);
+
+/**
+ * @brief Return every selectable kernel set: neon, then the generated matrix.
+ */
+const std::vector<MemoryKernelSet>& memory_kernel_registry();
+
+/**
+ * @brief Install the `tuned` set from per-operation registry names.
+ *
+ * Each sequential entry comes from the named registry set; strided and random
+ * entries stay NEON. Replaces any previously installed tuned set.
+ * @return Installed set, or nullptr when any name is not in the registry.
+ */
+const MemoryKernelSet* install_tuned_memory_kernel_set(const std::string& read_name,
+                                                       const std::string& write_name,
+                                                       const std::string& copy_name);
+
+/**
+ * @brief Look up a kernel set by registry name.
+ * @return Registry entry, the installed `tuned` set, or nullptr for unknown names.
+ */
+const MemoryKernelSet* find_memory_kernel_set(const std::string& name);
+
+/**
+ * @brief Resolve the kernel set for a run.
+ * @param name Explicit `--kernel` name; empty selects by variant.
+ * @param variant Host-selected variant used when `name` is empty or unknown.
+ */
+const MemoryKernelSet& resolve_memory_kernel_set(const std::string& name,
+                                                 MemoryKernelVariant variant);
+
+#endif  // MEMORY_KERNELS_H
@@ -0,0 +1,210 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file multi_process.cpp
+ * @brief Worker-count planning, result reduction, and JSON for multi-process mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Everything here is measurement-free so it can be unit tested; threads,
+ * fork(), and the shared barrier live in multi_process_runner.cpp.
+ */
+
+#include "benchmark/multi_process.h"
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+
+#include "core/config/config.h"
+#include "utils/descriptive_statistics.h"
+
+namespace {
+
+constexpr MultiProcessOperation kOperations[MULTI_PROCESS_OPERATION_COUNT] = {
+    MultiProcessOperation::Read, MultiProcessOperation::Write, MultiProcessOperation::Copy,
+    MultiProcessOperation::Latency};
+
+constexpr MultiProcessExecutor kExecutors[MULTI_PROCESS_EXECUTOR_COUNT] = {
+    MultiProcessExecutor::Threads, MultiProcessExecutor::Processes};
+
+}  // namespace
+
+const char* multi_process_memory_to_string(MultiProcessMemory memory) {
+  return memory == MultiProcessMemory::Shared ? "shared" : "private";
+}
+
+bool parse_multi_process_memory(const std::string& name, MultiProcessMemory& out_memory) {
+  if (name == "private") {
+    out_memory = MultiProcessMemory::Private;
+    return true;
+  }
+  if (name == "shared") {
+    out_memory = MultiProcessMemory::Shared;
+    return true;
+  }
+  return false;
+}
+
+const char* multi_process_executor_to_string(MultiProcessExecutor executor) {
+  return executor == MultiProcessExecutor::Processes ? "processes" : "threads";
+}
+
+const char* multi_process_operation_to_string(MultiProcessOperation operation) {
+  switch (operation) {
+    case MultiProcessOperation::Write:
+      return "write";
+    case MultiProcessOperation::Copy:
+      return "copy";
+    case MultiProcessOperation::Latency:
+      return "latency";
+    case MultiProcessOperation::Read:
+    default:
+      return "read";
+  }
+}
+
+const char* multi_process_operation_unit(MultiProcessOperation operation) {
+  return operation == MultiProcessOperation::Latency ? "ns" : "GB/s";
+}
+
+bool parse_multi_process_worker_counts(const std::string& text, std::vector<int>& out_counts) {
+  std::vector<int> counts;
+  std::stringstream stream(text);
+  std::string token;
+  while (std::getline(stream, token, ',')) {
+    long long parsed = 0;
+    if (parse_strict_signed_decimal(token, parsed) != StrictIntegerParseStatus::Success ||
+        parsed < 1 || parsed > std::numeric_limits<int>::max()) {
+      return false;
+    }
+    const int count = static_cast<int>(parsed);
+    if (std::find(counts.begin(), counts.end(), count) != counts.end()) {
+      return false;
+    }
+    counts.push_back(count);
+  }
+  // getline drops a trailing empty field, so "4," would otherwise pass.
+  if (counts.empty() || text.back() == ',') {
+    return false;
+  }
+  out_counts = std::move(counts);
+  return true;
+}
+
+std::vector<int> resolve_multi_process_worker_counts(const std::vector<int>& requested,
+                                                     int logical_cores) {
+  const int available = std::max(1, logical_cores);
+  const std::vector<int> wanted = requested.empty() ? std::vector<int>{1, available} : requested;
+  std::vector<int> counts;
+  for (int count : wanted) {
+    const int capped = std::min(count, available);
+    if (std::find(counts.begin(), counts.end(), capped) == counts.end()) {
+      counts.push_back(capped);
+    }
+  }
+  return counts;
+}
+
+double calculate_multi_process_advantage_pct(MultiProcessOperation operation,
+                                             double thread_value,
+                                             double process_value) {
+  if (thread_value <= 0.0 || process_value <= 0.0) {
+    return 0.0;
+  }
+  const double ratio = operation == MultiProcessOperation::Latency ? thread_value / process_value
+                                                                   : process_value / thread_value;
+  return (ratio - 1.0) * 100.0;
+}
+
+MultiProcessResult make_multi_process_result(const std::vector<int>& worker_counts) {
+  MultiProcessResult result;
+  for (int workers : worker_counts) {
+    MultiProcessPoint point;
+    point.workers = workers;
+    for (MultiProcessOperation operation : kOperations) {
+      MultiProcessOperationResult operation_result;
+      operation_result.operation = operation;
+      point.operations.push_back(std::move(operation_result));
+    }
+    result.points.push_back(std::move(point));
+  }
+  return result;
+}
+
+void finalize_multi_process_result(MultiProcessResult& result) {
+  for (MultiProcessPoint& point : result.points) {
+    for (MultiProcessOperationResult& operation : point.operations) {
+      for (size_t executor = 0; executor < MULTI_PROCESS_EXECUTOR_COUNT; ++executor) {
+        operation.median[executor] =
+            operation.samples[executor].empty()
+                ? 0.0
+                : calculate_descriptive_statistics(operation.samples[executor]).median;
+      }
+      operation.process_vs_thread_pct = calculate_multi_process_advantage_pct(
+          operation.operation, operation.median[0], operation.median[1]);
+    }
+  }
+}
+
+nlohmann::ordered_json build_multi_process_json(const MultiProcessConfig& config,
+                                                const MultiProcessResult& result,
+                                                const std::string& cpu_name,
+                                                double total_execution_time_sec) {
+  nlohmann::ordered_json result_json;
+  result_json["mode"] = Constants::MULTI_PROCESS_JSON_MODE_NAME;
+  result_json["schema_version"] = Constants::MULTI_PROCESS_JSON_SCHEMA_VERSION;
+  result_json["methodology_version"] = Constants::MULTI_PROCESS_METHODOLOGY_VERSION;
+  result_json["status"] = result.interrupted ? "interrupted" : "complete";
+  result_json["cpu_name"] = cpu_name;
+
+  nlohmann::ordered_json configuration;
+  configuration["process_memory"] = multi_process_memory_to_string(config.memory);
+  configuration["requested_worker_counts"] = config.worker_counts;
+  configuration["rounds"] = config.rounds;
+  configuration["buffer_size_mb"] = config.buffer_size_mb;
+  configuration["latency_accesses_per_worker"] = Constants::MULTI_PROCESS_LATENCY_ACCESSES;
+  result_json["configuration"] = std::move(configuration);
+
+  nlohmann::ordered_json points = nlohmann::ordered_json::array();
+  for (const MultiProcessPoint& point : result.points) {
+    nlohmann::ordered_json point_json;
+    point_json["workers"] = point.workers;
+    point_json["passes"] = point.passes;
+    nlohmann::ordered_json operations;
+    for (const MultiProcessOperationResult& operation : point.operations) {
+      nlohmann::ordered_json operation_json;
+      operation_json["unit"] = multi_process_operation_unit(operation.operation);
+      for (size_t executor = 0; executor < MULTI_PROCESS_EXECUTOR_COUNT; ++executor) {
+        operation_json[multi_process_executor_to_string(kExecutors[executor])] = {
+            {"median", operation.median[executor]}, {"rounds", operation.samples[executor]}};
+      }
+      if (operation.median[0] > 0.0 && operation.median[1] > 0.0) {
+        operation_json["process_vs_thread_pct"] = operation.process_vs_thread_pct;
+      } else {
+        operation_json["process_vs_thread_pct"] = nullptr;
+      }
+      operations[multi_process_operation_to_string(operation.operation)] =
+          std::move(operation_json);
+    }
+    point_json["operations"] = std::move(operations);
+    points.push_back(std::move(point_json));
+  }
+  result_json["points"] = std::move(points);
+  result_json["total_execution_time_sec"] = total_execution_time_sec;
+  return result_json;
+}
@@ -0,0 +1,148 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file multi_process.h
+ * @brief Standalone thread-versus-process scaling mode interfaces
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * `-F, --multi-process` runs main-memory read, write, copy, and loaded
+ * latency with N worker threads in one address space and again with N forked
+ * worker processes. Processes own either private buffers or chunks of one
+ * shared anonymous mapping, start behind a process-shared barrier, and report
+ * through a shared result area, so the two executors differ only in address
+ * space and page-table ownership.
+ */
+
+#ifndef MULTI_PROCESS_H
+#define MULTI_PROCESS_H
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "core/config/constants.h"
+#include "third_party/nlohmann/json.hpp"
+
+enum class MultiProcessMemory {
+  Private,  ///< Each child maps and faults its own chunk after fork()
+  Shared,   ///< Children use their chunk of one MAP_SHARED mapping made before fork()
+};
+
+enum class MultiProcessExecutor {
+  Threads,
+  Processes,
+};
+
+enum class MultiProcessOperation {
+  Read,     ///< GB/s over all workers
+  Write,    ///< GB/s over all workers
+  Copy,     ///< GB/s over all workers, read plus write bytes
+  Latency,  ///< ns per dependent access with every worker chasing its own chain
+};
+
+constexpr size_t MULTI_PROCESS_EXECUTOR_COUNT = 2;
+constexpr size_t MULTI_PROCESS_OPERATION_COUNT = 4;
+
+struct MultiProcessConfig {
+  std::vector<int> worker_counts;  ///< Empty uses 1 and all logical cores
+  MultiProcessMemory memory = MultiProcessMemory::Private;
+  int rounds = Constants::MULTI_PROCESS_DEFAULT_ROUNDS;
+  unsigned long buffer_size_mb = Constants::MULTI_PROCESS_DEFAULT_BUFFER_SIZE_MB;
+  std::string output_file;
+  bool help_requested = false;
+};
+
+struct MultiProcessOperationResult {
+  MultiProcessOperation operation = MultiProcessOperation::Read;
+  std::array<std::vector<double>, MULTI_PROCESS_EXECUTOR_COUNT> samples;  ///< Indexed by executor
+  std::array<double, MULTI_PROCESS_EXECUTOR_COUNT> median{};
+  double process_vs_thread_pct = 0.0;  ///< Signed; positive means processes did better
+};
+
+struct MultiProcessPoint {
+  int workers = 0;
+  size_t passes = 0;  ///< Bandwidth passes per worker, shared by both executors
+  std::vector<MultiProcessOperationResult> operations;  ///< Indexed by MultiProcessOperation
+};
+
+struct MultiProcessResult {
+  std::vector<MultiProcessPoint> points;
+  bool interrupted = false;
+};
+
+const char* multi_process_memory_to_string(MultiProcessMemory memory);
+bool parse_multi_process_memory(const std::string& name, MultiProcessMemory& out_memory);
+const char* multi_process_executor_to_string(MultiProcessExecutor executor);
+const char* multi_process_operation_to_string(MultiProcessOperation operation);
+const char* multi_process_operation_unit(MultiProcessOperation operation);
+
+/**
+ * @brief Parse a comma-separated worker-count list such as "1,4,8".
+ *
+ * Every entry must be a distinct positive integer; order is preserved.
+ */
+bool parse_multi_process_worker_counts(const std::string& text, std::vector<int>& out_counts);
+
+/**
+ * @brief Worker counts to measure.
+ *
+ * An empty request yields 1 and `logical_cores`. Requested counts are capped
+ * at `logical_cores` and de-duplicated in order.
+ */
+std::vector<int> resolve_multi_process_worker_counts(const std::vector<int>& requested,
+                                                     int logical_cores);
+
+/**
+ * @brief Signed process advantage over threads in percent.
+ *
+ * Positive when processes are better: higher bandwidth or lower latency.
+ * @return 0.0 when either value is not positive.
+ */
+double calculate_multi_process_advantage_pct(MultiProcessOperation operation,
+                                             double thread_value,
+                                             double process_value);
+
+/** @brief One point per worker count with every operation and no samples. */
+MultiProcessResult make_multi_process_result(const std::vector<int>& worker_counts);
+
+/** @brief Reduce samples to medians and compare processes with threads. */
+void finalize_multi_process_result(MultiProcessResult& result);
+
+nlohmann::ordered_json build_multi_process_json(const MultiProcessConfig& config,
+                                                const MultiProcessResult& result,
+                                                const std::string& cpu_name,
+                                                double total_execution_time_sec);
+
+/**
+ * @brief Parse CLI args for standalone multi-process mode.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on parse/validation error.
+ */
+int parse_multi_process_mode_arguments(int argc, char* argv[], MultiProcessConfig& config);
+
+/**
+ * @brief Measure every worker count with threads and processes, report, and save JSON.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on runtime/IO error.
+ */
+int run_multi_process(const MultiProcessConfig& config);
+
+/**
+ * @brief Parse and run standalone multi-process mode from main().
+ */
+int run_multi_process_mode(int argc, char* argv[]);
+
+#endif  // MULTI_PROCESS_H
@@ -0,0 +1,546 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file multi_process_runner.cpp
+ * @brief Thread and forked-process executors for multi-process mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * The thread executor is the parallel framework used by --benchmark. The
+ * process executor forks one child per worker; children meet the parent at a
+ * per-operation gate in a MAP_SHARED control area, time themselves against
+ * the start tick the parent published, and leave their elapsed time there.
+ * The slowest child is the measurement, exactly like the last worker to
+ * finish in run_parallel_test_common().
+ *
+ * fork() happens only while no worker threads exist, so children can
+ * allocate and print safely. Children leave through _exit() to skip the
+ * parent's atexit handlers and buffered output.
+ */
+
+#include "benchmark/multi_process.h"
+
+#include <mach/mach.h>
+#include <pthread/qos.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "asm/asm_functions.h"
+#include "benchmark/benchmark_work_plan.h"
+#include "benchmark/memory_kernels.h"
+#include "benchmark/parallel_test_framework.h"
+#include "core/config/constants.h"
+#include "core/memory/memory_manager.h"
+#include "core/memory/memory_utils.h"
+#include "core/signal/signal_handler.h"
+#include "core/system/system_info.h"
+#include "core/timing/timer.h"
+#include "output/console/messages/messages_api.h"
+#include "output/console/output_printer.h"
+#include "output/json/json_output/json_output_api.h"
+
+namespace {
+
+constexpr MultiProcessOperation kOperations[MULTI_PROCESS_OPERATION_COUNT] = {
+    MultiProcessOperation::Read, MultiProcessOperation::Write, MultiProcessOperation::Copy,
+    MultiProcessOperation::Latency};
+
+using OperationElapsed = std::array<double, MULTI_PROCESS_OPERATION_COUNT>;
+
+struct WorkerChunk {
+  char* src = nullptr;
+  char* dst = nullptr;
+  char* chain = nullptr;
+  size_t bytes = 0;
+};
+
+struct WorkerBuffers {
+  MmapPtr src;
+  MmapPtr dst;
+  MmapPtr chain;
+};
+
+// The barrier lives in memory shared across fork(), so its atomics must not
+// depend on process-local lock tables.
+static_assert(std::atomic<size_t>::is_always_lock_free &&
+                  std::atomic<uint64_t>::is_always_lock_free &&
+                  std::atomic<bool>::is_always_lock_free,
+              "process-shared gates need address-free atomics");
+
+struct ProcessGate {
+  std::atomic<size_t> ready{0};
+  std::atomic<uint64_t> start_ticks{0};
+  std::atomic<bool> go{false};
+};
+
+struct ProcessControl {
+  ProcessGate gates[MULTI_PROCESS_OPERATION_COUNT];
+  std::atomic<bool> abort{false};
+};
+
+struct alignas(128) ProcessWorkerSlot {
+  double elapsed_seconds[MULTI_PROCESS_OPERATION_COUNT] = {};
+  uint64_t checksum = 0;
+};
+
+struct ProcessWorkerContext {
+  MultiProcessMemory memory = MultiProcessMemory::Private;
+  const std::vector<size_t>* boundaries = nullptr;
+  const std::vector<WorkerChunk>* shared_chunks = nullptr;
+  size_t passes = 0;
+  const MemoryKernelSet* kernels = nullptr;
+  const HighResTimer* timer = nullptr;
+  ProcessControl* control = nullptr;
+  ProcessWorkerSlot* slots = nullptr;
+};
+
+struct ChildProcesses {
+  std::vector<pid_t> pids;
+  std::vector<bool> reaped;
+  bool failed = false;
+};
+
+size_t control_area_bytes(size_t workers) {
+  return sizeof(ProcessControl) + alignof(ProcessWorkerSlot) + workers * sizeof(ProcessWorkerSlot);
+}
+
+ProcessWorkerSlot* control_area_slots(void* area) {
+  const uintptr_t after_control = reinterpret_cast<uintptr_t>(area) + sizeof(ProcessControl);
+  const uintptr_t aligned = (after_control + alignof(ProcessWorkerSlot) - 1) &
+                            ~static_cast<uintptr_t>(alignof(ProcessWorkerSlot) - 1);
+  return reinterpret_cast<ProcessWorkerSlot*>(aligned);
+}
+
+MmapPtr allocate_worker_memory(MultiProcessMemory memory, size_t size, const char* name) {
+  return memory == MultiProcessMemory::Shared ? allocate_shared_buffer(size, name)
+                                              : allocate_buffer(size, name);
+}
+
+bool allocate_worker_buffers(MultiProcessMemory memory, size_t size, WorkerBuffers& buffers) {
+  buffers.src = allocate_worker_memory(memory, size, "multi-process source");
+  buffers.dst = allocate_worker_memory(memory, size, "multi-process destination");
+  buffers.chain = allocate_worker_memory(memory, size, "multi-process latency chain");
+  return buffers.src && buffers.dst && buffers.chain;
+}
+
+// Writing src and dst backs every page; the chain is rebuilt for each layout.
+bool prepare_chunk(const WorkerChunk& chunk, const MemoryKernelSet& kernels) {
+  kernels.write(chunk.src, chunk.bytes);
+  kernels.write(chunk.dst, chunk.bytes);
+  return setup_latency_chain(chunk.chain, chunk.bytes, Constants::LATENCY_STRIDE_BYTES) ==
+         EXIT_SUCCESS;
+}
+
+std::vector<WorkerChunk> chunks_from_boundaries(const WorkerBuffers& buffers,
+                                                const std::vector<size_t>& boundaries) {
+  std::vector<WorkerChunk> chunks;
+  for (size_t worker = 0; worker + 1 < boundaries.size(); ++worker) {
+    WorkerChunk chunk;
+    chunk.src = static_cast<char*>(buffers.src.get()) + boundaries[worker];
+    chunk.dst = static_cast<char*>(buffers.dst.get()) + boundaries[worker];
+    chunk.chain = static_cast<char*>(buffers.chain.get()) + boundaries[worker];
+    chunk.bytes = boundaries[worker + 1] - boundaries[worker];
+    chunks.push_back(chunk);
+  }
+  return chunks;
+}
+
+uint64_t run_chunk_operation(MultiProcessOperation operation,
+                             const WorkerChunk& chunk,
+                             size_t passes,
+                             const MemoryKernelSet& kernels) {
+  uint64_t checksum = 0;
+  switch (operation) {
+    case MultiProcessOperation::Read:
+      for (size_t pass = 0; pass < passes; ++pass) {
+        checksum ^= kernels.read(chunk.src, chunk.bytes);
+      }
+      break;
+    case MultiProcessOperation::Write:
+      for (size_t pass = 0; pass < passes; ++pass) {
+        kernels.write(chunk.dst, chunk.bytes);
+      }
+      break;
+    case MultiProcessOperation::Copy:
+      for (size_t pass = 0; pass < passes; ++pass) {
+        kernels.copy(chunk.dst, chunk.src, chunk.bytes);
+      }
+      break;
+    case MultiProcessOperation::Latency:
+      checksum = reinterpret_cast<uintptr_t>(memory_latency_chase_asm(
+          reinterpret_cast<uintptr_t*>(chunk.chain), Constants::MULTI_PROCESS_LATENCY_ACCESSES));
+      break;
+  }
+  return checksum;
+}
+
+size_t operation_passes(MultiProcessOperation operation, size_t passes) {
+  return operation == MultiProcessOperation::Latency ? 1 : passes;
+}
+
+bool run_thread_executor(const std::vector<WorkerChunk>& chunks,
+                         size_t passes,
+                         const MemoryKernelSet& kernels,
+                         HighResTimer& timer,
+                         OperationElapsed& out_elapsed) {
+  std::vector<uint64_t> worker_checksums(chunks.size(), 0);
+  for (size_t op = 0; op < MULTI_PROCESS_OPERATION_COUNT; ++op) {
+    const MultiProcessOperation operation = kOperations[op];
+    ParallelExecutionMetadata metadata;
+    out_elapsed[op] = run_parallel_test_per_worker(
+        chunks.size(), static_cast<int>(operation_passes(operation, passes)), timer,
+        [&chunks, &worker_checksums, &kernels, operation](size_t worker_index, int iterations) {
+          worker_checksums[worker_index] ^= run_chunk_operation(
+              operation, chunks[worker_index], static_cast<size_t>(iterations), kernels);
+        },
+        multi_process_operation_to_string(operation), &metadata);
+    if (metadata.worker_startup_failed || !benchmark_elapsed_is_valid(out_elapsed[op])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Body of one forked worker; the return value becomes its exit status.
+int run_process_worker(const ProcessWorkerContext& context, size_t worker_index) {
+  const kern_return_t qos_ret = pthread_set_qos_class_self_np(QOS_CLASS_USER_INTERACTIVE, 0);
+  if (qos_ret != KERN_SUCCESS) {
+    std::cerr << Messages::warning_prefix()
+              << Messages::warning_qos_failed_benchmark_worker("process", qos_ret) << std::endl;
+  }
+
+  WorkerBuffers private_buffers;
+  WorkerChunk chunk;
+  if (context.memory == MultiProcessMemory::Private) {
+    const std::vector<size_t>& boundaries = *context.boundaries;
+    const size_t bytes = boundaries[worker_index + 1] - boundaries[worker_index];
+    if (!allocate_worker_buffers(MultiProcessMemory::Private, bytes, private_buffers)) {
+      return EXIT_FAILURE;
+    }
+    chunk = chunks_from_boundaries(private_buffers, {0, bytes}).front();
+    if (!prepare_chunk(chunk, *context.kernels)) {
+      return EXIT_FAILURE;
+    }
+  } else {
+    chunk = (*context.shared_chunks)[worker_index];
+  }
+
+  ProcessWorkerSlot& slot = context.slots[worker_index];
+  HighResTimer timer = *context.timer;
+  for (size_t op = 0; op < MULTI_PROCESS_OPERATION_COUNT; ++op) {
+    ProcessGate& gate = context.control->gates[op];
+    gate.ready.fetch_add(1, std::memory_order_acq_rel);
+    while (!gate.go.load(std::memory_order_acquire)) {
+      if (context.control->abort.load(std::memory_order_relaxed)) {
+        return EXIT_FAILURE;
+      }
+      std::this_thread::yield();
+    }
+    timer.start_ticks = gate.start_ticks.load(std::memory_order_relaxed);
+    slot.checksum ^= run_chunk_operation(kOperations[op], chunk,
+                                         operation_passes(kOperations[op], context.passes),
+                                         *context.kernels);
+    slot.elapsed_seconds[op] = timer.stop();
+  }
+  return EXIT_SUCCESS;
+}
+
+// Non-blocking: true when some child has exited (successfully or not) before
+// the parent expected it to.
+bool poll_child_exit(ChildProcesses& children) {
+  bool exited = false;
+  for (size_t index = 0; index < children.pids.size(); ++index) {
+    int status = 0;
+    if (!children.reaped[index] && waitpid(children.pids[index], &status, WNOHANG) ==
+                                       children.pids[index]) {
+      children.reaped[index] = true;
+      children.failed = true;
+      exited = true;
+    }
+  }
+  return exited;
+}
+
+void reap_children(ChildProcesses& children) {
+  for (size_t index = 0; index < children.pids.size(); ++index) {
+    if (children.reaped[index]) {
+      continue;
+    }
+    int status = 0;
+    if (waitpid(children.pids[index], &status, 0) != children.pids[index] || !WIFEXITED(status) ||
+        WEXITSTATUS(status) != EXIT_SUCCESS) {
+      children.failed = true;
+    }
+    children.reaped[index] = true;
+  }
+}
+
+bool wait_for_gate(const ProcessGate& gate, size_t workers, ChildProcesses& children) {
+  while (gate.ready.load(std::memory_order_acquire) < workers) {
+    if (poll_child_exit(children)) {
+      return false;
+    }
+    std::this_thread::sleep_for(
+        std::chrono::microseconds(Constants::MULTI_PROCESS_CHILD_POLL_MICROSECONDS));
+  }
+  return true;
+}
+
+bool run_process_executor(const MultiProcessConfig& config,
+                          const std::vector<size_t>& boundaries,
+                          const std::vector<WorkerChunk>& shared_chunks,
+                          size_t passes,
+                          const MemoryKernelSet& kernels,
+                          HighResTimer& timer,
+                          OperationElapsed& out_elapsed) {
+  const size_t workers = boundaries.size() - 1;
+  MmapPtr area = allocate_shared_buffer(control_area_bytes(workers), "multi-process control");
+  if (!area) {
+    return false;
+  }
+  ProcessControl* control = new (area.get()) ProcessControl();
+  ProcessWorkerSlot* slots = control_area_slots(area.get());
+  for (size_t worker = 0; worker < workers; ++worker) {
+    new (&slots[worker]) ProcessWorkerSlot();
+  }
+
+  ProcessWorkerContext context;
+  context.memory = config.memory;
+  context.boundaries = &boundaries;
+  context.shared_chunks = &shared_chunks;
+  context.passes = passes;
+  context.kernels = &kernels;
+  context.timer = &timer;
+  context.control = control;
+  context.slots = slots;
+
+  std::cout.flush();
+  std::cerr.flush();
+  ChildProcesses children;
+  for (size_t worker = 0; worker < workers; ++worker) {
+    const pid_t pid = fork();
+    if (pid == 0) {
+      _exit(run_process_worker(context, worker));
+    }
+    if (pid < 0) {
+      children.failed = true;
+      break;
+    }
+    children.pids.push_back(pid);
+    children.reaped.push_back(false);
+  }
+
+  for (size_t op = 0; op < MULTI_PROCESS_OPERATION_COUNT && !children.failed; ++op) {
+    ProcessGate& gate = control->gates[op];
+    if (!wait_for_gate(gate, workers, children)) {
+      break;
+    }
+    timer.start();
+    gate.start_ticks.store(timer.start_ticks, std::memory_order_relaxed);
+    gate.go.store(true, std::memory_order_release);
+  }
+  if (children.failed) {
+    control->abort.store(true, std::memory_order_relaxed);
+  }
+  reap_children(children);
+  if (children.failed) {
+    return false;
+  }
+
+  for (size_t op = 0; op < MULTI_PROCESS_OPERATION_COUNT; ++op) {
+    out_elapsed[op] = 0.0;
+    for (size_t worker = 0; worker < workers; ++worker) {
+      out_elapsed[op] = std::max(out_elapsed[op], slots[worker].elapsed_seconds[op]);
+    }
+  }
+  return true;
+}
+
+double operation_value(MultiProcessOperation operation, size_t buffer_size, size_t passes,
+                       double elapsed) {
+  if (operation == MultiProcessOperation::Latency) {
+    return elapsed * Constants::NANOSECONDS_PER_SECOND /
+           static_cast<double>(Constants::MULTI_PROCESS_LATENCY_ACCESSES);
+  }
+  const double multiplier = operation == MultiProcessOperation::Copy
+                                ? static_cast<double>(Constants::COPY_OPERATION_MULTIPLIER)
+                                : 1.0;
+  return static_cast<double>(buffer_size) * static_cast<double>(passes) * multiplier / elapsed /
+         Constants::NANOSECONDS_PER_SECOND;
+}
+
+// Pass count for one worker count, calibrated on the thread executor's read.
+size_t calibrate_passes(const std::vector<WorkerChunk>& chunks, size_t buffer_size,
+                        const MemoryKernelSet& kernels, HighResTimer& timer) {
+  const size_t pilot_passes = calculate_benchmark_pilot_passes(
+      buffer_size, Constants::BENCHMARK_CALIBRATION_MIN_PILOT_BYTES,
+      Constants::BENCHMARK_CALIBRATION_MAX_PASSES);
+  const double pilot_elapsed = run_parallel_test_per_worker(
+      chunks.size(), static_cast<int>(pilot_passes), timer,
+      [&chunks, &kernels](size_t worker_index, int iterations) {
+        run_chunk_operation(MultiProcessOperation::Read, chunks[worker_index],
+                            static_cast<size_t>(iterations), kernels);
+      },
+      "read");
+  if (!benchmark_elapsed_is_valid(pilot_elapsed)) {
+    return 0;
+  }
+  return calculate_benchmark_calibrated_count(pilot_elapsed, pilot_passes,
+                                              Constants::BENCHMARK_CALIBRATION_TARGET_SECONDS, 1,
+                                              Constants::BENCHMARK_CALIBRATION_MAX_PASSES);
+}
+
+void print_multi_process_report(const MultiProcessConfig& config, const MultiProcessResult& result) {
+  std::cout << std::endl << Messages::report_multi_process_header() << std::endl;
+  std::cout << Messages::report_multi_process_note(multi_process_memory_to_string(config.memory))
+            << std::endl;
+  std::cout << Messages::report_multi_process_table_header() << std::endl;
+  for (const MultiProcessPoint& point : result.points) {
+    for (const MultiProcessOperationResult& operation : point.operations) {
+      std::cout << Messages::report_multi_process_row(
+                       point.workers, multi_process_operation_to_string(operation.operation),
+                       multi_process_operation_unit(operation.operation), operation.median[0],
+                       operation.median[1], operation.process_vs_thread_pct,
+                       operation.median[0] > 0.0 && operation.median[1] > 0.0)
+                << std::endl;
+    }
+  }
+}
+
+}  // namespace
+
+int run_multi_process(const MultiProcessConfig& config) {
+  print_runtime_banner();
+  std::cout << Messages::msg_running_multi_process(multi_process_memory_to_string(config.memory))
+            << std::endl;
+  const auto run_start = std::chrono::steady_clock::now();
+
+  const std::vector<int> worker_counts =
+      resolve_multi_process_worker_counts(config.worker_counts, get_total_logical_cores());
+  const size_t buffer_size = static_cast<size_t>(config.buffer_size_mb) * Constants::BYTES_PER_MB;
+  const MemoryKernelSet& kernels =
+      memory_kernel_set(MemoryKernelVariant::Neon);
+
+  WorkerBuffers thread_buffers;
+  WorkerBuffers shared_buffers;
+  if (!allocate_worker_buffers(MultiProcessMemory::Private, buffer_size, thread_buffers) ||
+      (config.memory == MultiProcessMemory::Shared &&
+       !allocate_worker_buffers(MultiProcessMemory::Shared, buffer_size, shared_buffers))) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_multi_process_failed("buffer allocation") << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  auto timer_optional = HighResTimer::create();
+  if (!timer_optional) {
+    std::cerr << Messages::error_prefix() << Messages::error_timer_creation_failed() << std::endl;
+    return EXIT_FAILURE;
+  }
+  HighResTimer& timer = *timer_optional;
+
+  MultiProcessResult result = make_multi_process_result(worker_counts);
+  for (MultiProcessPoint& point : result.points) {
+    const std::vector<size_t> boundaries =
+        build_aligned_chunk_boundaries(thread_buffers.src.get(), buffer_size, point.workers);
+    const std::vector<WorkerChunk> thread_chunks = chunks_from_boundaries(thread_buffers, boundaries);
+    std::vector<WorkerChunk> shared_chunks;
+    if (config.memory == MultiProcessMemory::Shared) {
+      shared_chunks = chunks_from_boundaries(shared_buffers, boundaries);
+    }
+    bool prepared = true;
+    for (const WorkerChunk& chunk : thread_chunks) {
+      prepared = prepared && chunk.bytes > 0 && prepare_chunk(chunk, kernels);
+    }
+    for (const WorkerChunk& chunk : shared_chunks) {
+      prepared = prepared && prepare_chunk(chunk, kernels);
+    }
+    point.passes = prepared ? calibrate_passes(thread_chunks, buffer_size, kernels, timer) : 0;
+    if (point.passes == 0) {
+      std::cerr << Messages::error_prefix()
+                << Messages::error_multi_process_failed("worker chunk setup or calibration")
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+    std::cout << Messages::msg_multi_process_point(point.workers, point.passes, config.rounds)
+              << std::endl;
+
+    for (int round = 0; round < config.rounds && !result.interrupted; ++round) {
+      for (size_t executor :
+           build_benchmark_cyclic_order(MULTI_PROCESS_EXECUTOR_COUNT, static_cast<size_t>(round))) {
+        OperationElapsed elapsed{};
+        const bool measured =
+            executor == static_cast<size_t>(MultiProcessExecutor::Processes)
+                ? run_process_executor(config, boundaries, shared_chunks, point.passes, kernels,
+                                       timer, elapsed)
+                : run_thread_executor(thread_chunks, point.passes, kernels, timer, elapsed);
+        if (signal_received()) {
+          result.interrupted = true;
+          std::cout << std::endl << Messages::msg_interrupted_by_user() << std::endl;
+          break;
+        }
+        if (!measured) {
+          std::cerr << Messages::error_prefix()
+                    << Messages::error_multi_process_failed(
+                           std::string(multi_process_executor_to_string(
+                               static_cast<MultiProcessExecutor>(executor))) +
+                           " executor")
+                    << std::endl;
+          return EXIT_FAILURE;
+        }
+        for (size_t op = 0; op < MULTI_PROCESS_OPERATION_COUNT; ++op) {
+          point.operations[op].samples[executor].push_back(
+              operation_value(kOperations[op], buffer_size, point.passes, elapsed[op]));
+        }
+      }
+    }
+    if (result.interrupted) {
+      break;
+    }
+  }
+
+  finalize_multi_process_result(result);
+  print_multi_process_report(config, result);
+
+  if (!config.output_file.empty()) {
+    const double total_execution_time_sec =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - run_start).count();
+    std::filesystem::path file_path(config.output_file);
+    if (file_path.is_relative()) {
+      file_path = std::filesystem::current_path() / file_path;
+    }
+    if (write_json_to_file(file_path, build_multi_process_json(config, result, get_processor_name(),
+                                                               total_execution_time_sec)) !=
+        EXIT_SUCCESS) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,252 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file noisy_neighbor.cpp
+ * @brief Option parsing helpers, reduction, and JSON for noisy-neighbor mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Everything here is measurement-free so it can be unit tested; aggressor
+ * threads and timed victims live in noisy_neighbor_runner.cpp.
+ */
+
+#include "benchmark/noisy_neighbor.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include "core/config/config.h"
+#include "utils/descriptive_statistics.h"
+
+namespace {
+
+struct TrafficName {
+  NoisyNeighborTraffic traffic;
+  const char* name;
+};
+
+constexpr TrafficName kTrafficNames[] = {
+    {NoisyNeighborTraffic::StreamingRead, "read"},
+    {NoisyNeighborTraffic::NonTemporalWrite, "nt-write"},
+    {NoisyNeighborTraffic::Random, "random"},
+    {NoisyNeighborTraffic::SharedAtomics, "atomic"},
+};
+
+constexpr NoisyNeighborVictim kVictims[NOISY_NEIGHBOR_VICTIM_COUNT] = {
+    NoisyNeighborVictim::Latency, NoisyNeighborVictim::Bandwidth, NoisyNeighborVictim::CoreToCore};
+
+double median_of(const std::vector<NoisyNeighborSample>& samples, double NoisyNeighborSample::*field) {
+  std::vector<double> values;
+  values.reserve(samples.size());
+  for (const NoisyNeighborSample& sample : samples) {
+    values.push_back(sample.*field);
+  }
+  return calculate_descriptive_statistics(values).median;
+}
+
+}  // namespace
+
+const char* noisy_neighbor_traffic_to_string(NoisyNeighborTraffic traffic) {
+  for (const TrafficName& entry : kTrafficNames) {
+    if (entry.traffic == traffic) {
+      return entry.name;
+    }
+  }
+  return "unknown";
+}
+
+bool parse_noisy_neighbor_traffic(const std::string& name, NoisyNeighborTraffic& out_traffic) {
+  for (const TrafficName& entry : kTrafficNames) {
+    if (name == entry.name) {
+      out_traffic = entry.traffic;
+      return true;
+    }
+  }
+  return false;
+}
+
+const char* noisy_neighbor_victim_to_string(NoisyNeighborVictim victim) {
+  switch (victim) {
+    case NoisyNeighborVictim::Latency:
+      return "latency";
+    case NoisyNeighborVictim::Bandwidth:
+      return "bandwidth";
+    case NoisyNeighborVictim::CoreToCore:
+      return "core_to_core";
+  }
+  return "unknown";
+}
+
+const char* noisy_neighbor_victim_unit(NoisyNeighborVictim victim) {
+  switch (victim) {
+    case NoisyNeighborVictim::Latency:
+      return "ns";
+    case NoisyNeighborVictim::Bandwidth:
+      return "GB/s";
+    case NoisyNeighborVictim::CoreToCore:
+      return "ns";
+  }
+  return "";
+}
+
+bool parse_noisy_neighbor_duty_cycles(const std::string& text, std::vector<int>& out_duty_cycles) {
+  std::vector<int> duty_cycles;
+  std::stringstream stream(text);
+  std::string token;
+  while (std::getline(stream, token, ',')) {
+    long long parsed = 0;
+    if (parse_strict_signed_decimal(token, parsed) != StrictIntegerParseStatus::Success ||
+        parsed < 1 || parsed > 100) {
+      return false;
+    }
+    const int duty = static_cast<int>(parsed);
+    if (std::find(duty_cycles.begin(), duty_cycles.end(), duty) != duty_cycles.end()) {
+      return false;
+    }
+    duty_cycles.push_back(duty);
+  }
+  // getline drops a trailing empty field, so "25," would otherwise pass.
+  if (duty_cycles.empty() || text.back() == ',') {
+    return false;
+  }
+  out_duty_cycles = std::move(duty_cycles);
+  return true;
+}
+
+double noisy_neighbor_busy_seconds(int duty_cycle_pct) {
+  return Constants::NOISY_NEIGHBOR_DUTY_PERIOD_SECONDS * static_cast<double>(duty_cycle_pct) / 100.0;
+}
+
+int resolve_noisy_neighbor_aggressor_threads(int requested, int logical_cores) {
+  const int available =
+      std::max(1, logical_cores - Constants::NOISY_NEIGHBOR_VICTIM_RESERVED_CORES);
+  return requested > 0 ? std::min(requested, available) : available;
+}
+
+double calculate_noisy_neighbor_slowdown(NoisyNeighborVictim victim,
+                                         double baseline_value,
+                                         double loaded_value) {
+  if (baseline_value <= 0.0 || loaded_value <= 0.0) {
+    return 0.0;
+  }
+  return victim == NoisyNeighborVictim::Bandwidth ? baseline_value / loaded_value
+                                                  : loaded_value / baseline_value;
+}
+
+NoisyNeighborResult make_noisy_neighbor_result(const NoisyNeighborConfig& config,
+                                               int aggressor_threads) {
+  NoisyNeighborResult result;
+  result.aggressor_threads = aggressor_threads;
+  std::vector<int> duty_levels{0};
+  duty_levels.insert(duty_levels.end(), config.duty_cycles_pct.begin(),
+                     config.duty_cycles_pct.end());
+  for (int duty : duty_levels) {
+    NoisyNeighborLevel level;
+    level.duty_cycle_pct = duty;
+    for (NoisyNeighborVictim victim : kVictims) {
+      NoisyNeighborVictimResult victim_result;
+      victim_result.victim = victim;
+      level.victims.push_back(std::move(victim_result));
+    }
+    result.levels.push_back(std::move(level));
+  }
+  return result;
+}
+
+void finalize_noisy_neighbor_result(NoisyNeighborResult& result) {
+  for (NoisyNeighborLevel& level : result.levels) {
+    for (NoisyNeighborVictimResult& victim : level.victims) {
+      victim.measured = !victim.samples.empty();
+      if (!victim.measured) {
+        continue;
+      }
+      victim.median_value = median_of(victim.samples, &NoisyNeighborSample::victim_value);
+      victim.median_aggressor_bandwidth_gb_s =
+          median_of(victim.samples, &NoisyNeighborSample::aggressor_bandwidth_gb_s);
+    }
+  }
+  if (result.levels.empty()) {
+    return;
+  }
+  const NoisyNeighborLevel& baseline = result.levels.front();
+  for (size_t level_index = 1; level_index < result.levels.size(); ++level_index) {
+    for (size_t victim_index = 0; victim_index < baseline.victims.size(); ++victim_index) {
+      const NoisyNeighborVictimResult& base = baseline.victims[victim_index];
+      NoisyNeighborVictimResult& loaded = result.levels[level_index].victims[victim_index];
+      loaded.slowdown = base.measured && loaded.measured
+                            ? calculate_noisy_neighbor_slowdown(loaded.victim, base.median_value,
+                                                                loaded.median_value)
+                            : 0.0;
+    }
+  }
+}
+
+nlohmann::ordered_json build_noisy_neighbor_json(const NoisyNeighborConfig& config,
+                                                 const NoisyNeighborResult& result,
+                                                 const std::string& cpu_name,
+                                                 double total_execution_time_sec) {
+  nlohmann::ordered_json result_json;
+  result_json["mode"] = Constants::NOISY_NEIGHBOR_JSON_MODE_NAME;
+  result_json["schema_version"] = Constants::NOISY_NEIGHBOR_JSON_SCHEMA_VERSION;
+  result_json["methodology_version"] = Constants::NOISY_NEIGHBOR_METHODOLOGY_VERSION;
+  result_json["status"] = result.interrupted ? "interrupted" : "complete";
+  result_json["cpu_name"] = cpu_name;
+
+  nlohmann::ordered_json configuration;
+  configuration["aggressor_threads"] = result.aggressor_threads;
+  configuration["requested_aggressor_threads"] = config.requested_aggressors;
+  configuration["aggressor_traffic"] = noisy_neighbor_traffic_to_string(config.traffic);
+  configuration["duty_cycles_pct"] = config.duty_cycles_pct;
+  configuration["duty_period_seconds"] = Constants::NOISY_NEIGHBOR_DUTY_PERIOD_SECONDS;
+  configuration["rounds"] = config.rounds;
+  configuration["buffer_size_mb"] = config.buffer_size_mb;
+  configuration["settle_seconds"] = Constants::NOISY_NEIGHBOR_SETTLE_SECONDS;
+  configuration["victim_target_seconds"] = Constants::NOISY_NEIGHBOR_VICTIM_TARGET_SECONDS;
+  result_json["configuration"] = std::move(configuration);
+
+  nlohmann::ordered_json levels = nlohmann::ordered_json::array();
+  for (const NoisyNeighborLevel& level : result.levels) {
+    nlohmann::ordered_json level_json;
+    level_json["duty_cycle_pct"] = level.duty_cycle_pct;
+    level_json["baseline"] = level.duty_cycle_pct == 0;
+    nlohmann::ordered_json victims = nlohmann::ordered_json::object();
+    for (const NoisyNeighborVictimResult& victim : level.victims) {
+      nlohmann::ordered_json victim_json;
+      victim_json["measured"] = victim.measured;
+      victim_json["unit"] = noisy_neighbor_victim_unit(victim.victim);
+      victim_json["median_value"] = victim.median_value;
+      if (level.duty_cycle_pct == 0 || victim.slowdown <= 0.0) {
+        victim_json["slowdown"] = nullptr;
+      } else {
+        victim_json["slowdown"] = victim.slowdown;
+      }
+      victim_json["median_aggressor_bandwidth_gb_s"] = victim.median_aggressor_bandwidth_gb_s;
+      nlohmann::ordered_json rounds = nlohmann::ordered_json::array();
+      for (const NoisyNeighborSample& sample : victim.samples) {
+        rounds.push_back({{"value", sample.victim_value},
+                          {"aggressor_bandwidth_gb_s", sample.aggressor_bandwidth_gb_s}});
+      }
+      victim_json["rounds"] = std::move(rounds);
+      victims[noisy_neighbor_victim_to_string(victim.victim)] = std::move(victim_json);
+    }
+    level_json["victims"] = std::move(victims);
+    levels.push_back(std::move(level_json));
+  }
+  result_json["levels"] = std::move(levels);
+  result_json["total_execution_time_sec"] = total_execution_time_sec;
+  return result_json;
+}
@@ -0,0 +1,154 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file noisy_neighbor.h
+ * @brief Standalone noisy-neighbor interference mode interfaces
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * `-N, --noisy-neighbor` runs latency-sensitive victim measurements (main-memory
+ * pointer chase, single-thread read bandwidth, and core-to-core token handoff)
+ * while duty-cycled aggressor threads generate one traffic type on the other
+ * cores. Aggressor bandwidth is measured over each victim run, so every
+ * victim slowdown is reported against the traffic that caused it.
+ */
+
+#ifndef NOISY_NEIGHBOR_H
+#define NOISY_NEIGHBOR_H
+
+#include <string>
+#include <vector>
+
+#include "core/config/constants.h"
+#include "third_party/nlohmann/json.hpp"
+
+enum class NoisyNeighborTraffic {
+  StreamingRead,     ///< Sequential reads with the host main-memory read kernel
+  NonTemporalWrite,  ///< Sequential `stnp` stores from the generated kernel matrix
+  Random,            ///< 32-byte random reads over per-aggressor pattern indices
+  SharedAtomics,     ///< Relaxed fetch-add on a few cache lines shared by all aggressors
+};
+
+enum class NoisyNeighborVictim {
+  Latency,     ///< Main-memory pointer chase, ns per access
+  Bandwidth,   ///< Single-thread main-memory read, GB/s
+  CoreToCore,  ///< Two-thread token handoff, ns per round trip
+};
+
+constexpr size_t NOISY_NEIGHBOR_VICTIM_COUNT = 3;
+
+struct NoisyNeighborConfig {
+  int requested_aggressors = 0;  ///< 0 uses every logical core not reserved for victims
+  NoisyNeighborTraffic traffic = NoisyNeighborTraffic::StreamingRead;
+  std::vector<int> duty_cycles_pct = {25, 50, 100};
+  int rounds = Constants::NOISY_NEIGHBOR_DEFAULT_ROUNDS;
+  unsigned long buffer_size_mb = Constants::NOISY_NEIGHBOR_DEFAULT_BUFFER_SIZE_MB;
+  std::string output_file;
+  bool help_requested = false;
+};
+
+/** @brief One victim run and the aggressor bandwidth measured over it. */
+struct NoisyNeighborSample {
+  double victim_value = 0.0;
+  double aggressor_bandwidth_gb_s = 0.0;
+};
+
+struct NoisyNeighborVictimResult {
+  NoisyNeighborVictim victim = NoisyNeighborVictim::Latency;
+  std::vector<NoisyNeighborSample> samples;  ///< One per round
+  bool measured = false;
+  double median_value = 0.0;
+  double median_aggressor_bandwidth_gb_s = 0.0;
+  double slowdown = 0.0;  ///< Loaded vs. baseline time per operation; 0.0 when unavailable
+};
+
+/** @brief All victims at one aggressor duty cycle; 0% is the unloaded baseline. */
+struct NoisyNeighborLevel {
+  int duty_cycle_pct = 0;
+  std::vector<NoisyNeighborVictimResult> victims;  ///< Indexed by NoisyNeighborVictim
+};
+
+struct NoisyNeighborResult {
+  int aggressor_threads = 0;
+  std::vector<NoisyNeighborLevel> levels;  ///< levels[0] is the baseline
+  bool interrupted = false;
+};
+
+const char* noisy_neighbor_traffic_to_string(NoisyNeighborTraffic traffic);
+bool parse_noisy_neighbor_traffic(const std::string& name, NoisyNeighborTraffic& out_traffic);
+const char* noisy_neighbor_victim_to_string(NoisyNeighborVictim victim);
+const char* noisy_neighbor_victim_unit(NoisyNeighborVictim victim);
+
+/**
+ * @brief Parse a comma-separated duty-cycle list such as "25,50,100".
+ *
+ * Every entry must be a distinct integer from 1 to 100; order is preserved.
+ */
+bool parse_noisy_neighbor_duty_cycles(const std::string& text, std::vector<int>& out_duty_cycles);
+
+/** @brief Busy time inside one duty period for `duty_cycle_pct`. */
+double noisy_neighbor_busy_seconds(int duty_cycle_pct);
+
+/**
+ * @brief Aggressor thread count after reserving cores for the victims.
+ *
+ * macOS cannot pin threads, so aggressors are capped to leave
+ * NOISY_NEIGHBOR_VICTIM_RESERVED_CORES logical cores for victim threads.
+ */
+int resolve_noisy_neighbor_aggressor_threads(int requested, int logical_cores);
+
+/**
+ * @brief Slowdown of a loaded victim relative to its baseline.
+ *
+ * Expressed as time per operation, so values above 1.0 are always worse:
+ * loaded/baseline for latencies and baseline/loaded for bandwidth.
+ * @return 0.0 when either value is not positive.
+ */
+double calculate_noisy_neighbor_slowdown(NoisyNeighborVictim victim,
+                                         double baseline_value,
+                                         double loaded_value);
+
+/** @brief Baseline level plus one level per configured duty cycle, no samples. */
+NoisyNeighborResult make_noisy_neighbor_result(const NoisyNeighborConfig& config,
+                                               int aggressor_threads);
+
+/** @brief Reduce samples to medians and compute slowdowns against levels[0]. */
+void finalize_noisy_neighbor_result(NoisyNeighborResult& result);
+
+nlohmann::ordered_json build_noisy_neighbor_json(const NoisyNeighborConfig& config,
+                                                 const NoisyNeighborResult& result,
+                                                 const std::string& cpu_name,
+                                                 double total_execution_time_sec);
+
+/**
+ * @brief Parse CLI args for standalone noisy-neighbor mode.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on parse/validation error.
+ */
+int parse_noisy_neighbor_mode_arguments(int argc, char* argv[], NoisyNeighborConfig& config);
+
+/**
+ * @brief Calibrate victims, run every duty level, report, and save JSON.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on runtime/IO error.
+ */
+int run_noisy_neighbor(const NoisyNeighborConfig& config);
+
+/**
+ * @brief Parse and run standalone noisy-neighbor mode from main().
+ */
+int run_noisy_neighbor_mode(int argc, char* argv[]);
+
+#endif  // NOISY_NEIGHBOR_H
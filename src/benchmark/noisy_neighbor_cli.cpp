@@ -0,0 +1,182 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file noisy_neighbor_cli.cpp
+ * @brief CLI parsing for standalone noisy-neighbor mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Parses and validates mode-specific command line options for
+ * `-N, --noisy-neighbor`. Like the other standalone modes, only an explicit
+ * option set is accepted.
+ */
+
+#include "benchmark/noisy_neighbor.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+
+#include "core/config/cli_options.h"
+#include "core/config/config.h"
+#include "core/config/constants.h"
+#include "core/signal/signal_handler.h"
+#include "output/console/messages/messages_api.h"
+#include "output/console/output_printer.h"
+
+namespace {
+
+constexpr const char* OPT_NOISY_NEIGHBOR_SHORT = "-N";
+constexpr const char* OPT_NOISY_NEIGHBOR_LONG = "--noisy-neighbor";
+constexpr const char* OPT_AGGRESSORS_LONG = "--aggressors";
+constexpr const char* OPT_AGGRESSOR_TRAFFIC_LONG = "--aggressor-traffic";
+constexpr const char* OPT_DUTY_CYCLE_LONG = "--duty-cycle";
+constexpr const char* OPT_BUFFER_SIZE_SHORT = "-b";
+constexpr const char* OPT_BUFFER_SIZE_LONG = "--buffer-size";
+constexpr const char* OPT_COUNT_SHORT = "-r";
+constexpr const char* OPT_COUNT_LONG = "--count";
+constexpr const char* OPT_HELP_SHORT = "-h";
+constexpr const char* OPT_HELP_LONG = "--help";
+constexpr const char* OPT_OUTPUT_SHORT = "-o";
+constexpr const char* OPT_OUTPUT_LONG = "--output";
+
+}  // namespace
+
+int parse_noisy_neighbor_mode_arguments(int argc, char* argv[], NoisyNeighborConfig& config) {
+  config.rounds = Constants::NOISY_NEIGHBOR_DEFAULT_ROUNDS;
+  config.buffer_size_mb = Constants::NOISY_NEIGHBOR_DEFAULT_BUFFER_SIZE_MB;
+
+  bool mode_seen = false;
+  bool output_seen = false;
+  bool buffer_size_seen = false;
+  bool count_seen = false;
+  bool aggressors_seen = false;
+  bool traffic_seen = false;
+  bool duty_seen = false;
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+
+    if (is_option(arg, OPT_NOISY_NEIGHBOR_SHORT, OPT_NOISY_NEIGHBOR_LONG)) {
+      mode_seen = true;
+      continue;
+    }
+
+    if (is_option(arg, OPT_HELP_SHORT, OPT_HELP_LONG)) {
+      print_help(argv[0]);
+      config.help_requested = true;
+      return EXIT_SUCCESS;
+    }
+
+    if (is_option(arg, OPT_OUTPUT_SHORT, OPT_OUTPUT_LONG)) {
+      if (!take_option_value(argc, argv, i, output_seen, OPT_OUTPUT_LONG)) {
+        return EXIT_FAILURE;
+      }
+      config.output_file = argv[i];
+      continue;
+    }
+
+    if (is_option(arg, OPT_BUFFER_SIZE_SHORT, OPT_BUFFER_SIZE_LONG)) {
+      if (!take_option_value(argc, argv, i, buffer_size_seen, OPT_BUFFER_SIZE_LONG)) {
+        return EXIT_FAILURE;
+      }
+      int parsed = 0;
+      if (!parse_positive_int_option(OPT_BUFFER_SIZE_LONG, argv[i], parsed, argv[0])) {
+        return EXIT_FAILURE;
+      }
+      config.buffer_size_mb = static_cast<unsigned long>(parsed);
+      continue;
+    }
+
+    if (is_option(arg, OPT_COUNT_SHORT, OPT_COUNT_LONG)) {
+      if (!take_option_value(argc, argv, i, count_seen, OPT_COUNT_LONG)) {
+        return EXIT_FAILURE;
+      }
+      if (!parse_positive_int_option(OPT_COUNT_LONG, argv[i], config.rounds, argv[0])) {
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (arg == OPT_AGGRESSORS_LONG) {
+      if (!take_option_value(argc, argv, i, aggressors_seen, OPT_AGGRESSORS_LONG)) {
+        return EXIT_FAILURE;
+      }
+      if (!parse_positive_int_option(OPT_AGGRESSORS_LONG, argv[i], config.requested_aggressors,
+                                     argv[0])) {
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (arg == OPT_AGGRESSOR_TRAFFIC_LONG) {
+      if (!take_option_value(argc, argv, i, traffic_seen, OPT_AGGRESSOR_TRAFFIC_LONG)) {
+        return EXIT_FAILURE;
+      }
+      if (!parse_noisy_neighbor_traffic(argv[i], config.traffic)) {
+        std::cerr << Messages::error_prefix()
+                  << Messages::error_noisy_neighbor_traffic_invalid(argv[i]) << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (arg == OPT_DUTY_CYCLE_LONG) {
+      if (!take_option_value(argc, argv, i, duty_seen, OPT_DUTY_CYCLE_LONG)) {
+        return EXIT_FAILURE;
+      }
+      if (!parse_noisy_neighbor_duty_cycles(argv[i], config.duty_cycles_pct)) {
+        std::cerr << Messages::error_prefix()
+                  << Messages::error_noisy_neighbor_duty_cycles_invalid(argv[i]) << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    std::cerr << Messages::error_prefix()
+              << Messages::error_noisy_neighbor_must_be_used_alone()
+              << std::endl;
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  if (!mode_seen) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_noisy_neighbor_must_be_used_alone()
+              << std::endl;
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+int run_noisy_neighbor_mode(int argc, char* argv[]) {
+  NoisyNeighborConfig config;
+  if (parse_noisy_neighbor_mode_arguments(argc, argv, config) != EXIT_SUCCESS) {
+    return EXIT_FAILURE;
+  }
+  if (config.help_requested) {
+    return EXIT_SUCCESS;
+  }
+
+  BenchmarkSignalMaskGuard signal_guard;
+  return run_noisy_neighbor(config);
+}
@@ -0,0 +1,505 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file noisy_neighbor_runner.cpp
+ * @brief Aggressor threads and timed victims for standalone noisy-neighbor mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Victim plans are calibrated once without aggressors and then reused at every
+ * duty level, so a slowdown reflects interference rather than a different
+ * amount of work. Aggressors partition their buffer with the parallel
+ * framework's aligned chunk boundaries and drive the same main-memory and
+ * pattern kernels as the bandwidth benchmarks. Level and victim order rotate
+ * every round to spread thermal drift across levels.
+ */
+
+#include "benchmark/noisy_neighbor.h"
+
+#include <pthread/qos.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "benchmark/bandwidth_timeline.h"
+#include "benchmark/benchmark_tests.h"
+#include "benchmark/benchmark_work_plan.h"
+#include "benchmark/core_to_core_latency_internal.h"
+#include "benchmark/memory_kernels.h"
+#include "benchmark/parallel_test_framework.h"
+#include "core/config/constants.h"
+#include "core/memory/memory_manager.h"
+#include "core/memory/memory_utils.h"
+#include "core/signal/signal_handler.h"
+#include "core/system/system_info.h"
+#include "core/timing/timer.h"
+#include "output/console/messages/messages_api.h"
+#include "output/console/output_printer.h"
+#include "output/json/json_output/json_output_api.h"
+#include "pattern_benchmark/pattern_work_plan.h"
+
+namespace {
+
+struct alignas(Constants::NOISY_NEIGHBOR_ATOMIC_LINE_BYTES) SharedAtomicLine {
+  std::atomic<uint64_t> value{0};
+};
+
+// Everything an aggressor touches, prepared before any aggressor starts.
+struct AggressorWorkload {
+  NoisyNeighborTraffic traffic = NoisyNeighborTraffic::StreamingRead;
+  char* buffer = nullptr;
+  std::vector<size_t> boundaries;
+  std::vector<std::vector<size_t>> random_indices;  ///< Chunk-relative, one list per aggressor
+  std::unique_ptr<SharedAtomicLine[]> atomic_lines;
+  uint64_t (*read)(const void*, size_t) = nullptr;
+  uint64_t (*read_random)(const void*, const size_t*, size_t) = nullptr;
+  void (*nt_write)(void*, size_t) = nullptr;
+};
+
+struct AggressorCursor {
+  size_t position = 0;
+  uint64_t checksum = 0;
+};
+
+struct AggressorPool {
+  std::vector<std::thread> threads;
+  std::unique_ptr<BandwidthProgressSlot[]> progress;
+  size_t thread_count = 0;
+  std::atomic<bool> stop{false};
+  std::atomic<size_t> ready{0};
+};
+
+struct VictimPlans {
+  char* buffer = nullptr;
+  size_t latency_accesses = 0;
+  bool bandwidth_ready = false;
+  BenchmarkWorkPlan bandwidth_plan;
+  uint64_t (*read)(const void*, size_t) = nullptr;
+  bool core_to_core_ready = false;
+  CoreToCoreWorkPlan core_to_core_plan;
+};
+
+const ScenarioDescriptor kCoreToCoreScenario{Constants::CORE_TO_CORE_SCENARIO_NO_AFFINITY,
+                                             Constants::CORE_TO_CORE_AFFINITY_HINT_DISABLED,
+                                             Constants::CORE_TO_CORE_AFFINITY_TAG_NONE,
+                                             Constants::CORE_TO_CORE_AFFINITY_TAG_NONE};
+
+// One unit of aggressor work between duty-cycle and stop checks. Returns the
+// payload bytes it moved; an atomic RMW counts as its 8-byte operand.
+uint64_t run_aggressor_burst(const AggressorWorkload& workload,
+                             size_t worker_index,
+                             AggressorCursor& cursor) {
+  char* chunk = workload.buffer + workload.boundaries[worker_index];
+  const size_t chunk_size =
+      workload.boundaries[worker_index + 1] - workload.boundaries[worker_index];
+  switch (workload.traffic) {
+    case NoisyNeighborTraffic::StreamingRead:
+    case NoisyNeighborTraffic::NonTemporalWrite: {
+      const size_t bytes = std::min(Constants::NOISY_NEIGHBOR_BURST_BYTES, chunk_size);
+      if (cursor.position + bytes > chunk_size) {
+        cursor.position = 0;
+      }
+      if (workload.traffic == NoisyNeighborTraffic::StreamingRead) {
+        cursor.checksum ^= workload.read(chunk + cursor.position, bytes);
+      } else {
+        workload.nt_write(chunk + cursor.position, bytes);
+      }
+      cursor.position += bytes;
+      return bytes;
+    }
+    case NoisyNeighborTraffic::Random: {
+      const std::vector<size_t>& indices = workload.random_indices[worker_index];
+      const size_t accesses = std::min(
+          Constants::NOISY_NEIGHBOR_BURST_BYTES / Constants::PATTERN_ACCESS_SIZE_BYTES,
+          indices.size());
+      if (cursor.position + accesses > indices.size()) {
+        cursor.position = 0;
+      }
+      cursor.checksum ^= workload.read_random(chunk, indices.data() + cursor.position, accesses);
+      cursor.position += accesses;
+      return accesses * Constants::PATTERN_ACCESS_SIZE_BYTES;
+    }
+    case NoisyNeighborTraffic::SharedAtomics: {
+      for (size_t op = 0; op < Constants::NOISY_NEIGHBOR_ATOMIC_OPS_PER_BURST; ++op) {
+        workload.atomic_lines[(worker_index + op) % Constants::NOISY_NEIGHBOR_ATOMIC_SHARED_LINES]
+            .value.fetch_add(1, std::memory_order_relaxed);
+      }
+      return Constants::NOISY_NEIGHBOR_ATOMIC_OPS_PER_BURST * sizeof(uint64_t);
+    }
+  }
+  return 0;
+}
+
+// Each duty period is a busy phase of whole bursts followed by an idle spin;
+// a burst that overruns the period starts the next period immediately.
+void run_aggressor(const AggressorWorkload& workload,
+                   size_t worker_index,
+                   int duty_cycle_pct,
+                   HighResTimer clock,
+                   AggressorPool& pool) {
+  kern_return_t qos_ret = pthread_set_qos_class_self_np(QOS_CLASS_USER_INTERACTIVE, 0);
+  if (qos_ret != KERN_SUCCESS) {
+    std::cerr << Messages::warning_prefix()
+              << Messages::warning_qos_failed_benchmark_worker("noisy-neighbor aggressor", qos_ret)
+              << std::endl;
+  }
+  pool.ready.fetch_add(1, std::memory_order_release);
+
+  const double busy_seconds = noisy_neighbor_busy_seconds(duty_cycle_pct);
+  AggressorCursor cursor;
+  uint64_t completed_bytes = 0;
+  clock.start();
+  double period_start = 0.0;
+  while (!pool.stop.load(std::memory_order_acquire)) {
+    double now = 0.0;
+    do {
+      completed_bytes += run_aggressor_burst(workload, worker_index, cursor);
+      pool.progress[worker_index].completed_bytes.store(completed_bytes,
+                                                        std::memory_order_relaxed);
+      now = clock.stop();
+    } while (now - period_start < busy_seconds && !pool.stop.load(std::memory_order_relaxed));
+    while (now - period_start < Constants::NOISY_NEIGHBOR_DUTY_PERIOD_SECONDS &&
+           !pool.stop.load(std::memory_order_relaxed)) {
+      now = clock.stop();
+    }
+    period_start = now;
+  }
+  // Keep read checksums observable so the loads cannot be elided.
+  asm volatile("" : : "r"(cursor.checksum) : "memory");
+}
+
+void stop_aggressors(AggressorPool& pool) {
+  pool.stop.store(true, std::memory_order_release);
+  for (std::thread& thread : pool.threads) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+  pool.threads.clear();
+}
+
+// Starts every aggressor and waits until all have passed QoS setup.
+bool start_aggressors(const AggressorWorkload& workload,
+                      int duty_cycle_pct,
+                      const HighResTimer& timer,
+                      AggressorPool& pool) {
+  pool.thread_count = workload.boundaries.size() - 1;
+  pool.progress = std::make_unique<BandwidthProgressSlot[]>(pool.thread_count);
+  try {
+    for (size_t worker_index = 0; worker_index < pool.thread_count; ++worker_index) {
+      pool.threads.emplace_back(run_aggressor, std::cref(workload), worker_index, duty_cycle_pct,
+                                timer, std::ref(pool));
+    }
+  } catch (const std::system_error&) {
+    stop_aggressors(pool);
+    return false;
+  }
+  while (pool.ready.load(std::memory_order_acquire) < pool.thread_count) {
+    std::this_thread::yield();
+  }
+  return true;
+}
+
+uint64_t total_aggressor_bytes(const AggressorPool& pool) {
+  uint64_t total = 0;
+  for (size_t worker_index = 0; worker_index < pool.thread_count; ++worker_index) {
+    total += pool.progress[worker_index].completed_bytes.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+bool prepare_aggressor_workload(const NoisyNeighborConfig& config,
+                                char* buffer,
+                                size_t buffer_size,
+                                int aggressor_threads,
+                                AggressorWorkload& workload) {
+  const MemoryKernelSet& kernels = memory_kernel_set(MemoryKernelVariant::Neon);
+  workload.traffic = config.traffic;
+  workload.buffer = buffer;
+  workload.boundaries = build_aligned_chunk_boundaries(buffer, buffer_size, aggressor_threads);
+  workload.read = kernels.read;
+  workload.read_random = kernels.read_random;
+  workload.atomic_lines =
+      std::make_unique<SharedAtomicLine[]>(Constants::NOISY_NEIGHBOR_ATOMIC_SHARED_LINES);
+
+  if (config.traffic == NoisyNeighborTraffic::NonTemporalWrite) {
+    const MemoryKernelSet* nt_kernels =
+        find_memory_kernel_set(Constants::NOISY_NEIGHBOR_NT_WRITE_KERNEL);
+    if (nt_kernels == nullptr) {
+      return false;
+    }
+    workload.nt_write = nt_kernels->write;
+  }
+
+  if (config.traffic == NoisyNeighborTraffic::Random) {
+    for (size_t worker_index = 0; worker_index + 1 < workload.boundaries.size(); ++worker_index) {
+      const size_t chunk_size =
+          workload.boundaries[worker_index + 1] - workload.boundaries[worker_index];
+      std::vector<size_t> indices =
+          generate_random_indices(chunk_size, Constants::PATTERN_RANDOM_ACCESS_MAX,
+                                  Constants::NOISY_NEIGHBOR_RANDOM_SEED + worker_index);
+      if (indices.empty()) {
+        return false;
+      }
+      workload.random_indices.push_back(std::move(indices));
+    }
+  }
+  return true;
+}
+
+// Sizes every victim to the target duration on an idle system. A victim that
+// cannot be calibrated is reported as not measured at every level.
+void calibrate_victims(size_t buffer_size, HighResTimer& timer, VictimPlans& plans) {
+  if (setup_latency_chain(plans.buffer, buffer_size, Constants::LATENCY_STRIDE_BYTES) ==
+      EXIT_SUCCESS) {
+    run_latency_test(plans.buffer, Constants::NOISY_NEIGHBOR_LATENCY_PILOT_ACCESSES, timer);
+    const double pilot_ns =
+        run_latency_test(plans.buffer, Constants::NOISY_NEIGHBOR_LATENCY_PILOT_ACCESSES, timer);
+    const double pilot_seconds = pilot_ns *
+                                 static_cast<double>(Constants::NOISY_NEIGHBOR_LATENCY_PILOT_ACCESSES) /
+                                 Constants::NANOSECONDS_PER_SECOND;
+    plans.latency_accesses = calculate_benchmark_calibrated_count(
+        pilot_seconds, Constants::NOISY_NEIGHBOR_LATENCY_PILOT_ACCESSES,
+        Constants::NOISY_NEIGHBOR_VICTIM_TARGET_SECONDS,
+        Constants::NOISY_NEIGHBOR_LATENCY_PILOT_ACCESSES,
+        Constants::NOISY_NEIGHBOR_LATENCY_MAX_ACCESSES);
+  }
+
+  const size_t pilot_passes = calculate_benchmark_pilot_passes(
+      buffer_size, Constants::BENCHMARK_CALIBRATION_MIN_PILOT_BYTES,
+      Constants::BENCHMARK_CALIBRATION_MAX_PASSES);
+  plans.bandwidth_plan = build_benchmark_bandwidth_work_plan(
+      buffer_size, Constants::SINGLE_THREAD, pilot_passes, BenchmarkTarget::MainMemory,
+      BenchmarkOperation::Read);
+  if (plans.bandwidth_plan.status == BenchmarkMeasurementStatus::Measured) {
+    uint64_t checksum = 0;
+    run_read_test_with_plan(plans.buffer, plans.bandwidth_plan, checksum, timer, plans.read);
+    const double pilot_elapsed =
+        run_read_test_with_plan(plans.buffer, plans.bandwidth_plan, checksum, timer, plans.read);
+    const size_t calibrated_passes = calculate_benchmark_calibrated_count(
+        pilot_elapsed, plans.bandwidth_plan.passes, Constants::NOISY_NEIGHBOR_VICTIM_TARGET_SECONDS,
+        1, Constants::BENCHMARK_CALIBRATION_MAX_PASSES);
+    plans.bandwidth_ready =
+        calibrated_passes > 0 && set_benchmark_work_plan_passes(plans.bandwidth_plan, calibrated_passes);
+  }
+
+  ScenarioMeasurement pilot;
+  plans.core_to_core_ready =
+      execute_single_scenario(kCoreToCoreScenario, build_core_to_core_calibration_pilot_plan(), 0,
+                              pilot) &&
+      build_core_to_core_work_plan(pilot.headline_elapsed_seconds, plans.core_to_core_plan);
+}
+
+// Returns false when the victim has no calibrated plan or its run failed.
+bool run_victim(NoisyNeighborVictim victim,
+                const VictimPlans& plans,
+                HighResTimer& timer,
+                double& out_value) {
+  switch (victim) {
+    case NoisyNeighborVictim::Latency:
+      if (plans.latency_accesses == 0) {
+        return false;
+      }
+      out_value = run_latency_test(plans.buffer, plans.latency_accesses, timer);
+      return out_value > 0.0;
+    case NoisyNeighborVictim::Bandwidth: {
+      if (!plans.bandwidth_ready) {
+        return false;
+      }
+      uint64_t checksum = 0;
+      const double elapsed =
+          run_read_test_with_plan(plans.buffer, plans.bandwidth_plan, checksum, timer, plans.read);
+      if (!benchmark_elapsed_is_valid(elapsed)) {
+        return false;
+      }
+      out_value = static_cast<double>(plans.bandwidth_plan.total_payload_bytes) / elapsed /
+                  Constants::NANOSECONDS_PER_SECOND;
+      return true;
+    }
+    case NoisyNeighborVictim::CoreToCore: {
+      if (!plans.core_to_core_ready) {
+        return false;
+      }
+      ScenarioMeasurement measurement;
+      if (!execute_single_scenario(kCoreToCoreScenario, plans.core_to_core_plan, 0, measurement) ||
+          measurement.status != CoreToCoreMeasurementStatus::Measured) {
+        return false;
+      }
+      out_value = measurement.round_trip_ns;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Runs every victim once at one level. Returns false when interrupted or when
+// the aggressors could not be started.
+bool run_level(NoisyNeighborLevel& level,
+               size_t round,
+               const AggressorWorkload& workload,
+               const VictimPlans& plans,
+               HighResTimer& timer,
+               bool& out_start_failed) {
+  AggressorPool pool;
+  HighResTimer wall = timer;
+  if (level.duty_cycle_pct > 0) {
+    if (!start_aggressors(workload, level.duty_cycle_pct, timer, pool)) {
+      out_start_failed = true;
+      return false;
+    }
+    std::this_thread::sleep_for(
+        std::chrono::duration<double>(Constants::NOISY_NEIGHBOR_SETTLE_SECONDS));
+  }
+  wall.start();
+
+  bool interrupted = false;
+  for (size_t victim_index : build_benchmark_cyclic_order(level.victims.size(), round)) {
+    NoisyNeighborVictimResult& victim = level.victims[victim_index];
+    const uint64_t bytes_before = total_aggressor_bytes(pool);
+    const double seconds_before = wall.stop();
+    NoisyNeighborSample sample;
+    const bool measured = run_victim(victim.victim, plans, timer, sample.victim_value);
+    const double seconds = wall.stop() - seconds_before;
+    const uint64_t bytes = total_aggressor_bytes(pool) - bytes_before;
+    if (signal_received()) {
+      interrupted = true;
+      break;
+    }
+    if (measured) {
+      sample.aggressor_bandwidth_gb_s =
+          seconds > 0.0 ? static_cast<double>(bytes) / seconds / Constants::NANOSECONDS_PER_SECOND
+                        : 0.0;
+      victim.samples.push_back(sample);
+    }
+  }
+  stop_aggressors(pool);
+  return !interrupted;
+}
+
+void print_noisy_neighbor_report(const NoisyNeighborResult& result) {
+  std::cout << std::endl << Messages::report_noisy_neighbor_header() << std::endl;
+  std::cout << Messages::report_noisy_neighbor_slowdown_note() << std::endl;
+  for (const NoisyNeighborLevel& level : result.levels) {
+    std::cout << Messages::report_noisy_neighbor_level(level.duty_cycle_pct) << std::endl;
+    for (const NoisyNeighborVictimResult& victim : level.victims) {
+      const std::string name = noisy_neighbor_victim_to_string(victim.victim);
+      if (!victim.measured) {
+        std::cout << Messages::report_noisy_neighbor_unmeasured(name) << std::endl;
+        continue;
+      }
+      std::cout << Messages::report_noisy_neighbor_victim(
+                       name, victim.median_value, noisy_neighbor_victim_unit(victim.victim),
+                       victim.slowdown, victim.median_aggressor_bandwidth_gb_s)
+                << std::endl;
+    }
+  }
+}
+
+}  // namespace
+
+int run_noisy_neighbor(const NoisyNeighborConfig& config) {
+  print_runtime_banner();
+  std::cout << Messages::msg_running_noisy_neighbor() << std::endl;
+  const auto run_start = std::chrono::steady_clock::now();
+
+  const int aggressor_threads =
+      resolve_noisy_neighbor_aggressor_threads(config.requested_aggressors, get_total_logical_cores());
+  const size_t buffer_size = config.buffer_size_mb * Constants::BYTES_PER_MB;
+  MmapPtr victim_buffer = allocate_buffer(buffer_size, "noisy-neighbor victim");
+  MmapPtr aggressor_buffer = allocate_buffer(buffer_size, "noisy-neighbor aggressor");
+  if (!victim_buffer || !aggressor_buffer ||
+      initialize_buffers(aggressor_buffer.get(), victim_buffer.get(), buffer_size) != EXIT_SUCCESS) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_noisy_neighbor_failed("buffer allocation or initialization")
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  auto timer_optional = HighResTimer::create();
+  if (!timer_optional) {
+    std::cerr << Messages::error_prefix() << Messages::error_timer_creation_failed() << std::endl;
+    return EXIT_FAILURE;
+  }
+  HighResTimer& timer = *timer_optional;
+
+  AggressorWorkload workload;
+  if (!prepare_aggressor_workload(config, static_cast<char*>(aggressor_buffer.get()), buffer_size,
+                                  aggressor_threads, workload)) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_noisy_neighbor_failed("aggressor workload preparation")
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  VictimPlans plans;
+  plans.buffer = static_cast<char*>(victim_buffer.get());
+  plans.read = workload.read;
+  calibrate_victims(buffer_size, timer, plans);
+
+  NoisyNeighborResult result = make_noisy_neighbor_result(config, aggressor_threads);
+  std::cout << Messages::msg_noisy_neighbor_plan(noisy_neighbor_traffic_to_string(config.traffic),
+                                                 aggressor_threads, config.duty_cycles_pct.size(),
+                                                 config.rounds)
+            << std::endl;
+  bool start_failed = false;
+  for (int round = 0; round < config.rounds && !result.interrupted && !start_failed; ++round) {
+    std::cout << Messages::msg_noisy_neighbor_round(round + 1, config.rounds) << std::endl;
+    for (size_t level_index :
+         build_benchmark_cyclic_order(result.levels.size(), static_cast<size_t>(round))) {
+      if (!run_level(result.levels[level_index], static_cast<size_t>(round), workload, plans, timer,
+                     start_failed)) {
+        result.interrupted = !start_failed;
+        break;
+      }
+    }
+  }
+  if (start_failed) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_noisy_neighbor_failed("aggressor thread creation") << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (result.interrupted) {
+    std::cout << std::endl << Messages::msg_interrupted_by_user() << std::endl;
+  }
+
+  finalize_noisy_neighbor_result(result);
+  print_noisy_neighbor_report(result);
+
+  if (!config.output_file.empty()) {
+    const double total_execution_time_sec =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - run_start).count();
+    std::filesystem::path file_path(config.output_file);
+    if (file_path.is_relative()) {
+      file_path = std::filesystem::current_path() / file_path;
+    }
+    if (write_json_to_file(file_path,
+                           build_noisy_neighbor_json(config, result, get_processor_name(),
+                                                     total_execution_time_sec)) != EXIT_SUCCESS) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
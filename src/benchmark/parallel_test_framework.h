@@ -40,6 +40,7 @@
 #define PARALLEL_TEST_FRAMEWORK_H
 
 #include <atomic>                // For std::atomic
+#include <chrono>                // For std::chrono::nanoseconds
 #include <condition_variable>    // For start gate sync
 #include <cstdio>                // For fprintf, stderr
 #include <functional>            // For std::function
@@ -57,6 +58,7 @@
 #include <pthread/qos.h>        // For pthread_set_qos_class_self_np
 
 #include "utils/benchmark.h"  // Include benchmark definitions (assembly funcs, HighResTimer)
+#include "benchmark/buffer_residency.h"  // For read_process_page_faults
 #include "core/memory/memory_utils.h"  // For align_ptr_to_cache_line
 #include "output/console/messages/messages_api.h"
 
@@ -68,6 +70,31 @@ struct ParallelExecutionMetadata {
   size_t qos_successful_workers = 0;
   size_t qos_failed_workers = 0;
   bool worker_startup_failed = false;
+  PageFaultCounts timed_page_faults;  ///< Process-wide faults between timer start and stop
+};
+
+/**
+ * @brief Optional observer run by the coordinating thread during the timed run.
+ *
+ * The coordinating thread otherwise sleeps until the last worker finishes; with
+ * a sampler it wakes once per `interval` and passes the elapsed time so far.
+ */
+struct ParallelProgressSampler {
+  std::chrono::nanoseconds interval{0};
+  std::function<void(double elapsed_seconds)> sample;
+};
+
+/**
+ * @brief Optional per-worker hooks run on the worker thread outside the timed region.
+ *
+ * `before_start` runs after QoS setup and before the worker reports ready;
+ * `after_finish` runs once the last worker has recorded the measured
+ * duration, so no hook overlaps another worker's timed work or delays the
+ * timer stop.
+ */
+struct ParallelWorkerBracket {
+  std::function<void(size_t worker_index)> before_start;
+  std::function<void(size_t worker_index)> after_finish;
 };
 
 /** @brief Deterministic test-only fault seam for worker creation handling. */
@@ -144,6 +171,8 @@ inline std::vector<size_t> build_aligned_chunk_boundaries(void* alignment_base,
  * @param planned_boundaries Optional precomputed worker boundaries; null builds aligned boundaries automatically
  * @param[out] execution_metadata Optional worker-creation and QoS outcome record
  * @param test_control Optional deterministic worker-creation failure seam used by tests
+ * @param progress_sampler Optional periodic observer of the timed run
+ * @param worker_bracket Optional per-worker hooks around the timed region
  * @return Total duration in seconds, or 0.0 if no work was performed
  */
 template <typename MakeWorkFunction>
@@ -151,7 +180,9 @@ double run_parallel_test_common(void* alignment_base, size_t size, int iteration
                                 const char* thread_name, MakeWorkFunction make_work,
                                 const std::vector<size_t>* planned_boundaries = nullptr,
                                 ParallelExecutionMetadata* execution_metadata = nullptr,
-                                const ParallelExecutionTestControl* test_control = nullptr) {
+                                const ParallelExecutionTestControl* test_control = nullptr,
+                                const ParallelProgressSampler* progress_sampler = nullptr,
+                                const ParallelWorkerBracket* worker_bracket = nullptr) {
   if (execution_metadata != nullptr) {
     *execution_metadata = {};
     execution_metadata->requested_workers = num_threads;
@@ -171,6 +202,8 @@ double run_parallel_test_common(void* alignment_base, size_t size, int iteration
   bool start_flag = false;
   bool measurement_complete = false;
   double measured_duration = 0.0;
+  PageFaultCounts faults_at_start;
+  PageFaultCounts faults_at_stop;
   std::atomic<size_t> remaining_workers{0};
   std::atomic<size_t> qos_successful_workers{0};
   std::atomic<size_t> qos_failed_workers{0};
@@ -213,9 +246,9 @@ double run_parallel_test_common(void* alignment_base, size_t size, int iteration
       }
       threads.emplace_back([measured_work = std::move(measured_work), &state_mutex, &state_cv,
                             &ready_workers, &start_flag, &measurement_complete,
-                            &measured_duration, &remaining_workers,
+                            &measured_duration, &faults_at_stop, &remaining_workers,
                             &qos_successful_workers, &qos_failed_workers,
-                            &timer, thread_name]() mutable {
+                            &timer, thread_name, worker_bracket, worker_index]() mutable {
         // QoS setup is preparation and must complete before the timed start gate.
         kern_return_t qos_ret =
             pthread_set_qos_class_self_np(QOS_CLASS_USER_INTERACTIVE, 0);
@@ -228,6 +261,9 @@ double run_parallel_test_common(void* alignment_base, size_t size, int iteration
         } else {
           qos_successful_workers.fetch_add(1, std::memory_order_relaxed);
         }
+        if (worker_bracket != nullptr && worker_bracket->before_start) {
+          worker_bracket->before_start(worker_index);
+        }
 
         {
           std::unique_lock<std::mutex> lock(state_mutex);
@@ -242,12 +278,22 @@ double run_parallel_test_common(void* alignment_base, size_t size, int iteration
         asm volatile("dsb ish" ::: "memory");
         if (remaining_workers.fetch_sub(1, std::memory_order_acq_rel) == 1) {
           const double duration = timer.stop();
+          const PageFaultCounts faults = read_process_page_faults();
           {
             std::lock_guard<std::mutex> lock(state_mutex);
             measured_duration = duration;
+            faults_at_stop = faults;
             measurement_complete = true;
           }
-          state_cv.notify_one();
+          // Wakes the main thread and any worker held for its after_finish hook.
+          state_cv.notify_all();
+        }
+        if (worker_bracket != nullptr && worker_bracket->after_finish) {
+          {
+            std::unique_lock<std::mutex> lock(state_mutex);
+            state_cv.wait(lock, [&measurement_complete] { return measurement_complete; });
+          }
+          worker_bracket->after_finish(worker_index);
         }
       });
     }
@@ -268,6 +314,7 @@ double run_parallel_test_common(void* alignment_base, size_t size, int iteration
   {
     std::unique_lock<std::mutex> lock(state_mutex);
     state_cv.wait(lock, [&ready_workers, &threads] { return ready_workers == threads.size(); });
+    faults_at_start = read_process_page_faults();
     timer.start();
     start_flag = true;
   }
@@ -275,7 +322,18 @@ double run_parallel_test_common(void* alignment_base, size_t size, int iteration
 
   {
     std::unique_lock<std::mutex> lock(state_mutex);
-    state_cv.wait(lock, [&measurement_complete] { return measurement_complete; });
+    if (progress_sampler == nullptr || progress_sampler->interval.count() <= 0) {
+      state_cv.wait(lock, [&measurement_complete] { return measurement_complete; });
+    } else {
+      // HighResTimer::stop() does not reset the start point, so it can be read
+      // here while the last worker still owns the final stop().
+      while (!state_cv.wait_for(lock, progress_sampler->interval,
+                                [&measurement_complete] { return measurement_complete; })) {
+        lock.unlock();
+        progress_sampler->sample(timer.stop());
+        lock.lock();
+      }
+    }
   }
 
   const int created_workers = static_cast<int>(threads.size());
@@ -288,6 +346,7 @@ double run_parallel_test_common(void* alignment_base, size_t size, int iteration
     execution_metadata->qos_failed_workers =
         qos_failed_workers.load(std::memory_order_relaxed);
     execution_metadata->worker_startup_failed = worker_startup_failed;
+    execution_metadata->timed_page_faults = page_faults_between(faults_at_start, faults_at_stop);
   }
   return worker_startup_failed ? 0.0 : measured_duration;
 }
@@ -302,7 +361,9 @@ template <typename WorkFunction>
 double run_parallel_test_indexed_with_boundaries(void* buffer, size_t size, int iterations, HighResTimer& timer,
                                                  const std::vector<size_t>& boundaries, WorkFunction work_function,
                                                  const char* thread_name,
-                                                 ParallelExecutionMetadata* execution_metadata = nullptr) {
+                                                 ParallelExecutionMetadata* execution_metadata = nullptr,
+                                                 const ParallelProgressSampler* progress_sampler = nullptr,
+                                                 const ParallelWorkerBracket* worker_bracket = nullptr) {
   if (boundaries.size() < 2 || boundaries.size() - 1 > static_cast<size_t>(std::numeric_limits<int>::max())) {
     return 0.0;
   }
@@ -315,7 +376,8 @@ double run_parallel_test_indexed_with_boundaries(void* buffer, size_t size, int
     };
   };
   return run_parallel_test_common(buffer, size, iterations, static_cast<int>(boundaries.size() - 1), timer, thread_name,
-                                  make_work, &boundaries, execution_metadata);
+                                  make_work, &boundaries, execution_metadata, nullptr, progress_sampler,
+                                  worker_bracket);
 }
 
 /** @brief Run indexed copy work with finalized worker boundaries. */
@@ -323,7 +385,9 @@ template <typename WorkFunction>
 double run_parallel_test_copy_indexed_with_boundaries(void* dst, void* src, size_t size, int iterations,
                                                       HighResTimer& timer, const std::vector<size_t>& boundaries,
                                                       WorkFunction work_function, const char* thread_name,
-                                                      ParallelExecutionMetadata* execution_metadata = nullptr) {
+                                                      ParallelExecutionMetadata* execution_metadata = nullptr,
+                                                      const ParallelProgressSampler* progress_sampler = nullptr,
+                                                      const ParallelWorkerBracket* worker_bracket = nullptr) {
   if (boundaries.size() < 2 || boundaries.size() - 1 > static_cast<size_t>(std::numeric_limits<int>::max())) {
     return 0.0;
   }
@@ -338,7 +402,37 @@ double run_parallel_test_copy_indexed_with_boundaries(void* dst, void* src, size
     };
   };
   return run_parallel_test_common(dst, size, iterations, static_cast<int>(boundaries.size() - 1), timer, thread_name,
-                                  make_work, &boundaries, execution_metadata);
+                                  make_work, &boundaries, execution_metadata, nullptr, progress_sampler,
+                                  worker_bracket);
+}
+
+/**
+ * @brief Run indexed work whose per-worker layout is owned by the caller.
+ *
+ * For layouts that are not one contiguous range per worker, such as
+ * interleaved or shuffled granules. The callback receives only the worker
+ * index and iteration count; the boundaries handed to the common runner
+ * number workers rather than bytes.
+ */
+template <typename WorkFunction>
+double run_parallel_test_per_worker(size_t worker_count, int iterations, HighResTimer& timer,
+                                    WorkFunction work_function, const char* thread_name,
+                                    ParallelExecutionMetadata* execution_metadata = nullptr) {
+  if (worker_count == 0 || worker_count > static_cast<size_t>(std::numeric_limits<int>::max())) {
+    return 0.0;
+  }
+  std::vector<size_t> worker_boundaries(worker_count + 1);
+  for (size_t index = 0; index < worker_boundaries.size(); ++index) {
+    worker_boundaries[index] = index;
+  }
+  auto make_work = [work_function](size_t /* chunk_start_offset */, size_t /* thread_chunk_size */,
+                                   int iterations_local, size_t worker_index) {
+    return [iterations_local, worker_index, work_function]() {
+      work_function(worker_index, iterations_local);
+    };
+  };
+  return run_parallel_test_common(nullptr, worker_count, iterations, static_cast<int>(worker_count), timer,
+                                  thread_name, make_work, &worker_boundaries, execution_metadata);
 }
 
 /**
@@ -0,0 +1,262 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file partition_compare.cpp
+ * @brief Partition layouts, result reduction, and JSON for partition-compare mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Everything here is measurement-free so it can be unit tested; timed
+ * bandwidth runs live in partition_compare_runner.cpp.
+ */
+
+#include "benchmark/partition_compare.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <sstream>
+
+#include "core/config/config.h"
+#include "utils/descriptive_statistics.h"
+
+namespace {
+
+constexpr PartitionOperation kOperations[PARTITION_COMPARE_OPERATION_COUNT] = {
+    PartitionOperation::Read, PartitionOperation::Write, PartitionOperation::Copy};
+
+// Appends [offset, offset + span), extending the previous extent when it ends
+// exactly where this one starts.
+void append_extent(std::vector<BenchmarkWorkerRange>& extents, size_t offset, size_t span) {
+  if (!extents.empty() && extents.back().offset_bytes + extents.back().span_bytes == offset) {
+    extents.back().span_bytes += span;
+    return;
+  }
+  BenchmarkWorkerRange extent;
+  extent.offset_bytes = offset;
+  extent.span_bytes = span;
+  extents.push_back(extent);
+}
+
+size_t granule_count(size_t size, size_t granule_bytes) {
+  return (size + granule_bytes - 1) / granule_bytes;
+}
+
+}  // namespace
+
+const char* partition_strategy_to_string(PartitionStrategy strategy) {
+  switch (strategy) {
+    case PartitionStrategy::Interleaved:
+      return "interleaved";
+    case PartitionStrategy::Random:
+      return "random";
+    case PartitionStrategy::Contiguous:
+    default:
+      return "contiguous";
+  }
+}
+
+const char* partition_operation_to_string(PartitionOperation operation) {
+  switch (operation) {
+    case PartitionOperation::Write:
+      return "write";
+    case PartitionOperation::Copy:
+      return "copy";
+    case PartitionOperation::Read:
+    default:
+      return "read";
+  }
+}
+
+bool parse_partition_granules(const std::string& text, std::vector<size_t>& out_granules_kb) {
+  std::vector<size_t> granules;
+  std::stringstream stream(text);
+  std::string token;
+  while (std::getline(stream, token, ',')) {
+    long long parsed = 0;
+    if (parse_strict_signed_decimal(token, parsed) != StrictIntegerParseStatus::Success ||
+        parsed < static_cast<long long>(Constants::PARTITION_COMPARE_MIN_GRANULE_KB) ||
+        parsed > static_cast<long long>(Constants::PARTITION_COMPARE_MAX_GRANULE_KB)) {
+      return false;
+    }
+    const size_t granule = static_cast<size_t>(parsed);
+    if ((granule & (granule - 1)) != 0 ||
+        std::find(granules.begin(), granules.end(), granule) != granules.end()) {
+      return false;
+    }
+    granules.push_back(granule);
+  }
+  // getline drops a trailing empty field, so "4," would otherwise pass.
+  if (granules.empty() || text.back() == ',') {
+    return false;
+  }
+  out_granules_kb = std::move(granules);
+  return true;
+}
+
+PartitionWorkerExtents partition_extents_from_boundaries(const std::vector<size_t>& boundaries) {
+  PartitionWorkerExtents extents;
+  for (size_t index = 1; index < boundaries.size(); ++index) {
+    std::vector<BenchmarkWorkerRange> worker;
+    if (boundaries[index] > boundaries[index - 1]) {
+      append_extent(worker, boundaries[index - 1], boundaries[index] - boundaries[index - 1]);
+    }
+    extents.push_back(std::move(worker));
+  }
+  return extents;
+}
+
+PartitionWorkerExtents build_interleaved_partition(size_t size, size_t granule_bytes, int workers) {
+  if (size == 0 || granule_bytes == 0 || workers <= 0) {
+    return {};
+  }
+  PartitionWorkerExtents extents(static_cast<size_t>(workers));
+  const size_t granules = granule_count(size, granule_bytes);
+  for (size_t granule = 0; granule < granules; ++granule) {
+    const size_t offset = granule * granule_bytes;
+    append_extent(extents[granule % extents.size()], offset, std::min(granule_bytes, size - offset));
+  }
+  return extents;
+}
+
+PartitionWorkerExtents build_random_partition(size_t size, size_t granule_bytes, int workers,
+                                              uint64_t seed) {
+  if (size == 0 || granule_bytes == 0 || workers <= 0) {
+    return {};
+  }
+  std::vector<size_t> order(granule_count(size, granule_bytes));
+  std::iota(order.begin(), order.end(), size_t{0});
+  std::mt19937_64 random(seed);
+  std::shuffle(order.begin(), order.end(), random);
+
+  const size_t worker_count = static_cast<size_t>(workers);
+  PartitionWorkerExtents extents(worker_count);
+  for (size_t worker = 0; worker < worker_count; ++worker) {
+    auto first = order.begin() + static_cast<std::ptrdiff_t>(worker * order.size() / worker_count);
+    auto last = order.begin() + static_cast<std::ptrdiff_t>((worker + 1) * order.size() / worker_count);
+    std::sort(first, last);
+    for (auto it = first; it != last; ++it) {
+      const size_t offset = *it * granule_bytes;
+      append_extent(extents[worker], offset, std::min(granule_bytes, size - offset));
+    }
+  }
+  return extents;
+}
+
+PartitionCompareResult make_partition_compare_result(const PartitionCompareConfig& config,
+                                                     int threads, size_t buffer_size_bytes) {
+  PartitionCompareResult result;
+  result.threads = threads;
+  result.buffer_size_bytes = buffer_size_bytes;
+  result.rows.push_back(PartitionCompareRow{});
+  for (PartitionStrategy strategy : {PartitionStrategy::Interleaved, PartitionStrategy::Random}) {
+    for (size_t granule_kb : config.granules_kb) {
+      PartitionCompareRow row;
+      row.strategy = strategy;
+      row.granule_bytes = granule_kb * Constants::BYTES_PER_KB;
+      result.rows.push_back(row);
+    }
+  }
+  return result;
+}
+
+void record_partition_balance(const PartitionWorkerExtents& extents, PartitionCompareRow& row) {
+  row.min_worker_bytes = 0;
+  row.max_worker_bytes = 0;
+  for (size_t worker = 0; worker < extents.size(); ++worker) {
+    size_t bytes = 0;
+    for (const BenchmarkWorkerRange& extent : extents[worker]) {
+      bytes += extent.span_bytes;
+    }
+    row.min_worker_bytes = worker == 0 ? bytes : std::min(row.min_worker_bytes, bytes);
+    row.max_worker_bytes = std::max(row.max_worker_bytes, bytes);
+  }
+}
+
+void finalize_partition_compare_result(PartitionCompareResult& result) {
+  for (PartitionCompareRow& row : result.rows) {
+    for (size_t op = 0; op < PARTITION_COMPARE_OPERATION_COUNT; ++op) {
+      row.median_gb_s[op] = row.samples_gb_s[op].empty()
+                                ? 0.0
+                                : calculate_descriptive_statistics(row.samples_gb_s[op]).median;
+    }
+  }
+  if (result.rows.empty()) {
+    return;
+  }
+  const PartitionCompareRow& baseline = result.rows.front();
+  for (PartitionCompareRow& row : result.rows) {
+    for (size_t op = 0; op < PARTITION_COMPARE_OPERATION_COUNT; ++op) {
+      row.vs_contiguous_pct[op] =
+          baseline.median_gb_s[op] > 0.0 && row.median_gb_s[op] > 0.0
+              ? (row.median_gb_s[op] / baseline.median_gb_s[op] - 1.0) * 100.0
+              : 0.0;
+    }
+  }
+}
+
+nlohmann::ordered_json build_partition_compare_json(const PartitionCompareConfig& config,
+                                                    const PartitionCompareResult& result,
+                                                    const std::string& cpu_name,
+                                                    double total_execution_time_sec) {
+  nlohmann::ordered_json result_json;
+  result_json["mode"] = Constants::PARTITION_COMPARE_JSON_MODE_NAME;
+  result_json["schema_version"] = Constants::PARTITION_COMPARE_JSON_SCHEMA_VERSION;
+  result_json["methodology_version"] = Constants::PARTITION_COMPARE_METHODOLOGY_VERSION;
+  result_json["status"] = result.interrupted ? "interrupted" : "complete";
+  result_json["cpu_name"] = cpu_name;
+
+  nlohmann::ordered_json configuration;
+  configuration["threads"] = result.threads;
+  configuration["requested_threads"] = config.requested_threads;
+  configuration["buffer_size_bytes"] = result.buffer_size_bytes;
+  configuration["passes"] = result.passes;
+  configuration["rounds"] = config.rounds;
+  configuration["granules_kb"] = config.granules_kb;
+  configuration["random_seed"] = Constants::PARTITION_COMPARE_RANDOM_SEED;
+  result_json["configuration"] = std::move(configuration);
+
+  nlohmann::ordered_json layouts = nlohmann::ordered_json::array();
+  for (const PartitionCompareRow& row : result.rows) {
+    nlohmann::ordered_json layout;
+    layout["strategy"] = partition_strategy_to_string(row.strategy);
+    if (row.strategy == PartitionStrategy::Contiguous) {
+      layout["granule_bytes"] = nullptr;
+    } else {
+      layout["granule_bytes"] = row.granule_bytes;
+    }
+    layout["min_worker_bytes"] = row.min_worker_bytes;
+    layout["max_worker_bytes"] = row.max_worker_bytes;
+    nlohmann::ordered_json operations;
+    for (size_t op = 0; op < PARTITION_COMPARE_OPERATION_COUNT; ++op) {
+      nlohmann::ordered_json operation;
+      operation["median_gb_s"] = row.median_gb_s[op];
+      if (row.strategy == PartitionStrategy::Contiguous || row.median_gb_s[op] <= 0.0) {
+        operation["vs_contiguous_pct"] = nullptr;
+      } else {
+        operation["vs_contiguous_pct"] = row.vs_contiguous_pct[op];
+      }
+      operation["rounds_gb_s"] = row.samples_gb_s[op];
+      operations[partition_operation_to_string(kOperations[op])] = std::move(operation);
+    }
+    layout["operations"] = std::move(operations);
+    layouts.push_back(std::move(layout));
+  }
+  result_json["layouts"] = std::move(layouts);
+  result_json["total_execution_time_sec"] = total_execution_time_sec;
+  return result_json;
+}
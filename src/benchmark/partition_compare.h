@@ -0,0 +1,149 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file partition_compare.h
+ * @brief Standalone worker-partitioning comparison mode interfaces
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * `-I, --partition-compare` measures main-memory read, write, and copy
+ * bandwidth with the same threads and buffer under several ways of dividing
+ * the buffer between workers: the contiguous chunks used by --benchmark,
+ * round-robin interleaved granules, and randomly assigned granules. A layout
+ * that beats contiguous points at channel or bank imbalance in the default.
+ */
+
+#ifndef PARTITION_COMPARE_H
+#define PARTITION_COMPARE_H
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark_work_plan.h"
+#include "core/config/constants.h"
+#include "third_party/nlohmann/json.hpp"
+
+enum class PartitionStrategy {
+  Contiguous,   ///< One aligned chunk per worker, identical to --benchmark
+  Interleaved,  ///< Granule g belongs to worker g % workers
+  Random,       ///< Shuffled granules dealt out in equal-count runs
+};
+
+enum class PartitionOperation {
+  Read,
+  Write,
+  Copy,
+};
+
+constexpr size_t PARTITION_COMPARE_OPERATION_COUNT = 3;
+
+/** @brief Byte ranges owned by each worker, in the order the worker visits them. */
+using PartitionWorkerExtents = std::vector<std::vector<BenchmarkWorkerRange>>;
+
+struct PartitionCompareConfig {
+  int requested_threads = 0;  ///< 0 uses every logical core
+  std::vector<size_t> granules_kb = {4, 64, 2048};
+  int rounds = Constants::PARTITION_COMPARE_DEFAULT_ROUNDS;
+  unsigned long buffer_size_mb = Constants::PARTITION_COMPARE_DEFAULT_BUFFER_SIZE_MB;
+  std::string output_file;
+  bool help_requested = false;
+};
+
+/** @brief One layout; granule_bytes is 0 for the contiguous baseline. */
+struct PartitionCompareRow {
+  PartitionStrategy strategy = PartitionStrategy::Contiguous;
+  size_t granule_bytes = 0;
+  size_t min_worker_bytes = 0;
+  size_t max_worker_bytes = 0;
+  std::array<std::vector<double>, PARTITION_COMPARE_OPERATION_COUNT> samples_gb_s;  ///< One per round
+  std::array<double, PARTITION_COMPARE_OPERATION_COUNT> median_gb_s{};
+  std::array<double, PARTITION_COMPARE_OPERATION_COUNT> vs_contiguous_pct{};  ///< Signed; positive is faster
+};
+
+struct PartitionCompareResult {
+  int threads = 0;
+  size_t buffer_size_bytes = 0;
+  size_t passes = 0;
+  std::vector<PartitionCompareRow> rows;  ///< rows[0] is the contiguous baseline
+  bool interrupted = false;
+};
+
+const char* partition_strategy_to_string(PartitionStrategy strategy);
+const char* partition_operation_to_string(PartitionOperation operation);
+
+/**
+ * @brief Parse a comma-separated granule list in KB such as "4,64,2048".
+ *
+ * Every entry must be a distinct power of two between
+ * PARTITION_COMPARE_MIN_GRANULE_KB and PARTITION_COMPARE_MAX_GRANULE_KB.
+ */
+bool parse_partition_granules(const std::string& text, std::vector<size_t>& out_granules_kb);
+
+/** @brief One extent per non-empty range of a boundary vector. */
+PartitionWorkerExtents partition_extents_from_boundaries(const std::vector<size_t>& boundaries);
+
+/**
+ * @brief Round-robin granules across workers.
+ *
+ * The last granule may be short; adjacent granules of one worker are merged,
+ * so a single worker degenerates to one contiguous extent.
+ */
+PartitionWorkerExtents build_interleaved_partition(size_t size, size_t granule_bytes, int workers);
+
+/**
+ * @brief Shuffle granules with `seed` and deal them out in equal-count runs.
+ *
+ * Each worker's granules are sorted by address so that only ownership, not
+ * the visiting order inside a worker, differs from the interleaved layout.
+ */
+PartitionWorkerExtents build_random_partition(size_t size, size_t granule_bytes, int workers,
+                                              uint64_t seed);
+
+/** @brief Contiguous baseline followed by interleaved and random rows per granule. */
+PartitionCompareResult make_partition_compare_result(const PartitionCompareConfig& config,
+                                                     int threads, size_t buffer_size_bytes);
+
+/** @brief Fill min/max worker bytes of `row` from its extents. */
+void record_partition_balance(const PartitionWorkerExtents& extents, PartitionCompareRow& row);
+
+/** @brief Reduce samples to medians and compare every row with rows[0]. */
+void finalize_partition_compare_result(PartitionCompareResult& result);
+
+nlohmann::ordered_json build_partition_compare_json(const PartitionCompareConfig& config,
+                                                    const PartitionCompareResult& result,
+                                                    const std::string& cpu_name,
+                                                    double total_execution_time_sec);
+
+/**
+ * @brief Parse CLI args for standalone partition-compare mode.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on parse/validation error.
+ */
+int parse_partition_compare_mode_arguments(int argc, char* argv[], PartitionCompareConfig& config);
+
+/**
+ * @brief Calibrate passes, measure every layout, report, and save JSON.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on runtime/IO error.
+ */
+int run_partition_compare(const PartitionCompareConfig& config);
+
+/**
+ * @brief Parse and run standalone partition-compare mode from main().
+ */
+int run_partition_compare_mode(int argc, char* argv[]);
+
+#endif  // PARTITION_COMPARE_H
@@ -0,0 +1,248 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file partition_compare_runner.cpp
+ * @brief Timed layout runs for partition-compare mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * One pass count is calibrated on the contiguous read layout and reused for
+ * every layout and operation, so each run moves the same bytes with the same
+ * workers and kernels. Layout/operation order rotates every round.
+ */
+
+#include "benchmark/partition_compare.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark_tests.h"
+#include "benchmark/benchmark_work_plan.h"
+#include "benchmark/memory_kernels.h"
+#include "benchmark/parallel_test_framework.h"
+#include "core/config/constants.h"
+#include "core/memory/memory_manager.h"
+#include "core/signal/signal_handler.h"
+#include "core/system/system_info.h"
+#include "core/timing/timer.h"
+#include "output/console/messages/messages_api.h"
+#include "output/console/output_printer.h"
+#include "output/json/json_output/json_output_api.h"
+
+namespace {
+
+constexpr PartitionOperation kOperations[PARTITION_COMPARE_OPERATION_COUNT] = {
+    PartitionOperation::Read, PartitionOperation::Write, PartitionOperation::Copy};
+
+struct PartitionBuffers {
+  MmapPtr src;
+  MmapPtr dst;
+  size_t size = 0;
+};
+
+// Runs `passes` sweeps of every worker's extents. Returns elapsed seconds, or
+// 0.0 when a worker could not be started.
+double run_layout(const PartitionBuffers& buffers,
+                  const PartitionWorkerExtents& extents,
+                  PartitionOperation operation,
+                  size_t passes,
+                  const MemoryKernelSet& kernels,
+                  HighResTimer& timer) {
+  char* src = static_cast<char*>(buffers.src.get());
+  char* dst = static_cast<char*>(buffers.dst.get());
+  std::vector<uint64_t> worker_checksums(extents.size(), 0);
+  ParallelExecutionMetadata metadata;
+  const double elapsed = run_parallel_test_per_worker(
+      extents.size(), static_cast<int>(passes), timer,
+      [&extents, &worker_checksums, &kernels, operation, src, dst](size_t worker_index,
+                                                                   int iterations) {
+        const std::vector<BenchmarkWorkerRange>& worker = extents[worker_index];
+        uint64_t local_checksum = 0;
+        for (int iteration = 0; iteration < iterations; ++iteration) {
+          for (const BenchmarkWorkerRange& extent : worker) {
+            switch (operation) {
+              case PartitionOperation::Read:
+                local_checksum ^= kernels.read(src + extent.offset_bytes, extent.span_bytes);
+                break;
+              case PartitionOperation::Write:
+                kernels.write(dst + extent.offset_bytes, extent.span_bytes);
+                break;
+              case PartitionOperation::Copy:
+                kernels.copy(dst + extent.offset_bytes, src + extent.offset_bytes,
+                             extent.span_bytes);
+                break;
+            }
+          }
+        }
+        worker_checksums[worker_index] = local_checksum;
+      },
+      partition_operation_to_string(operation), &metadata);
+  return metadata.worker_startup_failed ? 0.0 : elapsed;
+}
+
+double bandwidth_gb_s(PartitionOperation operation, size_t buffer_size, size_t passes,
+                      double elapsed) {
+  const double multiplier = operation == PartitionOperation::Copy
+                                ? static_cast<double>(Constants::COPY_OPERATION_MULTIPLIER)
+                                : 1.0;
+  return static_cast<double>(buffer_size) * static_cast<double>(passes) * multiplier / elapsed /
+         Constants::NANOSECONDS_PER_SECOND;
+}
+
+PartitionWorkerExtents build_layout_extents(const PartitionCompareRow& row,
+                                            const PartitionBuffers& buffers,
+                                            int threads) {
+  switch (row.strategy) {
+    case PartitionStrategy::Interleaved:
+      return build_interleaved_partition(buffers.size, row.granule_bytes, threads);
+    case PartitionStrategy::Random:
+      return build_random_partition(buffers.size, row.granule_bytes, threads,
+                                    Constants::PARTITION_COMPARE_RANDOM_SEED);
+    case PartitionStrategy::Contiguous:
+    default:
+      return partition_extents_from_boundaries(
+          build_aligned_chunk_boundaries(buffers.dst.get(), buffers.size, threads));
+  }
+}
+
+void print_partition_compare_report(const PartitionCompareResult& result) {
+  std::cout << std::endl << Messages::report_partition_compare_header() << std::endl;
+  std::cout << Messages::report_partition_compare_note() << std::endl;
+  std::cout << Messages::report_partition_compare_table_header() << std::endl;
+  for (const PartitionCompareRow& row : result.rows) {
+    std::cout << Messages::report_partition_compare_layout_label(
+        partition_strategy_to_string(row.strategy), row.granule_bytes);
+    for (size_t op = 0; op < PARTITION_COMPARE_OPERATION_COUNT; ++op) {
+      std::cout << Messages::report_partition_compare_cell(
+          row.median_gb_s[op], row.vs_contiguous_pct[op],
+          row.strategy != PartitionStrategy::Contiguous && row.median_gb_s[op] > 0.0);
+    }
+    std::cout << std::endl;
+  }
+}
+
+}  // namespace
+
+int run_partition_compare(const PartitionCompareConfig& config) {
+  print_runtime_banner();
+  std::cout << Messages::msg_running_partition_compare() << std::endl;
+  const auto run_start = std::chrono::steady_clock::now();
+
+  const int logical_cores = get_total_logical_cores();
+  int threads = logical_cores;
+  if (config.requested_threads > logical_cores) {
+    std::cerr << Messages::warning_prefix()
+              << Messages::warning_threads_capped(config.requested_threads, logical_cores)
+              << std::endl;
+  } else if (config.requested_threads > 0) {
+    threads = config.requested_threads;
+  }
+
+  PartitionBuffers buffers;
+  buffers.size = static_cast<size_t>(config.buffer_size_mb) * Constants::BYTES_PER_MB;
+  buffers.src = allocate_buffer(buffers.size, "partition-compare source");
+  buffers.dst = allocate_buffer(buffers.size, "partition-compare destination");
+  if (!buffers.src || !buffers.dst) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_partition_compare_failed("buffer allocation") << std::endl;
+    return EXIT_FAILURE;
+  }
+  const MemoryKernelSet& kernels =
+      memory_kernel_set(MemoryKernelVariant::Neon);
+  // Writing both buffers once backs every page before any timed run.
+  kernels.write(buffers.src.get(), buffers.size);
+  kernels.write(buffers.dst.get(), buffers.size);
+
+  PartitionCompareResult result = make_partition_compare_result(config, threads, buffers.size);
+  std::vector<PartitionWorkerExtents> layouts;
+  for (PartitionCompareRow& row : result.rows) {
+    layouts.push_back(build_layout_extents(row, buffers, threads));
+    record_partition_balance(layouts.back(), row);
+  }
+
+  auto timer_optional = HighResTimer::create();
+  if (!timer_optional) {
+    std::cerr << Messages::error_prefix() << Messages::error_timer_creation_failed() << std::endl;
+    return EXIT_FAILURE;
+  }
+  HighResTimer& timer = *timer_optional;
+
+  const size_t pilot_passes = calculate_benchmark_pilot_passes(
+      buffers.size, Constants::BENCHMARK_CALIBRATION_MIN_PILOT_BYTES,
+      Constants::BENCHMARK_CALIBRATION_MAX_PASSES);
+  const double pilot_elapsed =
+      run_layout(buffers, layouts.front(), PartitionOperation::Read, pilot_passes, kernels, timer);
+  if (!benchmark_elapsed_is_valid(pilot_elapsed)) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_partition_compare_failed("calibration run") << std::endl;
+    return EXIT_FAILURE;
+  }
+  result.passes = calculate_benchmark_calibrated_count(
+      pilot_elapsed, pilot_passes, Constants::BENCHMARK_CALIBRATION_TARGET_SECONDS, 1,
+      Constants::BENCHMARK_CALIBRATION_MAX_PASSES);
+
+  std::cout << Messages::msg_partition_compare_plan(threads, config.buffer_size_mb, result.passes,
+                                                    result.rows.size(), config.rounds)
+            << std::endl;
+  const size_t run_count = result.rows.size() * PARTITION_COMPARE_OPERATION_COUNT;
+  for (int round = 0; round < config.rounds && !result.interrupted; ++round) {
+    std::cout << Messages::msg_partition_compare_round(round + 1, config.rounds) << std::endl;
+    for (size_t run : build_benchmark_cyclic_order(run_count, static_cast<size_t>(round))) {
+      const size_t row_index = run / PARTITION_COMPARE_OPERATION_COUNT;
+      const PartitionOperation operation = kOperations[run % PARTITION_COMPARE_OPERATION_COUNT];
+      const double elapsed =
+          run_layout(buffers, layouts[row_index], operation, result.passes, kernels, timer);
+      if (signal_received()) {
+        result.interrupted = true;
+        std::cout << std::endl << Messages::msg_interrupted_by_user() << std::endl;
+        break;
+      }
+      if (!benchmark_elapsed_is_valid(elapsed)) {
+        std::cerr << Messages::error_prefix()
+                  << Messages::error_partition_compare_failed("worker startup") << std::endl;
+        return EXIT_FAILURE;
+      }
+      result.rows[row_index].samples_gb_s[run % PARTITION_COMPARE_OPERATION_COUNT].push_back(
+          bandwidth_gb_s(operation, buffers.size, result.passes, elapsed));
+    }
+  }
+
+  finalize_partition_compare_result(result);
+  print_partition_compare_report(result);
+
+  if (!config.output_file.empty()) {
+    const double total_execution_time_sec =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - run_start).count();
+    std::filesystem::path file_path(config.output_file);
+    if (file_path.is_relative()) {
+      file_path = std::filesystem::current_path() / file_path;
+    }
+    if (write_json_to_file(file_path, build_partition_compare_json(config, result,
+                                                                   get_processor_name(),
+                                                                   total_execution_time_sec)) !=
+        EXIT_SUCCESS) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
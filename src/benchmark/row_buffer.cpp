@@ -0,0 +1,505 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file row_buffer.cpp
+ * @brief Pair selection, clustering, bank functions, and JSON for row-buffer mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Everything here is measurement-free so it can be unit tested; the flush
+ * and reload timing lives in row_buffer_runner.cpp.
+ */
+
+#include "benchmark/row_buffer.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <memory>
+#include <sstream>
+
+#include "pattern_benchmark/pattern_work_plan.h"
+#include "utils/descriptive_statistics.h"
+
+namespace {
+
+constexpr uint64_t kPagemapPresentBit = 1ULL << 63;
+constexpr uint64_t kPagemapFrameMask = (1ULL << 55) - 1;
+
+unsigned floor_log2(size_t value) {
+  unsigned bit = 0;
+  while (value > 1) {
+    value >>= 1;
+    ++bit;
+  }
+  return bit;
+}
+
+unsigned parity(uint64_t value) {
+  return static_cast<unsigned>(std::bitset<64>(value).count() & 1U);
+}
+
+double median_of(const std::vector<double>& values) {
+  return values.empty() ? 0.0 : calculate_descriptive_statistics(values).median;
+}
+
+// Every mask of one to ROW_BUFFER_MAX_FUNCTION_BITS of `bits`, from `first` on.
+void append_masks(const std::vector<unsigned>& bits, size_t first, size_t bits_left,
+                  uint64_t mask, std::vector<uint64_t>& masks) {
+  for (size_t index = first; index < bits.size(); ++index) {
+    const uint64_t next = mask | (1ULL << bits[index]);
+    masks.push_back(next);
+    if (bits_left > 1) {
+      append_masks(bits, index + 1, bits_left - 1, next, masks);
+    }
+  }
+}
+
+std::string hex_mask(uint64_t mask) {
+  std::ostringstream oss;
+  oss << "0x" << std::hex << mask;
+  return oss.str();
+}
+
+nlohmann::ordered_json optional_number(const std::optional<double>& value) {
+  return value ? nlohmann::ordered_json(*value) : nlohmann::ordered_json(nullptr);
+}
+
+nlohmann::ordered_json excess_over(const std::optional<double>& value, double reference_ns) {
+  return value ? nlohmann::ordered_json(*value - reference_ns) : nlohmann::ordered_json(nullptr);
+}
+
+nlohmann::ordered_json probe_json(const RowBufferProbe& probe) {
+  nlohmann::ordered_json probe_json;
+  probe_json["offset_bytes"] = probe.offset_bytes;
+  probe_json["median_ns"] = probe.median_ns;
+  probe_json["class"] = row_buffer_class_to_string(probe.classification);
+  if (probe.physical_address) {
+    probe_json["physical_address"] = hex_mask(*probe.physical_address);
+  } else {
+    probe_json["physical_address"] = nullptr;
+  }
+  return probe_json;
+}
+
+const char* bank_function_reason(const RowBufferResult& result) {
+  switch (result.physical_address_status) {
+    case PhysicalAddressStatus::Unavailable:
+      return "physical addresses unavailable";
+    case PhysicalAddressStatus::Hidden:
+      return "page frame numbers hidden from this process";
+    case PhysicalAddressStatus::Available:
+      break;
+  }
+  if (!result.clusters.separated) {
+    return "latency clusters did not separate";
+  }
+  if (result.bank_functions.empty()) {
+    return result.clusters.high_count < Constants::ROW_BUFFER_MIN_SAME_BANK_PAIRS
+               ? "too few row-conflict pairs"
+               : "no consistent XOR mask";
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+const char* row_buffer_class_to_string(RowBufferClass classification) {
+  switch (classification) {
+    case RowBufferClass::RowHit:
+      return "row_hit";
+    case RowBufferClass::RowMiss:
+      return "row_miss";
+    case RowBufferClass::RowConflict:
+      return "row_conflict";
+    case RowBufferClass::Unclassified:
+    default:
+      return "unclassified";
+  }
+}
+
+const char* physical_address_status_to_string(PhysicalAddressStatus status) {
+  switch (status) {
+    case PhysicalAddressStatus::Hidden:
+      return "hidden";
+    case PhysicalAddressStatus::Available:
+      return "available";
+    case PhysicalAddressStatus::Unavailable:
+    default:
+      return "unavailable";
+  }
+}
+
+std::vector<size_t> build_row_buffer_pair_pages(size_t page_count, size_t pair_count,
+                                                uint64_t seed) {
+  if (page_count < 2) {
+    return {};
+  }
+  pair_count = std::min(pair_count, page_count - 1);
+  // The generator permutes PATTERN_ACCESS_SIZE_BYTES slots; one slot per page
+  // turns its offsets into page indices. One extra draw covers dropping page 0.
+  std::vector<size_t> pages = generate_random_indices(
+      page_count * Constants::PATTERN_ACCESS_SIZE_BYTES, pair_count + 1, seed);
+  std::vector<size_t> result;
+  result.reserve(pair_count);
+  for (size_t offset : pages) {
+    const size_t page = offset / Constants::PATTERN_ACCESS_SIZE_BYTES;
+    if (page != 0 && result.size() < pair_count) {
+      result.push_back(page);
+    }
+  }
+  return result;
+}
+
+RowBufferClusters cluster_row_buffer_latencies(const std::vector<double>& values) {
+  RowBufferClusters clusters;
+  if (values.size() < 4) {
+    return clusters;
+  }
+  std::vector<double> sorted = values;
+  std::sort(sorted.begin(), sorted.end());
+  const size_t count = sorted.size();
+  std::vector<double> sum(count + 1, 0.0);
+  std::vector<double> sum_squares(count + 1, 0.0);
+  for (size_t i = 0; i < count; ++i) {
+    sum[i + 1] = sum[i] + sorted[i];
+    sum_squares[i + 1] = sum_squares[i] + sorted[i] * sorted[i];
+  }
+  const auto sse = [&](size_t begin, size_t end) {
+    const double n = static_cast<double>(end - begin);
+    const double s = sum[end] - sum[begin];
+    return (sum_squares[end] - sum_squares[begin]) - s * s / n;
+  };
+
+  // On sorted data the optimal two-means split is a prefix/suffix cut.
+  size_t best_split = 1;
+  double best_sse = sse(0, 1) + sse(1, count);
+  for (size_t split = 2; split < count; ++split) {
+    const double split_sse = sse(0, split) + sse(split, count);
+    if (split_sse < best_sse) {
+      best_sse = split_sse;
+      best_split = split;
+    }
+  }
+
+  clusters.low_center_ns = sum[best_split] / static_cast<double>(best_split);
+  clusters.high_center_ns =
+      (sum[count] - sum[best_split]) / static_cast<double>(count - best_split);
+  clusters.threshold_ns = (clusters.low_center_ns + clusters.high_center_ns) / 2.0;
+  clusters.high_count = count - best_split;
+  const double gap = clusters.high_center_ns - clusters.low_center_ns;
+  const double pooled_sd = std::sqrt(std::max(0.0, best_sse) / static_cast<double>(count - 2));
+  clusters.separation = pooled_sd > 0.0 ? gap / pooled_sd : 0.0;
+  clusters.separated =
+      best_split >= 2 && clusters.high_count >= 2 &&
+      gap >= Constants::ROW_BUFFER_MIN_GAP_FRACTION * clusters.low_center_ns &&
+      (pooled_sd == 0.0 || clusters.separation >= Constants::ROW_BUFFER_MIN_SEPARATION);
+  return clusters;
+}
+
+std::vector<uint64_t> infer_row_buffer_bank_functions(
+    const std::vector<std::pair<uint64_t, uint64_t>>& same_bank_pairs,
+    const std::vector<std::pair<uint64_t, uint64_t>>& other_bank_pairs, unsigned low_bit,
+    unsigned high_bit) {
+  if (same_bank_pairs.size() < Constants::ROW_BUFFER_MIN_SAME_BANK_PAIRS ||
+      other_bank_pairs.empty() || low_bit >= high_bit) {
+    return {};
+  }
+  // A bit no pair differs in cannot be tested; adding it to a mask would
+  // only produce aliases of the same function.
+  uint64_t varying = 0;
+  for (const auto* pairs : {&same_bank_pairs, &other_bank_pairs}) {
+    for (const auto& pair : *pairs) {
+      varying |= pair.first ^ pair.second;
+    }
+  }
+  std::vector<unsigned> bits;
+  for (unsigned bit = low_bit; bit < std::min(high_bit, 64U); ++bit) {
+    if ((varying >> bit & 1ULL) != 0) {
+      bits.push_back(bit);
+    }
+  }
+  std::vector<uint64_t> candidates;
+  append_masks(bits, 0, Constants::ROW_BUFFER_MAX_FUNCTION_BITS, 0, candidates);
+
+  std::vector<uint64_t> consistent;
+  for (uint64_t mask : candidates) {
+    const bool agrees = std::all_of(
+        same_bank_pairs.begin(), same_bank_pairs.end(),
+        [mask](const auto& pair) { return parity((pair.first ^ pair.second) & mask) == 0; });
+    if (!agrees) {
+      continue;
+    }
+    size_t split = 0;
+    for (const auto& pair : other_bank_pairs) {
+      split += parity((pair.first ^ pair.second) & mask);
+    }
+    if (static_cast<double>(split) >=
+        Constants::ROW_BUFFER_MIN_FUNCTION_SPLIT * static_cast<double>(other_bank_pairs.size())) {
+      consistent.push_back(mask);
+    }
+  }
+
+  std::sort(consistent.begin(), consistent.end(), [](uint64_t a, uint64_t b) {
+    const size_t a_bits = std::bitset<64>(a).count();
+    const size_t b_bits = std::bitset<64>(b).count();
+    return a_bits != b_bits ? a_bits < b_bits : a < b;
+  });
+  // GF(2) basis indexed by leading bit; a mask that reduces to zero is a
+  // combination of simpler functions already kept.
+  uint64_t basis[64] = {};
+  std::vector<uint64_t> functions;
+  for (uint64_t mask : consistent) {
+    uint64_t reduced = mask;
+    for (int bit = 63; bit >= 0 && reduced != 0; --bit) {
+      if ((reduced >> bit & 1ULL) == 0) {
+        continue;
+      }
+      if (basis[bit] == 0) {
+        basis[bit] = reduced;
+        functions.push_back(mask);
+        break;
+      }
+      reduced ^= basis[bit];
+    }
+  }
+  return functions;
+}
+
+void attach_row_buffer_physical_addresses(RowBufferResult& result, const void* base,
+                                          const PhysicalAddressProvider& provider) {
+  result.physical_address_status = PhysicalAddressStatus::Unavailable;
+  if (!provider) {
+    return;
+  }
+  result.base_physical_address = provider(base);
+  if (!result.base_physical_address) {
+    result.physical_address_status = PhysicalAddressStatus::Hidden;
+    return;
+  }
+  result.physical_address_status = PhysicalAddressStatus::Available;
+  const char* bytes = static_cast<const char*>(base);
+  for (std::vector<RowBufferProbe>* probes : {&result.bits, &result.pairs}) {
+    for (RowBufferProbe& probe : *probes) {
+      probe.physical_address = provider(bytes + probe.offset_bytes);
+    }
+  }
+  result.reference.physical_address = result.base_physical_address;
+}
+
+PhysicalAddressProvider open_pagemap_physical_address_provider() {
+  const int fd = open("/proc/self/pagemap", O_RDONLY);
+  if (fd < 0) {
+    return {};
+  }
+  std::shared_ptr<int> pagemap(new int(fd), [](int* owned) {
+    close(*owned);
+    delete owned;
+  });
+  const size_t page_bytes = static_cast<size_t>(getpagesize());
+  return [pagemap, page_bytes](const void* address) -> std::optional<uint64_t> {
+    const uintptr_t virtual_address = reinterpret_cast<uintptr_t>(address);
+    uint64_t entry = 0;
+    const off_t offset =
+        static_cast<off_t>(virtual_address / page_bytes * sizeof(entry));
+    if (pread(*pagemap, &entry, sizeof(entry), offset) != static_cast<ssize_t>(sizeof(entry))) {
+      return std::nullopt;
+    }
+    // Without CAP_SYS_ADMIN the kernel reports present pages with frame 0.
+    const uint64_t frame = entry & kPagemapFrameMask;
+    if ((entry & kPagemapPresentBit) == 0 || frame == 0) {
+      return std::nullopt;
+    }
+    return frame * page_bytes + virtual_address % page_bytes;
+  };
+}
+
+RowBufferResult make_row_buffer_result(const RowBufferConfig& config, size_t page_bytes) {
+  RowBufferResult result;
+  result.buffer_bytes = static_cast<size_t>(config.buffer_size_mb) * Constants::BYTES_PER_MB;
+  result.page_bytes = page_bytes;
+  for (size_t offset = Constants::ROW_BUFFER_MIN_BIT_BYTES; offset < page_bytes; offset <<= 1) {
+    RowBufferProbe probe;
+    probe.offset_bytes = offset;
+    result.bits.push_back(std::move(probe));
+  }
+  const std::vector<size_t> pages =
+      build_row_buffer_pair_pages(result.buffer_bytes / page_bytes,
+                                  static_cast<size_t>(config.pairs),
+                                  Constants::ROW_BUFFER_PAIR_SEED);
+  for (size_t page : pages) {
+    RowBufferProbe probe;
+    probe.offset_bytes = page * page_bytes;
+    result.pairs.push_back(std::move(probe));
+  }
+  return result;
+}
+
+void finalize_row_buffer_result(RowBufferResult& result) {
+  result.reference.median_ns = median_of(result.reference.samples_ns);
+  std::vector<double> pair_medians;
+  for (RowBufferProbe& probe : result.pairs) {
+    probe.median_ns = median_of(probe.samples_ns);
+    if (!probe.samples_ns.empty()) {
+      pair_medians.push_back(probe.median_ns);
+    }
+  }
+  for (RowBufferProbe& probe : result.bits) {
+    probe.median_ns = median_of(probe.samples_ns);
+  }
+
+  result.clusters = cluster_row_buffer_latencies(pair_medians);
+  if (!result.clusters.separated) {
+    return;
+  }
+  const RowBufferClusters& clusters = result.clusters;
+  result.row_miss_ns = clusters.low_center_ns;
+  result.row_conflict_ns = clusters.high_center_ns;
+  result.conflict_fraction =
+      static_cast<double>(clusters.high_count) / static_cast<double>(pair_medians.size());
+  result.estimated_banks =
+      static_cast<size_t>(std::lround(1.0 / result.conflict_fraction));
+
+  for (RowBufferProbe& probe : result.pairs) {
+    if (!probe.samples_ns.empty()) {
+      probe.classification = probe.median_ns > clusters.threshold_ns
+                                 ? RowBufferClass::RowConflict
+                                 : RowBufferClass::RowMiss;
+    }
+  }
+  // A flip inside the page that stays clearly below the different-bank
+  // cluster reuses the row A opened.
+  const double hit_ceiling_ns =
+      clusters.low_center_ns * (1.0 - Constants::ROW_BUFFER_MIN_GAP_FRACTION);
+  std::vector<double> hit_medians;
+  for (RowBufferProbe& probe : result.bits) {
+    if (probe.samples_ns.empty()) {
+      continue;
+    }
+    if (probe.median_ns > clusters.threshold_ns) {
+      probe.classification = RowBufferClass::RowConflict;
+    } else if (probe.median_ns < hit_ceiling_ns) {
+      probe.classification = RowBufferClass::RowHit;
+      hit_medians.push_back(probe.median_ns);
+    } else {
+      probe.classification = RowBufferClass::RowMiss;
+    }
+  }
+  if (!hit_medians.empty()) {
+    result.row_hit_ns = median_of(hit_medians);
+  }
+
+  if (result.physical_address_status != PhysicalAddressStatus::Available ||
+      !result.base_physical_address) {
+    return;
+  }
+  std::vector<std::pair<uint64_t, uint64_t>> same_bank;
+  std::vector<std::pair<uint64_t, uint64_t>> other_bank;
+  uint64_t highest = *result.base_physical_address;
+  for (const RowBufferProbe& probe : result.pairs) {
+    if (!probe.physical_address || probe.classification == RowBufferClass::Unclassified) {
+      continue;
+    }
+    highest = std::max(highest, *probe.physical_address);
+    const auto pair = std::make_pair(*result.base_physical_address, *probe.physical_address);
+    (probe.classification == RowBufferClass::RowConflict ? same_bank : other_bank)
+        .push_back(pair);
+  }
+  // Pairs share their page offset, so only bits at or above the page size differ.
+  result.bank_functions = infer_row_buffer_bank_functions(
+      same_bank, other_bank, floor_log2(result.page_bytes), floor_log2(highest) + 1);
+}
+
+nlohmann::ordered_json build_row_buffer_json(const RowBufferConfig& config,
+                                             const RowBufferResult& result,
+                                             const std::string& cpu_name,
+                                             double total_execution_time_sec) {
+  nlohmann::ordered_json result_json;
+  result_json["mode"] = Constants::ROW_BUFFER_JSON_MODE_NAME;
+  result_json["schema_version"] = Constants::ROW_BUFFER_JSON_SCHEMA_VERSION;
+  result_json["methodology_version"] = Constants::ROW_BUFFER_METHODOLOGY_VERSION;
+  result_json["status"] = result.interrupted ? "interrupted" : "complete";
+  result_json["cpu_name"] = cpu_name;
+
+  nlohmann::ordered_json configuration;
+  configuration["buffer_size_mb"] = config.buffer_size_mb;
+  configuration["page_bytes"] = result.page_bytes;
+  configuration["iterations"] = config.iterations;
+  configuration["pairs"] = result.pairs.size();
+  configuration["rounds"] = config.rounds;
+  configuration["buffer_locked"] = result.buffer_locked;
+  result_json["configuration"] = std::move(configuration);
+
+  const double reference_ns = result.reference.median_ns;
+  nlohmann::ordered_json latencies;
+  latencies["reference_ns"] = reference_ns;
+  latencies["row_hit_ns"] = optional_number(result.row_hit_ns);
+  latencies["row_miss_ns"] = optional_number(result.row_miss_ns);
+  latencies["row_conflict_ns"] = optional_number(result.row_conflict_ns);
+  latencies["row_hit_excess_ns"] = excess_over(result.row_hit_ns, reference_ns);
+  latencies["row_miss_excess_ns"] = excess_over(result.row_miss_ns, reference_ns);
+  latencies["row_conflict_excess_ns"] = excess_over(result.row_conflict_ns, reference_ns);
+  result_json["latencies"] = std::move(latencies);
+
+  nlohmann::ordered_json clusters;
+  clusters["separated"] = result.clusters.separated;
+  clusters["low_center_ns"] = result.clusters.low_center_ns;
+  clusters["high_center_ns"] = result.clusters.high_center_ns;
+  clusters["threshold_ns"] = result.clusters.threshold_ns;
+  clusters["separation"] = result.clusters.separation;
+  clusters["conflict_fraction"] =
+      result.clusters.separated ? nlohmann::ordered_json(result.conflict_fraction) : nullptr;
+  clusters["estimated_banks"] = result.estimated_banks
+                                    ? nlohmann::ordered_json(*result.estimated_banks)
+                                    : nlohmann::ordered_json(nullptr);
+  result_json["clusters"] = std::move(clusters);
+
+  nlohmann::ordered_json physical;
+  physical["status"] = physical_address_status_to_string(result.physical_address_status);
+  const char* reason = bank_function_reason(result);
+  if (reason == nullptr) {
+    nlohmann::ordered_json functions = nlohmann::ordered_json::array();
+    for (uint64_t mask : result.bank_functions) {
+      functions.push_back(hex_mask(mask));
+    }
+    physical["bank_functions"] = std::move(functions);
+    physical["reason"] = nullptr;
+  } else {
+    physical["bank_functions"] = nullptr;
+    physical["reason"] = reason;
+  }
+  result_json["physical_addresses"] = std::move(physical);
+
+  nlohmann::ordered_json bits = nlohmann::ordered_json::array();
+  for (const RowBufferProbe& probe : result.bits) {
+    nlohmann::ordered_json bit_json = probe_json(probe);
+    bit_json["bit"] = floor_log2(probe.offset_bytes);
+    bits.push_back(std::move(bit_json));
+  }
+  result_json["bits"] = std::move(bits);
+
+  nlohmann::ordered_json pairs = nlohmann::ordered_json::array();
+  for (const RowBufferProbe& probe : result.pairs) {
+    pairs.push_back(probe_json(probe));
+  }
+  result_json["pairs"] = std::move(pairs);
+  result_json["total_execution_time_sec"] = total_execution_time_sec;
+  return result_json;
+}
@@ -0,0 +1,176 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file row_buffer.h
+ * @brief Standalone DRAM row-buffer probe mode interfaces
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * `-Q, --row-buffer` times a dependent load of line A followed by line B,
+ * with both lines flushed to DRAM before every repetition. Page-offset bit
+ * flips keep B in A's physical page, so low flips expose the open-row hit
+ * latency. Cross-page pairs split into a fast different-bank cluster (row
+ * miss) and a slow same-bank cluster (row conflict). When a physical address
+ * source is available the conflict pairs also yield XOR bank functions.
+ */
+#ifndef ROW_BUFFER_H
+#define ROW_BUFFER_H
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "core/config/constants.h"
+#include "third_party/nlohmann/json.hpp"
+
+enum class RowBufferClass {
+  Unclassified,  ///< Clusters did not separate
+  RowHit,        ///< Second line in the row the first one opened
+  RowMiss,       ///< Second line in another bank
+  RowConflict,   ///< Second line in another row of the same bank
+};
+
+/** @brief Virtual to physical translation; nullopt when the frame is hidden. */
+using PhysicalAddressProvider = std::function<std::optional<uint64_t>(const void* address)>;
+
+enum class PhysicalAddressStatus {
+  Unavailable,  ///< No /proc/self/pagemap on this system
+  Hidden,       ///< pagemap readable but frame numbers zeroed for this process
+  Available,
+};
+
+struct RowBufferConfig {
+  unsigned long buffer_size_mb = Constants::ROW_BUFFER_DEFAULT_BUFFER_SIZE_MB;
+  int iterations = Constants::ROW_BUFFER_DEFAULT_ITERATIONS;
+  int pairs = Constants::ROW_BUFFER_DEFAULT_PAIRS;
+  int rounds = Constants::ROW_BUFFER_DEFAULT_ROUNDS;
+  std::string output_file;
+  bool help_requested = false;
+};
+
+/** @brief One timed pair: line A at the buffer base and line B at `offset_bytes`. */
+struct RowBufferProbe {
+  size_t offset_bytes = 0;
+  std::optional<uint64_t> physical_address;  ///< Of line B, when translated
+  std::vector<double> samples_ns;            ///< Mean pair latency, one per round
+  double median_ns = 0.0;
+  RowBufferClass classification = RowBufferClass::Unclassified;
+};
+
+/** @brief Two-means split of the cross-page pair medians. */
+struct RowBufferClusters {
+  bool separated = false;
+  double low_center_ns = 0.0;
+  double high_center_ns = 0.0;
+  double threshold_ns = 0.0;  ///< Midpoint between the centers
+  double separation = 0.0;    ///< Center gap in pooled standard deviations
+  size_t high_count = 0;
+};
+
+struct RowBufferResult {
+  size_t buffer_bytes = 0;
+  size_t page_bytes = 0;
+  RowBufferProbe reference;            ///< A paired with itself: one DRAM access
+  std::vector<RowBufferProbe> bits;    ///< B = A with one page-offset bit flipped
+  std::vector<RowBufferProbe> pairs;   ///< B at the same offset of another page
+  RowBufferClusters clusters;
+  std::optional<double> row_hit_ns;
+  std::optional<double> row_miss_ns;
+  std::optional<double> row_conflict_ns;
+  double conflict_fraction = 0.0;       ///< Cross-page pairs in the conflict cluster
+  std::optional<size_t> estimated_banks;
+  PhysicalAddressStatus physical_address_status = PhysicalAddressStatus::Unavailable;
+  std::optional<uint64_t> base_physical_address;
+  std::vector<uint64_t> bank_functions;  ///< Independent XOR masks over physical address bits
+  bool buffer_locked = false;
+  bool interrupted = false;
+};
+
+const char* row_buffer_class_to_string(RowBufferClass classification);
+const char* physical_address_status_to_string(PhysicalAddressStatus status);
+
+/**
+ * @brief Distinct pages other than page 0, shuffled with `seed`.
+ * @return At most `page_count - 1` page indices.
+ */
+std::vector<size_t> build_row_buffer_pair_pages(size_t page_count, size_t pair_count,
+                                                uint64_t seed);
+
+/** @brief Optimal one-dimensional two-means split of `values`. */
+RowBufferClusters cluster_row_buffer_latencies(const std::vector<double>& values);
+
+/**
+ * @brief XOR masks that agree on every same-bank pair and split other pairs.
+ *
+ * Needs at least ROW_BUFFER_MIN_SAME_BANK_PAIRS same-bank pairs, since a
+ * handful of them agrees with almost any mask. Candidates use at most ROW_BUFFER_MAX_FUNCTION_BITS of the bits in
+ * [`low_bit`, `high_bit`) that differ in at least one pair. A mask must give equal parity for every same-bank
+ * address pair and differing parity for at least ROW_BUFFER_MIN_FUNCTION_SPLIT
+ * of the different-bank pairs. The survivors are reduced over GF(2) to an
+ * independent set, preferring masks with fewer bits.
+ */
+std::vector<uint64_t> infer_row_buffer_bank_functions(
+    const std::vector<std::pair<uint64_t, uint64_t>>& same_bank_pairs,
+    const std::vector<std::pair<uint64_t, uint64_t>>& other_bank_pairs, unsigned low_bit,
+    unsigned high_bit);
+
+/**
+ * @brief Translate the buffer base and every probe's line B.
+ *
+ * An empty provider leaves the status Unavailable; a provider that cannot
+ * translate the base marks it Hidden.
+ */
+void attach_row_buffer_physical_addresses(RowBufferResult& result, const void* base,
+                                          const PhysicalAddressProvider& provider);
+
+/**
+ * @brief Translator backed by /proc/self/pagemap.
+ * @return An empty provider when pagemap cannot be opened.
+ */
+PhysicalAddressProvider open_pagemap_physical_address_provider();
+
+/** @brief Reference, bit-flip, and cross-page probes with no samples. */
+RowBufferResult make_row_buffer_result(const RowBufferConfig& config, size_t page_bytes);
+
+/** @brief Reduce samples, cluster, classify, and infer bank functions. */
+void finalize_row_buffer_result(RowBufferResult& result);
+
+nlohmann::ordered_json build_row_buffer_json(const RowBufferConfig& config,
+                                             const RowBufferResult& result,
+                                             const std::string& cpu_name,
+                                             double total_execution_time_sec);
+
+/**
+ * @brief Parse CLI args for standalone row-buffer mode.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on parse/validation error.
+ */
+int parse_row_buffer_mode_arguments(int argc, char* argv[], RowBufferConfig& config);
+
+/**
+ * @brief Time every probe, report, and save JSON.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on runtime/IO error.
+ */
+int run_row_buffer(const RowBufferConfig& config);
+
+/**
+ * @brief Parse and run standalone row-buffer mode from main().
+ */
+int run_row_buffer_mode(int argc, char* argv[]);
+
+#endif  // ROW_BUFFER_H
@@ -0,0 +1,177 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file row_buffer_cli.cpp
+ * @brief CLI parsing for standalone row-buffer mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Parses and validates mode-specific command line options for
+ * `-Q, --row-buffer`. Like the other standalone modes, only an explicit
+ * option set is accepted.
+ */
+
+#include "benchmark/row_buffer.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+
+#include "core/config/cli_options.h"
+#include "core/config/config.h"
+#include "core/config/constants.h"
+#include "core/signal/signal_handler.h"
+#include "output/console/messages/messages_api.h"
+#include "output/console/output_printer.h"
+
+namespace {
+
+constexpr const char* OPT_ROW_BUFFER_SHORT = "-Q";
+constexpr const char* OPT_ROW_BUFFER_LONG = "--row-buffer";
+constexpr const char* OPT_ROW_PAIRS_LONG = "--row-pairs";
+constexpr const char* OPT_BUFFER_SIZE_SHORT = "-b";
+constexpr const char* OPT_BUFFER_SIZE_LONG = "--buffer-size";
+constexpr const char* OPT_ITERATIONS_SHORT = "-i";
+constexpr const char* OPT_ITERATIONS_LONG = "--iterations";
+constexpr const char* OPT_COUNT_SHORT = "-r";
+constexpr const char* OPT_COUNT_LONG = "--count";
+constexpr const char* OPT_HELP_SHORT = "-h";
+constexpr const char* OPT_HELP_LONG = "--help";
+constexpr const char* OPT_OUTPUT_SHORT = "-o";
+constexpr const char* OPT_OUTPUT_LONG = "--output";
+
+}  // namespace
+
+int parse_row_buffer_mode_arguments(int argc, char* argv[], RowBufferConfig& config) {
+  config.rounds = Constants::ROW_BUFFER_DEFAULT_ROUNDS;
+  config.buffer_size_mb = Constants::ROW_BUFFER_DEFAULT_BUFFER_SIZE_MB;
+  config.iterations = Constants::ROW_BUFFER_DEFAULT_ITERATIONS;
+  config.pairs = Constants::ROW_BUFFER_DEFAULT_PAIRS;
+
+  bool mode_seen = false;
+  bool output_seen = false;
+  bool buffer_size_seen = false;
+  bool iterations_seen = false;
+  bool count_seen = false;
+  bool pairs_seen = false;
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+
+    if (is_option(arg, OPT_ROW_BUFFER_SHORT, OPT_ROW_BUFFER_LONG)) {
+      mode_seen = true;
+      continue;
+    }
+
+    if (is_option(arg, OPT_HELP_SHORT, OPT_HELP_LONG)) {
+      print_help(argv[0]);
+      config.help_requested = true;
+      return EXIT_SUCCESS;
+    }
+
+    if (is_option(arg, OPT_OUTPUT_SHORT, OPT_OUTPUT_LONG)) {
+      if (!take_option_value(argc, argv, i, output_seen, OPT_OUTPUT_LONG)) {
+        return EXIT_FAILURE;
+      }
+      config.output_file = argv[i];
+      continue;
+    }
+
+    if (is_option(arg, OPT_BUFFER_SIZE_SHORT, OPT_BUFFER_SIZE_LONG)) {
+      if (!take_option_value(argc, argv, i, buffer_size_seen, OPT_BUFFER_SIZE_LONG)) {
+        return EXIT_FAILURE;
+      }
+      int parsed = 0;
+      if (!parse_positive_int_option(OPT_BUFFER_SIZE_LONG, argv[i], parsed, argv[0])) {
+        return EXIT_FAILURE;
+      }
+      config.buffer_size_mb = static_cast<unsigned long>(parsed);
+      continue;
+    }
+
+    if (is_option(arg, OPT_ITERATIONS_SHORT, OPT_ITERATIONS_LONG)) {
+      if (!take_option_value(argc, argv, i, iterations_seen, OPT_ITERATIONS_LONG)) {
+        return EXIT_FAILURE;
+      }
+      if (!parse_positive_int_option(OPT_ITERATIONS_LONG, argv[i], config.iterations, argv[0])) {
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (is_option(arg, OPT_COUNT_SHORT, OPT_COUNT_LONG)) {
+      if (!take_option_value(argc, argv, i, count_seen, OPT_COUNT_LONG)) {
+        return EXIT_FAILURE;
+      }
+      if (!parse_positive_int_option(OPT_COUNT_LONG, argv[i], config.rounds, argv[0])) {
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (arg == OPT_ROW_PAIRS_LONG) {
+      if (!take_option_value(argc, argv, i, pairs_seen, OPT_ROW_PAIRS_LONG)) {
+        return EXIT_FAILURE;
+      }
+      if (!parse_positive_int_option(OPT_ROW_PAIRS_LONG, argv[i], config.pairs, argv[0])) {
+        return EXIT_FAILURE;
+      }
+      // Two-means needs at least two pairs in each cluster.
+      if (config.pairs < 4 || config.pairs > Constants::ROW_BUFFER_MAX_PAIRS) {
+        std::cerr << Messages::error_prefix()
+                  << Messages::error_invalid_value(
+                         OPT_ROW_PAIRS_LONG, argv[i],
+                         "must be between 4 and " +
+                             std::to_string(Constants::ROW_BUFFER_MAX_PAIRS))
+                  << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    std::cerr << Messages::error_prefix()
+              << Messages::error_row_buffer_must_be_used_alone()
+              << std::endl;
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  if (!mode_seen) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_row_buffer_must_be_used_alone()
+              << std::endl;
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+int run_row_buffer_mode(int argc, char* argv[]) {
+  RowBufferConfig config;
+  if (parse_row_buffer_mode_arguments(argc, argv, config) != EXIT_SUCCESS) {
+    return EXIT_FAILURE;
+  }
+  if (config.help_requested) {
+    return EXIT_SUCCESS;
+  }
+
+  BenchmarkSignalMaskGuard signal_guard;
+  return run_row_buffer(config);
+}
@@ -0,0 +1,205 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file row_buffer_runner.cpp
+ * @brief Flush and reload pair timing for row-buffer mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Every repetition loads line A, then line B at an address that depends on
+ * the value A returned, and cleans and invalidates both lines to the point
+ * of coherency before the next repetition. The second load therefore finds
+ * either the row A opened, an idle bank, or a bank whose open row must be
+ * closed first. The buffer is zero-filled, so each loaded value is a zero
+ * offset that chains the loads without changing the addresses.
+ */
+
+#include "benchmark/row_buffer.h"
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark_work_plan.h"
+#include "benchmark/buffer_residency.h"
+#include "core/config/constants.h"
+#include "core/memory/memory_manager.h"
+#include "core/signal/signal_handler.h"
+#include "core/system/system_info.h"
+#include "core/timing/timer.h"
+#include "output/console/messages/messages_api.h"
+#include "output/console/output_printer.h"
+#include "output/json/json_output/json_output_api.h"
+
+namespace {
+
+inline void flush_line(const void* address) {
+  asm volatile("dc civac, %0" : : "r"(address) : "memory");
+}
+
+// Mean nanoseconds for one dependent A-then-B load pair from DRAM.
+double time_row_buffer_pair(const char* line_a, const char* line_b, int iterations,
+                            HighResTimer& timer, uint64_t& checksum) {
+  uint64_t link = 0;
+  timer.start();
+  for (int iteration = 0; iteration < iterations; ++iteration) {
+    const char* first = line_a + link;
+    link = *reinterpret_cast<const volatile uint64_t*>(first);
+    const char* second = line_b + link;
+    link = *reinterpret_cast<const volatile uint64_t*>(second);
+    flush_line(first);
+    flush_line(second);
+    asm volatile("dsb sy" ::: "memory");
+  }
+  const double elapsed_ns = timer.stop_ns();
+  checksum ^= link;
+  return elapsed_ns / static_cast<double>(iterations);
+}
+
+void print_row_buffer_report(const RowBufferResult& result) {
+  const double reference_ns = result.reference.median_ns;
+  std::cout << std::endl << Messages::report_row_buffer_header() << std::endl;
+  std::cout << Messages::report_row_buffer_note() << std::endl;
+  std::cout << Messages::report_row_buffer_latency_row("reference", reference_ns, reference_ns)
+            << std::endl;
+  std::cout << Messages::report_row_buffer_latency_row("row hit", result.row_hit_ns, reference_ns)
+            << std::endl;
+  std::cout << Messages::report_row_buffer_latency_row("row miss", result.row_miss_ns,
+                                                       reference_ns)
+            << std::endl;
+  std::cout << Messages::report_row_buffer_latency_row("row conflict", result.row_conflict_ns,
+                                                       reference_ns)
+            << std::endl;
+  std::cout << Messages::report_row_buffer_clusters(
+                   result.clusters.separated, result.clusters.separation,
+                   result.conflict_fraction, result.estimated_banks)
+            << std::endl;
+  std::cout << Messages::report_row_buffer_bits_header() << std::endl;
+  for (const RowBufferProbe& probe : result.bits) {
+    if (probe.samples_ns.empty()) {
+      continue;
+    }
+    std::cout << Messages::report_row_buffer_bit_row(
+                     probe.offset_bytes, probe.median_ns,
+                     row_buffer_class_to_string(probe.classification))
+              << std::endl;
+  }
+  std::cout << Messages::report_row_buffer_physical(
+                   physical_address_status_to_string(result.physical_address_status),
+                   result.bank_functions)
+            << std::endl;
+}
+
+int fail_row_buffer(const std::string& reason) {
+  std::cerr << Messages::error_prefix() << Messages::error_row_buffer_failed(reason) << std::endl;
+  return EXIT_FAILURE;
+}
+
+}  // namespace
+
+int run_row_buffer(const RowBufferConfig& config) {
+  print_runtime_banner();
+  const size_t page_bytes = static_cast<size_t>(getpagesize());
+  RowBufferResult result = make_row_buffer_result(config, page_bytes);
+  if (result.pairs.size() < 4) {
+    return fail_row_buffer("the buffer holds fewer than 5 pages");
+  }
+  std::cout << Messages::msg_running_row_buffer(config.buffer_size_mb, page_bytes,
+                                                result.pairs.size(), config.iterations)
+            << std::endl;
+  const auto run_start = std::chrono::steady_clock::now();
+
+  MmapPtr buffer = allocate_buffer(result.buffer_bytes, "row-buffer probe");
+  if (!buffer) {
+    return fail_row_buffer("buffer allocation");
+  }
+  // Zero fill faults every page in and makes each loaded value a zero link.
+  std::memset(buffer.get(), 0, result.buffer_bytes);
+  BufferLockState lock = make_buffer_lock_state(true);
+  lock_phase_buffer(buffer.get(), result.buffer_bytes, lock);
+  result.buffer_locked = lock.locked;
+  if (!lock.locked) {
+    std::cerr << Messages::warning_prefix()
+              << Messages::warning_buffer_lock_failed(lock.error, std::strerror(lock.error),
+                                                      lock.memlock_limit_bytes)
+              << std::endl;
+  }
+  attach_row_buffer_physical_addresses(result, buffer.get(),
+                                       open_pagemap_physical_address_provider());
+
+  auto timer_optional = HighResTimer::create();
+  if (!timer_optional) {
+    std::cerr << Messages::error_prefix() << Messages::error_timer_creation_failed() << std::endl;
+    return EXIT_FAILURE;
+  }
+  HighResTimer& timer = *timer_optional;
+
+  std::vector<RowBufferProbe*> probes;
+  probes.push_back(&result.reference);
+  for (RowBufferProbe& probe : result.bits) {
+    probes.push_back(&probe);
+  }
+  for (RowBufferProbe& probe : result.pairs) {
+    probes.push_back(&probe);
+  }
+
+  const char* base = static_cast<const char*>(buffer.get());
+  uint64_t checksum = 0;
+  // One untimed pass settles the TLB entries and frequency before round one.
+  for (RowBufferProbe* probe : probes) {
+    time_row_buffer_pair(base, base + probe->offset_bytes, config.iterations, timer, checksum);
+  }
+  for (int round = 0; round < config.rounds && !result.interrupted; ++round) {
+    for (size_t index : build_benchmark_cyclic_order(probes.size(), static_cast<size_t>(round))) {
+      RowBufferProbe& probe = *probes[index];
+      probe.samples_ns.push_back(time_row_buffer_pair(base, base + probe.offset_bytes,
+                                                      config.iterations, timer, checksum));
+      if (signal_received()) {
+        result.interrupted = true;
+        break;
+      }
+    }
+  }
+  if (result.interrupted) {
+    std::cout << std::endl << Messages::msg_interrupted_by_user() << std::endl;
+  }
+
+  finalize_row_buffer_result(result);
+  print_row_buffer_report(result);
+
+  if (!config.output_file.empty()) {
+    const double total_execution_time_sec =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - run_start).count();
+    std::filesystem::path output_path(config.output_file);
+    if (output_path.is_relative()) {
+      output_path = std::filesystem::current_path() / output_path;
+    }
+    if (write_json_to_file(output_path,
+                           build_row_buffer_json(config, result, get_processor_name(),
+                                                 total_execution_time_sec)) != EXIT_SUCCESS) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
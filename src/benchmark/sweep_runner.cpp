@@ -23,11 +23,13 @@
 #include <algorithm>
 #include <filesystem>
 #include <iostream>
+#include <optional>
 #include <string>
 #include <unistd.h>
 #include <vector>
 
 #include "benchmark/benchmark_runner.h"
+#include "benchmark/benchmark_statistics_collector.h"
 #include "benchmark/tlb_analysis.h"
 #include "core/config/config.h"
 #include "core/config/constants.h"
@@ -227,6 +229,17 @@ int run_standard_sweep_point(BenchmarkConfig& run_config, nlohmann::ordered_json
                    stats.all_custom_latency_samples,
                    run_config.only_bandwidth,
                    run_config.only_latency);
+  const std::optional<CoreFrequencyLoopDrift> frequency_drift =
+      find_largest_core_frequency_drift(stats);
+  if (frequency_drift.has_value() &&
+      frequency_drift->drift_pct > Constants::CORE_FREQUENCY_DRIFT_WARNING_PCT) {
+    std::cerr << Messages::warning_prefix()
+              << Messages::warning_core_frequency_drift(
+                     frequency_drift->measurement_name, frequency_drift->min_ghz,
+                     frequency_drift->max_ghz, frequency_drift->drift_pct,
+                     Constants::CORE_FREQUENCY_DRIFT_WARNING_PCT)
+              << std::endl;
+  }
   result_json = build_results_json(run_config, stats, elapsed_sec);
   return EXIT_SUCCESS;
 }
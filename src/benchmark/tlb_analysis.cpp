@@ -41,6 +41,8 @@
 #include "benchmark/benchmark_tests.h"
 #include "benchmark/tlb_analysis_json.h"
 #include "benchmark/tlb_chain.h"
+#include "benchmark/tlb_chain_cache.h"
+#include "benchmark/tlb_chain_prebuilder.h"
 #include "benchmark/tlb_measurement_scheduler.h"
 #include "benchmark/tlb_runtime_policy.h"
 #include "benchmark/tlb_sweep_planner.h"
@@ -60,6 +62,7 @@ namespace {
 
 constexpr size_t kPageWalkComparisonLocalityBytes = 512 * Constants::BYTES_PER_MB;
 constexpr size_t kPageWalkMinimumBufferMb = 512;
+constexpr size_t kPageTableComparisonPages = 4096;
 
 const std::array<size_t, 3> kBufferCandidateMb = {1024, 512, 256};
 
@@ -109,7 +112,8 @@ TlbPassExecutionSummary summarize_tlb_pass(
           result.rounds_completed,
           result.converged,
           result.status == TlbScheduleExecutionStatus::Complete,
-          result.status};
+          result.status,
+          result.retired_points};
 }
 
 void print_tlb_pass_completion(
@@ -283,7 +287,34 @@ TlbChainTraversalPolicy tlb_chain_policy_for_mode(LatencyChainMode mode) {
   return TlbChainTraversalPolicy::RandomPagesRandomOffsets;
 }
 
-TlbTaskMeasureStatus measure_tlb_chain(
+/** Layouts stored in the spread and packed slots of one pass's pairs. */
+std::pair<TlbChainLayout, TlbChainLayout> tlb_pass_layouts(
+    TlbMeasurementPass pass) {
+  if (pass == TlbMeasurementPass::PageTableFootprint) {
+    return {TlbChainLayout::TableSpread, TlbChainLayout::TableDense};
+  }
+  return {TlbChainLayout::Spread, TlbChainLayout::Packed};
+}
+
+/** Seed, buffer placement, and cache state of one pair member before timing. */
+struct PreparedTlbChain {
+  TlbChainLayout layout = TlbChainLayout::Spread;
+  bool needs_build = false;
+  bool retained = false;
+  size_t region_offset_bytes = 0;
+  size_t region_size_bytes = 0;
+  void* chain_head = nullptr;
+  TlbChainBuildRequest request;
+};
+
+/**
+ * Resolve one pair member's seed and buffer region without writing the buffer.
+ *
+ * Cached chains are reused directly. Without a cache, spread chains start at the
+ * buffer base and packed chains use the page-aligned buffer tail when it does
+ * not overlap the spread footprint, which lets both members be built at once.
+ */
+TlbTaskMeasureStatus prepare_tlb_chain(
     void* latency_buffer,
     size_t buffer_size_bytes,
     size_t stride_bytes,
@@ -291,48 +322,163 @@ TlbTaskMeasureStatus measure_tlb_chain(
     const TlbMeasurementTask& task,
     TlbChainLayout layout,
     TlbChainTraversalPolicy traversal_policy,
-    HighResTimer& timer,
-    const TlbRuntimeProfile& runtime_profile,
-    TlbChainScratch& scratch,
-    TlbChainMeasurement& measurement) {
+    TlbChainCache* chain_cache,
+    uint64_t base_seed,
+    TlbChainMeasurement& measurement,
+    PreparedTlbChain& prepared) {
   if (task.locality_bytes == 0 ||
       (task.locality_bytes % page_size_bytes) != 0) {
     return TlbTaskMeasureStatus::Error;
   }
 
-  measurement.seed = derive_tlb_chain_layout_seed(task.seed, layout);
   const size_t requested_pages = task.locality_bytes / page_size_bytes;
-  const TlbChainBuildResult chain = build_tlb_chain(latency_buffer,
-                                                    buffer_size_bytes,
-                                                    requested_pages,
-                                                    page_size_bytes,
-                                                    stride_bytes,
-                                                    layout,
-                                                    traversal_policy,
-                                                    measurement.seed,
-                                                    scratch);
+  uint64_t layout_task_seed = task.seed;
+  measurement.layout_identity = task.round_index;
+  measurement.layout_reused = false;
+  if (chain_cache != nullptr) {
+    measurement.layout_identity = tlb_chain_layout_identity(
+        task.round_index, chain_cache->layout_identities);
+    layout_task_seed = derive_tlb_layout_identity_seed(
+        base_seed, task.pass, measurement.layout_identity, task.point_index);
+  }
+  measurement.seed = derive_tlb_chain_layout_seed(layout_task_seed, layout);
+
+  prepared = PreparedTlbChain{};
+  prepared.layout = layout;
+  const TlbChainCacheEntry* cached_chain =
+      chain_cache == nullptr
+          ? nullptr
+          : find_tlb_chain_cache_entry(*chain_cache,
+                                       layout,
+                                       task.point_index,
+                                       measurement.layout_identity);
+  if (cached_chain != nullptr) {
+    prepared.chain_head = cached_chain->chain_head;
+    prepared.region_offset_bytes = cached_chain->region_offset_bytes;
+    prepared.region_size_bytes = cached_chain->region_size_bytes;
+    measurement.diagnostics = cached_chain->diagnostics;
+    measurement.layout_reused = true;
+    return TlbTaskMeasureStatus::Success;
+  }
+
+  prepared.region_size_bytes =
+      tlb_chain_region_bytes(requested_pages, page_size_bytes, layout);
+  if (layout == TlbChainLayout::TableSpread) {
+    prepared.region_size_bytes = buffer_size_bytes;
+  } else if (chain_cache != nullptr) {
+    prepared.region_offset_bytes = reserve_tlb_chain_region(
+        *chain_cache, prepared.region_size_bytes, prepared.retained);
+  } else if (layout == TlbChainLayout::Packed &&
+             task.locality_bytes <= buffer_size_bytes &&
+             prepared.region_size_bytes <=
+                 buffer_size_bytes - task.locality_bytes) {
+    const size_t tail_offset = buffer_size_bytes - prepared.region_size_bytes;
+    prepared.region_offset_bytes = tail_offset - (tail_offset % page_size_bytes);
+  }
+  prepared.needs_build = true;
+  prepared.request = TlbChainBuildRequest{
+      static_cast<char*>(latency_buffer) + prepared.region_offset_bytes,
+      prepared.region_size_bytes,
+      requested_pages,
+      page_size_bytes,
+      stride_bytes,
+      layout,
+      traversal_policy,
+      measurement.seed,
+  };
+  return TlbTaskMeasureStatus::Success;
+}
+
+/** Record a finished build, reporting failures and retaining cacheable chains. */
+TlbTaskMeasureStatus finish_tlb_chain_build(
+    const TlbMeasurementTask& task,
+    const TlbChainBuildResult& chain,
+    TlbChainCache* chain_cache,
+    TlbChainMeasurement& measurement,
+    PreparedTlbChain& prepared) {
   if (chain.status != TlbChainBuildStatus::Success) {
     std::cerr << Messages::error_prefix()
               << Messages::error_tlb_chain_setup_failed(
                      task.locality_bytes / Constants::BYTES_PER_KB,
-                     tlb_chain_layout_to_string(layout),
+                     tlb_chain_layout_to_string(prepared.layout),
                      tlb_chain_build_status_to_string(chain.status),
                      tlb_chain_validation_status_to_string(
                          chain.validation_status))
               << std::endl;
     return TlbTaskMeasureStatus::Error;
   }
-
+  prepared.chain_head = chain.chain_head;
+  prepared.needs_build = false;
   measurement.diagnostics = chain.diagnostics;
+  if (prepared.retained && chain_cache != nullptr) {
+    chain_cache->entries.push_back(TlbChainCacheEntry{
+        prepared.layout,
+        task.point_index,
+        measurement.layout_identity,
+        prepared.region_offset_bytes,
+        prepared.region_size_bytes,
+        chain.chain_head,
+        chain.diagnostics,
+    });
+  }
+  return TlbTaskMeasureStatus::Success;
+}
+
+/** Build a prepared chain on the calling thread when it is not built yet. */
+TlbTaskMeasureStatus build_prepared_tlb_chain(
+    const TlbMeasurementTask& task,
+    TlbChainScratch& scratch,
+    TlbChainCache* chain_cache,
+    TlbChainMeasurement& measurement,
+    PreparedTlbChain& prepared) {
+  if (!prepared.needs_build) {
+    return TlbTaskMeasureStatus::Success;
+  }
+  return finish_tlb_chain_build(task,
+                                build_tlb_chain_request(prepared.request, scratch),
+                                chain_cache,
+                                measurement,
+                                prepared);
+}
+
+/** First member of the following task, prepared once the current task is timed. */
+struct NextTlbChain {
+  bool available = false;
+  bool in_flight = false;
+  TlbMeasurementTask task;
+  PreparedTlbChain chain;
+  TlbChainMeasurement measurement;
+};
+
+bool tlb_chain_regions_overlap(const PreparedTlbChain& lhs,
+                               const PreparedTlbChain& rhs) {
+  return lhs.region_offset_bytes <
+             rhs.region_offset_bytes + rhs.region_size_bytes &&
+         rhs.region_offset_bytes <
+             lhs.region_offset_bytes + lhs.region_size_bytes;
+}
+
+/** Warm, pilot, calibrate, and time one built chain. */
+TlbTaskMeasureStatus time_tlb_chain(
+    void* latency_buffer,
+    size_t buffer_size_bytes,
+    size_t page_size_bytes,
+    const TlbMeasurementTask& task,
+    const PreparedTlbChain& prepared,
+    HighResTimer& timer,
+    const TlbRuntimeProfile& runtime_profile,
+    TlbChainMeasurement& measurement) {
   const size_t warmup_bytes =
-      layout == TlbChainLayout::Spread
-          ? task.locality_bytes
-          : chain.diagnostics.actual_pages * page_size_bytes;
-  warmup_latency(latency_buffer, std::min(warmup_bytes, buffer_size_bytes));
+      prepared.layout == TlbChainLayout::Packed
+          ? measurement.diagnostics.actual_pages * page_size_bytes
+          : prepared.region_size_bytes;
+  warmup_latency(static_cast<char*>(latency_buffer) + prepared.region_offset_bytes,
+                 std::min(warmup_bytes,
+                          buffer_size_bytes - prepared.region_offset_bytes));
   measurement.pilot_access_count =
-      calculate_tlb_pilot_accesses(chain.diagnostics.node_count);
+      calculate_tlb_pilot_accesses(measurement.diagnostics.node_count);
   measurement.pilot_duration_ns = run_latency_test(
-      chain.chain_head, measurement.pilot_access_count, timer, nullptr, 0);
+      prepared.chain_head, measurement.pilot_access_count, timer, nullptr, 0);
   if (measurement.pilot_access_count == 0 ||
       measurement.pilot_duration_ns <= 0.0 ||
       !std::isfinite(measurement.pilot_duration_ns)) {
@@ -344,7 +490,7 @@ TlbTaskMeasureStatus measure_tlb_chain(
     return TlbTaskMeasureStatus::Error;
   }
   measurement.access_count = calculate_tlb_calibrated_accesses(
-      chain.diagnostics.node_count,
+      measurement.diagnostics.node_count,
       measurement.pilot_access_count,
       measurement.pilot_duration_ns,
       runtime_profile);
@@ -357,7 +503,7 @@ TlbTaskMeasureStatus measure_tlb_chain(
     return TlbTaskMeasureStatus::Error;
   }
   const double total_latency_ns = run_latency_test(
-      chain.chain_head, measurement.access_count, timer, nullptr, 0);
+      prepared.chain_head, measurement.access_count, timer, nullptr, 0);
   if (total_latency_ns <= 0.0 || std::isnan(total_latency_ns) ||
       std::isinf(total_latency_ns)) {
     std::cerr << Messages::error_prefix()
@@ -398,10 +544,17 @@ void append_measurement_records(
 }
 
 /**
- * @brief Execute a balanced seeded round schedule and aggregate locality medians.
+ * @brief Execute balanced seeded rounds with per-point retirement and aggregate medians.
  *
- * Each round measures every supplied point once. The scheduler rotates the seeded
- * point order between rounds so locality and elapsed run time are not correlated.
+ * Each round measures every still-active point once. The scheduler rotates the
+ * seeded point order between rounds so locality and elapsed run time are not
+ * correlated. After the minimum rounds, points whose paired-delta CI is narrow
+ * enough retire, so later rounds concentrate on unresolved and boundary points.
+ * A nonzero layout-identity count cycles rounds through that many chain layouts
+ * per point and reuses chains retained in disjoint buffer regions. When the
+ * buffer cannot hold the pass's largest chain region beside the retained
+ * chains, the pass warns, rebuilds every chain, and sets
+ * `chain_reuse_unavailable`.
  */
 TlbScheduleExecutionResult measure_scheduled_points(
     void* latency_buffer,
@@ -414,17 +567,62 @@ TlbScheduleExecutionResult measure_scheduled_points(
     uint64_t base_seed,
     TlbMeasurementPass pass,
     const TlbRuntimeProfile& runtime_profile,
+    size_t chain_layout_identities,
     const TlbStopRequested& stop_requested,
-    std::vector<LocalityMeasurement>& measurements) {
+    std::vector<LocalityMeasurement>& measurements,
+    bool& chain_reuse_unavailable) {
   ProgressSpinner spinner;
   TlbChainScratch chain_scratch;
+  TlbChainPrebuilder chain_prebuilder;
+  TlbChainCache chain_cache;
+  size_t maximum_region_bytes = 0;
+  for (const TlbSweepPoint& point : points) {
+    maximum_region_bytes = std::max(
+        maximum_region_bytes,
+        tlb_chain_region_bytes(point.locality_bytes / page_size_bytes,
+                               page_size_bytes,
+                               TlbChainLayout::Spread));
+  }
+  // Failure only means validation grows the scratch on demand.
+  (void)reserve_tlb_chain_scratch(chain_scratch, maximum_region_bytes,
+                                  page_size_bytes);
+  (void)chain_prebuilder.reserve_scratch(maximum_region_bytes,
+                                         page_size_bytes);
+  const std::pair<TlbChainLayout, TlbChainLayout> pass_layouts =
+      tlb_pass_layouts(pass);
+  TlbChainCache* active_chain_cache =
+      pass != TlbMeasurementPass::PageTableFootprint &&
+              reset_tlb_chain_cache(chain_cache,
+                                    chain_layout_identities,
+                                    buffer_size_bytes,
+                                    page_size_bytes,
+                                    maximum_region_bytes)
+          ? &chain_cache
+          : nullptr;
+  chain_reuse_unavailable = chain_layout_identities > 0 &&
+                            pass != TlbMeasurementPass::PageTableFootprint &&
+                            active_chain_cache == nullptr;
+  if (chain_reuse_unavailable) {
+    std::cerr << Messages::warning_prefix()
+              << Messages::warning_tlb_chain_reuse_unavailable(
+                     tlb_measurement_pass_to_string(pass), chain_layout_identities)
+              << std::endl;
+  }
   TlbConvergenceScratch convergence_scratch;
   std::vector<std::vector<double>> convergence_samples(points.size());
-  const std::vector<TlbMeasurementTask> schedule =
-      build_tlb_measurement_schedule(
-          points, runtime_profile.max_rounds, base_seed, pass);
-  TlbScheduleExecutionResult result = execute_tlb_measurement_schedule(
-      schedule,
+  std::vector<size_t> point_localities_bytes;
+  point_localities_bytes.reserve(points.size());
+  for (const TlbSweepPoint& point : points) {
+    point_localities_bytes.push_back(point.locality_bytes);
+  }
+  TlbMeasurementTask next_task;
+  bool next_task_available = false;
+  NextTlbChain next_chain;
+  TlbScheduleExecutionResult result = execute_tlb_sequential_schedule(
+      points,
+      runtime_profile.max_rounds,
+      base_seed,
+      pass,
       stop_requested,
       [&](const TlbMeasurementTask& task, TlbMeasurementSample& sample) {
         const size_t locality_kb = task.locality_bytes / Constants::BYTES_PER_KB;
@@ -439,39 +637,148 @@ TlbScheduleExecutionResult measure_scheduled_points(
             tlb_measure_spread_first(task);
         const TlbChainTraversalPolicy traversal_policy =
             tlb_chain_policy_for_mode(chain_mode);
-        auto measure_layout = [&](TlbChainLayout layout,
-                                  TlbChainMeasurement& measurement) {
-          return measure_tlb_chain(latency_buffer,
+        const bool spread_first = sample.paired.spread_measured_first;
+        TlbChainMeasurement& first_measurement =
+            spread_first ? sample.paired.spread : sample.paired.packed;
+        TlbChainMeasurement& second_measurement =
+            spread_first ? sample.paired.packed : sample.paired.spread;
+        PreparedTlbChain first_chain;
+        PreparedTlbChain second_chain;
+        auto prepare_layout = [&](TlbChainLayout layout,
+                                  TlbChainMeasurement& measurement,
+                                  PreparedTlbChain& prepared) {
+          return prepare_tlb_chain(latency_buffer,
                                    buffer_size_bytes,
                                    stride_bytes,
                                    page_size_bytes,
                                    task,
                                    layout,
                                    traversal_policy,
-                                   timer,
-                                   runtime_profile,
-                                   chain_scratch,
-                                   measurement);
+                                   active_chain_cache,
+                                   base_seed,
+                                   measurement,
+                                   prepared);
+        };
+        auto time_layout = [&](const PreparedTlbChain& prepared,
+                               TlbChainMeasurement& measurement) {
+          return time_tlb_chain(latency_buffer,
+                                buffer_size_bytes,
+                                page_size_bytes,
+                                task,
+                                prepared,
+                                timer,
+                                runtime_profile,
+                                measurement);
+        };
+        // A first member prepared at the end of the previous task keeps its
+        // cache reservation; preparing it again would reserve a second region.
+        const bool use_next_chain =
+            next_chain.available &&
+            next_chain.task.point_index == task.point_index &&
+            next_chain.task.round_index == task.round_index &&
+            next_chain.task.seed == task.seed;
+        const bool next_chain_in_flight =
+            use_next_chain && next_chain.in_flight;
+        if (next_chain.in_flight && !use_next_chain) {
+          (void)chain_prebuilder.wait();
+        }
+        next_chain.available = false;
+        next_chain.in_flight = false;
+        if (use_next_chain) {
+          first_chain = next_chain.chain;
+          first_measurement = next_chain.measurement;
+        }
+        auto join_first_chain = [&]() {
+          return finish_tlb_chain_build(task,
+                                        chain_prebuilder.wait(),
+                                        active_chain_cache,
+                                        first_measurement,
+                                        first_chain);
         };
+        if ((!use_next_chain &&
+             prepare_layout(spread_first ? pass_layouts.first
+                                         : pass_layouts.second,
+                            first_measurement,
+                            first_chain) != TlbTaskMeasureStatus::Success) ||
+            prepare_layout(spread_first ? pass_layouts.second
+                                        : pass_layouts.first,
+                           second_measurement,
+                           second_chain) != TlbTaskMeasureStatus::Success) {
+          if (next_chain_in_flight) {
+            (void)chain_prebuilder.wait();
+          }
+          return TlbTaskMeasureStatus::Error;
+        }
 
-        if (sample.paired.spread_measured_first) {
-          if (measure_layout(TlbChainLayout::Spread,
-                             sample.paired.spread) !=
-                  TlbTaskMeasureStatus::Success ||
-              measure_layout(TlbChainLayout::Packed,
-                             sample.paired.packed) !=
-                  TlbTaskMeasureStatus::Success) {
+        if (next_chain_in_flight) {
+          // The helper started on the first member after the previous task's
+          // timed traversal; build the second member alongside it when the
+          // regions allow, and join before this task's first timed region.
+          TlbTaskMeasureStatus second_status = TlbTaskMeasureStatus::Success;
+          if (second_chain.needs_build &&
+              !tlb_chain_regions_overlap(first_chain, second_chain)) {
+            second_status = build_prepared_tlb_chain(
+                task, chain_scratch, active_chain_cache, second_measurement,
+                second_chain);
+          }
+          if (join_first_chain() != TlbTaskMeasureStatus::Success ||
+              second_status != TlbTaskMeasureStatus::Success) {
+            return TlbTaskMeasureStatus::Error;
+          }
+        } else if (first_chain.needs_build && second_chain.needs_build &&
+                   !tlb_chain_regions_overlap(first_chain, second_chain) &&
+                   chain_prebuilder.submit(first_chain.request)) {
+          // Fallback when nothing was prebuilt: build both members at once
+          // in disjoint regions, idle again before the first timed region.
+          const TlbTaskMeasureStatus second_status = build_prepared_tlb_chain(
+              task, chain_scratch, active_chain_cache, second_measurement,
+              second_chain);
+          if (join_first_chain() != TlbTaskMeasureStatus::Success ||
+              second_status != TlbTaskMeasureStatus::Success) {
             return TlbTaskMeasureStatus::Error;
           }
-        } else if (measure_layout(TlbChainLayout::Packed,
-                                  sample.paired.packed) !=
-                       TlbTaskMeasureStatus::Success ||
-                   measure_layout(TlbChainLayout::Spread,
-                                  sample.paired.spread) !=
-                       TlbTaskMeasureStatus::Success) {
+        }
+
+        if (build_prepared_tlb_chain(task, chain_scratch, active_chain_cache,
+                                     first_measurement, first_chain) !=
+                TlbTaskMeasureStatus::Success ||
+            time_layout(first_chain, first_measurement) !=
+                TlbTaskMeasureStatus::Success ||
+            build_prepared_tlb_chain(task, chain_scratch, active_chain_cache,
+                                     second_measurement, second_chain) !=
+                TlbTaskMeasureStatus::Success ||
+            time_layout(second_chain, second_measurement) !=
+                TlbTaskMeasureStatus::Success) {
           return TlbTaskMeasureStatus::Error;
         }
 
+        // Both timed traversals are done: hand the next task's first member
+        // to the helper so its build overlaps this task's bookkeeping and the
+        // next task's second build. Preparing it only now keeps the cache
+        // reservation order identical to a serial pass.
+        if (next_task_available) {
+          next_chain.task = next_task;
+          const bool next_spread_first = tlb_measure_spread_first(next_task);
+          if (prepare_tlb_chain(latency_buffer,
+                                buffer_size_bytes,
+                                stride_bytes,
+                                page_size_bytes,
+                                next_task,
+                                next_spread_first ? pass_layouts.first
+                                                  : pass_layouts.second,
+                                traversal_policy,
+                                active_chain_cache,
+                                base_seed,
+                                next_chain.measurement,
+                                next_chain.chain) ==
+              TlbTaskMeasureStatus::Success) {
+            next_chain.available = true;
+            next_chain.in_flight =
+                next_chain.chain.needs_build &&
+                chain_prebuilder.submit(next_chain.chain.request);
+          }
+        }
+
         sample.latency_ns = sample.paired.spread.latency_ns;
         sample.paired.translation_delta_ns =
             sample.paired.spread.latency_ns -
@@ -490,17 +797,28 @@ TlbScheduleExecutionResult measure_scheduled_points(
         return TlbTaskMeasureStatus::Success;
       },
       [&](size_t completed_rounds,
-          const std::vector<TlbMeasurementRecord>&) {
+          const std::vector<TlbMeasurementRecord>&,
+          std::vector<uint8_t>& active_points) {
         if (completed_rounds < runtime_profile.min_rounds) {
-          return false;
+          return;
+        }
+        (void)update_tlb_active_points(point_localities_bytes,
+                                       convergence_samples,
+                                       runtime_profile,
+                                       base_seed ^ static_cast<uint64_t>(pass),
+                                       active_points,
+                                       &convergence_scratch);
+      },
+      [&](const TlbMeasurementTask* announced_task) {
+        next_task_available = announced_task != nullptr;
+        if (next_task_available) {
+          next_task = *announced_task;
         }
-        const TlbConvergenceSummary convergence = evaluate_tlb_convergence(
-            convergence_samples,
-            runtime_profile,
-            base_seed ^ static_cast<uint64_t>(pass),
-            &convergence_scratch);
-        return convergence.converged;
       });
+  // An interrupted or failed pass can leave the next task's build running.
+  if (next_chain.in_flight) {
+    (void)chain_prebuilder.wait();
+  }
 
   append_measurement_records(result.records, measurements);
   return result;
@@ -829,6 +1147,7 @@ int run_tlb_analysis_impl(
       localities_bytes.size() * runtime_profile.max_rounds);
   std::vector<TlbPassExecutionSummary> pass_summaries;
   pass_summaries.reserve(4);
+  std::vector<std::string> chain_reuse_unavailable_passes;
   bool measurement_error = false;
 
   auto execute_measurement_pass =
@@ -846,7 +1165,8 @@ int run_tlb_analysis_impl(
           append_measurement_records(result.records, pass_measurements);
           return result;
         }
-        return measure_scheduled_points(
+        bool chain_reuse_unavailable = false;
+        TlbScheduleExecutionResult result = measure_scheduled_points(
             latency_buffer.get(),
             selected_buffer_bytes,
             analysis_stride_bytes,
@@ -857,8 +1177,15 @@ int run_tlb_analysis_impl(
             config.tlb_seed,
             pass,
             runtime_profile,
+            config.tlb_chain_layouts,
             stop_requested,
-            pass_measurements);
+            pass_measurements,
+            chain_reuse_unavailable);
+        if (chain_reuse_unavailable) {
+          chain_reuse_unavailable_passes.push_back(
+              tlb_measurement_pass_to_string(pass));
+        }
+        return result;
       };
 
   std::cout << std::fixed;
@@ -1208,6 +1535,60 @@ int run_tlb_analysis_impl(
     }
   }
 
+  TlbPairedPointSummary page_table_summary;
+  bool page_table_comparison_completed = false;
+  bool page_table_pass_completed = false;
+  const bool page_table_planned =
+      large_locality_pass_completed && !interrupted && !measurement_error &&
+      tlb_table_spread_page_stride(selected_buffer_bytes,
+                                   kPageTableComparisonPages,
+                                   page_size_bytes) != 0;
+  const size_t page_table_locality_bytes =
+      page_table_planned ? kPageTableComparisonPages * page_size_bytes : 0;
+  if (page_table_planned) {
+    TlbSweepPoint table_point;
+    table_point.point_index = planned_points + validation_points.size() + 1;
+    table_point.requested_pages = kPageTableComparisonPages;
+    table_point.effective_pages = table_point.requested_pages;
+    table_point.locality_bytes = page_table_locality_bytes;
+    table_point.stride_bytes = analysis_stride_bytes;
+    table_point.pointer_count = table_point.requested_pages;
+    table_point.refinement_source = "page-table-footprint";
+    print_tlb_work_estimate(
+        "page-table-footprint",
+        estimate_tlb_work(1,
+                          estimated_peak_memory_bytes,
+                          table_point.requested_pages,
+                          runtime_profile));
+    std::vector<LocalityMeasurement> table_measurements;
+    const TlbScheduleExecutionResult table_result =
+        execute_measurement_pass({table_point},
+                                 TlbMeasurementPass::PageTableFootprint,
+                                 table_measurements);
+    measurement_records.insert(measurement_records.end(),
+                               table_result.records.begin(),
+                               table_result.records.end());
+    pass_summaries.push_back(summarize_tlb_pass(
+        TlbMeasurementPass::PageTableFootprint, 1, table_result));
+    print_tlb_pass_completion(TlbMeasurementPass::PageTableFootprint,
+                              table_result);
+    if (table_result.status == TlbScheduleExecutionStatus::Interrupted) {
+      interrupted = true;
+      report_interrupt_once();
+    } else if (table_result.status == TlbScheduleExecutionStatus::Error) {
+      measurement_error = true;
+    }
+    page_table_pass_completed =
+        table_result.status == TlbScheduleExecutionStatus::Complete;
+    if (page_table_pass_completed && !table_measurements.empty()) {
+      page_table_summary = summarize_tlb_paired_point(
+          measurement_records,
+          page_table_locality_bytes,
+          {TlbMeasurementPass::PageTableFootprint});
+      page_table_comparison_completed = page_table_summary.available;
+    }
+  }
+
   if (!interrupted && stop_requested && stop_requested()) {
     interrupted = true;
     report_interrupt_once();
@@ -1231,6 +1612,7 @@ int run_tlb_analysis_impl(
     private_cache_to_l1_distance_pages = 0;
     private_cache_interference_elevated = false;
     page_walk_comparison_completed = false;
+    page_table_comparison_completed = false;
   }
 
   if (buffer_locked) {
@@ -1325,6 +1707,10 @@ int run_tlb_analysis_impl(
                      l1_entry_range.second)
               << std::endl;
     std::cout << Messages::report_tlb_inferred_size_entries(l1_entries) << std::endl;
+    std::cout << Messages::report_tlb_effective_reach(
+                     tlb_effective_reach_bytes(l1_entries, page_size_bytes),
+                     page_size_bytes)
+              << std::endl;
     if (l1_boundary.overlaps_private_cache_knee) {
       std::cout << Messages::report_tlb_private_cache_overlap() << std::endl;
     }
@@ -1353,6 +1739,10 @@ int run_tlb_analysis_impl(
                      l2_entry_range.second)
               << std::endl;
     std::cout << Messages::report_tlb_inferred_reach_entries(l2_entries) << std::endl;
+    std::cout << Messages::report_tlb_effective_reach(
+                     tlb_effective_reach_bytes(l2_entries, page_size_bytes),
+                     page_size_bytes)
+              << std::endl;
     std::cout << Messages::report_tlb_statistical_confidence(
                      l2_boundary.confidence,
                      l2_boundary.discovery.effect_ns,
@@ -1365,6 +1755,14 @@ int run_tlb_analysis_impl(
     std::cout << Messages::report_tlb_not_detected() << std::endl;
   }
   std::cout << std::endl;
+  std::cout << Messages::report_tlb_page_granules_section() << std::endl;
+  std::cout << Messages::report_tlb_page_granules_scope() << std::endl;
+  for (const TlbPageGranule& granule : build_tlb_page_granules(page_size_bytes)) {
+    std::cout << Messages::report_tlb_page_granule(
+                     granule.page_size_bytes, granule.analyzed, granule.reason)
+              << std::endl;
+  }
+  std::cout << std::endl;
   if (!conclusions_valid ||
       (can_measure_page_walk_penalty && !page_walk_comparison_completed)) {
     std::cout << Messages::report_tlb_large_locality_paired_interrupted()
@@ -1386,6 +1784,23 @@ int run_tlb_analysis_impl(
                      selected_buffer_mb)
               << std::endl;
   }
+  if (page_table_comparison_completed) {
+    const size_t table_spread_stride_pages =
+        measurement_records.empty()
+            ? 0
+            : measurement_records.back().paired.spread.diagnostics
+                  .page_stride_pages;
+    std::cout << Messages::report_tlb_page_table_footprint_comparison(
+                     page_table_summary.spread_actual_pages,
+                     table_spread_stride_pages,
+                     page_table_summary.spread_p50_ns,
+                     page_table_summary.packed_p50_ns,
+                     page_table_summary.translation_delta_p50_ns)
+              << std::endl;
+  } else {
+    std::cout << Messages::report_tlb_page_table_footprint_unavailable()
+              << std::endl;
+  }
 
   const double total_execution_time_sec =
       execution_seam != nullptr && execution_seam->elapsed_seconds
@@ -1421,6 +1836,8 @@ int run_tlb_analysis_impl(
     summary.conclusions_valid = conclusions_valid;
     summary.large_locality_planned = large_locality_planned;
     summary.large_locality_completed = large_locality_pass_completed;
+    summary.page_table_footprint_planned = page_table_planned;
+    summary.page_table_footprint_completed = page_table_pass_completed;
     summary.pass_summaries = pass_summaries;
     execution_seam->observe_summary(summary);
   }
@@ -1473,6 +1890,9 @@ int run_tlb_analysis_impl(
       buffer_lock_error,
       base_work_estimate,
       pass_summaries,
+      page_table_locality_bytes,
+      page_table_comparison_completed,
+      chain_reuse_unavailable_passes,
   };
 
   if (save_tlb_analysis_to_json(json_context) != EXIT_SUCCESS) {
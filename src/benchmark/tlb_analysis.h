@@ -107,6 +107,8 @@ struct TlbAnalysisCoordinatorSummary {
   bool conclusions_valid = false;
   bool large_locality_planned = false;
   bool large_locality_completed = false;
+  bool page_table_footprint_planned = false;
+  bool page_table_footprint_completed = false;
   std::vector<TlbPassExecutionSummary> pass_summaries;
 };
 
@@ -28,6 +28,7 @@
 #include <string>
 
 #include "benchmark/tlb_analysis.h"
+#include "benchmark/tlb_sweep_planner.h"
 #include "core/config/config.h"
 #include "core/config/constants.h"
 #include "core/config/version.h"
@@ -70,7 +71,8 @@ nlohmann::ordered_json build_tlb_candidate_json(
 }
 
 nlohmann::ordered_json build_tlb_boundary_json(const TlbBoundaryDetection& boundary,
-                                               size_t inferred_entries) {
+                                               size_t inferred_entries,
+                                               size_t page_size_bytes) {
   nlohmann::ordered_json boundary_json;
   boundary_json["detected"] = boundary.detected;
   boundary_json["signal"] = "translation_delta_ns";
@@ -103,6 +105,8 @@ nlohmann::ordered_json build_tlb_boundary_json(const TlbBoundaryDetection& bound
   boundary_json["inferred_entries"] = inferred_entries;
   boundary_json["inferred_entries_method"] =
       "validated-bracket-range-midpoint-estimate";
+  boundary_json["effective_reach_bytes"] =
+      tlb_effective_reach_bytes(inferred_entries, page_size_bytes);
   return boundary_json;
 }
 
@@ -158,6 +162,9 @@ nlohmann::ordered_json build_tlb_chain_diagnostics_json(
       {"requested_stride_bytes", diagnostics.requested_stride_bytes},
       {"effective_node_spacing_bytes",
        diagnostics.effective_node_spacing_bytes},
+      {"page_stride_pages", diagnostics.page_stride_pages},
+      {"leaf_descriptor_lines", diagnostics.leaf_descriptor_lines},
+      {"leaf_table_pages", diagnostics.leaf_table_pages},
       {"integrity_verified", diagnostics.integrity_verified},
   };
 }
@@ -188,6 +195,8 @@ nlohmann::ordered_json build_tlb_measurement_record_json(
         {"pilot_access_count", record.paired.spread.pilot_access_count},
         {"pilot_duration_ns", record.paired.spread.pilot_duration_ns},
         {"access_count", record.paired.spread.access_count},
+        {"layout_identity", record.paired.spread.layout_identity},
+        {"layout_reused", record.paired.spread.layout_reused},
         {"chain",
          build_tlb_chain_diagnostics_json(
              record.paired.spread.diagnostics)}}},
@@ -197,6 +206,8 @@ nlohmann::ordered_json build_tlb_measurement_record_json(
         {"pilot_access_count", record.paired.packed.pilot_access_count},
         {"pilot_duration_ns", record.paired.packed.pilot_duration_ns},
         {"access_count", record.paired.packed.access_count},
+        {"layout_identity", record.paired.packed.layout_identity},
+        {"layout_reused", record.paired.packed.layout_reused},
         {"chain",
          build_tlb_chain_diagnostics_json(
              record.paired.packed.diagnostics)}}},
@@ -249,6 +260,17 @@ int save_tlb_analysis_to_json(const TlbAnalysisJsonContext& context) {
          "splitmix64(splitmix64(splitmix64(base_seed xor pass) xor round_index) xor point_index)"},
         {"chain_layout",
          "splitmix64(task_seed xor layout-domain-constant)"}}},
+      {"chain_reuse",
+       {{"layout_identities_per_point", context.config.tlb_chain_layouts},
+        {"policy",
+         context.config.tlb_chain_layouts == 0
+             ? "rebuild-every-round"
+             : context.chain_reuse_unavailable_passes.empty()
+                   ? "round-modulo-identity-disjoint-regions"
+                   : "rebuild-every-round-in-unavailable-passes"},
+        {"reuse_unavailable_passes", context.chain_reuse_unavailable_passes},
+        {"identity_seed",
+         "measurement_task seed of round_index = layout_identity"}}},
       {"schedule_policy", "seeded-cyclic-latin"},
       {"chain_model", "one-node-per-spread-page-with-packed-control"},
       {"latency_interpretation",
@@ -269,7 +291,10 @@ int save_tlb_analysis_to_json(const TlbAnalysisJsonContext& context) {
         {"maximum", maximum_rounds},
         {"ci_width_target_ns", context.runtime_profile.ci_width_target_ns},
         {"bootstrap_resamples",
-         context.runtime_profile.convergence_bootstrap_resamples}}},
+         context.runtime_profile.convergence_bootstrap_resamples},
+        {"point_retirement",
+         "per-point CI after minimum rounds; boundary windows must resolve half their 0.5ns+ median step; "
+         "retired points re-activate when a later window does not resolve"}}},
       {"access_calibration",
        {{"target_duration_ns", context.runtime_profile.target_measurement_ns},
         {"minimum_chain_cycles",
@@ -349,6 +374,7 @@ int save_tlb_analysis_to_json(const TlbAnalysisJsonContext& context) {
     bool physical_metadata_added = false;
     for (const TlbMeasurementRecord& record : context.measurement_records) {
       if (record.pass == TlbMeasurementPass::LargeLocality ||
+          record.pass == TlbMeasurementPass::PageTableFootprint ||
           record.locality_bytes != context.localities_bytes[i]) {
         continue;
       }
@@ -481,16 +507,23 @@ int save_tlb_analysis_to_json(const TlbAnalysisJsonContext& context) {
           context.measurement_records.begin(),
           context.measurement_records.end(),
           [](const TlbMeasurementRecord& record) {
-            return record.pass != TlbMeasurementPass::LargeLocality;
+            return record.pass != TlbMeasurementPass::LargeLocality &&
+                   record.pass != TlbMeasurementPass::PageTableFootprint;
           }));
   const size_t completed_large_locality_records =
-      context.measurement_records.size() - completed_base_validation_records;
+      static_cast<size_t>(std::count_if(
+          context.measurement_records.begin(),
+          context.measurement_records.end(),
+          [](const TlbMeasurementRecord& record) {
+            return record.pass == TlbMeasurementPass::LargeLocality;
+          }));
   const size_t completed_base_validation_pairs =
       static_cast<size_t>(std::count_if(
           context.measurement_records.begin(),
           context.measurement_records.end(),
           [](const TlbMeasurementRecord& record) {
             return record.pass != TlbMeasurementPass::LargeLocality &&
+                   record.pass != TlbMeasurementPass::PageTableFootprint &&
                    record.paired.available;
           }));
   const size_t completed_large_locality_pairs =
@@ -501,13 +534,18 @@ int save_tlb_analysis_to_json(const TlbAnalysisJsonContext& context) {
             return record.pass == TlbMeasurementPass::LargeLocality &&
                    record.paired.available;
           }));
-  const size_t total_completed_pairs =
-      completed_base_validation_pairs >
-              std::numeric_limits<size_t>::max() -
-                  completed_large_locality_pairs
-          ? std::numeric_limits<size_t>::max()
-          : completed_base_validation_pairs +
-                completed_large_locality_pairs;
+  const size_t completed_page_table_footprint_pairs =
+      static_cast<size_t>(std::count_if(
+          context.measurement_records.begin(),
+          context.measurement_records.end(),
+          [](const TlbMeasurementRecord& record) {
+            return record.pass == TlbMeasurementPass::PageTableFootprint &&
+                   record.paired.available;
+          }));
+  // Each pass pair count is bounded by the record count, so the sum fits.
+  const size_t total_completed_pairs = completed_base_validation_pairs +
+                                       completed_large_locality_pairs +
+                                       completed_page_table_footprint_pairs;
   const auto raw_measurement_count = [](size_t pair_count) {
     return pair_count > std::numeric_limits<size_t>::max() / 2
                ? std::numeric_limits<size_t>::max()
@@ -537,6 +575,8 @@ int save_tlb_analysis_to_json(const TlbAnalysisJsonContext& context) {
       completed_large_locality_pairs;
   tlb_json["completed_large_locality_raw_measurements"] =
       raw_measurement_count(completed_large_locality_pairs);
+  tlb_json["completed_page_table_footprint_pairs"] =
+      completed_page_table_footprint_pairs;
   tlb_json["total_completed_measurement_records"] =
       context.measurement_records.size();
   tlb_json["total_completed_measurement_pairs"] =
@@ -546,6 +586,7 @@ int save_tlb_analysis_to_json(const TlbAnalysisJsonContext& context) {
   tlb_json["measurement_counter_scope"] = {
       {"base_validation", "base and validation passes"},
       {"large_locality", "large-locality pass"},
+      {"page_table_footprint", "page-table-footprint pass"},
       {"total", "all serialized measurement passes"},
   };
   tlb_json["pass_summaries"] = nlohmann::ordered_json::array();
@@ -565,6 +606,7 @@ int save_tlb_analysis_to_json(const TlbAnalysisJsonContext& context) {
         {"pass", tlb_measurement_pass_to_string(summary.pass)},
         {"point_count", summary.point_count},
         {"rounds_completed", summary.rounds_completed},
+        {"retired_points", summary.retired_points},
         {"converged", summary.converged},
         {"status", status},
         {"completion_reason", completion_reason},
@@ -577,8 +619,10 @@ int save_tlb_analysis_to_json(const TlbAnalysisJsonContext& context) {
   }
   tlb_json["sweep"] = sweep_json;
   if (context.conclusions_valid) {
-    tlb_json["l1_tlb_detection"] = build_tlb_boundary_json(context.l1_boundary, context.l1_entries);
-    tlb_json["l2_tlb_detection"] = build_tlb_boundary_json(context.l2_boundary, context.l2_entries);
+    tlb_json["l1_tlb_detection"] = build_tlb_boundary_json(
+        context.l1_boundary, context.l1_entries, context.page_size_bytes);
+    tlb_json["l2_tlb_detection"] = build_tlb_boundary_json(
+        context.l2_boundary, context.l2_entries, context.page_size_bytes);
     tlb_json["private_cache_knee"] = build_private_cache_knee_json(context.private_cache_knee,
                                                                     context.private_cache_interference_elevated,
                                                                     context.private_cache_to_l1_distance_bytes,
@@ -605,6 +649,41 @@ int save_tlb_analysis_to_json(const TlbAnalysisJsonContext& context) {
         "inferred_entries_min..inferred_entries_max";
   }
 
+  tlb_json["page_granules"] = nlohmann::ordered_json::array();
+  for (const TlbPageGranule& granule :
+       build_tlb_page_granules(context.page_size_bytes)) {
+    nlohmann::ordered_json granule_json = {
+        {"page_size_bytes", granule.page_size_bytes},
+        {"backing", granule.backing},
+        {"analyzed", granule.analyzed},
+    };
+    if (!granule.analyzed) {
+      granule_json["reason"] = granule.reason;
+    } else {
+      const bool l1_available =
+          context.conclusions_valid && context.l1_boundary.detected;
+      const bool l2_available =
+          context.conclusions_valid && context.l2_boundary.detected;
+      granule_json["l1_tlb"] = {
+          {"detected", l1_available},
+          {"inferred_entries", l1_available ? context.l1_entries : 0},
+          {"effective_reach_bytes",
+           l1_available ? tlb_effective_reach_bytes(context.l1_entries,
+                                                    granule.page_size_bytes)
+                        : 0},
+      };
+      granule_json["l2_tlb"] = {
+          {"detected", l2_available},
+          {"inferred_entries", l2_available ? context.l2_entries : 0},
+          {"effective_reach_bytes",
+           l2_available ? tlb_effective_reach_bytes(context.l2_entries,
+                                                    granule.page_size_bytes)
+                        : 0},
+      };
+    }
+    tlb_json["page_granules"].push_back(granule_json);
+  }
+
   const bool large_locality_comparison_available =
       context.conclusions_valid && context.page_walk_comparison_completed;
   const TlbPairedPointSummary large_locality_summary =
@@ -661,6 +740,71 @@ int save_tlb_analysis_to_json(const TlbAnalysisJsonContext& context) {
   tlb_json["large_locality_paired_comparison"] =
       large_locality_paired;
 
+  const TlbPairedPointSummary page_table_summary =
+      summarize_tlb_paired_point(
+          context.measurement_records,
+          context.page_table_comparison_locality_bytes,
+          {TlbMeasurementPass::PageTableFootprint});
+  const bool page_table_available = context.conclusions_valid &&
+                                    context.page_table_comparison_completed &&
+                                    page_table_summary.available;
+  nlohmann::ordered_json page_table_comparison = {
+      {"available", page_table_available},
+      {"comparison_locality_bytes",
+       context.page_table_comparison_locality_bytes},
+      {"page_walk_delta_definition",
+       "median of same-round (table_spread_latency_ns - table_dense_latency_ns)"},
+      {"interpretation",
+       "equal data-page and cache-line counts; the delta isolates leaf page-table "
+       "descriptor and walk-cache misses from data-cache misses"}};
+  if (page_table_available) {
+    page_table_comparison["table_spread_p50_ns"] =
+        page_table_summary.spread_p50_ns;
+    page_table_comparison["table_dense_p50_ns"] =
+        page_table_summary.packed_p50_ns;
+    page_table_comparison["page_walk_delta_p50_ns"] =
+        page_table_summary.translation_delta_p50_ns;
+    page_table_comparison["data_pages"] =
+        page_table_summary.spread_actual_pages;
+    page_table_comparison["unique_cache_lines"] =
+        page_table_summary.unique_cache_lines;
+    page_table_comparison["measurements"] = nlohmann::ordered_json::array();
+    for (const TlbMeasurementRecord& record : context.measurement_records) {
+      if (record.pass != TlbMeasurementPass::PageTableFootprint) {
+        continue;
+      }
+      if (!page_table_comparison.contains("table_spread_page_stride_pages")) {
+        const TlbChainDiagnostics& table_spread =
+            record.paired.spread.diagnostics;
+        const TlbChainDiagnostics& table_dense =
+            record.paired.packed.diagnostics;
+        page_table_comparison["table_spread_page_stride_pages"] =
+            table_spread.page_stride_pages;
+        page_table_comparison["table_spread_leaf_descriptor_lines"] =
+            table_spread.leaf_descriptor_lines;
+        page_table_comparison["table_dense_leaf_descriptor_lines"] =
+            table_dense.leaf_descriptor_lines;
+        page_table_comparison["table_spread_leaf_table_pages"] =
+            table_spread.leaf_table_pages;
+        page_table_comparison["table_dense_leaf_table_pages"] =
+            table_dense.leaf_table_pages;
+      }
+      page_table_comparison["measurements"].push_back(
+          build_tlb_measurement_record_json(record));
+    }
+  } else if (!context.conclusions_valid) {
+    page_table_comparison["reason"] =
+        "analysis incomplete; page-table comparison suppressed";
+  } else if (context.page_table_comparison_locality_bytes == 0) {
+    page_table_comparison["reason"] =
+        "requires a completed large-locality pass and a buffer of at least "
+        "8 pages per node";
+  } else {
+    page_table_comparison["reason"] =
+        "page-table comparison measurement did not complete";
+  }
+  tlb_json["page_table_footprint_comparison"] = page_table_comparison;
+
   json_output["tlb_analysis"] = tlb_json;
   json_output[JsonKeys::TIMESTAMP] = build_utc_timestamp();
   json_output[JsonKeys::VERSION] = SOFTVERSION;
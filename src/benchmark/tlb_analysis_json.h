@@ -86,6 +86,9 @@ struct TlbAnalysisJsonContext {
   std::string buffer_lock_error;
   TlbWorkEstimate base_work_estimate;
   std::vector<TlbPassExecutionSummary> pass_summaries;
+  size_t page_table_comparison_locality_bytes = 0;
+  bool page_table_comparison_completed = false;
+  std::vector<std::string> chain_reuse_unavailable_passes;
 };
 
 /**
@@ -28,8 +28,6 @@
 #include <new>
 #include <numeric>
 #include <random>
-#include <unordered_map>
-#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -38,6 +36,9 @@
 
 namespace {
 
+static_assert(Constants::CACHE_LINE_SIZE_BYTES / sizeof(uintptr_t) <= 8,
+              "One validation mask byte must cover every word of a cache line");
+
 bool add_would_overflow(size_t left, size_t right) {
   return left > std::numeric_limits<size_t>::max() - right;
 }
@@ -62,8 +63,16 @@ bool pointer_in_buffer(uintptr_t address,
   return address >= buffer_start && address <= buffer_end - sizeof(uintptr_t);
 }
 
+constexpr size_t kLeafDescriptorBytes = sizeof(uint64_t);
+
 bool valid_layout(TlbChainLayout layout) {
-  return layout == TlbChainLayout::Spread || layout == TlbChainLayout::Packed;
+  return layout == TlbChainLayout::Spread || layout == TlbChainLayout::Packed ||
+         layout == TlbChainLayout::TableSpread ||
+         layout == TlbChainLayout::TableDense;
+}
+
+bool one_node_per_page(TlbChainLayout layout) {
+  return layout != TlbChainLayout::Packed;
 }
 
 bool valid_traversal_policy(TlbChainTraversalPolicy policy) {
@@ -80,6 +89,10 @@ const char* tlb_chain_layout_to_string(TlbChainLayout layout) {
       return "spread";
     case TlbChainLayout::Packed:
       return "packed";
+    case TlbChainLayout::TableSpread:
+      return "table-spread";
+    case TlbChainLayout::TableDense:
+      return "table-dense";
   }
   return "spread";
 }
@@ -136,13 +149,74 @@ const char* tlb_chain_validation_status_to_string(
   return "invalid-argument";
 }
 
+size_t tlb_table_spread_page_stride(size_t buffer_size_bytes,
+                                    size_t requested_pages,
+                                    size_t page_size_bytes) {
+  const size_t descriptors_per_line =
+      Constants::CACHE_LINE_SIZE_BYTES / kLeafDescriptorBytes;
+  if (requested_pages == 0 || page_size_bytes < kLeafDescriptorBytes) {
+    return 0;
+  }
+  const size_t stride_pages =
+      std::min(page_size_bytes / kLeafDescriptorBytes,
+               (buffer_size_bytes / page_size_bytes) / requested_pages);
+  return stride_pages >= descriptors_per_line ? stride_pages : 0;
+}
+
 uint64_t derive_tlb_chain_layout_seed(uint64_t task_seed,
                                       TlbChainLayout layout) {
   constexpr uint64_t kSpreadSalt = 0x535052454144ULL;
   constexpr uint64_t kPackedSalt = 0x5041434b4544ULL;
-  return SeedUtils::splitmix64(
-      task_seed ^ (layout == TlbChainLayout::Spread ? kSpreadSalt
-                                                    : kPackedSalt));
+  constexpr uint64_t kTableSpreadSalt = 0x5442535052454144ULL;
+  constexpr uint64_t kTableDenseSalt = 0x544244454e5345ULL;
+  uint64_t salt = kPackedSalt;
+  switch (layout) {
+    case TlbChainLayout::Spread:
+      salt = kSpreadSalt;
+      break;
+    case TlbChainLayout::Packed:
+      salt = kPackedSalt;
+      break;
+    case TlbChainLayout::TableSpread:
+      salt = kTableSpreadSalt;
+      break;
+    case TlbChainLayout::TableDense:
+      salt = kTableDenseSalt;
+      break;
+  }
+  return SeedUtils::splitmix64(task_seed ^ salt);
+}
+
+bool reserve_tlb_chain_scratch(TlbChainScratch& scratch,
+                               size_t maximum_region_bytes,
+                               size_t page_size_bytes) {
+  const size_t cache_line_bytes = Constants::CACHE_LINE_SIZE_BYTES;
+  if (maximum_region_bytes == 0 || page_size_bytes < cache_line_bytes) {
+    return false;
+  }
+  const size_t line_count =
+      maximum_region_bytes / cache_line_bytes +
+      ((maximum_region_bytes % cache_line_bytes) != 0 ? 1 : 0);
+  const size_t page_count =
+      maximum_region_bytes / page_size_bytes +
+      ((maximum_region_bytes % page_size_bytes) != 0 ? 1 : 0);
+  try {
+    if (scratch.cache_line_word_masks.size() < line_count) {
+      scratch.cache_line_word_masks.resize(line_count, 0);
+    }
+    if (scratch.page_node_counts.size() < page_count) {
+      scratch.page_node_counts.resize(page_count, 0);
+    }
+    // The largest region is a one-node-per-page spread region, so its page
+    // count bounds the node count of every chain built in a smaller region.
+    scratch.physical_offsets.reserve(page_count);
+    scratch.traversal.reserve(page_count);
+    scratch.physical_writes.reserve(page_count);
+    scratch.visited_offsets.reserve(page_count);
+  } catch (const std::bad_alloc&) {
+    return false;
+  }
+  return true;
 }
 
 TlbChainValidationStatus validate_tlb_chain_with_scratch(
@@ -174,53 +248,69 @@ TlbChainValidationStatus validate_tlb_chain_with_scratch(
     return TlbChainValidationStatus::InvalidArgument;
   }
 
-  auto& visited_nodes = scratch.visited_nodes;
-  auto& visited_pages = scratch.visited_pages;
-  auto& visited_cache_lines = scratch.visited_cache_lines;
-  auto& nodes_per_page = scratch.nodes_per_page;
-  visited_nodes.clear();
-  visited_pages.clear();
-  visited_cache_lines.clear();
-  nodes_per_page.clear();
-  if (visited_nodes.bucket_count() < expected.node_count) {
-    visited_nodes.reserve(expected.node_count);
-  }
-  if (visited_pages.bucket_count() < expected.node_count) {
-    visited_pages.reserve(expected.node_count);
+  const size_t line_count =
+      buffer_size_bytes / cache_line_bytes +
+      ((buffer_size_bytes % cache_line_bytes) != 0 ? 1 : 0);
+  const size_t page_count =
+      buffer_size_bytes / expected.page_size_bytes +
+      ((buffer_size_bytes % expected.page_size_bytes) != 0 ? 1 : 0);
+  auto& line_word_masks = scratch.cache_line_word_masks;
+  auto& page_node_counts = scratch.page_node_counts;
+  auto& visited_offsets = scratch.visited_offsets;
+  // Entries past this buffer are zero too, so a larger table is reused as-is.
+  if (line_word_masks.size() < line_count) {
+    line_word_masks.resize(line_count, 0);
   }
-  if (visited_cache_lines.bucket_count() < expected.node_count) {
-    visited_cache_lines.reserve(expected.node_count);
+  if (page_node_counts.size() < page_count) {
+    page_node_counts.resize(page_count, 0);
   }
-  if (nodes_per_page.bucket_count() < expected.node_count) {
-    nodes_per_page.reserve(expected.node_count);
+  visited_offsets.clear();
+  if (visited_offsets.capacity() < expected.node_count) {
+    visited_offsets.reserve(expected.node_count);
   }
 
   uintptr_t current = reinterpret_cast<uintptr_t>(chain_head);
   uintptr_t minimum_address = current;
   uintptr_t maximum_address = current;
   size_t max_nodes_per_page = 0;
+  size_t unique_pages = 0;
+  size_t unique_cache_lines = 0;
+  TlbChainValidationStatus status = TlbChainValidationStatus::Valid;
 
   for (size_t node_index = 0; node_index < expected.node_count;
        ++node_index) {
     if (!pointer_in_buffer(current, buffer_start, buffer_end)) {
-      return TlbChainValidationStatus::NodeOutOfBounds;
+      status = TlbChainValidationStatus::NodeOutOfBounds;
+      break;
     }
     if ((current % alignof(uintptr_t)) != 0) {
-      return TlbChainValidationStatus::NodeMisaligned;
-    }
-    if (!visited_nodes.insert(current).second) {
-      return node_index + 1 < expected.node_count
-                 ? TlbChainValidationStatus::EarlyCycle
-                 : TlbChainValidationStatus::DuplicateNode;
+      status = TlbChainValidationStatus::NodeMisaligned;
+      break;
     }
 
     const size_t relative_offset =
         static_cast<size_t>(current - buffer_start);
-    const size_t page_index = relative_offset / expected.page_size_bytes;
     const size_t cache_line_index = relative_offset / cache_line_bytes;
-    visited_pages.insert(page_index);
-    visited_cache_lines.insert(cache_line_index);
-    const size_t page_node_count = ++nodes_per_page[page_index];
+    const uint8_t word_bit = static_cast<uint8_t>(
+        1U << ((relative_offset % cache_line_bytes) / sizeof(uintptr_t)));
+    uint8_t& line_mask = line_word_masks[cache_line_index];
+    if ((line_mask & word_bit) != 0) {
+      status = node_index + 1 < expected.node_count
+                   ? TlbChainValidationStatus::EarlyCycle
+                   : TlbChainValidationStatus::DuplicateNode;
+      break;
+    }
+    if (line_mask == 0) {
+      ++unique_cache_lines;
+    }
+    line_mask = static_cast<uint8_t>(line_mask | word_bit);
+    visited_offsets.push_back(relative_offset);
+
+    const size_t page_index = relative_offset / expected.page_size_bytes;
+    const size_t page_node_count = ++page_node_counts[page_index];
+    if (page_node_count == 1) {
+      ++unique_pages;
+    }
     max_nodes_per_page = std::max(max_nodes_per_page, page_node_count);
     minimum_address = std::min(minimum_address, current);
     maximum_address = std::max(maximum_address, current);
@@ -229,27 +319,39 @@ TlbChainValidationStatus validate_tlb_chain_with_scratch(
     std::memcpy(&next, reinterpret_cast<const void*>(current), sizeof(next));
     if (next == reinterpret_cast<uintptr_t>(chain_head) &&
         node_index + 1 < expected.node_count) {
-      return TlbChainValidationStatus::EarlyCycle;
+      status = TlbChainValidationStatus::EarlyCycle;
+      break;
     }
     current = next;
   }
 
+  // Restore the all-zero invariant before any status is returned.
+  const size_t visited_node_count = visited_offsets.size();
+  for (const size_t relative_offset : visited_offsets) {
+    line_word_masks[relative_offset / cache_line_bytes] = 0;
+    page_node_counts[relative_offset / expected.page_size_bytes] = 0;
+  }
+  visited_offsets.clear();
+
+  if (status != TlbChainValidationStatus::Valid) {
+    return status;
+  }
   if (current != reinterpret_cast<uintptr_t>(chain_head)) {
     return TlbChainValidationStatus::DoesNotReturnToHead;
   }
-  if (visited_cache_lines.size() != expected.node_count) {
+  if (unique_cache_lines != expected.node_count) {
     return TlbChainValidationStatus::CacheLineReuse;
   }
-  if (expected.layout == TlbChainLayout::Spread &&
-      visited_pages.size() != expected.requested_pages) {
+  if (one_node_per_page(expected.layout) &&
+      unique_pages != expected.requested_pages) {
     return TlbChainValidationStatus::PageCountMismatch;
   }
 
   if (observed != nullptr) {
     *observed = expected;
-    observed->actual_pages = visited_pages.size();
-    observed->node_count = visited_nodes.size();
-    observed->unique_cache_lines = visited_cache_lines.size();
+    observed->actual_pages = unique_pages;
+    observed->node_count = visited_node_count;
+    observed->unique_cache_lines = unique_cache_lines;
     observed->max_nodes_per_page = max_nodes_per_page;
     observed->byte_span =
         static_cast<size_t>(maximum_address - minimum_address) +
@@ -336,7 +438,15 @@ TlbChainBuildResult build_tlb_chain(
   result.diagnostics.effective_node_spacing_bytes =
       effective_spacing_bytes;
 
-  if (layout == TlbChainLayout::Spread) {
+  size_t page_stride_pages = 1;
+  if (layout == TlbChainLayout::TableSpread) {
+    page_stride_pages = tlb_table_spread_page_stride(
+        buffer_size_bytes, requested_pages, page_size_bytes);
+    if (page_stride_pages == 0) {
+      result.status = TlbChainBuildStatus::InsufficientBuffer;
+      return result;
+    }
+  } else if (one_node_per_page(layout)) {
     if (requested_pages > buffer_size_bytes / page_size_bytes) {
       result.status = TlbChainBuildStatus::InsufficientBuffer;
       return result;
@@ -357,7 +467,7 @@ TlbChainBuildResult build_tlb_chain(
     std::mt19937_64 offset_rng(
         SeedUtils::splitmix64(seed ^ 0x4f464653455453ULL));
 
-    if (layout == TlbChainLayout::Spread) {
+    if (one_node_per_page(layout)) {
       const size_t slot_count =
           1 + (page_size_bytes - cache_line_bytes) /
                   effective_spacing_bytes;
@@ -376,7 +486,8 @@ TlbChainBuildResult build_tlb_chain(
                 ? shared_slot
                 : slot_distribution(offset_rng);
         physical_offsets[page_index] =
-            page_index * page_size_bytes + slot * effective_spacing_bytes;
+            page_index * page_stride_pages * page_size_bytes +
+            slot * effective_spacing_bytes;
       }
     } else {
       for (size_t node_index = 0; node_index < requested_pages;
@@ -415,6 +526,27 @@ TlbChainBuildResult build_tlb_chain(
       std::memcpy(bytes + write.first, &next_address, sizeof(next_address));
     }
 
+    // Offsets increase with node index, so distinct leaf descriptor lines
+    // and tables are counted as changes between consecutive virtual pages.
+    const size_t descriptors_per_line = cache_line_bytes / kLeafDescriptorBytes;
+    const size_t descriptors_per_table = page_size_bytes / kLeafDescriptorBytes;
+    size_t previous_line = std::numeric_limits<size_t>::max();
+    size_t previous_table = std::numeric_limits<size_t>::max();
+    for (const size_t offset : physical_offsets) {
+      const size_t virtual_page =
+          reinterpret_cast<uintptr_t>(bytes + offset) / page_size_bytes;
+      if (virtual_page / descriptors_per_line != previous_line) {
+        previous_line = virtual_page / descriptors_per_line;
+        ++result.diagnostics.leaf_descriptor_lines;
+      }
+      if (virtual_page / descriptors_per_table != previous_table) {
+        previous_table = virtual_page / descriptors_per_table;
+        ++result.diagnostics.leaf_table_pages;
+      }
+    }
+    result.diagnostics.page_stride_pages =
+        one_node_per_page(layout) ? page_stride_pages : 0;
+
     result.chain_head = bytes + physical_offsets[traversal.front()];
     TlbChainDiagnostics observed;
     result.validation_status = validate_tlb_chain_with_scratch(
@@ -25,14 +25,21 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <unordered_map>
-#include <unordered_set>
 #include <utility>
 #include <vector>
 
+/**
+ * Spread and packed control data-TLB reach at a fixed cache-line count.
+ * TableSpread and TableDense both place one node on each of the same number
+ * of pages, but TableSpread separates the pages across leaf page-table
+ * descriptor lines and tables while TableDense keeps them on consecutive
+ * pages, so their difference controls page-table footprint instead.
+ */
 enum class TlbChainLayout {
   Spread = 0,
   Packed,
+  TableSpread,
+  TableDense,
 };
 
 enum class TlbChainTraversalPolicy {
@@ -74,6 +81,9 @@ struct TlbChainDiagnostics {
   size_t page_size_bytes = 0;
   size_t requested_stride_bytes = 0;
   size_t effective_node_spacing_bytes = 0;
+  size_t page_stride_pages = 0;
+  size_t leaf_descriptor_lines = 0;
+  size_t leaf_table_pages = 0;
   uint64_t seed = 0;
   bool integrity_verified = false;
 };
@@ -86,15 +96,23 @@ struct TlbChainBuildResult {
   TlbChainDiagnostics diagnostics;
 };
 
-/** Reusable builder and integrity-validation storage for serial TLB tasks. */
+/**
+ * Reusable builder and integrity-validation storage for serial TLB tasks.
+ *
+ * Validation state is dense and indexed by buffer-relative position: one byte
+ * per cache line holds one visited bit per pointer-sized word, and one counter
+ * per page holds the visited node count. Both arrays are all-zero between
+ * validations; only entries recorded in `visited_offsets` are cleared again.
+ * The arrays only grow, so once they cover the largest validated region a
+ * smaller region reuses them without reallocating or refilling.
+ */
 struct TlbChainScratch {
   std::vector<size_t> physical_offsets;
   std::vector<size_t> traversal;
   std::vector<std::pair<size_t, size_t>> physical_writes;
-  std::unordered_set<uintptr_t> visited_nodes;
-  std::unordered_set<size_t> visited_pages;
-  std::unordered_set<size_t> visited_cache_lines;
-  std::unordered_map<size_t, size_t> nodes_per_page;
+  std::vector<uint8_t> cache_line_word_masks;
+  std::vector<uint32_t> page_node_counts;
+  std::vector<size_t> visited_offsets;
 };
 
 const char* tlb_chain_layout_to_string(TlbChainLayout layout);
@@ -104,6 +122,17 @@ const char* tlb_chain_build_status_to_string(TlbChainBuildStatus status);
 const char* tlb_chain_validation_status_to_string(
     TlbChainValidationStatus status);
 
+/**
+ * Page stride that lets TableSpread place `requested_pages` nodes in the
+ * buffer, capped at one leaf page table (page size / 8 descriptors).
+ *
+ * Returns 0 when the stride would be smaller than one descriptor cache line,
+ * because neighboring nodes would then share leaf descriptors.
+ */
+size_t tlb_table_spread_page_stride(size_t buffer_size_bytes,
+                                    size_t requested_pages,
+                                    size_t page_size_bytes);
+
 /** Derive a stable, layout-specific seed from one scheduled task seed. */
 uint64_t derive_tlb_chain_layout_seed(uint64_t task_seed,
                                       TlbChainLayout layout);
@@ -113,7 +142,9 @@ uint64_t derive_tlb_chain_layout_seed(uint64_t task_seed,
  *
  * Spread places exactly one node on every requested page. Packed places the
  * same number of nodes on consecutive distinct cache lines, minimizing the
- * physical page count without changing data-cache line count.
+ * physical page count without changing data-cache line count. TableSpread
+ * places one node every tlb_table_spread_page_stride() pages and TableDense
+ * one node on each of the first requested pages.
  * Pointer values are written in physical-slot order after traversal order has
  * been planned, so setup writes do not reveal the measured traversal sequence.
  */
@@ -127,6 +158,17 @@ TlbChainBuildResult build_tlb_chain(
     TlbChainTraversalPolicy traversal_policy,
     uint64_t seed);
 
+/**
+ * Size `scratch` for chains of up to `maximum_region_bytes` so builds and
+ * validations in any smaller region neither reallocate nor refill it.
+ *
+ * Returns false when the storage cannot be allocated; validation then grows
+ * the arrays on demand as before.
+ */
+bool reserve_tlb_chain_scratch(TlbChainScratch& scratch,
+                               size_t maximum_region_bytes,
+                               size_t page_size_bytes);
+
 /** Build a TLB chain while retaining scratch capacity for the next task. */
 TlbChainBuildResult build_tlb_chain(
     void* buffer,
@@ -0,0 +1,121 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+/**
+ * @file tlb_chain_cache.cpp
+ * @brief Optional per-point chain-layout reuse for standalone TLB analysis
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include "benchmark/tlb_chain_cache.h"
+
+#include <limits>
+
+#include "core/config/constants.h"
+#include "utils/numeric_utils.h"
+
+size_t tlb_chain_layout_identity(size_t round_index, size_t layout_identities) {
+  return layout_identities == 0 ? round_index : round_index % layout_identities;
+}
+
+uint64_t derive_tlb_layout_identity_seed(uint64_t base_seed,
+                                         TlbMeasurementPass pass,
+                                         size_t layout_identity,
+                                         size_t point_index) {
+  return derive_tlb_measurement_seed(base_seed, pass, layout_identity,
+                                     point_index);
+}
+
+size_t tlb_chain_region_bytes(size_t requested_pages,
+                              size_t page_size_bytes,
+                              TlbChainLayout layout) {
+  if (requested_pages == 0 || page_size_bytes == 0) {
+    return 0;
+  }
+  if (layout == TlbChainLayout::TableSpread) {
+    return 0;
+  }
+  if (layout == TlbChainLayout::Spread || layout == TlbChainLayout::TableDense) {
+    return NumericUtils::saturating_multiply(requested_pages, page_size_bytes);
+  }
+  const size_t packed_bytes = NumericUtils::saturating_multiply(
+      requested_pages, Constants::CACHE_LINE_SIZE_BYTES);
+  return NumericUtils::saturating_round_up(packed_bytes, page_size_bytes);
+}
+
+bool reset_tlb_chain_cache(TlbChainCache& cache,
+                           size_t layout_identities,
+                           size_t buffer_size_bytes,
+                           size_t page_size_bytes,
+                           size_t maximum_region_bytes) {
+  cache.entries.clear();
+  cache.layout_identities = 0;
+  cache.page_size_bytes = page_size_bytes;
+  cache.arena_bytes = 0;
+  cache.arena_used_bytes = 0;
+  cache.transient_offset_bytes = 0;
+  cache.transient_bytes = 0;
+  if (layout_identities == 0 || page_size_bytes == 0 ||
+      maximum_region_bytes == 0 ||
+      maximum_region_bytes == std::numeric_limits<size_t>::max()) {
+    return false;
+  }
+  const size_t transient_bytes =
+      NumericUtils::saturating_round_up(maximum_region_bytes, page_size_bytes);
+  const size_t usable_bytes =
+      buffer_size_bytes - (buffer_size_bytes % page_size_bytes);
+  if (transient_bytes > usable_bytes) {
+    return false;
+  }
+  cache.layout_identities = layout_identities;
+  cache.arena_bytes = usable_bytes - transient_bytes;
+  cache.transient_offset_bytes = cache.arena_bytes;
+  cache.transient_bytes = transient_bytes;
+  return true;
+}
+
+const TlbChainCacheEntry* find_tlb_chain_cache_entry(
+    const TlbChainCache& cache,
+    TlbChainLayout layout,
+    size_t point_index,
+    size_t layout_identity) {
+  for (const TlbChainCacheEntry& entry : cache.entries) {
+    if (entry.layout == layout && entry.point_index == point_index &&
+        entry.layout_identity == layout_identity) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+size_t reserve_tlb_chain_region(TlbChainCache& cache,
+                                size_t region_bytes,
+                                bool& retained) {
+  retained = false;
+  if (cache.page_size_bytes == 0) {
+    return cache.transient_offset_bytes;
+  }
+  const size_t aligned_bytes =
+      NumericUtils::saturating_round_up(region_bytes, cache.page_size_bytes);
+  if (aligned_bytes == 0 || aligned_bytes > cache.transient_bytes ||
+      aligned_bytes > cache.arena_bytes - cache.arena_used_bytes) {
+    return cache.transient_offset_bytes;
+  }
+  const size_t offset = cache.arena_used_bytes;
+  cache.arena_used_bytes += aligned_bytes;
+  retained = true;
+  return offset;
+}
@@ -0,0 +1,122 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+/**
+ * @file tlb_chain_cache.h
+ * @brief Optional per-point chain-layout reuse for standalone TLB analysis
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#ifndef TLB_CHAIN_CACHE_H
+#define TLB_CHAIN_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/tlb_chain.h"
+#include "benchmark/tlb_measurement_scheduler.h"
+
+/** One verified chain retained in its own buffer region. */
+struct TlbChainCacheEntry {
+  TlbChainLayout layout = TlbChainLayout::Spread;
+  size_t point_index = 0;
+  size_t layout_identity = 0;
+  size_t region_offset_bytes = 0;
+  size_t region_size_bytes = 0;
+  void* chain_head = nullptr;
+  TlbChainDiagnostics diagnostics;
+};
+
+/**
+ * Disjoint-region store for chain layouts reused across rounds of one pass.
+ *
+ * The buffer is split into a retained arena and one transient region at its
+ * end sized for the largest chain of the pass. Chains are retained in
+ * first-request order while the arena has room; later chains are rebuilt in
+ * the transient region for every task. Retained regions never overlap each
+ * other or the transient region, so a reused chain is never overwritten.
+ */
+struct TlbChainCache {
+  size_t layout_identities = 0;
+  size_t page_size_bytes = 0;
+  size_t arena_bytes = 0;
+  size_t arena_used_bytes = 0;
+  size_t transient_offset_bytes = 0;
+  size_t transient_bytes = 0;
+  std::vector<TlbChainCacheEntry> entries;
+};
+
+/**
+ * Map a round to its layout identity.
+ *
+ * Zero identities disables reuse and gives every round its own identity.
+ * Otherwise rounds cycle through `layout_identities` identities.
+ */
+size_t tlb_chain_layout_identity(size_t round_index, size_t layout_identities);
+
+/**
+ * Derive the task seed that owns one layout identity.
+ *
+ * Identity `i` uses the scheduled seed of round `i`, so the first
+ * `layout_identities` rounds build exactly the chains a rebuild-every-task
+ * run would build.
+ */
+uint64_t derive_tlb_layout_identity_seed(uint64_t base_seed,
+                                         TlbMeasurementPass pass,
+                                         size_t layout_identity,
+                                         size_t point_index);
+
+/**
+ * Buffer bytes one chain occupies, rounded up to whole pages.
+ *
+ * TableSpread returns 0 because its page stride, and so its footprint,
+ * depends on the buffer it is built in.
+ */
+size_t tlb_chain_region_bytes(size_t requested_pages,
+                              size_t page_size_bytes,
+                              TlbChainLayout layout);
+
+/**
+ * Clear retained chains and partition the buffer for one pass.
+ *
+ * Returns false when reuse is disabled or the transient region cannot hold
+ * the largest chain; the cache is then left empty and must not be used.
+ */
+bool reset_tlb_chain_cache(TlbChainCache& cache,
+                           size_t layout_identities,
+                           size_t buffer_size_bytes,
+                           size_t page_size_bytes,
+                           size_t maximum_region_bytes);
+
+/** Find a retained chain, or nullptr when it must be built. */
+const TlbChainCacheEntry* find_tlb_chain_cache_entry(
+    const TlbChainCache& cache,
+    TlbChainLayout layout,
+    size_t point_index,
+    size_t layout_identity);
+
+/**
+ * Choose the region for a chain that is not retained yet.
+ *
+ * Sets `retained` when the region was committed from the arena; otherwise the
+ * transient region is returned.
+ */
+size_t reserve_tlb_chain_region(TlbChainCache& cache,
+                                size_t region_bytes,
+                                bool& retained);
+
+#endif  // TLB_CHAIN_CACHE_H
@@ -0,0 +1,125 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+/**
+ * @file tlb_chain_prebuilder.cpp
+ * @brief Helper-thread chain construction for standalone TLB analysis
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include "benchmark/tlb_chain_prebuilder.h"
+
+#include <system_error>
+
+#include <pthread/qos.h>  // For pthread_set_qos_class_self_np
+
+TlbChainBuildResult build_tlb_chain_request(const TlbChainBuildRequest& request,
+                                            TlbChainScratch& scratch) {
+  return build_tlb_chain(request.buffer,
+                         request.buffer_size_bytes,
+                         request.requested_pages,
+                         request.page_size_bytes,
+                         request.stride_bytes,
+                         request.layout,
+                         request.traversal_policy,
+                         request.seed,
+                         scratch);
+}
+
+TlbChainPrebuilder::~TlbChainPrebuilder() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  condition_.notify_all();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+bool TlbChainPrebuilder::ensure_started() {
+  if (thread_.joinable()) {
+    return true;
+  }
+  if (start_failed_) {
+    return false;
+  }
+  try {
+    thread_ = std::thread([this]() { run(); });
+  } catch (const std::system_error&) {
+    start_failed_ = true;
+    return false;
+  }
+  return true;
+}
+
+bool TlbChainPrebuilder::submit(const TlbChainBuildRequest& request) {
+  if (!ensure_started()) {
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (request_pending_ || result_ready_) {
+      return false;
+    }
+    request_ = request;
+    request_pending_ = true;
+  }
+  condition_.notify_all();
+  return true;
+}
+
+TlbChainBuildResult TlbChainPrebuilder::wait() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (!request_pending_ && !result_ready_) {
+    return TlbChainBuildResult{};
+  }
+  condition_.wait(lock, [this]() { return result_ready_; });
+  result_ready_ = false;
+  return result_;
+}
+
+bool TlbChainPrebuilder::reserve_scratch(size_t maximum_region_bytes,
+                                         size_t page_size_bytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (request_pending_ || result_ready_) {
+    return false;
+  }
+  return reserve_tlb_chain_scratch(scratch_, maximum_region_bytes,
+                                   page_size_bytes);
+}
+
+void TlbChainPrebuilder::run() {
+  // Setup work is not latency-critical; a lower class lets the scheduler keep
+  // it off the measuring core where possible. Failure only loses the hint.
+  (void)pthread_set_qos_class_self_np(QOS_CLASS_UTILITY, 0);
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    condition_.wait(lock, [this]() { return stop_ || request_pending_; });
+    if (stop_) {
+      return;
+    }
+    const TlbChainBuildRequest request = request_;
+    lock.unlock();
+    TlbChainBuildResult result = build_tlb_chain_request(request, scratch_);
+    lock.lock();
+    result_ = result;
+    request_pending_ = false;
+    result_ready_ = true;
+    condition_.notify_all();
+  }
+}
@@ -0,0 +1,99 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+/**
+ * @file tlb_chain_prebuilder.h
+ * @brief Helper-thread chain construction for standalone TLB analysis
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#ifndef TLB_CHAIN_PREBUILDER_H
+#define TLB_CHAIN_PREBUILDER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "benchmark/tlb_chain.h"
+
+/** Arguments of one build_tlb_chain() call. */
+struct TlbChainBuildRequest {
+  void* buffer = nullptr;
+  size_t buffer_size_bytes = 0;
+  size_t requested_pages = 0;
+  size_t page_size_bytes = 0;
+  size_t stride_bytes = 0;
+  TlbChainLayout layout = TlbChainLayout::Spread;
+  TlbChainTraversalPolicy traversal_policy =
+      TlbChainTraversalPolicy::RandomPagesRandomOffsets;
+  uint64_t seed = 0;
+};
+
+/** Run one build request with caller-owned scratch. */
+TlbChainBuildResult build_tlb_chain_request(const TlbChainBuildRequest& request,
+                                            TlbChainScratch& scratch);
+
+/**
+ * One persistent helper thread that builds and validates a chain while the
+ * caller builds another one in a disjoint buffer region.
+ *
+ * Standalone TLB analysis submits the next task's first chain once the
+ * current task's timed traversals finish. The helper owns its own scratch and
+ * blocks on a condition variable while idle. Callers wait() for the result
+ * before the next timed region, so the helper never runs while latency is
+ * being measured. The thread is started on the
+ * first submit(); if it cannot be created, submit() returns false and the
+ * caller builds serially.
+ */
+class TlbChainPrebuilder {
+ public:
+  TlbChainPrebuilder() = default;
+  ~TlbChainPrebuilder();
+
+  TlbChainPrebuilder(const TlbChainPrebuilder&) = delete;
+  TlbChainPrebuilder& operator=(const TlbChainPrebuilder&) = delete;
+
+  /** Hand one build to the helper; false when unavailable or already busy. */
+  bool submit(const TlbChainBuildRequest& request);
+
+  /** Block until the submitted build finishes; the helper is idle on return. */
+  TlbChainBuildResult wait();
+
+  /**
+   * Size the helper's scratch for regions up to `maximum_region_bytes`
+   * (see reserve_tlb_chain_scratch()); false when busy or out of memory.
+   */
+  bool reserve_scratch(size_t maximum_region_bytes, size_t page_size_bytes);
+
+ private:
+  bool ensure_started();
+  void run();
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::thread thread_;
+  bool start_failed_ = false;
+  bool stop_ = false;
+  bool request_pending_ = false;
+  bool result_ready_ = false;
+  TlbChainBuildRequest request_;
+  TlbChainBuildResult result_;
+  TlbChainScratch scratch_;
+};
+
+#endif  // TLB_CHAIN_PREBUILDER_H
@@ -28,6 +28,71 @@
 #include <numeric>
 #include <random>
 
+namespace {
+
+std::vector<size_t> seeded_tlb_point_order(
+    const std::vector<TlbSweepPoint>& points,
+    uint64_t base_seed,
+    TlbMeasurementPass pass) {
+  std::vector<size_t> seeded_point_order(points.size());
+  std::iota(seeded_point_order.begin(), seeded_point_order.end(), 0);
+  std::mt19937_64 rng(derive_tlb_measurement_seed(base_seed, pass, 0, points.size()));
+  std::shuffle(seeded_point_order.begin(), seeded_point_order.end(), rng);
+  return seeded_point_order;
+}
+
+void append_tlb_round(const std::vector<TlbSweepPoint>& points,
+                      const std::vector<size_t>& point_order,
+                      size_t round_index,
+                      uint64_t base_seed,
+                      TlbMeasurementPass pass,
+                      std::vector<TlbMeasurementTask>& schedule) {
+  for (size_t order_index = 0; order_index < point_order.size(); ++order_index) {
+    const size_t rotated_index = (order_index + round_index) % point_order.size();
+    const size_t local_point_index = point_order[rotated_index];
+    const size_t point_index = points[local_point_index].point_index;
+    schedule.push_back(TlbMeasurementTask{
+        pass,
+        point_index,
+        points[local_point_index].locality_bytes,
+        round_index,
+        order_index,
+        derive_tlb_measurement_seed(base_seed, pass, round_index, point_index),
+    });
+  }
+}
+
+/** Measure and record one task; returns false after recording an interrupt or error. */
+bool execute_tlb_task(const TlbMeasurementTask& task,
+                      const TlbStopRequested& stop_requested,
+                      const TlbTaskMeasureFunction& measure_task,
+                      TlbScheduleExecutionResult& result) {
+  if (stop_requested && stop_requested()) {
+    result.status = TlbScheduleExecutionStatus::Interrupted;
+    return false;
+  }
+
+  TlbMeasurementSample sample;
+  if (!measure_task ||
+      measure_task(task, sample) != TlbTaskMeasureStatus::Success) {
+    result.status = TlbScheduleExecutionStatus::Error;
+    return false;
+  }
+  result.records.push_back(TlbMeasurementRecord{
+      task.pass,
+      task.point_index,
+      task.locality_bytes,
+      task.round_index,
+      task.order_index,
+      task.seed,
+      sample.latency_ns,
+      sample.paired,
+  });
+  return true;
+}
+
+}  // namespace
+
 const char* tlb_measurement_pass_to_string(TlbMeasurementPass pass) {
   switch (pass) {
     case TlbMeasurementPass::Base:
@@ -38,6 +103,8 @@ const char* tlb_measurement_pass_to_string(TlbMeasurementPass pass) {
       return "validation";
     case TlbMeasurementPass::LargeLocality:
       return "large-locality";
+    case TlbMeasurementPass::PageTableFootprint:
+      return "page-table-footprint";
   }
   return "base";
 }
@@ -69,79 +136,93 @@ std::vector<TlbMeasurementTask> build_tlb_measurement_schedule(
     return schedule;
   }
 
-  std::vector<size_t> seeded_point_order(points.size());
-  std::iota(seeded_point_order.begin(), seeded_point_order.end(), 0);
-  std::mt19937_64 rng(derive_tlb_measurement_seed(base_seed, pass, 0, points.size()));
-  std::shuffle(seeded_point_order.begin(), seeded_point_order.end(), rng);
-
+  const std::vector<size_t> seeded_point_order =
+      seeded_tlb_point_order(points, base_seed, pass);
   schedule.reserve(points.size() * round_count);
   for (size_t round_index = 0; round_index < round_count; ++round_index) {
-    for (size_t order_index = 0; order_index < points.size(); ++order_index) {
-      const size_t rotated_index = (order_index + round_index) % points.size();
-      const size_t local_point_index = seeded_point_order[rotated_index];
-      const size_t point_index = points[local_point_index].point_index;
-      schedule.push_back(TlbMeasurementTask{
-          pass,
-          point_index,
-          points[local_point_index].locality_bytes,
-          round_index,
-          order_index,
-          derive_tlb_measurement_seed(base_seed, pass, round_index, point_index),
-      });
-    }
+    append_tlb_round(points, seeded_point_order, round_index, base_seed, pass,
+                     schedule);
   }
   return schedule;
 }
 
-TlbScheduleExecutionResult execute_tlb_measurement_schedule(
-    const std::vector<TlbMeasurementTask>& schedule,
-    const TlbStopRequested& stop_requested,
-    const TlbTaskMeasureFunction& measure_task,
-    const TlbRoundCompleteFunction& stop_when_converged) {
-  TlbScheduleExecutionResult result;
-  result.records.reserve(schedule.size());
+std::vector<TlbMeasurementTask> build_tlb_active_round_schedule(
+    const std::vector<TlbSweepPoint>& points,
+    const std::vector<uint8_t>& active_points,
+    size_t round_index,
+    uint64_t base_seed,
+    TlbMeasurementPass pass) {
+  std::vector<TlbMeasurementTask> round;
+  if (points.empty() || active_points.size() != points.size()) {
+    return round;
+  }
 
-  for (size_t task_index = 0; task_index < schedule.size(); ++task_index) {
-    const TlbMeasurementTask& task = schedule[task_index];
-    if (stop_requested && stop_requested()) {
-      result.status = TlbScheduleExecutionStatus::Interrupted;
-      return result;
+  std::vector<size_t> active_order;
+  active_order.reserve(points.size());
+  for (size_t local_point_index :
+       seeded_tlb_point_order(points, base_seed, pass)) {
+    if (active_points[local_point_index] != 0) {
+      active_order.push_back(local_point_index);
     }
+  }
+  round.reserve(active_order.size());
+  append_tlb_round(points, active_order, round_index, base_seed, pass, round);
+  return round;
+}
 
-    TlbMeasurementSample sample;
-    if (!measure_task ||
-        measure_task(task, sample) != TlbTaskMeasureStatus::Success) {
-      result.status = TlbScheduleExecutionStatus::Error;
-      return result;
-    }
-    result.records.push_back(TlbMeasurementRecord{
-        task.pass,
-        task.point_index,
-        task.locality_bytes,
-        task.round_index,
-        task.order_index,
-        task.seed,
-        sample.latency_ns,
-        sample.paired,
-    });
+TlbScheduleExecutionResult execute_tlb_sequential_schedule(
+    const std::vector<TlbSweepPoint>& points,
+    size_t max_rounds,
+    uint64_t base_seed,
+    TlbMeasurementPass pass,
+    const TlbStopRequested& stop_requested,
+    const TlbTaskMeasureFunction& measure_task,
+    const TlbActivePointsFunction& update_active_points,
+    const TlbNextTaskFunction& announce_next_task) {
+  TlbScheduleExecutionResult result;
+  if (points.empty() || max_rounds == 0) {
+    return result;
+  }
+  if (max_rounds <= std::numeric_limits<size_t>::max() / points.size()) {
+    result.records.reserve(points.size() * max_rounds);
+  }
 
-    const bool round_complete =
-        task_index + 1 == schedule.size() ||
-        schedule[task_index + 1].round_index != task.round_index;
-    if (round_complete) {
-      ++result.rounds_completed;
+  std::vector<uint8_t> active_points(points.size(), 1);
+  for (size_t round_index = 0; round_index < max_rounds; ++round_index) {
+    const std::vector<TlbMeasurementTask> round = build_tlb_active_round_schedule(
+        points, active_points, round_index, base_seed, pass);
+    for (size_t order_index = 0; order_index < round.size(); ++order_index) {
+      if (announce_next_task) {
+        announce_next_task(order_index + 1 < round.size() ? &round[order_index + 1]
+                                                          : nullptr);
+      }
+      if (!execute_tlb_task(round[order_index], stop_requested, measure_task,
+                            result)) {
+        return result;
+      }
+      if (order_index + 1 == round.size()) {
+        ++result.rounds_completed;
+      }
+      if (stop_requested && stop_requested()) {
+        result.status = TlbScheduleExecutionStatus::Interrupted;
+        return result;
+      }
     }
 
-    if (stop_requested && stop_requested()) {
-      result.status = TlbScheduleExecutionStatus::Interrupted;
-      return result;
+    if (update_active_points) {
+      update_active_points(result.rounds_completed, result.records,
+                           active_points);
+      if (active_points.size() != points.size()) {
+        result.status = TlbScheduleExecutionStatus::Error;
+        return result;
+      }
     }
-    if (round_complete && stop_when_converged &&
-        stop_when_converged(result.rounds_completed, result.records)) {
+    result.retired_points = static_cast<size_t>(
+        std::count(active_points.begin(), active_points.end(), 0));
+    if (result.retired_points == points.size()) {
       result.converged = true;
       return result;
     }
   }
-
   return result;
 }
@@ -36,6 +36,7 @@ enum class TlbMeasurementPass {
   Refinement,
   Validation,
   LargeLocality,
+  PageTableFootprint,
 };
 
 /** One deterministic measurement action in execution order. */
@@ -55,6 +56,8 @@ struct TlbChainMeasurement {
   size_t pilot_access_count = 0;
   double pilot_duration_ns = 0.0;
   size_t access_count = 0;
+  size_t layout_identity = 0;
+  bool layout_reused = false;
   TlbChainDiagnostics diagnostics;
 };
 
@@ -72,9 +75,15 @@ struct TlbPassExecutionSummary {
   bool converged = false;
   bool complete = false;
   TlbScheduleExecutionStatus status = TlbScheduleExecutionStatus::Complete;
+  size_t retired_points = 0;
 };
 
-/** Same-round spread/packed control pair. */
+/**
+ * Same-round spread/packed control pair.
+ *
+ * In the page-table-footprint pass `spread` holds the TableSpread chain and
+ * `packed` the TableDense control; each diagnostic records its layout.
+ */
 struct TlbPairedMeasurement {
   bool available = false;
   bool spread_measured_first = true;
@@ -111,14 +120,18 @@ struct TlbScheduleExecutionResult {
   std::vector<TlbMeasurementRecord> records;
   size_t rounds_completed = 0;
   bool converged = false;
+  size_t retired_points = 0;
 };
 
 using TlbStopRequested = std::function<bool()>;
 using TlbTaskMeasureFunction =
     std::function<TlbTaskMeasureStatus(const TlbMeasurementTask&,
                                        TlbMeasurementSample&)>;
-using TlbRoundCompleteFunction =
-    std::function<bool(size_t, const std::vector<TlbMeasurementRecord>&)>;
+using TlbActivePointsFunction =
+    std::function<void(size_t,
+                       const std::vector<TlbMeasurementRecord>&,
+                       std::vector<uint8_t>&)>;
+using TlbNextTaskFunction = std::function<void(const TlbMeasurementTask*)>;
 
 const char* tlb_measurement_pass_to_string(TlbMeasurementPass pass);
 
@@ -137,11 +150,41 @@ std::vector<TlbMeasurementTask> build_tlb_measurement_schedule(
     uint64_t base_seed,
     TlbMeasurementPass pass);
 
-/** Execute tasks with non-blocking stop and optional whole-round convergence callbacks. */
-TlbScheduleExecutionResult execute_tlb_measurement_schedule(
-    const std::vector<TlbMeasurementTask>& schedule,
+/**
+ * Build one cyclic Latin round restricted to still-active points.
+ *
+ * Active points keep their seeded relative order and are rotated by the round
+ * index, so a stable active set sees every order position equally often. With
+ * every point active the round equals the matching round of
+ * build_tlb_measurement_schedule().
+ */
+std::vector<TlbMeasurementTask> build_tlb_active_round_schedule(
+    const std::vector<TlbSweepPoint>& points,
+    const std::vector<uint8_t>& active_points,
+    size_t round_index,
+    uint64_t base_seed,
+    TlbMeasurementPass pass);
+
+/**
+ * Execute up to `max_rounds` rounds, retiring points between rounds.
+ *
+ * After each complete round the optional callback may clear entries of the
+ * per-point active mask, or set them again to resume a retired point. Only
+ * active points are scheduled. The pass converges when no active point
+ * remains.
+ *
+ * Before each task the optional `announce_next_task` callback receives the
+ * task that follows it in the same round, or nullptr for a round's last
+ * task, whose successor depends on the retirement update.
+ */
+TlbScheduleExecutionResult execute_tlb_sequential_schedule(
+    const std::vector<TlbSweepPoint>& points,
+    size_t max_rounds,
+    uint64_t base_seed,
+    TlbMeasurementPass pass,
     const TlbStopRequested& stop_requested,
     const TlbTaskMeasureFunction& measure_task,
-    const TlbRoundCompleteFunction& stop_when_converged = {});
+    const TlbActivePointsFunction& update_active_points,
+    const TlbNextTaskFunction& announce_next_task = {});
 
 #endif  // TLB_MEASUREMENT_SCHEDULER_H
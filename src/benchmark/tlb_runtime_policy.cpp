@@ -22,7 +22,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <limits>
+#include <numeric>
 #include <random>
 #include <vector>
 
@@ -39,7 +41,11 @@ constexpr size_t kTlbMemoryReserveMb = 1024;
 constexpr size_t kFallbackMemoryBudgetMb = 384;
 constexpr size_t kScratchFixedOverheadBytes = Constants::BYTES_PER_MB;
 constexpr size_t kScratchBytesPerNode = 256;
+// The measuring thread and the chain prebuilder each own one chain scratch.
+constexpr size_t kChainScratchInstances = 2;
 constexpr double kDurationOverheadFactor = 1.25;
+constexpr double kBoundaryGuardMinimumStepNs = 0.5;
+constexpr size_t kBoundaryGuardPersistencePoints = 2;
 
 double median_in_place(std::vector<double>& values) {
   if (values.empty()) {
@@ -157,13 +163,17 @@ size_t calculate_tlb_calibrated_accesses(
   return std::min(rounded, effective_maximum - (effective_maximum % node_count));
 }
 
-TlbConvergenceSummary evaluate_tlb_convergence(
+TlbConvergenceSummary update_tlb_active_points(
+    const std::vector<size_t>& locality_bytes,
     const std::vector<std::vector<double>>& samples_by_point,
     const TlbRuntimeProfile& profile,
     uint64_t bootstrap_seed,
+    std::vector<uint8_t>& active_points,
     TlbConvergenceScratch* scratch) {
   TlbConvergenceSummary summary;
-  if (samples_by_point.empty() || profile.min_rounds == 0 ||
+  const size_t point_count = samples_by_point.size();
+  if (point_count == 0 || locality_bytes.size() != point_count ||
+      active_points.size() != point_count || profile.min_rounds == 0 ||
       profile.ci_width_target_ns <= 0.0 ||
       profile.convergence_bootstrap_resamples == 0) {
     return summary;
@@ -172,9 +182,60 @@ TlbConvergenceSummary evaluate_tlb_convergence(
   TlbConvergenceScratch local_scratch;
   TlbConvergenceScratch& reusable_scratch =
       scratch == nullptr ? local_scratch : *scratch;
+
+  // Walk points in locality order so boundary windows follow the sweep.
+  std::vector<size_t> locality_order(point_count);
+  std::iota(locality_order.begin(), locality_order.end(), 0);
+  std::sort(locality_order.begin(), locality_order.end(),
+            [&locality_bytes](size_t lhs, size_t rhs) {
+              return locality_bytes[lhs] < locality_bytes[rhs];
+            });
+  std::vector<double> point_medians(point_count,
+                                    std::numeric_limits<double>::quiet_NaN());
+  for (size_t point_index = 0; point_index < point_count; ++point_index) {
+    if (samples_by_point[point_index].size() >= profile.min_rounds) {
+      reusable_scratch.resample = samples_by_point[point_index];
+      point_medians[point_index] = median_in_place(reusable_scratch.resample);
+    }
+  }
+  std::vector<double> required_width_ns(point_count,
+                                        profile.ci_width_target_ns);
+  for (size_t rank = 1; rank < point_count; ++rank) {
+    const double step_ns = std::abs(point_medians[locality_order[rank]] -
+                                    point_medians[locality_order[rank - 1]]);
+    if (!std::isfinite(step_ns) || step_ns < kBoundaryGuardMinimumStepNs) {
+      continue;
+    }
+    const size_t window_end =
+        std::min(point_count, rank + kBoundaryGuardPersistencePoints + 1);
+    for (size_t guarded = rank - 1; guarded < window_end; ++guarded) {
+      double& required = required_width_ns[locality_order[guarded]];
+      required = std::min(required, 0.5 * step_ns);
+    }
+  }
+
   summary.converged = true;
-  for (size_t point_index = 0; point_index < samples_by_point.size();
-       ++point_index) {
+  for (size_t point_index = 0; point_index < point_count; ++point_index) {
+    if (active_points[point_index] == 0) {
+      // A step found after this point retired can tighten its requirement;
+      // measure it again until it also resolves that step.
+      if (required_width_ns[point_index] >= profile.ci_width_target_ns) {
+        continue;
+      }
+      const double retired_width = bootstrap_median_ci_width(
+          samples_by_point[point_index],
+          profile.convergence_bootstrap_resamples,
+          bootstrap_seed ^ static_cast<uint64_t>(point_index),
+          reusable_scratch);
+      if (std::isfinite(retired_width) &&
+          retired_width <= required_width_ns[point_index]) {
+        continue;
+      }
+      active_points[point_index] = 1;
+      ++summary.reactivated_points;
+      summary.converged = false;
+      continue;
+    }
     const std::vector<double>& samples = samples_by_point[point_index];
     if (samples.size() < profile.min_rounds) {
       summary.converged = false;
@@ -188,13 +249,12 @@ TlbConvergenceSummary evaluate_tlb_convergence(
     summary.maximum_ci_width_ns =
         std::max(summary.maximum_ci_width_ns, width);
     ++summary.evaluated_points;
-    if (!std::isfinite(width) || width > profile.ci_width_target_ns) {
+    if (std::isfinite(width) && width <= required_width_ns[point_index]) {
+      active_points[point_index] = 0;
+    } else {
       summary.converged = false;
     }
   }
-  if (summary.evaluated_points != samples_by_point.size()) {
-    summary.converged = false;
-  }
   return summary;
 }
 
@@ -222,7 +282,16 @@ size_t estimate_tlb_scratch_bytes(size_t maximum_node_count) {
 
 size_t estimate_tlb_peak_memory_bytes(size_t buffer_size_bytes,
                                       size_t maximum_node_count) {
-  const size_t scratch_bytes = estimate_tlb_scratch_bytes(maximum_node_count);
+  // Each validator keeps one word-mask byte per buffer cache line and one
+  // node counter per page on top of its per-node builder storage.
+  const size_t dense_validation_bytes = NumericUtils::saturating_add(
+      buffer_size_bytes / Constants::CACHE_LINE_SIZE_BYTES,
+      NumericUtils::saturating_multiply(maximum_node_count, sizeof(uint32_t)));
+  const size_t scratch_bytes = NumericUtils::saturating_multiply(
+      NumericUtils::saturating_add(
+          estimate_tlb_scratch_bytes(maximum_node_count),
+          dense_validation_bytes),
+      kChainScratchInstances);
   if (buffer_size_bytes >
       std::numeric_limits<size_t>::max() - scratch_bytes) {
     return std::numeric_limits<size_t>::max();
@@ -43,6 +43,7 @@ struct TlbConvergenceSummary {
   bool converged = false;
   size_t evaluated_points = 0;
   double maximum_ci_width_ns = 0.0;
+  size_t reactivated_points = 0;
 };
 
 struct TlbConvergenceScratch {
@@ -75,11 +76,23 @@ size_t calculate_tlb_calibrated_accesses(
     double pilot_duration_ns,
     const TlbRuntimeProfile& profile);
 
-/** Check whether every point's deterministic bootstrap median CI is narrow enough. */
-TlbConvergenceSummary evaluate_tlb_convergence(
+/**
+ * Retire points whose deterministic bootstrap median CI is narrow enough.
+ *
+ * `locality_bytes` and `samples_by_point` are indexed like `active_points`.
+ * A point is considered only after `min_rounds` samples. Points inside a
+ * candidate-boundary window, from the point before a median step of at least
+ * 0.5 ns through the two following persistence points, must also resolve half
+ * that step. A retired point that falls inside a window found later is
+ * re-activated when its CI does not resolve the new step; the summary
+ * converges once no point remains active.
+ */
+TlbConvergenceSummary update_tlb_active_points(
+    const std::vector<size_t>& locality_bytes,
     const std::vector<std::vector<double>>& samples_by_point,
     const TlbRuntimeProfile& profile,
     uint64_t bootstrap_seed,
+    std::vector<uint8_t>& active_points,
     TlbConvergenceScratch* scratch = nullptr);
 
 /** Derive the conservative TLB allocation budget from currently available memory. */
@@ -88,7 +101,11 @@ size_t calculate_tlb_memory_budget_mb(size_t available_memory_mb);
 /** Estimate retained chain-builder and validator scratch storage. */
 size_t estimate_tlb_scratch_bytes(size_t maximum_node_count);
 
-/** Estimate the buffer plus retained scratch peak. */
+/**
+ * Estimate the buffer plus the retained per-node, per-page, and
+ * per-cache-line scratch of both chain builders (measuring thread and
+ * prebuilder).
+ */
 size_t estimate_tlb_peak_memory_bytes(size_t buffer_size_bytes,
                                       size_t maximum_node_count);
 
@@ -29,6 +29,7 @@
 #include <map>
 
 #include "core/config/constants.h"
+#include "output/console/messages/messages_api.h"
 
 namespace {
 
@@ -285,3 +286,32 @@ std::vector<size_t> tlb_point_localities(const std::vector<TlbSweepPoint>& point
   }
   return localities;
 }
+
+std::vector<TlbPageGranule> build_tlb_page_granules(size_t base_page_size_bytes) {
+  std::vector<TlbPageGranule> granules;
+  if (base_page_size_bytes == 0) {
+    return granules;
+  }
+  granules.push_back(
+      TlbPageGranule{base_page_size_bytes, "base-pages", true, ""});
+
+  const size_t descriptors_per_table = base_page_size_bytes / sizeof(uint64_t);
+  if (descriptors_per_table > 1 &&
+      base_page_size_bytes <=
+          std::numeric_limits<size_t>::max() / descriptors_per_table) {
+    granules.push_back(TlbPageGranule{
+        base_page_size_bytes * descriptors_per_table,
+        "block-mapping",
+        false,
+        Messages::tlb_page_granule_reason_block_mapping()});
+  }
+  return granules;
+}
+
+size_t tlb_effective_reach_bytes(size_t entries, size_t page_size_bytes) {
+  if (page_size_bytes != 0 &&
+      entries > std::numeric_limits<size_t>::max() / page_size_bytes) {
+    return std::numeric_limits<size_t>::max();
+  }
+  return entries * page_size_bytes;
+}
@@ -42,6 +42,14 @@ struct TlbSweepPoint {
   size_t bracket_upper_bytes = 0;
 };
 
+/** Translation granule considered by analysis and whether it was measured. */
+struct TlbPageGranule {
+  size_t page_size_bytes = 0;
+  std::string backing;
+  bool analyzed = false;
+  std::string reason;
+};
+
 /** Boundary candidate that requests refinement and labels its source. */
 struct TlbRefinementTarget {
   size_t boundary_index = 0;
@@ -73,6 +81,17 @@ std::vector<size_t> build_tlb_refinement_points(const std::vector<size_t>& local
                                                 size_t max_locality_bytes,
                                                 size_t alignment_bytes);
 
+/**
+ * List the base page granule and the next block-mapping granule.
+ *
+ * Only base pages can be requested from macOS user space, so the block
+ * granule (page size times page size / 8 descriptors) is reported unanalyzed.
+ */
+std::vector<TlbPageGranule> build_tlb_page_granules(size_t base_page_size_bytes);
+
+/** Translation reach of `entries` pages, saturating instead of overflowing. */
+size_t tlb_effective_reach_bytes(size_t entries, size_t page_size_bytes);
+
 /** Extract locality byte values from a planned point vector. */
 std::vector<size_t> tlb_point_localities(const std::vector<TlbSweepPoint>& points);
 
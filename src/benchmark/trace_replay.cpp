@@ -0,0 +1,425 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file trace_replay.cpp
+ * @brief Trace format codec, page packing, and JSON for trace replay mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * The decoder makes one sequential pass over the mapped file and reports the
+ * first malformed record by number. Page packing and widening happen here,
+ * so the timed loop only adds an offset to the buffer base. Execution lives
+ * in trace_replay_runner.cpp.
+ */
+
+#include "benchmark/trace_replay.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <random>
+
+#include "core/memory/memory_manager.h"
+#include "output/console/messages/messages_api.h"
+#include "utils/descriptive_statistics.h"
+
+namespace {
+
+void append_uleb128(std::vector<unsigned char>& out, uint64_t value) {
+  do {
+    unsigned char byte = static_cast<unsigned char>(value & 0x7F);
+    value >>= 7;
+    if (value != 0) {
+      byte |= 0x80;
+    }
+    out.push_back(byte);
+  } while (value != 0);
+}
+
+void append_le(std::vector<unsigned char>& out, uint64_t value, size_t bytes) {
+  for (size_t index = 0; index < bytes; ++index) {
+    out.push_back(static_cast<unsigned char>(value >> (8 * index)));
+  }
+}
+
+uint64_t read_le(const unsigned char* data, size_t bytes) {
+  uint64_t value = 0;
+  for (size_t index = 0; index < bytes; ++index) {
+    value |= static_cast<uint64_t>(data[index]) << (8 * index);
+  }
+  return value;
+}
+
+// At most ten bytes; the tenth may only carry the top bit of a 64-bit value.
+bool read_uleb128(const unsigned char* data, size_t size, size_t& position, uint64_t& value) {
+  value = 0;
+  for (unsigned shift = 0; shift < 64; shift += 7) {
+    if (position >= size) {
+      return false;
+    }
+    const unsigned char byte = data[position++];
+    if (shift == 63 && (byte & 0x7E) != 0) {
+      return false;
+    }
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+struct TraceReplayDecodeThread {
+  size_t index = 0;        ///< Position in TraceReplayTrace::threads
+  uint64_t previous = 0;   ///< Last traced address, before widening
+};
+
+// Give back fully decoded pages of the mapping; a failed hint changes nothing.
+void release_decoded_window(const unsigned char* data, size_t position, size_t& released) {
+  const size_t system_page = static_cast<size_t>(getpagesize());
+  const size_t end = position / system_page * system_page;
+  if (end <= released || end - released < Constants::TRACE_REPLAY_DECODE_WINDOW_BYTES) {
+    return;
+  }
+  (void)madvise(const_cast<unsigned char*>(data) + released, end - released, MADV_DONTNEED);
+  released = end;
+}
+
+bool pack_trace_replay_pages(TraceReplayTrace& trace, std::string& error) {
+  const uint64_t page_bytes = Constants::TRACE_REPLAY_PAGE_BYTES;
+  std::vector<uint64_t> pages;
+  for (const TraceReplayThread& thread : trace.threads) {
+    for (const TraceReplayOp& op : thread.ops) {
+      // Runs on one page are the common case; dropping them early keeps the list short.
+      const uint64_t page = op.offset / page_bytes;
+      if (pages.empty() || pages.back() != page) {
+        pages.push_back(page);
+      }
+    }
+  }
+  std::sort(pages.begin(), pages.end());
+  pages.erase(std::unique(pages.begin(), pages.end()), pages.end());
+  if (pages.size() > Constants::TRACE_REPLAY_MAX_BUFFER_BYTES / page_bytes) {
+    error = Messages::trace_replay_reason_too_many_pages(
+        pages.size(), Constants::TRACE_REPLAY_MAX_BUFFER_BYTES / page_bytes);
+    return false;
+  }
+  for (TraceReplayThread& thread : trace.threads) {
+    for (TraceReplayOp& op : thread.ops) {
+      const uint64_t page = op.offset / page_bytes;
+      const uint64_t packed = static_cast<uint64_t>(
+          std::lower_bound(pages.begin(), pages.end(), page) - pages.begin());
+      op.offset = packed * page_bytes + op.offset % page_bytes;
+    }
+  }
+  trace.touched_pages = pages.size();
+  trace.buffer_bytes = pages.size() * Constants::TRACE_REPLAY_PAGE_BYTES;
+  return true;
+}
+
+void finalize_order_measurement(TraceReplayOrderMeasurement& measurement) {
+  if (measurement.gb_s_samples.empty()) {
+    return;
+  }
+  const DescriptiveStatistics bandwidth =
+      calculate_descriptive_statistics(measurement.gb_s_samples);
+  measurement.median_gb_s = bandwidth.median;
+  measurement.gb_s_cv_pct = bandwidth.coefficient_of_variation_pct;
+  measurement.median_mops = calculate_descriptive_statistics(measurement.mops_samples).median;
+}
+
+}  // namespace
+
+std::vector<unsigned char> encode_trace_replay(const std::vector<TraceReplayRecord>& records) {
+  std::vector<unsigned char> out(Constants::TRACE_REPLAY_MAGIC,
+                                 Constants::TRACE_REPLAY_MAGIC +
+                                     Constants::TRACE_REPLAY_MAGIC_BYTES);
+  append_le(out, Constants::TRACE_REPLAY_FORMAT_VERSION, 4);
+  append_le(out, 0, 4);
+  append_le(out, records.size(), 8);
+  append_le(out, 0, 8);
+  std::map<uint32_t, uint64_t> previous;
+  for (const TraceReplayRecord& record : records) {
+    out.push_back(static_cast<unsigned char>((record.write ? 1U : 0U) |
+                                             (record.dependent ? 2U : 0U) |
+                                             ((record.size_log2 & 7U) << 2)));
+    append_uleb128(out, record.thread_id);
+    // Wrapping subtraction, then zigzag so small backward steps stay short.
+    const uint64_t delta = record.address - previous[record.thread_id];
+    const uint64_t zigzag = (delta << 1) ^ (0 - (delta >> 63));
+    append_uleb128(out, zigzag);
+    previous[record.thread_id] = record.address;
+  }
+  return out;
+}
+
+bool decode_trace_replay(const unsigned char* data, size_t size, TraceReplayTrace& trace,
+                         std::string& error, bool release_consumed) {
+  trace = TraceReplayTrace{};
+  if (size < Constants::TRACE_REPLAY_HEADER_BYTES) {
+    error = Messages::trace_replay_reason_short_header(Constants::TRACE_REPLAY_HEADER_BYTES);
+    return false;
+  }
+  if (std::memcmp(data, Constants::TRACE_REPLAY_MAGIC, Constants::TRACE_REPLAY_MAGIC_BYTES) !=
+      0) {
+    error = Messages::trace_replay_reason_bad_magic(Constants::TRACE_REPLAY_MAGIC);
+    return false;
+  }
+  const uint64_t version = read_le(data + 8, 4);
+  if (version != Constants::TRACE_REPLAY_FORMAT_VERSION) {
+    error = Messages::trace_replay_reason_version(version,
+                                                  Constants::TRACE_REPLAY_FORMAT_VERSION);
+    return false;
+  }
+  if (read_le(data + 12, 4) != 0 || read_le(data + 24, 8) != 0) {
+    error = Messages::trace_replay_reason_reserved_fields();
+    return false;
+  }
+  const uint64_t record_count = read_le(data + 16, 8);
+  if (record_count == 0) {
+    error = Messages::trace_replay_reason_no_records();
+    return false;
+  }
+  if (record_count > Constants::TRACE_REPLAY_MAX_RECORDS) {
+    error = Messages::trace_replay_reason_too_many_records(record_count,
+                                                           Constants::TRACE_REPLAY_MAX_RECORDS);
+    return false;
+  }
+
+  std::map<uint32_t, TraceReplayDecodeThread> threads;
+  uint64_t lowest = std::numeric_limits<uint64_t>::max();
+  uint64_t highest = 0;
+  size_t position = Constants::TRACE_REPLAY_HEADER_BYTES;
+  size_t released = 0;
+  for (uint64_t record = 1; record <= record_count; ++record) {
+    if (position >= size) {
+      error = Messages::error_trace_replay_record(
+          record, Messages::trace_replay_reason_record_missing());
+      return false;
+    }
+    const unsigned control = data[position++];
+    const unsigned size_log2 = (control >> 2) & 7U;
+    if ((control & 0xE0U) != 0 || size_log2 > Constants::TRACE_REPLAY_MAX_SIZE_LOG2) {
+      error = Messages::error_trace_replay_record(
+          record, Messages::trace_replay_reason_control_byte(control));
+      return false;
+    }
+    uint64_t thread_id = 0;
+    uint64_t zigzag = 0;
+    if (!read_uleb128(data, size, position, thread_id) ||
+        thread_id > std::numeric_limits<uint32_t>::max()) {
+      error = Messages::error_trace_replay_record(record,
+                                                  Messages::trace_replay_reason_thread_id());
+      return false;
+    }
+    if (!read_uleb128(data, size, position, zigzag)) {
+      error = Messages::error_trace_replay_record(
+          record, Messages::trace_replay_reason_address_delta());
+      return false;
+    }
+
+    auto found = threads.find(static_cast<uint32_t>(thread_id));
+    if (found == threads.end()) {
+      if (threads.size() == Constants::TRACE_REPLAY_MAX_THREADS) {
+        error = Messages::trace_replay_reason_too_many_threads(
+            Constants::TRACE_REPLAY_MAX_THREADS);
+        return false;
+      }
+      TraceReplayDecodeThread decode_thread;
+      decode_thread.index = trace.threads.size();
+      found = threads.emplace(static_cast<uint32_t>(thread_id), decode_thread).first;
+      trace.threads.emplace_back();
+      trace.threads.back().thread_id = static_cast<uint32_t>(thread_id);
+    }
+    const uint64_t delta = (zigzag >> 1) ^ (0 - (zigzag & 1));
+    const uint64_t address = found->second.previous + delta;
+    const uint64_t access_bytes = uint64_t{1} << size_log2;
+    if (address > std::numeric_limits<uint64_t>::max() - (access_bytes - 1)) {
+      error = Messages::error_trace_replay_record(
+          record, Messages::trace_replay_reason_address_overflow());
+      return false;
+    }
+    found->second.previous = address;
+    lowest = std::min(lowest, address);
+    highest = std::max(highest, address + access_bytes - 1);
+
+    // Widen to whole 8-byte words and align naturally, so no access crosses a page.
+    const uint64_t alignment = std::max<uint64_t>(access_bytes, sizeof(uint64_t));
+    TraceReplayOp op;
+    op.offset = address & ~(alignment - 1);
+    op.words = static_cast<uint32_t>(alignment / sizeof(uint64_t));
+    op.write = static_cast<uint8_t>(control & 1U);
+    op.dependent = static_cast<uint8_t>((control >> 1) & 1U);
+    TraceReplayThread& thread = trace.threads[found->second.index];
+    thread.ops.push_back(op);
+    thread.bytes += access_bytes;
+    thread.writes += op.write;
+    thread.dependent_accesses += op.dependent;
+    trace.total_bytes += access_bytes;
+
+    if (release_consumed) {
+      release_decoded_window(data, position, released);
+    }
+  }
+  if (position != size) {
+    error = Messages::trace_replay_reason_trailing_bytes(size - position);
+    return false;
+  }
+
+  // Workers follow thread ids in ascending order.
+  std::sort(trace.threads.begin(), trace.threads.end(),
+            [](const TraceReplayThread& left, const TraceReplayThread& right) {
+              return left.thread_id < right.thread_id;
+            });
+  trace.record_count = record_count;
+  trace.address_span_bytes = highest - lowest + 1;
+  return pack_trace_replay_pages(trace, error);
+}
+
+bool load_trace_replay_file(const std::string& path, TraceReplayTrace& trace,
+                            std::string& error) {
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    error = Messages::trace_replay_reason_open_failed(std::strerror(errno));
+    return false;
+  }
+  struct stat file_stat {};
+  if (fstat(fd, &file_stat) != 0) {
+    error = Messages::trace_replay_reason_stat_failed(std::strerror(errno));
+    close(fd);
+    return false;
+  }
+  const size_t file_bytes = static_cast<size_t>(file_stat.st_size);
+  if (file_bytes < Constants::TRACE_REPLAY_HEADER_BYTES) {
+    close(fd);
+    // Too short to map usefully; the decoder rejects it without reading.
+    return decode_trace_replay(nullptr, file_bytes, trace, error);
+  }
+  void* mapping = mmap(nullptr, file_bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    error = Messages::trace_replay_reason_map_failed(std::strerror(errno));
+    return false;
+  }
+  MmapPtr mapping_owner(mapping, MmapDeleter{file_bytes});
+  (void)madvise(mapping, file_bytes, MADV_SEQUENTIAL);
+  return decode_trace_replay(static_cast<const unsigned char*>(mapping), file_bytes, trace,
+                             error, true);
+}
+
+std::vector<TraceReplayOp> build_trace_replay_control(const std::vector<TraceReplayOp>& ops,
+                                                      uint64_t seed) {
+  std::vector<TraceReplayOp> control = ops;
+  std::mt19937_64 random(seed);
+  std::shuffle(control.begin(), control.end(), random);
+  return control;
+}
+
+void record_trace_replay_sample(const TraceReplayTrace& trace, double trace_wall_ns,
+                                double control_wall_ns, TraceReplayResult& result) {
+  const double passes = static_cast<double>(result.passes);
+  const double bytes = static_cast<double>(trace.total_bytes) * passes;
+  const double accesses = static_cast<double>(trace.record_count) * passes;
+  const auto record = [bytes, accesses](double wall_ns, TraceReplayOrderMeasurement& order) {
+    // Bytes per nanosecond is GB/s; accesses per nanosecond times 1000 is Mops/s.
+    order.gb_s_samples.push_back(wall_ns > 0.0 ? bytes / wall_ns : 0.0);
+    order.mops_samples.push_back(wall_ns > 0.0 ? accesses * 1e3 / wall_ns : 0.0);
+  };
+  record(trace_wall_ns, result.trace);
+  record(control_wall_ns, result.control);
+  result.order_speedup_samples.push_back(trace_wall_ns > 0.0 ? control_wall_ns / trace_wall_ns
+                                                             : 0.0);
+}
+
+void finalize_trace_replay_result(TraceReplayResult& result) {
+  finalize_order_measurement(result.trace);
+  finalize_order_measurement(result.control);
+  if (!result.order_speedup_samples.empty()) {
+    result.median_order_speedup =
+        calculate_descriptive_statistics(result.order_speedup_samples).median;
+  }
+}
+
+nlohmann::ordered_json build_trace_replay_json(const TraceReplayConfig& config,
+                                               const TraceReplayTrace& trace,
+                                               const TraceReplayResult& result,
+                                               const std::string& cpu_name,
+                                               double total_execution_time_sec) {
+  nlohmann::ordered_json result_json;
+  result_json["mode"] = Constants::TRACE_REPLAY_JSON_MODE_NAME;
+  result_json["schema_version"] = Constants::TRACE_REPLAY_JSON_SCHEMA_VERSION;
+  result_json["methodology_version"] = Constants::TRACE_REPLAY_METHODOLOGY_VERSION;
+  result_json["status"] = result.interrupted ? "interrupted" : "complete";
+  result_json["cpu_name"] = cpu_name;
+
+  nlohmann::ordered_json configuration;
+  configuration["trace_file"] = config.trace_file;
+  configuration["rounds"] = config.rounds;
+  configuration["sample_ms"] = config.sample_ms;
+  configuration["speed_of_light"] = config.speed_of_light;
+  configuration["passes_per_sample"] = result.passes;
+  configuration["page_bytes"] = Constants::TRACE_REPLAY_PAGE_BYTES;
+  configuration["control_seed"] = Constants::TRACE_REPLAY_CONTROL_SEED;
+  result_json["configuration"] = std::move(configuration);
+
+  nlohmann::ordered_json trace_json;
+  trace_json["records"] = trace.record_count;
+  trace_json["bytes"] = trace.total_bytes;
+  trace_json["address_span_bytes"] = trace.address_span_bytes;
+  trace_json["touched_pages"] = trace.touched_pages;
+  trace_json["buffer_bytes"] = trace.buffer_bytes;
+  nlohmann::ordered_json threads = nlohmann::ordered_json::array();
+  for (const TraceReplayThread& thread : trace.threads) {
+    nlohmann::ordered_json thread_json;
+    thread_json["thread_id"] = thread.thread_id;
+    thread_json["records"] = thread.ops.size();
+    thread_json["bytes"] = thread.bytes;
+    thread_json["writes"] = thread.writes;
+    thread_json["dependent_accesses"] = thread.dependent_accesses;
+    threads.push_back(std::move(thread_json));
+  }
+  trace_json["threads"] = std::move(threads);
+  result_json["trace"] = std::move(trace_json);
+
+  const auto order_json = [](const TraceReplayOrderMeasurement& order) {
+    const bool measured = !order.gb_s_samples.empty();
+    nlohmann::ordered_json json;
+    json["gb_s"] = measured ? nlohmann::ordered_json(order.median_gb_s) : nullptr;
+    json["gb_s_cv_pct"] = measured ? nlohmann::ordered_json(order.gb_s_cv_pct) : nullptr;
+    json["mops"] = measured ? nlohmann::ordered_json(order.median_mops) : nullptr;
+    json["samples_gb_s"] = order.gb_s_samples;
+    json["samples_mops"] = order.mops_samples;
+    return json;
+  };
+  nlohmann::ordered_json results;
+  results["trace_order"] = order_json(result.trace);
+  results["shuffled_control"] = order_json(result.control);
+  results["order_speedup"] = result.order_speedup_samples.empty()
+                                 ? nlohmann::ordered_json(nullptr)
+                                 : nlohmann::ordered_json(result.median_order_speedup);
+  results["samples_order_speedup"] = result.order_speedup_samples;
+  result_json["results"] = std::move(results);
+  result_json["total_execution_time_sec"] = total_execution_time_sec;
+  return result_json;
+}
@@ -0,0 +1,175 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file trace_replay.h
+ * @brief Standalone address-trace replay mode interfaces
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * `-Z, --trace-replay <file>` replays an address trace captured from an
+ * application against a buffer sized to the pages the trace touches. The
+ * file is little-endian binary:
+ *
+ *     header (32 bytes)  "MBTRACE1", u32 version (1), u32 flags (0),
+ *                        u64 record count, u64 reserved (0)
+ *     record (3+ bytes)  u8 control, ULEB128 thread id, zigzag LEB128 delta
+ *
+ * Control bit 0 marks a write, bit 1 a load whose address depends on the
+ * thread's previous load, and bits 2-4 hold log2 of the access size (1 to 64
+ * bytes); bits 5-7 are zero. The delta is the signed distance from the same
+ * thread's previous address, which starts at zero.
+ *
+ * Decoding streams through a read-only mapping of the file. Touched pages are
+ * packed densely in address order, so offsets within a page and the order of
+ * pages survive while unmapped gaps between heap, stack, and libraries
+ * disappear. Each traced thread becomes one worker that replays its records
+ * in order; a shuffled copy of every thread's records is the control that
+ * shows how much the trace's order is worth.
+ */
+#ifndef TRACE_REPLAY_H
+#define TRACE_REPLAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "core/config/constants.h"
+#include "third_party/nlohmann/json.hpp"
+
+/** @brief One trace record before encoding; used by converters and tests. */
+struct TraceReplayRecord {
+  uint32_t thread_id = 0;
+  uint64_t address = 0;
+  unsigned size_log2 = 3;  ///< Access of `1 << size_log2` bytes
+  bool write = false;
+  bool dependent = false;  ///< Address depends on the thread's previous load
+};
+
+/**
+ * @brief One decoded access as the replay loop sees it.
+ *
+ * `offset` is 8-byte aligned and naturally aligned for accesses of 8 bytes
+ * or more, so an access never leaves its page. Narrower accesses touch one
+ * 8-byte word.
+ */
+struct TraceReplayOp {
+  uint64_t offset = 0;  ///< Byte offset in the replay buffer
+  uint32_t words = 1;   ///< 8-byte words touched
+  uint8_t write = 0;
+  uint8_t dependent = 0;
+};
+
+struct TraceReplayThread {
+  uint32_t thread_id = 0;
+  std::vector<TraceReplayOp> ops;
+  uint64_t bytes = 0;  ///< Access sizes as traced, before widening
+  uint64_t writes = 0;
+  uint64_t dependent_accesses = 0;
+};
+
+struct TraceReplayTrace {
+  std::vector<TraceReplayThread> threads;  ///< Ascending thread id
+  uint64_t record_count = 0;
+  uint64_t total_bytes = 0;
+  uint64_t address_span_bytes = 0;  ///< Lowest to highest traced byte
+  size_t touched_pages = 0;
+  size_t buffer_bytes = 0;          ///< touched_pages * TRACE_REPLAY_PAGE_BYTES
+};
+
+struct TraceReplayOrderMeasurement {
+  std::vector<double> gb_s_samples;
+  std::vector<double> mops_samples;  ///< Million accesses per second over all workers
+  double median_gb_s = 0.0;
+  double gb_s_cv_pct = 0.0;
+  double median_mops = 0.0;
+};
+
+struct TraceReplayResult {
+  int passes = 0;  ///< Whole-trace replays per sample
+  TraceReplayOrderMeasurement trace;
+  TraceReplayOrderMeasurement control;
+  std::vector<double> order_speedup_samples;  ///< Control wall time over trace wall time
+  double median_order_speedup = 0.0;
+  bool interrupted = false;
+};
+
+struct TraceReplayConfig {
+  std::string trace_file;
+  int rounds = Constants::TRACE_REPLAY_DEFAULT_ROUNDS;
+  int sample_ms = Constants::TRACE_REPLAY_DEFAULT_SAMPLE_MS;
+  bool speed_of_light = false;  ///< Ignore dependency bits
+  std::string output_file;
+  bool help_requested = false;
+};
+
+/** @brief Encode records into the trace file format, header included. */
+std::vector<unsigned char> encode_trace_replay(const std::vector<TraceReplayRecord>& records);
+
+/**
+ * @brief Decode a whole trace and pack its pages into replay offsets.
+ * @param release_consumed Drop decoded windows of a file mapping as decoding moves on;
+ *                         only valid when `data` is the start of an mmap() of the file.
+ * @param[out] error Reason on failure, naming the record for malformed input.
+ * @return false for a bad header, malformed or truncated records, too many threads,
+ *         records, or touched pages, or an empty trace.
+ */
+bool decode_trace_replay(const unsigned char* data, size_t size, TraceReplayTrace& trace,
+                         std::string& error, bool release_consumed = false);
+
+/**
+ * @brief Map a trace file read-only, decode it sequentially, and unmap it.
+ * @param[out] error Reason on failure, without the path.
+ */
+bool load_trace_replay_file(const std::string& path, TraceReplayTrace& trace,
+                            std::string& error);
+
+/** @brief Seeded shuffle of one thread's ops: same accesses, no order. */
+std::vector<TraceReplayOp> build_trace_replay_control(const std::vector<TraceReplayOp>& ops,
+                                                      uint64_t seed);
+
+/** @brief Append one alternating trace/control sample pair. */
+void record_trace_replay_sample(const TraceReplayTrace& trace, double trace_wall_ns,
+                                double control_wall_ns, TraceReplayResult& result);
+
+/** @brief Medians and CVs of every recorded sample. */
+void finalize_trace_replay_result(TraceReplayResult& result);
+
+nlohmann::ordered_json build_trace_replay_json(const TraceReplayConfig& config,
+                                               const TraceReplayTrace& trace,
+                                               const TraceReplayResult& result,
+                                               const std::string& cpu_name,
+                                               double total_execution_time_sec);
+
+/**
+ * @brief Parse CLI args for standalone trace replay mode.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on parse/validation error.
+ */
+int parse_trace_replay_mode_arguments(int argc, char* argv[], TraceReplayConfig& config);
+
+/**
+ * @brief Load the trace, run trace and control replays, report, and save JSON.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on runtime/IO error.
+ */
+int run_trace_replay(const TraceReplayConfig& config);
+
+/**
+ * @brief Parse and run standalone trace replay mode from main().
+ */
+int run_trace_replay_mode(int argc, char* argv[]);
+
+#endif  // TRACE_REPLAY_H
@@ -0,0 +1,152 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file trace_replay_cli.cpp
+ * @brief CLI parsing for standalone trace replay mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Parses and validates mode-specific command line options for
+ * `-Z, --trace-replay <file>`. The trace itself is decoded by the runner,
+ * which owns the mapping and the buffers sized from it. Like the other
+ * standalone modes, only an explicit option set is accepted.
+ */
+
+#include "benchmark/trace_replay.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+
+#include "core/config/cli_options.h"
+#include "core/config/config.h"
+#include "core/config/constants.h"
+#include "core/signal/signal_handler.h"
+#include "output/console/messages/messages_api.h"
+#include "output/console/output_printer.h"
+
+namespace {
+
+constexpr const char* OPT_TRACE_REPLAY_SHORT = "-Z";
+constexpr const char* OPT_TRACE_REPLAY_LONG = "--trace-replay";
+constexpr const char* OPT_SPEED_OF_LIGHT_LONG = "--speed-of-light";
+constexpr const char* OPT_SAMPLE_MS_LONG = "--sample-ms";
+constexpr const char* OPT_COUNT_SHORT = "-r";
+constexpr const char* OPT_COUNT_LONG = "--count";
+constexpr const char* OPT_HELP_SHORT = "-h";
+constexpr const char* OPT_HELP_LONG = "--help";
+constexpr const char* OPT_OUTPUT_SHORT = "-o";
+constexpr const char* OPT_OUTPUT_LONG = "--output";
+
+}  // namespace
+
+int parse_trace_replay_mode_arguments(int argc, char* argv[], TraceReplayConfig& config) {
+  config.rounds = Constants::TRACE_REPLAY_DEFAULT_ROUNDS;
+  config.sample_ms = Constants::TRACE_REPLAY_DEFAULT_SAMPLE_MS;
+  config.speed_of_light = false;
+
+  bool trace_seen = false;
+  bool output_seen = false;
+  bool count_seen = false;
+  bool sample_ms_seen = false;
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+
+    if (is_option(arg, OPT_TRACE_REPLAY_SHORT, OPT_TRACE_REPLAY_LONG)) {
+      if (!take_option_value(argc, argv, i, trace_seen, OPT_TRACE_REPLAY_LONG)) {
+        return EXIT_FAILURE;
+      }
+      config.trace_file = argv[i];
+      continue;
+    }
+
+    if (is_option(arg, OPT_HELP_SHORT, OPT_HELP_LONG)) {
+      print_help(argv[0]);
+      config.help_requested = true;
+      return EXIT_SUCCESS;
+    }
+
+    if (is_option(arg, OPT_OUTPUT_SHORT, OPT_OUTPUT_LONG)) {
+      if (!take_option_value(argc, argv, i, output_seen, OPT_OUTPUT_LONG)) {
+        return EXIT_FAILURE;
+      }
+      config.output_file = argv[i];
+      continue;
+    }
+
+    if (is_option(arg, OPT_COUNT_SHORT, OPT_COUNT_LONG)) {
+      if (!take_option_value(argc, argv, i, count_seen, OPT_COUNT_LONG) ||
+          !parse_bounded_int_option(OPT_COUNT_LONG, argv[i], std::numeric_limits<int>::max(),
+                                    config.rounds, argv[0])) {
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (arg == OPT_SAMPLE_MS_LONG) {
+      if (!take_option_value(argc, argv, i, sample_ms_seen, OPT_SAMPLE_MS_LONG) ||
+          !parse_bounded_int_option(OPT_SAMPLE_MS_LONG, argv[i],
+                                    Constants::TRACE_REPLAY_MAX_SAMPLE_MS, config.sample_ms,
+                                    argv[0])) {
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (arg == OPT_SPEED_OF_LIGHT_LONG) {
+      if (config.speed_of_light) {
+        std::cerr << Messages::error_prefix()
+                  << Messages::error_duplicate_option(OPT_SPEED_OF_LIGHT_LONG)
+                  << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      config.speed_of_light = true;
+      continue;
+    }
+
+    std::cerr << Messages::error_prefix()
+              << Messages::error_trace_replay_must_be_used_alone()
+              << std::endl;
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  if (!trace_seen) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_trace_replay_must_be_used_alone()
+              << std::endl;
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+
+int run_trace_replay_mode(int argc, char* argv[]) {
+  TraceReplayConfig config;
+  if (parse_trace_replay_mode_arguments(argc, argv, config) != EXIT_SUCCESS) {
+    return EXIT_FAILURE;
+  }
+  if (config.help_requested) {
+    return EXIT_SUCCESS;
+  }
+
+  BenchmarkSignalMaskGuard signal_guard;
+  return run_trace_replay(config);
+}
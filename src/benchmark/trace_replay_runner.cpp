@@ -0,0 +1,226 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file trace_replay_runner.cpp
+ * @brief Trace and shuffled-control execution for trace replay mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * The whole trace is decoded and page-packed before the replay buffer is
+ * allocated. One worker per traced thread replays that thread's records;
+ * a sample ends when the slowest worker finishes its passes, so wall time
+ * covers the whole trace. Trace-order and shuffled-control samples
+ * alternate, with the first order swapped each round, so slow drift in
+ * frequency or background load hits both equally.
+ */
+
+#include "benchmark/trace_replay.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "benchmark/parallel_test_framework.h"
+#include "core/config/constants.h"
+#include "core/memory/memory_manager.h"
+#include "core/signal/signal_handler.h"
+#include "core/system/system_info.h"
+#include "core/timing/timer.h"
+#include "output/console/messages/messages_api.h"
+#include "output/console/output_printer.h"
+#include "output/json/json_output/json_output_api.h"
+#include "utils/seed_utils.h"
+
+namespace {
+
+// Each worker stores its checksum after every pass; padding keeps neighbours off its line.
+struct alignas(128) TraceReplayWorkerState {
+  uint64_t checksum = 0;
+};
+
+// The buffer only ever holds zeros, so `carry` is always zero: adding it to a
+// dependent record's offset makes the access wait for the previous load
+// without moving it.
+template <bool kHonorDependencies>
+uint64_t replay_trace_ops(char* base, const std::vector<TraceReplayOp>& ops) {
+  uint64_t carry = 0;
+  uint64_t checksum = 0;
+  for (const TraceReplayOp& op : ops) {
+    uint64_t offset = op.offset;
+    if (kHonorDependencies && op.dependent != 0) {
+      offset += carry;
+      // Keeps this a branch; a select would make every access wait for the previous load.
+      asm volatile("" : "+r"(offset));
+    }
+    uint64_t* words = reinterpret_cast<uint64_t*>(base + offset);
+    if (op.write != 0) {
+      for (uint32_t word = 0; word < op.words; ++word) {
+        words[word] = 0;
+      }
+    } else {
+      uint64_t value = 0;
+      for (uint32_t word = 0; word < op.words; ++word) {
+        value ^= words[word];
+      }
+      carry = value;
+      checksum += value;
+    }
+  }
+  return checksum + carry;
+}
+
+void print_trace_replay_report(const TraceReplayConfig& config, const TraceReplayResult& result) {
+  if (result.trace.gb_s_samples.empty()) {
+    return;
+  }
+  std::cout << std::endl << Messages::report_trace_replay_header() << std::endl;
+  std::cout << Messages::report_trace_replay_note(config.speed_of_light) << std::endl;
+  std::cout << Messages::report_trace_replay_table_header() << std::endl;
+  std::cout << Messages::report_trace_replay_row(Messages::report_trace_replay_trace_order_label(),
+                                                 result.trace.median_gb_s,
+                                                 result.trace.median_mops,
+                                                 result.trace.gb_s_cv_pct)
+            << std::endl;
+  std::cout << Messages::report_trace_replay_row(Messages::report_trace_replay_shuffled_label(),
+                                                 result.control.median_gb_s,
+                                                 result.control.median_mops,
+                                                 result.control.gb_s_cv_pct)
+            << std::endl;
+  std::cout << Messages::report_trace_replay_speedup(result.median_order_speedup) << std::endl;
+}
+
+int fail_trace_replay(const std::string& reason) {
+  std::cerr << Messages::error_prefix() << Messages::error_trace_replay_failed(reason)
+            << std::endl;
+  return EXIT_FAILURE;
+}
+
+}  // namespace
+
+int run_trace_replay(const TraceReplayConfig& config) {
+  print_runtime_banner();
+  TraceReplayTrace trace;
+  std::string error;
+  if (!load_trace_replay_file(config.trace_file, trace, error)) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_trace_replay_file(config.trace_file, error) << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << Messages::msg_running_trace_replay(config.trace_file, trace.record_count,
+                                                  trace.threads.size(), trace.buffer_bytes,
+                                                  trace.address_span_bytes,
+                                                  config.speed_of_light)
+            << std::endl;
+  const auto run_start = std::chrono::steady_clock::now();
+
+  MmapPtr buffer = allocate_buffer(trace.buffer_bytes, "trace replay buffer");
+  if (!buffer) {
+    return fail_trace_replay("buffer allocation");
+  }
+  // Zero fill faults every page in and is what keeps dependent offsets unchanged.
+  std::memset(buffer.get(), 0, trace.buffer_bytes);
+  char* base = static_cast<char*>(buffer.get());
+
+  std::vector<std::vector<TraceReplayOp>> controls;
+  for (size_t index = 0; index < trace.threads.size(); ++index) {
+    controls.push_back(build_trace_replay_control(
+        trace.threads[index].ops,
+        SeedUtils::splitmix64(Constants::TRACE_REPLAY_CONTROL_SEED + index)));
+  }
+
+  auto timer_optional = HighResTimer::create();
+  if (!timer_optional) {
+    std::cerr << Messages::error_prefix() << Messages::error_timer_creation_failed() << std::endl;
+    return EXIT_FAILURE;
+  }
+  HighResTimer& timer = *timer_optional;
+
+  std::vector<TraceReplayWorkerState> workers(trace.threads.size());
+  bool replay_control = false;  // Set between samples, before any worker starts
+  const bool speed_of_light = config.speed_of_light;
+  auto work = [&trace, &controls, &workers, &replay_control, base, speed_of_light](
+                  size_t worker_index, int passes) {
+    const std::vector<TraceReplayOp>& ops =
+        replay_control ? controls[worker_index] : trace.threads[worker_index].ops;
+    for (int pass = 0; pass < passes; ++pass) {
+      workers[worker_index].checksum ^= speed_of_light ? replay_trace_ops<false>(base, ops)
+                                                       : replay_trace_ops<true>(base, ops);
+    }
+  };
+  const auto run_sample = [&](bool control, int passes) {
+    replay_control = control;
+    return run_parallel_test_per_worker(workers.size(), passes, timer, work, "trace replay");
+  };
+
+  // One untimed pass of each order settles the TLB and caches and sizes the samples.
+  const double trace_seconds = run_sample(false, 1);
+  const double control_seconds = run_sample(true, 1);
+  if (trace_seconds <= 0.0 || control_seconds <= 0.0) {
+    return fail_trace_replay("worker startup");
+  }
+  const double pass_seconds = std::min(trace_seconds, control_seconds);
+  const double wanted_passes =
+      std::ceil(static_cast<double>(config.sample_ms) / 1e3 / pass_seconds);
+  TraceReplayResult result;
+  result.passes = static_cast<int>(
+      std::clamp(wanted_passes, 1.0, static_cast<double>(Constants::TRACE_REPLAY_MAX_PASSES)));
+  std::cout << Messages::msg_trace_replay_plan(result.passes, config.sample_ms) << std::endl;
+
+  for (int round = 0; round < config.rounds; ++round) {
+    const bool control_first = (round % 2) == 1;
+    const double first_seconds = run_sample(control_first, result.passes);
+    const double second_seconds = run_sample(!control_first, result.passes);
+    if (first_seconds <= 0.0 || second_seconds <= 0.0) {
+      return fail_trace_replay("worker startup");
+    }
+    const double trace_wall_ns = (control_first ? second_seconds : first_seconds) * 1e9;
+    const double control_wall_ns = (control_first ? first_seconds : second_seconds) * 1e9;
+    record_trace_replay_sample(trace, trace_wall_ns, control_wall_ns, result);
+    if (signal_received()) {
+      result.interrupted = true;
+      break;
+    }
+  }
+  if (result.interrupted) {
+    std::cout << std::endl << Messages::msg_interrupted_by_user() << std::endl;
+  }
+
+  finalize_trace_replay_result(result);
+  print_trace_replay_report(config, result);
+
+  if (!config.output_file.empty()) {
+    const double total_execution_time_sec =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - run_start).count();
+    std::filesystem::path output_path(config.output_file);
+    if (output_path.is_relative()) {
+      output_path = std::filesystem::current_path() / output_path;
+    }
+    if (write_json_to_file(output_path,
+                           build_trace_replay_json(config, trace, result, get_processor_name(),
+                                                   total_execution_time_sec)) != EXIT_SUCCESS) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,630 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file workload.cpp
+ * @brief Workload file parser, schedule compiler, and JSON for workload mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * The parser accepts one directive per line and reports the first error
+ * with its line number. Compilation fixes every stream's per-worker share
+ * and slice shape up front, so the timed loop only advances cursors.
+ * Execution lives in workload_runner.cpp.
+ */
+
+#include "benchmark/workload.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <numeric>
+#include <sstream>
+
+#include "core/config/config.h"
+#include "output/console/messages/messages_api.h"
+#include "utils/descriptive_statistics.h"
+
+namespace {
+
+bool valid_workload_name(const std::string& name) {
+  return !name.empty() && std::all_of(name.begin(), name.end(), [](char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) != 0 || c == '_' || c == '-';
+  });
+}
+
+// Byte count with an optional binary suffix: B, K/KB/KiB, M/MB/MiB, G/GB/GiB.
+bool parse_workload_size(const std::string& value, size_t& out_bytes) {
+  const size_t digits_end = value.find_first_not_of("0123456789");
+  const std::string digits = value.substr(0, digits_end);
+  std::string suffix = digits_end == std::string::npos ? "" : value.substr(digits_end);
+  std::transform(suffix.begin(), suffix.end(), suffix.begin(),
+                 [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+  uint64_t count = 0;
+  if (digits.empty() || parse_strict_unsigned_decimal(digits, count) !=
+                            StrictIntegerParseStatus::Success) {
+    return false;
+  }
+  uint64_t unit = 0;
+  if (suffix.empty() || suffix == "b") {
+    unit = 1;
+  } else if (suffix == "k" || suffix == "kb" || suffix == "kib") {
+    unit = Constants::BYTES_PER_KB;
+  } else if (suffix == "m" || suffix == "mb" || suffix == "mib") {
+    unit = Constants::BYTES_PER_MB;
+  } else if (suffix == "g" || suffix == "gb" || suffix == "gib") {
+    unit = Constants::BYTES_PER_MB * Constants::BYTES_PER_KB;
+  } else {
+    return false;
+  }
+  if (count == 0 || count > std::numeric_limits<size_t>::max() / unit) {
+    return false;
+  }
+  out_bytes = static_cast<size_t>(count * unit);
+  return true;
+}
+
+bool parse_workload_count(const std::string& value, uint64_t maximum, uint64_t& out_value) {
+  return parse_strict_unsigned_decimal(value, out_value) == StrictIntegerParseStatus::Success &&
+         out_value >= 1 && out_value <= maximum;
+}
+
+bool parse_workload_theta(const std::string& value, double& out_theta) {
+  if (value.empty() || std::isspace(static_cast<unsigned char>(value.front())) != 0) {
+    return false;
+  }
+  char* end = nullptr;
+  errno = 0;
+  const double parsed = std::strtod(value.c_str(), &end);
+  if (*end != '\0' || errno != 0 || !std::isfinite(parsed) || parsed <= 0.0 ||
+      parsed > Constants::PATTERN_ZIPF_MAX_THETA) {
+    return false;
+  }
+  out_theta = parsed;
+  return true;
+}
+
+bool parse_workload_operation(const std::string& value, WorkloadOperation& out_operation) {
+  for (WorkloadOperation operation : {WorkloadOperation::Read, WorkloadOperation::Write}) {
+    if (value == workload_operation_to_string(operation)) {
+      out_operation = operation;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool parse_workload_pattern(const std::string& value, WorkloadPattern& out_pattern) {
+  for (WorkloadPattern pattern :
+       {WorkloadPattern::Sequential, WorkloadPattern::Strided, WorkloadPattern::Random,
+        WorkloadPattern::Zipf, WorkloadPattern::Chase}) {
+    if (value == workload_pattern_to_string(pattern)) {
+      out_pattern = pattern;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool split_workload_setting(const std::string& token, std::string& key, std::string& value) {
+  const size_t equals = token.find('=');
+  if (equals == std::string::npos || equals == 0 || equals + 1 == token.size()) {
+    return false;
+  }
+  key = token.substr(0, equals);
+  value = token.substr(equals + 1);
+  return true;
+}
+
+bool parse_group_line(const std::vector<std::string>& tokens, WorkloadGroupSpec& group,
+                      std::string& reason) {
+  if (tokens.size() < 2 || !valid_workload_name(tokens[1])) {
+    reason = Messages::workload_reason_group_syntax();
+    return false;
+  }
+  group.name = tokens[1];
+  bool threads_seen = false;
+  for (size_t index = 2; index < tokens.size(); ++index) {
+    std::string key;
+    std::string value;
+    if (!split_workload_setting(tokens[index], key, value) || key != "threads" || threads_seen) {
+      reason = Messages::workload_reason_group_setting(tokens[index]);
+      return false;
+    }
+    uint64_t threads = 0;
+    if (!parse_workload_count(value, Constants::WORKLOAD_MAX_TOTAL_THREADS, threads)) {
+      reason = Messages::workload_reason_thread_range(Constants::WORKLOAD_MAX_TOTAL_THREADS);
+      return false;
+    }
+    group.threads = static_cast<int>(threads);
+    threads_seen = true;
+  }
+  return true;
+}
+
+bool parse_stream_line(const std::vector<std::string>& tokens, WorkloadStreamSpec& stream,
+                       std::string& reason) {
+  if (tokens.size() < 4 || !valid_workload_name(tokens[1])) {
+    reason = Messages::workload_reason_stream_syntax();
+    return false;
+  }
+  stream.name = tokens[1];
+  if (!parse_workload_operation(tokens[2], stream.operation)) {
+    reason = Messages::workload_reason_unknown_operation(tokens[2]);
+    return false;
+  }
+  if (!parse_workload_pattern(tokens[3], stream.pattern)) {
+    reason = Messages::workload_reason_unknown_pattern(tokens[3]);
+    return false;
+  }
+  if (stream.pattern == WorkloadPattern::Chase && stream.operation != WorkloadOperation::Read) {
+    reason = Messages::workload_reason_chase_write();
+    return false;
+  }
+
+  bool region_seen = false;
+  bool weight_seen = false;
+  bool stride_seen = false;
+  bool theta_seen = false;
+  for (size_t index = 4; index < tokens.size(); ++index) {
+    std::string key;
+    std::string value;
+    if (!split_workload_setting(tokens[index], key, value)) {
+      reason = Messages::workload_reason_expected_setting(tokens[index]);
+      return false;
+    }
+    if (key == "region" && !region_seen) {
+      if (!parse_workload_size(value, stream.region_bytes)) {
+        reason = Messages::workload_reason_region_size();
+        return false;
+      }
+      region_seen = true;
+    } else if (key == "weight" && !weight_seen) {
+      uint64_t weight = 0;
+      if (!parse_workload_count(value, Constants::WORKLOAD_MAX_WEIGHT, weight)) {
+        reason = Messages::workload_reason_weight_range(Constants::WORKLOAD_MAX_WEIGHT);
+        return false;
+      }
+      stream.weight = static_cast<unsigned>(weight);
+      weight_seen = true;
+    } else if (key == "stride" && !stride_seen && stream.pattern == WorkloadPattern::Strided) {
+      if (!parse_workload_size(value, stream.stride_bytes) ||
+          stream.stride_bytes < 2 * Constants::WORKLOAD_ACCESS_BYTES ||
+          stream.stride_bytes % Constants::WORKLOAD_ACCESS_BYTES != 0) {
+        reason = Messages::workload_reason_stride(Constants::WORKLOAD_ACCESS_BYTES);
+        return false;
+      }
+      stride_seen = true;
+    } else if (key == "theta" && !theta_seen && stream.pattern == WorkloadPattern::Zipf) {
+      if (!parse_workload_theta(value, stream.zipf_theta)) {
+        reason = Messages::workload_reason_theta_range(Constants::PATTERN_ZIPF_MAX_THETA);
+        return false;
+      }
+      theta_seen = true;
+    } else {
+      reason = Messages::workload_reason_unexpected_setting(
+          key, workload_pattern_to_string(stream.pattern));
+      return false;
+    }
+  }
+  if (!region_seen) {
+    reason = Messages::workload_reason_region_missing();
+    return false;
+  }
+  if (stream.pattern == WorkloadPattern::Strided && !stride_seen) {
+    reason = Messages::workload_reason_stride_missing();
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+const char* workload_operation_to_string(WorkloadOperation operation) {
+  switch (operation) {
+    case WorkloadOperation::Read:
+      return "read";
+    case WorkloadOperation::Write:
+      return "write";
+  }
+  return "unknown";
+}
+
+const char* workload_pattern_to_string(WorkloadPattern pattern) {
+  switch (pattern) {
+    case WorkloadPattern::Sequential:
+      return "sequential";
+    case WorkloadPattern::Strided:
+      return "strided";
+    case WorkloadPattern::Random:
+      return "random";
+    case WorkloadPattern::Zipf:
+      return "zipf";
+    case WorkloadPattern::Chase:
+      return "chase";
+  }
+  return "unknown";
+}
+
+bool parse_workload_spec(const std::string& text, WorkloadSpec& spec, std::string& error) {
+  spec = WorkloadSpec{};
+  std::istringstream input(text);
+  std::string raw_line;
+  size_t line_number = 0;
+  int total_threads = 0;
+  while (std::getline(input, raw_line)) {
+    ++line_number;
+    const std::string line = raw_line.substr(0, raw_line.find('#'));
+    std::istringstream words(line);
+    std::vector<std::string> tokens;
+    for (std::string token; words >> token;) {
+      tokens.push_back(token);
+    }
+    if (tokens.empty()) {
+      continue;
+    }
+
+    std::string reason;
+    if (tokens[0] == "group") {
+      WorkloadGroupSpec group;
+      group.line = line_number;
+      if (!parse_group_line(tokens, group, reason)) {
+        error = Messages::error_workload_line(line_number, reason);
+        return false;
+      }
+      for (const WorkloadGroupSpec& existing : spec.groups) {
+        if (existing.name == group.name) {
+          error = Messages::error_workload_line(
+              line_number, Messages::workload_reason_group_duplicate(group.name));
+          return false;
+        }
+      }
+      total_threads += group.threads;
+      if (total_threads > Constants::WORKLOAD_MAX_TOTAL_THREADS) {
+        error = Messages::error_workload_line(
+            line_number,
+            Messages::workload_reason_thread_total(Constants::WORKLOAD_MAX_TOTAL_THREADS));
+        return false;
+      }
+      spec.groups.push_back(std::move(group));
+    } else if (tokens[0] == "stream") {
+      if (spec.groups.empty()) {
+        error = Messages::error_workload_line(line_number,
+                                              Messages::workload_reason_stream_before_group());
+        return false;
+      }
+      WorkloadGroupSpec& group = spec.groups.back();
+      WorkloadStreamSpec stream;
+      stream.line = line_number;
+      if (!parse_stream_line(tokens, stream, reason)) {
+        error = Messages::error_workload_line(line_number, reason);
+        return false;
+      }
+      for (const WorkloadStreamSpec& existing : group.streams) {
+        if (existing.name == stream.name) {
+          error = Messages::error_workload_line(
+              line_number, Messages::workload_reason_stream_duplicate(stream.name, group.name));
+          return false;
+        }
+      }
+      if (group.streams.size() == Constants::WORKLOAD_MAX_STREAMS_PER_GROUP) {
+        error = Messages::error_workload_line(
+            line_number,
+            Messages::workload_reason_stream_limit(Constants::WORKLOAD_MAX_STREAMS_PER_GROUP));
+        return false;
+      }
+      group.streams.push_back(std::move(stream));
+    } else {
+      error = Messages::error_workload_line(
+          line_number, Messages::workload_reason_unknown_directive(tokens[0]));
+      return false;
+    }
+  }
+
+  if (spec.groups.empty()) {
+    error = Messages::error_workload_no_group();
+    return false;
+  }
+  for (const WorkloadGroupSpec& group : spec.groups) {
+    if (group.streams.empty()) {
+      error = Messages::error_workload_line(
+          group.line, Messages::workload_reason_group_without_stream(group.name));
+      return false;
+    }
+  }
+  return true;
+}
+
+std::vector<size_t> build_workload_weighted_cycle(const std::vector<unsigned>& weights) {
+  unsigned divisor = 0;
+  for (unsigned weight : weights) {
+    divisor = std::gcd(divisor, weight);
+  }
+  if (divisor == 0) {
+    return {};
+  }
+  std::vector<long long> reduced;
+  long long total = 0;
+  for (unsigned weight : weights) {
+    reduced.push_back(weight / divisor);
+    total += weight / divisor;
+  }
+
+  std::vector<long long> credit(weights.size(), 0);
+  std::vector<size_t> cycle;
+  cycle.reserve(static_cast<size_t>(total));
+  for (long long position = 0; position < total; ++position) {
+    size_t selected = 0;
+    for (size_t index = 0; index < credit.size(); ++index) {
+      credit[index] += reduced[index];
+      if (credit[index] > credit[selected]) {
+        selected = index;
+      }
+    }
+    credit[selected] -= total;
+    cycle.push_back(selected);
+  }
+  return cycle;
+}
+
+bool compile_workload_plan(const WorkloadSpec& spec, WorkloadPlan& plan, std::string& error) {
+  plan = WorkloadPlan{};
+  for (size_t group_index = 0; group_index < spec.groups.size(); ++group_index) {
+    const WorkloadGroupSpec& group = spec.groups[group_index];
+    const size_t threads = static_cast<size_t>(group.threads);
+    const size_t first_stream = plan.streams.size();
+    std::vector<unsigned> weights;
+    unsigned weight_total = 0;
+    for (const WorkloadStreamSpec& stream : group.streams) {
+      weights.push_back(stream.weight);
+      weight_total += stream.weight;
+    }
+
+    for (const WorkloadStreamSpec& stream : group.streams) {
+      WorkloadStreamPlan stream_plan;
+      stream_plan.group_index = group_index;
+      stream_plan.spec = stream;
+      stream_plan.weight_share =
+          static_cast<double>(stream.weight) / static_cast<double>(weight_total);
+      stream_plan.access_bytes = stream.pattern == WorkloadPattern::Chase
+                                     ? sizeof(uintptr_t)
+                                     : Constants::WORKLOAD_ACCESS_BYTES;
+      stream_plan.slice_accesses = Constants::WORKLOAD_SLICE_BYTES / stream_plan.access_bytes;
+
+      // Partitioned streams round each worker's share down to whole wrap units.
+      size_t unit = 0;
+      switch (stream.pattern) {
+        case WorkloadPattern::Sequential:
+          stream_plan.slice_span_bytes = Constants::WORKLOAD_SLICE_BYTES;
+          unit = stream_plan.slice_span_bytes;
+          break;
+        case WorkloadPattern::Strided:
+          if (stream.stride_bytes > std::numeric_limits<size_t>::max() /
+                                        stream_plan.slice_accesses) {
+            error = Messages::error_workload_stream_too_small(
+                group.name, stream.name, stream.line, Messages::workload_reason_stride_overflow());
+            return false;
+          }
+          stream_plan.slice_span_bytes = stream_plan.slice_accesses * stream.stride_bytes;
+          unit = stream_plan.slice_span_bytes;
+          break;
+        case WorkloadPattern::Chase:
+          unit = Constants::WORKLOAD_CHASE_STRIDE_BYTES;
+          break;
+        case WorkloadPattern::Random:
+        case WorkloadPattern::Zipf:
+          break;
+      }
+      if (unit == 0) {
+        stream_plan.partition_bytes = stream.region_bytes;
+        if (stream.region_bytes < Constants::WORKLOAD_ACCESS_BYTES) {
+          error = Messages::error_workload_stream_too_small(
+              group.name, stream.name, stream.line,
+              Messages::workload_reason_region_below_access(Constants::WORKLOAD_ACCESS_BYTES));
+          return false;
+        }
+      } else {
+        stream_plan.partition_bytes = stream.region_bytes / threads / unit * unit;
+        const size_t minimum = stream.pattern == WorkloadPattern::Chase ? 2 * unit : unit;
+        if (stream_plan.partition_bytes < minimum) {
+          error = Messages::error_workload_stream_too_small(
+              group.name, stream.name, stream.line,
+              Messages::workload_reason_partition_too_small(threads, minimum));
+          return false;
+        }
+      }
+      plan.total_region_bytes += stream.region_bytes;
+      plan.streams.push_back(std::move(stream_plan));
+    }
+
+    const std::vector<size_t> cycle = build_workload_weighted_cycle(weights);
+    for (size_t worker = 0; worker < threads; ++worker) {
+      // Rotating the start keeps a group's workers out of lockstep on one stream.
+      WorkloadWorkerPlan worker_plan;
+      worker_plan.group_index = group_index;
+      worker_plan.group_worker = worker;
+      const size_t rotation = worker * cycle.size() / threads;
+      for (size_t position = 0; position < cycle.size(); ++position) {
+        worker_plan.schedule.push_back(first_stream +
+                                       cycle[(position + rotation) % cycle.size()]);
+      }
+      plan.workers.push_back(std::move(worker_plan));
+    }
+  }
+  return true;
+}
+
+void record_workload_sample(const WorkloadPlan& plan,
+                            const std::vector<WorkloadStreamTotals>& totals, double wall_ns,
+                            WorkloadResult& result) {
+  result.streams.resize(plan.streams.size());
+  std::vector<uint64_t> group_bytes;
+  uint64_t total_bytes = 0;
+  uint64_t chase_accesses = 0;
+  double chase_busy_ns = 0.0;
+  bool has_chase = false;
+  for (size_t index = 0; index < plan.streams.size(); ++index) {
+    const size_t group = plan.streams[index].group_index;
+    if (group_bytes.size() <= group) {
+      group_bytes.resize(group + 1, 0);
+    }
+    group_bytes[group] += totals[index].bytes;
+    total_bytes += totals[index].bytes;
+    if (plan.streams[index].spec.pattern == WorkloadPattern::Chase) {
+      has_chase = true;
+      chase_accesses += totals[index].accesses;
+      chase_busy_ns += totals[index].busy_ns;
+    }
+  }
+
+  for (size_t index = 0; index < plan.streams.size(); ++index) {
+    const WorkloadStreamTotals& stream = totals[index];
+    const uint64_t group_total = group_bytes[plan.streams[index].group_index];
+    WorkloadStreamMeasurement& measurement = result.streams[index];
+    // Bytes per nanosecond is GB/s.
+    measurement.gb_s_samples.push_back(
+        wall_ns > 0.0 ? static_cast<double>(stream.bytes) / wall_ns : 0.0);
+    measurement.ns_per_access_samples.push_back(
+        stream.accesses > 0 ? stream.busy_ns / static_cast<double>(stream.accesses) : 0.0);
+    measurement.byte_share_samples.push_back(
+        group_total > 0 ? static_cast<double>(stream.bytes) / static_cast<double>(group_total)
+                        : 0.0);
+  }
+  result.aggregate_gb_s_samples.push_back(
+      wall_ns > 0.0 ? static_cast<double>(total_bytes) / wall_ns : 0.0);
+  if (has_chase) {
+    result.chase_ns_samples.push_back(
+        chase_accesses > 0 ? chase_busy_ns / static_cast<double>(chase_accesses) : 0.0);
+  }
+}
+
+void finalize_workload_result(WorkloadResult& result) {
+  for (WorkloadStreamMeasurement& measurement : result.streams) {
+    if (measurement.gb_s_samples.empty()) {
+      continue;
+    }
+    const DescriptiveStatistics bandwidth =
+        calculate_descriptive_statistics(measurement.gb_s_samples);
+    measurement.median_gb_s = bandwidth.median;
+    measurement.gb_s_cv_pct = bandwidth.coefficient_of_variation_pct;
+    measurement.median_ns_per_access =
+        calculate_descriptive_statistics(measurement.ns_per_access_samples).median;
+    measurement.median_byte_share =
+        calculate_descriptive_statistics(measurement.byte_share_samples).median;
+  }
+  if (!result.aggregate_gb_s_samples.empty()) {
+    const DescriptiveStatistics aggregate =
+        calculate_descriptive_statistics(result.aggregate_gb_s_samples);
+    result.median_aggregate_gb_s = aggregate.median;
+    result.aggregate_cv_pct = aggregate.coefficient_of_variation_pct;
+  }
+  if (!result.chase_ns_samples.empty()) {
+    result.median_chase_ns = calculate_descriptive_statistics(result.chase_ns_samples).median;
+  }
+}
+
+nlohmann::ordered_json build_workload_json(const WorkloadConfig& config, const WorkloadPlan& plan,
+                                           const WorkloadResult& result,
+                                           const std::string& cpu_name,
+                                           double total_execution_time_sec) {
+  nlohmann::ordered_json result_json;
+  result_json["mode"] = Constants::WORKLOAD_JSON_MODE_NAME;
+  result_json["schema_version"] = Constants::WORKLOAD_JSON_SCHEMA_VERSION;
+  result_json["methodology_version"] = Constants::WORKLOAD_METHODOLOGY_VERSION;
+  result_json["status"] = result.interrupted ? "interrupted" : "complete";
+  result_json["cpu_name"] = cpu_name;
+
+  nlohmann::ordered_json configuration;
+  configuration["workload_file"] = config.workload_file;
+  configuration["rounds"] = config.rounds;
+  configuration["sample_ms"] = config.sample_ms;
+  configuration["slice_bytes"] = Constants::WORKLOAD_SLICE_BYTES;
+  configuration["chase_stride_bytes"] = Constants::WORKLOAD_CHASE_STRIDE_BYTES;
+  configuration["index_stream_accesses"] = Constants::WORKLOAD_INDEX_STREAM_ACCESSES;
+  configuration["total_threads"] = plan.workers.size();
+  configuration["total_region_bytes"] = plan.total_region_bytes;
+  configuration["base_seed_uint64_decimal"] = std::to_string(config.seed);
+  configuration["seed_source"] = config.user_specified_seed ? "user" : "generated";
+  result_json["configuration"] = std::move(configuration);
+
+  const auto median_or_null = [](const std::vector<double>& samples, double median) {
+    return samples.empty() ? nlohmann::ordered_json(nullptr) : nlohmann::ordered_json(median);
+  };
+
+  nlohmann::ordered_json groups = nlohmann::ordered_json::array();
+  for (size_t group_index = 0; group_index < config.spec.groups.size(); ++group_index) {
+    const WorkloadGroupSpec& group = config.spec.groups[group_index];
+    nlohmann::ordered_json group_json;
+    group_json["name"] = group.name;
+    group_json["threads"] = group.threads;
+    nlohmann::ordered_json streams = nlohmann::ordered_json::array();
+    for (size_t index = 0; index < plan.streams.size(); ++index) {
+      const WorkloadStreamPlan& stream_plan = plan.streams[index];
+      if (stream_plan.group_index != group_index) {
+        continue;
+      }
+      const WorkloadStreamSpec& stream = stream_plan.spec;
+      const bool shared = stream.pattern == WorkloadPattern::Random ||
+                          stream.pattern == WorkloadPattern::Zipf;
+      nlohmann::ordered_json stream_json;
+      stream_json["name"] = stream.name;
+      stream_json["operation"] = workload_operation_to_string(stream.operation);
+      stream_json["pattern"] = workload_pattern_to_string(stream.pattern);
+      stream_json["region_bytes"] = stream.region_bytes;
+      stream_json["region_sharing"] = shared ? "shared" : "partitioned";
+      stream_json["worker_region_bytes"] = stream_plan.partition_bytes;
+      if (stream.pattern == WorkloadPattern::Strided) {
+        stream_json["stride_bytes"] = stream.stride_bytes;
+      }
+      if (stream.pattern == WorkloadPattern::Zipf) {
+        stream_json["zipf_theta"] = stream.zipf_theta;
+      }
+      stream_json["access_bytes"] = stream_plan.access_bytes;
+      stream_json["weight"] = stream.weight;
+      stream_json["requested_byte_share"] = stream_plan.weight_share;
+
+      const WorkloadStreamMeasurement empty;
+      const WorkloadStreamMeasurement& measurement =
+          index < result.streams.size() ? result.streams[index] : empty;
+      stream_json["achieved_byte_share"] =
+          median_or_null(measurement.byte_share_samples, measurement.median_byte_share);
+      stream_json["gb_s"] = median_or_null(measurement.gb_s_samples, measurement.median_gb_s);
+      stream_json["gb_s_cv_pct"] =
+          median_or_null(measurement.gb_s_samples, measurement.gb_s_cv_pct);
+      stream_json["ns_per_access"] =
+          median_or_null(measurement.ns_per_access_samples, measurement.median_ns_per_access);
+      stream_json["samples_gb_s"] = measurement.gb_s_samples;
+      stream_json["samples_ns_per_access"] = measurement.ns_per_access_samples;
+      streams.push_back(std::move(stream_json));
+    }
+    group_json["streams"] = std::move(streams);
+    groups.push_back(std::move(group_json));
+  }
+  result_json["groups"] = std::move(groups);
+
+  nlohmann::ordered_json aggregate;
+  aggregate["gb_s"] = median_or_null(result.aggregate_gb_s_samples, result.median_aggregate_gb_s);
+  aggregate["gb_s_cv_pct"] =
+      median_or_null(result.aggregate_gb_s_samples, result.aggregate_cv_pct);
+  aggregate["chase_ns_per_load"] = median_or_null(result.chase_ns_samples, result.median_chase_ns);
+  aggregate["samples_gb_s"] = result.aggregate_gb_s_samples;
+  result_json["aggregate"] = std::move(aggregate);
+  result_json["total_execution_time_sec"] = total_execution_time_sec;
+  return result_json;
+}
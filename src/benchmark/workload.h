@@ -0,0 +1,210 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file workload.h
+ * @brief Standalone synthetic workload mode interfaces
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * `-Y, --workload <file>` runs a mix of access streams described in a small
+ * line-oriented file. Each `group` line starts a thread group and each
+ * following `stream` line adds one weighted stream to it:
+ *
+ *     group service threads=4
+ *     stream scan  read  sequential region=1GiB   weight=70
+ *     stream cache write zipf       region=256MiB weight=30 theta=0.99
+ *     group walker threads=1
+ *     stream chain read  chase      region=64MiB
+ *
+ * The file compiles to one schedule per worker: a cycle of fixed-payload
+ * slices whose mix matches the group's weights, run over the existing
+ * sequential, strided, and random kernels and the pointer-chase kernel.
+ * Workers run their schedules concurrently for a bounded busy time, and the
+ * report gives each stream's throughput and time per access plus the
+ * aggregate bandwidth and pointer-chase latency of the mix.
+ */
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "core/config/constants.h"
+#include "third_party/nlohmann/json.hpp"
+
+enum class WorkloadOperation {
+  Read,
+  Write,
+};
+
+enum class WorkloadPattern {
+  Sequential,  ///< Contiguous slices through the worker's share of the region
+  Strided,     ///< One 32-byte access per stride through the worker's share
+  Random,      ///< Uniform 32-byte accesses anywhere in the region
+  Zipf,        ///< Zipf-skewed 32-byte accesses anywhere in the region
+  Chase,       ///< Dependent loads along a seeded pointer chain in the worker's share
+};
+
+struct WorkloadStreamSpec {
+  std::string name;
+  WorkloadOperation operation = WorkloadOperation::Read;
+  WorkloadPattern pattern = WorkloadPattern::Sequential;
+  size_t region_bytes = 0;
+  unsigned weight = 1;
+  size_t stride_bytes = 0;  ///< Strided streams only
+  double zipf_theta = Constants::PATTERN_ZIPF_DEFAULT_THETA;  ///< Zipf streams only
+  size_t line = 0;          ///< Source line, for compile errors
+};
+
+struct WorkloadGroupSpec {
+  std::string name;
+  int threads = 1;
+  std::vector<WorkloadStreamSpec> streams;
+  size_t line = 0;
+};
+
+struct WorkloadSpec {
+  std::vector<WorkloadGroupSpec> groups;
+};
+
+/**
+ * @brief One stream of the compiled workload, shared by its group's workers.
+ *
+ * Sequential, strided, and chase streams split the region into one
+ * `partition_bytes` share per worker; random and Zipf streams draw from the
+ * whole region in every worker. A slice moves `slice_accesses *
+ * access_bytes` bytes; sequential and strided slices advance
+ * `slice_span_bytes` through the share and wrap at its end.
+ */
+struct WorkloadStreamPlan {
+  size_t group_index = 0;
+  WorkloadStreamSpec spec;
+  size_t partition_bytes = 0;
+  size_t slice_span_bytes = 0;
+  size_t slice_accesses = 0;
+  size_t access_bytes = 0;
+  double weight_share = 0.0;  ///< Requested share of the group's bytes
+};
+
+struct WorkloadWorkerPlan {
+  size_t group_index = 0;
+  size_t group_worker = 0;      ///< Position within the group; selects the partition
+  std::vector<size_t> schedule;  ///< Stream indices of one weighted cycle, rotated per worker
+};
+
+struct WorkloadPlan {
+  std::vector<WorkloadStreamPlan> streams;
+  std::vector<WorkloadWorkerPlan> workers;
+  size_t total_region_bytes = 0;
+};
+
+/** @brief Bytes, accesses, and busy time of one stream summed over its workers for one sample. */
+struct WorkloadStreamTotals {
+  uint64_t bytes = 0;
+  uint64_t accesses = 0;
+  double busy_ns = 0.0;
+};
+
+struct WorkloadStreamMeasurement {
+  std::vector<double> gb_s_samples;           ///< Stream bytes over the sample's wall time
+  std::vector<double> ns_per_access_samples;  ///< Busy time per access on one worker
+  std::vector<double> byte_share_samples;     ///< Achieved share of the group's bytes
+  double median_gb_s = 0.0;
+  double gb_s_cv_pct = 0.0;
+  double median_ns_per_access = 0.0;
+  double median_byte_share = 0.0;
+};
+
+struct WorkloadResult {
+  std::vector<WorkloadStreamMeasurement> streams;
+  std::vector<double> aggregate_gb_s_samples;
+  std::vector<double> chase_ns_samples;  ///< Per-load latency over every chase stream; empty without one
+  double median_aggregate_gb_s = 0.0;
+  double aggregate_cv_pct = 0.0;
+  double median_chase_ns = 0.0;
+  bool interrupted = false;
+};
+
+struct WorkloadConfig {
+  std::string workload_file;
+  WorkloadSpec spec;
+  int rounds = Constants::WORKLOAD_DEFAULT_ROUNDS;
+  int sample_ms = Constants::WORKLOAD_DEFAULT_SAMPLE_MS;
+  uint64_t seed = 0;
+  bool user_specified_seed = false;
+  std::string output_file;
+  bool help_requested = false;
+};
+
+const char* workload_operation_to_string(WorkloadOperation operation);
+const char* workload_pattern_to_string(WorkloadPattern pattern);
+
+/**
+ * @brief Parse workload file text.
+ * @param[out] error Reason on failure, line-numbered except for an empty workload.
+ * @return false for syntax errors, unknown keys, out-of-range values, or an empty workload.
+ */
+bool parse_workload_spec(const std::string& text, WorkloadSpec& spec, std::string& error);
+
+/**
+ * @brief Interleave stream indices so each appears `weights[i] / gcd` times per cycle.
+ *
+ * Smooth weighted round-robin: every position goes to the stream furthest
+ * behind its share, so heavy streams are spread through the cycle instead of
+ * running back to back.
+ */
+std::vector<size_t> build_workload_weighted_cycle(const std::vector<unsigned>& weights);
+
+/**
+ * @brief Compile a parsed workload into stream partitions and per-worker schedules.
+ * @param[out] error Reason naming the stream when a region cannot hold its workers' slices.
+ */
+bool compile_workload_plan(const WorkloadSpec& spec, WorkloadPlan& plan, std::string& error);
+
+/** @brief Append one sample's per-stream and aggregate metrics. */
+void record_workload_sample(const WorkloadPlan& plan,
+                            const std::vector<WorkloadStreamTotals>& totals, double wall_ns,
+                            WorkloadResult& result);
+
+/** @brief Medians and CVs of every recorded sample. */
+void finalize_workload_result(WorkloadResult& result);
+
+nlohmann::ordered_json build_workload_json(const WorkloadConfig& config, const WorkloadPlan& plan,
+                                           const WorkloadResult& result,
+                                           const std::string& cpu_name,
+                                           double total_execution_time_sec);
+
+/**
+ * @brief Parse CLI args for standalone workload mode and load the workload file.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on parse/validation error.
+ */
+int parse_workload_mode_arguments(int argc, char* argv[], WorkloadConfig& config);
+
+/**
+ * @brief Compile the workload, run every sample, report, and save JSON.
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE on runtime/IO error.
+ */
+int run_workload(const WorkloadConfig& config);
+
+/**
+ * @brief Parse and run standalone workload mode from main().
+ */
+int run_workload_mode(int argc, char* argv[]);
+
+#endif  // WORKLOAD_H
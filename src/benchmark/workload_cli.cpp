@@ -0,0 +1,197 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file workload_cli.cpp
+ * @brief CLI parsing for standalone workload mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Parses and validates mode-specific command line options for
+ * `-Y, --workload <file>`, then reads and parses the workload file so that
+ * syntax errors are reported before any buffer is allocated. Like the
+ * other standalone modes, only an explicit option set is accepted.
+ */
+
+#include "benchmark/workload.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+
+#include "core/config/cli_options.h"
+#include "core/config/config.h"
+#include "core/config/constants.h"
+#include "core/signal/signal_handler.h"
+#include "output/console/messages/messages_api.h"
+#include "output/console/output_printer.h"
+#include "utils/seed_utils.h"
+
+namespace {
+
+constexpr const char* OPT_WORKLOAD_SHORT = "-Y";
+constexpr const char* OPT_WORKLOAD_LONG = "--workload";
+constexpr const char* OPT_SAMPLE_MS_LONG = "--sample-ms";
+constexpr const char* OPT_SEED_LONG = "--seed";
+constexpr const char* OPT_COUNT_SHORT = "-r";
+constexpr const char* OPT_COUNT_LONG = "--count";
+constexpr const char* OPT_HELP_SHORT = "-h";
+constexpr const char* OPT_HELP_LONG = "--help";
+constexpr const char* OPT_OUTPUT_SHORT = "-o";
+constexpr const char* OPT_OUTPUT_LONG = "--output";
+
+bool load_workload_file(const std::string& path, WorkloadSpec& spec) {
+  std::ifstream input(path, std::ios::binary);
+  if (!input) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_workload_file(path, Messages::workload_reason_file_unreadable()) << std::endl;
+    return false;
+  }
+  // Reading one byte past the limit tells an oversized file from one that fits exactly.
+  std::string text(Constants::WORKLOAD_MAX_FILE_BYTES + 1, '\0');
+  input.read(text.data(), static_cast<std::streamsize>(text.size()));
+  text.resize(static_cast<size_t>(input.gcount()));
+  if (text.size() > Constants::WORKLOAD_MAX_FILE_BYTES) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_workload_file(
+                     path, Messages::workload_reason_file_too_large(
+                               Constants::WORKLOAD_MAX_FILE_BYTES))
+              << std::endl;
+    return false;
+  }
+  std::string error;
+  if (!parse_workload_spec(text, spec, error)) {
+    std::cerr << Messages::error_prefix() << Messages::error_workload_file(path, error)
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+int parse_workload_mode_arguments(int argc, char* argv[], WorkloadConfig& config) {
+  config.rounds = Constants::WORKLOAD_DEFAULT_ROUNDS;
+  config.sample_ms = Constants::WORKLOAD_DEFAULT_SAMPLE_MS;
+  config.user_specified_seed = false;
+
+  bool workload_seen = false;
+  bool output_seen = false;
+  bool count_seen = false;
+  bool sample_ms_seen = false;
+  bool seed_seen = false;
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+
+    if (is_option(arg, OPT_WORKLOAD_SHORT, OPT_WORKLOAD_LONG)) {
+      if (!take_option_value(argc, argv, i, workload_seen, OPT_WORKLOAD_LONG)) {
+        return EXIT_FAILURE;
+      }
+      config.workload_file = argv[i];
+      continue;
+    }
+
+    if (is_option(arg, OPT_HELP_SHORT, OPT_HELP_LONG)) {
+      print_help(argv[0]);
+      config.help_requested = true;
+      return EXIT_SUCCESS;
+    }
+
+    if (is_option(arg, OPT_OUTPUT_SHORT, OPT_OUTPUT_LONG)) {
+      if (!take_option_value(argc, argv, i, output_seen, OPT_OUTPUT_LONG)) {
+        return EXIT_FAILURE;
+      }
+      config.output_file = argv[i];
+      continue;
+    }
+
+    if (is_option(arg, OPT_COUNT_SHORT, OPT_COUNT_LONG)) {
+      if (!take_option_value(argc, argv, i, count_seen, OPT_COUNT_LONG) ||
+          !parse_bounded_int_option(OPT_COUNT_LONG, argv[i], std::numeric_limits<int>::max(),
+                                    config.rounds, argv[0])) {
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (arg == OPT_SAMPLE_MS_LONG) {
+      if (!take_option_value(argc, argv, i, sample_ms_seen, OPT_SAMPLE_MS_LONG) ||
+          !parse_bounded_int_option(OPT_SAMPLE_MS_LONG, argv[i],
+                                    Constants::WORKLOAD_MAX_SAMPLE_MS, config.sample_ms,
+                                    argv[0])) {
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (arg == OPT_SEED_LONG) {
+      if (!take_option_value(argc, argv, i, seed_seen, OPT_SEED_LONG)) {
+        return EXIT_FAILURE;
+      }
+      const StrictIntegerParseStatus status =
+          parse_strict_unsigned_decimal(argv[i], config.seed);
+      if (status != StrictIntegerParseStatus::Success) {
+        std::cerr << Messages::error_prefix()
+                  << Messages::error_invalid_value(OPT_SEED_LONG, argv[i],
+                                                   strict_unsigned_decimal_error_reason(status))
+                  << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      config.user_specified_seed = true;
+      continue;
+    }
+
+    std::cerr << Messages::error_prefix()
+              << Messages::error_workload_must_be_used_alone()
+              << std::endl;
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  if (!workload_seen) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_workload_must_be_used_alone()
+              << std::endl;
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  if (!load_workload_file(config.workload_file, config.spec)) {
+    return EXIT_FAILURE;
+  }
+
+  if (!config.user_specified_seed) {
+    config.seed = SeedUtils::generate_seed();
+  }
+  return EXIT_SUCCESS;
+}
+
+int run_workload_mode(int argc, char* argv[]) {
+  WorkloadConfig config;
+  if (parse_workload_mode_arguments(argc, argv, config) != EXIT_SUCCESS) {
+    return EXIT_FAILURE;
+  }
+  if (config.help_requested) {
+    return EXIT_SUCCESS;
+  }
+
+  BenchmarkSignalMaskGuard signal_guard;
+  return run_workload(config);
+}
@@ -0,0 +1,348 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file workload_runner.cpp
+ * @brief Concurrent schedule execution for workload mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ *
+ * Every stream gets its own buffer; chase shares are linked by the seeded
+ * latency-chain builder and random shares get a fixed per-worker index
+ * stream, all before timing. Each worker times its own slices and stops once
+ * its busy time reaches the sample length, so all groups run concurrently
+ * for the whole sample regardless of how fast their streams are. Cursors,
+ * phases, and chain positions carry over between samples.
+ */
+
+#include "benchmark/workload.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "asm/asm_functions.h"
+#include "benchmark/memory_kernels.h"
+#include "benchmark/parallel_test_framework.h"
+#include "core/config/constants.h"
+#include "core/memory/memory_manager.h"
+#include "core/memory/memory_utils.h"
+#include "core/signal/signal_handler.h"
+#include "core/system/system_info.h"
+#include "core/timing/timer.h"
+#include "output/console/messages/messages_api.h"
+#include "output/console/output_printer.h"
+#include "output/json/json_output/json_output_api.h"
+#include "pattern_benchmark/pattern_work_plan.h"
+#include "utils/seed_utils.h"
+
+namespace {
+
+// One worker's view of one stream.
+struct WorkloadStreamState {
+  char* base = nullptr;  ///< Worker share (partitioned) or region start (shared)
+  size_t cursor = 0;     ///< Byte offset in the share, or position in `indices`
+  size_t phase = 0;      ///< Strided 32-byte phase, advanced on every wrap
+  std::vector<size_t> indices;
+  uintptr_t* chase = nullptr;
+  WorkloadStreamTotals totals;
+};
+
+// Each worker updates its own state every slice; padding keeps neighbours off its line.
+struct alignas(128) WorkloadWorkerState {
+  std::vector<WorkloadStreamState> streams;  ///< Indexed like WorkloadPlan::streams
+  size_t position = 0;                       ///< Next schedule entry
+  uint64_t checksum = 0;
+};
+
+void run_workload_slice(const WorkloadStreamPlan& stream, WorkloadStreamState& state,
+                        const MemoryKernelSet& kernels, uint64_t& checksum) {
+  const bool read = stream.spec.operation == WorkloadOperation::Read;
+  switch (stream.spec.pattern) {
+    case WorkloadPattern::Sequential:
+    case WorkloadPattern::Strided: {
+      char* slice = state.base + state.cursor;
+      if (stream.spec.pattern == WorkloadPattern::Sequential) {
+        if (read) {
+          checksum ^= kernels.read(slice, stream.slice_span_bytes);
+        } else {
+          kernels.write(slice, stream.slice_span_bytes);
+        }
+      } else if (read) {
+        checksum ^= kernels.read_strided(slice, stream.slice_span_bytes, stream.spec.stride_bytes,
+                                         1, state.phase);
+      } else {
+        kernels.write_strided(slice, stream.slice_span_bytes, stream.spec.stride_bytes, 1,
+                              state.phase);
+      }
+      state.cursor += stream.slice_span_bytes;
+      if (state.cursor == stream.partition_bytes) {
+        state.cursor = 0;
+        if (stream.spec.pattern == WorkloadPattern::Strided) {
+          state.phase = (state.phase + stream.access_bytes) % stream.spec.stride_bytes;
+        }
+      }
+      break;
+    }
+    case WorkloadPattern::Random:
+    case WorkloadPattern::Zipf: {
+      const size_t* indices = state.indices.data() + state.cursor;
+      if (read) {
+        checksum ^= kernels.read_random(state.base, indices, stream.slice_accesses);
+      } else {
+        kernels.write_random(state.base, indices, stream.slice_accesses);
+      }
+      state.cursor += stream.slice_accesses;
+      if (state.cursor == state.indices.size()) {
+        state.cursor = 0;
+      }
+      break;
+    }
+    case WorkloadPattern::Chase:
+      state.chase = memory_latency_chase_asm(state.chase, stream.slice_accesses);
+      break;
+  }
+}
+
+// Fixed-length index stream of region-relative offsets for one worker.
+bool build_workload_indices(const WorkloadStreamPlan& stream, uint64_t seed,
+                            std::vector<size_t>& indices) {
+  const size_t count = Constants::WORKLOAD_INDEX_STREAM_ACCESSES;
+  if (stream.spec.pattern == WorkloadPattern::Zipf) {
+    PatternSkewParameters parameters;
+    parameters.zipf_theta = stream.spec.zipf_theta;
+    indices = generate_skewed_indices(PatternSkewDistribution::Zipf, stream.spec.region_bytes,
+                                      count, parameters, seed);
+  } else {
+    indices = generate_random_indices(stream.spec.region_bytes, count, seed);
+  }
+  if (indices.empty()) {
+    return false;
+  }
+  // A region with fewer slots than the stream repeats its permutation.
+  const size_t distinct = indices.size();
+  for (size_t index = distinct; index < count; ++index) {
+    indices.push_back(indices[index % distinct]);
+  }
+  return true;
+}
+
+uint64_t stream_worker_seed(uint64_t base_seed, size_t stream_index, size_t worker_index) {
+  return SeedUtils::splitmix64(SeedUtils::splitmix64(base_seed + stream_index) + worker_index);
+}
+
+void print_workload_report(const WorkloadConfig& config, const WorkloadPlan& plan,
+                           const WorkloadResult& result) {
+  std::cout << std::endl << Messages::report_workload_header() << std::endl;
+  std::cout << Messages::report_workload_note() << std::endl;
+  std::cout << Messages::report_workload_table_header() << std::endl;
+  for (size_t index = 0; index < plan.streams.size() && index < result.streams.size(); ++index) {
+    const WorkloadStreamPlan& stream = plan.streams[index];
+    const WorkloadStreamMeasurement& measurement = result.streams[index];
+    if (measurement.gb_s_samples.empty()) {
+      continue;
+    }
+    const WorkloadGroupSpec& group = config.spec.groups[stream.group_index];
+    std::cout << Messages::report_workload_row(
+                     group.name + "/" + stream.spec.name,
+                     workload_operation_to_string(stream.spec.operation),
+                     workload_pattern_to_string(stream.spec.pattern), group.threads,
+                     measurement.median_byte_share, stream.weight_share, measurement.median_gb_s,
+                     measurement.median_ns_per_access, measurement.gb_s_cv_pct)
+              << std::endl;
+  }
+  if (!result.aggregate_gb_s_samples.empty()) {
+    std::cout << Messages::report_workload_aggregate(
+                     result.median_aggregate_gb_s, plan.workers.size(), result.aggregate_cv_pct,
+                     !result.chase_ns_samples.empty(), result.median_chase_ns)
+              << std::endl;
+  }
+}
+
+int fail_workload(const std::string& reason) {
+  std::cerr << Messages::error_prefix() << Messages::error_workload_failed(reason) << std::endl;
+  return EXIT_FAILURE;
+}
+
+}  // namespace
+
+int run_workload(const WorkloadConfig& config) {
+  print_runtime_banner();
+  WorkloadPlan plan;
+  std::string error;
+  if (!compile_workload_plan(config.spec, plan, error)) {
+    std::cerr << Messages::error_prefix() << error << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << Messages::msg_running_workload(config.workload_file, config.spec.groups.size(),
+                                              plan.streams.size(), plan.workers.size(),
+                                              plan.total_region_bytes, config.sample_ms)
+            << std::endl;
+  const auto run_start = std::chrono::steady_clock::now();
+
+  std::vector<MmapPtr> regions;
+  for (const WorkloadStreamPlan& stream : plan.streams) {
+    regions.push_back(allocate_buffer(stream.spec.region_bytes, "workload stream"));
+    if (!regions.back()) {
+      return fail_workload("buffer allocation");
+    }
+    // Zero fill faults every page in before chains are linked or timing starts.
+    std::memset(regions.back().get(), 0, stream.spec.region_bytes);
+  }
+
+  std::vector<WorkloadWorkerState> workers(plan.workers.size());
+  for (size_t worker_index = 0; worker_index < plan.workers.size(); ++worker_index) {
+    const WorkloadWorkerPlan& worker_plan = plan.workers[worker_index];
+    WorkloadWorkerState& worker = workers[worker_index];
+    worker.streams.resize(plan.streams.size());
+    for (size_t stream_index = 0; stream_index < plan.streams.size(); ++stream_index) {
+      const WorkloadStreamPlan& stream = plan.streams[stream_index];
+      if (stream.group_index != worker_plan.group_index) {
+        continue;
+      }
+      WorkloadStreamState& state = worker.streams[stream_index];
+      char* region = static_cast<char*>(regions[stream_index].get());
+      const uint64_t seed = stream_worker_seed(config.seed, stream_index, worker_index);
+      switch (stream.spec.pattern) {
+        case WorkloadPattern::Sequential:
+        case WorkloadPattern::Strided:
+          state.base = region + worker_plan.group_worker * stream.partition_bytes;
+          break;
+        case WorkloadPattern::Random:
+        case WorkloadPattern::Zipf:
+          state.base = region;
+          if (!build_workload_indices(stream, seed, state.indices)) {
+            return fail_workload("index generation for stream '" + stream.spec.name + "'");
+          }
+          break;
+        case WorkloadPattern::Chase:
+          state.base = region + worker_plan.group_worker * stream.partition_bytes;
+          if (setup_latency_chain(state.base, stream.partition_bytes,
+                                  Constants::WORKLOAD_CHASE_STRIDE_BYTES, 0, nullptr,
+                                  LatencyChainMode::GlobalRandom, seed) != EXIT_SUCCESS) {
+            return fail_workload("pointer chain for stream '" + stream.spec.name + "'");
+          }
+          state.chase = reinterpret_cast<uintptr_t*>(state.base);
+          break;
+      }
+    }
+  }
+
+  auto timer_optional = HighResTimer::create();
+  if (!timer_optional) {
+    std::cerr << Messages::error_prefix() << Messages::error_timer_creation_failed() << std::endl;
+    return EXIT_FAILURE;
+  }
+  HighResTimer& timer = *timer_optional;
+  std::vector<HighResTimer> slice_timers;
+  for (size_t worker_index = 0; worker_index < workers.size(); ++worker_index) {
+    auto slice_timer = HighResTimer::create();
+    if (!slice_timer) {
+      std::cerr << Messages::error_prefix() << Messages::error_timer_creation_failed()
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+    slice_timers.push_back(*slice_timer);
+  }
+
+  const MemoryKernelSet& kernels =
+      memory_kernel_set(MemoryKernelVariant::Neon);
+  const double sample_ns = static_cast<double>(config.sample_ms) * 1e6;
+  auto work = [&plan, &workers, &slice_timers, &kernels, sample_ns](size_t worker_index,
+                                                                    int /* iterations */) {
+    WorkloadWorkerState& worker = workers[worker_index];
+    HighResTimer& slice_timer = slice_timers[worker_index];
+    const std::vector<size_t>& schedule = plan.workers[worker_index].schedule;
+    double busy_ns = 0.0;
+    while (busy_ns < sample_ns) {
+      const size_t stream_index = schedule[worker.position];
+      worker.position = (worker.position + 1) % schedule.size();
+      const WorkloadStreamPlan& stream = plan.streams[stream_index];
+      WorkloadStreamState& state = worker.streams[stream_index];
+      slice_timer.start();
+      run_workload_slice(stream, state, kernels, worker.checksum);
+      const double slice_ns = slice_timer.stop_ns();
+      state.totals.bytes += stream.slice_accesses * stream.access_bytes;
+      state.totals.accesses += stream.slice_accesses;
+      state.totals.busy_ns += slice_ns;
+      busy_ns += slice_ns;
+    }
+  };
+
+  // Runs one concurrent sample and sums every worker's per-stream totals.
+  const auto run_sample = [&](std::vector<WorkloadStreamTotals>& totals) {
+    for (WorkloadWorkerState& worker : workers) {
+      for (WorkloadStreamState& state : worker.streams) {
+        state.totals = WorkloadStreamTotals{};
+      }
+    }
+    const double wall_seconds =
+        run_parallel_test_per_worker(workers.size(), 1, timer, work, "workload");
+    totals.assign(plan.streams.size(), WorkloadStreamTotals{});
+    for (const WorkloadWorkerState& worker : workers) {
+      for (size_t stream_index = 0; stream_index < worker.streams.size(); ++stream_index) {
+        totals[stream_index].bytes += worker.streams[stream_index].totals.bytes;
+        totals[stream_index].accesses += worker.streams[stream_index].totals.accesses;
+        totals[stream_index].busy_ns += worker.streams[stream_index].totals.busy_ns;
+      }
+    }
+    return wall_seconds;
+  };
+
+  WorkloadResult result;
+  std::vector<WorkloadStreamTotals> totals;
+  // One untimed sample settles the TLB and frequency before round one.
+  if (run_sample(totals) <= 0.0) {
+    return fail_workload("worker startup");
+  }
+  for (int round = 0; round < config.rounds; ++round) {
+    const double wall_seconds = run_sample(totals);
+    if (wall_seconds <= 0.0) {
+      return fail_workload("worker startup");
+    }
+    record_workload_sample(plan, totals, wall_seconds * 1e9, result);
+    if (signal_received()) {
+      result.interrupted = true;
+      break;
+    }
+  }
+  if (result.interrupted) {
+    std::cout << std::endl << Messages::msg_interrupted_by_user() << std::endl;
+  }
+
+  finalize_workload_result(result);
+  print_workload_report(config, plan, result);
+
+  if (!config.output_file.empty()) {
+    const double total_execution_time_sec =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - run_start).count();
+    std::filesystem::path output_path(config.output_file);
+    if (output_path.is_relative()) {
+      output_path = std::filesystem::current_path() / output_path;
+    }
+    if (write_json_to_file(output_path,
+                           build_workload_json(config, plan, result, get_processor_name(),
+                                               total_execution_time_sec)) != EXIT_SUCCESS) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -28,7 +28,10 @@
  * - Thread count configuration (-t, --threads)
  * - Test mode selection (-B/--benchmark, -P/--patterns, --analyze-tlb,
  *   -W/--only-bandwidth, -L/--only-latency)
- * - Reproducible workload selection (--seed) and TLB density (--tlb-density)
+ * - Reproducible workload selection (--seed), TLB density (--tlb-density), and
+ *   TLB chain-layout reuse (--tlb-chain-layouts)
+ * - Skewed pattern distributions (--zipf-theta, --hot-fraction, --hot-probability)
+ * - 2D matrix pattern shape (--matrix-row-bytes, --matrix-pitch, --matrix-tile)
  * - Multi-configuration sweeps (--sweep, --sweep-max-runs)
  * - Best-effort cache-discouraging allocation hints (--non-cacheable)
  * - Output options (-o, --output)
@@ -44,6 +47,8 @@
  * @note Performs comprehensive range validation for all numeric parameters
  */
 
+#include "benchmark/kernel_autotune.h"
+#include "benchmark/memory_kernels.h"
 #include "core/config/config.h"
 #include "core/config/constants.h"
 #include "core/config/sweep_utils.h"
@@ -51,6 +56,8 @@
 #include "output/console/messages/messages_api.h"
 #include "utils/benchmark.h"
 #include "utils/seed_utils.h"
+#include <cctype>
+#include <cerrno>
 #include <charconv>
 #include <iostream>
 #include <limits>
@@ -142,6 +149,7 @@ constexpr const char* OPT_ANALYZE_TLB_SHORT = "-T";
 constexpr const char* OPT_ANALYZE_TLB_LONG = "--analyze-tlb";
 constexpr const char* OPT_BENCHMARK_SHORT = "-B";
 constexpr const char* OPT_BENCHMARK_LONG = "--benchmark";
+constexpr const char* OPT_BANDWIDTH_TIMELINE_LONG = "--bandwidth-timeline";
 constexpr const char* OPT_BUFFER_SIZE_SHORT = "-b";
 constexpr const char* OPT_BUFFER_SIZE_LONG = "--buffer-size";
 constexpr const char* OPT_CACHE_SIZE_SHORT = "-k";
@@ -152,6 +160,7 @@ constexpr const char* OPT_HELP_SHORT = "-h";
 constexpr const char* OPT_HELP_LONG = "--help";
 constexpr const char* OPT_ITERATIONS_SHORT = "-i";
 constexpr const char* OPT_ITERATIONS_LONG = "--iterations";
+constexpr const char* OPT_KERNEL_LONG = "--kernel";
 constexpr const char* OPT_LATENCY_CHAIN_MODE_SHORT = "-m";
 constexpr const char* OPT_LATENCY_CHAIN_MODE_LONG = "--latency-chain-mode";
 constexpr const char* OPT_LATENCY_SAMPLES_SHORT = "-n";
@@ -160,6 +169,7 @@ constexpr const char* OPT_LATENCY_STRIDE_SHORT = "-s";
 constexpr const char* OPT_LATENCY_STRIDE_LONG = "--latency-stride-bytes";
 constexpr const char* OPT_LATENCY_TLB_LOCALITY_SHORT = "-l";
 constexpr const char* OPT_LATENCY_TLB_LOCALITY_LONG = "--latency-tlb-locality-kb";
+constexpr const char* OPT_LOCK_BUFFERS_LONG = "--lock-buffers";
 constexpr const char* OPT_NON_CACHEABLE_SHORT = "-u";
 constexpr const char* OPT_NON_CACHEABLE_LONG = "--non-cacheable";
 constexpr const char* OPT_ONLY_BANDWIDTH_SHORT = "-W";
@@ -170,6 +180,12 @@ constexpr const char* OPT_OUTPUT_SHORT = "-o";
 constexpr const char* OPT_OUTPUT_LONG = "--output";
 constexpr const char* OPT_PATTERNS_SHORT = "-P";
 constexpr const char* OPT_PATTERNS_LONG = "--patterns";
+constexpr const char* OPT_ZIPF_THETA_LONG = "--zipf-theta";
+constexpr const char* OPT_HOT_FRACTION_LONG = "--hot-fraction";
+constexpr const char* OPT_HOT_PROBABILITY_LONG = "--hot-probability";
+constexpr const char* OPT_MATRIX_ROW_BYTES_LONG = "--matrix-row-bytes";
+constexpr const char* OPT_MATRIX_PITCH_LONG = "--matrix-pitch";
+constexpr const char* OPT_MATRIX_TILE_LONG = "--matrix-tile";
 constexpr const char* OPT_SEED_LONG = "--seed";
 constexpr const char* OPT_SWEEP_SHORT = "-S";
 constexpr const char* OPT_SWEEP_LONG = "--sweep";
@@ -177,6 +193,7 @@ constexpr const char* OPT_SWEEP_MAX_RUNS_SHORT = "-X";
 constexpr const char* OPT_SWEEP_MAX_RUNS_LONG = "--sweep-max-runs";
 constexpr const char* OPT_THREADS_SHORT = "-t";
 constexpr const char* OPT_THREADS_LONG = "--threads";
+constexpr const char* OPT_TLB_CHAIN_LAYOUTS_LONG = "--tlb-chain-layouts";
 constexpr const char* OPT_TLB_DENSITY_SHORT = "-D";
 constexpr const char* OPT_TLB_DENSITY_LONG = "--tlb-density";
 
@@ -202,6 +219,19 @@ uint64_t parse_unsigned_decimal_or_throw(const std::string& value) {
   return parsed;
 }
 
+double parse_finite_decimal_or_throw(const std::string& value) {
+  if (value.empty() || std::isspace(static_cast<unsigned char>(value.front()))) {
+    throw std::out_of_range("must be a decimal number");
+  }
+  errno = 0;
+  char* end = nullptr;
+  const double parsed = std::strtod(value.c_str(), &end);
+  if (end != value.c_str() + value.size() || errno == ERANGE || !std::isfinite(parsed)) {
+    throw std::out_of_range("must be a finite decimal number");
+  }
+  return parsed;
+}
+
 uint64_t generate_config_seed() {
   const ConfigTestHooks* hooks = get_config_test_hooks();
   if (hooks != nullptr && hooks->generated_seed != 0) {
@@ -378,6 +408,7 @@ int parse_arguments(int argc, char* argv[], BenchmarkConfig& config) {
     bool tlb_density_seen = false;
     bool seed_seen = false;
     bool sweep_max_runs_seen = false;
+    bool tlb_chain_layouts_seen = false;
 
     for (int i = 1; i < argc; ++i) {
       const std::string arg = argv[i];
@@ -621,6 +652,44 @@ int parse_arguments(int argc, char* argv[], BenchmarkConfig& config) {
         continue;
       }
 
+      if (arg == OPT_TLB_CHAIN_LAYOUTS_LONG) {
+        if (tlb_chain_layouts_seen) {
+          std::cerr << Messages::error_prefix()
+                    << Messages::error_duplicate_option(OPT_TLB_CHAIN_LAYOUTS_LONG)
+                    << std::endl;
+          print_usage(argv[0]);
+          return EXIT_FAILURE;
+        }
+        if (++i >= argc) {
+          std::cerr << Messages::error_prefix()
+                    << Messages::error_missing_value(OPT_TLB_CHAIN_LAYOUTS_LONG)
+                    << std::endl;
+          print_usage(argv[0]);
+          return EXIT_FAILURE;
+        }
+
+        const std::string layouts_value = argv[i];
+        try {
+          const long long val_ll = parse_signed_decimal_or_throw(layouts_value);
+          if (val_ll < 0 ||
+              static_cast<unsigned long long>(val_ll) >
+                  Constants::MAX_TLB_CHAIN_LAYOUTS) {
+            throw std::out_of_range(
+                Messages::error_tlb_chain_layouts_invalid(
+                    Constants::MAX_TLB_CHAIN_LAYOUTS));
+          }
+          config.tlb_chain_layouts = static_cast<size_t>(val_ll);
+        } catch (const std::out_of_range& e) {
+          std::cerr << Messages::error_prefix()
+                    << Messages::error_invalid_value(arg, layouts_value, e.what())
+                    << std::endl;
+          print_usage(argv[0]);
+          return EXIT_FAILURE;
+        }
+        tlb_chain_layouts_seen = true;
+        continue;
+      }
+
       std::cerr << Messages::error_prefix()
                 << Messages::error_analyze_tlb_must_be_used_alone()
                 << std::endl;
@@ -682,6 +751,7 @@ int parse_arguments(int argc, char* argv[], BenchmarkConfig& config) {
   config.macos_version = use_injected_system_info ? test_hooks->macos_version : get_macos_version();
   config.perf_cores = use_injected_system_info ? test_hooks->performance_cores : get_performance_cores();
   config.eff_cores = use_injected_system_info ? test_hooks->efficiency_cores : get_efficiency_cores();
+  config.memory_kernel_variant = MemoryKernelVariant::Neon;
   int max_cores = use_injected_system_info ? test_hooks->total_logical_cores : get_total_logical_cores();
   config.num_threads = max_cores;  // Default: use all available cores
   
@@ -713,6 +783,13 @@ int parse_arguments(int argc, char* argv[], BenchmarkConfig& config) {
   bool threads_seen = false;
   bool output_seen = false;
   bool seed_seen = false;
+  bool kernel_seen = false;
+  bool zipf_theta_seen = false;
+  bool hot_fraction_seen = false;
+  bool hot_probability_seen = false;
+  bool matrix_row_bytes_seen = false;
+  bool matrix_pitch_seen = false;
+  bool matrix_tile_seen = false;
   uint64_t parsed_general_seed = 0;
   bool sweep_max_runs_seen = false;
 
@@ -801,6 +878,19 @@ int parse_arguments(int argc, char* argv[], BenchmarkConfig& config) {
           throw std::invalid_argument(Messages::error_missing_value(OPT_LATENCY_CHAIN_MODE_LONG));
         }
         latency_chain_mode_seen = true;
+      } else if (arg == OPT_KERNEL_LONG) {
+        if (kernel_seen)
+          throw std::invalid_argument(Messages::error_duplicate_option(OPT_KERNEL_LONG));
+        if (++i < argc) {
+          if (argv[i] != std::string(Constants::KERNEL_AUTOTUNE_TUNED_KERNEL_NAME) &&
+              find_memory_kernel_set(argv[i]) == nullptr) {
+            throw std::out_of_range(Messages::error_kernel_name_invalid());
+          }
+          config.memory_kernel_name = argv[i];
+        } else {
+          throw std::invalid_argument(Messages::error_missing_value(OPT_KERNEL_LONG));
+        }
+        kernel_seen = true;
       } else if (is_option(arg, OPT_LATENCY_TLB_LOCALITY_SHORT, OPT_LATENCY_TLB_LOCALITY_LONG)) {
         if (latency_tlb_locality_seen)
           throw std::invalid_argument(Messages::error_duplicate_option(OPT_LATENCY_TLB_LOCALITY_LONG));
@@ -860,6 +950,88 @@ int parse_arguments(int argc, char* argv[], BenchmarkConfig& config) {
           throw std::invalid_argument(Messages::error_missing_value(OPT_SEED_LONG));
         }
         seed_seen = true;
+      } else if (arg == OPT_ZIPF_THETA_LONG) {
+        if (zipf_theta_seen)
+          throw std::invalid_argument(Messages::error_duplicate_option(OPT_ZIPF_THETA_LONG));
+        if (++i < argc) {
+          const double theta = parse_finite_decimal_or_throw(argv[i]);
+          if (theta <= 0.0 || theta > Constants::PATTERN_ZIPF_MAX_THETA)
+            throw std::out_of_range(Messages::error_zipf_theta_invalid(Constants::PATTERN_ZIPF_MAX_THETA));
+          config.pattern_zipf_theta = theta;
+        } else {
+          throw std::invalid_argument(Messages::error_missing_value(OPT_ZIPF_THETA_LONG));
+        }
+        config.user_specified_pattern_skew = true;
+        zipf_theta_seen = true;
+      } else if (arg == OPT_HOT_FRACTION_LONG) {
+        if (hot_fraction_seen)
+          throw std::invalid_argument(Messages::error_duplicate_option(OPT_HOT_FRACTION_LONG));
+        if (++i < argc) {
+          const double fraction = parse_finite_decimal_or_throw(argv[i]);
+          if (fraction <= 0.0 || fraction >= 1.0)
+            throw std::out_of_range(Messages::error_hot_fraction_invalid());
+          config.pattern_hot_fraction = fraction;
+        } else {
+          throw std::invalid_argument(Messages::error_missing_value(OPT_HOT_FRACTION_LONG));
+        }
+        config.user_specified_pattern_skew = true;
+        hot_fraction_seen = true;
+      } else if (arg == OPT_HOT_PROBABILITY_LONG) {
+        if (hot_probability_seen)
+          throw std::invalid_argument(Messages::error_duplicate_option(OPT_HOT_PROBABILITY_LONG));
+        if (++i < argc) {
+          const double probability = parse_finite_decimal_or_throw(argv[i]);
+          if (probability <= 0.0 || probability > 1.0)
+            throw std::out_of_range(Messages::error_hot_probability_invalid());
+          config.pattern_hot_probability = probability;
+        } else {
+          throw std::invalid_argument(Messages::error_missing_value(OPT_HOT_PROBABILITY_LONG));
+        }
+        config.user_specified_pattern_skew = true;
+        hot_probability_seen = true;
+      } else if (arg == OPT_MATRIX_ROW_BYTES_LONG) {
+        if (matrix_row_bytes_seen)
+          throw std::invalid_argument(Messages::error_duplicate_option(OPT_MATRIX_ROW_BYTES_LONG));
+        if (++i < argc) {
+          const uint64_t row_bytes = parse_unsigned_decimal_or_throw(argv[i]);
+          if (row_bytes == 0 || row_bytes > std::numeric_limits<size_t>::max())
+            throw std::out_of_range(Messages::error_matrix_row_bytes_invalid());
+          config.pattern_matrix_row_bytes = static_cast<size_t>(row_bytes);
+        } else {
+          throw std::invalid_argument(Messages::error_missing_value(OPT_MATRIX_ROW_BYTES_LONG));
+        }
+        config.user_specified_pattern_matrix = true;
+        matrix_row_bytes_seen = true;
+      } else if (arg == OPT_MATRIX_PITCH_LONG) {
+        if (matrix_pitch_seen)
+          throw std::invalid_argument(Messages::error_duplicate_option(OPT_MATRIX_PITCH_LONG));
+        if (++i < argc) {
+          const uint64_t pitch_bytes = parse_unsigned_decimal_or_throw(argv[i]);
+          if (pitch_bytes == 0 || pitch_bytes > std::numeric_limits<size_t>::max())
+            throw std::out_of_range(Messages::error_matrix_pitch_invalid());
+          config.pattern_matrix_pitch_bytes = static_cast<size_t>(pitch_bytes);
+        } else {
+          throw std::invalid_argument(Messages::error_missing_value(OPT_MATRIX_PITCH_LONG));
+        }
+        config.user_specified_pattern_matrix = true;
+        matrix_pitch_seen = true;
+      } else if (arg == OPT_MATRIX_TILE_LONG) {
+        if (matrix_tile_seen)
+          throw std::invalid_argument(Messages::error_duplicate_option(OPT_MATRIX_TILE_LONG));
+        if (++i < argc) {
+          const uint64_t tile_elements = parse_unsigned_decimal_or_throw(argv[i]);
+          if (tile_elements == 0 ||
+              tile_elements % Constants::PATTERN_MATRIX_TILE_ELEMENT_MULTIPLE != 0 ||
+              tile_elements > Constants::PATTERN_MATRIX_MAX_TILE_ELEMENTS)
+            throw std::out_of_range(Messages::error_matrix_tile_invalid(
+                Constants::PATTERN_MATRIX_TILE_ELEMENT_MULTIPLE,
+                Constants::PATTERN_MATRIX_MAX_TILE_ELEMENTS));
+          config.pattern_matrix_tile_elements = static_cast<size_t>(tile_elements);
+        } else {
+          throw std::invalid_argument(Messages::error_missing_value(OPT_MATRIX_TILE_LONG));
+        }
+        config.user_specified_pattern_matrix = true;
+        matrix_tile_seen = true;
       } else if (is_option(arg, OPT_BENCHMARK_SHORT, OPT_BENCHMARK_LONG)) {
         config.run_benchmark = true;
         if (config.run_patterns) {
@@ -876,6 +1048,10 @@ int parse_arguments(int argc, char* argv[], BenchmarkConfig& config) {
         config.only_bandwidth = true;
       } else if (is_option(arg, OPT_ONLY_LATENCY_SHORT, OPT_ONLY_LATENCY_LONG)) {
         config.only_latency = true;
+      } else if (arg == OPT_BANDWIDTH_TIMELINE_LONG) {
+        config.bandwidth_timeline = true;
+      } else if (arg == OPT_LOCK_BUFFERS_LONG) {
+        config.lock_buffers = true;
       } else if (is_option(arg, OPT_THREADS_SHORT, OPT_THREADS_LONG)) {
         if (threads_seen)
           throw std::invalid_argument(Messages::error_duplicate_option(OPT_THREADS_LONG));
@@ -918,6 +1094,41 @@ int parse_arguments(int argc, char* argv[], BenchmarkConfig& config) {
     }
   }
 
+  // An explicit --kernel overrides the default NEON variant.
+  if (kernel_seen) {
+    if (config.memory_kernel_name == Constants::KERNEL_AUTOTUNE_TUNED_KERNEL_NAME) {
+      // Tuned winners are keyed by CPU identity, so they can only be resolved
+      // once system info is known.
+      const std::string cache_path =
+          test_hooks != nullptr && !test_hooks->kernel_autotune_cache_path.empty()
+              ? test_hooks->kernel_autotune_cache_path
+              : default_kernel_autotune_cache_path();
+      TunedMemoryKernelNames tuned_names;
+      std::string tuned_error = "HOME is not set";
+      if (cache_path.empty() ||
+          !load_tuned_memory_kernel_names(
+              cache_path,
+              build_kernel_autotune_cpu_identity(config.cpu_name, config.perf_cores,
+                                                 config.eff_cores),
+              tuned_names, tuned_error) ||
+          install_tuned_memory_kernel_set(tuned_names.read, tuned_names.write,
+                                          tuned_names.copy) == nullptr) {
+        if (tuned_error.empty()) {
+          tuned_error = "cached kernel names are not in this build's registry";
+        }
+        std::cerr << Messages::error_prefix()
+                  << Messages::error_kernel_tuned_unavailable(tuned_error) << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      config.tuned_read_kernel = tuned_names.read;
+      config.tuned_write_kernel = tuned_names.write;
+      config.tuned_copy_kernel = tuned_names.copy;
+    }
+    const MemoryKernelSet* named_kernels = find_memory_kernel_set(config.memory_kernel_name);
+    config.memory_kernel_variant = named_kernels->variant;
+  }
+
   // Set buffer size from user request or default
   if (requested_buffer_size_mb_ll != -1) {
     config.buffer_size_mb = static_cast<unsigned long>(requested_buffer_size_mb_ll);
@@ -0,0 +1,90 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+/**
+ * @file cli_options.cpp
+ * @brief Shared option matching and value handling for standalone mode CLIs.
+ */
+
+#include "core/config/cli_options.h"
+
+#include <iostream>
+#include <limits>
+
+#include "core/config/config.h"
+#include "output/console/messages/messages_api.h"
+#include "output/console/output_printer.h"
+
+bool is_option(const std::string& arg, const char* short_option, const char* long_option) {
+  return arg == short_option || (long_option != nullptr && arg == long_option);
+}
+
+bool parse_bounded_int_option(const std::string& option,
+                              const std::string& value,
+                              int maximum,
+                              int& out_value,
+                              const char* prog_name) {
+  long long parsed = 0;
+  const StrictIntegerParseStatus parse_status =
+      parse_strict_signed_decimal(value, parsed);
+  if (parse_status != StrictIntegerParseStatus::Success) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_invalid_value(
+                     option, value,
+                     strict_signed_decimal_error_reason(parse_status))
+              << std::endl;
+    print_usage(prog_name);
+    return false;
+  }
+
+  if (parsed <= 0 || parsed > maximum) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_invalid_value(
+                     option, value, "must be between 1 and " + std::to_string(maximum))
+              << std::endl;
+    print_usage(prog_name);
+    return false;
+  }
+
+  out_value = static_cast<int>(parsed);
+  return true;
+}
+
+bool parse_positive_int_option(const std::string& option,
+                               const std::string& value,
+                               int& out_value,
+                               const char* prog_name) {
+  return parse_bounded_int_option(option, value, std::numeric_limits<int>::max(), out_value,
+                                  prog_name);
+}
+
+bool take_option_value(int argc, char* argv[], int& i, bool& seen, const char* long_option) {
+  if (seen) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_duplicate_option(long_option)
+              << std::endl;
+    print_usage(argv[0]);
+    return false;
+  }
+  if (++i >= argc) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_missing_value(long_option)
+              << std::endl;
+    print_usage(argv[0]);
+    return false;
+  }
+  seen = true;
+  return true;
+}
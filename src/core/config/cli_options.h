@@ -0,0 +1,52 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+/**
+ * @file cli_options.h
+ * @brief Shared option matching and value handling for standalone mode CLIs.
+ *
+ * Each failing helper prints its error and the usage text before returning
+ * false, so mode parsers only propagate the failure.
+ */
+
+#ifndef CLI_OPTIONS_H
+#define CLI_OPTIONS_H
+
+#include <string>
+
+/** True when `arg` is the short option or, when given, the long option. */
+bool is_option(const std::string& arg, const char* short_option, const char* long_option);
+
+/** Parse a strict decimal `value` in [1, `maximum`] for `option`. */
+bool parse_bounded_int_option(const std::string& option,
+                              const std::string& value,
+                              int maximum,
+                              int& out_value,
+                              const char* prog_name);
+
+/** Parse a strict decimal `value` in [1, INT_MAX] for `option`. */
+bool parse_positive_int_option(const std::string& option,
+                               const std::string& value,
+                               int& out_value,
+                               const char* prog_name);
+
+/**
+ * Advance `i` to the value of a single-value option.
+ *
+ * Rejects a repeated option (tracked through `seen`) and a missing value.
+ */
+bool take_option_value(int argc, char* argv[], int& i, bool& seen, const char* long_option);
+
+#endif  // CLI_OPTIONS_H
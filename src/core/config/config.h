@@ -100,6 +100,7 @@ struct ConfigTestHooks {
   size_t l2_cache_size = 0;
   uint64_t generated_seed = 0;
   size_t page_size_bytes = 0;
+  std::string kernel_autotune_cache_path;  ///< Non-empty replaces the $HOME cache for --kernel tuned
 };
 
 void set_config_test_hooks(const ConfigTestHooks* hooks);
@@ -155,8 +156,15 @@ struct BenchmarkConfig {
   size_t latency_tlb_locality_bytes = Constants::DEFAULT_LATENCY_TLB_LOCALITY_KB * Constants::BYTES_PER_KB;  ///< TLB-locality window for latency chains (default 1 MB; 0 = global random)
   TlbSweepDensity tlb_sweep_density = TlbSweepDensity::Medium;  ///< Standard profile for standalone --analyze-tlb
   uint64_t tlb_seed = 0;  ///< Reproducible standalone TLB planner/chain seed
+  size_t tlb_chain_layouts = Constants::DEFAULT_TLB_CHAIN_LAYOUTS;  ///< Reused chain layouts per point (0 = rebuild every round)
   uint64_t pattern_seed = 0;  ///< Reproducible random workload seed for --patterns
   uint64_t benchmark_seed = 0;  ///< Reproducible workload/schedule seed for --benchmark
+  double pattern_zipf_theta = Constants::PATTERN_ZIPF_DEFAULT_THETA;  ///< Zipf exponent for the skewed zipf pattern
+  double pattern_hot_fraction = Constants::PATTERN_HOT_DEFAULT_FRACTION;  ///< Hot-set share of slots for hot/cold patterns
+  double pattern_hot_probability = Constants::PATTERN_HOT_DEFAULT_PROBABILITY;  ///< Share of accesses hitting the hot set
+  size_t pattern_matrix_row_bytes = Constants::PATTERN_MATRIX_DEFAULT_ROW_BYTES;  ///< Logical row width of the 2D matrix patterns
+  size_t pattern_matrix_pitch_bytes = 0;  ///< Row pitch of the 2D matrix patterns (0 = row width)
+  size_t pattern_matrix_tile_elements = Constants::PATTERN_MATRIX_DEFAULT_TILE_ELEMENTS;  ///< Tile edge for tiled/transpose patterns
   
   // Calculated sizes
   size_t buffer_size = 0;        ///< Final buffer size in bytes (calculated from buffer_size_mb)
@@ -179,6 +187,11 @@ struct BenchmarkConfig {
   size_t l1_cache_size = 0;      ///< L1 cache size in bytes
   size_t l2_cache_size = 0;      ///< L2 cache size in bytes
   size_t custom_cache_size_bytes = 0;  ///< Custom cache size in bytes
+  MemoryKernelVariant memory_kernel_variant = MemoryKernelVariant::Neon;  ///< Main-memory kernel family
+  std::string memory_kernel_name;  ///< Explicit --kernel registry name (empty = default NEON)
+  std::string tuned_read_kernel;   ///< --kernel tuned: cached main-memory read winner
+  std::string tuned_write_kernel;  ///< --kernel tuned: cached main-memory write winner
+  std::string tuned_copy_kernel;   ///< --kernel tuned: cached main-memory copy winner
   unsigned long max_total_allowed_mb = 0;  ///< Maximum total memory allowed in MB (80% of available)
   
   // Flags
@@ -189,6 +202,8 @@ struct BenchmarkConfig {
   bool user_specified_threads = false; ///< Whether user explicitly set --threads parameter
   bool only_bandwidth = false;         ///< When true, run only bandwidth tests
   bool only_latency = false;           ///< When true, run only latency tests
+  bool bandwidth_timeline = false;     ///< Record an intra-pass timeline per bandwidth measurement
+  bool lock_buffers = false;           ///< mlock() standard-mode phase buffers
   bool analyze_tlb = false;            ///< When true, run standalone TLB analysis mode
   bool run_sweep = false;              ///< Whether to execute a multi-configuration sweep
   bool help_printed = false;           ///< Whether -h/--help was invoked (usage already printed)
@@ -206,6 +221,8 @@ struct BenchmarkConfig {
   bool user_specified_tlb_seed = false;  ///< Whether user explicitly set --seed
   bool user_specified_pattern_seed = false;  ///< Whether user explicitly set --seed for --patterns
   bool user_specified_benchmark_seed = false;  ///< Whether user explicitly set --seed for --benchmark
+  bool user_specified_pattern_skew = false;  ///< Whether user set --zipf-theta/--hot-fraction/--hot-probability
+  bool user_specified_pattern_matrix = false;  ///< Whether user set --matrix-row-bytes/--matrix-pitch/--matrix-tile
   
   // Output file
   std::string output_file;  ///< JSON output file path (empty = no JSON output)
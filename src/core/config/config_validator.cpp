@@ -217,6 +217,33 @@ int validate_config(BenchmarkConfig& config) {
               << std::endl;
     return EXIT_FAILURE;
   }
+  if (config.user_specified_pattern_skew && !config.run_patterns) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_pattern_skew_requires_patterns()
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (config.user_specified_pattern_matrix && !config.run_patterns) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_pattern_matrix_requires_patterns()
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (config.pattern_matrix_row_bytes %
+          (config.pattern_matrix_tile_elements * Constants::PATTERN_MATRIX_ELEMENT_BYTES) != 0) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_matrix_row_bytes_invalid()
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (config.pattern_matrix_pitch_bytes != 0 &&
+      (config.pattern_matrix_pitch_bytes < config.pattern_matrix_row_bytes ||
+       config.pattern_matrix_pitch_bytes % Constants::PATTERN_ACCESS_SIZE_BYTES != 0)) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_matrix_pitch_invalid()
+              << std::endl;
+    return EXIT_FAILURE;
+  }
   if (config.user_specified_benchmark_seed && !config.run_benchmark) {
     std::cerr << Messages::error_prefix()
               << Messages::error_seed_requires_supported_mode()
@@ -262,7 +289,28 @@ int validate_config(BenchmarkConfig& config) {
     std::cerr << Messages::error_prefix() << Messages::error_only_flags_with_patterns() << std::endl;
     return EXIT_FAILURE;  // Return code: validation error
   }
+
+  // Error: --kernel only affects main-memory bandwidth and sequential/strided/random patterns
+  if (!config.memory_kernel_name.empty() &&
+      ((!config.run_benchmark && !config.run_patterns) || config.only_latency)) {
+    std::cerr << Messages::error_prefix() << Messages::error_kernel_requires_bandwidth_mode() << std::endl;
+    return EXIT_FAILURE;
+  }
   
+  // Error: --bandwidth-timeline instruments standard-mode bandwidth runs only
+  if (config.bandwidth_timeline && (!config.run_benchmark || config.only_latency)) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_bandwidth_timeline_requires_benchmark() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Error: --lock-buffers wires the standard benchmark's phase buffers only
+  if (config.lock_buffers && !config.run_benchmark) {
+    std::cerr << Messages::error_prefix()
+              << Messages::error_lock_buffers_requires_benchmark() << std::endl;
+    return EXIT_FAILURE;
+  }
+
   // Error: Validate --only-bandwidth and --only-latency require --benchmark
   if (!config.run_benchmark && !config.run_patterns) {
     if (config.only_bandwidth || config.only_latency) {
@@ -154,6 +154,204 @@ namespace Constants {
   constexpr const char* GPU_WORK_PLAN_IDENTITY_VERSION =
       "gpu-work-plan-v1";
 
+  // Standalone kernel autotune mode. Candidates share one calibrated plan per
+  // target/operation so their medians compare identical work.
+  constexpr int KERNEL_AUTOTUNE_DEFAULT_ROUNDS = 5;
+  constexpr double KERNEL_AUTOTUNE_TARGET_SECONDS = 0.025;  // Per-candidate timed run
+  constexpr int KERNEL_AUTOTUNE_JSON_SCHEMA_VERSION = 1;
+  constexpr int KERNEL_AUTOTUNE_CACHE_VERSION = 1;
+  constexpr const char* KERNEL_AUTOTUNE_JSON_MODE_NAME = "autotune_kernels";
+  constexpr const char* KERNEL_AUTOTUNE_METHODOLOGY_VERSION =
+      "kernel-autotune-v1-shared-plan-rotated-median";
+  constexpr const char* KERNEL_AUTOTUNE_CACHE_RELATIVE_PATH =
+      "Library/Caches/memory_benchmark/kernel_autotune.json";  // Under $HOME
+  constexpr const char* KERNEL_AUTOTUNE_TUNED_KERNEL_NAME = "tuned";
+  constexpr const char* KERNEL_AUTOTUNE_CACHE_KERNEL_NAME = "neon-cache";
+
+  // Opt-in intra-pass bandwidth timeline. Workers publish cumulative bytes
+  // after each progress block into private cache lines; the coordinating
+  // thread samples them once per interval while the timer runs.
+  constexpr size_t BANDWIDTH_TIMELINE_PROGRESS_BLOCK_BYTES = 64 * 1024;  // Multiple of 32-byte granule
+  constexpr size_t BANDWIDTH_TIMELINE_SLOT_ISOLATION_BYTES = 128;  // Apple Silicon cache line
+  constexpr double BANDWIDTH_TIMELINE_SAMPLE_INTERVAL_SECONDS = 0.001;
+  constexpr size_t BANDWIDTH_TIMELINE_MIN_WINDOWS = 4;  // Fewer windows are reported unanalyzed
+  constexpr double BANDWIDTH_TIMELINE_PHASE_TOLERANCE = 0.05;  // Ramp/tail: below median by >5%
+  constexpr double BANDWIDTH_TIMELINE_TRANSITION_TOLERANCE = 0.10;  // Step vs. previous window
+
+  // Core frequency sentinel: a dependent add chain timed on every worker just
+  // before and after each timed region (~0.25 ms per probe at 4 GHz).
+  constexpr uint64_t CORE_FREQUENCY_PROBE_ADD_GROUPS = 65536;
+  constexpr uint64_t CORE_FREQUENCY_PROBE_ADDS_PER_GROUP = 16;  // Unroll of core_frequency_add_chain_asm
+  constexpr double CORE_FREQUENCY_PROBE_ADDS_PER_CYCLE = 1.0;  // Assumed dependent-add throughput
+  constexpr double CORE_FREQUENCY_DRIFT_WARNING_PCT = 5.0;  // Same measurement, across loops
+
+  // Standalone noisy-neighbor interference mode. Aggressors realize their duty
+  // cycle as a busy phase followed by an idle spin inside every period; victims
+  // reuse one baseline-calibrated plan at every duty level.
+  constexpr int NOISY_NEIGHBOR_DEFAULT_ROUNDS = 3;
+  constexpr unsigned long NOISY_NEIGHBOR_DEFAULT_BUFFER_SIZE_MB = 256;  // Per aggressor/victim buffer
+  constexpr int NOISY_NEIGHBOR_VICTIM_RESERVED_CORES = 2;  // Core-to-core victim runs two threads
+  constexpr double NOISY_NEIGHBOR_DUTY_PERIOD_SECONDS = 0.001;
+  constexpr size_t NOISY_NEIGHBOR_BURST_BYTES = 64 * 1024;  // Work between duty/stop checks
+  constexpr size_t NOISY_NEIGHBOR_ATOMIC_SHARED_LINES = 4;  // Contended by every atomic aggressor
+  constexpr size_t NOISY_NEIGHBOR_ATOMIC_LINE_BYTES = 128;  // Apple Silicon cache line
+  constexpr size_t NOISY_NEIGHBOR_ATOMIC_OPS_PER_BURST = 256;  // Contended RMWs are ~100x slower than streaming
+  constexpr double NOISY_NEIGHBOR_SETTLE_SECONDS = 0.020;  // Aggressors run before victims start
+  constexpr double NOISY_NEIGHBOR_VICTIM_TARGET_SECONDS = 0.100;  // Unloaded latency/bandwidth victim run
+  constexpr size_t NOISY_NEIGHBOR_LATENCY_PILOT_ACCESSES = 1000000;
+  constexpr size_t NOISY_NEIGHBOR_LATENCY_MAX_ACCESSES = 1000000000;
+  constexpr uint64_t NOISY_NEIGHBOR_RANDOM_SEED = 0x6e6f697379;  // Per-aggressor index seeds start here
+  constexpr const char* NOISY_NEIGHBOR_NT_WRITE_KERNEL = "generated-u4-w32-nt-pf0";
+  constexpr int NOISY_NEIGHBOR_JSON_SCHEMA_VERSION = 1;
+  constexpr const char* NOISY_NEIGHBOR_JSON_MODE_NAME = "noisy_neighbor";
+  constexpr const char* NOISY_NEIGHBOR_METHODOLOGY_VERSION =
+      "noisy-neighbor-v1-duty-cycled-aggressors-baseline-plan-rotated-median";
+
+  // Standalone per-core uniformity scan. Every slot runs identical fixed work
+  // so medians are directly comparable within a core class.
+  constexpr int CORE_SCAN_DEFAULT_ROUNDS = 3;
+  constexpr int CORE_SCAN_DEFAULT_CONCURRENCY = 1;  // Slots measured at once
+  constexpr size_t CORE_SCAN_LATENCY_ACCESSES = 2000000;  // Per latency measurement
+  constexpr size_t CORE_SCAN_BANDWIDTH_BYTES = 256 * 1024 * 1024;  // Payload per bandwidth measurement
+  constexpr double CORE_SCAN_OUTLIER_PCT = 10.0;  // Worse than the class median by more than this
+  constexpr size_t CORE_SCAN_MIN_CLASS_SLOTS = 3;  // Smaller classes have no meaningful median
+  constexpr int CORE_SCAN_JSON_SCHEMA_VERSION = 1;
+  constexpr const char* CORE_SCAN_JSON_MODE_NAME = "core_scan";
+  constexpr const char* CORE_SCAN_METHODOLOGY_VERSION =
+      "core-scan-v1-hinted-slots-fixed-work-class-median-outliers";
+
+  // Standalone worker-partitioning comparison. Every layout covers the same
+  // buffer with the same calibrated pass count; only granule ownership changes.
+  constexpr int PARTITION_COMPARE_DEFAULT_ROUNDS = 3;
+  constexpr unsigned long PARTITION_COMPARE_DEFAULT_BUFFER_SIZE_MB = 512;  // Shared by all workers
+  constexpr size_t PARTITION_COMPARE_MIN_GRANULE_KB = 4;  // One 16 KB page holds four granules
+  constexpr size_t PARTITION_COMPARE_MAX_GRANULE_KB = 2048;
+  constexpr uint64_t PARTITION_COMPARE_RANDOM_SEED = 0x7061727469;  // Random-assignment shuffle
+  constexpr int PARTITION_COMPARE_JSON_SCHEMA_VERSION = 1;
+  constexpr const char* PARTITION_COMPARE_JSON_MODE_NAME = "partition_compare";
+  constexpr const char* PARTITION_COMPARE_METHODOLOGY_VERSION =
+      "partition-compare-v1-fixed-passes-granule-layouts-rotated-median";
+
+  // Standalone thread-versus-process scaling. Both executors run the same
+  // per-worker chunks, pass count, and kernels behind a start barrier.
+  constexpr int MULTI_PROCESS_DEFAULT_ROUNDS = 3;
+  constexpr unsigned long MULTI_PROCESS_DEFAULT_BUFFER_SIZE_MB = 512;  // Split across workers
+  constexpr size_t MULTI_PROCESS_LATENCY_ACCESSES = 2000000;  // Per worker and measurement
+  constexpr int MULTI_PROCESS_CHILD_POLL_MICROSECONDS = 100;  // Parent barrier/exit polling
+  constexpr int MULTI_PROCESS_JSON_SCHEMA_VERSION = 1;
+  constexpr const char* MULTI_PROCESS_JSON_MODE_NAME = "multi_process";
+  constexpr const char* MULTI_PROCESS_METHODOLOGY_VERSION =
+      "multi-process-v1-shared-barrier-same-chunks-rotated-executor-median";
+
+  // Standalone inter-process transfer suite. A forked receiver takes a
+  // calibrated message stream from the parent over each mechanism.
+  constexpr int IPC_BANDWIDTH_DEFAULT_ROUNDS = 3;
+  constexpr size_t IPC_BANDWIDTH_MAX_MESSAGE_SIZE_KB = 262144;  // 256 MB
+  constexpr size_t IPC_BANDWIDTH_SHM_RING_BYTES = 1024 * 1024;
+  constexpr int IPC_BANDWIDTH_SOCKET_BUFFER_BYTES = 1024 * 1024;  // Best-effort SO_SNDBUF/SO_RCVBUF
+  constexpr size_t IPC_BANDWIDTH_MAX_MESSAGES = 100000000;
+  constexpr size_t IPC_BANDWIDTH_MIN_LATENCY_MESSAGES = 16;
+  constexpr size_t IPC_BANDWIDTH_MAX_LATENCY_MESSAGES = 10000;
+  constexpr size_t IPC_BANDWIDTH_PEER_CHECK_SPINS = 1024;  // Spins between peer-exit checks
+  constexpr int IPC_BANDWIDTH_JSON_SCHEMA_VERSION = 1;
+  constexpr const char* IPC_BANDWIDTH_JSON_MODE_NAME = "ipc_bandwidth";
+  constexpr const char* IPC_BANDWIDTH_METHODOLOGY_VERSION =
+      "ipc-bandwidth-v1-forked-receiver-calibrated-stream-shared-ack-rotated-median";
+
+  // Standalone page-cache file I/O mode. A warmed temporary file is read
+  // through each path and compared with the same kernels on anonymous memory.
+  constexpr int FILE_IO_DEFAULT_ROUNDS = 3;
+  constexpr unsigned long FILE_IO_DEFAULT_FILE_SIZE_MB = 256;
+  constexpr size_t FILE_IO_DEFAULT_BLOCK_KB = 64;
+  constexpr size_t FILE_IO_MIN_BLOCK_KB = 4;
+  constexpr size_t FILE_IO_MAX_BLOCK_KB = 16384;
+  constexpr size_t FILE_IO_READV_SEGMENTS = 4;  // Equal iovecs per readv() request
+  constexpr uint64_t FILE_IO_RANDOM_SEED = 0x66696c65696f;  // Random block order
+  constexpr int FILE_IO_JSON_SCHEMA_VERSION = 1;
+  constexpr const char* FILE_IO_JSON_MODE_NAME = "file_io";
+  constexpr const char* FILE_IO_METHODOLOGY_VERSION =
+      "file-io-v1-warm-page-cache-fixed-blocks-rotated-median-vs-anonymous";
+
+  // Standalone DRAM row-buffer probe mode. Pairs of lines are loaded and
+  // flushed to DRAM together; the pair latency separates same-row hits,
+  // different-bank misses, and same-bank row conflicts.
+  constexpr int ROW_BUFFER_DEFAULT_ROUNDS = 3;
+  constexpr unsigned long ROW_BUFFER_DEFAULT_BUFFER_SIZE_MB = 512;
+  constexpr int ROW_BUFFER_DEFAULT_ITERATIONS = 200;  // Flush+reload repetitions per sample
+  constexpr int ROW_BUFFER_DEFAULT_PAIRS = 1024;      // Cross-page pairs per run
+  constexpr int ROW_BUFFER_MAX_PAIRS = 65536;
+  constexpr size_t ROW_BUFFER_MIN_BIT_BYTES = 128;  // Lowest flipped offset; one Apple cache line
+  constexpr double ROW_BUFFER_MIN_SEPARATION = 4.0;     // Cluster gap in pooled standard deviations
+  constexpr double ROW_BUFFER_MIN_GAP_FRACTION = 0.05;  // Cluster gap relative to the low center
+  constexpr size_t ROW_BUFFER_MAX_FUNCTION_BITS = 3;    // Widest XOR mask tried for bank functions
+  constexpr size_t ROW_BUFFER_MIN_SAME_BANK_PAIRS = 16;  // Fewer conflict pairs fit almost any mask
+  constexpr double ROW_BUFFER_MIN_FUNCTION_SPLIT = 0.25;  // Different-bank pairs a mask must split
+  constexpr uint64_t ROW_BUFFER_PAIR_SEED = 0x726f77627566;  // Cross-page pair selection
+  constexpr int ROW_BUFFER_JSON_SCHEMA_VERSION = 1;
+  constexpr const char* ROW_BUFFER_JSON_MODE_NAME = "row_buffer";
+  constexpr const char* ROW_BUFFER_METHODOLOGY_VERSION =
+      "row-buffer-v1-flush-reload-pairs-two-means-median";
+
+  // Standalone linked-structure traversal mode. Every structure is one
+  // dependent chain: each operation's result selects the next operation.
+  constexpr int LINKED_DEFAULT_ROUNDS = 3;
+  constexpr unsigned long LINKED_DEFAULT_BUFFER_SIZE_MB = 256;  // Per structure
+  constexpr int LINKED_DEFAULT_OPERATIONS = 1000000;  // Dependent operations per sample
+  constexpr size_t LINKED_DEFAULT_PAYLOAD_BYTES = 64;
+  constexpr size_t LINKED_MAX_PAYLOAD_BYTES = 4096;
+  constexpr size_t LINKED_NODE_ALIGNMENT_BYTES = 16;  // Allocator-style list node granularity
+  constexpr size_t LINKED_DEFAULT_TREE_FANOUT = 15;  // Largest that fits the default node
+  constexpr size_t LINKED_MAX_TREE_FANOUT = 256;
+  constexpr size_t LINKED_DEFAULT_TREE_NODE_BYTES = 256;
+  constexpr size_t LINKED_MAX_TREE_NODE_BYTES = 65536;
+  constexpr double LINKED_DEFAULT_LOAD_FACTOR = 0.75;
+  constexpr double LINKED_MAX_LOAD_FACTOR = 0.95;
+  constexpr size_t LINKED_HASH_SLOT_BYTES = 16;  // 8-byte key and 8-byte value
+  constexpr int LINKED_JSON_SCHEMA_VERSION = 1;
+  constexpr const char* LINKED_JSON_MODE_NAME = "linked_structures";
+  constexpr const char* LINKED_METHODOLOGY_VERSION =
+      "linked-structures-v1-seeded-chain-order-dependent-operations-rotated-median";
+
+  // Standalone workload mode. A workload file describes thread groups whose
+  // workers interleave weighted slices of several access streams.
+  constexpr int WORKLOAD_DEFAULT_ROUNDS = 3;
+  constexpr int WORKLOAD_DEFAULT_SAMPLE_MS = 250;  // Busy time each worker spends per sample
+  constexpr int WORKLOAD_MAX_SAMPLE_MS = 60000;
+  constexpr size_t WORKLOAD_SLICE_BYTES = 64 * 1024;  // Payload of one bandwidth-stream slice
+  constexpr size_t WORKLOAD_ACCESS_BYTES = 32;  // Strided, random, and Zipf access size
+  constexpr size_t WORKLOAD_CHASE_STRIDE_BYTES = 256;  // Pointer-chain node spacing
+  constexpr size_t WORKLOAD_INDEX_STREAM_ACCESSES = 256 * 1024;  // Per worker and random stream
+  constexpr int WORKLOAD_MAX_TOTAL_THREADS = 256;
+  constexpr size_t WORKLOAD_MAX_STREAMS_PER_GROUP = 16;
+  constexpr unsigned WORKLOAD_MAX_WEIGHT = 1000;
+  constexpr size_t WORKLOAD_MAX_FILE_BYTES = 64 * 1024;
+  constexpr int WORKLOAD_JSON_SCHEMA_VERSION = 1;
+  constexpr const char* WORKLOAD_JSON_MODE_NAME = "workload";
+  constexpr const char* WORKLOAD_METHODOLOGY_VERSION =
+      "workload-v1-weighted-slice-schedule-busy-time-bounded-median";
+
+  // Standalone trace replay mode. A binary address trace is packed into one
+  // buffer page by page and replayed by one worker per traced thread.
+  constexpr int TRACE_REPLAY_DEFAULT_ROUNDS = 5;
+  constexpr int TRACE_REPLAY_DEFAULT_SAMPLE_MS = 100;  // Minimum wall time of one timed replay
+  constexpr int TRACE_REPLAY_MAX_SAMPLE_MS = 60000;
+  constexpr int TRACE_REPLAY_MAX_PASSES = 1 << 20;
+  constexpr char TRACE_REPLAY_MAGIC[] = "MBTRACE1";  // First 8 file bytes, no terminator
+  constexpr size_t TRACE_REPLAY_MAGIC_BYTES = 8;
+  constexpr size_t TRACE_REPLAY_HEADER_BYTES = 32;
+  constexpr uint32_t TRACE_REPLAY_FORMAT_VERSION = 1;
+  constexpr unsigned TRACE_REPLAY_MAX_SIZE_LOG2 = 6;  // Largest access: 64 bytes
+  constexpr uint64_t TRACE_REPLAY_MAX_RECORDS = 64ULL * 1024ULL * 1024ULL;
+  constexpr size_t TRACE_REPLAY_MAX_THREADS = 256;
+  constexpr size_t TRACE_REPLAY_PAGE_BYTES = 16 * 1024;  // Remap granularity (Apple Silicon page)
+  constexpr size_t TRACE_REPLAY_MAX_BUFFER_BYTES = 16ULL * 1024ULL * BYTES_PER_MB;
+  constexpr size_t TRACE_REPLAY_DECODE_WINDOW_BYTES = 64 * BYTES_PER_MB;  // Released behind the decoder
+  constexpr uint64_t TRACE_REPLAY_CONTROL_SEED = 0x7472616365;  // Shuffled-order control
+  constexpr int TRACE_REPLAY_JSON_SCHEMA_VERSION = 1;
+  constexpr const char* TRACE_REPLAY_JSON_MODE_NAME = "trace_replay";
+  constexpr const char* TRACE_REPLAY_METHODOLOGY_VERSION =
+      "trace-replay-v1-page-packed-per-thread-shuffled-control-alternating-median";
+
   constexpr double BENCHMARK_LATENCY_TARGET_SECONDS = 0.250;
   constexpr double BENCHMARK_LATENCY_CALIBRATION_MIN_SECONDS = 0.100;
   constexpr double BENCHMARK_LATENCY_CALIBRATION_MAX_SECONDS = 0.300;
@@ -165,6 +363,8 @@ namespace Constants {
       "benchmark-v2-calibrated-seeded-balanced";
   constexpr size_t DEFAULT_SWEEP_MAX_RUNS = 256;  // Default guardrail for generated sweep combinations
   constexpr size_t DEFAULT_ANALYZE_TLB_SWEEP_MAX_RUNS = 16;  // Safer standalone TLB Cartesian sweep limit
+  constexpr size_t DEFAULT_TLB_CHAIN_LAYOUTS = 0;  // Rebuild a fresh chain layout for every TLB round
+  constexpr size_t MAX_TLB_CHAIN_LAYOUTS = 64;  // Upper bound for reused TLB chain layouts per point
 
   // Core-to-core standalone mode constants
   constexpr size_t CORE_TO_CORE_SHARED_STATE_ISOLATION_BYTES =
@@ -207,6 +407,7 @@ namespace Constants {
   
   // Bandwidth calculation constants
   constexpr double NANOSECONDS_PER_SECOND = 1e9;  // Conversion factor for GB/s calculations
+  constexpr double MICROSECONDS_PER_SECOND = 1e6;  // Conversion factor for microsecond latencies
   constexpr int COPY_OPERATION_MULTIPLIER = 2;  // Copy = read + write
   
   // Output formatting precision constants
@@ -236,8 +437,20 @@ namespace Constants {
       BANDWIDTH_CALIBRATION_MIN_PILOT_BYTES;
   constexpr size_t PATTERN_CALIBRATION_MAX_PASSES =
       BANDWIDTH_CALIBRATION_MAX_PASSES;
+  constexpr size_t PATTERN_GATHER_ELEMENT_BYTES = 8;  // Bytes per gathered/scattered element
+  constexpr size_t PATTERN_GATHER_GROUP_INDICES = 8;  // Indices consumed per gather/scatter kernel group
   constexpr size_t PATTERN_RANDOM_ACCESS_MIN = 1000;  // Minimum number of random accesses
   constexpr size_t PATTERN_RANDOM_ACCESS_MAX = 1000000;  // Maximum number of random accesses
+  constexpr double PATTERN_ZIPF_DEFAULT_THETA = 0.99;  // YCSB-style Zipf skew exponent
+  constexpr double PATTERN_ZIPF_MAX_THETA = 4.0;  // Largest accepted --zipf-theta
+  constexpr double PATTERN_HOT_DEFAULT_FRACTION = 0.10;  // Share of slots in the hot set
+  constexpr double PATTERN_HOT_DEFAULT_PROBABILITY = 0.90;  // Share of accesses drawn from the hot set
+  constexpr size_t PATTERN_SHIFTING_HOT_SET_PHASES = 4;  // Disjoint hot-set positions per shifting stream
+  constexpr size_t PATTERN_MATRIX_ELEMENT_BYTES = 8;  // Matrix element size (one double)
+  constexpr size_t PATTERN_MATRIX_DEFAULT_ROW_BYTES = 8192;  // Logical row width: 1024 doubles
+  constexpr size_t PATTERN_MATRIX_DEFAULT_TILE_ELEMENTS = 32;  // Square tile edge in elements
+  constexpr size_t PATTERN_MATRIX_TILE_ELEMENT_MULTIPLE = 4;  // Tile rows stay whole 32-byte accesses
+  constexpr size_t PATTERN_MATRIX_MAX_TILE_ELEMENTS = 1024;  // Largest accepted --matrix-tile
   constexpr double PATTERN_MIN_TIME_NS = 1e-9;  // Minimum time for bandwidth calculation (nanoseconds)
   constexpr int PATTERN_PERCENTAGE_PRECISION = 1;  // Decimal places for percentage values
   constexpr int PATTERN_BANDWIDTH_PRECISION = 3;  // Decimal places for bandwidth values in pattern results
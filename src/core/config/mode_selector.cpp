@@ -22,12 +22,23 @@ struct ModeOption {
   const char* long_option;
 };
 
-constexpr std::array<ModeOption, 5> kModeOptions{{
+constexpr std::array<ModeOption, 16> kModeOptions{{
     {PrimaryBenchmarkMode::Standard, "-B", "--benchmark"},
     {PrimaryBenchmarkMode::Patterns, "-P", "--patterns"},
     {PrimaryBenchmarkMode::AnalyzeTlb, "-T", "--analyze-tlb"},
     {PrimaryBenchmarkMode::AnalyzeCoreToCore, "-C", "--analyze-core2core"},
     {PrimaryBenchmarkMode::GpuBandwidth, "-G", "--gpu-bandwidth"},
+    {PrimaryBenchmarkMode::AutotuneKernels, "-A", "--autotune-kernels"},
+    {PrimaryBenchmarkMode::NoisyNeighbor, "-N", "--noisy-neighbor"},
+    {PrimaryBenchmarkMode::CoreScan, "-U", "--core-scan"},
+    {PrimaryBenchmarkMode::PartitionCompare, "-I", "--partition-compare"},
+    {PrimaryBenchmarkMode::MultiProcess, "-F", "--multi-process"},
+    {PrimaryBenchmarkMode::IpcBandwidth, "-E", "--ipc-bandwidth"},
+    {PrimaryBenchmarkMode::FileIo, "-R", "--file-io"},
+    {PrimaryBenchmarkMode::RowBuffer, "-Q", "--row-buffer"},
+    {PrimaryBenchmarkMode::LinkedStructures, "-K", "--linked-structures"},
+    {PrimaryBenchmarkMode::Workload, "-Y", "--workload"},
+    {PrimaryBenchmarkMode::TraceReplay, "-Z", "--trace-replay"},
 }};
 
 }  // namespace
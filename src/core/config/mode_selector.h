@@ -24,6 +24,17 @@ enum class PrimaryBenchmarkMode {
   AnalyzeTlb,
   AnalyzeCoreToCore,
   GpuBandwidth,
+  AutotuneKernels,
+  NoisyNeighbor,
+  CoreScan,
+  PartitionCompare,
+  MultiProcess,
+  IpcBandwidth,
+  FileIo,
+  RowBuffer,
+  LinkedStructures,
+  Workload,
+  TraceReplay,
   Conflict,
 };
 
@@ -194,3 +194,41 @@ MmapPtr allocate_buffer_non_cacheable(size_t size, const char* buffer_name) {
   
   return buffer_ptr;  // Return valid pointer on success
 }
+
+/**
+ * @brief Allocates an anonymous mapping that forked children share with the parent.
+ *
+ * Same validation, error reporting, and MADV_WILLNEED hint as allocate_buffer();
+ * only the sharing flag differs.
+ *
+ * @param[in] size         Size of the buffer to allocate in bytes. Must be non-zero.
+ * @param[in] buffer_name  Descriptive name for the buffer (used in error messages).
+ *
+ * @return MmapPtr smart pointer managing the parent's view of the mapping
+ * @return nullptr if allocation fails (size is 0 or mmap fails)
+ *
+ * @see allocate_buffer() for process-private allocation
+ */
+MmapPtr allocate_shared_buffer(size_t size, const char* buffer_name) {
+  if (size == 0) {
+    std::cerr << Messages::error_prefix() << Messages::error_buffer_size_zero(buffer_name) << std::endl;
+    return MmapPtr(nullptr, MmapDeleter{0});
+  }
+
+  void *ptr = active_memory_system_calls.map(
+      nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (ptr == MAP_FAILED) {
+    std::cerr << Messages::error_prefix() << Messages::error_mmap_failed(buffer_name)
+              << ": " << strerror(errno) << std::endl;
+    return MmapPtr(nullptr, MmapDeleter{0});
+  }
+
+  MmapPtr buffer_ptr(ptr, MmapDeleter{size, active_memory_system_calls.unmap});
+  // Non-fatal, as in allocate_buffer().
+  if (active_memory_system_calls.advise(ptr, size, MADV_WILLNEED) == -1) {
+    std::cerr << Messages::error_prefix() << Messages::error_madvise_failed(buffer_name)
+              << ": " << strerror(errno) << std::endl;
+  }
+
+  return buffer_ptr;
+}
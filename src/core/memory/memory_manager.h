@@ -132,4 +132,19 @@ MmapPtr allocate_buffer(size_t size, const char* buffer_name = "buffer");
  */
 MmapPtr allocate_buffer_non_cacheable(size_t size, const char* buffer_name = "buffer");
 
+/**
+ * @brief Allocate an anonymous mapping shared with child processes
+ * @param size Size of the buffer to allocate in bytes (must be > 0)
+ * @param buffer_name Name of the buffer (used in error messages for clarity)
+ * @return MmapPtr that will automatically free the memory on destruction (RAII)
+ * @return nullptr (empty unique_ptr) if allocation fails or size is 0
+ *
+ * Uses MAP_SHARED | MAP_ANONYMOUS, so processes forked after the allocation see
+ * the same physical pages at the same address. This is the macOS counterpart of
+ * a memfd mapping inherited across fork().
+ *
+ * @note Each process that inherits the mapping unmaps its own view on exit.
+ */
+MmapPtr allocate_shared_buffer(size_t size, const char* buffer_name = "buffer");
+
 #endif // MEMORY_MANAGER_H
@@ -127,6 +127,22 @@ void reorder_indices_with_mode(std::vector<size_t>& indices,
   indices.swap(reordered_indices);
 }
 
+// Visiting order of `node_count` nodes: a global shuffle, or the mode's box
+// order for a resolved locality mode. Shared by every seeded chain layout.
+std::vector<size_t> order_chain_indices(size_t node_count,
+                                        size_t locality_node_span,
+                                        LatencyChainMode effective_mode,
+                                        std::mt19937_64& rng) {
+  std::vector<size_t> indices(node_count);
+  std::iota(indices.begin(), indices.end(), 0);
+  if (effective_mode == LatencyChainMode::GlobalRandom) {
+    std::shuffle(indices.begin(), indices.end(), rng);
+  } else {
+    reorder_indices_with_mode(indices, locality_node_span, effective_mode, rng);
+  }
+  return indices;
+}
+
 }  // namespace
 
 void set_memory_utils_test_hooks(const MemoryUtilsTestHooks* hooks) {
@@ -156,6 +172,19 @@ const char* latency_chain_mode_to_string(LatencyChainMode mode) {
   return "auto";
 }
 
+const char* memory_kernel_variant_to_string(MemoryKernelVariant variant) {
+  switch (variant) {
+    case MemoryKernelVariant::Neon:
+      return "neon";
+    case MemoryKernelVariant::Generated:
+      return "generated";
+    case MemoryKernelVariant::Tuned:
+      return "tuned";
+  }
+
+  return "neon";
+}
+
 bool latency_chain_mode_from_string(const std::string& mode_value, LatencyChainMode& out_mode) {
   const std::string normalized = normalize_mode_token(mode_value);
 
@@ -306,10 +335,16 @@ static int setup_latency_chain_impl(void *buffer, size_t buffer_size, size_t str
         return EXIT_FAILURE;
     }
 
-    // Create a vector to store the indices of pointer locations.
-    std::vector<size_t> indices(num_pointers);
-    // Fill indices vector with 0, 1, 2, ..., num_pointers - 1.
-    std::iota(indices.begin(), indices.end(), 0);
+    size_t locality_pointer_span = 0;
+    if (effective_mode != LatencyChainMode::GlobalRandom) {
+        locality_pointer_span = tlb_locality_bytes / stride;
+        if (locality_pointer_span < 2) {
+            std::cerr << Messages::error_prefix()
+                      << Messages::error_buffer_stride_invalid_latency_chain(locality_pointer_span, tlb_locality_bytes, stride)
+                      << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
 
     // Initialize random number generator.
     std::mt19937_64 g;
@@ -321,20 +356,8 @@ static int setup_latency_chain_impl(void *buffer, size_t buffer_size, size_t str
         std::random_device rd;
         g.seed(rd());
     }
-    if (effective_mode == LatencyChainMode::GlobalRandom) {
-        // Randomly shuffle the full index space.
-        std::shuffle(indices.begin(), indices.end(), g);
-    } else {
-        const size_t locality_pointer_span = tlb_locality_bytes / stride;
-        if (locality_pointer_span < 2) {
-            std::cerr << Messages::error_prefix()
-                      << Messages::error_buffer_stride_invalid_latency_chain(locality_pointer_span, tlb_locality_bytes, stride)
-                      << std::endl;
-            return EXIT_FAILURE;
-        }
-
-        reorder_indices_with_mode(indices, locality_pointer_span, effective_mode, g);
-    }
+    const std::vector<size_t> indices =
+        order_chain_indices(num_pointers, locality_pointer_span, effective_mode, g);
 
     // Get a base pointer to the buffer.
     char *base_ptr = static_cast<char *>(buffer);
@@ -399,6 +422,20 @@ static int setup_latency_chain_impl(void *buffer, size_t buffer_size, size_t str
     return EXIT_SUCCESS;
 }
 
+std::vector<size_t> build_latency_chain_order(size_t node_count,
+                                              size_t locality_node_span,
+                                              LatencyChainMode mode,
+                                              uint64_t deterministic_seed) {
+    const LatencyChainMode effective_mode =
+        resolve_latency_chain_mode(mode, locality_node_span);
+    if (node_count < 2 ||
+        (effective_mode != LatencyChainMode::GlobalRandom && locality_node_span < 2)) {
+        return {};
+    }
+    std::mt19937_64 g(deterministic_seed);
+    return order_chain_indices(node_count, locality_node_span, effective_mode, g);
+}
+
 int setup_latency_chain(void* buffer, size_t buffer_size, size_t stride,
                         size_t tlb_locality_bytes,
                         LatencyChainDiagnostics* diagnostics,
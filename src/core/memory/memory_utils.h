@@ -38,6 +38,7 @@
 #include <cstddef>  // size_t
 #include <cstdint>  // uintptr_t
 #include <string>
+#include <vector>
 #include "core/config/constants.h"
 
 /**
@@ -57,6 +58,21 @@ enum class LatencyChainMode {
  */
 const char* latency_chain_mode_to_string(LatencyChainMode mode);
 
+/**
+ * @enum MemoryKernelVariant
+ * @brief Instruction-set family of the main-memory bandwidth kernels
+ */
+enum class MemoryKernelVariant {
+  Neon = 0,
+  Generated,  ///< Template-generated NEON matrix selected by name with --kernel
+  Tuned,      ///< Per-operation winners of --autotune-kernels, selected with --kernel tuned
+};
+
+/**
+ * @brief Convert a kernel variant to its canonical JSON/console string.
+ */
+const char* memory_kernel_variant_to_string(MemoryKernelVariant variant);
+
 /**
  * @brief Parse latency-chain mode string.
  * @return true when parsing succeeds, false otherwise.
@@ -158,6 +174,22 @@ int setup_latency_chain(void* buffer, size_t buffer_size, size_t stride,
                         LatencyChainMode mode,
                         uint64_t deterministic_seed);
 
+/**
+ * @brief Seeded node visiting order used by the pointer-chain builder.
+ * @param node_count Number of nodes to order; at least two.
+ * @param locality_node_span Nodes per locality window (0 = none, as `tlb_locality_bytes / stride`).
+ * @param mode Chain construction policy, resolved like setup_latency_chain().
+ * @param deterministic_seed Shuffle seed.
+ * @return A permutation of `[0, node_count)`, empty for invalid input.
+ *
+ * The seeded setup_latency_chain() overload links nodes in exactly this
+ * order, so other linked layouts built from the same seed share its shape.
+ */
+std::vector<size_t> build_latency_chain_order(size_t node_count,
+                                              size_t locality_node_span,
+                                              LatencyChainMode mode,
+                                              uint64_t deterministic_seed);
+
 /**
  * @brief Initialize data buffers with test data
  * @param src_buffer Pointer to source buffer
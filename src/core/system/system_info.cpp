@@ -314,6 +314,36 @@ size_t get_l2_cache_size() {
   return get_l2_cache_size(default_system_info_provider());
 }
 
+// Gets the L1 data cache size for efficiency cores (perflevel1). Hosts without
+// a second performance level have no such key, which is not a failure, so no
+// fallback or warning applies.
+size_t get_efficiency_l1_cache_size(const SystemInfoProvider& provider) {
+  size_t l1_size = 0;
+  size_t len = sizeof(l1_size);
+  if (provider.query_sysctl("hw.perflevel1.l1dcachesize", &l1_size, &len) == 0) {
+    return l1_size;
+  }
+  return 0;
+}
+
+size_t get_efficiency_l1_cache_size() {
+  return get_efficiency_l1_cache_size(default_system_info_provider());
+}
+
+// Gets the L2 cache size for efficiency cores (perflevel1); 0 when absent.
+size_t get_efficiency_l2_cache_size(const SystemInfoProvider& provider) {
+  size_t l2_size = 0;
+  size_t len = sizeof(l2_size);
+  if (provider.query_sysctl("hw.perflevel1.l2cachesize", &l2_size, &len) == 0) {
+    return l2_size;
+  }
+  return 0;
+}
+
+size_t get_efficiency_l2_cache_size() {
+  return get_efficiency_l2_cache_size(default_system_info_provider());
+}
+
 // Gets the macOS version string using sysctl.
 std::string get_macos_version(const SystemInfoProvider& provider) {
   return read_sysctl_string(provider, "kern.osproductversion");
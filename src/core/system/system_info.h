@@ -147,6 +147,24 @@ size_t get_l2_cache_size();
 /** @brief Provider-injected overload of `get_l2_cache_size()`. */
 size_t get_l2_cache_size(const SystemInfoProvider& provider);
 
+/**
+ * @brief Get L1 data cache size for efficiency cores
+ * @return L1 data cache size in bytes, or 0 when the host reports no efficiency cores
+ */
+size_t get_efficiency_l1_cache_size();
+
+/** @brief Provider-injected overload of `get_efficiency_l1_cache_size()`. */
+size_t get_efficiency_l1_cache_size(const SystemInfoProvider& provider);
+
+/**
+ * @brief Get L2 cache size for efficiency cores
+ * @return L2 cache size in bytes, or 0 when the host reports no efficiency cores
+ */
+size_t get_efficiency_l2_cache_size();
+
+/** @brief Provider-injected overload of `get_efficiency_l2_cache_size()`. */
+size_t get_efficiency_l2_cache_size(const SystemInfoProvider& provider);
+
 /**
  * @brief Get macOS version string
  * @return macOS version as string (e.g., "14.2.1")
@@ -0,0 +1,129 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file core_scan_messages.cpp
+ * @brief Message helpers for standalone core-scan mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <iomanip>
+#include <sstream>
+
+#include "core/config/constants.h"
+#include "messages_api.h"
+
+namespace Messages {
+
+const std::string& error_core_scan_must_be_used_alone() {
+  static const std::string msg =
+      "--core-scan allows only optional -o/--output <file>, -r/--count <rounds>, and "
+      "--scan-concurrency <count>; -h/--help prints help";
+  return msg;
+}
+
+std::string error_core_scan_failed(const std::string& reason) {
+  return "Core scan failed: " + reason;
+}
+
+const std::string& msg_running_core_scan() {
+  static const std::string msg = "\nRunning standalone per-core uniformity scan...";
+  return msg;
+}
+
+std::string msg_core_scan_plan(size_t slot_count, size_t batch_count, int concurrency, int rounds) {
+  std::ostringstream oss;
+  oss << "  " << slot_count << " slots in " << batch_count << " batches (up to " << concurrency
+      << " concurrent) x " << rounds << " rounds";
+  return oss.str();
+}
+
+std::string msg_core_scan_batch(size_t batch, size_t batch_count, const std::string& core_class,
+                                size_t slot_count) {
+  std::ostringstream oss;
+  oss << "  batch " << batch << "/" << batch_count << " [" << core_class << "] " << slot_count
+      << (slot_count == 1 ? " slot" : " slots");
+  return oss.str();
+}
+
+const std::string& report_core_scan_header() {
+  static const std::string msg = "--- Per-Core Uniformity Scan ---";
+  return msg;
+}
+
+std::string report_core_scan_placement_note(double outlier_threshold_pct) {
+  std::ostringstream oss;
+  oss << "Slots are QoS-class and affinity-tag hints, not pinned cores; '*' marks a value more than "
+      << outlier_threshold_pct << "% worse than its class median.";
+  return oss.str();
+}
+
+const std::string& report_core_scan_table_header() {
+  static const std::string msg =
+      "  slot class        L1 lat ns   L2 lat ns  L1 rd GB/s  L1 wr GB/s  L2 rd GB/s  L2 wr GB/s";
+  return msg;
+}
+
+std::string report_core_scan_slot_label(int slot, const std::string& core_class) {
+  std::ostringstream oss;
+  oss << "  " << std::right << std::setw(4) << slot << " " << std::left << std::setw(12)
+      << core_class;
+  return oss.str();
+}
+
+std::string report_core_scan_class_label(const std::string& core_class) {
+  std::ostringstream oss;
+  oss << "  " << std::left << std::setw(17) << core_class + " median";
+  return oss.str();
+}
+
+std::string report_core_scan_class_not_comparable(const std::string& core_class,
+                                                  size_t measured_slots) {
+  return "  " + core_class + " class has " + std::to_string(measured_slots) +
+         " measured slots; at least " + std::to_string(Constants::CORE_SCAN_MIN_CLASS_SLOTS) +
+         " are needed to flag outliers.";
+}
+
+std::string report_core_scan_cell(double value, bool outlier) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(2) << std::right << std::setw(11) << value
+      << (outlier ? "*" : " ");
+  return oss.str();
+}
+
+const std::string& report_core_scan_unmeasured_cells() {
+  static const std::string msg = "  not measured";
+  return msg;
+}
+
+std::string report_core_scan_outlier(int slot,
+                                     const std::string& core_class,
+                                     const std::string& metric,
+                                     double deviation_pct) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(1);
+  oss << "  Outlier: slot " << slot << " (" << core_class << ") " << metric << " is "
+      << deviation_pct << "% worse than the class median";
+  return oss.str();
+}
+
+const std::string& report_core_scan_no_outliers() {
+  static const std::string msg = "  No outlier slots.";
+  return msg;
+}
+
+}  // namespace Messages
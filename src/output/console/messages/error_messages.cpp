@@ -129,6 +129,15 @@ std::string error_latency_chain_mode_invalid() {
   return "latency-chain-mode invalid (must be one of: auto, global-random, random-box, same-random-in-box, diff-random-in-box)";
 }
 
+std::string error_kernel_name_invalid() {
+  return "kernel invalid (must be neon or generated-u<2|4|8>-w<16|32>-<t|nt>-pf<0|512>)";
+}
+
+
+std::string error_kernel_tuned_unavailable(const std::string& reason) {
+  return "--kernel tuned requires a prior --autotune-kernels run on this machine (" + reason + ")";
+}
+
 std::string error_latency_chain_mode_requires_locality(const std::string& mode_name) {
   return "latency-chain-mode '" + mode_name + "' requires --latency-tlb-locality-kb > 0";
 }
@@ -165,9 +174,15 @@ std::string error_threads_invalid(long long value, long long min_val, long long
   return oss.str();
 }
 
+std::string error_tlb_chain_layouts_invalid(size_t max_layouts) {
+  std::ostringstream oss;
+  oss << "tlb-chain-layouts invalid (must be between 0 and " << max_layouts << ")";
+  return oss.str();
+}
+
 const std::string& error_analyze_tlb_must_be_used_alone() {
   static const std::string msg =
-      "--analyze-tlb allows only optional -o/--output <file>, -s/--latency-stride-bytes <bytes>, -m/--latency-chain-mode <mode>, -D/--tlb-density <low|medium|high>, --seed <uint64>, -S/--sweep <key=...>, and -X/--sweep-max-runs <count> (no other options allowed)";
+      "--analyze-tlb allows only optional -o/--output <file>, -s/--latency-stride-bytes <bytes>, -m/--latency-chain-mode <mode>, -D/--tlb-density <low|medium|high>, --seed <uint64>, --tlb-chain-layouts <count>, -S/--sweep <key=...>, and -X/--sweep-max-runs <count> (no other options allowed)";
   return msg;
 }
 
@@ -407,6 +422,64 @@ const std::string& error_only_flags_with_patterns() {
   return msg;
 }
 
+const std::string& error_kernel_requires_bandwidth_mode() {
+  static const std::string msg = "--kernel requires --benchmark or --patterns and cannot be used with --only-latency";
+  return msg;
+}
+
+const std::string& error_bandwidth_timeline_requires_benchmark() {
+  static const std::string msg = "--bandwidth-timeline requires --benchmark and cannot be used with --only-latency";
+  return msg;
+}
+
+const std::string& error_lock_buffers_requires_benchmark() {
+  static const std::string msg = "--lock-buffers requires --benchmark";
+  return msg;
+}
+
+const std::string& error_pattern_skew_requires_patterns() {
+  static const std::string msg = "--zipf-theta, --hot-fraction, and --hot-probability require --patterns";
+  return msg;
+}
+
+std::string error_zipf_theta_invalid(double max_theta) {
+  std::ostringstream oss;
+  oss << "Zipf theta must be greater than 0 and at most " << max_theta;
+  return oss.str();
+}
+
+const std::string& error_hot_fraction_invalid() {
+  static const std::string msg = "Hot fraction must be greater than 0 and less than 1";
+  return msg;
+}
+
+const std::string& error_hot_probability_invalid() {
+  static const std::string msg = "Hot probability must be greater than 0 and at most 1";
+  return msg;
+}
+
+const std::string& error_pattern_matrix_requires_patterns() {
+  static const std::string msg = "--matrix-row-bytes, --matrix-pitch, and --matrix-tile require --patterns";
+  return msg;
+}
+
+const std::string& error_matrix_row_bytes_invalid() {
+  static const std::string msg = "Matrix row bytes must be a positive multiple of the tile width (--matrix-tile x 8 bytes)";
+  return msg;
+}
+
+const std::string& error_matrix_pitch_invalid() {
+  static const std::string msg = "Matrix pitch must be a multiple of 32 bytes and at least the matrix row bytes";
+  return msg;
+}
+
+std::string error_matrix_tile_invalid(size_t multiple, size_t max_elements) {
+  std::ostringstream oss;
+  oss << "Matrix tile must be a multiple of " << multiple << " elements and at most "
+      << max_elements;
+  return oss.str();
+}
+
 const std::string& error_only_bandwidth_with_cache_size() {
   static const std::string msg = "--only-bandwidth cannot be used with --cache-size (cache-size is only relevant for latency tests)";
   return msg;
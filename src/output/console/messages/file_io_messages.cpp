@@ -0,0 +1,106 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file file_io_messages.cpp
+ * @brief Message helpers for standalone file I/O mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <iomanip>
+#include <sstream>
+
+#include "messages_api.h"
+
+namespace Messages {
+
+const std::string& error_file_io_must_be_used_alone() {
+  static const std::string msg =
+      "--file-io allows only optional -o/--output <file>, -r/--count <rounds>, "
+      "-b/--buffer-size <MB>, --file-dir <dir>, and --io-block <KB>; -h/--help prints help";
+  return msg;
+}
+
+std::string error_file_io_block_invalid(size_t block_kb, unsigned long file_size_mb) {
+  std::ostringstream oss;
+  oss << "Invalid --io-block " << block_kb
+      << " KB: expected a power of two from 4 to 16384 KB no larger than the " << file_size_mb
+      << " MB file";
+  return oss.str();
+}
+
+std::string error_file_io_failed(const std::string& reason) {
+  return "File I/O measurement failed: " + reason;
+}
+
+std::string msg_running_file_io(const std::string& file_path,
+                                unsigned long file_size_mb,
+                                size_t block_bytes) {
+  std::ostringstream oss;
+  oss << "\nRunning standalone page-cache file I/O comparison (" << file_size_mb << " MB file, "
+      << block_bytes / 1024 << " KB blocks)...\n  File: " << file_path;
+  return oss.str();
+}
+
+std::string msg_file_io_plan(const std::string& method, const std::string& access,
+                             size_t passes) {
+  std::ostringstream oss;
+  oss << "  " << std::left << std::setw(11) << method << std::setw(11) << access << passes
+      << (passes == 1 ? " pass" : " passes") << " per round";
+  return oss.str();
+}
+
+const std::string& report_file_io_header() {
+  static const std::string msg = "--- Page-Cache File I/O ---";
+  return msg;
+}
+
+const std::string& report_file_io_note() {
+  static const std::string msg =
+      "The file is warm in the page cache. memory runs the same read kernels on anonymous pages; "
+      "mmap paths read every byte, while pread/readv count bytes copied into a reused block "
+      "buffer. Overhead is extra time per byte over memory for the same access order. "
+      "io_uring is Linux-only and not measured.";
+  return msg;
+}
+
+const std::string& report_file_io_table_header() {
+  static const std::string msg =
+      "  method     access          GB/s   overhead ns/B   vs memory";
+  return msg;
+}
+
+std::string report_file_io_row(const std::string& method,
+                               const std::string& access,
+                               double gb_s,
+                               double overhead_ns_per_byte,
+                               double vs_memory_pct,
+                               bool baseline) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(2);
+  oss << "  " << std::left << std::setw(11) << method << std::setw(11) << access << std::right
+      << std::setw(9) << gb_s;
+  if (baseline) {
+    oss << std::setw(16) << "baseline";
+  } else {
+    oss << std::setprecision(4) << std::setw(16) << overhead_ns_per_byte << std::setprecision(1)
+        << std::setw(11) << std::showpos << vs_memory_pct << "%";
+  }
+  return oss.str();
+}
+
+}  // namespace Messages
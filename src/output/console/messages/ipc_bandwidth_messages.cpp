@@ -0,0 +1,124 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file ipc_bandwidth_messages.cpp
+ * @brief Message helpers for standalone IPC bandwidth mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <iomanip>
+#include <sstream>
+
+#include "messages_api.h"
+
+namespace Messages {
+
+namespace {
+
+std::string format_ipc_message_size(size_t message_bytes) {
+  constexpr size_t kKb = 1024;
+  constexpr size_t kMb = kKb * kKb;
+  std::ostringstream oss;
+  if (message_bytes >= kMb && message_bytes % kMb == 0) {
+    oss << message_bytes / kMb << " MB";
+  } else {
+    oss << message_bytes / kKb << " KB";
+  }
+  return oss.str();
+}
+
+}  // namespace
+
+const std::string& error_ipc_bandwidth_must_be_used_alone() {
+  static const std::string msg =
+      "--ipc-bandwidth allows only optional -o/--output <file>, -r/--count <rounds>, "
+      "--ipc-methods <name,...>, and --message-size <KB,...>; -h/--help prints help";
+  return msg;
+}
+
+std::string error_ipc_methods_invalid(const std::string& value) {
+  return "Invalid --ipc-methods '" + value +
+         "': expected distinct names from shm-ring, pipe, unix-socket, mmap-handoff";
+}
+
+std::string error_ipc_message_sizes_invalid(const std::string& value) {
+  return "Invalid --message-size '" + value +
+         "': expected distinct sizes in KB from 1 to 262144, e.g. 4,64,1024";
+}
+
+std::string error_ipc_bandwidth_failed(const std::string& reason) {
+  return "IPC bandwidth measurement failed: " + reason;
+}
+
+std::string msg_running_ipc_bandwidth(size_t row_count, int rounds) {
+  std::ostringstream oss;
+  oss << "\nRunning standalone inter-process transfer suite (" << row_count
+      << (row_count == 1 ? " method/size pair" : " method/size pairs") << " x " << rounds
+      << (rounds == 1 ? " round" : " rounds") << ")...";
+  return oss.str();
+}
+
+std::string msg_ipc_bandwidth_plan(const std::string& method,
+                                   size_t message_bytes,
+                                   size_t messages,
+                                   size_t latency_messages) {
+  std::ostringstream oss;
+  oss << "  " << std::left << std::setw(13) << method << std::right << std::setw(9)
+      << format_ipc_message_size(message_bytes) << ": " << messages
+      << (messages == 1 ? " message" : " messages") << " per stream, " << latency_messages
+      << " round trips";
+  return oss.str();
+}
+
+const std::string& report_ipc_bandwidth_header() {
+  static const std::string msg = "--- Inter-Process Transfer ---";
+  return msg;
+}
+
+const std::string& report_ipc_bandwidth_note() {
+  static const std::string msg =
+      "Bandwidth is one-way payload into a forked receiver; latency is one message plus a "
+      "shared-memory acknowledgement. CPU is user plus system time of both processes per payload "
+      "byte, including spin-waiting in shm-ring and mmap-handoff. splice/vmsplice, "
+      "process_vm_readv/writev, and memfd are Linux-only and not measured.";
+  return msg;
+}
+
+const std::string& report_ipc_bandwidth_table_header() {
+  static const std::string msg =
+      "  method         message       GB/s   latency us   CPU ns/B  (sender + receiver)";
+  return msg;
+}
+
+std::string report_ipc_bandwidth_row(const std::string& method,
+                                     size_t message_bytes,
+                                     double gb_s,
+                                     double latency_us,
+                                     double cpu_ns_per_byte,
+                                     double sender_cpu_ns_per_byte,
+                                     double receiver_cpu_ns_per_byte) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(2);
+  oss << "  " << std::left << std::setw(13) << method << std::right << std::setw(9)
+      << format_ipc_message_size(message_bytes) << std::setw(11) << gb_s << std::setw(13)
+      << latency_us << std::setprecision(3) << std::setw(11) << cpu_ns_per_byte << "  ("
+      << sender_cpu_ns_per_byte << " + " << receiver_cpu_ns_per_byte << ")";
+  return oss.str();
+}
+
+}  // namespace Messages
@@ -0,0 +1,110 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file kernel_autotune_messages.cpp
+ * @brief Message helpers for standalone kernel autotune mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <iomanip>
+#include <sstream>
+
+#include "core/config/constants.h"
+#include "messages_api.h"
+
+namespace Messages {
+
+const std::string& error_autotune_kernels_must_be_used_alone() {
+  static const std::string msg =
+      "--autotune-kernels allows only optional -o/--output <file>, -b/--buffer-size <size_mb>, "
+      "-t/--threads <count>, -r/--count <rounds>, and --autotune-cache <file>; -h/--help prints help";
+  return msg;
+}
+
+std::string error_kernel_autotune_failed(const std::string& reason) {
+  return "Kernel autotune failed: " + reason;
+}
+
+std::string error_kernel_autotune_cache_missing_winners(const std::string& cpu_identity,
+                                                        const std::string& cache_path) {
+  return "no main-memory read/write/copy winners for " + cpu_identity + " in " + cache_path;
+}
+
+const std::string& msg_running_kernel_autotune() {
+  static const std::string msg = "\nRunning standalone sequential-kernel autotune...";
+  return msg;
+}
+
+std::string msg_kernel_autotune_progress(const std::string& target,
+                                         const std::string& operation,
+                                         size_t candidate_count,
+                                         int rounds) {
+  std::ostringstream oss;
+  oss << "  [" << target << " " << operation << "] " << candidate_count << " candidates x "
+      << rounds << " rounds";
+  return oss.str();
+}
+
+std::string msg_kernel_autotune_cache_saved(const std::string& cache_path) {
+  return "Tuned kernels saved to: " + cache_path;
+}
+
+const std::string& warning_kernel_autotune_cache_path_unavailable() {
+  static const std::string msg =
+      "HOME is not set and --autotune-cache was not given; tuned kernels were not persisted.";
+  return msg;
+}
+
+const std::string& report_kernel_autotune_header() {
+  static const std::string msg = "--- Kernel Autotune Report ---";
+  return msg;
+}
+
+std::string report_kernel_autotune_identity(const std::string& cpu_identity) {
+  return "CPU identity: " + cpu_identity;
+}
+
+const std::string& report_kernel_autotune_peak_note() {
+  static const std::string msg =
+      "Peak is the fastest candidate's median; the gap is how far the default kernel falls short of it.";
+  return msg;
+}
+
+std::string report_kernel_autotune_choice(const std::string& target,
+                                          const std::string& operation,
+                                          int threads,
+                                          const std::string& best_kernel,
+                                          double best_bandwidth_gb_s,
+                                          const std::string& default_kernel,
+                                          double default_bandwidth_gb_s,
+                                          double default_shortfall_pct) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(2);
+  oss << "  " << std::left << std::setw(12) << target << std::setw(6) << operation
+      << " (" << threads << "T)  peak " << best_bandwidth_gb_s << " GB/s [" << best_kernel
+      << "]  default " << default_bandwidth_gb_s << " GB/s [" << default_kernel << "]  gap "
+      << default_shortfall_pct << " %";
+  return oss.str();
+}
+
+std::string report_kernel_autotune_unmeasured(const std::string& target,
+                                              const std::string& operation) {
+  return "  " + target + " " + operation + ": not measured";
+}
+
+}  // namespace Messages
@@ -0,0 +1,116 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+
+/**
+ * @file linked_structures_messages.cpp
+ * @brief Message helpers for standalone linked-structures mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <iomanip>
+#include <sstream>
+
+#include "messages_api.h"
+
+namespace Messages {
+
+const std::string& error_linked_structures_must_be_used_alone() {
+  static const std::string msg =
+      "--linked-structures allows only optional -o/--output <file>, -r/--count <rounds>, "
+      "-b/--buffer-size <MB>, -i/--iterations <operations>, --seed <uint64>, "
+      "--payload-bytes <bytes>, --tree-fanout <count>, --tree-node-bytes <bytes>, and "
+      "--load-factor <fraction>; -h/--help prints help";
+  return msg;
+}
+
+std::string error_linked_tree_node_too_small(size_t fanout, size_t node_bytes,
+                                             size_t minimum_bytes) {
+  std::ostringstream oss;
+  oss << "--tree-node-bytes " << node_bytes << " cannot hold a fanout-" << fanout
+      << " node; it needs at least " << minimum_bytes
+      << " bytes (8-byte header plus 8-byte key and link per child)";
+  return oss.str();
+}
+
+std::string error_linked_load_factor_range(double maximum) {
+  std::ostringstream oss;
+  oss << "must be a decimal greater than 0 and at most " << maximum;
+  return oss.str();
+}
+
+std::string error_linked_structures_failed(const std::string& reason) {
+  return "Linked-structure traversal failed: " + reason;
+}
+
+std::string msg_running_linked_structures(unsigned long buffer_size_mb,
+                                          int operations,
+                                          size_t payload_bytes,
+                                          size_t tree_fanout,
+                                          size_t tree_node_bytes,
+                                          double load_factor) {
+  std::ostringstream oss;
+  oss << "\nRunning standalone linked-structure traversal (" << buffer_size_mb
+      << " MB per structure, " << operations << " dependent operations per sample, "
+      << payload_bytes << " B list payload, fanout-" << tree_fanout << " " << tree_node_bytes
+      << " B tree nodes, hash load factor " << load_factor << ")...";
+  return oss.str();
+}
+
+const std::string& report_linked_structures_header() {
+  static const std::string msg = "--- Linked Structure Traversal ---";
+  return msg;
+}
+
+const std::string& report_linked_structures_note() {
+  static const std::string msg =
+      "Each operation's result selects the next one, so ns/op is dependent latency. "
+      "B/op counts the bytes an operation reads, averaged over one full chain cycle. "
+      "pointer_chase walks the list's next pointers without reading payload.";
+  return msg;
+}
+
+const std::string& report_linked_structures_table_header() {
+  static const std::string msg =
+      "  structure                 ns/op      B/op     GB/s        steps   vs chase     CV";
+  return msg;
+}
+
+std::string report_linked_structures_row(const std::string& name,
+                                         double ns_per_operation,
+                                         double bytes_per_operation,
+                                         double steps_per_operation,
+                                         const std::string& step_unit,
+                                         double reference_ns,
+                                         double cv_pct) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(1);
+  oss << "  " << std::left << std::setw(22) << name << std::right << std::setw(10)
+      << ns_per_operation << std::setw(10) << bytes_per_operation << std::setprecision(2)
+      << std::setw(9) << (ns_per_operation > 0.0 ? bytes_per_operation / ns_per_operation : 0.0)
+      << std::setw(6) << steps_per_operation << " " << std::left << std::setw(7) << step_unit
+      << std::right;
+  if (reference_ns > 0.0) {
+    oss << std::setw(8) << ns_per_operation / reference_ns << "x";
+  } else {
+    oss << std::setw(9) << "n/a";
+  }
+  oss << std::setprecision(1) << std::setw(6) << cv_pct << "%";
+  return oss.str();
+}
+
+}  // namespace Messages
@@ -38,7 +38,9 @@
 #define MESSAGES_MESSAGES_API_H
 
 #include <cstdint>
+#include <optional>
 #include <string>
+#include <vector>
 
 /**
  * @brief Centralized namespace for all text messages, error messages, and output strings
@@ -72,6 +74,94 @@ const std::string& error_analyze_tlb_global_random_unsupported();
 std::string error_latency_tlb_locality_page_multiple(size_t value_kb, size_t page_size_kb);
 std::string error_latency_tlb_locality_too_small_for_stride(size_t locality_bytes, size_t stride_bytes);
 std::string error_threads_invalid(long long value, long long min_val, long long max_val);
+std::string error_tlb_chain_layouts_invalid(size_t max_layouts);
+std::string error_kernel_name_invalid();
+std::string error_kernel_tuned_unavailable(const std::string& reason);
+const std::string& error_autotune_kernels_must_be_used_alone();
+std::string error_kernel_autotune_failed(const std::string& reason);
+std::string error_kernel_autotune_cache_missing_winners(const std::string& cpu_identity,
+                                                        const std::string& cache_path);
+const std::string& error_noisy_neighbor_must_be_used_alone();
+std::string error_noisy_neighbor_traffic_invalid(const std::string& value);
+std::string error_noisy_neighbor_duty_cycles_invalid(const std::string& value);
+std::string error_noisy_neighbor_failed(const std::string& reason);
+const std::string& error_core_scan_must_be_used_alone();
+std::string error_core_scan_failed(const std::string& reason);
+const std::string& error_partition_compare_must_be_used_alone();
+std::string error_partition_granules_invalid(const std::string& value);
+std::string error_partition_compare_failed(const std::string& reason);
+const std::string& error_multi_process_must_be_used_alone();
+std::string error_multi_process_workers_invalid(const std::string& value);
+std::string error_multi_process_memory_invalid(const std::string& value);
+std::string error_multi_process_failed(const std::string& reason);
+const std::string& error_ipc_bandwidth_must_be_used_alone();
+std::string error_ipc_methods_invalid(const std::string& value);
+std::string error_ipc_message_sizes_invalid(const std::string& value);
+std::string error_ipc_bandwidth_failed(const std::string& reason);
+const std::string& error_file_io_must_be_used_alone();
+std::string error_file_io_block_invalid(size_t block_kb, unsigned long file_size_mb);
+std::string error_file_io_failed(const std::string& reason);
+const std::string& error_row_buffer_must_be_used_alone();
+std::string error_row_buffer_failed(const std::string& reason);
+const std::string& error_linked_structures_must_be_used_alone();
+std::string error_linked_tree_node_too_small(size_t fanout, size_t node_bytes, size_t minimum_bytes);
+std::string error_linked_load_factor_range(double maximum);
+std::string error_linked_structures_failed(const std::string& reason);
+const std::string& error_workload_must_be_used_alone();
+std::string error_workload_file(const std::string& path, const std::string& reason);
+std::string error_workload_line(size_t line, const std::string& reason);
+std::string error_workload_stream_too_small(const std::string& group, const std::string& stream,
+                                            size_t line, const std::string& reason);
+std::string error_workload_failed(const std::string& reason);
+const std::string& error_workload_no_group();
+const std::string& workload_reason_file_unreadable();
+std::string workload_reason_file_too_large(size_t maximum_bytes);
+const std::string& workload_reason_group_syntax();
+std::string workload_reason_group_setting(const std::string& token);
+std::string workload_reason_thread_range(int maximum);
+std::string workload_reason_group_duplicate(const std::string& group);
+std::string workload_reason_thread_total(int maximum);
+std::string workload_reason_group_without_stream(const std::string& group);
+const std::string& workload_reason_stream_syntax();
+std::string workload_reason_unknown_operation(const std::string& operation);
+std::string workload_reason_unknown_pattern(const std::string& pattern);
+const std::string& workload_reason_chase_write();
+std::string workload_reason_expected_setting(const std::string& token);
+const std::string& workload_reason_region_size();
+std::string workload_reason_weight_range(unsigned maximum);
+std::string workload_reason_stride(size_t access_bytes);
+std::string workload_reason_theta_range(double maximum);
+std::string workload_reason_unexpected_setting(const std::string& key, const std::string& pattern);
+const std::string& workload_reason_region_missing();
+const std::string& workload_reason_stride_missing();
+const std::string& workload_reason_stream_before_group();
+std::string workload_reason_stream_duplicate(const std::string& stream, const std::string& group);
+std::string workload_reason_stream_limit(size_t maximum);
+std::string workload_reason_unknown_directive(const std::string& directive);
+const std::string& workload_reason_stride_overflow();
+std::string workload_reason_region_below_access(size_t access_bytes);
+std::string workload_reason_partition_too_small(size_t threads, size_t minimum_bytes);
+const std::string& error_trace_replay_must_be_used_alone();
+std::string error_trace_replay_file(const std::string& path, const std::string& reason);
+std::string error_trace_replay_record(uint64_t record, const std::string& reason);
+std::string error_trace_replay_failed(const std::string& reason);
+std::string trace_replay_reason_short_header(size_t header_bytes);
+std::string trace_replay_reason_bad_magic(const std::string& magic);
+std::string trace_replay_reason_version(uint64_t version, uint64_t supported_version);
+const std::string& trace_replay_reason_reserved_fields();
+const std::string& trace_replay_reason_no_records();
+std::string trace_replay_reason_too_many_records(uint64_t records, uint64_t maximum);
+const std::string& trace_replay_reason_record_missing();
+std::string trace_replay_reason_control_byte(unsigned control);
+const std::string& trace_replay_reason_thread_id();
+const std::string& trace_replay_reason_address_delta();
+const std::string& trace_replay_reason_address_overflow();
+std::string trace_replay_reason_too_many_threads(size_t maximum);
+std::string trace_replay_reason_trailing_bytes(size_t bytes);
+std::string trace_replay_reason_too_many_pages(size_t pages, size_t maximum_pages);
+std::string trace_replay_reason_open_failed(const std::string& system_error);
+std::string trace_replay_reason_stat_failed(const std::string& system_error);
+std::string trace_replay_reason_map_failed(const std::string& system_error);
 const std::string& error_analyze_tlb_must_be_used_alone();
 const std::string& error_seed_requires_supported_mode();
 std::string error_duplicate_sweep_parameter(const std::string& parameter_name);
@@ -124,6 +214,17 @@ const std::string& error_latency_access_count_overflow();
 const std::string& error_latency_access_count_negative();
 const std::string& error_incompatible_flags();
 const std::string& error_only_flags_with_patterns();
+const std::string& error_kernel_requires_bandwidth_mode();
+const std::string& error_bandwidth_timeline_requires_benchmark();
+const std::string& error_lock_buffers_requires_benchmark();
+const std::string& error_pattern_skew_requires_patterns();
+std::string error_zipf_theta_invalid(double max_theta);
+const std::string& error_hot_fraction_invalid();
+const std::string& error_hot_probability_invalid();
+const std::string& error_pattern_matrix_requires_patterns();
+const std::string& error_matrix_row_bytes_invalid();
+const std::string& error_matrix_pitch_invalid();
+std::string error_matrix_tile_invalid(size_t multiple, size_t max_elements);
 const std::string& error_only_bandwidth_with_cache_size();
 const std::string& error_only_bandwidth_with_latency_samples();
 const std::string& error_buffersize_zero_requires_only_latency();
@@ -158,6 +259,11 @@ std::string warning_qos_failed_benchmark_worker(const std::string& worker_name,
 std::string warning_madvise_random_failed(const std::string& buffer_name, const std::string& error_msg);
 std::string warning_tlb_mlock_failed(int error_code,
                                      const std::string& error_message);
+std::string warning_tlb_chain_reuse_unavailable(const std::string& pass_name,
+                                                size_t layout_identities);
+std::string warning_buffer_lock_failed(int error_code,
+                                       const std::string& error_message,
+                                       const std::optional<uint64_t>& memlock_limit_bytes);
 const std::string& warning_core_count_detection_failed();
 const std::string& warning_mach_host_self_failed();
 std::string warning_host_page_size_failed(const std::string& error_details);
@@ -170,6 +276,11 @@ std::string warning_threads_capped(int requested, int max_cores);
 std::string warning_benchmark_high_cv(const std::string& metric_name,
                                       double cv_pct,
                                       double threshold_pct);
+std::string warning_core_frequency_drift(const std::string& measurement_name,
+                                         double min_ghz,
+                                         double max_ghz,
+                                         double drift_pct,
+                                         double threshold_pct);
 
 // --- Info Messages ---
 std::string info_setting_max_fallback(unsigned long max_mb);
@@ -250,6 +361,207 @@ std::string report_core_to_core_hint_status(const std::string& thread_role,
                                             int affinity_code,
                                             int affinity_tag);
 
+// --- Kernel Autotune Messages ---
+const std::string& msg_running_kernel_autotune();
+std::string msg_kernel_autotune_progress(const std::string& target,
+                                         const std::string& operation,
+                                         size_t candidate_count,
+                                         int rounds);
+std::string msg_kernel_autotune_cache_saved(const std::string& cache_path);
+const std::string& warning_kernel_autotune_cache_path_unavailable();
+const std::string& report_kernel_autotune_header();
+std::string report_kernel_autotune_identity(const std::string& cpu_identity);
+const std::string& report_kernel_autotune_peak_note();
+std::string report_kernel_autotune_choice(const std::string& target,
+                                          const std::string& operation,
+                                          int threads,
+                                          const std::string& best_kernel,
+                                          double best_bandwidth_gb_s,
+                                          const std::string& default_kernel,
+                                          double default_bandwidth_gb_s,
+                                          double default_shortfall_pct);
+std::string report_kernel_autotune_unmeasured(const std::string& target,
+                                              const std::string& operation);
+
+// --- Noisy-Neighbor Messages ---
+const std::string& msg_running_noisy_neighbor();
+std::string msg_noisy_neighbor_plan(const std::string& traffic,
+                                    int aggressor_threads,
+                                    size_t duty_level_count,
+                                    int rounds);
+std::string msg_noisy_neighbor_round(int round, int rounds);
+const std::string& report_noisy_neighbor_header();
+const std::string& report_noisy_neighbor_slowdown_note();
+std::string report_noisy_neighbor_level(int duty_cycle_pct);
+std::string report_noisy_neighbor_victim(const std::string& victim,
+                                         double value,
+                                         const std::string& unit,
+                                         double slowdown,
+                                         double aggressor_bandwidth_gb_s);
+std::string report_noisy_neighbor_unmeasured(const std::string& victim);
+
+// --- Core Scan Messages ---
+const std::string& msg_running_core_scan();
+std::string msg_core_scan_plan(size_t slot_count, size_t batch_count, int concurrency, int rounds);
+std::string msg_core_scan_batch(size_t batch, size_t batch_count, const std::string& core_class,
+                                size_t slot_count);
+const std::string& report_core_scan_header();
+std::string report_core_scan_placement_note(double outlier_threshold_pct);
+const std::string& report_core_scan_table_header();
+std::string report_core_scan_slot_label(int slot, const std::string& core_class);
+std::string report_core_scan_class_label(const std::string& core_class);
+std::string report_core_scan_class_not_comparable(const std::string& core_class,
+                                                  size_t measured_slots);
+std::string report_core_scan_cell(double value, bool outlier);
+const std::string& report_core_scan_unmeasured_cells();
+std::string report_core_scan_outlier(int slot,
+                                     const std::string& core_class,
+                                     const std::string& metric,
+                                     double deviation_pct);
+const std::string& report_core_scan_no_outliers();
+
+// --- Partition Compare Messages ---
+const std::string& msg_running_partition_compare();
+std::string msg_partition_compare_plan(int threads, unsigned long buffer_size_mb, size_t passes,
+                                       size_t layout_count, int rounds);
+std::string msg_partition_compare_round(int round, int rounds);
+const std::string& report_partition_compare_header();
+const std::string& report_partition_compare_note();
+const std::string& report_partition_compare_table_header();
+std::string report_partition_compare_layout_label(const std::string& strategy,
+                                                  size_t granule_bytes);
+std::string report_partition_compare_cell(double gb_s, double vs_contiguous_pct, bool show_pct);
+
+// --- Multi-Process Messages ---
+std::string msg_running_multi_process(const std::string& process_memory);
+std::string msg_multi_process_point(int workers, size_t passes, int rounds);
+const std::string& report_multi_process_header();
+std::string report_multi_process_note(const std::string& process_memory);
+const std::string& report_multi_process_table_header();
+std::string report_multi_process_row(int workers,
+                                     const std::string& operation,
+                                     const std::string& unit,
+                                     double thread_value,
+                                     double process_value,
+                                     double process_vs_thread_pct,
+                                     bool show_pct);
+
+// --- IPC Bandwidth Messages ---
+std::string msg_running_ipc_bandwidth(size_t row_count, int rounds);
+std::string msg_ipc_bandwidth_plan(const std::string& method,
+                                   size_t message_bytes,
+                                   size_t messages,
+                                   size_t latency_messages);
+const std::string& report_ipc_bandwidth_header();
+const std::string& report_ipc_bandwidth_note();
+const std::string& report_ipc_bandwidth_table_header();
+std::string report_ipc_bandwidth_row(const std::string& method,
+                                     size_t message_bytes,
+                                     double gb_s,
+                                     double latency_us,
+                                     double cpu_ns_per_byte,
+                                     double sender_cpu_ns_per_byte,
+                                     double receiver_cpu_ns_per_byte);
+
+// --- File I/O Messages ---
+std::string msg_running_file_io(const std::string& file_path,
+                                unsigned long file_size_mb,
+                                size_t block_bytes);
+std::string msg_file_io_plan(const std::string& method, const std::string& access,
+                             size_t passes);
+const std::string& report_file_io_header();
+const std::string& report_file_io_note();
+const std::string& report_file_io_table_header();
+std::string report_file_io_row(const std::string& method,
+                               const std::string& access,
+                               double gb_s,
+                               double overhead_ns_per_byte,
+                               double vs_memory_pct,
+                               bool baseline);
+
+// --- Row Buffer Messages ---
+std::string msg_running_row_buffer(unsigned long buffer_size_mb,
+                                   size_t page_bytes,
+                                   size_t pairs,
+                                   int iterations);
+const std::string& report_row_buffer_header();
+const std::string& report_row_buffer_note();
+std::string report_row_buffer_latency_row(const std::string& label,
+                                          const std::optional<double>& latency_ns,
+                                          double reference_ns);
+std::string report_row_buffer_clusters(bool separated,
+                                       double separation,
+                                       double conflict_fraction,
+                                       const std::optional<size_t>& estimated_banks);
+const std::string& report_row_buffer_bits_header();
+std::string report_row_buffer_bit_row(size_t offset_bytes,
+                                      double latency_ns,
+                                      const std::string& classification);
+std::string report_row_buffer_physical(const std::string& status,
+                                       const std::vector<uint64_t>& bank_functions);
+
+// --- Linked Structures Messages ---
+std::string msg_running_linked_structures(unsigned long buffer_size_mb,
+                                          int operations,
+                                          size_t payload_bytes,
+                                          size_t tree_fanout,
+                                          size_t tree_node_bytes,
+                                          double load_factor);
+const std::string& report_linked_structures_header();
+const std::string& report_linked_structures_note();
+const std::string& report_linked_structures_table_header();
+std::string report_linked_structures_row(const std::string& name,
+                                         double ns_per_operation,
+                                         double bytes_per_operation,
+                                         double steps_per_operation,
+                                         const std::string& step_unit,
+                                         double reference_ns,
+                                         double cv_pct);
+
+// --- Workload Messages ---
+std::string msg_running_workload(const std::string& workload_file,
+                                 size_t groups,
+                                 size_t streams,
+                                 size_t threads,
+                                 size_t region_bytes,
+                                 int sample_ms);
+const std::string& report_workload_header();
+const std::string& report_workload_note();
+const std::string& report_workload_table_header();
+std::string report_workload_row(const std::string& name,
+                                const std::string& operation,
+                                const std::string& pattern,
+                                int threads,
+                                double achieved_share,
+                                double requested_share,
+                                double gb_s,
+                                double ns_per_access,
+                                double cv_pct);
+std::string report_workload_aggregate(double gb_s,
+                                      size_t threads,
+                                      double cv_pct,
+                                      bool has_chase,
+                                      double chase_ns);
+
+// --- Trace Replay Messages ---
+std::string msg_running_trace_replay(const std::string& trace_file,
+                                     uint64_t records,
+                                     size_t threads,
+                                     size_t buffer_bytes,
+                                     uint64_t address_span_bytes,
+                                     bool speed_of_light);
+std::string msg_trace_replay_plan(int passes, int sample_ms);
+const std::string& report_trace_replay_header();
+const std::string& report_trace_replay_note(bool speed_of_light);
+const std::string& report_trace_replay_table_header();
+const std::string& report_trace_replay_trace_order_label();
+const std::string& report_trace_replay_shuffled_label();
+std::string report_trace_replay_row(const std::string& order,
+                                    double gb_s,
+                                    double mops,
+                                    double cv_pct);
+std::string report_trace_replay_speedup(double order_speedup);
+
 // --- TLB Analysis Report Messages ---
 const std::string& report_tlb_header();
 const std::string& report_tlb_settings_header();
@@ -306,6 +618,13 @@ std::string report_tlb_boundary_kb(size_t boundary_kb);
 std::string report_tlb_inferred_size_entries(size_t entries);
 std::string report_tlb_inferred_reach_entries(size_t entries);
 std::string report_tlb_inferred_entries_range(size_t min_entries, size_t max_entries);
+std::string report_tlb_effective_reach(size_t reach_bytes, size_t page_size_bytes);
+const std::string& report_tlb_page_granules_section();
+const std::string& report_tlb_page_granules_scope();
+const std::string& tlb_page_granule_reason_block_mapping();
+std::string report_tlb_page_granule(size_t page_size_bytes,
+                                    bool analyzed,
+                                    const std::string& reason);
 const std::string& report_tlb_private_cache_overlap();
 std::string report_tlb_confidence(const std::string& confidence, double step_ns, double step_percent);
 std::string report_tlb_statistical_confidence(const std::string& confidence,
@@ -329,6 +648,13 @@ std::string report_tlb_large_locality_paired_comparison(
 std::string report_tlb_large_locality_paired_unavailable(size_t required_buffer_mb,
                                                          size_t selected_buffer_mb);
 const std::string& report_tlb_large_locality_paired_interrupted();
+std::string report_tlb_page_table_footprint_comparison(
+    size_t data_pages,
+    size_t page_stride_pages,
+    double table_spread_p50_ns,
+    double table_dense_p50_ns,
+    double page_walk_delta_p50_ns);
+const std::string& report_tlb_page_table_footprint_unavailable();
 std::string report_tlb_conclusions_unavailable(const std::string& status);
 const std::string& report_tlb_not_detected();
 
@@ -379,6 +705,9 @@ std::string results_main_memory_bandwidth(int num_threads);
 std::string results_read_bandwidth(double bw_gb_s, double total_time);
 std::string results_write_bandwidth(double bw_gb_s, double total_time);
 std::string results_copy_bandwidth(double bw_gb_s, double total_time);
+std::string results_bandwidth_timeline(double steady_gb_s, double ramp_up_seconds,
+                                       size_t transition_windows, size_t windows);
+std::string results_bandwidth_timeline_unanalyzed(size_t windows);
 std::string results_main_memory_latency();
 std::string results_latency_total_time(double total_time_sec);
 std::string results_latency_average(double latency_ns, size_t locality_bytes);
@@ -476,6 +805,23 @@ const std::string& pattern_sequential_forward();
 const std::string& pattern_sequential_reverse();
 std::string pattern_strided(const std::string& stride_name);
 const std::string& pattern_random_uniform();
+const std::string& pattern_gather_scatter_scalar();
+const std::string& pattern_gather_scatter_neon();
+const std::string& pattern_skewed_zipf();
+const std::string& pattern_skewed_hot_cold();
+const std::string& pattern_skewed_shifting_hot_set();
+std::string pattern_skew_zipf_parameters(double theta);
+std::string pattern_skew_hot_set_parameters(double hot_fraction, double hot_probability,
+                                            size_t phases);
+std::string pattern_skew_hit_ratio_proxy(const std::string& parameters,
+                                         std::optional<double> l1_ratio,
+                                         std::optional<double> l2_ratio);
+const std::string& pattern_matrix_row_major();
+const std::string& pattern_matrix_column_major();
+const std::string& pattern_matrix_tiled();
+const std::string& pattern_matrix_transpose();
+std::string pattern_matrix_shape(size_t rows, size_t row_bytes, size_t pitch_bytes,
+                                 size_t tile_elements);
 const std::string& pattern_cache_line_64b();
 const std::string& pattern_page_4096b();
 const std::string& pattern_page_16384b();
@@ -494,6 +840,9 @@ const std::string& pattern_reason_measurement_not_completed();
 const std::string& pattern_reason_timer_creation_failed();
 const std::string& pattern_reason_calibration_or_accounting_failed();
 const std::string& pattern_reason_no_valid_random_workload();
+const std::string& pattern_reason_no_valid_gather_workload();
+const std::string& pattern_reason_matrix_does_not_fit();
+const std::string& pattern_reason_transpose_copy_only();
 const std::string& pattern_reason_stride_transition_unavailable();
 const std::string& pattern_reason_copy_accounting_overflow();
 const std::string& pattern_reason_invalid_strided_timing();
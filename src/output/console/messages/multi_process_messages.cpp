@@ -0,0 +1,101 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file multi_process_messages.cpp
+ * @brief Message helpers for standalone multi-process mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <iomanip>
+#include <sstream>
+
+#include "messages_api.h"
+
+namespace Messages {
+
+const std::string& error_multi_process_must_be_used_alone() {
+  static const std::string msg =
+      "--multi-process allows only optional -o/--output <file>, -r/--count <rounds>, "
+      "-b/--buffer-size <MB>, --workers <count,...>, and --process-memory <private|shared>; "
+      "-h/--help prints help";
+  return msg;
+}
+
+std::string error_multi_process_workers_invalid(const std::string& value) {
+  return "Invalid --workers '" + value + "': expected distinct positive worker counts, e.g. 1,4,8";
+}
+
+std::string error_multi_process_memory_invalid(const std::string& value) {
+  return "Invalid --process-memory '" + value + "': expected private or shared";
+}
+
+std::string error_multi_process_failed(const std::string& reason) {
+  return "Multi-process comparison failed: " + reason;
+}
+
+std::string msg_running_multi_process(const std::string& process_memory) {
+  return "\nRunning standalone thread-versus-process comparison (" + process_memory +
+         " process memory)...";
+}
+
+std::string msg_multi_process_point(int workers, size_t passes, int rounds) {
+  std::ostringstream oss;
+  oss << "  " << workers << (workers == 1 ? " worker, " : " workers, ") << passes
+      << (passes == 1 ? " pass" : " passes") << " per bandwidth run x " << rounds << " rounds";
+  return oss.str();
+}
+
+const std::string& report_multi_process_header() {
+  static const std::string msg = "--- Thread vs Process Scaling ---";
+  return msg;
+}
+
+std::string report_multi_process_note(const std::string& process_memory) {
+  return "Both executors run identical chunks, passes, and kernels; processes use " +
+         process_memory +
+         " memory. Latency is the loaded time per access with every worker chasing its own chain. "
+         "The last column is positive when processes did better.";
+}
+
+const std::string& report_multi_process_table_header() {
+  static const std::string msg =
+      "  workers  operation     threads   processes  unit   process vs thread";
+  return msg;
+}
+
+std::string report_multi_process_row(int workers,
+                                     const std::string& operation,
+                                     const std::string& unit,
+                                     double thread_value,
+                                     double process_value,
+                                     double process_vs_thread_pct,
+                                     bool show_pct) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(2);
+  oss << "  " << std::right << std::setw(7) << workers << "  " << std::left << std::setw(9)
+      << operation << std::right << std::setw(11) << thread_value << std::setw(12)
+      << process_value << "  " << std::left << std::setw(7) << unit;
+  if (show_pct) {
+    oss << std::setprecision(1) << std::showpos << process_vs_thread_pct << "%";
+  } else {
+    oss << "n/a";
+  }
+  return oss.str();
+}
+
+}  // namespace Messages
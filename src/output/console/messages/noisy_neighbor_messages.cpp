@@ -0,0 +1,110 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file noisy_neighbor_messages.cpp
+ * @brief Message helpers for standalone noisy-neighbor mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <iomanip>
+#include <sstream>
+
+#include "core/config/constants.h"
+#include "messages_api.h"
+
+namespace Messages {
+
+const std::string& error_noisy_neighbor_must_be_used_alone() {
+  static const std::string msg =
+      "--noisy-neighbor allows only optional -o/--output <file>, -b/--buffer-size <size_mb>, "
+      "-r/--count <rounds>, --aggressors <count>, --aggressor-traffic <type>, and "
+      "--duty-cycle <list>; -h/--help prints help";
+  return msg;
+}
+
+std::string error_noisy_neighbor_traffic_invalid(const std::string& value) {
+  return "Invalid --aggressor-traffic '" + value + "' (expected read, nt-write, random, or atomic)";
+}
+
+std::string error_noisy_neighbor_duty_cycles_invalid(const std::string& value) {
+  return "Invalid --duty-cycle '" + value +
+         "' (expected comma-separated distinct percentages from 1 to 100, e.g. 25,50,100)";
+}
+
+std::string error_noisy_neighbor_failed(const std::string& reason) {
+  return "Noisy-neighbor run failed: " + reason;
+}
+
+const std::string& msg_running_noisy_neighbor() {
+  static const std::string msg = "\nRunning standalone noisy-neighbor interference test...";
+  return msg;
+}
+
+std::string msg_noisy_neighbor_plan(const std::string& traffic,
+                                    int aggressor_threads,
+                                    size_t duty_level_count,
+                                    int rounds) {
+  std::ostringstream oss;
+  oss << "  " << aggressor_threads << " x " << traffic << " aggressors, baseline + "
+      << duty_level_count << " duty levels x " << rounds << " rounds";
+  return oss.str();
+}
+
+std::string msg_noisy_neighbor_round(int round, int rounds) {
+  return "  round " + std::to_string(round) + "/" + std::to_string(rounds);
+}
+
+const std::string& report_noisy_neighbor_header() {
+  static const std::string msg = "--- Noisy-Neighbor Interference Report ---";
+  return msg;
+}
+
+const std::string& report_noisy_neighbor_slowdown_note() {
+  static const std::string msg =
+      "Slowdown is loaded vs. baseline time per operation (>1.00x is slower); aggressor "
+      "bandwidth is measured over the same victim run.";
+  return msg;
+}
+
+std::string report_noisy_neighbor_level(int duty_cycle_pct) {
+  if (duty_cycle_pct == 0) {
+    return "  baseline (no aggressors)";
+  }
+  return "  duty " + std::to_string(duty_cycle_pct) + "%";
+}
+
+std::string report_noisy_neighbor_victim(const std::string& victim,
+                                         double value,
+                                         const std::string& unit,
+                                         double slowdown,
+                                         double aggressor_bandwidth_gb_s) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(2);
+  oss << "    " << std::left << std::setw(14) << victim << std::right << std::setw(10) << value
+      << " " << std::left << std::setw(5) << unit;
+  if (slowdown > 0.0) {
+    oss << "  " << slowdown << "x  aggressors " << aggressor_bandwidth_gb_s << " GB/s";
+  }
+  return oss.str();
+}
+
+std::string report_noisy_neighbor_unmeasured(const std::string& victim) {
+  return "    " + victim + ": not measured";
+}
+
+}  // namespace Messages
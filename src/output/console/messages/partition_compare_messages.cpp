@@ -0,0 +1,108 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file partition_compare_messages.cpp
+ * @brief Message helpers for standalone partition-compare mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <iomanip>
+#include <sstream>
+
+#include "core/config/constants.h"
+#include "messages_api.h"
+
+namespace Messages {
+
+const std::string& error_partition_compare_must_be_used_alone() {
+  static const std::string msg =
+      "--partition-compare allows only optional -o/--output <file>, -r/--count <rounds>, "
+      "-t/--threads <count>, -b/--buffer-size <MB>, and --granule <KB,...>; -h/--help prints help";
+  return msg;
+}
+
+std::string error_partition_granules_invalid(const std::string& value) {
+  return "Invalid --granule '" + value + "': expected distinct powers of two from " +
+         std::to_string(Constants::PARTITION_COMPARE_MIN_GRANULE_KB) + " to " +
+         std::to_string(Constants::PARTITION_COMPARE_MAX_GRANULE_KB) + " KB, e.g. 4,64,2048";
+}
+
+std::string error_partition_compare_failed(const std::string& reason) {
+  return "Partition comparison failed: " + reason;
+}
+
+const std::string& msg_running_partition_compare() {
+  static const std::string msg = "\nRunning standalone worker-partitioning comparison...";
+  return msg;
+}
+
+std::string msg_partition_compare_plan(int threads, unsigned long buffer_size_mb, size_t passes,
+                                       size_t layout_count, int rounds) {
+  std::ostringstream oss;
+  oss << "  " << threads << " threads, " << buffer_size_mb << " MB buffer, " << passes
+      << (passes == 1 ? " pass" : " passes") << " per run, " << layout_count << " layouts x "
+      << rounds << " rounds";
+  return oss.str();
+}
+
+std::string msg_partition_compare_round(int round, int rounds) {
+  return "  round " + std::to_string(round) + "/" + std::to_string(rounds);
+}
+
+const std::string& report_partition_compare_header() {
+  static const std::string msg = "--- Worker Partitioning Comparison ---";
+  return msg;
+}
+
+const std::string& report_partition_compare_note() {
+  static const std::string msg =
+      "Contiguous is the --benchmark layout; percentages compare each median with it. macOS "
+      "exposes a single memory node, so node-local partitioning is the contiguous layout.";
+  return msg;
+}
+
+const std::string& report_partition_compare_table_header() {
+  static const std::string msg =
+      "  layout               read GB/s            write GB/s           copy GB/s";
+  return msg;
+}
+
+std::string report_partition_compare_layout_label(const std::string& strategy,
+                                                  size_t granule_bytes) {
+  std::string label = strategy;
+  if (granule_bytes > 0) {
+    label += " " + std::to_string(granule_bytes / Constants::BYTES_PER_KB) + "K";
+  }
+  std::ostringstream oss;
+  oss << "  " << std::left << std::setw(19) << label;
+  return oss.str();
+}
+
+std::string report_partition_compare_cell(double gb_s, double vs_contiguous_pct, bool show_pct) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(2) << std::right << std::setw(10) << gb_s;
+  std::ostringstream pct;
+  if (show_pct) {
+    pct << std::fixed << std::setprecision(1) << " (" << std::showpos << vs_contiguous_pct
+        << "%)";
+  }
+  oss << std::left << std::setw(11) << pct.str();
+  return oss.str();
+}
+
+}  // namespace Messages
@@ -50,6 +50,93 @@ const std::string& pattern_random_uniform() {
   return msg;
 }
 
+const std::string& pattern_gather_scatter_scalar() {
+  static const std::string msg = "Gather/Scatter Scalar (8 B elements):";
+  return msg;
+}
+
+const std::string& pattern_gather_scatter_neon() {
+  static const std::string msg = "Gather/Scatter NEON (8 B elements, 8 per group):";
+  return msg;
+}
+
+const std::string& pattern_skewed_zipf() {
+  static const std::string msg = "Skewed Zipf:";
+  return msg;
+}
+
+const std::string& pattern_skewed_hot_cold() {
+  static const std::string msg = "Skewed Hot/Cold:";
+  return msg;
+}
+
+const std::string& pattern_skewed_shifting_hot_set() {
+  static const std::string msg = "Skewed Shifting Hot Set:";
+  return msg;
+}
+
+std::string pattern_skew_zipf_parameters(double theta) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(2) << "theta " << theta;
+  return oss.str();
+}
+
+std::string pattern_skew_hot_set_parameters(double hot_fraction, double hot_probability,
+                                            size_t phases) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(1) << hot_probability * 100.0
+      << "% of accesses to " << hot_fraction * 100.0 << "% of slots";
+  if (phases > 1) {
+    oss << ", moving over " << phases << " phases";
+  }
+  return oss.str();
+}
+
+std::string pattern_skew_hit_ratio_proxy(const std::string& parameters,
+                                         std::optional<double> l1_ratio,
+                                         std::optional<double> l2_ratio) {
+  auto format_ratio = [](std::optional<double> ratio) {
+    if (!ratio.has_value()) return std::string("N/A");
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(1) << *ratio * 100.0 << "%";
+    return oss.str();
+  };
+  return "  Skew : " + parameters + "; hit-ratio proxy L1 " + format_ratio(l1_ratio) +
+         ", L2 " + format_ratio(l2_ratio);
+}
+
+const std::string& pattern_matrix_row_major() {
+  static const std::string msg = "Matrix Row-Major:";
+  return msg;
+}
+
+const std::string& pattern_matrix_column_major() {
+  static const std::string msg = "Matrix Column-Major:";
+  return msg;
+}
+
+const std::string& pattern_matrix_tiled() {
+  static const std::string msg = "Matrix Tiled:";
+  return msg;
+}
+
+const std::string& pattern_matrix_transpose() {
+  static const std::string msg = "Matrix Transpose:";
+  return msg;
+}
+
+std::string pattern_matrix_shape(size_t rows, size_t row_bytes, size_t pitch_bytes,
+                                 size_t tile_elements) {
+  std::ostringstream oss;
+  oss << "  Shape: " << rows << " rows x " << row_bytes << " B, pitch " << pitch_bytes
+      << " B";
+  if ((pitch_bytes & (pitch_bytes - 1)) == 0) {
+    oss << " (power of two)";
+  }
+  oss << ", tile " << tile_elements << "x" << tile_elements << " elements";
+  return oss.str();
+}
+
 const std::string& pattern_cache_line_64b() {
   static const std::string msg = "64 B stride";
   return msg;
@@ -130,6 +217,23 @@ const std::string& pattern_reason_no_valid_random_workload() {
   return msg;
 }
 
+const std::string& pattern_reason_no_valid_gather_workload() {
+  static const std::string msg =
+      "a worker has fewer random indices than one gather group";
+  return msg;
+}
+
+const std::string& pattern_reason_matrix_does_not_fit() {
+  static const std::string msg =
+      "buffer holds no whole tile row at this matrix pitch and tile size";
+  return msg;
+}
+
+const std::string& pattern_reason_transpose_copy_only() {
+  static const std::string msg = "transpose is measured as an out-of-place copy only";
+  return msg;
+}
+
 const std::string& pattern_reason_stride_transition_unavailable() {
   static const std::string msg = "buffer cannot provide a valid stride transition";
   return msg;
@@ -171,7 +171,7 @@ std::string usage_options(const std::string& prog_name) {
       << "                        boundary validation (allows optional -o/--output <file>,\n"
       << "                        -s/--latency-stride-bytes <bytes>, -m/--latency-chain-mode <mode>,\n"
       << "                        -D/--tlb-density <low|medium|high>, --seed <uint64>,\n"
-      << "                        -S/--sweep <key=...>,\n"
+      << "                        --tlb-chain-layouts <count>, -S/--sweep <key=...>,\n"
       << "                        and -X/--sweep-max-runs <count> only).\n"
       << "                        JSON output uses schema 4 with exact string seeds and scoped counters.\n"
       << "  -D, --tlb-density <level>\n"
@@ -179,6 +179,10 @@ std::string usage_options(const std::string& prog_name) {
       << "                        low/quick = 15 points, no refinement, 7-12 adaptive rounds.\n"
       << "                        medium/standard = 15 points + refinement, 10-20 rounds.\n"
       << "                        high/exhaustive = 29 points + refinement, 15-30 rounds.\n"
+      << "      --tlb-chain-layouts <count>\n"
+      << "                        Reuse <count> verified chain layouts per --analyze-tlb point,\n"
+      << "                        cycling rounds through them instead of rebuilding every round\n"
+      << "                        (0-" << Constants::MAX_TLB_CHAIN_LAYOUTS << ", default: 0 = fresh layout every round).\n"
       << "      --seed <uint64>\n"
       << "                        Reproducible workload/schedule seed for --benchmark, --patterns,\n"
       << "                        and --gpu-bandwidth, or planner, round-order, and pointer-chain\n"
@@ -192,6 +196,112 @@ std::string usage_options(const std::string& prog_name) {
       << "                        JSON uses core-to-core schema 2 with per-loop audit metadata\n"
       << "                        (allows optional -o/--output <file>, -r/--count <count>, -n/--latency-samples <count>,\n"
       << "                        sweep over count or latency-samples only, and -h/--help).\n"
+      << "  -A, --autotune-kernels\n"
+      << "                        Measure every sequential kernel shape on L1, L2, and main memory,\n"
+      << "                        report the fastest (peak) kernel per operation and the default\n"
+      << "                        kernel's gap to it, and cache the winners for --kernel tuned\n"
+      << "                        (allows optional -o/--output <file>, -b/--buffer-size <size_mb>,\n"
+      << "                        -t/--threads <count>, -r/--count <rounds> (default: "
+      << Constants::KERNEL_AUTOTUNE_DEFAULT_ROUNDS << "),\n"
+      << "                        --autotune-cache <file> (default: $HOME/"
+      << Constants::KERNEL_AUTOTUNE_CACHE_RELATIVE_PATH << "), and -h/--help).\n"
+      << "  -N, --noisy-neighbor  Measure main-memory latency, single-thread read bandwidth, and\n"
+      << "                        core-to-core round trips with no aggressors and again while\n"
+      << "                        duty-cycled aggressor threads generate traffic on the other cores;\n"
+      << "                        reports each victim's slowdown and the aggressor bandwidth it saw\n"
+      << "                        (allows optional -o/--output <file>, -b/--buffer-size <size_mb>\n"
+      << "                        (default: " << Constants::NOISY_NEIGHBOR_DEFAULT_BUFFER_SIZE_MB
+      << " per victim/aggressor buffer), -r/--count <rounds> (default: "
+      << Constants::NOISY_NEIGHBOR_DEFAULT_ROUNDS << "),\n"
+      << "                        --aggressors <count> (default/cap: logical cores - "
+      << Constants::NOISY_NEIGHBOR_VICTIM_RESERVED_CORES << "),\n"
+      << "                        --aggressor-traffic <read|nt-write|random|atomic> (default: read),\n"
+      << "                        --duty-cycle <pct,...> (default: 25,50,100), and -h/--help).\n"
+      << "  -U, --core-scan       Measure L1/L2 latency and L1/L2 read/write bandwidth on one worker per\n"
+      << "                        logical-CPU slot, hinted by core-class QoS and affinity tag (macOS\n"
+      << "                        cannot pin), and flag slots more than "
+      << Constants::CORE_SCAN_OUTLIER_PCT << "% worse than their class median\n"
+      << "                        (allows optional -o/--output <file>, -r/--count <rounds> (default: "
+      << Constants::CORE_SCAN_DEFAULT_ROUNDS << "),\n"
+      << "                        --scan-concurrency <count> slots measured at once (default: "
+      << Constants::CORE_SCAN_DEFAULT_CONCURRENCY << "), and -h/--help).\n"
+      << "  -I, --partition-compare\n"
+      << "                        Measure main-memory read/write/copy bandwidth with the --benchmark\n"
+      << "                        contiguous worker chunks and with interleaved and randomly assigned\n"
+      << "                        granules, reporting each layout against contiguous\n"
+      << "                        (allows optional -o/--output <file>, -b/--buffer-size <size_mb>\n"
+      << "                        (default: " << Constants::PARTITION_COMPARE_DEFAULT_BUFFER_SIZE_MB
+      << "), -r/--count <rounds> (default: " << Constants::PARTITION_COMPARE_DEFAULT_ROUNDS
+      << "), -t/--threads <count>\n"
+      << "                        (default: all cores), --granule <KB,...> powers of two from "
+      << Constants::PARTITION_COMPARE_MIN_GRANULE_KB << " to "
+      << Constants::PARTITION_COMPARE_MAX_GRANULE_KB << "\n"
+      << "                        (default: 4,64,2048), and -h/--help).\n"
+      << "  -F, --multi-process   Run main-memory read/write/copy bandwidth and pointer-chase latency on\n"
+      << "                        the same worker chunks once with threads and once with forked\n"
+      << "                        processes, reporting the process executor against threads per worker count\n"
+      << "                        (allows optional -o/--output <file>, -b/--buffer-size <size_mb>\n"
+      << "                        (default: " << Constants::MULTI_PROCESS_DEFAULT_BUFFER_SIZE_MB
+      << "), -r/--count <rounds> (default: " << Constants::MULTI_PROCESS_DEFAULT_ROUNDS
+      << "),\n"
+      << "                        --workers <count,...> (default: 1 and all logical cores),\n"
+      << "                        --process-memory <private|shared> (default: private), and -h/--help).\n"
+      << "  -E, --ipc-bandwidth   Stream calibrated runs of equal-size messages to a forked receiver over a\n"
+      << "                        shm_open ring, a pipe, a Unix socket pair, and a shared-mapping handoff,\n"
+      << "                        reporting GB/s, round-trip latency, and CPU ns per byte for both processes\n"
+      << "                        (allows optional -o/--output <file>, -r/--count <rounds> (default: "
+      << Constants::IPC_BANDWIDTH_DEFAULT_ROUNDS << "),\n"
+      << "                        --ipc-methods <shm-ring,pipe,unix-socket,mmap-handoff> (default: all),\n"
+      << "                        --message-size <KB,...> (default: 4,64,1024,16384), and -h/--help).\n"
+      << "  -R, --file-io         Read a warm temporary file by mmap (long-lived and per-pass), pread, and\n"
+      << "                        readv in sequential and random block order, reporting GB/s and ns per\n"
+      << "                        byte over the same reads from anonymous memory\n"
+      << "                        (allows optional -o/--output <file>, -b/--buffer-size <size_mb>\n"
+      << "                        (default: " << Constants::FILE_IO_DEFAULT_FILE_SIZE_MB
+      << "), -r/--count <rounds> (default: " << Constants::FILE_IO_DEFAULT_ROUNDS << "),\n"
+      << "                        --io-block <KB> (default: " << Constants::FILE_IO_DEFAULT_BLOCK_KB
+      << "), --file-dir <dir> (default: $TMPDIR), and -h/--help).\n"
+      << "  -Q, --row-buffer      Time dependent loads of two lines flushed to DRAM for page-offset bit flips\n"
+      << "                        and random cross-page pairs, clustering them into row-hit, row-miss, and\n"
+      << "                        row-conflict latencies (bank XOR functions when physical addresses are visible)\n"
+      << "                        (allows optional -o/--output <file>, -b/--buffer-size <size_mb>\n"
+      << "                        (default: " << Constants::ROW_BUFFER_DEFAULT_BUFFER_SIZE_MB
+      << "), -i/--iterations <count> (default: " << Constants::ROW_BUFFER_DEFAULT_ITERATIONS << "),\n"
+      << "                        -r/--count <rounds> (default: " << Constants::ROW_BUFFER_DEFAULT_ROUNDS
+      << "), --row-pairs <count> (default: " << Constants::ROW_BUFFER_DEFAULT_PAIRS << "),\n"
+      << "                        and -h/--help).\n"
+      << "  -K, --linked-structures\n"
+      << "                        Time dependent operations on a linked list reading an N-byte payload per node,\n"
+      << "                        a B+-tree lookup, and linear/quadratic open-addressing hash probes, built from\n"
+      << "                        the seeded pointer-chain layout; reports ns and bytes per operation\n"
+      << "                        (allows optional -o/--output <file>, -b/--buffer-size <size_mb> per structure\n"
+      << "                        (default: " << Constants::LINKED_DEFAULT_BUFFER_SIZE_MB
+      << "), -i/--iterations <operations> (default: " << Constants::LINKED_DEFAULT_OPERATIONS << "),\n"
+      << "                        -r/--count <rounds> (default: " << Constants::LINKED_DEFAULT_ROUNDS
+      << "), --seed <uint64>, --payload-bytes <bytes> (default: " << Constants::LINKED_DEFAULT_PAYLOAD_BYTES << "),\n"
+      << "                        --tree-fanout <count> (default: " << Constants::LINKED_DEFAULT_TREE_FANOUT
+      << "), --tree-node-bytes <bytes> (default: " << Constants::LINKED_DEFAULT_TREE_NODE_BYTES << "),\n"
+      << "                        --load-factor <fraction> (default: " << Constants::LINKED_DEFAULT_LOAD_FACTOR
+      << "), and -h/--help).\n"
+      << "  -Y, --workload <file>\n"
+      << "                        Run the thread groups described in <file>: 'group <name> threads=<n>' lines followed\n"
+      << "                        by 'stream <name> <read|write> <sequential|strided|random|zipf|chase> region=<size>\n"
+      << "                        [weight=<n>] [stride=<bytes>] [theta=<value>]' lines. Workers interleave weighted\n"
+      << "                        " << Constants::WORKLOAD_SLICE_BYTES / Constants::BYTES_PER_KB
+      << " KiB slices of their group's streams; reports per-stream GB/s and ns per access plus\n"
+      << "                        aggregate GB/s and chase latency (allows optional -o/--output <file>,\n"
+      << "                        -r/--count <samples> (default: " << Constants::WORKLOAD_DEFAULT_ROUNDS
+      << "), --sample-ms <ms> (default: " << Constants::WORKLOAD_DEFAULT_SAMPLE_MS << "),\n"
+      << "                        --seed <uint64>, and -h/--help).\n"
+      << "  -Z, --trace-replay <file>\n"
+      << "                        Replay a binary address trace (MBTRACE1: per record a control byte, a thread id,\n"
+      << "                        and a delta-encoded address) with one worker per traced thread against a buffer\n"
+      << "                        of the trace's touched pages; reports GB/s and Mops/s in trace order and for a\n"
+      << "                        shuffled-order control (allows optional -o/--output <file>, -r/--count <samples>\n"
+      << "                        (default: " << Constants::TRACE_REPLAY_DEFAULT_ROUNDS
+      << "), --sample-ms <ms> (default: " << Constants::TRACE_REPLAY_DEFAULT_SAMPLE_MS
+      << "), --speed-of-light to ignore\n"
+      << "                        dependency bits, and -h/--help).\n"
       << "  -n, --latency-samples <count>\n"
       << "                        Number of latency samples to collect per test (default: " << Constants::DEFAULT_LATENCY_SAMPLE_COUNT << ")\n"
       << "                        Samples use a separate pass and do not define the continuous headline.\n"
@@ -226,11 +336,38 @@ std::string usage_options(const std::string& prog_name) {
       << "                        tests for the custom cache size.\n"
       << "                        In --only-latency mode, --cache-size 0 disables cache latency.\n"
       << "  -P, --patterns        Run pattern benchmarks (sequential forward/reverse, strided,\n"
-      << "                        and random access patterns). When set, only pattern benchmarks\n"
+      << "                        random, gather/scatter, skewed Zipf/hot-set, and 2D matrix\n"
+      << "                        row/column/tiled/transpose access patterns).\n"
+      << "                        When set, only pattern benchmarks\n"
       << "                        are executed, skipping standard bandwidth and latency tests.\n"
       << "                        Samples auto-calibrate toward 150 ms unless --iterations is explicit.\n"
       << "                        Cannot be used with --benchmark.\n"
       << "                        use with --buffer-size <size_mb> to set the buffer size for the pattern benchmarks.\n"
+      << "      --zipf-theta <theta>\n"
+      << "                        Zipf exponent for the skewed_zipf pattern, 0 < theta <= "
+      << Constants::PATTERN_ZIPF_MAX_THETA << " (default: "
+      << Constants::PATTERN_ZIPF_DEFAULT_THETA << "). Requires --patterns.\n"
+      << "      --hot-fraction <fraction>\n"
+      << "                        Share of buffer slots in the hot set for the hot/cold and shifting\n"
+      << "                        hot-set patterns, 0 < fraction < 1 (default: "
+      << Constants::PATTERN_HOT_DEFAULT_FRACTION << "). Requires --patterns.\n"
+      << "      --hot-probability <probability>\n"
+      << "                        Share of accesses drawn from the hot set, 0 < probability <= 1\n"
+      << "                        (default: " << Constants::PATTERN_HOT_DEFAULT_PROBABILITY
+      << "). Requires --patterns.\n"
+      << "      --matrix-row-bytes <bytes>\n"
+      << "                        Row width of the matrix patterns, a multiple of the tile width\n"
+      << "                        (default: " << Constants::PATTERN_MATRIX_DEFAULT_ROW_BYTES
+      << "). Requires --patterns.\n"
+      << "      --matrix-pitch <bytes>\n"
+      << "                        Distance between matrix row starts, a multiple of 32 and at least\n"
+      << "                        the row width (default: the row width). Requires --patterns.\n"
+      << "      --matrix-tile <elements>\n"
+      << "                        Square tile edge for the tiled and transpose patterns, a multiple of "
+      << Constants::PATTERN_MATRIX_TILE_ELEMENT_MULTIPLE << "\n"
+      << "                        up to " << Constants::PATTERN_MATRIX_MAX_TILE_ELEMENTS
+      << " (default: " << Constants::PATTERN_MATRIX_DEFAULT_TILE_ELEMENTS
+      << "). Requires --patterns.\n"
       << "  -W, --only-bandwidth  Run only bandwidth tests (read/write/copy for main memory and cache).\n"
       << "                        Skips all latency tests. Requires --benchmark. Cannot be used with --patterns,\n"
       << "                        --cache-size, or --latency-samples.\n"
@@ -239,6 +376,21 @@ std::string usage_options(const std::string& prog_name) {
       << "                        or --iterations.\n"
       << "                        Use --buffer-size 0 to disable main memory latency, or --cache-size 0\n"
       << "                        to disable cache latency.\n"
+      << "      --kernel <name>   Main-memory kernel for --benchmark bandwidth and --patterns:\n"
+      << "                        neon or a generated matrix kernel\n"
+      << "                        generated-u<2|4|8>-w<16|32>-<t|nt>-pf<0|512>\n"
+      << "                        or tuned (cached --autotune-kernels winners for this CPU)\n"
+      << "                        (default: neon).\n"
+      << "                        Strided and random patterns keep NEON kernels with generated names.\n"
+      << "      --bandwidth-timeline\n"
+      << "                        Record a 1 ms bandwidth-vs-time series inside each timed bandwidth\n"
+      << "                        run and report steady-state bandwidth separately from ramp-up.\n"
+      << "                        Windows whose rate steps >10% are flagged as possible frequency\n"
+      << "                        transitions. Requires --benchmark; cannot be used with --only-latency.\n"
+      << "      --lock-buffers    mlock() every standard-mode phase buffer so pages cannot be compressed\n"
+      << "                        or reclaimed between loops; continues unlocked with a warning when\n"
+      << "                        RLIMIT_MEMLOCK or the wired-memory limit refuses. Resident pages and\n"
+      << "                        page faults are recorded per measurement either way. Requires --benchmark.\n"
       << "  -u, --non-cacheable   Apply cache-discouraging hints to src/dst buffers.\n"
       << "                        Uses madvise() hints to discourage caching, but does NOT provide\n"
       << "                        true non-cacheable memory (user-space cannot modify page tables).\n"
@@ -467,6 +619,44 @@ std::string report_tlb_inferred_entries_range(size_t min_entries, size_t max_ent
   return oss.str();
 }
 
+std::string report_tlb_effective_reach(size_t reach_bytes, size_t page_size_bytes) {
+  std::ostringstream oss;
+  oss << "  Effective Reach: ~" << format_binary_size(reach_bytes) << " ("
+      << format_binary_size(page_size_bytes) << " pages)";
+  return oss.str();
+}
+
+const std::string& report_tlb_page_granules_section() {
+  static const std::string msg = "[Page Granules]";
+  return msg;
+}
+
+const std::string& report_tlb_page_granules_scope() {
+  static const std::string msg =
+      "  Only the base page granule is measured; every TLB result above uses it.\n"
+      "  Larger granules are listed for reference and were not measured.";
+  return msg;
+}
+
+const std::string& tlb_page_granule_reason_block_mapping() {
+  static const std::string msg =
+      "block mappings cannot be requested from macOS user space";
+  return msg;
+}
+
+std::string report_tlb_page_granule(size_t page_size_bytes,
+                                    bool analyzed,
+                                    const std::string& reason) {
+  std::ostringstream oss;
+  oss << "  " << format_binary_size(page_size_bytes) << ": ";
+  if (analyzed) {
+    oss << "analyzed";
+  } else {
+    oss << "not analyzed (" << reason << ")";
+  }
+  return oss.str();
+}
+
 const std::string& report_tlb_private_cache_overlap() {
   static const std::string msg =
       "  Private Cache Overlap: yes (kept as ambiguous L1 TLB candidate)";
@@ -557,6 +747,33 @@ std::string report_tlb_large_locality_paired_unavailable(
   return oss.str();
 }
 
+std::string report_tlb_page_table_footprint_comparison(
+    size_t data_pages,
+    size_t page_stride_pages,
+    double table_spread_p50_ns,
+    double table_dense_p50_ns,
+    double page_walk_delta_p50_ns) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(Constants::LATENCY_PRECISION)
+      << "[Page-Table Footprint Comparison]\n"
+      << "  " << data_pages << " pages, one line each | table-spread every "
+      << page_stride_pages << " pages vs table-dense consecutive pages\n"
+      << "  P50: page-walk delta "
+      << normalize_tlb_display_latency(page_walk_delta_p50_ns)
+      << " ns/access (table-spread "
+      << normalize_tlb_display_latency(table_spread_p50_ns) << ", table-dense "
+      << normalize_tlb_display_latency(table_dense_p50_ns) << ")";
+  return oss.str();
+}
+
+const std::string& report_tlb_page_table_footprint_unavailable() {
+  static const std::string msg =
+      "[Page-Table Footprint Comparison]\n"
+      "  Result: N/A (requires a completed large-locality comparison and "
+      "8 buffer pages per node)";
+  return msg;
+}
+
 const std::string& report_tlb_large_locality_paired_interrupted() {
   static const std::string msg =
       "[Large-Locality Paired Comparison]\n"
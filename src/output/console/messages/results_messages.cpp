@@ -68,6 +68,22 @@ std::string results_copy_bandwidth(double bw_gb_s, double total_time) {
   return oss.str();
 }
 
+std::string results_bandwidth_timeline(double steady_gb_s, double ramp_up_seconds,
+                                       size_t transition_windows, size_t windows) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(Constants::BANDWIDTH_PRECISION);
+  oss << "         steady " << steady_gb_s << " GB/s after ";
+  oss << std::setprecision(Constants::TIME_PRECISION) << ramp_up_seconds << " s ramp-up, ";
+  oss << transition_windows << "/" << windows << " windows flagged as transitions";
+  return oss.str();
+}
+
+std::string results_bandwidth_timeline_unanalyzed(size_t windows) {
+  std::ostringstream oss;
+  oss << "         timeline: " << windows << " windows, too few to separate ramp-up";
+  return oss.str();
+}
+
 std::string results_main_memory_latency() {
   return "\nMain Memory Latency Test (single-threaded, pointer chase):";
 }
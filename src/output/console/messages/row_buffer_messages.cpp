@@ -0,0 +1,139 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file row_buffer_messages.cpp
+ * @brief Message helpers for standalone row-buffer mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <iomanip>
+#include <sstream>
+
+#include "messages_api.h"
+
+namespace Messages {
+
+const std::string& error_row_buffer_must_be_used_alone() {
+  static const std::string msg =
+      "--row-buffer allows only optional -o/--output <file>, -r/--count <rounds>, "
+      "-b/--buffer-size <MB>, -i/--iterations <count>, and --row-pairs <count>; "
+      "-h/--help prints help";
+  return msg;
+}
+
+std::string error_row_buffer_failed(const std::string& reason) {
+  return "Row-buffer probe failed: " + reason;
+}
+
+std::string msg_running_row_buffer(unsigned long buffer_size_mb,
+                                   size_t page_bytes,
+                                   size_t pairs,
+                                   int iterations) {
+  std::ostringstream oss;
+  oss << "\nRunning standalone DRAM row-buffer probe (" << buffer_size_mb << " MB buffer, "
+      << page_bytes / 1024 << " KB pages, " << pairs << " cross-page pairs, " << iterations
+      << " flush+reload iterations per sample)...";
+  return oss.str();
+}
+
+const std::string& report_row_buffer_header() {
+  static const std::string msg = "--- DRAM Row Buffer ---";
+  return msg;
+}
+
+const std::string& report_row_buffer_note() {
+  static const std::string msg =
+      "Each sample is a dependent load of two lines flushed to DRAM before every repetition. "
+      "reference pairs a line with itself. Page-offset flips below the different-bank cluster "
+      "are row hits; cross-page pairs split into row misses (other bank) and row conflicts "
+      "(same bank, other row). Excess is over the reference.";
+  return msg;
+}
+
+std::string report_row_buffer_latency_row(const std::string& label,
+                                          const std::optional<double>& latency_ns,
+                                          double reference_ns) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(1);
+  oss << "  " << std::left << std::setw(14) << label << std::right;
+  if (!latency_ns) {
+    oss << std::setw(10) << "n/a";
+    return oss.str();
+  }
+  oss << std::setw(10) << *latency_ns << " ns";
+  if (label != "reference") {
+    oss << "   excess " << std::showpos << *latency_ns - reference_ns << std::noshowpos << " ns";
+  }
+  return oss.str();
+}
+
+std::string report_row_buffer_clusters(bool separated,
+                                       double separation,
+                                       double conflict_fraction,
+                                       const std::optional<size_t>& estimated_banks) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(1);
+  if (!separated) {
+    oss << "  Cross-page latencies did not split into two clusters (separation " << separation
+        << " sd); caches beyond the point of coherency or a closed-page policy can hide "
+           "row conflicts.";
+    return oss.str();
+  }
+  oss << "  Clusters separated by " << separation << " sd; " << conflict_fraction * 100.0
+      << "% of pairs conflict";
+  if (estimated_banks) {
+    oss << " (about " << *estimated_banks << " banks)";
+  }
+  return oss.str();
+}
+
+const std::string& report_row_buffer_bits_header() {
+  static const std::string msg = "  flipped bit   offset        ns   class";
+  return msg;
+}
+
+std::string report_row_buffer_bit_row(size_t offset_bytes,
+                                      double latency_ns,
+                                      const std::string& classification) {
+  unsigned bit = 0;
+  while ((static_cast<size_t>(1) << (bit + 1)) <= offset_bytes) {
+    ++bit;
+  }
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(1);
+  oss << "  " << std::left << std::setw(14) << bit << std::right << std::setw(6) << offset_bytes
+      << std::setw(10) << latency_ns << "   " << classification;
+  return oss.str();
+}
+
+std::string report_row_buffer_physical(const std::string& status,
+                                       const std::vector<uint64_t>& bank_functions) {
+  std::ostringstream oss;
+  oss << "  Physical addresses: " << status;
+  if (bank_functions.empty()) {
+    oss << "; no bank functions inferred";
+    return oss.str();
+  }
+  oss << "; bank functions:" << std::hex;
+  for (uint64_t mask : bank_functions) {
+    oss << " 0x" << mask;
+  }
+  return oss.str();
+}
+
+}  // namespace Messages
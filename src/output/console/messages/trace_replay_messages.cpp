@@ -0,0 +1,200 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file trace_replay_messages.cpp
+ * @brief Message helpers for standalone trace replay mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <iomanip>
+#include <sstream>
+
+#include "messages_api.h"
+
+namespace Messages {
+
+const std::string& error_trace_replay_must_be_used_alone() {
+  static const std::string msg =
+      "--trace-replay <file> allows only optional -o/--output <file>, -r/--count <rounds>, "
+      "--sample-ms <ms>, and --speed-of-light; -h/--help prints help";
+  return msg;
+}
+
+std::string error_trace_replay_file(const std::string& path, const std::string& reason) {
+  return "Trace file '" + path + "' " + reason;
+}
+
+std::string error_trace_replay_record(uint64_t record, const std::string& reason) {
+  return "has a malformed record " + std::to_string(record) + ": " + reason;
+}
+
+std::string error_trace_replay_failed(const std::string& reason) {
+  return "Trace replay failed: " + reason;
+}
+
+std::string trace_replay_reason_short_header(size_t header_bytes) {
+  return "is shorter than the " + std::to_string(header_bytes) + "-byte trace header";
+}
+
+std::string trace_replay_reason_bad_magic(const std::string& magic) {
+  return "does not start with " + magic;
+}
+
+std::string trace_replay_reason_version(uint64_t version, uint64_t supported_version) {
+  return "has format version " + std::to_string(version) + "; only version " +
+         std::to_string(supported_version) + " is supported";
+}
+
+const std::string& trace_replay_reason_reserved_fields() {
+  static const std::string msg = "sets reserved header fields";
+  return msg;
+}
+
+const std::string& trace_replay_reason_no_records() {
+  static const std::string msg = "holds no records";
+  return msg;
+}
+
+std::string trace_replay_reason_too_many_records(uint64_t records, uint64_t maximum) {
+  return "holds " + std::to_string(records) + " records, more than the limit of " +
+         std::to_string(maximum);
+}
+
+const std::string& trace_replay_reason_record_missing() {
+  static const std::string msg = "the file ends before it";
+  return msg;
+}
+
+std::string trace_replay_reason_control_byte(unsigned control) {
+  return "invalid control byte " + std::to_string(control);
+}
+
+const std::string& trace_replay_reason_thread_id() {
+  static const std::string msg = "truncated or oversized thread id";
+  return msg;
+}
+
+const std::string& trace_replay_reason_address_delta() {
+  static const std::string msg = "truncated or oversized address delta";
+  return msg;
+}
+
+const std::string& trace_replay_reason_address_overflow() {
+  static const std::string msg = "access runs past the address space";
+  return msg;
+}
+
+std::string trace_replay_reason_too_many_threads(size_t maximum) {
+  return "traces more than " + std::to_string(maximum) + " threads";
+}
+
+std::string trace_replay_reason_trailing_bytes(size_t bytes) {
+  return "has " + std::to_string(bytes) + " bytes after its last record";
+}
+
+std::string trace_replay_reason_too_many_pages(size_t pages, size_t maximum_pages) {
+  return "touches " + std::to_string(pages) + " pages, more than the " +
+         std::to_string(maximum_pages) + "-page replay buffer limit";
+}
+
+std::string trace_replay_reason_open_failed(const std::string& system_error) {
+  return "cannot be opened: " + system_error;
+}
+
+std::string trace_replay_reason_stat_failed(const std::string& system_error) {
+  return "cannot be inspected: " + system_error;
+}
+
+std::string trace_replay_reason_map_failed(const std::string& system_error) {
+  return "cannot be mapped: " + system_error;
+}
+
+std::string msg_running_trace_replay(const std::string& trace_file,
+                                     uint64_t records,
+                                     size_t threads,
+                                     size_t buffer_bytes,
+                                     uint64_t address_span_bytes,
+                                     bool speed_of_light) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(1);
+  oss << "\nRunning standalone trace replay of " << trace_file << " (" << records
+      << " records, " << threads << " threads, "
+      << static_cast<double>(buffer_bytes) / (1024.0 * 1024.0) << " MiB buffer for a "
+      << static_cast<double>(address_span_bytes) / (1024.0 * 1024.0 * 1024.0)
+      << " GiB address span, "
+      << (speed_of_light ? "dependencies dropped" : "dependencies kept") << ")...";
+  return oss.str();
+}
+
+std::string msg_trace_replay_plan(int passes, int sample_ms) {
+  return "Each sample replays the trace " + std::to_string(passes) +
+         (passes == 1 ? " time" : " times") + " (at least " + std::to_string(sample_ms) +
+         " ms) in trace order and in shuffled order.";
+}
+
+const std::string& report_trace_replay_header() {
+  static const std::string msg = "--- Trace Replay ---";
+  return msg;
+}
+
+const std::string& report_trace_replay_note(bool speed_of_light) {
+  static const std::string kept =
+      "GB/s counts traced access sizes over the wall time of all workers. Dependent records "
+      "wait for the thread's previous load. The shuffled control replays the same accesses "
+      "per thread in random order.";
+  static const std::string dropped =
+      "GB/s counts traced access sizes over the wall time of all workers. Speed of light: "
+      "dependency bits are ignored, so only bandwidth and order limit the replay. The shuffled "
+      "control replays the same accesses per thread in random order.";
+  return speed_of_light ? dropped : kept;
+}
+
+const std::string& report_trace_replay_table_header() {
+  static const std::string msg = "  order              GB/s    Mops/s     CV";
+  return msg;
+}
+
+const std::string& report_trace_replay_trace_order_label() {
+  static const std::string msg = "trace order";
+  return msg;
+}
+
+const std::string& report_trace_replay_shuffled_label() {
+  static const std::string msg = "shuffled";
+  return msg;
+}
+
+std::string report_trace_replay_row(const std::string& order,
+                                    double gb_s,
+                                    double mops,
+                                    double cv_pct) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(2);
+  oss << "  " << std::left << std::setw(15) << order << std::right << std::setw(9) << gb_s
+      << std::setw(10) << mops << std::setprecision(1) << std::setw(6) << cv_pct << "%";
+  return oss.str();
+}
+
+std::string report_trace_replay_speedup(double order_speedup) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(2);
+  oss << "  Trace order runs " << order_speedup << "x as fast as the shuffled control";
+  return oss.str();
+}
+
+}  // namespace Messages
@@ -84,6 +84,28 @@ std::string warning_tlb_mlock_failed(
   return oss.str();
 }
 
+std::string warning_tlb_chain_reuse_unavailable(const std::string& pass_name,
+                                                size_t layout_identities) {
+  std::ostringstream oss;
+  oss << "--tlb-chain-layouts " << layout_identities << " requested, but the "
+      << pass_name
+      << " pass's largest chain region does not fit the TLB analysis buffer; "
+         "rebuilding every chain in this pass.";
+  return oss.str();
+}
+
+std::string warning_buffer_lock_failed(int error_code,
+                                       const std::string& error_message,
+                                       const std::optional<uint64_t>& memlock_limit_bytes) {
+  std::ostringstream oss;
+  oss << "--lock-buffers: mlock() failed (errno " << error_code << ": " << error_message << ")";
+  if (memlock_limit_bytes.has_value()) {
+    oss << " with RLIMIT_MEMLOCK " << *memlock_limit_bytes << " bytes";
+  }
+  oss << "; continuing unlocked. Residency and page faults are still reported per measurement.";
+  return oss.str();
+}
+
 const std::string& warning_core_count_detection_failed() {
   static const std::string msg = "Failed to detect core count, defaulting to 1.";
   return msg;
@@ -145,4 +167,18 @@ std::string warning_benchmark_high_cv(const std::string& metric_name,
   return oss.str();
 }
 
+std::string warning_core_frequency_drift(const std::string& measurement_name,
+                                         double min_ghz,
+                                         double max_ghz,
+                                         double drift_pct,
+                                         double threshold_pct) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(2)
+      << measurement_name << " core frequency varied " << min_ghz << "-"
+      << max_ghz << " GHz across loops (" << std::setprecision(1) << drift_pct
+      << "% > " << threshold_pct
+      << "% drift threshold); compare core_frequency.normalized_value in JSON";
+  return oss.str();
+}
+
 } // namespace Messages
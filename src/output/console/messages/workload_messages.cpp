@@ -0,0 +1,255 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file workload_messages.cpp
+ * @brief Message helpers for standalone workload mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <iomanip>
+#include <sstream>
+
+#include "messages_api.h"
+
+namespace Messages {
+
+const std::string& error_workload_must_be_used_alone() {
+  static const std::string msg =
+      "--workload <file> allows only optional -o/--output <file>, -r/--count <rounds>, "
+      "--sample-ms <ms>, and --seed <uint64>; -h/--help prints help";
+  return msg;
+}
+
+std::string error_workload_file(const std::string& path, const std::string& reason) {
+  return "Workload file '" + path + "' " + reason;
+}
+
+std::string error_workload_line(size_t line, const std::string& reason) {
+  return "has an error on line " + std::to_string(line) + ": " + reason;
+}
+
+std::string error_workload_stream_too_small(const std::string& group, const std::string& stream,
+                                            size_t line, const std::string& reason) {
+  return "Workload stream '" + group + "/" + stream + "' (line " + std::to_string(line) +
+         ") cannot be scheduled: " + reason;
+}
+
+std::string error_workload_failed(const std::string& reason) {
+  return "Workload run failed: " + reason;
+}
+
+const std::string& error_workload_no_group() {
+  static const std::string msg = "defines no group";
+  return msg;
+}
+
+const std::string& workload_reason_file_unreadable() {
+  static const std::string msg = "cannot be opened";
+  return msg;
+}
+
+std::string workload_reason_file_too_large(size_t maximum_bytes) {
+  return "is larger than " + std::to_string(maximum_bytes) + " bytes";
+}
+
+const std::string& workload_reason_group_syntax() {
+  static const std::string msg =
+      "expected 'group <name> [threads=<count>]' with a name of letters, digits, '_', '-'";
+  return msg;
+}
+
+std::string workload_reason_group_setting(const std::string& token) {
+  return "unexpected '" + token + "'; groups take one threads=<count>";
+}
+
+std::string workload_reason_thread_range(int maximum) {
+  return "threads must be between 1 and " + std::to_string(maximum);
+}
+
+std::string workload_reason_group_duplicate(const std::string& group) {
+  return "group '" + group + "' is already defined";
+}
+
+std::string workload_reason_thread_total(int maximum) {
+  return "groups use more than " + std::to_string(maximum) + " threads in total";
+}
+
+std::string workload_reason_group_without_stream(const std::string& group) {
+  return "group '" + group + "' has no stream";
+}
+
+const std::string& workload_reason_stream_syntax() {
+  static const std::string msg =
+      "expected 'stream <name> <read|write> <pattern> region=<size> [weight=<n>] ...'";
+  return msg;
+}
+
+std::string workload_reason_unknown_operation(const std::string& operation) {
+  return "unknown operation '" + operation + "'; expected read or write";
+}
+
+std::string workload_reason_unknown_pattern(const std::string& pattern) {
+  return "unknown pattern '" + pattern + "'; expected sequential, strided, random, zipf, or chase";
+}
+
+const std::string& workload_reason_chase_write() {
+  static const std::string msg = "chase streams only read";
+  return msg;
+}
+
+std::string workload_reason_expected_setting(const std::string& token) {
+  return "expected key=value, got '" + token + "'";
+}
+
+const std::string& workload_reason_region_size() {
+  static const std::string msg =
+      "region must be a positive size such as 65536, 64KiB, 256MiB, or 1GiB";
+  return msg;
+}
+
+std::string workload_reason_weight_range(unsigned maximum) {
+  return "weight must be between 1 and " + std::to_string(maximum);
+}
+
+std::string workload_reason_stride(size_t access_bytes) {
+  return "stride must be a multiple of " + std::to_string(access_bytes) + " bytes and at least " +
+         std::to_string(2 * access_bytes);
+}
+
+std::string workload_reason_theta_range(double maximum) {
+  std::ostringstream oss;
+  oss << "theta must be greater than 0 and at most " << maximum;
+  return oss.str();
+}
+
+std::string workload_reason_unexpected_setting(const std::string& key, const std::string& pattern) {
+  return "unexpected or repeated setting '" + key + "' for a " + pattern + " stream";
+}
+
+const std::string& workload_reason_region_missing() {
+  static const std::string msg = "stream needs region=<size>";
+  return msg;
+}
+
+const std::string& workload_reason_stride_missing() {
+  static const std::string msg = "strided streams need stride=<bytes>";
+  return msg;
+}
+
+const std::string& workload_reason_stream_before_group() {
+  static const std::string msg = "stream before the first group";
+  return msg;
+}
+
+std::string workload_reason_stream_duplicate(const std::string& stream, const std::string& group) {
+  return "stream '" + stream + "' is already defined in group '" + group + "'";
+}
+
+std::string workload_reason_stream_limit(size_t maximum) {
+  return "a group holds at most " + std::to_string(maximum) + " streams";
+}
+
+std::string workload_reason_unknown_directive(const std::string& directive) {
+  return "unknown directive '" + directive + "'; expected group or stream";
+}
+
+const std::string& workload_reason_stride_overflow() {
+  static const std::string msg = "the stride overflows one slice";
+  return msg;
+}
+
+std::string workload_reason_region_below_access(size_t access_bytes) {
+  return "the region must hold one " + std::to_string(access_bytes) + "-byte access";
+}
+
+std::string workload_reason_partition_too_small(size_t threads, size_t minimum_bytes) {
+  return "each of " + std::to_string(threads) + " workers needs at least " +
+         std::to_string(minimum_bytes) + " bytes of the region";
+}
+
+std::string msg_running_workload(const std::string& workload_file,
+                                 size_t groups,
+                                 size_t streams,
+                                 size_t threads,
+                                 size_t region_bytes,
+                                 int sample_ms) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(1);
+  oss << "\nRunning standalone workload " << workload_file << " (" << groups << " groups, "
+      << streams << " streams, " << threads << " threads, "
+      << static_cast<double>(region_bytes) / (1024.0 * 1024.0) << " MiB of regions, "
+      << sample_ms << " ms busy time per worker and sample)...";
+  return oss.str();
+}
+
+const std::string& report_workload_header() {
+  static const std::string msg = "--- Workload Streams ---";
+  return msg;
+}
+
+const std::string& report_workload_note() {
+  static const std::string msg =
+      "GB/s is a stream's bytes over the sample's wall time, so stream rows add up to the "
+      "aggregate. ns/acc is one worker's slice time per 32-byte access (8-byte load for chase). "
+      "share is the stream's part of its group's bytes next to the weight it asked for.";
+  return msg;
+}
+
+const std::string& report_workload_table_header() {
+  static const std::string msg =
+      "  stream                    op     pattern     thr   share  target     GB/s   ns/acc     CV";
+  return msg;
+}
+
+std::string report_workload_row(const std::string& name,
+                                const std::string& operation,
+                                const std::string& pattern,
+                                int threads,
+                                double achieved_share,
+                                double requested_share,
+                                double gb_s,
+                                double ns_per_access,
+                                double cv_pct) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(1);
+  oss << "  " << std::left << std::setw(26) << name << std::setw(7) << operation << std::setw(11)
+      << pattern << std::right << std::setw(4) << threads << std::setw(7)
+      << achieved_share * 100.0 << "%" << std::setw(7) << requested_share * 100.0 << "%"
+      << std::setprecision(2) << std::setw(9) << gb_s << std::setw(9) << ns_per_access
+      << std::setprecision(1) << std::setw(6) << cv_pct << "%";
+  return oss.str();
+}
+
+std::string report_workload_aggregate(double gb_s,
+                                      size_t threads,
+                                      double cv_pct,
+                                      bool has_chase,
+                                      double chase_ns) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(2);
+  oss << "  Aggregate: " << gb_s << " GB/s over " << threads << " threads (CV "
+      << std::setprecision(1) << cv_pct << "%)";
+  if (has_chase) {
+    oss << "; pointer-chase latency " << chase_ns << " ns/load";
+  } else {
+    oss << "; no chase stream, so no latency figure";
+  }
+  return oss.str();
+}
+
+}  // namespace Messages
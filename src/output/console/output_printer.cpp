@@ -39,6 +39,23 @@ std::string unavailable_measurement(const std::string& label,
       measurement.status_reason);
 }
 
+// Only measurements recorded with --bandwidth-timeline carry a summary.
+void print_bandwidth_timeline(const BenchmarkMeasurement& measurement) {
+  if (!measurement.is_measured() || !measurement.timeline.has_value()) {
+    return;
+  }
+  const BandwidthTimelineSummary& timeline = *measurement.timeline;
+  if (!timeline.analyzed) {
+    std::cout << Messages::results_bandwidth_timeline_unanalyzed(timeline.windows.size())
+              << std::endl;
+    return;
+  }
+  std::cout << Messages::results_bandwidth_timeline(
+                   *timeline.steady_state_bandwidth_gb_s, timeline.ramp_up_seconds,
+                   timeline.transition_window_count, timeline.windows.size())
+            << std::endl;
+}
+
 void print_cache_buffer_suffix(size_t buffer_size) {
   if (buffer_size < 1024) {
     std::cout << Messages::results_buffer_size_bytes(buffer_size) << std::endl;
@@ -263,6 +280,7 @@ void print_results(int loop, const BenchmarkConfig& config,
                       : unavailable_measurement("  Read ",
                                                 results.main_read_bandwidth))
               << std::endl;
+    print_bandwidth_timeline(results.main_read_bandwidth);
     std::cout << (results.main_write_bandwidth.is_measured()
                       ? Messages::results_write_bandwidth(
                             *results.main_write_bandwidth.value,
@@ -270,6 +288,7 @@ void print_results(int loop, const BenchmarkConfig& config,
                       : unavailable_measurement("  Write",
                                                 results.main_write_bandwidth))
               << std::endl;
+    print_bandwidth_timeline(results.main_write_bandwidth);
     std::cout << (results.main_copy_bandwidth.is_measured()
                       ? Messages::results_copy_bandwidth(
                             *results.main_copy_bandwidth.value,
@@ -277,6 +296,7 @@ void print_results(int loop, const BenchmarkConfig& config,
                       : unavailable_measurement("  Copy ",
                                                 results.main_copy_bandwidth))
               << std::endl;
+    print_bandwidth_timeline(results.main_copy_bandwidth);
   }
 
   // Display main memory latency test results (skip if only bandwidth tests
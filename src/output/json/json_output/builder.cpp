@@ -57,6 +57,23 @@ nlohmann::json build_config_json(const BenchmarkConfig& config, const char* mode
   config_json[JsonKeys::MACOS_VERSION] = config.macos_version;
   config_json[JsonKeys::PERFORMANCE_CORES] = config.perf_cores;
   config_json[JsonKeys::EFFICIENCY_CORES] = config.eff_cores;
+  config_json["memory_kernel_variant"] =
+      memory_kernel_variant_to_string(config.memory_kernel_variant);
+  config_json["memory_kernel"] =
+      config.memory_kernel_name.empty()
+          ? std::string(memory_kernel_variant_to_string(config.memory_kernel_variant))
+          : config.memory_kernel_name;
+  config_json["memory_kernel_selection_policy"] =
+      config.memory_kernel_name.empty() ? "default-neon-main-memory-only"
+      : config.memory_kernel_variant == MemoryKernelVariant::Tuned ? "autotune-cache"
+                                                                   : "explicit-kernel-name";
+  if (config.memory_kernel_variant == MemoryKernelVariant::Tuned) {
+    config_json["tuned_memory_kernels"] = {{"read", config.tuned_read_kernel},
+                                           {"write", config.tuned_write_kernel},
+                                           {"copy", config.tuned_copy_kernel}};
+  }
+  config_json["bandwidth_timeline"] = config.bandwidth_timeline;
+  config_json["lock_buffers"] = config.lock_buffers;
   config_json[JsonKeys::TOTAL_THREADS] = config.num_threads;
   config_json[JsonKeys::USE_CUSTOM_CACHE_SIZE] = config.use_custom_cache_size;
   config_json[JsonKeys::USE_NON_CACHEABLE] = config.use_non_cacheable;
@@ -113,6 +113,15 @@ namespace JsonKeys {
   constexpr const char* STRIDED_16384 = "strided_16384";
   constexpr const char* STRIDED_2MB = "strided_2mb";
   constexpr const char* RANDOM = "random";
+  constexpr const char* GATHER_SCATTER_SCALAR = "gather_scatter_scalar";
+  constexpr const char* GATHER_SCATTER_NEON = "gather_scatter_neon";
+  constexpr const char* SKEWED_ZIPF = "skewed_zipf";
+  constexpr const char* SKEWED_HOT_COLD = "skewed_hot_cold";
+  constexpr const char* SKEWED_SHIFTING_HOT_SET = "skewed_shifting_hot_set";
+  constexpr const char* MATRIX_ROW_MAJOR = "matrix_row_major";
+  constexpr const char* MATRIX_COLUMN_MAJOR = "matrix_column_major";
+  constexpr const char* MATRIX_TILED = "matrix_tiled";
+  constexpr const char* MATRIX_TRANSPOSE = "matrix_transpose";
 }
 
 nlohmann::json build_config_json(const BenchmarkConfig& config, const char* mode_name);
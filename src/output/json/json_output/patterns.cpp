@@ -20,7 +20,8 @@
  * @date 2025
  *
  * This file builds the JSON structure for pattern benchmark results including
- * sequential (forward/reverse), strided (64B/4096B), and random access patterns.
+ * sequential (forward/reverse), strided (64B/4096B), random, gather/scatter, skewed, and 2D matrix
+ * access patterns.
  * Each pattern includes bandwidth measurements (read/write/copy) with values
  * and optional statistical aggregation.
  */
@@ -56,7 +57,9 @@ nlohmann::json serialize_pattern_measurement(const PatternMeasurement& measureme
   output["effective_threads"] = measurement.effective_threads;
   output["accesses_per_pass"] = measurement.accesses_per_pass;
   output["accesses_per_pass_semantics"] =
-      measurement.stride_bytes > 0 ? "phase-zero-count" : "constant-count";
+      measurement.stride_bytes > 0 && !measurement.matrix_shape.has_value()
+          ? "phase-zero-count"
+          : "constant-count";
   output["min_accesses_per_pass"] = measurement.min_accesses_per_pass;
   output["max_accesses_per_pass"] = measurement.max_accesses_per_pass;
   output["passes"] = measurement.passes;
@@ -66,6 +69,18 @@ nlohmann::json serialize_pattern_measurement(const PatternMeasurement& measureme
   output["logical_working_set_bytes"] = measurement.logical_working_set_bytes;
   output["completed_phase_cycles"] = measurement.completed_phase_cycles;
   output["phase_period_passes"] = measurement.phase_period_passes;
+  output["indices_per_group"] = measurement.indices_per_group == 0
+                                    ? nlohmann::json(nullptr)
+                                    : nlohmann::json(measurement.indices_per_group);
+  output["kernel_variant"] = measurement.kernel_variant.empty()
+                                 ? nlohmann::json(nullptr)
+                                 : nlohmann::json(measurement.kernel_variant);
+  output["l1_hit_ratio_proxy"] = measurement.l1_hit_ratio_proxy.has_value()
+                                     ? nlohmann::json(*measurement.l1_hit_ratio_proxy)
+                                     : nlohmann::json(nullptr);
+  output["l2_hit_ratio_proxy"] = measurement.l2_hit_ratio_proxy.has_value()
+                                     ? nlohmann::json(*measurement.l2_hit_ratio_proxy)
+                                     : nlohmann::json(nullptr);
   output["native_page_size_bytes"] = measurement.native_page_size_bytes;
   output["stride_equals_native_page_size"] =
       measurement.stride_equals_native_page_size;
@@ -188,6 +203,69 @@ nlohmann::json build_pattern_json(const PatternStatistics& stats,
   output["seed"] = representative != nullptr && representative->has_seed
                        ? nlohmann::json(std::to_string(representative->seed))
                        : nlohmann::json(nullptr);
+  if (kind == PatternKind::GatherScatterScalar ||
+      kind == PatternKind::GatherScatterNeon) {
+    output["indices_per_group"] = Constants::PATTERN_GATHER_GROUP_INDICES;
+    output["kernel"] = kind == PatternKind::GatherScatterNeon
+                           ? "neon-register-offset"
+                           : "scalar";
+    output["operation_semantics"] = {{"read", "gather"},
+                                     {"write", "scatter"},
+                                     {"copy", "gather-scatter"}};
+  }
+  if (kind == PatternKind::SkewedZipf || kind == PatternKind::SkewedHotCold ||
+      kind == PatternKind::SkewedShiftingHotSet) {
+    output["distribution"] = kind == PatternKind::SkewedZipf      ? "zipf"
+                             : kind == PatternKind::SkewedHotCold ? "hot-cold"
+                                                                  : "shifting-hot-set";
+    output["sampling"] = "with-replacement";
+    output["hit_ratio_proxy_semantics"] = "ideal-frequency-pinned-lines";
+    output["hit_ratio_proxy_line_bytes"] = Constants::CACHE_LINE_SIZE_BYTES;
+    if (representative != nullptr && representative->skew_parameters.has_value()) {
+      const PatternSkewParameters& parameters = *representative->skew_parameters;
+      if (kind == PatternKind::SkewedZipf) {
+        output["zipf_theta"] = parameters.zipf_theta;
+      } else {
+        output["hot_fraction"] = parameters.hot_fraction;
+        output["hot_probability"] = parameters.hot_probability;
+        output["phases"] = parameters.phases;
+      }
+      output["l1_hit_ratio_proxy"] = representative->l1_hit_ratio_proxy.has_value()
+                                         ? nlohmann::json(*representative->l1_hit_ratio_proxy)
+                                         : nlohmann::json(nullptr);
+      output["l2_hit_ratio_proxy"] = representative->l2_hit_ratio_proxy.has_value()
+                                         ? nlohmann::json(*representative->l2_hit_ratio_proxy)
+                                         : nlohmann::json(nullptr);
+    }
+  }
+
+  if (kind == PatternKind::MatrixRowMajor || kind == PatternKind::MatrixColumnMajor ||
+      kind == PatternKind::MatrixTiled || kind == PatternKind::MatrixTranspose) {
+    output["layout"] = kind == PatternKind::MatrixRowMajor      ? "row-major"
+                       : kind == PatternKind::MatrixColumnMajor ? "column-major"
+                       : kind == PatternKind::MatrixTiled       ? "tiled"
+                                                                : "transpose";
+    output["element_bytes"] = Constants::PATTERN_MATRIX_ELEMENT_BYTES;
+    output["worker_partition"] =
+        kind == PatternKind::MatrixTiled || kind == PatternKind::MatrixTranspose
+            ? "tile-row-bands"
+            : "row-bands";
+    if (kind == PatternKind::MatrixTranspose) {
+      output["operation_semantics"] = {{"read", "not-applicable"},
+                                       {"write", "not-applicable"},
+                                       {"copy", "out-of-place-transpose"}};
+      output["destination_layout"] = "dense-transposed";
+    }
+    if (representative != nullptr && representative->matrix_shape.has_value()) {
+      const PatternMatrixShape& shape = *representative->matrix_shape;
+      output["rows"] = shape.rows;
+      output["row_bytes"] = shape.row_bytes;
+      output["pitch_bytes"] = shape.pitch_bytes;
+      output["pitch_power_of_two"] =
+          shape.pitch_bytes != 0 && (shape.pitch_bytes & (shape.pitch_bytes - 1)) == 0;
+      output["tile_elements"] = shape.tile_elements;
+    }
+  }
 
   output[JsonKeys::BANDWIDTH] = {
       {JsonKeys::READ_GB_S,
@@ -221,6 +299,24 @@ nlohmann::json build_patterns_json(const PatternStatistics& stats) {
       stats, PatternKind::Strided2MiB);
   patterns[JsonKeys::RANDOM] = build_pattern_json(
       stats, PatternKind::Random);
+  patterns[JsonKeys::GATHER_SCATTER_SCALAR] = build_pattern_json(
+      stats, PatternKind::GatherScatterScalar);
+  patterns[JsonKeys::GATHER_SCATTER_NEON] = build_pattern_json(
+      stats, PatternKind::GatherScatterNeon);
+  patterns[JsonKeys::SKEWED_ZIPF] = build_pattern_json(
+      stats, PatternKind::SkewedZipf);
+  patterns[JsonKeys::SKEWED_HOT_COLD] = build_pattern_json(
+      stats, PatternKind::SkewedHotCold);
+  patterns[JsonKeys::SKEWED_SHIFTING_HOT_SET] = build_pattern_json(
+      stats, PatternKind::SkewedShiftingHotSet);
+  patterns[JsonKeys::MATRIX_ROW_MAJOR] = build_pattern_json(
+      stats, PatternKind::MatrixRowMajor);
+  patterns[JsonKeys::MATRIX_COLUMN_MAJOR] = build_pattern_json(
+      stats, PatternKind::MatrixColumnMajor);
+  patterns[JsonKeys::MATRIX_TILED] = build_pattern_json(
+      stats, PatternKind::MatrixTiled);
+  patterns[JsonKeys::MATRIX_TRANSPOSE] = build_pattern_json(
+      stats, PatternKind::MatrixTranspose);
   
   return patterns;
 }
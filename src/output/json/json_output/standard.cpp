@@ -13,10 +13,13 @@
 #include "output/json/json_output/json_output_api.h"
 
 #include <cmath>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "benchmark/benchmark_runner.h"
+#include "benchmark/buffer_residency.h"
+#include "benchmark/core_frequency_probe.h"
 #include "core/config/config.h"
 #include "core/config/constants.h"
 #include "utils/json_utils.h"
@@ -25,6 +28,83 @@ namespace {
 
 using MeasurementMember = BenchmarkMeasurement BenchmarkResults::*;
 
+nlohmann::json timeline_json(const BandwidthTimelineSummary& timeline) {
+  nlohmann::json json;
+  json["sample_interval_seconds"] =
+      Constants::BANDWIDTH_TIMELINE_SAMPLE_INTERVAL_SECONDS;
+  json["progress_block_bytes"] =
+      Constants::BANDWIDTH_TIMELINE_PROGRESS_BLOCK_BYTES;
+  json["analyzed"] = timeline.analyzed;
+  json["ramp_up_seconds"] = timeline.ramp_up_seconds;
+  json["ramp_up_bandwidth_gb_s"] =
+      timeline.ramp_up_bandwidth_gb_s.has_value()
+          ? nlohmann::json(*timeline.ramp_up_bandwidth_gb_s)
+          : nlohmann::json(nullptr);
+  json["steady_state_bandwidth_gb_s"] =
+      timeline.steady_state_bandwidth_gb_s.has_value()
+          ? nlohmann::json(*timeline.steady_state_bandwidth_gb_s)
+          : nlohmann::json(nullptr);
+  json["transition_window_count"] = timeline.transition_window_count;
+  json["windows"] = nlohmann::json::array();
+  for (const BandwidthTimelineWindow& window : timeline.windows) {
+    json["windows"].push_back(
+        {{"start_seconds", window.start_seconds},
+         {"end_seconds", window.end_seconds},
+         {"bandwidth_gb_s", window.bandwidth_gb_s},
+         {"phase", bandwidth_timeline_phase_to_string(window.phase)},
+         {"frequency_transition", window.frequency_transition}});
+  }
+  return json;
+}
+
+// Bandwidth normalizes to bytes per core cycle and latency to core cycles, so
+// loops that ran at different clocks can be compared directly.
+nlohmann::json core_frequency_json(const BenchmarkMeasurement& measurement) {
+  const CoreFrequencySummary& frequency = *measurement.core_frequency;
+  nlohmann::json json;
+  json["probe_dependent_adds"] = Constants::CORE_FREQUENCY_PROBE_ADD_GROUPS *
+                                 Constants::CORE_FREQUENCY_PROBE_ADDS_PER_GROUP;
+  json["assumed_adds_per_cycle"] = Constants::CORE_FREQUENCY_PROBE_ADDS_PER_CYCLE;
+  json["before_ghz"] = frequency.before_ghz;
+  json["after_ghz"] = frequency.after_ghz;
+  json["min_ghz"] = frequency.min_ghz;
+  json["max_ghz"] = frequency.max_ghz;
+  json["effective_ghz"] = frequency.effective_ghz;
+  json["within_measurement_drift_pct"] = frequency.within_measurement_drift_pct;
+  const bool latency = measurement.operation == "latency";
+  if (measurement.value.has_value() && frequency.effective_ghz > 0.0) {
+    json["normalized_value"] = latency
+                                   ? *measurement.value * frequency.effective_ghz
+                                   : *measurement.value / frequency.effective_ghz;
+  } else {
+    json["normalized_value"] = nullptr;
+  }
+  json["normalized_unit"] = latency ? "cycles" : "bytes-per-cycle";
+  return json;
+}
+
+template <typename T>
+nlohmann::json optional_json(const std::optional<T>& value) {
+  return value.has_value() ? nlohmann::json(*value) : nlohmann::json(nullptr);
+}
+
+// took_page_faults flags a timed run that faulted: its pages were not all
+// resident and wired, so part of the measured time went to the VM system.
+nlohmann::json residency_json(const BufferResidency& residency) {
+  nlohmann::json json;
+  json["lock_requested"] = residency.lock_requested;
+  json["locked"] = residency.locked;
+  json["lock_errno"] =
+      residency.lock_error != 0 ? nlohmann::json(residency.lock_error) : nlohmann::json(nullptr);
+  json["buffer_pages"] = residency.buffer_pages;
+  json["resident_pages_before"] = optional_json(residency.resident_pages_before);
+  json["resident_pages_after"] = optional_json(residency.resident_pages_after);
+  json["minor_faults"] = residency.minor_faults;
+  json["major_faults"] = residency.major_faults;
+  json["took_page_faults"] = buffer_residency_took_faults(residency);
+  return json;
+}
+
 nlohmann::json measurement_json(const BenchmarkMeasurement& measurement,
                                 size_t loop_index) {
   nlohmann::json json;
@@ -39,6 +119,11 @@ nlohmann::json measurement_json(const BenchmarkMeasurement& measurement,
   }
   json["target"] = measurement.target;
   json["operation"] = measurement.operation;
+  if (measurement.kernel_variant.empty()) {
+    json["kernel_variant"] = nullptr;
+  } else {
+    json["kernel_variant"] = measurement.kernel_variant;
+  }
   json["work_policy"] = measurement.work_policy;
   json["buffer_size_bytes"] = measurement.buffer_size_bytes;
   json["passes"] = measurement.passes;
@@ -72,6 +157,19 @@ nlohmann::json measurement_json(const BenchmarkMeasurement& measurement,
       json["sample_seeds"].push_back(std::to_string(seed));
     }
   }
+  if (measurement.timeline.has_value()) {
+    json["timeline"] = timeline_json(*measurement.timeline);
+  }
+  if (measurement.core_frequency.has_value()) {
+    json["core_frequency"] = core_frequency_json(measurement);
+  } else {
+    json["core_frequency"] = nullptr;
+  }
+  if (measurement.residency.has_value()) {
+    json["residency"] = residency_json(*measurement.residency);
+  } else {
+    json["residency"] = nullptr;
+  }
   return json;
 }
 
@@ -172,6 +270,33 @@ nlohmann::json aggregate_json(const BenchmarkStatistics& stats,
   } else {
     quality["cv_warning"] = nullptr;
   }
+  std::vector<double> frequencies;
+  for (const BenchmarkResults& loop : stats.loop_results) {
+    const BenchmarkMeasurement& measurement = loop.*member;
+    if (measurement.is_measured() && measurement.core_frequency.has_value()) {
+      frequencies.push_back(measurement.core_frequency->effective_ghz);
+    }
+  }
+  quality["core_frequency_drift_threshold_pct"] =
+      Constants::CORE_FREQUENCY_DRIFT_WARNING_PCT;
+  if (frequencies.size() >= 2) {
+    const double drift_pct = core_frequency_drift_pct(frequencies);
+    quality["core_frequency_drift_pct"] = drift_pct;
+    quality["core_frequency_drift_warning"] =
+        drift_pct > Constants::CORE_FREQUENCY_DRIFT_WARNING_PCT;
+  } else {
+    quality["core_frequency_drift_pct"] = nullptr;
+    quality["core_frequency_drift_warning"] = nullptr;
+  }
+  size_t faulted_loops = 0;
+  for (const BenchmarkResults& loop : stats.loop_results) {
+    const BenchmarkMeasurement& measurement = loop.*member;
+    if (measurement.residency.has_value() &&
+        buffer_residency_took_faults(*measurement.residency)) {
+      ++faulted_loops;
+    }
+  }
+  quality["page_faulted_loops"] = faulted_loops;
   aggregate["quality"] = quality;
 
   if (include_pooled_samples) {
@@ -27,22 +27,32 @@
  * - Sequential forward: Standard linear memory access (baseline)
  * - Sequential reverse: Backward linear memory access
  * - Random uniform: Pseudo-random memory access at cache-line-aligned offsets
+ * - Gather/scatter: 8-byte indexed elements from the random index stream,
+ *   scalar baseline and NEON-register kernels sharing one work plan
+ * - Skewed: Zipf, hot/cold, and shifting hot-set streams sampled with
+ *   replacement and executed through the random kernels
+ * - 2D matrix: row-major, column-major, tiled, and out-of-place transpose over a
+ *   pitched matrix view, partitioned into row or tile-row bands
  */
 #include "pattern_benchmark/pattern_benchmark.h"
 #include "pattern_benchmark/pattern_work_plan.h"
 #include "utils/benchmark.h"
+#include "benchmark/memory_kernels.h"
 #include "core/memory/buffer_manager.h"
 #include "core/config/config.h"
 #include "core/config/constants.h"
 #include "core/system/page_size.h"
 #include "output/console/messages/messages_api.h"
 #include "utils/numeric_utils.h"
+#include "utils/seed_utils.h"
 #include "warmup/warmup.h"
+#include "asm/asm_functions.h"
 #include <atomic>
 #include <vector>
 #include <algorithm>
 #include <cstdlib>
 #include <limits>
+#include <optional>
 #include <utility>
 
 // Forward declarations from helpers.cpp
@@ -57,11 +67,37 @@ double run_pattern_copy_test(void* dst, void* src, size_t size, int iterations,
                              void (*copy_func)(void*, const void*, size_t),
                              HighResTimer& timer, int num_threads);
 double run_pattern_read_random_test(void* buffer, const std::vector<PatternRandomWorkerIndices>& worker_indices,
-                                    int iterations, std::atomic<uint64_t>& checksum, HighResTimer& timer);
+                                    int iterations, uint64_t (*read_func)(const void*, const size_t*, size_t),
+                                    std::atomic<uint64_t>& checksum, HighResTimer& timer);
 double run_pattern_write_random_test(void* buffer, const std::vector<PatternRandomWorkerIndices>& worker_indices,
-                                     int iterations, HighResTimer& timer);
+                                     int iterations, void (*write_func)(void*, const size_t*, size_t),
+                                     HighResTimer& timer);
 double run_pattern_copy_random_test(void* dst, void* src, const std::vector<PatternRandomWorkerIndices>& worker_indices,
-                                    int iterations, HighResTimer& timer);
+                                    int iterations, void (*copy_func)(void*, const void*, const size_t*, size_t),
+                                    HighResTimer& timer);
+double run_pattern_gather_test(void* buffer, const std::vector<PatternRandomWorkerIndices>& worker_indices,
+                               const PatternWorkPlan& plan, int iterations,
+                               uint64_t (*gather_func)(const void*, const size_t*, size_t),
+                               std::atomic<uint64_t>& checksum, HighResTimer& timer);
+double run_pattern_scatter_test(void* buffer, const std::vector<PatternRandomWorkerIndices>& worker_indices,
+                                const PatternWorkPlan& plan, int iterations,
+                                void (*scatter_func)(void*, const size_t*, size_t),
+                                HighResTimer& timer);
+double run_pattern_gather_scatter_test(void* dst, void* src,
+                                       const std::vector<PatternRandomWorkerIndices>& worker_indices,
+                                       const PatternWorkPlan& plan, int iterations,
+                                       void (*gather_scatter_func)(void*, const void*, const size_t*, size_t),
+                                       HighResTimer& timer);
+double run_pattern_read_matrix_test(void* buffer, const PatternWorkPlan& plan,
+                                    PatternMatrixLayout layout, int iterations,
+                                    const MemoryKernelSet& kernels,
+                                    std::atomic<uint64_t>& checksum, HighResTimer& timer);
+double run_pattern_write_matrix_test(void* buffer, const PatternWorkPlan& plan,
+                                     PatternMatrixLayout layout, int iterations,
+                                     const MemoryKernelSet& kernels, HighResTimer& timer);
+double run_pattern_copy_matrix_test(void* dst, void* src, const PatternWorkPlan& plan,
+                                    PatternMatrixLayout layout, int iterations,
+                                    const MemoryKernelSet& kernels, HighResTimer& timer);
 
 // Forward declarations from execution_utils.cpp
 double calculate_bandwidth(size_t data_size, int iterations, double elapsed_time_ns);
@@ -158,6 +194,8 @@ PatternMeasurement build_pattern_measurement(
       stride_bytes != 0 && stride_bytes == measurement.native_page_size_bytes;
   measurement.has_seed = has_seed;
   measurement.seed = has_seed ? config.pattern_seed : 0;
+  measurement.kernel_variant =
+      resolve_memory_kernel_set(config.memory_kernel_name, config.memory_kernel_variant).name;
 
   if (measurement.passes == 0 || elapsed_seconds <= 0.0 ||
       !std::isfinite(elapsed_seconds) || !std::isfinite(bandwidth_gb_s) ||
@@ -202,6 +240,36 @@ void set_triplet_status(PatternResults& results, PatternKind kind,
   }
 }
 
+size_t count_distinct_worker_offsets(
+    const std::vector<PatternRandomWorkerIndices>& worker_indices) {
+  std::vector<size_t> offsets;
+  for (const PatternRandomWorkerIndices& worker : worker_indices) {
+    for (size_t index : worker.indices) {
+      offsets.push_back(worker.offset_bytes + index);
+    }
+  }
+  std::sort(offsets.begin(), offsets.end());
+  return static_cast<size_t>(std::unique(offsets.begin(), offsets.end()) - offsets.begin());
+}
+
+void apply_gather_plan_accounting(PatternMeasurement& measurement,
+                                  const PatternWorkPlan& plan) {
+  measurement.access_size_bytes = plan.access_size_bytes;
+  measurement.indices_per_group = plan.indices_per_group;
+  measurement.effective_threads = plan.effective_threads;
+  measurement.min_accesses_per_pass = plan.min_accesses_per_pass;
+  measurement.max_accesses_per_pass = plan.max_accesses_per_pass;
+}
+
+void apply_matrix_plan_accounting(PatternMeasurement& measurement,
+                                  const PatternWorkPlan& plan) {
+  measurement.access_size_bytes = plan.access_size_bytes;
+  measurement.effective_threads = plan.effective_threads;
+  measurement.min_accesses_per_pass = plan.min_accesses_per_pass;
+  measurement.max_accesses_per_pass = plan.max_accesses_per_pass;
+  measurement.matrix_shape = plan.matrix_shape;
+}
+
 }  // namespace
 
 // ============================================================================
@@ -211,12 +279,14 @@ void set_triplet_status(PatternResults& results, PatternKind kind,
 // Run forward pattern benchmarks (baseline sequential access)
 void run_forward_pattern_benchmarks(const PatternBuffers& buffers, const BenchmarkConfig& config,
                                     PatternResults& results, HighResTimer& timer) {
+  const MemoryKernelSet& kernels =
+      resolve_memory_kernel_set(config.memory_kernel_name, config.memory_kernel_variant);
   show_progress();
   std::atomic<uint64_t> checksum{0};
   warmup_read(buffers.src_buffer(), config.buffer_size, config.num_threads, checksum);
   auto run_read = [&](int passes) {
     return run_pattern_read_test(buffers.src_buffer(), config.buffer_size, passes,
-                                 memory_read_loop_asm, checksum, timer,
+                                 kernels.read, checksum, timer,
                                  config.num_threads);
   };
   PatternCalibrationDecision read_calibration =
@@ -237,8 +307,8 @@ void run_forward_pattern_benchmarks(const PatternBuffers& buffers, const Benchma
   show_progress();
   warmup_write(buffers.dst_buffer(), config.buffer_size, config.num_threads);
   auto run_write = [&](int passes) {
-    return run_write_test(buffers.dst_buffer(), config.buffer_size, passes,
-                          config.num_threads, timer);
+    return run_pattern_write_test(buffers.dst_buffer(), config.buffer_size, passes,
+                                  kernels.write, timer, config.num_threads);
   };
   PatternCalibrationDecision write_calibration =
       resolve_pattern_passes(config, config.buffer_size, run_write);
@@ -258,8 +328,8 @@ void run_forward_pattern_benchmarks(const PatternBuffers& buffers, const Benchma
   show_progress();
   warmup_copy(buffers.dst_buffer(), buffers.src_buffer(), config.buffer_size, config.num_threads);
   auto run_copy = [&](int passes) {
-    return run_copy_test(buffers.dst_buffer(), buffers.src_buffer(), config.buffer_size,
-                         passes, config.num_threads, timer);
+    return run_pattern_copy_test(buffers.dst_buffer(), buffers.src_buffer(), config.buffer_size,
+                                 passes, kernels.copy, timer, config.num_threads);
   };
   PatternCalibrationDecision copy_calibration = resolve_pattern_passes(
       config, config.buffer_size * Constants::COPY_OPERATION_MULTIPLIER, run_copy);
@@ -353,9 +423,10 @@ void run_reverse_pattern_benchmarks(const PatternBuffers& buffers, const Benchma
           config.buffer_size));
 }
 
-// Run random pattern benchmarks (uniform random access)
+// Run random pattern benchmarks (uniform or skewed random access)
 // Returns EXIT_SUCCESS on success, EXIT_FAILURE on error, or skips pattern if buffer too small
 int run_random_pattern_benchmarks(const PatternBuffers& buffers, const BenchmarkConfig& config,
+                                   PatternKind kind,
                                    const std::vector<size_t>& random_indices,
                                    const std::vector<PatternRandomWorkerIndices>& worker_indices,
                                    PatternResults& results, HighResTimer& timer) {
@@ -364,7 +435,7 @@ int run_random_pattern_benchmarks(const PatternBuffers& buffers, const Benchmark
   // Validate indices - if validation fails due to buffer size, skip pattern gracefully
   if (!validate_random_indices(random_indices, config.buffer_size)) {
     // No valid indices or buffer too small - skip pattern (not an error)
-    set_triplet_status(results, PatternKind::Random,
+    set_triplet_status(results, kind,
                        PatternMeasurementStatus::Skipped,
                        Messages::pattern_reason_no_valid_random_workload(),
                        config, 0, true);
@@ -383,12 +454,16 @@ int run_random_pattern_benchmarks(const PatternBuffers& buffers, const Benchmark
     return EXIT_FAILURE;
   }
   
+  const MemoryKernelSet& kernels =
+      resolve_memory_kernel_set(config.memory_kernel_name, config.memory_kernel_variant);
+
   // Execute read benchmark
   show_progress();
   std::atomic<uint64_t> checksum{0};
   warmup_read_random(buffers.src_buffer(), worker_indices, checksum);
   auto run_read = [&](int passes) {
-    return run_pattern_read_random_test(buffers.src_buffer(), worker_indices, passes, checksum, timer);
+    return run_pattern_read_random_test(buffers.src_buffer(), worker_indices, passes, kernels.read_random,
+                                        checksum, timer);
   };
   const size_t payload_bytes_per_pass = num_accesses * PATTERN_ACCESS_SIZE_BYTES;
   PatternCalibrationDecision read_calibration =
@@ -401,35 +476,42 @@ int run_random_pattern_benchmarks(const PatternBuffers& buffers, const Benchmark
       std::minmax_element(random_indices.begin(), random_indices.end());
   const size_t logical_working_set_bytes =
       *maximum_index - *minimum_index + PATTERN_ACCESS_SIZE_BYTES;
-  set_pattern_measurement(
-      results, PatternKind::Random, PatternOperation::Read,
-      build_pattern_measurement(config, read_bandwidth, read_time, read_calibration,
-                                payload_bytes_per_pass, num_accesses, num_accesses,
-                                logical_working_set_bytes, 0, true));
+  // The uniform stream never repeats an offset; skewed streams sample with replacement.
+  const size_t distinct_address_count =
+      kind == PatternKind::Random ? num_accesses
+                                  : count_distinct_worker_offsets(worker_indices);
+  PatternMeasurement read_measurement = build_pattern_measurement(
+      config, read_bandwidth, read_time, read_calibration, payload_bytes_per_pass,
+      num_accesses, distinct_address_count, logical_working_set_bytes, 0, true);
+  read_measurement.kernel_variant = kernels.indexed_name;
+  set_pattern_measurement(results, kind, PatternOperation::Read,
+                          std::move(read_measurement));
 
   // Execute write benchmark
   show_progress();
   warmup_write_random(buffers.dst_buffer(), worker_indices);
   auto run_write = [&](int passes) {
-    return run_pattern_write_random_test(buffers.dst_buffer(), worker_indices, passes, timer);
+    return run_pattern_write_random_test(buffers.dst_buffer(), worker_indices, passes, kernels.write_random,
+                                         timer);
   };
   PatternCalibrationDecision write_calibration =
       resolve_pattern_passes(config, payload_bytes_per_pass, run_write);
   const double write_time = run_pattern_sample(run_write, write_calibration);
   const double write_bandwidth = calculate_bandwidth(
       payload_bytes_per_pass, write_calibration.passes, write_time);
-  set_pattern_measurement(
-      results, PatternKind::Random, PatternOperation::Write,
-      build_pattern_measurement(config, write_bandwidth, write_time,
-                                write_calibration, payload_bytes_per_pass,
-                                num_accesses, num_accesses,
-                                logical_working_set_bytes, 0, true));
+  PatternMeasurement write_measurement = build_pattern_measurement(
+      config, write_bandwidth, write_time, write_calibration, payload_bytes_per_pass,
+      num_accesses, distinct_address_count, logical_working_set_bytes, 0, true);
+  write_measurement.kernel_variant = kernels.indexed_name;
+  set_pattern_measurement(results, kind, PatternOperation::Write,
+                          std::move(write_measurement));
 
   // Execute copy benchmark
   show_progress();
   warmup_copy_random(buffers.dst_buffer(), buffers.src_buffer(), worker_indices);
   auto run_copy = [&](int passes) {
-    return run_pattern_copy_random_test(buffers.dst_buffer(), buffers.src_buffer(), worker_indices, passes, timer);
+    return run_pattern_copy_random_test(buffers.dst_buffer(), buffers.src_buffer(), worker_indices, passes,
+                                        kernels.copy_random, timer);
   };
   const size_t copy_payload_bytes_per_pass =
       payload_bytes_per_pass * Constants::COPY_OPERATION_MULTIPLIER;
@@ -438,12 +520,285 @@ int run_random_pattern_benchmarks(const PatternBuffers& buffers, const Benchmark
   const double copy_time = run_pattern_sample(run_copy, copy_calibration);
   const double copy_bandwidth = calculate_bandwidth(
       copy_payload_bytes_per_pass, copy_calibration.passes, copy_time);
-  set_pattern_measurement(
-      results, PatternKind::Random, PatternOperation::Copy,
-      build_pattern_measurement(config, copy_bandwidth, copy_time,
-                                copy_calibration, copy_payload_bytes_per_pass,
-                                num_accesses, num_accesses,
-                                logical_working_set_bytes, 0, true));
+  PatternMeasurement copy_measurement = build_pattern_measurement(
+      config, copy_bandwidth, copy_time, copy_calibration, copy_payload_bytes_per_pass,
+      num_accesses, distinct_address_count, logical_working_set_bytes, 0, true);
+  copy_measurement.kernel_variant = kernels.indexed_name;
+  set_pattern_measurement(results, kind, PatternOperation::Copy,
+                          std::move(copy_measurement));
   
   return EXIT_SUCCESS;
 }
+
+// Run skewed pattern benchmarks (Zipf, hot/cold, shifting hot-set)
+// Each kind samples its own stream from a domain-separated seed, runs it through
+// the random kernels and worker partition, then attaches hit-ratio proxies.
+int run_skewed_pattern_benchmarks(const PatternBuffers& buffers, const BenchmarkConfig& config,
+                                  PatternKind kind, size_t num_accesses,
+                                  PatternResults& results, HighResTimer& timer) {
+  using namespace Constants;
+
+  PatternSkewParameters parameters;
+  parameters.zipf_theta = config.pattern_zipf_theta;
+  parameters.hot_fraction = config.pattern_hot_fraction;
+  parameters.hot_probability = config.pattern_hot_probability;
+  PatternSkewDistribution distribution = PatternSkewDistribution::Zipf;
+  switch (kind) {
+    case PatternKind::SkewedZipf:
+      break;
+    case PatternKind::SkewedHotCold:
+      distribution = PatternSkewDistribution::HotCold;
+      break;
+    case PatternKind::SkewedShiftingHotSet:
+      distribution = PatternSkewDistribution::ShiftingHotSet;
+      parameters.phases = PATTERN_SHIFTING_HOT_SET_PHASES;
+      break;
+    default:
+      return EXIT_FAILURE;
+  }
+
+  const std::vector<size_t> skewed_indices = generate_skewed_indices(
+      distribution, config.buffer_size, num_accesses, parameters,
+      SeedUtils::splitmix64(config.pattern_seed ^ static_cast<uint64_t>(kind)));
+  const std::vector<PatternRandomWorkerIndices> worker_indices = build_random_worker_indices(
+      config.buffer_size, PATTERN_ACCESS_SIZE_BYTES, config.num_threads, skewed_indices);
+  const int status = run_random_pattern_benchmarks(
+      buffers, config, kind, skewed_indices, worker_indices, results, timer);
+
+  std::optional<double> l1_proxy;
+  std::optional<double> l2_proxy;
+  if (!skewed_indices.empty() && config.l1_cache_size > 0) {
+    l1_proxy = calculate_pattern_hit_ratio_proxy(
+        skewed_indices, config.l1_cache_size, CACHE_LINE_SIZE_BYTES, parameters.phases);
+  }
+  if (!skewed_indices.empty() && config.l2_cache_size > 0) {
+    l2_proxy = calculate_pattern_hit_ratio_proxy(
+        skewed_indices, config.l2_cache_size, CACHE_LINE_SIZE_BYTES, parameters.phases);
+  }
+  for (PatternOperation operation : {PatternOperation::Read, PatternOperation::Write,
+                                     PatternOperation::Copy}) {
+    PatternMeasurement& measurement = get_pattern_measurement(results, kind, operation);
+    measurement.skew_parameters = parameters;
+    measurement.l1_hit_ratio_proxy = l1_proxy;
+    measurement.l2_hit_ratio_proxy = l2_proxy;
+  }
+  return status;
+}
+
+// Run gather/scatter pattern benchmarks (indexed 8-byte elements)
+// Both kinds share the random index stream and one work plan; only the kernels differ.
+int run_gather_pattern_benchmarks(const PatternBuffers& buffers, const BenchmarkConfig& config,
+                                  PatternKind kind,
+                                  const std::vector<size_t>& random_indices,
+                                  const std::vector<PatternRandomWorkerIndices>& worker_indices,
+                                  PatternResults& results, HighResTimer& timer) {
+  using namespace Constants;
+
+  const bool neon = kind == PatternKind::GatherScatterNeon;
+  if (!neon && kind != PatternKind::GatherScatterScalar) {
+    return EXIT_FAILURE;
+  }
+  const PatternWorkPlan plan = build_gather_pattern_work_plan(
+      worker_indices, PATTERN_GATHER_ELEMENT_BYTES, PATTERN_GATHER_GROUP_INDICES,
+      config.num_threads);
+  if (!validate_random_indices(random_indices, config.buffer_size) ||
+      plan.status != PatternMeasurementStatus::Measured) {
+    set_triplet_status(results, kind,
+                       plan.status == PatternMeasurementStatus::Measured
+                           ? PatternMeasurementStatus::Skipped
+                           : plan.status,
+                       plan.status_reason.empty()
+                           ? Messages::pattern_reason_no_valid_random_workload()
+                           : plan.status_reason,
+                       config, 0, true);
+    for (PatternOperation operation : {PatternOperation::Read, PatternOperation::Write,
+                                       PatternOperation::Copy}) {
+      apply_gather_plan_accounting(get_pattern_measurement(results, kind, operation), plan);
+    }
+    return plan.status == PatternMeasurementStatus::Invalid ? EXIT_FAILURE : EXIT_SUCCESS;
+  }
+
+  const size_t num_accesses = plan.accesses_per_pass;
+  const size_t payload_bytes_per_pass = plan.payload_bytes_per_pass;
+  const auto [minimum_index, maximum_index] =
+      std::minmax_element(random_indices.begin(), random_indices.end());
+  const size_t logical_working_set_bytes =
+      *maximum_index - *minimum_index + PATTERN_GATHER_ELEMENT_BYTES;
+  auto record = [&](PatternOperation operation, double bandwidth, double elapsed,
+                    const PatternCalibrationDecision& calibration, size_t payload) {
+    PatternMeasurement measurement = build_pattern_measurement(
+        config, bandwidth, elapsed, calibration, payload, num_accesses, num_accesses,
+        logical_working_set_bytes, 0, true);
+    apply_gather_plan_accounting(measurement, plan);
+    set_pattern_measurement(results, kind, operation, std::move(measurement));
+  };
+
+  // Gather (read). One untimed pass of the measured kernel is the warmup.
+  show_progress();
+  std::atomic<uint64_t> checksum{0};
+  auto run_gather = [&](int passes) {
+    return run_pattern_gather_test(
+        buffers.src_buffer(), worker_indices, plan, passes,
+        neon ? memory_gather_neon_loop_asm : memory_gather_scalar_loop_asm, checksum, timer);
+  };
+  (void)run_gather(1);
+  PatternCalibrationDecision read_calibration =
+      resolve_pattern_passes(config, payload_bytes_per_pass, run_gather);
+  const double read_time = run_pattern_sample(run_gather, read_calibration);
+  record(PatternOperation::Read,
+         calculate_bandwidth(payload_bytes_per_pass, read_calibration.passes, read_time),
+         read_time, read_calibration, payload_bytes_per_pass);
+
+  // Scatter (write)
+  show_progress();
+  auto run_scatter = [&](int passes) {
+    return run_pattern_scatter_test(
+        buffers.dst_buffer(), worker_indices, plan, passes,
+        neon ? memory_scatter_neon_loop_asm : memory_scatter_scalar_loop_asm, timer);
+  };
+  (void)run_scatter(1);
+  PatternCalibrationDecision write_calibration =
+      resolve_pattern_passes(config, payload_bytes_per_pass, run_scatter);
+  const double write_time = run_pattern_sample(run_scatter, write_calibration);
+  record(PatternOperation::Write,
+         calculate_bandwidth(payload_bytes_per_pass, write_calibration.passes, write_time),
+         write_time, write_calibration, payload_bytes_per_pass);
+
+  // Gather-scatter (copy)
+  show_progress();
+  auto run_gather_scatter = [&](int passes) {
+    return run_pattern_gather_scatter_test(
+        buffers.dst_buffer(), buffers.src_buffer(), worker_indices, plan, passes,
+        neon ? memory_gather_scatter_neon_loop_asm : memory_gather_scatter_scalar_loop_asm,
+        timer);
+  };
+  (void)run_gather_scatter(1);
+  const size_t copy_payload_bytes_per_pass =
+      payload_bytes_per_pass * Constants::COPY_OPERATION_MULTIPLIER;
+  PatternCalibrationDecision copy_calibration = resolve_pattern_passes(
+      config, copy_payload_bytes_per_pass, run_gather_scatter);
+  const double copy_time = run_pattern_sample(run_gather_scatter, copy_calibration);
+  record(PatternOperation::Copy,
+         calculate_bandwidth(copy_payload_bytes_per_pass, copy_calibration.passes, copy_time),
+         copy_time, copy_calibration, copy_payload_bytes_per_pass);
+
+  return EXIT_SUCCESS;
+}
+
+// Run 2D matrix pattern benchmarks (row-major, column-major, tiled, transpose)
+// Every layout views the buffer through the same pitched shape; workers own
+// contiguous row or tile-row bands so each layout parallelizes without overlap.
+int run_matrix_pattern_benchmarks(const PatternBuffers& buffers, const BenchmarkConfig& config,
+                                  PatternKind kind, PatternResults& results,
+                                  HighResTimer& timer) {
+  using namespace Constants;
+
+  PatternMatrixLayout layout = PatternMatrixLayout::RowMajor;
+  switch (kind) {
+    case PatternKind::MatrixRowMajor:
+      break;
+    case PatternKind::MatrixColumnMajor:
+      layout = PatternMatrixLayout::ColumnMajor;
+      break;
+    case PatternKind::MatrixTiled:
+      layout = PatternMatrixLayout::Tiled;
+      break;
+    case PatternKind::MatrixTranspose:
+      layout = PatternMatrixLayout::Transpose;
+      break;
+    default:
+      return EXIT_FAILURE;
+  }
+
+  const size_t pitch_bytes = config.pattern_matrix_pitch_bytes != 0
+                                 ? config.pattern_matrix_pitch_bytes
+                                 : config.pattern_matrix_row_bytes;
+  const PatternWorkPlan plan = build_matrix_pattern_work_plan(
+      config.buffer_size, config.pattern_matrix_row_bytes, pitch_bytes,
+      config.pattern_matrix_tile_elements, layout, config.num_threads);
+  if (plan.status != PatternMeasurementStatus::Measured) {
+    set_triplet_status(results, kind, plan.status, plan.status_reason, config, pitch_bytes);
+    for (PatternOperation operation : {PatternOperation::Read, PatternOperation::Write,
+                                       PatternOperation::Copy}) {
+      apply_matrix_plan_accounting(get_pattern_measurement(results, kind, operation), plan);
+    }
+    return plan.status == PatternMeasurementStatus::Invalid ? EXIT_FAILURE : EXIT_SUCCESS;
+  }
+
+  const MemoryKernelSet& kernels =
+      resolve_memory_kernel_set(config.memory_kernel_name, config.memory_kernel_variant);
+  const size_t payload_bytes_per_pass = plan.payload_bytes_per_pass;
+  auto record = [&](PatternOperation operation, double bandwidth, double elapsed,
+                    const PatternCalibrationDecision& calibration, size_t payload) {
+    PatternMeasurement measurement = build_pattern_measurement(
+        config, bandwidth, elapsed, calibration, payload, plan.accesses_per_pass,
+        plan.distinct_address_count, plan.logical_working_set_bytes, pitch_bytes);
+    apply_matrix_plan_accounting(measurement, plan);
+    if (layout == PatternMatrixLayout::Transpose) {
+      measurement.kernel_variant = "portable";
+    } else if (layout == PatternMatrixLayout::ColumnMajor) {
+      measurement.kernel_variant = kernels.indexed_name;
+    }
+    set_pattern_measurement(results, kind, operation, std::move(measurement));
+  };
+
+  if (layout == PatternMatrixLayout::Transpose) {
+    for (PatternOperation operation : {PatternOperation::Read, PatternOperation::Write}) {
+      PatternMeasurement measurement;
+      measurement.status = PatternMeasurementStatus::Skipped;
+      measurement.status_reason = Messages::pattern_reason_transpose_copy_only();
+      measurement.stride_bytes = pitch_bytes;
+      measurement.requested_threads = config.num_threads;
+      measurement.native_page_size_bytes = get_system_page_size_bytes();
+      apply_matrix_plan_accounting(measurement, plan);
+      set_pattern_measurement(results, kind, operation, std::move(measurement));
+    }
+  } else {
+    // Read. One untimed pass of the measured traversal is the warmup.
+    show_progress();
+    std::atomic<uint64_t> checksum{0};
+    auto run_read = [&](int passes) {
+      return run_pattern_read_matrix_test(buffers.src_buffer(), plan, layout, passes, kernels,
+                                          checksum, timer);
+    };
+    (void)run_read(1);
+    PatternCalibrationDecision read_calibration =
+        resolve_pattern_passes(config, payload_bytes_per_pass, run_read);
+    const double read_time = run_pattern_sample(run_read, read_calibration);
+    record(PatternOperation::Read,
+           calculate_bandwidth(payload_bytes_per_pass, read_calibration.passes, read_time),
+           read_time, read_calibration, payload_bytes_per_pass);
+
+    // Write
+    show_progress();
+    auto run_write = [&](int passes) {
+      return run_pattern_write_matrix_test(buffers.dst_buffer(), plan, layout, passes, kernels,
+                                           timer);
+    };
+    (void)run_write(1);
+    PatternCalibrationDecision write_calibration =
+        resolve_pattern_passes(config, payload_bytes_per_pass, run_write);
+    const double write_time = run_pattern_sample(run_write, write_calibration);
+    record(PatternOperation::Write,
+           calculate_bandwidth(payload_bytes_per_pass, write_calibration.passes, write_time),
+           write_time, write_calibration, payload_bytes_per_pass);
+  }
+
+  // Copy (or out-of-place transpose into the dense destination)
+  show_progress();
+  auto run_copy = [&](int passes) {
+    return run_pattern_copy_matrix_test(buffers.dst_buffer(), buffers.src_buffer(), plan,
+                                        layout, passes, kernels, timer);
+  };
+  (void)run_copy(1);
+  const size_t copy_payload_bytes_per_pass =
+      payload_bytes_per_pass * Constants::COPY_OPERATION_MULTIPLIER;
+  PatternCalibrationDecision copy_calibration =
+      resolve_pattern_passes(config, copy_payload_bytes_per_pass, run_copy);
+  const double copy_time = run_pattern_sample(run_copy, copy_calibration);
+  record(PatternOperation::Copy,
+         calculate_bandwidth(copy_payload_bytes_per_pass, copy_calibration.passes, copy_time),
+         copy_time, copy_calibration, copy_payload_bytes_per_pass);
+
+  return EXIT_SUCCESS;
+}
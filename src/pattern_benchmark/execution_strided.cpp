@@ -31,6 +31,7 @@
 #include "pattern_benchmark/pattern_benchmark.h"
 #include "pattern_benchmark/pattern_work_plan.h"
 #include "utils/benchmark.h"
+#include "benchmark/memory_kernels.h"
 #include "core/memory/buffer_manager.h"
 #include "core/config/config.h"
 #include "core/config/constants.h"
@@ -46,10 +47,13 @@
 #include <utility>
 
 // Forward declarations from helpers.cpp
-double run_pattern_read_strided_test(void* buffer, const PatternWorkPlan& plan, std::atomic<uint64_t>& checksum,
-                                     HighResTimer& timer);
-double run_pattern_write_strided_test(void* buffer, const PatternWorkPlan& plan, HighResTimer& timer);
-double run_pattern_copy_strided_test(void* dst, void* src, const PatternWorkPlan& plan, HighResTimer& timer);
+double run_pattern_read_strided_test(void* buffer, const PatternWorkPlan& plan,
+                                     uint64_t (*read_func)(const void*, size_t, size_t, size_t, size_t),
+                                     std::atomic<uint64_t>& checksum, HighResTimer& timer);
+double run_pattern_write_strided_test(void* buffer, const PatternWorkPlan& plan,
+                                      void (*write_func)(void*, size_t, size_t, size_t, size_t), HighResTimer& timer);
+double run_pattern_copy_strided_test(void* dst, void* src, const PatternWorkPlan& plan,
+                                     void (*copy_func)(void*, const void*, size_t, size_t, size_t, size_t), HighResTimer& timer);
 
 // Forward declarations from execution_utils.cpp
 double calculate_bandwidth(size_t data_size, int iterations, double elapsed_time_ns);
@@ -162,6 +166,9 @@ PatternMeasurement build_strided_measurement(
   measurement.native_page_size_bytes = get_system_page_size_bytes();
   measurement.stride_equals_native_page_size =
       plan.stride_bytes == measurement.native_page_size_bytes;
+  measurement.kernel_variant =
+      resolve_memory_kernel_set(config.memory_kernel_name, config.memory_kernel_variant)
+          .indexed_name;
 
   if (copy_operation) {
     if (measurement.total_payload_bytes >
@@ -229,12 +236,15 @@ int run_strided_pattern_benchmarks(const PatternBuffers& buffers, const Benchmar
     return EXIT_FAILURE;
   }
   
+  const MemoryKernelSet& kernels =
+      resolve_memory_kernel_set(config.memory_kernel_name, config.memory_kernel_variant);
+
   // Execute read benchmark
   show_progress();
   std::atomic<uint64_t> checksum{0};
   warmup_read_strided(buffers.src_buffer(), pilot_plan, checksum);
   auto run_read = [&](const PatternWorkPlan& plan) {
-    return run_pattern_read_strided_test(buffers.src_buffer(), plan, checksum, timer);
+    return run_pattern_read_strided_test(buffers.src_buffer(), plan, kernels.read_strided, checksum, timer);
   };
   PatternWorkPlan read_plan;
   double read_pilot_time = 0.0;
@@ -254,7 +264,7 @@ int run_strided_pattern_benchmarks(const PatternBuffers& buffers, const Benchmar
   show_progress();
   warmup_write_strided(buffers.dst_buffer(), pilot_plan);
   auto run_write = [&](const PatternWorkPlan& plan) {
-    return run_pattern_write_strided_test(buffers.dst_buffer(), plan, timer);
+    return run_pattern_write_strided_test(buffers.dst_buffer(), plan, kernels.write_strided, timer);
   };
   PatternWorkPlan write_plan;
   double write_pilot_time = 0.0;
@@ -274,7 +284,8 @@ int run_strided_pattern_benchmarks(const PatternBuffers& buffers, const Benchmar
   show_progress();
   warmup_copy_strided(buffers.dst_buffer(), buffers.src_buffer(), pilot_plan);
   auto run_copy = [&](const PatternWorkPlan& plan) {
-    return run_pattern_copy_strided_test(buffers.dst_buffer(), buffers.src_buffer(), plan, timer);
+    return run_pattern_copy_strided_test(buffers.dst_buffer(), buffers.src_buffer(), plan,
+                                         kernels.copy_strided, timer);
   };
   PatternWorkPlan copy_plan;
   double copy_pilot_time = 0.0;
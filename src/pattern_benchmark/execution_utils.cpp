@@ -26,6 +26,7 @@
  * Key utilities:
  * - Bandwidth calculation with overflow protection
  * - Random access index generation with proper alignment
+ * - Skewed (Zipf, hot/cold, shifting hot-set) index streams and hit-ratio proxies
  * - Access count calculation based on buffer size
  * - Alignment boundary calculations
  */
@@ -36,6 +37,7 @@
 #include <algorithm>
 #include <limits>  // std::numeric_limits
 #include <cmath>   // std::isnan, std::isinf
+#include <functional>  // std::greater
 #include <numeric>
 
 // ============================================================================
@@ -134,6 +136,184 @@ std::vector<size_t> generate_random_indices(size_t buffer_size, size_t num_acces
   return indices;
 }
 
+namespace {
+
+double unit_interval(std::mt19937_64& random) {
+  return static_cast<double>(random() >> 11) * 0x1.0p-53;
+}
+
+// log1p(x) / x and expm1(x) / x, continued through x == 0 by their series.
+double zipf_log1p_ratio(double x) {
+  return std::abs(x) > 1e-8 ? std::log1p(x) / x
+                            : 1.0 - x * (0.5 - x * (1.0 / 3.0 - 0.25 * x));
+}
+
+double zipf_expm1_ratio(double x) {
+  return std::abs(x) > 1e-8 ? std::expm1(x) / x
+                            : 1.0 + x * 0.5 * (1.0 + x / 3.0 * (1.0 + 0.25 * x));
+}
+
+// Rejection-inversion Zipf sampler (Hoermann and Derflinger). Draws zero-based
+// ranks in [0, rank_count) with P(rank) proportional to 1 / (rank + 1)^theta
+// in O(1) expected time and memory, for any theta > 0 including theta == 1.
+class ZipfRankSampler {
+ public:
+  ZipfRankSampler(size_t rank_count, double theta)
+      : rank_count_(static_cast<double>(rank_count)), theta_(theta) {
+    h_integral_first_ = h_integral(1.5) - 1.0;
+    h_integral_last_ = h_integral(rank_count_ + 0.5);
+    squeeze_ = 2.0 - h_integral_inverse(h_integral(2.5) - h(2.0));
+  }
+
+  size_t operator()(std::mt19937_64& random) const {
+    while (true) {
+      const double u = h_integral_last_ +
+                       unit_interval(random) * (h_integral_first_ - h_integral_last_);
+      const double x = h_integral_inverse(u);
+      const double k = std::clamp(std::floor(x + 0.5), 1.0, rank_count_);
+      if (k - x <= squeeze_ || u >= h_integral(k + 0.5) - h(k)) {
+        return static_cast<size_t>(k) - 1;
+      }
+    }
+  }
+
+ private:
+  double h(double x) const { return std::exp(-theta_ * std::log(x)); }
+
+  double h_integral(double x) const {
+    const double log_x = std::log(x);
+    return zipf_expm1_ratio((1.0 - theta_) * log_x) * log_x;
+  }
+
+  double h_integral_inverse(double x) const {
+    const double t = std::max(x * (1.0 - theta_), -1.0);
+    return std::exp(zipf_log1p_ratio(t) * x);
+  }
+
+  double rank_count_;
+  double theta_;
+  double h_integral_first_ = 0.0;
+  double h_integral_last_ = 0.0;
+  double squeeze_ = 0.0;
+};
+
+size_t pattern_phase_length(size_t access_count, size_t phases) {
+  return (access_count + phases - 1) / phases;
+}
+
+}  // namespace
+
+// Generate a deterministic with-replacement skewed stream of aligned offsets.
+std::vector<size_t> generate_skewed_indices(PatternSkewDistribution distribution,
+                                            size_t buffer_size, size_t num_accesses,
+                                            const PatternSkewParameters& parameters,
+                                            uint64_t seed) {
+  using namespace Constants;
+  std::vector<size_t> indices;
+  const bool zipf = distribution == PatternSkewDistribution::Zipf;
+  const bool valid_parameters =
+      zipf ? parameters.zipf_theta > 0.0 && std::isfinite(parameters.zipf_theta)
+           : parameters.hot_fraction > 0.0 && parameters.hot_fraction < 1.0 &&
+                 parameters.hot_probability > 0.0 && parameters.hot_probability <= 1.0;
+  if (buffer_size < PATTERN_ACCESS_SIZE_BYTES || num_accesses == 0 ||
+      parameters.phases == 0 || !valid_parameters) {
+    return indices;
+  }
+
+  const size_t slot_count = calculate_max_aligned_offset(buffer_size) /
+                                PATTERN_ACCESS_SIZE_BYTES +
+                            1;
+  std::mt19937_64 random(seed);
+  size_t multiplier = 1;
+  if (slot_count > 1) {
+    multiplier = static_cast<size_t>(random() % (slot_count - 1)) + 1;
+    while (std::gcd(multiplier, slot_count) != 1) {
+      multiplier = multiplier == slot_count - 1 ? 1 : multiplier + 1;
+    }
+  }
+  const size_t slot_offset = static_cast<size_t>(random() % slot_count);
+
+  const double scaled_hot_count =
+      std::round(parameters.hot_fraction * static_cast<double>(slot_count));
+  const size_t hot_count = std::clamp<size_t>(
+      static_cast<size_t>(std::max(scaled_hot_count, 1.0)), 1, slot_count);
+  const bool shifting = distribution == PatternSkewDistribution::ShiftingHotSet;
+  const size_t phase_length = pattern_phase_length(num_accesses, parameters.phases);
+  const ZipfRankSampler zipf_sampler(slot_count, zipf ? parameters.zipf_theta : 1.0);
+
+  indices.reserve(num_accesses);
+  for (size_t access = 0; access < num_accesses; ++access) {
+    size_t rank = 0;
+    if (zipf) {
+      rank = zipf_sampler(random);
+    } else {
+      const bool hot = hot_count == slot_count ||
+                       unit_interval(random) < parameters.hot_probability;
+      rank = hot ? static_cast<size_t>(random() % hot_count)
+                 : hot_count + static_cast<size_t>(random() % (slot_count - hot_count));
+      if (shifting) {
+        const size_t phase = access / phase_length;
+        const size_t shift = static_cast<size_t>(
+            static_cast<unsigned __int128>(phase) * slot_count / parameters.phases);
+        rank = rank >= slot_count - shift ? rank - (slot_count - shift) : rank + shift;
+      }
+    }
+    const size_t scattered = static_cast<size_t>(
+        static_cast<unsigned __int128>(rank) * multiplier % slot_count);
+    const size_t slot = scattered >= slot_count - slot_offset
+                            ? scattered - (slot_count - slot_offset)
+                            : scattered + slot_offset;
+    indices.push_back(slot * PATTERN_ACCESS_SIZE_BYTES);
+  }
+  return indices;
+}
+
+// Hit ratio of an ideal frequency-pinned cache, averaged over stream phases.
+double calculate_pattern_hit_ratio_proxy(const std::vector<size_t>& indices,
+                                         size_t capacity_bytes, size_t line_bytes,
+                                         size_t phases) {
+  if (indices.empty() || line_bytes == 0 || phases == 0) {
+    return 0.0;
+  }
+
+  const size_t capacity_lines = capacity_bytes / line_bytes;
+  const size_t phase_length = pattern_phase_length(indices.size(), phases);
+  std::vector<size_t> lines;
+  std::vector<size_t> line_counts;
+  double ratio_sum = 0.0;
+  size_t phase_count = 0;
+  for (size_t begin = 0; begin < indices.size(); begin += phase_length) {
+    const size_t end = std::min(indices.size(), begin + phase_length);
+    lines.assign(indices.begin() + static_cast<std::ptrdiff_t>(begin),
+                 indices.begin() + static_cast<std::ptrdiff_t>(end));
+    for (size_t& line : lines) {
+      line /= line_bytes;
+    }
+    std::sort(lines.begin(), lines.end());
+    line_counts.clear();
+    for (size_t position = 0; position < lines.size();) {
+      size_t run_end = position + 1;
+      while (run_end < lines.size() && lines[run_end] == lines[position]) {
+        ++run_end;
+      }
+      line_counts.push_back(run_end - position);
+      position = run_end;
+    }
+
+    size_t hits = end - begin;
+    if (capacity_lines < line_counts.size()) {
+      const auto pinned_end =
+          line_counts.begin() + static_cast<std::ptrdiff_t>(capacity_lines);
+      std::nth_element(line_counts.begin(), pinned_end, line_counts.end(),
+                       std::greater<size_t>());
+      hits = std::accumulate(line_counts.begin(), pinned_end, size_t{0});
+    }
+    ratio_sum += static_cast<double>(hits) / static_cast<double>(end - begin);
+    ++phase_count;
+  }
+  return ratio_sum / static_cast<double>(phase_count);
+}
+
 // Helper function to calculate number of random accesses based on buffer size
 size_t calculate_num_random_accesses(size_t buffer_size) {
   using namespace Constants;
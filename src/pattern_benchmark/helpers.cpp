@@ -22,7 +22,7 @@
  * This file provides helper functions that wrap the parallel test framework
  * for pattern-based memory access benchmarks. These functions handle the
  * execution of read, write, and copy operations for various access patterns
- * including sequential, strided, and random access.
+ * including sequential, strided, random, and 2D matrix access.
  *
  * The helpers integrate assembly-level memory access functions with the
  * multi-threaded parallel test framework, managing checksums, timing, and
@@ -32,6 +32,7 @@
 #include "pattern_benchmark/pattern_work_plan.h"
 #include "utils/benchmark.h"
 #include "benchmark/parallel_test_framework.h"
+#include "benchmark/memory_kernels.h"
 #include "asm/asm_functions.h"
 #include "core/config/constants.h"
 #include <atomic>
@@ -82,6 +83,118 @@ bool validate_random_worker_plan(
   return true;
 }
 
+bool validate_gather_worker_plan(
+    const std::vector<PatternRandomWorkerIndices>& workers,
+    const PatternWorkPlan& plan) {
+  if (plan.status != PatternMeasurementStatus::Measured ||
+      plan.indices_per_group == 0 || plan.workers.size() != workers.size()) {
+    return false;
+  }
+  for (size_t worker_index = 0; worker_index < workers.size(); ++worker_index) {
+    const size_t accesses = plan.workers[worker_index].accesses_per_pass;
+    if (accesses == 0 || accesses % plan.indices_per_group != 0 ||
+        accesses > workers[worker_index].indices.size()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Tiled traversals issue one kernel call per tile row segment; row-major is the
+// degenerate tile spanning the whole band. Column-major runs the phased strided
+// kernel with the pitch as stride, one 32-byte column per pass.
+size_t matrix_run_bytes(const PatternMatrixShape& shape, PatternMatrixLayout layout) {
+  return layout == PatternMatrixLayout::Tiled
+             ? shape.tile_elements * Constants::PATTERN_MATRIX_ELEMENT_BYTES
+             : shape.row_bytes;
+}
+
+size_t matrix_tile_rows(const PatternMatrixShape& shape, PatternMatrixLayout layout,
+                        size_t band_rows) {
+  return layout == PatternMatrixLayout::Tiled ? shape.tile_elements : band_rows;
+}
+
+uint64_t read_matrix_band(const char* band, size_t band_rows, const PatternMatrixShape& shape,
+                          PatternMatrixLayout layout, const MemoryKernelSet& kernels) {
+  const size_t pitch = shape.pitch_bytes;
+  if (layout == PatternMatrixLayout::ColumnMajor) {
+    return kernels.read_strided(band, band_rows * pitch, pitch,
+                                shape.row_bytes / Constants::PATTERN_ACCESS_SIZE_BYTES, 0);
+  }
+  const size_t run_bytes = matrix_run_bytes(shape, layout);
+  const size_t tile_rows = matrix_tile_rows(shape, layout, band_rows);
+  uint64_t checksum = 0;
+  for (size_t tile_row = 0; tile_row < band_rows; tile_row += tile_rows) {
+    for (size_t column = 0; column < shape.row_bytes; column += run_bytes) {
+      for (size_t row = tile_row; row < tile_row + tile_rows; ++row) {
+        checksum ^= kernels.read(band + row * pitch + column, run_bytes);
+      }
+    }
+  }
+  return checksum;
+}
+
+void write_matrix_band(char* band, size_t band_rows, const PatternMatrixShape& shape,
+                       PatternMatrixLayout layout, const MemoryKernelSet& kernels) {
+  const size_t pitch = shape.pitch_bytes;
+  if (layout == PatternMatrixLayout::ColumnMajor) {
+    kernels.write_strided(band, band_rows * pitch, pitch,
+                          shape.row_bytes / Constants::PATTERN_ACCESS_SIZE_BYTES, 0);
+    return;
+  }
+  const size_t run_bytes = matrix_run_bytes(shape, layout);
+  const size_t tile_rows = matrix_tile_rows(shape, layout, band_rows);
+  for (size_t tile_row = 0; tile_row < band_rows; tile_row += tile_rows) {
+    for (size_t column = 0; column < shape.row_bytes; column += run_bytes) {
+      for (size_t row = tile_row; row < tile_row + tile_rows; ++row) {
+        kernels.write(band + row * pitch + column, run_bytes);
+      }
+    }
+  }
+}
+
+void copy_matrix_band(char* dst_band, const char* src_band, size_t band_rows,
+                      const PatternMatrixShape& shape, PatternMatrixLayout layout,
+                      const MemoryKernelSet& kernels) {
+  const size_t pitch = shape.pitch_bytes;
+  if (layout == PatternMatrixLayout::ColumnMajor) {
+    kernels.copy_strided(dst_band, src_band, band_rows * pitch, pitch,
+                         shape.row_bytes / Constants::PATTERN_ACCESS_SIZE_BYTES, 0);
+    return;
+  }
+  const size_t run_bytes = matrix_run_bytes(shape, layout);
+  const size_t tile_rows = matrix_tile_rows(shape, layout, band_rows);
+  for (size_t tile_row = 0; tile_row < band_rows; tile_row += tile_rows) {
+    for (size_t column = 0; column < shape.row_bytes; column += run_bytes) {
+      for (size_t row = tile_row; row < tile_row + tile_rows; ++row) {
+        const size_t offset = row * pitch + column;
+        kernels.copy(dst_band + offset, src_band + offset, run_bytes);
+      }
+    }
+  }
+}
+
+// Out-of-place transpose of one band of whole tile rows. The destination is
+// dense: source element (row, column) lands at column * rows + row.
+void transpose_matrix_band(uint64_t* dst, const char* src_band, size_t first_row,
+                           size_t band_rows, const PatternMatrixShape& shape) {
+  const size_t tile = shape.tile_elements;
+  const size_t columns = shape.row_bytes / Constants::PATTERN_MATRIX_ELEMENT_BYTES;
+  const size_t source_pitch = shape.pitch_bytes / Constants::PATTERN_MATRIX_ELEMENT_BYTES;
+  const uint64_t* source = reinterpret_cast<const uint64_t*>(src_band);
+  for (size_t tile_row = 0; tile_row < band_rows; tile_row += tile) {
+    for (size_t tile_column = 0; tile_column < columns; tile_column += tile) {
+      for (size_t row = tile_row; row < tile_row + tile; ++row) {
+        const uint64_t* source_row = source + row * source_pitch + tile_column;
+        uint64_t* destination = dst + tile_column * shape.rows + first_row + row;
+        for (size_t column = 0; column < tile; ++column) {
+          destination[column * shape.rows] = source_row[column];
+        }
+      }
+    }
+  }
+}
+
 }  // namespace
 
 // Helper function to run a pattern read test (multi-threaded)
@@ -144,8 +257,9 @@ double run_pattern_copy_test(void* dst, void* src, size_t size, int iterations,
 }
 
 // Helper function to run a strided pattern read test (multi-threaded)
-double run_pattern_read_strided_test(void* buffer, const PatternWorkPlan& plan, std::atomic<uint64_t>& checksum,
-                                     HighResTimer& timer) {
+double run_pattern_read_strided_test(void* buffer, const PatternWorkPlan& plan,
+                                     uint64_t (*read_func)(const void*, size_t, size_t, size_t, size_t),
+                                     std::atomic<uint64_t>& checksum, HighResTimer& timer) {
   checksum.store(0, std::memory_order_relaxed);
   const std::vector<size_t> boundaries = build_finalized_boundaries(plan.workers);
   if (boundaries.empty() || plan.passes == 0 || plan.passes > static_cast<size_t>(std::numeric_limits<int>::max())) {
@@ -156,10 +270,10 @@ double run_pattern_read_strided_test(void* buffer, const PatternWorkPlan& plan,
   const size_t stride = plan.stride_bytes;
   std::vector<uint64_t> worker_checksums(plan.workers.size(), 0);
 
-  auto strided_read_work = [&worker_checksums, stride](char* chunk_start, size_t chunk_size, int iters,
+  auto strided_read_work = [&worker_checksums, stride, read_func](char* chunk_start, size_t chunk_size, int iters,
                                                       size_t worker_index) {
     const uint64_t result =
-        memory_read_strided_phased_loop_asm(chunk_start, chunk_size, stride, static_cast<size_t>(iters), 0);
+        read_func(chunk_start, chunk_size, stride, static_cast<size_t>(iters), 0);
     worker_checksums[worker_index] = result;
   };
 
@@ -174,7 +288,8 @@ double run_pattern_read_strided_test(void* buffer, const PatternWorkPlan& plan,
 }
 
 // Helper function to run a strided pattern write test (multi-threaded)
-double run_pattern_write_strided_test(void* buffer, const PatternWorkPlan& plan, HighResTimer& timer) {
+double run_pattern_write_strided_test(void* buffer, const PatternWorkPlan& plan,
+                                      void (*write_func)(void*, size_t, size_t, size_t, size_t), HighResTimer& timer) {
   const std::vector<size_t> boundaries = build_finalized_boundaries(plan.workers);
   if (boundaries.empty() || plan.passes == 0 || plan.passes > static_cast<size_t>(std::numeric_limits<int>::max())) {
     return 0.0;
@@ -183,9 +298,9 @@ double run_pattern_write_strided_test(void* buffer, const PatternWorkPlan& plan,
   const int iterations = static_cast<int>(plan.passes);
   const size_t stride = plan.stride_bytes;
 
-  auto strided_write_work = [stride](char* chunk_start, size_t chunk_size, int iters,
+  auto strided_write_work = [stride, write_func](char* chunk_start, size_t chunk_size, int iters,
                                      size_t /* worker_index */) {
-    memory_write_strided_phased_loop_asm(chunk_start, chunk_size, stride, static_cast<size_t>(iters), 0);
+    write_func(chunk_start, chunk_size, stride, static_cast<size_t>(iters), 0);
   };
 
   return run_parallel_test_indexed_with_boundaries(buffer, size, iterations, timer, boundaries, strided_write_work,
@@ -193,7 +308,8 @@ double run_pattern_write_strided_test(void* buffer, const PatternWorkPlan& plan,
 }
 
 // Helper function to run a strided pattern copy test (multi-threaded)
-double run_pattern_copy_strided_test(void* dst, void* src, const PatternWorkPlan& plan, HighResTimer& timer) {
+double run_pattern_copy_strided_test(void* dst, void* src, const PatternWorkPlan& plan,
+                                     void (*copy_func)(void*, const void*, size_t, size_t, size_t, size_t), HighResTimer& timer) {
   const std::vector<size_t> boundaries = build_finalized_boundaries(plan.workers);
   if (boundaries.empty() || plan.passes == 0 || plan.passes > static_cast<size_t>(std::numeric_limits<int>::max())) {
     return 0.0;
@@ -202,18 +318,118 @@ double run_pattern_copy_strided_test(void* dst, void* src, const PatternWorkPlan
   const int iterations = static_cast<int>(plan.passes);
   const size_t stride = plan.stride_bytes;
 
-  auto strided_copy_work = [stride](char* dst_chunk, char* src_chunk, size_t chunk_size, int iters,
+  auto strided_copy_work = [stride, copy_func](char* dst_chunk, char* src_chunk, size_t chunk_size, int iters,
                                    size_t /* worker_index */) {
-    memory_copy_strided_phased_loop_asm(dst_chunk, src_chunk, chunk_size, stride, static_cast<size_t>(iters), 0);
+    copy_func(dst_chunk, src_chunk, chunk_size, stride, static_cast<size_t>(iters), 0);
   };
 
   return run_parallel_test_copy_indexed_with_boundaries(dst, src, size, iterations, timer, boundaries,
                                                         strided_copy_work, "strided_copy");
 }
 
+// Helper function to run a 2D matrix read test over finalized row bands (multi-threaded)
+double run_pattern_read_matrix_test(void* buffer, const PatternWorkPlan& plan,
+                                    PatternMatrixLayout layout, int iterations,
+                                    const MemoryKernelSet& kernels,
+                                    std::atomic<uint64_t>& checksum, HighResTimer& timer) {
+  checksum.store(0, std::memory_order_relaxed);
+  const std::vector<size_t> boundaries = build_finalized_boundaries(plan.workers);
+  if (boundaries.empty() || iterations <= 0 || plan.matrix_shape.pitch_bytes == 0) {
+    return 0.0;
+  }
+  const PatternMatrixShape shape = plan.matrix_shape;
+  std::vector<uint64_t> worker_checksums(plan.workers.size(), 0);
+
+  auto matrix_read_work = [&worker_checksums, &kernels, shape, layout](
+                              char* chunk_start, size_t chunk_size, int iters,
+                              size_t worker_index) {
+    const size_t band_rows = chunk_size / shape.pitch_bytes;
+    uint64_t result = 0;
+    for (int pass = 0; pass < iters; ++pass) {
+      result ^= read_matrix_band(chunk_start, band_rows, shape, layout, kernels);
+    }
+    worker_checksums[worker_index] = result;
+  };
+
+  const double duration = run_parallel_test_indexed_with_boundaries(
+      buffer, boundaries.back(), iterations, timer, boundaries, matrix_read_work, "matrix_read");
+  uint64_t combined_checksum = 0;
+  for (uint64_t worker_checksum : worker_checksums) {
+    combined_checksum ^= worker_checksum;
+  }
+  checksum.store(combined_checksum, std::memory_order_release);
+  return duration;
+}
+
+// Helper function to run a 2D matrix write test over finalized row bands (multi-threaded)
+double run_pattern_write_matrix_test(void* buffer, const PatternWorkPlan& plan,
+                                     PatternMatrixLayout layout, int iterations,
+                                     const MemoryKernelSet& kernels, HighResTimer& timer) {
+  const std::vector<size_t> boundaries = build_finalized_boundaries(plan.workers);
+  if (boundaries.empty() || iterations <= 0 || plan.matrix_shape.pitch_bytes == 0) {
+    return 0.0;
+  }
+  const PatternMatrixShape shape = plan.matrix_shape;
+
+  auto matrix_write_work = [&kernels, shape, layout](char* chunk_start, size_t chunk_size,
+                                                     int iters, size_t /* worker_index */) {
+    const size_t band_rows = chunk_size / shape.pitch_bytes;
+    for (int pass = 0; pass < iters; ++pass) {
+      write_matrix_band(chunk_start, band_rows, shape, layout, kernels);
+    }
+  };
+
+  return run_parallel_test_indexed_with_boundaries(buffer, boundaries.back(), iterations, timer,
+                                                   boundaries, matrix_write_work, "matrix_write");
+}
+
+// Helper function to run a 2D matrix copy or out-of-place transpose test (multi-threaded)
+// Transpose workers own source row bands; their destination columns are disjoint.
+double run_pattern_copy_matrix_test(void* dst, void* src, const PatternWorkPlan& plan,
+                                    PatternMatrixLayout layout, int iterations,
+                                    const MemoryKernelSet& kernels, HighResTimer& timer) {
+  const std::vector<size_t> boundaries = build_finalized_boundaries(plan.workers);
+  if (boundaries.empty() || iterations <= 0 || plan.matrix_shape.pitch_bytes == 0) {
+    return 0.0;
+  }
+  const PatternMatrixShape shape = plan.matrix_shape;
+
+  if (layout == PatternMatrixLayout::Transpose) {
+    uint64_t* destination = static_cast<uint64_t*>(dst);
+    const char* source_start = static_cast<const char*>(src);
+    auto matrix_transpose_work = [destination, source_start, shape](
+                                     char* chunk_start, size_t chunk_size, int iters,
+                                     size_t /* worker_index */) {
+      const size_t first_row =
+          static_cast<size_t>(chunk_start - source_start) / shape.pitch_bytes;
+      const size_t band_rows = chunk_size / shape.pitch_bytes;
+      for (int pass = 0; pass < iters; ++pass) {
+        transpose_matrix_band(destination, chunk_start, first_row, band_rows, shape);
+      }
+    };
+    return run_parallel_test_indexed_with_boundaries(src, boundaries.back(), iterations, timer,
+                                                     boundaries, matrix_transpose_work,
+                                                     "matrix_transpose");
+  }
+
+  auto matrix_copy_work = [&kernels, shape, layout](char* dst_chunk, char* src_chunk,
+                                                    size_t chunk_size, int iters,
+                                                    size_t /* worker_index */) {
+    const size_t band_rows = chunk_size / shape.pitch_bytes;
+    for (int pass = 0; pass < iters; ++pass) {
+      copy_matrix_band(dst_chunk, src_chunk, band_rows, shape, layout, kernels);
+    }
+  };
+
+  return run_parallel_test_copy_indexed_with_boundaries(dst, src, boundaries.back(), iterations,
+                                                        timer, boundaries, matrix_copy_work,
+                                                        "matrix_copy");
+}
+
 // Helper function to run a random pattern read test (multi-threaded)
 double run_pattern_read_random_test(void* buffer, const std::vector<PatternRandomWorkerIndices>& worker_indices,
-                                    int iterations, std::atomic<uint64_t>& checksum, HighResTimer& timer) {
+                                    int iterations, uint64_t (*read_func)(const void*, const size_t*, size_t),
+                                    std::atomic<uint64_t>& checksum, HighResTimer& timer) {
   checksum.store(0, std::memory_order_relaxed);
   const std::vector<size_t> boundaries = build_finalized_boundaries(worker_indices);
   if (boundaries.empty() || !validate_random_worker_plan(worker_indices, boundaries)) {
@@ -223,7 +439,7 @@ double run_pattern_read_random_test(void* buffer, const std::vector<PatternRando
   std::vector<uint64_t> worker_checksums(worker_indices.size(), 0);
   char* buffer_start = static_cast<char*>(buffer);
 
-  auto make_work = [buffer_start, &worker_checksums, &worker_indices](
+  auto make_work = [buffer_start, &worker_checksums, &worker_indices, read_func](
                        size_t chunk_start_offset, size_t /* chunk_size */, int iters,
                        size_t worker_index) {
     char* chunk_start = buffer_start + chunk_start_offset;
@@ -231,10 +447,10 @@ double run_pattern_read_random_test(void* buffer, const std::vector<PatternRando
     const size_t* indices = worker.indices.data();
     const size_t index_count = worker.indices.size();
     uint64_t* worker_checksum = &worker_checksums[worker_index];
-    return [chunk_start, indices, index_count, iters, worker_checksum]() {
+    return [chunk_start, indices, index_count, iters, worker_checksum, read_func]() {
       uint64_t local_checksum = 0;
       for (int i = 0; i < iters; ++i) {
-        local_checksum ^= memory_read_random_loop_asm(chunk_start, indices, index_count);
+        local_checksum ^= read_func(chunk_start, indices, index_count);
       }
       *worker_checksum = local_checksum;
     };
@@ -253,22 +469,23 @@ double run_pattern_read_random_test(void* buffer, const std::vector<PatternRando
 
 // Helper function to run a random pattern write test (multi-threaded)
 double run_pattern_write_random_test(void* buffer, const std::vector<PatternRandomWorkerIndices>& worker_indices,
-                                     int iterations, HighResTimer& timer) {
+                                     int iterations, void (*write_func)(void*, const size_t*, size_t),
+                                     HighResTimer& timer) {
   const std::vector<size_t> boundaries = build_finalized_boundaries(worker_indices);
   if (boundaries.empty() || !validate_random_worker_plan(worker_indices, boundaries)) return 0.0;
   const size_t buffer_size = boundaries.back();
   char* buffer_start = static_cast<char*>(buffer);
 
-  auto make_work = [buffer_start, &worker_indices](size_t chunk_start_offset,
-                                                   size_t /* chunk_size */, int iters,
-                                                   size_t worker_index) {
+  auto make_work = [buffer_start, &worker_indices, write_func](size_t chunk_start_offset,
+                                                               size_t /* chunk_size */, int iters,
+                                                               size_t worker_index) {
     char* chunk_start = buffer_start + chunk_start_offset;
     const PatternRandomWorkerIndices& worker = worker_indices[worker_index];
     const size_t* indices = worker.indices.data();
     const size_t index_count = worker.indices.size();
-    return [chunk_start, indices, index_count, iters]() {
+    return [chunk_start, indices, index_count, iters, write_func]() {
       for (int i = 0; i < iters; ++i) {
-        memory_write_random_loop_asm(chunk_start, indices, index_count);
+        write_func(chunk_start, indices, index_count);
       }
     };
   };
@@ -280,14 +497,15 @@ double run_pattern_write_random_test(void* buffer, const std::vector<PatternRand
 
 // Helper function to run a random pattern copy test (multi-threaded)
 double run_pattern_copy_random_test(void* dst, void* src, const std::vector<PatternRandomWorkerIndices>& worker_indices,
-                                    int iterations, HighResTimer& timer) {
+                                    int iterations, void (*copy_func)(void*, const void*, const size_t*, size_t),
+                                    HighResTimer& timer) {
   const std::vector<size_t> boundaries = build_finalized_boundaries(worker_indices);
   if (boundaries.empty() || !validate_random_worker_plan(worker_indices, boundaries)) return 0.0;
   const size_t buffer_size = boundaries.back();
   char* dst_start = static_cast<char*>(dst);
   char* src_start = static_cast<char*>(src);
 
-  auto make_work = [dst_start, src_start, &worker_indices](
+  auto make_work = [dst_start, src_start, &worker_indices, copy_func](
                        size_t chunk_start_offset, size_t /* chunk_size */, int iters,
                        size_t worker_index) {
     char* dst_chunk = dst_start + chunk_start_offset;
@@ -295,9 +513,9 @@ double run_pattern_copy_random_test(void* dst, void* src, const std::vector<Patt
     const PatternRandomWorkerIndices& worker = worker_indices[worker_index];
     const size_t* indices = worker.indices.data();
     const size_t index_count = worker.indices.size();
-    return [dst_chunk, src_chunk, indices, index_count, iters]() {
+    return [dst_chunk, src_chunk, indices, index_count, iters, copy_func]() {
       for (int i = 0; i < iters; ++i) {
-        memory_copy_random_loop_asm(dst_chunk, src_chunk, indices, index_count);
+        copy_func(dst_chunk, src_chunk, indices, index_count);
       }
     };
   };
@@ -306,3 +524,110 @@ double run_pattern_copy_random_test(void* dst, void* src, const std::vector<Patt
                                   static_cast<int>(worker_indices.size()), timer,
                                   "random_copy", make_work, &boundaries);
 }
+
+// Helper function to run a gather pattern test (multi-threaded)
+double run_pattern_gather_test(void* buffer, const std::vector<PatternRandomWorkerIndices>& worker_indices,
+                               const PatternWorkPlan& plan, int iterations,
+                               uint64_t (*gather_func)(const void*, const size_t*, size_t),
+                               std::atomic<uint64_t>& checksum, HighResTimer& timer) {
+  checksum.store(0, std::memory_order_relaxed);
+  const std::vector<size_t> boundaries = build_finalized_boundaries(worker_indices);
+  if (boundaries.empty() || !validate_random_worker_plan(worker_indices, boundaries) ||
+      !validate_gather_worker_plan(worker_indices, plan)) {
+    return 0.0;
+  }
+  const size_t buffer_size = boundaries.back();
+  std::vector<uint64_t> worker_checksums(worker_indices.size(), 0);
+  char* buffer_start = static_cast<char*>(buffer);
+
+  auto make_work = [buffer_start, &worker_checksums, &worker_indices, &plan, gather_func](
+                       size_t chunk_start_offset, size_t /* chunk_size */, int iters,
+                       size_t worker_index) {
+    char* chunk_start = buffer_start + chunk_start_offset;
+    const size_t* indices = worker_indices[worker_index].indices.data();
+    const size_t index_count = plan.workers[worker_index].accesses_per_pass;
+    uint64_t* worker_checksum = &worker_checksums[worker_index];
+    return [chunk_start, indices, index_count, iters, worker_checksum, gather_func]() {
+      uint64_t local_checksum = 0;
+      for (int i = 0; i < iters; ++i) {
+        local_checksum ^= gather_func(chunk_start, indices, index_count);
+      }
+      *worker_checksum = local_checksum;
+    };
+  };
+
+  const double duration = run_parallel_test_common(
+      buffer, buffer_size, iterations, static_cast<int>(worker_indices.size()), timer,
+      "gather", make_work, &boundaries);
+  uint64_t combined_checksum = 0;
+  for (uint64_t worker_checksum : worker_checksums) {
+    combined_checksum ^= worker_checksum;
+  }
+  checksum.store(combined_checksum, std::memory_order_release);
+  return duration;
+}
+
+// Helper function to run a scatter pattern test (multi-threaded)
+double run_pattern_scatter_test(void* buffer, const std::vector<PatternRandomWorkerIndices>& worker_indices,
+                                const PatternWorkPlan& plan, int iterations,
+                                void (*scatter_func)(void*, const size_t*, size_t),
+                                HighResTimer& timer) {
+  const std::vector<size_t> boundaries = build_finalized_boundaries(worker_indices);
+  if (boundaries.empty() || !validate_random_worker_plan(worker_indices, boundaries) ||
+      !validate_gather_worker_plan(worker_indices, plan)) {
+    return 0.0;
+  }
+  const size_t buffer_size = boundaries.back();
+  char* buffer_start = static_cast<char*>(buffer);
+
+  auto make_work = [buffer_start, &worker_indices, &plan, scatter_func](
+                       size_t chunk_start_offset, size_t /* chunk_size */, int iters,
+                       size_t worker_index) {
+    char* chunk_start = buffer_start + chunk_start_offset;
+    const size_t* indices = worker_indices[worker_index].indices.data();
+    const size_t index_count = plan.workers[worker_index].accesses_per_pass;
+    return [chunk_start, indices, index_count, iters, scatter_func]() {
+      for (int i = 0; i < iters; ++i) {
+        scatter_func(chunk_start, indices, index_count);
+      }
+    };
+  };
+
+  return run_parallel_test_common(buffer, buffer_size, iterations,
+                                  static_cast<int>(worker_indices.size()), timer,
+                                  "scatter", make_work, &boundaries);
+}
+
+// Helper function to run a gather-scatter pattern test (multi-threaded)
+double run_pattern_gather_scatter_test(void* dst, void* src,
+                                       const std::vector<PatternRandomWorkerIndices>& worker_indices,
+                                       const PatternWorkPlan& plan, int iterations,
+                                       void (*gather_scatter_func)(void*, const void*, const size_t*, size_t),
+                                       HighResTimer& timer) {
+  const std::vector<size_t> boundaries = build_finalized_boundaries(worker_indices);
+  if (boundaries.empty() || !validate_random_worker_plan(worker_indices, boundaries) ||
+      !validate_gather_worker_plan(worker_indices, plan)) {
+    return 0.0;
+  }
+  const size_t buffer_size = boundaries.back();
+  char* dst_start = static_cast<char*>(dst);
+  char* src_start = static_cast<char*>(src);
+
+  auto make_work = [dst_start, src_start, &worker_indices, &plan, gather_scatter_func](
+                       size_t chunk_start_offset, size_t /* chunk_size */, int iters,
+                       size_t worker_index) {
+    char* dst_chunk = dst_start + chunk_start_offset;
+    char* src_chunk = src_start + chunk_start_offset;
+    const size_t* indices = worker_indices[worker_index].indices.data();
+    const size_t index_count = plan.workers[worker_index].accesses_per_pass;
+    return [dst_chunk, src_chunk, indices, index_count, iters, gather_scatter_func]() {
+      for (int i = 0; i < iters; ++i) {
+        gather_scatter_func(dst_chunk, src_chunk, indices, index_count);
+      }
+    };
+  };
+
+  return run_parallel_test_common(dst, buffer_size, iterations,
+                                  static_cast<int>(worker_indices.size()), timer,
+                                  "gather_scatter", make_work, &boundaries);
+}
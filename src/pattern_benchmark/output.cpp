@@ -33,9 +33,12 @@
 #include "core/config/constants.h"
 #include "output/console/messages/messages_api.h"
 #include "output/console/statistics_renderer.h"
+#include <array>
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 // ============================================================================
@@ -161,6 +164,106 @@ static void print_random_results(const PatternResults& results) {
   std::cout << "\n";
 }
 
+// Print gather/scatter results; the NEON kernels are compared with the scalar baseline
+static void print_gather_results(const PatternResults& results) {
+  std::cout << Messages::pattern_gather_scatter_scalar() << "\n";
+  const PatternMeasurement& scalar_read = get_pattern_measurement(
+      results, PatternKind::GatherScatterScalar, PatternOperation::Read);
+  const PatternMeasurement& scalar_write = get_pattern_measurement(
+      results, PatternKind::GatherScatterScalar, PatternOperation::Write);
+  const PatternMeasurement& scalar_copy = get_pattern_measurement(
+      results, PatternKind::GatherScatterScalar, PatternOperation::Copy);
+  print_measurement_line(Messages::pattern_read_label(), scalar_read);
+  print_measurement_line(Messages::pattern_write_label(), scalar_write);
+  print_measurement_line(Messages::pattern_copy_label(), scalar_copy);
+  std::cout << "\n";
+
+  std::cout << Messages::pattern_gather_scatter_neon() << "\n";
+  print_measurement_line(
+      Messages::pattern_read_label(),
+      get_pattern_measurement(results, PatternKind::GatherScatterNeon,
+                              PatternOperation::Read),
+      &scalar_read);
+  print_measurement_line(
+      Messages::pattern_write_label(),
+      get_pattern_measurement(results, PatternKind::GatherScatterNeon,
+                              PatternOperation::Write),
+      &scalar_write);
+  print_measurement_line(
+      Messages::pattern_copy_label(),
+      get_pattern_measurement(results, PatternKind::GatherScatterNeon,
+                              PatternOperation::Copy),
+      &scalar_copy);
+  std::cout << "\n";
+}
+
+// Print skewed pattern results against the uniform random baseline, followed by
+// the distribution parameters and hit-ratio proxies
+static void print_skewed_results(const PatternResults& results, PatternKind kind,
+                                 const std::string& name) {
+  std::cout << name << "\n";
+  for (PatternOperation operation : {PatternOperation::Read, PatternOperation::Write,
+                                     PatternOperation::Copy}) {
+    const std::string& label = operation == PatternOperation::Read
+                                   ? Messages::pattern_read_label()
+                                   : operation == PatternOperation::Write
+                                         ? Messages::pattern_write_label()
+                                         : Messages::pattern_copy_label();
+    print_measurement_line(label, get_pattern_measurement(results, kind, operation),
+                           &get_pattern_measurement(results, PatternKind::Random, operation));
+  }
+  const PatternMeasurement& read =
+      get_pattern_measurement(results, kind, PatternOperation::Read);
+  if (read.skew_parameters.has_value()) {
+    const PatternSkewParameters& parameters = *read.skew_parameters;
+    const std::string description =
+        kind == PatternKind::SkewedZipf
+            ? Messages::pattern_skew_zipf_parameters(parameters.zipf_theta)
+            : Messages::pattern_skew_hot_set_parameters(
+                  parameters.hot_fraction, parameters.hot_probability, parameters.phases);
+    std::cout << Messages::pattern_skew_hit_ratio_proxy(
+                     description, read.l1_hit_ratio_proxy, read.l2_hit_ratio_proxy)
+              << "\n";
+  }
+  std::cout << "\n";
+}
+
+// Print 2D matrix results: row-major against sequential forward, the other
+// layouts against row-major over the same matrix, then the shared shape
+static void print_matrix_results(const PatternResults& results) {
+  const std::array<std::pair<PatternKind, const std::string*>, 4> layouts = {{
+      {PatternKind::MatrixRowMajor, &Messages::pattern_matrix_row_major()},
+      {PatternKind::MatrixColumnMajor, &Messages::pattern_matrix_column_major()},
+      {PatternKind::MatrixTiled, &Messages::pattern_matrix_tiled()},
+      {PatternKind::MatrixTranspose, &Messages::pattern_matrix_transpose()},
+  }};
+  for (const auto& [kind, name] : layouts) {
+    std::cout << *name << "\n";
+    const PatternKind baseline_kind = kind == PatternKind::MatrixRowMajor
+                                          ? PatternKind::SequentialForward
+                                          : PatternKind::MatrixRowMajor;
+    for (PatternOperation operation : {PatternOperation::Read, PatternOperation::Write,
+                                       PatternOperation::Copy}) {
+      const std::string& label = operation == PatternOperation::Read
+                                     ? Messages::pattern_read_label()
+                                     : operation == PatternOperation::Write
+                                           ? Messages::pattern_write_label()
+                                           : Messages::pattern_copy_label();
+      print_measurement_line(label, get_pattern_measurement(results, kind, operation),
+                             &get_pattern_measurement(results, baseline_kind, operation));
+    }
+    std::cout << "\n";
+  }
+  const PatternMeasurement& copy = get_pattern_measurement(
+      results, PatternKind::MatrixRowMajor, PatternOperation::Copy);
+  if (copy.matrix_shape.has_value()) {
+    const PatternMatrixShape& shape = *copy.matrix_shape;
+    std::cout << Messages::pattern_matrix_shape(shape.rows, shape.row_bytes,
+                                                shape.pitch_bytes, shape.tile_elements)
+              << "\n\n";
+  }
+}
+
 void print_pattern_results(const PatternResults& results) {
   using namespace Constants;
   
@@ -177,6 +280,13 @@ void print_pattern_results(const PatternResults& results) {
   print_strided_results(results, Messages::pattern_superpage_2mb(),
                         PatternKind::Strided2MiB);
   print_random_results(results);
+  print_gather_results(results);
+  print_skewed_results(results, PatternKind::SkewedZipf, Messages::pattern_skewed_zipf());
+  print_skewed_results(results, PatternKind::SkewedHotCold,
+                       Messages::pattern_skewed_hot_cold());
+  print_skewed_results(results, PatternKind::SkewedShiftingHotSet,
+                       Messages::pattern_skewed_shifting_hot_set());
+  print_matrix_results(results);
 }
 
 // ============================================================================
@@ -333,6 +443,99 @@ void print_pattern_statistics(int loop_count, const PatternStatistics& stats) {
                                  stats.all_random_copy_bw,
                                  PATTERN_SPARSE_CV_WARNING_PCT,
                                  noise_warnings);
+  std::cout << "\n";
+
+  // Display Gather/Scatter Scalar statistics
+  std::string gather_scalar_name = Messages::pattern_gather_scatter_scalar();
+  if (!gather_scalar_name.empty() && gather_scalar_name.back() == ':') {
+    gather_scalar_name.pop_back();
+  }
+  print_pattern_type_statistics(gather_scalar_name,
+                                 stats.all_gather_scalar_read_bw,
+                                 stats.all_gather_scalar_write_bw,
+                                 stats.all_gather_scalar_copy_bw,
+                                 PATTERN_SPARSE_CV_WARNING_PCT,
+                                 noise_warnings);
+  std::cout << "\n";
+
+  // Display Gather/Scatter NEON statistics
+  std::string gather_neon_name = Messages::pattern_gather_scatter_neon();
+  if (!gather_neon_name.empty() && gather_neon_name.back() == ':') {
+    gather_neon_name.pop_back();
+  }
+  print_pattern_type_statistics(gather_neon_name,
+                                 stats.all_gather_neon_read_bw,
+                                 stats.all_gather_neon_write_bw,
+                                 stats.all_gather_neon_copy_bw,
+                                 PATTERN_SPARSE_CV_WARNING_PCT,
+                                 noise_warnings);
+  std::cout << "\n";
+
+  // Display Skewed Zipf statistics
+  std::string zipf_name = Messages::pattern_skewed_zipf();
+  if (!zipf_name.empty() && zipf_name.back() == ':') {
+    zipf_name.pop_back();
+  }
+  print_pattern_type_statistics(zipf_name,
+                                 stats.all_zipf_read_bw,
+                                 stats.all_zipf_write_bw,
+                                 stats.all_zipf_copy_bw,
+                                 PATTERN_SPARSE_CV_WARNING_PCT,
+                                 noise_warnings);
+  std::cout << "\n";
+
+  // Display Skewed Hot/Cold statistics
+  std::string hot_cold_name = Messages::pattern_skewed_hot_cold();
+  if (!hot_cold_name.empty() && hot_cold_name.back() == ':') {
+    hot_cold_name.pop_back();
+  }
+  print_pattern_type_statistics(hot_cold_name,
+                                 stats.all_hot_cold_read_bw,
+                                 stats.all_hot_cold_write_bw,
+                                 stats.all_hot_cold_copy_bw,
+                                 PATTERN_SPARSE_CV_WARNING_PCT,
+                                 noise_warnings);
+  std::cout << "\n";
+
+  // Display Skewed Shifting Hot Set statistics
+  std::string shifting_hot_name = Messages::pattern_skewed_shifting_hot_set();
+  if (!shifting_hot_name.empty() && shifting_hot_name.back() == ':') {
+    shifting_hot_name.pop_back();
+  }
+  print_pattern_type_statistics(shifting_hot_name,
+                                 stats.all_shifting_hot_read_bw,
+                                 stats.all_shifting_hot_write_bw,
+                                 stats.all_shifting_hot_copy_bw,
+                                 PATTERN_SPARSE_CV_WARNING_PCT,
+                                 noise_warnings);
+
+  // Display 2D matrix statistics; column-major and transpose are sparse-line traversals
+  const std::array<std::tuple<std::string, const std::vector<double>*,
+                              const std::vector<double>*, const std::vector<double>*, double>,
+                   4>
+      matrix_layouts = {{
+          {Messages::pattern_matrix_row_major(), &stats.all_matrix_row_read_bw,
+           &stats.all_matrix_row_write_bw, &stats.all_matrix_row_copy_bw,
+           PATTERN_STREAMING_CV_WARNING_PCT},
+          {Messages::pattern_matrix_column_major(), &stats.all_matrix_column_read_bw,
+           &stats.all_matrix_column_write_bw, &stats.all_matrix_column_copy_bw,
+           PATTERN_SPARSE_CV_WARNING_PCT},
+          {Messages::pattern_matrix_tiled(), &stats.all_matrix_tiled_read_bw,
+           &stats.all_matrix_tiled_write_bw, &stats.all_matrix_tiled_copy_bw,
+           PATTERN_STREAMING_CV_WARNING_PCT},
+          {Messages::pattern_matrix_transpose(), &stats.all_matrix_transpose_read_bw,
+           &stats.all_matrix_transpose_write_bw, &stats.all_matrix_transpose_copy_bw,
+           PATTERN_SPARSE_CV_WARNING_PCT},
+      }};
+  for (const auto& [name, read_bw, write_bw, copy_bw, cv_threshold] : matrix_layouts) {
+    std::string matrix_name = name;
+    if (!matrix_name.empty() && matrix_name.back() == ':') {
+      matrix_name.pop_back();
+    }
+    std::cout << "\n";
+    print_pattern_type_statistics(matrix_name, *read_bw, *write_bw, *copy_bw, cv_threshold,
+                                  noise_warnings);
+  }
   
   // Print a final separator after statistics
   std::cout << Messages::statistics_footer() << std::endl;
@@ -50,9 +50,19 @@ enum class PatternKind {
   Strided16384,
   Strided2MiB,
   Random,
+  GatherScatterScalar,  ///< Indexed 8-byte elements, scalar loads/stores
+  GatherScatterNeon,    ///< Same indices, elements moved through NEON registers
+  SkewedZipf,            ///< With-replacement Zipf(theta) slot popularity
+  SkewedHotCold,         ///< Fixed hot set drawn with the hot probability
+  SkewedShiftingHotSet,  ///< Hot/cold stream whose hot set moves each phase
+  MatrixRowMajor,        ///< Pitched matrix rows traversed left to right
+  MatrixColumnMajor,     ///< Pitched matrix traversed down 32-byte columns
+  MatrixTiled,           ///< Pitched matrix traversed in square tiles
+  MatrixTranspose,       ///< Tiled out-of-place transpose; copy only
   Count,
 };
 
+/** Read/Write/Copy are gather/scatter/gather-scatter for the indexed kinds. */
 enum class PatternOperation {
   Read = 0,
   Write,
@@ -92,6 +102,12 @@ struct PatternMeasurement {
   size_t logical_working_set_bytes = 0;
   size_t completed_phase_cycles = 0;
   size_t phase_period_passes = 0;
+  size_t indices_per_group = 0;  ///< Gather/scatter kinds only
+  std::string kernel_variant;    ///< Kernel family that executed; empty when not run
+  std::optional<PatternSkewParameters> skew_parameters;  ///< Skewed kinds only
+  std::optional<double> l1_hit_ratio_proxy;  ///< Skewed kinds: ideal L1-sized pinned-line hit share
+  std::optional<double> l2_hit_ratio_proxy;  ///< Skewed kinds: ideal L2-sized pinned-line hit share
+  std::optional<PatternMatrixShape> matrix_shape;  ///< Matrix kinds only
   uint64_t seed = 0;
   bool has_seed = false;
   bool automatic_calibration = false;
@@ -113,7 +129,7 @@ constexpr size_t pattern_measurement_index(PatternKind kind,
  * @brief Status-bearing evidence from one pattern benchmark loop.
  *
  * The fixed measurement array is the sole per-operation source of truth. Loop
- * status and counters summarize whether all 21 planned operations reached a
+ * status and counters summarize whether all 48 planned operations reached a
  * terminal measured-or-skipped state.
  */
 struct PatternResults {
@@ -170,6 +186,33 @@ struct PatternStatistics {
   std::vector<double> all_random_read_bw;         ///< Random read bandwidth from each loop (GB/s)
   std::vector<double> all_random_write_bw;        ///< Random write bandwidth from each loop (GB/s)
   std::vector<double> all_random_copy_bw;         ///< Random copy bandwidth from each loop (GB/s)
+  std::vector<double> all_gather_scalar_read_bw;   ///< Scalar gather bandwidth from each loop (GB/s)
+  std::vector<double> all_gather_scalar_write_bw;  ///< Scalar scatter bandwidth from each loop (GB/s)
+  std::vector<double> all_gather_scalar_copy_bw;   ///< Scalar gather-scatter bandwidth from each loop (GB/s)
+  std::vector<double> all_gather_neon_read_bw;     ///< NEON gather bandwidth from each loop (GB/s)
+  std::vector<double> all_gather_neon_write_bw;    ///< NEON scatter bandwidth from each loop (GB/s)
+  std::vector<double> all_gather_neon_copy_bw;     ///< NEON gather-scatter bandwidth from each loop (GB/s)
+  std::vector<double> all_zipf_read_bw;            ///< Zipf read bandwidth from each loop (GB/s)
+  std::vector<double> all_zipf_write_bw;           ///< Zipf write bandwidth from each loop (GB/s)
+  std::vector<double> all_zipf_copy_bw;            ///< Zipf copy bandwidth from each loop (GB/s)
+  std::vector<double> all_hot_cold_read_bw;        ///< Hot/cold read bandwidth from each loop (GB/s)
+  std::vector<double> all_hot_cold_write_bw;       ///< Hot/cold write bandwidth from each loop (GB/s)
+  std::vector<double> all_hot_cold_copy_bw;        ///< Hot/cold copy bandwidth from each loop (GB/s)
+  std::vector<double> all_shifting_hot_read_bw;    ///< Shifting hot-set read bandwidth from each loop (GB/s)
+  std::vector<double> all_shifting_hot_write_bw;   ///< Shifting hot-set write bandwidth from each loop (GB/s)
+  std::vector<double> all_shifting_hot_copy_bw;    ///< Shifting hot-set copy bandwidth from each loop (GB/s)
+  std::vector<double> all_matrix_row_read_bw;      ///< Matrix row-major read bandwidth from each loop (GB/s)
+  std::vector<double> all_matrix_row_write_bw;     ///< Matrix row-major write bandwidth from each loop (GB/s)
+  std::vector<double> all_matrix_row_copy_bw;      ///< Matrix row-major copy bandwidth from each loop (GB/s)
+  std::vector<double> all_matrix_column_read_bw;   ///< Matrix column-major read bandwidth from each loop (GB/s)
+  std::vector<double> all_matrix_column_write_bw;  ///< Matrix column-major write bandwidth from each loop (GB/s)
+  std::vector<double> all_matrix_column_copy_bw;   ///< Matrix column-major copy bandwidth from each loop (GB/s)
+  std::vector<double> all_matrix_tiled_read_bw;    ///< Matrix tiled read bandwidth from each loop (GB/s)
+  std::vector<double> all_matrix_tiled_write_bw;   ///< Matrix tiled write bandwidth from each loop (GB/s)
+  std::vector<double> all_matrix_tiled_copy_bw;    ///< Matrix tiled copy bandwidth from each loop (GB/s)
+  std::vector<double> all_matrix_transpose_read_bw;   ///< Always empty: transpose is copy only
+  std::vector<double> all_matrix_transpose_write_bw;  ///< Always empty: transpose is copy only
+  std::vector<double> all_matrix_transpose_copy_bw;   ///< Matrix transpose copy bandwidth from each loop (GB/s)
 };
 
 using PatternStatisticsData = DescriptiveStatistics;
@@ -255,7 +298,8 @@ bool validate_random_indices(const std::vector<size_t>& indices, size_t buffer_s
  * @return EXIT_SUCCESS on success, EXIT_FAILURE on error
  *
  * Executes benchmarks for sequential forward, sequential reverse, strided (64B and 4096B),
- * and random access patterns. Results are stored in the PatternResults structure.
+ * random, scalar/NEON gather-scatter, skewed (Zipf, hot/cold, shifting
+ * hot-set), and 2D matrix (row-major, column-major, tiled, transpose) access patterns. Results are stored in the PatternResults structure.
  */
 int run_pattern_benchmarks(const PatternBuffers& buffers, const BenchmarkConfig& config,
                            PatternResults& results, size_t loop_index = 0);
@@ -21,8 +21,8 @@
  *
  * This file provides the main public API function for running pattern
  * benchmarks. It orchestrates the execution of all pattern types (sequential,
- * strided, random) within a single benchmark loop and generates random
- * indices for random access patterns.
+ * strided, random, gather/scatter, skewed, 2D matrix) within a single benchmark
+ * loop and generates random indices for random access patterns.
  *
  * Primary responsibilities:
  * - Coordinate execution of all pattern types in sequence
@@ -56,9 +56,21 @@ void run_forward_pattern_benchmarks(const PatternBuffers& buffers, const Benchma
 void run_reverse_pattern_benchmarks(const PatternBuffers& buffers, const BenchmarkConfig& config,
                                    PatternResults& results, HighResTimer& timer);
 int run_random_pattern_benchmarks(const PatternBuffers& buffers, const BenchmarkConfig& config,
+                                   PatternKind kind,
                                    const std::vector<size_t>& random_indices,
                                    const std::vector<PatternRandomWorkerIndices>& worker_indices,
                                    PatternResults& results, HighResTimer& timer);
+int run_gather_pattern_benchmarks(const PatternBuffers& buffers, const BenchmarkConfig& config,
+                                  PatternKind kind,
+                                  const std::vector<size_t>& random_indices,
+                                  const std::vector<PatternRandomWorkerIndices>& worker_indices,
+                                  PatternResults& results, HighResTimer& timer);
+int run_skewed_pattern_benchmarks(const PatternBuffers& buffers, const BenchmarkConfig& config,
+                                  PatternKind kind, size_t num_accesses,
+                                  PatternResults& results, HighResTimer& timer);
+int run_matrix_pattern_benchmarks(const PatternBuffers& buffers, const BenchmarkConfig& config,
+                                  PatternKind kind, PatternResults& results,
+                                  HighResTimer& timer);
 
 // ============================================================================
 // Public API Functions
@@ -66,6 +78,8 @@ int run_random_pattern_benchmarks(const PatternBuffers& buffers, const Benchmark
 
 std::array<PatternKind, static_cast<size_t>(PatternKind::Count)>
 build_pattern_execution_order(size_t loop_index) {
+  // The rotation spans every kind, so adding a kind changes which position the
+  // existing kinds take in loops after the first.
   constexpr std::array<PatternKind, static_cast<size_t>(PatternKind::Count)>
       base_order = {PatternKind::SequentialForward,
                     PatternKind::SequentialReverse,
@@ -73,7 +87,16 @@ build_pattern_execution_order(size_t loop_index) {
                     PatternKind::Strided4096,
                     PatternKind::Strided16384,
                     PatternKind::Strided2MiB,
-                    PatternKind::Random};
+                    PatternKind::Random,
+                    PatternKind::GatherScatterScalar,
+                    PatternKind::GatherScatterNeon,
+                    PatternKind::SkewedZipf,
+                    PatternKind::SkewedHotCold,
+                    PatternKind::SkewedShiftingHotSet,
+                    PatternKind::MatrixRowMajor,
+                    PatternKind::MatrixColumnMajor,
+                    PatternKind::MatrixTiled,
+                    PatternKind::MatrixTranspose};
   std::array<PatternKind, static_cast<size_t>(PatternKind::Count)> order{};
   const size_t rotation = loop_index % base_order.size();
   for (size_t position = 0; position < order.size(); ++position) {
@@ -157,7 +180,24 @@ int run_pattern_benchmarks(const PatternBuffers& buffers, const BenchmarkConfig&
         break;
       case PatternKind::Random:
         status = run_random_pattern_benchmarks(
-            buffers, config, random_indices, random_worker_indices, results, timer);
+            buffers, config, kind, random_indices, random_worker_indices, results, timer);
+        break;
+      case PatternKind::GatherScatterScalar:
+      case PatternKind::GatherScatterNeon:
+        status = run_gather_pattern_benchmarks(
+            buffers, config, kind, random_indices, random_worker_indices, results, timer);
+        break;
+      case PatternKind::SkewedZipf:
+      case PatternKind::SkewedHotCold:
+      case PatternKind::SkewedShiftingHotSet:
+        status = run_skewed_pattern_benchmarks(
+            buffers, config, kind, num_random_accesses, results, timer);
+        break;
+      case PatternKind::MatrixRowMajor:
+      case PatternKind::MatrixColumnMajor:
+      case PatternKind::MatrixTiled:
+      case PatternKind::MatrixTranspose:
+        status = run_matrix_pattern_benchmarks(buffers, config, kind, results, timer);
         break;
       case PatternKind::Count:
         status = EXIT_FAILURE;
@@ -26,7 +26,8 @@
  *
  * Coordinates execution of:
  * - Multiple benchmark loops (user-configurable loop count)
- * - All pattern types (forward, reverse, strided, random)
+ * - All pattern types (forward, reverse, strided, random, gather/scatter, skewed,
+ *   2D matrix)
  * - Result aggregation into PatternStatistics structure
  */
 #include "pattern_benchmark/pattern_benchmark.h"
@@ -74,6 +75,33 @@ constexpr std::array<PatternValuesMember,
         &PatternStatistics::all_random_read_bw,
         &PatternStatistics::all_random_write_bw,
         &PatternStatistics::all_random_copy_bw,
+        &PatternStatistics::all_gather_scalar_read_bw,
+        &PatternStatistics::all_gather_scalar_write_bw,
+        &PatternStatistics::all_gather_scalar_copy_bw,
+        &PatternStatistics::all_gather_neon_read_bw,
+        &PatternStatistics::all_gather_neon_write_bw,
+        &PatternStatistics::all_gather_neon_copy_bw,
+        &PatternStatistics::all_zipf_read_bw,
+        &PatternStatistics::all_zipf_write_bw,
+        &PatternStatistics::all_zipf_copy_bw,
+        &PatternStatistics::all_hot_cold_read_bw,
+        &PatternStatistics::all_hot_cold_write_bw,
+        &PatternStatistics::all_hot_cold_copy_bw,
+        &PatternStatistics::all_shifting_hot_read_bw,
+        &PatternStatistics::all_shifting_hot_write_bw,
+        &PatternStatistics::all_shifting_hot_copy_bw,
+        &PatternStatistics::all_matrix_row_read_bw,
+        &PatternStatistics::all_matrix_row_write_bw,
+        &PatternStatistics::all_matrix_row_copy_bw,
+        &PatternStatistics::all_matrix_column_read_bw,
+        &PatternStatistics::all_matrix_column_write_bw,
+        &PatternStatistics::all_matrix_column_copy_bw,
+        &PatternStatistics::all_matrix_tiled_read_bw,
+        &PatternStatistics::all_matrix_tiled_write_bw,
+        &PatternStatistics::all_matrix_tiled_copy_bw,
+        &PatternStatistics::all_matrix_transpose_read_bw,
+        &PatternStatistics::all_matrix_transpose_write_bw,
+        &PatternStatistics::all_matrix_transpose_copy_bw,
 };
 
 void apply_pattern_loop_summary(PatternResults& results,
@@ -100,6 +128,25 @@ const PatternMeasurement& get_pattern_measurement(const PatternResults& results,
 void set_pattern_measurement(PatternResults& results, PatternKind kind,
                              PatternOperation operation,
                              PatternMeasurement measurement) {
+  // Only forward, strided, random, skewed, and matrix kinds report their own
+  // kernel family (the matrix transpose is portable C++); reverse and
+  // gather/scatter kernels are NEON on every host.
+  const bool selectable_kind = kind == PatternKind::SequentialForward ||
+                               kind == PatternKind::Strided64 ||
+                               kind == PatternKind::Strided4096 ||
+                               kind == PatternKind::Strided16384 ||
+                               kind == PatternKind::Strided2MiB ||
+                               kind == PatternKind::Random ||
+                               kind == PatternKind::SkewedZipf ||
+                               kind == PatternKind::SkewedHotCold ||
+                               kind == PatternKind::SkewedShiftingHotSet ||
+                               kind == PatternKind::MatrixRowMajor ||
+                               kind == PatternKind::MatrixColumnMajor ||
+                               kind == PatternKind::MatrixTiled ||
+                               kind == PatternKind::MatrixTranspose;
+  if (!selectable_kind && !measurement.kernel_variant.empty()) {
+    measurement.kernel_variant = memory_kernel_variant_to_string(MemoryKernelVariant::Neon);
+  }
   get_pattern_measurement(results, kind, operation) = std::move(measurement);
 }
 
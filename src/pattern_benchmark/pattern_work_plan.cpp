@@ -358,6 +358,131 @@ size_t calculate_pattern_calibrated_passes(double pilot_duration_seconds,
       minimum_passes, maximum_passes);
 }
 
+PatternWorkPlan build_gather_pattern_work_plan(
+    const std::vector<PatternRandomWorkerIndices>& worker_indices,
+    size_t element_size, size_t indices_per_group, int requested_threads) {
+  PatternWorkPlan plan;
+  plan.access_size_bytes = element_size;
+  plan.indices_per_group = indices_per_group;
+  plan.requested_threads = requested_threads;
+  if (element_size == 0 || indices_per_group == 0 || requested_threads <= 0 ||
+      worker_indices.empty() ||
+      worker_indices.size() > static_cast<size_t>(requested_threads)) {
+    plan.status_reason = Messages::pattern_reason_invalid_work_plan_parameters();
+    return plan;
+  }
+
+  plan.effective_threads = static_cast<int>(worker_indices.size());
+  plan.workers.reserve(worker_indices.size());
+  size_t minimum_accesses = std::numeric_limits<size_t>::max();
+  size_t maximum_accesses = 0;
+  for (const PatternRandomWorkerIndices& worker : worker_indices) {
+    PatternWorkerRange range;
+    range.offset_bytes = worker.offset_bytes;
+    range.span_bytes = worker.span_bytes;
+    range.accesses_per_pass =
+        worker.indices.size() / indices_per_group * indices_per_group;
+    if (range.accesses_per_pass == 0) {
+      plan.status = PatternMeasurementStatus::Skipped;
+      plan.status_reason = Messages::pattern_reason_no_valid_gather_workload();
+      plan.workers.clear();
+      return plan;
+    }
+    if (!NumericUtils::checked_multiply(range.accesses_per_pass, element_size,
+                                        range.payload_bytes_per_pass) ||
+        range.accesses_per_pass >
+            std::numeric_limits<size_t>::max() - plan.accesses_per_pass) {
+      plan.status_reason = Messages::pattern_reason_work_plan_byte_overflow();
+      plan.workers.clear();
+      return plan;
+    }
+    plan.accesses_per_pass += range.accesses_per_pass;
+    plan.payload_bytes_per_pass += range.payload_bytes_per_pass;
+    minimum_accesses = std::min(minimum_accesses, range.accesses_per_pass);
+    maximum_accesses = std::max(maximum_accesses, range.accesses_per_pass);
+    plan.workers.push_back(range);
+  }
+
+  plan.min_accesses_per_pass = minimum_accesses;
+  plan.max_accesses_per_pass = maximum_accesses;
+  plan.distinct_address_count = plan.accesses_per_pass;
+  plan.status = PatternMeasurementStatus::Measured;
+  plan.status_reason.clear();
+  return plan;
+}
+
+PatternWorkPlan build_matrix_pattern_work_plan(size_t buffer_size, size_t row_bytes,
+                                               size_t pitch_bytes, size_t tile_elements,
+                                               PatternMatrixLayout layout,
+                                               int requested_threads) {
+  using namespace Constants;
+  PatternWorkPlan plan;
+  plan.stride_bytes = pitch_bytes;
+  plan.access_size_bytes = layout == PatternMatrixLayout::Transpose
+                               ? PATTERN_MATRIX_ELEMENT_BYTES
+                               : PATTERN_ACCESS_SIZE_BYTES;
+  plan.requested_threads = requested_threads;
+  size_t tile_bytes = 0;
+  if (requested_threads <= 0 || tile_elements == 0 ||
+      tile_elements % PATTERN_MATRIX_TILE_ELEMENT_MULTIPLE != 0 ||
+      !NumericUtils::checked_multiply(tile_elements, PATTERN_MATRIX_ELEMENT_BYTES,
+                                      tile_bytes) ||
+      row_bytes == 0 || row_bytes % tile_bytes != 0 || pitch_bytes < row_bytes ||
+      pitch_bytes % PATTERN_ACCESS_SIZE_BYTES != 0) {
+    plan.status_reason = Messages::pattern_reason_invalid_work_plan_parameters();
+    return plan;
+  }
+
+  // Whole tile rows only, so every layout touches the same elements.
+  const size_t rows = buffer_size / pitch_bytes / tile_elements * tile_elements;
+  plan.matrix_shape.row_bytes = row_bytes;
+  plan.matrix_shape.pitch_bytes = pitch_bytes;
+  plan.matrix_shape.rows = rows;
+  plan.matrix_shape.tile_elements = tile_elements;
+  if (rows == 0) {
+    plan.status = PatternMeasurementStatus::Skipped;
+    plan.status_reason = Messages::pattern_reason_matrix_does_not_fit();
+    return plan;
+  }
+
+  const bool tile_bands = layout == PatternMatrixLayout::Tiled ||
+                          layout == PatternMatrixLayout::Transpose;
+  const size_t band_rows = tile_bands ? tile_elements : 1;
+  const size_t bands = rows / band_rows;
+  const size_t minimum_bands_per_worker =
+      layout == PatternMatrixLayout::ColumnMajor ? 2 : 1;
+  const size_t worker_count = std::min(static_cast<size_t>(requested_threads),
+                                       bands / minimum_bands_per_worker);
+  plan.effective_threads = static_cast<int>(worker_count);
+  plan.workers.reserve(worker_count);
+  size_t minimum_accesses = std::numeric_limits<size_t>::max();
+  size_t maximum_accesses = 0;
+  size_t first_band = 0;
+  for (size_t worker = 0; worker < worker_count; ++worker) {
+    const size_t end_band = bands * (worker + 1) / worker_count;
+    const size_t worker_rows = (end_band - first_band) * band_rows;
+    PatternWorkerRange range;
+    range.offset_bytes = first_band * band_rows * pitch_bytes;
+    range.span_bytes = worker_rows * pitch_bytes;
+    range.payload_bytes_per_pass = worker_rows * row_bytes;
+    range.accesses_per_pass = range.payload_bytes_per_pass / plan.access_size_bytes;
+    plan.accesses_per_pass += range.accesses_per_pass;
+    plan.payload_bytes_per_pass += range.payload_bytes_per_pass;
+    minimum_accesses = std::min(minimum_accesses, range.accesses_per_pass);
+    maximum_accesses = std::max(maximum_accesses, range.accesses_per_pass);
+    plan.workers.push_back(range);
+    first_band = end_band;
+  }
+
+  plan.min_accesses_per_pass = minimum_accesses;
+  plan.max_accesses_per_pass = maximum_accesses;
+  plan.distinct_address_count = plan.accesses_per_pass;
+  plan.logical_working_set_bytes = plan.payload_bytes_per_pass;
+  plan.status = PatternMeasurementStatus::Measured;
+  plan.status_reason.clear();
+  return plan;
+}
+
 const char* pattern_measurement_status_to_string(PatternMeasurementStatus status) {
   switch (status) {
     case PatternMeasurementStatus::Measured:
@@ -39,6 +39,20 @@ struct PatternWorkerRange {
   size_t payload_bytes_per_pass = 0;
 };
 
+enum class PatternMatrixLayout {
+  RowMajor,     ///< Each row left to right, rows in order
+  ColumnMajor,  ///< Each 32-byte column down every row, columns in order
+  Tiled,        ///< Square tiles, row-major inside and across tiles
+  Transpose,    ///< Out-of-place tiled transpose into a dense destination
+};
+
+struct PatternMatrixShape {
+  size_t row_bytes = 0;      ///< Logical bytes touched per row
+  size_t pitch_bytes = 0;    ///< Distance between consecutive row starts
+  size_t rows = 0;           ///< Rows used; a whole number of tiles
+  size_t tile_elements = 0;  ///< Square tile edge in 8-byte elements
+};
+
 struct PatternWorkPlan {
   PatternMeasurementStatus status = PatternMeasurementStatus::Invalid;
   std::string status_reason;
@@ -57,6 +71,8 @@ struct PatternWorkPlan {
   size_t distinct_address_count = 0;
   size_t logical_working_set_bytes = 0;
   size_t completed_phase_cycles = 0;
+  size_t indices_per_group = 0;  ///< Gather/scatter indices consumed per kernel group
+  PatternMatrixShape matrix_shape;  ///< Matrix kinds only
   std::vector<PatternWorkerRange> workers;
 };
 
@@ -111,12 +127,79 @@ std::vector<PatternRandomWorkerIndices> build_random_worker_indices(
     size_t buffer_size, size_t access_size, int requested_threads,
     const std::vector<size_t>& global_indices);
 
+/**
+ * @brief Build the gather/scatter plan over finalized random worker indices.
+ *
+ * Each worker executes the largest prefix of its indices that is a whole
+ * number of `indices_per_group` groups, and every access moves
+ * `element_size` bytes. Scalar and vector kernels share this plan, so their
+ * accesses and payload are identical. The plan is skipped when any worker
+ * lacks one full group.
+ */
+PatternWorkPlan build_gather_pattern_work_plan(
+    const std::vector<PatternRandomWorkerIndices>& worker_indices,
+    size_t element_size, size_t indices_per_group, int requested_threads);
+
+/**
+ * @brief Build a row-band work plan for one 2D matrix layout.
+ *
+ * The buffer is viewed as `buffer_size / pitch_bytes` rows of `row_bytes`,
+ * rounded down to whole tiles so every layout covers the same elements. Workers
+ * receive contiguous bands of whole rows (row-major, column-major) or whole tile
+ * rows (tiled, transpose); column-major bands keep at least two rows so every
+ * worker makes a genuine pitch transition. Worker ranges span complete pitches
+ * and are not cache-line trimmed. The plan is skipped when no whole tile row
+ * fits and invalid when the shape is; pass counts are calibrated by the caller.
+ */
+PatternWorkPlan build_matrix_pattern_work_plan(size_t buffer_size, size_t row_bytes,
+                                               size_t pitch_bytes, size_t tile_elements,
+                                               PatternMatrixLayout layout,
+                                               int requested_threads);
+
 /**
  * @brief Generate a deterministic no-replacement permutation prefix of aligned offsets.
  */
 std::vector<size_t> generate_random_indices(size_t buffer_size, size_t num_accesses,
                                             uint64_t seed);
 
+enum class PatternSkewDistribution {
+  Zipf,            ///< Rank popularity proportional to 1 / rank^theta
+  HotCold,         ///< Fixed hot set drawn with a fixed probability
+  ShiftingHotSet,  ///< Hot/cold whose hot set moves to a disjoint region each phase
+};
+
+struct PatternSkewParameters {
+  double zipf_theta = 0.0;
+  double hot_fraction = 0.0;
+  double hot_probability = 0.0;
+  size_t phases = 1;  ///< Equal-length stream phases; only the shifting set moves
+};
+
+/**
+ * @brief Generate a deterministic with-replacement skewed stream of aligned offsets.
+ *
+ * Zipf ranks are drawn by rejection-inversion and hot/cold ranks by a single
+ * uniform draw, so no per-slot table is materialized. Ranks map onto slots
+ * through a seeded coprime multiplier, scattering popular slots across the
+ * buffer. Returns an empty stream for invalid parameters.
+ */
+std::vector<size_t> generate_skewed_indices(PatternSkewDistribution distribution,
+                                            size_t buffer_size, size_t num_accesses,
+                                            const PatternSkewParameters& parameters,
+                                            uint64_t seed);
+
+/**
+ * @brief Share of accesses landing on the `capacity_bytes / line_bytes` most
+ *        frequently used lines, averaged over equal-length stream phases.
+ *
+ * This is the hit ratio of an ideal frequency-pinned cache of that capacity:
+ * an upper-bound proxy for how much of the stream a real cache could serve,
+ * not a measured hit rate.
+ */
+double calculate_pattern_hit_ratio_proxy(const std::vector<size_t>& indices,
+                                         size_t capacity_bytes, size_t line_bytes,
+                                         size_t phases = 1);
+
 const char* pattern_measurement_status_to_string(PatternMeasurementStatus status);
 
 #endif  // PATTERN_WORK_PLAN_H
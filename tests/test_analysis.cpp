@@ -278,6 +278,7 @@ TEST(AnalysisTest, CoordinatorCompletesWithoutLargeLocalityWithExactCounters) {
   EXPECT_TRUE(summary.conclusions_valid);
   EXPECT_FALSE(summary.large_locality_planned);
   EXPECT_FALSE(summary.large_locality_completed);
+  EXPECT_FALSE(summary.page_table_footprint_planned);
   ASSERT_EQ(summary.pass_summaries.size(), 1u);
   EXPECT_EQ(summary.pass_summaries[0].rounds_completed, 7u);
   EXPECT_TRUE(summary.pass_summaries[0].converged);
@@ -286,6 +287,45 @@ TEST(AnalysisTest, CoordinatorCompletesWithoutLargeLocalityWithExactCounters) {
             TlbScheduleExecutionStatus::Complete);
 }
 
+TEST(AnalysisTest, CoordinatorRunsPageTableFootprintAfterLargeLocality) {
+  BenchmarkConfig config;
+  config.tlb_sweep_density = TlbSweepDensity::Low;
+  TlbAnalysisExecutionSeam seam = make_tlb_execution_seam();
+  seam.selected_buffer_mb = 512;
+  TlbAnalysisCoordinatorSummary summary;
+  std::vector<TlbMeasurementPass> executed_passes;
+  std::vector<size_t> table_pass_pages;
+  seam.execute_pass = [&](TlbMeasurementPass pass,
+                          const std::vector<TlbSweepPoint>& points) {
+    executed_passes.push_back(pass);
+    if (pass == TlbMeasurementPass::PageTableFootprint) {
+      for (const TlbSweepPoint& point : points) {
+        table_pass_pages.push_back(point.requested_pages);
+      }
+    }
+    return make_pass_result(pass,
+                            points,
+                            TlbScheduleExecutionStatus::Complete,
+                            points.size(),
+                            7);
+  };
+  seam.observe_summary = [&](const TlbAnalysisCoordinatorSummary& value) {
+    summary = value;
+  };
+
+  EXPECT_EQ(run_tlb_analysis_silently(config, []() { return false; }, seam),
+            EXIT_SUCCESS);
+  EXPECT_EQ(executed_passes,
+            (std::vector<TlbMeasurementPass>{
+                TlbMeasurementPass::Base,
+                TlbMeasurementPass::LargeLocality,
+                TlbMeasurementPass::PageTableFootprint}));
+  EXPECT_EQ(table_pass_pages, (std::vector<size_t>{4096}));
+  EXPECT_TRUE(summary.page_table_footprint_planned);
+  EXPECT_TRUE(summary.page_table_footprint_completed);
+  EXPECT_EQ(summary.planned_passes, 3u);
+}
+
 TEST(AnalysisTest, PairedSummaryUsesMedianOfSameRoundDeltasAndFiltersPasses) {
   const size_t locality = 2 * Constants::BYTES_PER_MB;
   std::vector<TlbMeasurementRecord> records = {
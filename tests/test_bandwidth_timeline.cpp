@@ -0,0 +1,105 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file test_bandwidth_timeline.cpp
+ * @brief Unit tests for bandwidth timeline recording and phase analysis
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/bandwidth_timeline.h"
+
+namespace {
+
+// Builds cumulative 1 ms samples whose per-window rates are `rates_gb_s`.
+std::vector<BandwidthTimelineSample> samples_from_rates(const std::vector<double>& rates_gb_s) {
+  std::vector<BandwidthTimelineSample> samples = {{0.0, 0}};
+  uint64_t completed_bytes = 0;
+  for (size_t index = 0; index < rates_gb_s.size(); ++index) {
+    completed_bytes += static_cast<uint64_t>(rates_gb_s[index] * 1e6);
+    samples.push_back({static_cast<double>(index + 1) * 0.001, completed_bytes});
+  }
+  return samples;
+}
+
+}  // namespace
+
+TEST(BandwidthTimelineTest, SplitsRampSteadyAndTailAndFlagsSteps) {
+  const BandwidthTimelineSummary summary = analyze_bandwidth_timeline(
+      samples_from_rates({2, 6, 10, 10, 10, 10, 8, 8, 10, 10, 10, 10, 4}));
+
+  ASSERT_TRUE(summary.analyzed);
+  ASSERT_EQ(summary.windows.size(), 13u);
+  EXPECT_EQ(summary.windows[0].phase, BandwidthTimelinePhase::RampUp);
+  EXPECT_EQ(summary.windows[1].phase, BandwidthTimelinePhase::RampUp);
+  EXPECT_EQ(summary.windows[2].phase, BandwidthTimelinePhase::Steady);
+  EXPECT_EQ(summary.windows[12].phase, BandwidthTimelinePhase::Tail);
+  EXPECT_NEAR(summary.ramp_up_seconds, 0.002, 1e-12);
+  ASSERT_TRUE(summary.ramp_up_bandwidth_gb_s.has_value());
+  EXPECT_NEAR(*summary.ramp_up_bandwidth_gb_s, 4.0, 1e-9);
+  ASSERT_TRUE(summary.steady_state_bandwidth_gb_s.has_value());
+  EXPECT_NEAR(*summary.steady_state_bandwidth_gb_s, 9.6, 1e-9);
+
+  // Both edges of the throttled stretch are flagged, its interior is not.
+  EXPECT_EQ(summary.transition_window_count, 2u);
+  EXPECT_TRUE(summary.windows[6].frequency_transition);
+  EXPECT_FALSE(summary.windows[7].frequency_transition);
+  EXPECT_TRUE(summary.windows[8].frequency_transition);
+  EXPECT_STREQ(bandwidth_timeline_phase_to_string(summary.windows[12].phase), "tail");
+}
+
+TEST(BandwidthTimelineTest, FlatSeriesHasNoRampAndShortSeriesIsUnanalyzed) {
+  const BandwidthTimelineSummary flat =
+      analyze_bandwidth_timeline(samples_from_rates({10, 10, 10, 10, 10}));
+  ASSERT_TRUE(flat.analyzed);
+  EXPECT_EQ(flat.ramp_up_seconds, 0.0);
+  EXPECT_FALSE(flat.ramp_up_bandwidth_gb_s.has_value());
+  EXPECT_EQ(flat.transition_window_count, 0u);
+  EXPECT_NEAR(*flat.steady_state_bandwidth_gb_s, 10.0, 1e-9);
+
+  // A repeated timestamp adds no window, leaving too few to split phases.
+  std::vector<BandwidthTimelineSample> short_samples = samples_from_rates({10, 10, 10});
+  short_samples.push_back(short_samples.back());
+  const BandwidthTimelineSummary short_summary = analyze_bandwidth_timeline(short_samples);
+  EXPECT_FALSE(short_summary.analyzed);
+  EXPECT_EQ(short_summary.windows.size(), 3u);
+  EXPECT_FALSE(short_summary.steady_state_bandwidth_gb_s.has_value());
+}
+
+TEST(BandwidthTimelineTest, RecorderSumsWorkerSlotsFromZero) {
+  BandwidthTimelineRecorder recorder;
+  reset_bandwidth_timeline_recorder(recorder, 3);
+  ASSERT_EQ(recorder.samples.size(), 1u);
+  EXPECT_EQ(recorder.samples[0].completed_bytes, 0u);
+
+  recorder.slots[0].completed_bytes.store(100);
+  recorder.slots[2].completed_bytes.store(28);
+  record_bandwidth_timeline_sample(recorder, 0.5);
+  ASSERT_EQ(recorder.samples.size(), 2u);
+  EXPECT_EQ(recorder.samples[1].completed_bytes, 128u);
+  EXPECT_EQ(recorder.samples[1].elapsed_seconds, 0.5);
+
+  reset_bandwidth_timeline_recorder(recorder, 3);
+  record_bandwidth_timeline_sample(recorder, 0.1);
+  EXPECT_EQ(recorder.samples.back().completed_bytes, 0u);
+  EXPECT_EQ(alignof(BandwidthProgressSlot), Constants::BANDWIDTH_TIMELINE_SLOT_ISOLATION_BYTES);
+}
@@ -152,6 +152,25 @@ TEST(BenchmarkExecutorTest, ParallelTimingStopsBeforeWorkerTeardownIntegration)
   EXPECT_LT(measured_duration, wall_duration - 0.020);
 }
 
+TEST(BenchmarkExecutorTest, PerWorkerRunnerCallsEveryWorkerIndexOnceIntegration) {
+  auto timer_opt = HighResTimer::create();
+  ASSERT_TRUE(timer_opt.has_value());
+
+  std::array<int, 3> iterations_seen{};
+  ParallelExecutionMetadata metadata;
+  const double duration = run_parallel_test_per_worker(
+      iterations_seen.size(), 5, *timer_opt,
+      [&iterations_seen](size_t worker_index, int iterations) {
+        iterations_seen[worker_index] += iterations;
+      },
+      "per_worker_test", &metadata);
+
+  EXPECT_GT(duration, 0.0);
+  EXPECT_EQ(metadata.created_workers, 3);
+  EXPECT_EQ(iterations_seen, (std::array<int, 3>{5, 5, 5}));
+  EXPECT_EQ(run_parallel_test_per_worker(0, 5, *timer_opt, [](size_t, int) {}, "per_worker_test"), 0.0);
+}
+
 TEST(BenchmarkExecutorTest, ReadLoopChecksumFoldsUpperVectorLaneIntegration) {
   alignas(64) std::array<std::uint8_t, 32> buffer{};
   buffer[8] = 0x5A;
@@ -0,0 +1,91 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file test_buffer_residency.cpp
+ * @brief Unit tests for buffer locking, residency counts, and fault accounting
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <optional>
+#include <vector>
+
+#include "benchmark/buffer_residency.h"
+
+TEST(BufferResidencyTest, CountsResidentPagesBeforeAndAfterFirstTouch) {
+  const size_t page_size = static_cast<size_t>(getpagesize());
+  const size_t pages = 16;
+  void* mapping = mmap(nullptr, pages * page_size, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  ASSERT_NE(mapping, MAP_FAILED);
+  const std::vector<BufferRange> ranges = {{mapping, pages * page_size}};
+  EXPECT_EQ(count_buffer_pages(ranges), pages);
+  EXPECT_EQ(count_buffer_pages({{static_cast<char*>(mapping) + 1, page_size}}), 2u);
+  EXPECT_EQ(count_buffer_pages({{mapping, 0}}), 0u);
+
+  const std::optional<size_t> untouched = count_resident_pages(ranges);
+  ASSERT_TRUE(untouched.has_value());
+  EXPECT_EQ(*untouched, 0u);
+
+  const PageFaultCounts before = read_process_page_faults();
+  std::memset(mapping, 0x5a, pages * page_size);
+  const PageFaultCounts touch_faults = page_faults_between(before, read_process_page_faults());
+  EXPECT_GE(touch_faults.minor, 1u);
+  EXPECT_EQ(count_resident_pages(ranges), std::optional<size_t>(pages));
+  munmap(mapping, pages * page_size);
+}
+
+TEST(BufferResidencyTest, FoldsLockOutcomesAndFlagsFaultedRuns) {
+  BufferLockState unrequested = make_buffer_lock_state(false);
+  int value = 0;
+  lock_phase_buffer(&value, sizeof(value), unrequested);
+  EXPECT_FALSE(unrequested.requested);
+  EXPECT_FALSE(unrequested.locked);
+
+  BufferLockState requested = make_buffer_lock_state(true);
+  EXPECT_TRUE(requested.locked);
+  lock_phase_buffer(nullptr, 4096, requested);
+  EXPECT_TRUE(requested.locked);
+
+  PageFaultCounts before;
+  before.minor = 10;
+  before.major = 3;
+  PageFaultCounts after;
+  after.minor = 14;
+  after.major = 1;
+  const PageFaultCounts delta = page_faults_between(before, after);
+  EXPECT_EQ(delta.minor, 4u);
+  EXPECT_EQ(delta.major, 0u);
+
+  requested.locked = false;
+  requested.error = 1;
+  const BufferResidency residency =
+      make_buffer_residency(requested, 8, size_t{8}, size_t{7}, delta);
+  EXPECT_TRUE(residency.lock_requested);
+  EXPECT_FALSE(residency.locked);
+  EXPECT_EQ(residency.lock_error, 1);
+  EXPECT_EQ(residency.resident_pages_after, std::optional<size_t>(7));
+  EXPECT_TRUE(buffer_residency_took_faults(residency));
+  EXPECT_FALSE(buffer_residency_took_faults(
+      make_buffer_residency(requested, 8, size_t{8}, size_t{8}, PageFaultCounts{})));
+}
@@ -0,0 +1,89 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+/**
+ * @file test_cli_options.cpp
+ * @brief Unit tests for the option helpers shared by standalone mode CLIs.
+ */
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "core/config/cli_options.h"
+
+namespace {
+
+struct Argv {
+  explicit Argv(std::vector<std::string> arguments) : storage(std::move(arguments)) {
+    for (std::string& argument : storage) {
+      pointers.push_back(argument.data());
+    }
+  }
+  int argc() const { return static_cast<int>(pointers.size()); }
+  char** argv() { return pointers.data(); }
+
+  std::vector<std::string> storage;
+  std::vector<char*> pointers;
+};
+
+}  // namespace
+
+TEST(CliOptionsTest, MatchesShortAndOptionalLongSpelling) {
+  EXPECT_TRUE(is_option("-r", "-r", "--count"));
+  EXPECT_TRUE(is_option("--count", "-r", "--count"));
+  EXPECT_FALSE(is_option("--counts", "-r", "--count"));
+  EXPECT_TRUE(is_option("--workload", "--workload", nullptr));
+  EXPECT_FALSE(is_option("-w", "--workload", nullptr));
+}
+
+TEST(CliOptionsTest, BoundedIntegersRejectZeroOverflowAndMalformedTokens) {
+  testing::internal::CaptureStdout();
+  testing::internal::CaptureStderr();
+  int value = 7;
+  EXPECT_TRUE(parse_bounded_int_option("--sample-ms", "250", 1000, value, "prog"));
+  EXPECT_EQ(value, 250);
+  EXPECT_FALSE(parse_bounded_int_option("--sample-ms", "1001", 1000, value, "prog"));
+  EXPECT_FALSE(parse_positive_int_option("--count", "0", value, "prog"));
+  EXPECT_FALSE(parse_positive_int_option("--count", "+3", value, "prog"));
+  EXPECT_FALSE(parse_positive_int_option(
+      "--count", std::to_string(static_cast<long long>(std::numeric_limits<int>::max()) + 1),
+      value, "prog"));
+  EXPECT_EQ(value, 250);
+  testing::internal::GetCapturedStdout();
+  const std::string errors = testing::internal::GetCapturedStderr();
+  EXPECT_NE(errors.find("--sample-ms"), std::string::npos);
+  EXPECT_NE(errors.find("must be between 1 and 1000"), std::string::npos);
+}
+
+TEST(CliOptionsTest, TakeOptionValueRejectsDuplicateAndMissingValues) {
+  testing::internal::CaptureStdout();
+  testing::internal::CaptureStderr();
+  Argv args({"prog", "--count", "3", "--count"});
+  int i = 1;
+  bool seen = false;
+  ASSERT_TRUE(take_option_value(args.argc(), args.argv(), i, seen, "--count"));
+  EXPECT_EQ(i, 2);
+  EXPECT_TRUE(seen);
+  i = 3;
+  EXPECT_FALSE(take_option_value(args.argc(), args.argv(), i, seen, "--count"));
+  seen = false;
+  EXPECT_FALSE(take_option_value(args.argc(), args.argv(), i, seen, "--count"));
+  EXPECT_FALSE(seen);
+  testing::internal::GetCapturedStdout();
+  testing::internal::GetCapturedStderr();
+}
@@ -14,11 +14,13 @@
 // along with this program. If not, see <https://www.gnu.org/licenses/>.
 //
 #include <gtest/gtest.h>
+#include "benchmark/kernel_autotune.h"
 #include "core/config/config.h"
 #include "core/config/constants.h"
 #include "output/console/messages/messages_api.h"
 #include <cstdlib>
 #include <cstdint>
+#include <fstream>
 #include <limits>
 #include <string>
 #include <vector>
@@ -99,6 +101,7 @@ TEST(ConfigTest, DefaultValues) {
   EXPECT_FALSE(config.user_specified_benchmark_seed);
   EXPECT_EQ(config.custom_cache_size_kb_ll, -1);
   EXPECT_FALSE(config.use_custom_cache_size);
+  EXPECT_EQ(config.memory_kernel_variant, MemoryKernelVariant::Neon);
 }
 
 // Test parsing valid arguments
@@ -114,6 +117,195 @@ TEST(ConfigTest, ParseValidArguments) {
   EXPECT_EQ(config.loop_count, 3);
 }
 
+TEST(ConfigTest, ParsesExplicitKernelName) {
+  BenchmarkConfig config;
+  const char* argv[] = {"program", "--benchmark", "--kernel", "generated-u4-w32-nt-pf512"};
+  EXPECT_EQ(parse_arguments(4, const_cast<char**>(argv), config), EXIT_SUCCESS);
+  EXPECT_EQ(config.memory_kernel_name, "generated-u4-w32-nt-pf512");
+  EXPECT_EQ(config.memory_kernel_variant, MemoryKernelVariant::Generated);
+}
+
+TEST(ConfigTest, RejectsUnknownAndDuplicateKernelNames) {
+  BenchmarkConfig unknown_config;
+  const char* unknown_argv[] = {"program", "--benchmark", "--kernel", "generated-u3-w32-t-pf0"};
+  EXPECT_EQ(parse_arguments(4, const_cast<char**>(unknown_argv), unknown_config), EXIT_FAILURE);
+
+  BenchmarkConfig duplicate_config;
+  const char* duplicate_argv[] = {"program", "--kernel", "neon", "--kernel", "neon"};
+  EXPECT_EQ(parse_arguments(5, const_cast<char**>(duplicate_argv), duplicate_config),
+            EXIT_FAILURE);
+
+  BenchmarkConfig sve_config;
+  const char* sve_argv[] = {"program", "--benchmark", "--kernel", "sve"};
+  EXPECT_EQ(parse_arguments(4, const_cast<char**>(sve_argv), sve_config), EXIT_FAILURE);
+}
+
+TEST(ConfigTest, ResolvesTunedKernelsFromAutotuneCacheForThisCpu) {
+  KernelAutotuneChoice read_choice;
+  read_choice.operation = BenchmarkOperation::Read;
+  read_choice.best_kernel = "generated-u8-w32-t-pf512";
+  read_choice.measured = true;
+  KernelAutotuneChoice write_choice = read_choice;
+  write_choice.operation = BenchmarkOperation::Write;
+  write_choice.best_kernel = "generated-u4-w32-nt-pf0";
+  KernelAutotuneChoice copy_choice = read_choice;
+  copy_choice.operation = BenchmarkOperation::Copy;
+  copy_choice.best_kernel = "neon";
+  nlohmann::json cache;
+  merge_kernel_autotune_cache(cache,
+                              build_kernel_autotune_cpu_identity("Injected Apple CPU", 6, 4),
+                              {read_choice, write_choice, copy_choice}, "2026-01-01T00:00:00Z");
+  const std::string cache_path = testing::TempDir() + "config_kernel_autotune_cache.json";
+  std::ofstream(cache_path) << cache.dump();
+
+  const ConfigTestHooks original_hooks = *get_config_test_hooks();
+  ConfigTestHooks hooks = original_hooks;
+  hooks.kernel_autotune_cache_path = cache_path;
+  set_config_test_hooks(&hooks);
+  BenchmarkConfig config;
+  const char* argv[] = {"program", "--benchmark", "--kernel", "tuned"};
+  EXPECT_EQ(parse_arguments(4, const_cast<char**>(argv), config), EXIT_SUCCESS);
+  EXPECT_EQ(config.memory_kernel_variant, MemoryKernelVariant::Tuned);
+  EXPECT_EQ(config.tuned_read_kernel, "generated-u8-w32-t-pf512");
+  EXPECT_EQ(config.tuned_write_kernel, "generated-u4-w32-nt-pf0");
+  EXPECT_EQ(config.tuned_copy_kernel, "neon");
+
+  // Winners recorded for another machine configuration are not reused.
+  hooks.performance_cores = 8;
+  set_config_test_hooks(&hooks);
+  BenchmarkConfig other_cpu_config;
+  testing::internal::CaptureStderr();
+  EXPECT_EQ(parse_arguments(4, const_cast<char**>(argv), other_cpu_config), EXIT_FAILURE);
+  EXPECT_NE(testing::internal::GetCapturedStderr().find("--autotune-kernels"), std::string::npos);
+  set_config_test_hooks(&original_hooks);
+}
+
+TEST(ConfigTest, ValidateKernelRequiresBandwidthMode) {
+  BenchmarkConfig config;
+  config.memory_kernel_name = "neon";
+  EXPECT_EQ(validate_config(config), EXIT_FAILURE);
+
+  config.run_benchmark = true;
+  config.only_latency = true;
+  EXPECT_EQ(validate_config(config), EXIT_FAILURE);
+}
+
+TEST(ConfigTest, BandwidthTimelineRequiresBenchmarkBandwidth) {
+  BenchmarkConfig parsed;
+  const char* argv[] = {"program", "--benchmark", "--bandwidth-timeline"};
+  EXPECT_EQ(parse_arguments(3, const_cast<char**>(argv), parsed), EXIT_SUCCESS);
+  EXPECT_TRUE(parsed.bandwidth_timeline);
+
+  BenchmarkConfig config;
+  config.bandwidth_timeline = true;
+  EXPECT_EQ(validate_config(config), EXIT_FAILURE);
+
+  config.run_patterns = true;
+  EXPECT_EQ(validate_config(config), EXIT_FAILURE);
+
+  config.run_patterns = false;
+  config.run_benchmark = true;
+  config.only_latency = true;
+  EXPECT_EQ(validate_config(config), EXIT_FAILURE);
+}
+
+TEST(ConfigTest, LockBuffersRequiresBenchmark) {
+  BenchmarkConfig parsed;
+  const char* argv[] = {"program", "--benchmark", "--lock-buffers"};
+  EXPECT_EQ(parse_arguments(3, const_cast<char**>(argv), parsed), EXIT_SUCCESS);
+  EXPECT_TRUE(parsed.lock_buffers);
+
+  BenchmarkConfig config;
+  config.lock_buffers = true;
+  EXPECT_EQ(validate_config(config), EXIT_FAILURE);
+
+  config.run_patterns = true;
+  EXPECT_EQ(validate_config(config), EXIT_FAILURE);
+}
+
+TEST(ConfigTest, PatternSkewOptionsParseAndRequirePatterns) {
+  BenchmarkConfig parsed;
+  const char* argv[] = {"program", "--patterns", "--zipf-theta", "1.2",
+                        "--hot-fraction", "0.05", "--hot-probability", "1"};
+  EXPECT_EQ(parse_arguments(8, const_cast<char**>(argv), parsed), EXIT_SUCCESS);
+  EXPECT_DOUBLE_EQ(parsed.pattern_zipf_theta, 1.2);
+  EXPECT_DOUBLE_EQ(parsed.pattern_hot_fraction, 0.05);
+  EXPECT_DOUBLE_EQ(parsed.pattern_hot_probability, 1.0);
+  EXPECT_TRUE(parsed.user_specified_pattern_skew);
+
+  for (const std::string invalid : {"0", "-1", "4.5", "nan", "inf", "0.5x", " 1", ""}) {
+    BenchmarkConfig rejected;
+    EXPECT_EQ(parse_capturing_stderr({"program", "--patterns", "--zipf-theta", invalid},
+                                     rejected)
+                  .result,
+              EXIT_FAILURE)
+        << invalid;
+  }
+  for (const std::string invalid : {"0", "1", "1.5"}) {
+    BenchmarkConfig rejected;
+    const CapturedParseResult parsed_invalid = parse_capturing_stderr(
+        {"program", "--patterns", "--hot-fraction", invalid}, rejected);
+    EXPECT_EQ(parsed_invalid.result, EXIT_FAILURE) << invalid;
+    EXPECT_NE(parsed_invalid.stderr_output.find(Messages::error_hot_fraction_invalid()),
+              std::string::npos);
+  }
+
+  BenchmarkConfig config;
+  config.user_specified_pattern_skew = true;
+  config.run_benchmark = true;
+  testing::internal::CaptureStderr();
+  EXPECT_EQ(validate_config(config), EXIT_FAILURE);
+  EXPECT_NE(testing::internal::GetCapturedStderr().find("require --patterns"),
+            std::string::npos);
+}
+
+TEST(ConfigTest, PatternMatrixOptionsParseAndValidateShape) {
+  BenchmarkConfig parsed;
+  const char* argv[] = {"program", "--patterns", "--matrix-row-bytes", "4096",
+                        "--matrix-pitch", "4160", "--matrix-tile", "16"};
+  EXPECT_EQ(parse_arguments(8, const_cast<char**>(argv), parsed), EXIT_SUCCESS);
+  EXPECT_EQ(parsed.pattern_matrix_row_bytes, 4096u);
+  EXPECT_EQ(parsed.pattern_matrix_pitch_bytes, 4160u);
+  EXPECT_EQ(parsed.pattern_matrix_tile_elements, 16u);
+  EXPECT_TRUE(parsed.user_specified_pattern_matrix);
+
+  for (const std::string invalid : {"0", "6", "2048", "-4", "x"}) {
+    BenchmarkConfig rejected;
+    EXPECT_EQ(parse_capturing_stderr({"program", "--patterns", "--matrix-tile", invalid},
+                                     rejected)
+                  .result,
+              EXIT_FAILURE)
+        << invalid;
+  }
+
+  BenchmarkConfig unaligned_row;
+  unaligned_row.run_patterns = true;
+  unaligned_row.pattern_matrix_row_bytes = 4000;
+  testing::internal::CaptureStderr();
+  EXPECT_EQ(validate_config(unaligned_row), EXIT_FAILURE);
+  EXPECT_NE(testing::internal::GetCapturedStderr().find(
+                Messages::error_matrix_row_bytes_invalid()),
+            std::string::npos);
+
+  BenchmarkConfig narrow_pitch;
+  narrow_pitch.run_patterns = true;
+  narrow_pitch.pattern_matrix_pitch_bytes = 4096;
+  testing::internal::CaptureStderr();
+  EXPECT_EQ(validate_config(narrow_pitch), EXIT_FAILURE);
+  EXPECT_NE(testing::internal::GetCapturedStderr().find(
+                Messages::error_matrix_pitch_invalid()),
+            std::string::npos);
+
+  BenchmarkConfig config;
+  config.user_specified_pattern_matrix = true;
+  config.run_benchmark = true;
+  testing::internal::CaptureStderr();
+  EXPECT_EQ(validate_config(config), EXIT_FAILURE);
+  EXPECT_NE(testing::internal::GetCapturedStderr().find(
+                Messages::error_pattern_matrix_requires_patterns()),
+            std::string::npos);
+}
+
 TEST(ConfigTest, ParseShortOptions) {
   BenchmarkConfig config;
   const char* argv[] = {
@@ -647,6 +839,48 @@ TEST(ConfigTest, ParseAnalyzeTlbRejectsDuplicateSeed) {
   EXPECT_EQ(parse_arguments(6, const_cast<char**>(argv), config), EXIT_FAILURE);
 }
 
+TEST(ConfigTest, ParseAnalyzeTlbWithChainLayoutsSucceeds) {
+  BenchmarkConfig config;
+  const char* argv[] = {"program", "--analyze-tlb", "--tlb-chain-layouts", "4"};
+
+  EXPECT_EQ(parse_arguments(4, const_cast<char**>(argv), config), EXIT_SUCCESS);
+  EXPECT_EQ(config.tlb_chain_layouts, 4u);
+}
+
+TEST(ConfigTest, ParseAnalyzeTlbDefaultsToFreshChainLayouts) {
+  BenchmarkConfig config;
+  const char* argv[] = {"program", "--analyze-tlb"};
+
+  EXPECT_EQ(parse_arguments(2, const_cast<char**>(argv), config), EXIT_SUCCESS);
+  EXPECT_EQ(config.tlb_chain_layouts, Constants::DEFAULT_TLB_CHAIN_LAYOUTS);
+}
+
+TEST(ConfigTest, ParseAnalyzeTlbRejectsInvalidChainLayouts) {
+  const std::string above_maximum =
+      std::to_string(Constants::MAX_TLB_CHAIN_LAYOUTS + 1);
+  for (const char* value : {"-1", "4x", above_maximum.c_str()}) {
+    BenchmarkConfig config;
+    const char* argv[] = {"program", "--analyze-tlb", "--tlb-chain-layouts", value};
+    EXPECT_EQ(parse_arguments(4, const_cast<char**>(argv), config), EXIT_FAILURE)
+        << value;
+  }
+}
+
+TEST(ConfigTest, ParseAnalyzeTlbRejectsDuplicateChainLayouts) {
+  BenchmarkConfig config;
+  const char* argv[] = {"program", "--analyze-tlb", "--tlb-chain-layouts", "2",
+                        "--tlb-chain-layouts", "3"};
+
+  EXPECT_EQ(parse_arguments(6, const_cast<char**>(argv), config), EXIT_FAILURE);
+}
+
+TEST(ConfigTest, ParseChainLayoutsWithoutAnalyzeTlbFails) {
+  BenchmarkConfig config;
+  const char* argv[] = {"program", "--tlb-chain-layouts", "2"};
+
+  EXPECT_EQ(parse_arguments(3, const_cast<char**>(argv), config), EXIT_FAILURE);
+}
+
 TEST(ConfigTest, ParsePatternsWithExplicitSeedSucceeds) {
   BenchmarkConfig config;
   const char* argv[] = {"program", "--patterns", "--seed", "18446744073709551615"};
@@ -0,0 +1,104 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file test_core_frequency_probe.cpp
+ * @brief Unit tests for core frequency probe summaries and drift detection
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "benchmark/benchmark_runner.h"
+#include "benchmark/benchmark_statistics_collector.h"
+#include "benchmark/core_frequency_probe.h"
+
+namespace {
+
+BenchmarkMeasurement probed_measurement(double value, double effective_ghz) {
+  BenchmarkMeasurement measurement;
+  measurement.status = BenchmarkMeasurementStatus::Measured;
+  measurement.value = value;
+  CoreFrequencySummary frequency;
+  frequency.before_ghz = effective_ghz;
+  frequency.after_ghz = effective_ghz;
+  frequency.effective_ghz = effective_ghz;
+  measurement.core_frequency = frequency;
+  return measurement;
+}
+
+}  // namespace
+
+TEST(CoreFrequencyProbeTest, EstimatesGigahertzFromDependentAdds) {
+  EXPECT_DOUBLE_EQ(estimate_core_frequency_ghz(3'000'000, 0.001), 3.0);
+  EXPECT_EQ(estimate_core_frequency_ghz(1000, 0.0), 0.0);
+  EXPECT_EQ(estimate_core_frequency_ghz(1000, -1.0), 0.0);
+  EXPECT_EQ(estimate_core_frequency_ghz(
+                1000, std::numeric_limits<double>::infinity()),
+            0.0);
+}
+
+TEST(CoreFrequencyProbeTest, SummarizesWorkerMediansAndRejectsMissingProbes) {
+  CoreFrequencyProbeRecord record;
+  reset_core_frequency_probe_record(record, 3);
+  EXPECT_FALSE(summarize_core_frequency_probes(record).has_value());
+
+  record.before_ghz = {3.0, 3.2, 3.1};
+  record.after_ghz = {2.9, 3.0, 2.8};
+  const std::optional<CoreFrequencySummary> summary =
+      summarize_core_frequency_probes(record);
+  ASSERT_TRUE(summary.has_value());
+  EXPECT_DOUBLE_EQ(summary->before_ghz, 3.1);
+  EXPECT_DOUBLE_EQ(summary->after_ghz, 2.9);
+  EXPECT_DOUBLE_EQ(summary->min_ghz, 2.8);
+  EXPECT_DOUBLE_EQ(summary->max_ghz, 3.2);
+  EXPECT_NEAR(summary->effective_ghz, 3.0, 1e-12);
+  EXPECT_NEAR(summary->within_measurement_drift_pct, (2.9 - 3.1) / 3.1 * 100.0,
+              1e-9);
+
+  record.after_ghz[1] = 0.0;
+  EXPECT_FALSE(summarize_core_frequency_probes(record).has_value());
+}
+
+TEST(CoreFrequencyProbeTest, FindsLargestCrossLoopDrift) {
+  EXPECT_EQ(core_frequency_drift_pct({3.0}), 0.0);
+  EXPECT_NEAR(core_frequency_drift_pct({3.0, 3.3, 3.15}), 10.0, 1e-9);
+
+  BenchmarkStatistics stats;
+  EXPECT_FALSE(find_largest_core_frequency_drift(stats).has_value());
+
+  BenchmarkResults first;
+  first.main_read_bandwidth = probed_measurement(100.0, 3.0);
+  first.main_latency = probed_measurement(90.0, 3.0);
+  BenchmarkResults second;
+  second.main_read_bandwidth = probed_measurement(95.0, 3.06);
+  second.main_latency = probed_measurement(95.0, 2.4);
+  stats.loop_results = {first, second};
+
+  const std::optional<CoreFrequencyLoopDrift> drift =
+      find_largest_core_frequency_drift(stats);
+  ASSERT_TRUE(drift.has_value());
+  EXPECT_EQ(drift->measurement_name, "main_latency");
+  EXPECT_DOUBLE_EQ(drift->min_ghz, 2.4);
+  EXPECT_DOUBLE_EQ(drift->max_ghz, 3.0);
+  EXPECT_NEAR(drift->drift_pct, 25.0, 1e-9);
+}
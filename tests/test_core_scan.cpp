@@ -0,0 +1,136 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file test_core_scan.cpp
+ * @brief Unit tests for core-scan CLI parsing, slot planning, and outliers
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "benchmark/core_scan.h"
+#include "core/config/constants.h"
+
+namespace {
+
+int parse_with_args(const std::vector<std::string>& args, CoreScanConfig& config) {
+  std::vector<std::string> mutable_args = args;
+  std::vector<char*> argv;
+  argv.reserve(mutable_args.size());
+  for (std::string& arg : mutable_args) {
+    argv.push_back(arg.data());
+  }
+  testing::internal::CaptureStderr();
+  const int result =
+      parse_core_scan_mode_arguments(static_cast<int>(argv.size()), argv.data(), config);
+  testing::internal::GetCapturedStderr();
+  return result;
+}
+
+// Latency values first, then bandwidth values, in CoreScanMetric order.
+void add_slot(CoreScanResult& result, CoreScanClass core_class, double l1_latency_ns,
+              double l2_read_gb_s) {
+  CoreScanSlotResult slot;
+  slot.slot.index = static_cast<int>(result.slots.size());
+  slot.slot.core_class = core_class;
+  const double values[CORE_SCAN_METRIC_COUNT] = {l1_latency_ns, 5.0, 120.0, 60.0, l2_read_gb_s, 40.0};
+  for (size_t metric = 0; metric < CORE_SCAN_METRIC_COUNT; ++metric) {
+    slot.samples[metric] = {values[metric]};
+  }
+  result.slots.push_back(slot);
+}
+
+}  // namespace
+
+TEST(CoreScanCliTest, ParsesDefaultsAndModeOptions) {
+  CoreScanConfig defaults;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "--core-scan"}, defaults), EXIT_SUCCESS);
+  EXPECT_EQ(defaults.rounds, Constants::CORE_SCAN_DEFAULT_ROUNDS);
+  EXPECT_EQ(defaults.concurrency, Constants::CORE_SCAN_DEFAULT_CONCURRENCY);
+
+  CoreScanConfig config;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-U", "--scan-concurrency", "8", "-r", "5", "-o",
+                             "scan.json"},
+                            config),
+            EXIT_SUCCESS);
+  EXPECT_EQ(config.concurrency, 8);
+  EXPECT_EQ(config.rounds, 5);
+  EXPECT_EQ(config.output_file, "scan.json");
+
+  CoreScanConfig foreign;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-U", "--threads", "4"}, foreign), EXIT_FAILURE);
+  CoreScanConfig zero;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-U", "--scan-concurrency", "0"}, zero),
+            EXIT_FAILURE);
+}
+
+TEST(CoreScanPlanTest, SlotsFollowCoreClassesAndBatchesNeverMixClasses) {
+  const std::vector<CoreScanSlot> slots =
+      build_core_scan_slots(4, 2, 6, 128 * 1024, 16 << 20, 64 * 1024, 4 << 20);
+  ASSERT_EQ(slots.size(), 6u);
+  EXPECT_EQ(slots[0].core_class, CoreScanClass::Performance);
+  EXPECT_EQ(slots[0].affinity_tag, 1);
+  EXPECT_EQ(slots[0].l2_bytes, static_cast<size_t>(16 << 20));
+  EXPECT_EQ(slots[5].core_class, CoreScanClass::Efficiency);
+  EXPECT_EQ(slots[5].l1_bytes, static_cast<size_t>(64 * 1024));
+
+  const std::vector<std::vector<size_t>> batches = build_core_scan_batches(slots, 3);
+  ASSERT_EQ(batches.size(), 3u);
+  EXPECT_EQ(batches[0], (std::vector<size_t>{0, 1, 2}));
+  EXPECT_EQ(batches[1], (std::vector<size_t>{3}));
+  EXPECT_EQ(batches[2], (std::vector<size_t>{4, 5}));
+
+  const std::vector<CoreScanSlot> uniform = build_core_scan_slots(0, 0, 3, 1, 2, 0, 0);
+  ASSERT_EQ(uniform.size(), 3u);
+  EXPECT_EQ(uniform[2].core_class, CoreScanClass::Performance);
+  EXPECT_EQ(build_core_scan_batches(uniform, 1).size(), 3u);
+}
+
+TEST(CoreScanResultTest, FlagsSlotsWorseThanTheirClassMedian) {
+  CoreScanResult result;
+  add_slot(result, CoreScanClass::Performance, 1.0, 100.0);
+  add_slot(result, CoreScanClass::Performance, 1.0, 100.0);
+  add_slot(result, CoreScanClass::Performance, 1.2, 100.0);  // Slow L1 latency
+  add_slot(result, CoreScanClass::Performance, 1.0, 85.0);   // Slow L2 read
+  add_slot(result, CoreScanClass::Efficiency, 2.0, 20.0);
+  add_slot(result, CoreScanClass::Efficiency, 3.0, 10.0);  // Too few slots to compare
+  finalize_core_scan_result(result);
+
+  ASSERT_EQ(result.classes.size(), 2u);
+  EXPECT_TRUE(result.classes[0].comparable);
+  EXPECT_FALSE(result.classes[1].comparable);
+  EXPECT_DOUBLE_EQ(result.classes[0].median[0], 1.0);
+
+  const size_t l1_latency = static_cast<size_t>(CoreScanMetric::L1Latency);
+  const size_t l2_read = static_cast<size_t>(CoreScanMetric::L2Read);
+  EXPECT_FALSE(result.slots[0].any_outlier);
+  EXPECT_TRUE(result.slots[2].outlier[l1_latency]);
+  EXPECT_NEAR(result.slots[2].deviation_pct[l1_latency], 20.0, 1e-9);
+  EXPECT_TRUE(result.slots[3].outlier[l2_read]);
+  EXPECT_NEAR(result.slots[3].deviation_pct[l2_read], 15.0, 1e-9);
+  EXPECT_FALSE(result.slots[5].any_outlier);
+
+  const nlohmann::ordered_json json = build_core_scan_json(CoreScanConfig{}, result, "Test CPU", 1.0);
+  EXPECT_EQ(json["mode"], Constants::CORE_SCAN_JSON_MODE_NAME);
+  EXPECT_EQ(json["outlier_slots"], (std::vector<int>{2, 3}));
+  EXPECT_TRUE(json["slots"][3]["metrics"]["l2_read_gb_s"]["outlier"].get<bool>());
+  EXPECT_FALSE(json["classes"][1]["comparable"].get<bool>());
+}
@@ -0,0 +1,141 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file test_file_io.cpp
+ * @brief Unit tests for file I/O CLI parsing, block order, and results
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "benchmark/file_io.h"
+#include "core/config/constants.h"
+
+namespace {
+
+int parse_with_args(const std::vector<std::string>& args, FileIoConfig& config) {
+  std::vector<std::string> mutable_args = args;
+  std::vector<char*> argv;
+  argv.reserve(mutable_args.size());
+  for (std::string& arg : mutable_args) {
+    argv.push_back(arg.data());
+  }
+  testing::internal::CaptureStderr();
+  const int result =
+      parse_file_io_mode_arguments(static_cast<int>(argv.size()), argv.data(), config);
+  testing::internal::GetCapturedStderr();
+  return result;
+}
+
+}  // namespace
+
+TEST(FileIoCliTest, ParsesDefaultsBlockSizeAndRejectsForeignOptions) {
+  FileIoConfig defaults;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "--file-io"}, defaults), EXIT_SUCCESS);
+  EXPECT_TRUE(defaults.directory.empty());
+  EXPECT_EQ(defaults.file_size_mb, Constants::FILE_IO_DEFAULT_FILE_SIZE_MB);
+  EXPECT_EQ(defaults.block_kb, Constants::FILE_IO_DEFAULT_BLOCK_KB);
+  EXPECT_EQ(defaults.rounds, Constants::FILE_IO_DEFAULT_ROUNDS);
+
+  FileIoConfig config;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-R", "--file-dir", "/Volumes/Scratch", "-b",
+                             "32", "--io-block", "1024", "-r", "2", "-o", "file.json"},
+                            config),
+            EXIT_SUCCESS);
+  EXPECT_EQ(config.directory, "/Volumes/Scratch");
+  EXPECT_EQ(config.file_size_mb, 32u);
+  EXPECT_EQ(config.block_kb, 1024u);
+  EXPECT_EQ(config.rounds, 2);
+  EXPECT_EQ(config.output_file, "file.json");
+
+  for (const char* block : {"3", "6", "32768", "0"}) {
+    FileIoConfig invalid;
+    EXPECT_EQ(parse_with_args({"memory_benchmark", "-R", "--io-block", block}, invalid),
+              EXIT_FAILURE)
+        << block;
+  }
+  FileIoConfig too_large;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-R", "-b", "4", "--io-block", "8192"},
+                            too_large),
+            EXIT_FAILURE);
+  FileIoConfig empty_directory;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-R", "--file-dir", ""}, empty_directory),
+            EXIT_FAILURE);
+  FileIoConfig foreign;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-R", "--threads", "2"}, foreign),
+            EXIT_FAILURE);
+}
+
+TEST(FileIoPlanTest, BuildsDeterministicBlockPermutationAndOverhead) {
+  const std::vector<size_t> order = build_file_io_block_order(1024, 7);
+  EXPECT_EQ(order, build_file_io_block_order(1024, 7));
+  std::vector<size_t> sorted = order;
+  std::sort(sorted.begin(), sorted.end());
+  std::vector<size_t> identity(1024);
+  std::iota(identity.begin(), identity.end(), size_t{0});
+  EXPECT_EQ(sorted, identity);
+  EXPECT_NE(order, identity);
+
+  EXPECT_DOUBLE_EQ(calculate_file_io_overhead_ns_per_byte(4.0, 8.0), 0.125);
+  EXPECT_DOUBLE_EQ(calculate_file_io_overhead_ns_per_byte(0.0, 8.0), 0.0);
+  EXPECT_TRUE(file_io_block_is_valid(64, 1));
+  EXPECT_FALSE(file_io_block_is_valid(2048, 1));
+}
+
+TEST(FileIoResultTest, ComparesEachAccessOrderWithItsMemoryRow) {
+  FileIoConfig config;
+  config.file_size_mb = 8;
+  config.block_kb = 64;
+  FileIoResult result = make_file_io_result(config);
+  ASSERT_EQ(result.rows.size(), FILE_IO_METHOD_COUNT * FILE_IO_ACCESS_COUNT);
+  EXPECT_EQ(result.file_bytes, 8u * 1024u * 1024u);
+  EXPECT_EQ(result.block_bytes, 64u * 1024u);
+  EXPECT_EQ(result.rows[0].method, FileIoMethod::Memory);
+  EXPECT_EQ(result.rows[0].access, FileIoAccess::Sequential);
+
+  for (FileIoRow& row : result.rows) {
+    const bool sequential = row.access == FileIoAccess::Sequential;
+    if (row.method == FileIoMethod::Memory) {
+      row.samples_gb_s = sequential ? std::vector<double>{8.0, 10.0, 9.0}
+                                    : std::vector<double>{4.0};
+    } else if (row.method == FileIoMethod::Pread) {
+      row.samples_gb_s = {sequential ? 4.5 : 2.0};
+    }
+  }
+  finalize_file_io_result(result);
+  for (const FileIoRow& row : result.rows) {
+    if (row.method != FileIoMethod::Pread) {
+      continue;
+    }
+    EXPECT_DOUBLE_EQ(row.vs_memory_pct, -50.0);
+    EXPECT_DOUBLE_EQ(row.overhead_ns_per_byte,
+                     row.access == FileIoAccess::Sequential ? 1.0 / 4.5 - 1.0 / 9.0 : 0.25);
+  }
+
+  const nlohmann::ordered_json json = build_file_io_json(config, result, "/tmp", "cpu", 1.0);
+  EXPECT_EQ(json["mode"], Constants::FILE_IO_JSON_MODE_NAME);
+  EXPECT_EQ(json["configuration"]["unavailable_methods"][0]["method"], "io_uring");
+  EXPECT_EQ(json["results"][0]["method"], "memory");
+  EXPECT_TRUE(json["results"][0]["overhead_ns_per_byte"].is_null());
+  EXPECT_DOUBLE_EQ(json["results"][0]["median_gb_s"].get<double>(), 9.0);
+}
@@ -0,0 +1,132 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file test_ipc_bandwidth.cpp
+ * @brief Unit tests for IPC bandwidth CLI parsing, metrics, and results
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "benchmark/ipc_bandwidth.h"
+#include "core/config/constants.h"
+
+namespace {
+
+int parse_with_args(const std::vector<std::string>& args, IpcBandwidthConfig& config) {
+  std::vector<std::string> mutable_args = args;
+  std::vector<char*> argv;
+  argv.reserve(mutable_args.size());
+  for (std::string& arg : mutable_args) {
+    argv.push_back(arg.data());
+  }
+  testing::internal::CaptureStderr();
+  const int result =
+      parse_ipc_bandwidth_mode_arguments(static_cast<int>(argv.size()), argv.data(), config);
+  testing::internal::GetCapturedStderr();
+  return result;
+}
+
+}  // namespace
+
+TEST(IpcBandwidthCliTest, ParsesDefaultsMethodsSizesAndRejectsForeignOptions) {
+  IpcBandwidthConfig defaults;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "--ipc-bandwidth"}, defaults), EXIT_SUCCESS);
+  EXPECT_TRUE(defaults.methods.empty());
+  EXPECT_EQ(defaults.message_sizes_kb, (std::vector<size_t>{4, 64, 1024, 16384}));
+  EXPECT_EQ(defaults.rounds, Constants::IPC_BANDWIDTH_DEFAULT_ROUNDS);
+
+  IpcBandwidthConfig config;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-E", "--ipc-methods", "pipe,mmap-handoff",
+                             "--message-size", "1,256", "-r", "2", "-o", "ipc.json"},
+                            config),
+            EXIT_SUCCESS);
+  EXPECT_EQ(config.methods, (std::vector<IpcMethod>{IpcMethod::Pipe, IpcMethod::MmapHandoff}));
+  EXPECT_EQ(config.message_sizes_kb, (std::vector<size_t>{1, 256}));
+  EXPECT_EQ(config.rounds, 2);
+  EXPECT_EQ(config.output_file, "ipc.json");
+
+  for (const char* methods : {"splice", "pipe,pipe", "pipe,", ""}) {
+    IpcBandwidthConfig invalid;
+    EXPECT_EQ(parse_with_args({"memory_benchmark", "-E", "--ipc-methods", methods}, invalid),
+              EXIT_FAILURE)
+        << methods;
+  }
+  for (const char* sizes : {"0", "262145", "4,4", "4,", "-1"}) {
+    IpcBandwidthConfig invalid;
+    EXPECT_EQ(parse_with_args({"memory_benchmark", "-E", "--message-size", sizes}, invalid),
+              EXIT_FAILURE)
+        << sizes;
+  }
+  IpcBandwidthConfig foreign;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-E", "--buffer-size", "64"}, foreign),
+            EXIT_FAILURE);
+}
+
+TEST(IpcBandwidthMetricsTest, ConvertsStreamTimingAndClampsLatencyMessages) {
+  const auto values = calculate_ipc_metrics(2000000000, 0.5, 0.4, 0.6, 0.002, 100);
+  EXPECT_DOUBLE_EQ(values[static_cast<size_t>(IpcMetric::Bandwidth)], 4.0);
+  EXPECT_DOUBLE_EQ(values[static_cast<size_t>(IpcMetric::Latency)], 20.0);
+  EXPECT_DOUBLE_EQ(values[static_cast<size_t>(IpcMetric::SenderCpuPerByte)], 0.2);
+  EXPECT_DOUBLE_EQ(values[static_cast<size_t>(IpcMetric::ReceiverCpuPerByte)], 0.3);
+  EXPECT_DOUBLE_EQ(values[static_cast<size_t>(IpcMetric::CpuPerByte)], 0.5);
+
+  const auto empty = calculate_ipc_metrics(0, 0.5, 0.4, 0.6, 0.002, 100);
+  EXPECT_DOUBLE_EQ(empty[static_cast<size_t>(IpcMetric::Bandwidth)], 0.0);
+
+  EXPECT_EQ(calculate_ipc_latency_messages(1), Constants::IPC_BANDWIDTH_MIN_LATENCY_MESSAGES);
+  EXPECT_EQ(calculate_ipc_latency_messages(500), 500u);
+  EXPECT_EQ(calculate_ipc_latency_messages(Constants::IPC_BANDWIDTH_MAX_MESSAGES),
+            Constants::IPC_BANDWIDTH_MAX_LATENCY_MESSAGES);
+}
+
+TEST(IpcBandwidthResultTest, OrdersRowsReducesMediansAndSerializes) {
+  IpcBandwidthConfig config;
+  config.methods = {IpcMethod::UnixSocket, IpcMethod::ShmRing};
+  config.message_sizes_kb = {1024, 4};
+  IpcBandwidthResult result = make_ipc_bandwidth_result(config);
+  ASSERT_EQ(result.rows.size(), 4u);
+  EXPECT_EQ(result.rows[0].method, IpcMethod::UnixSocket);
+  EXPECT_EQ(result.rows[0].message_bytes, 4096u);
+  EXPECT_EQ(result.rows[1].message_bytes, 1024u * 1024u);
+  EXPECT_EQ(result.rows[2].method, IpcMethod::ShmRing);
+
+  IpcBandwidthRow& row = result.rows[0];
+  row.messages = 1000;
+  row.latency_messages = 100;
+  row.samples[static_cast<size_t>(IpcMetric::Bandwidth)] = {3.0, 5.0, 4.0};
+  row.samples[static_cast<size_t>(IpcMetric::Latency)] = {12.0, 10.0, 11.0};
+  finalize_ipc_bandwidth_result(result);
+  EXPECT_DOUBLE_EQ(row.median[static_cast<size_t>(IpcMetric::Bandwidth)], 4.0);
+  EXPECT_DOUBLE_EQ(row.median[static_cast<size_t>(IpcMetric::Latency)], 11.0);
+  EXPECT_DOUBLE_EQ(result.rows[3].median[static_cast<size_t>(IpcMetric::Bandwidth)], 0.0);
+
+  const nlohmann::ordered_json json = build_ipc_bandwidth_json(config, result, "cpu", 1.0);
+  EXPECT_EQ(json["mode"], Constants::IPC_BANDWIDTH_JSON_MODE_NAME);
+  EXPECT_EQ(json["configuration"]["methods"],
+            nlohmann::ordered_json::array({"unix-socket", "shm-ring"}));
+  ASSERT_EQ(json["results"].size(), 4u);
+  EXPECT_EQ(json["results"][0]["method"], "unix-socket");
+  EXPECT_EQ(json["results"][0]["messages"], 1000u);
+  EXPECT_EQ(json["results"][0]["gb_s"]["rounds"].size(), 3u);
+  EXPECT_DOUBLE_EQ(json["results"][0]["latency_us"]["median"].get<double>(), 11.0);
+  EXPECT_TRUE(json["results"][0].contains("receiver_cpu_ns_per_byte"));
+}
@@ -177,6 +177,7 @@ TEST(JsonSchemaTest, BenchmarkSchemaV2IncludesCompletionAndNullableMeasurements)
   set_measurement_value(loop.main_read_bandwidth, 12.5, 0.150);
   loop.main_read_bandwidth.target = "main-memory";
   loop.main_read_bandwidth.operation = "read";
+  loop.main_read_bandwidth.kernel_variant = "generated";
   loop.main_read_bandwidth.work_policy = "automatic-duration-calibration";
   loop.main_read_bandwidth.automatic_calibration = true;
   loop.main_read_bandwidth.duration_within_target = true;
@@ -213,6 +214,10 @@ TEST(JsonSchemaTest, BenchmarkSchemaV2IncludesCompletionAndNullableMeasurements)
       0.300);
   EXPECT_EQ(output["configuration"]["benchmark_seed"],
             "18446744073709551615");
+  EXPECT_EQ(output["configuration"]["memory_kernel_variant"], "neon");
+  EXPECT_EQ(output["configuration"]["memory_kernel"], "neon");
+  EXPECT_EQ(output["configuration"]["memory_kernel_selection_policy"],
+            "default-neon-main-memory-only");
   EXPECT_EQ(output["status"], "partial");
   EXPECT_FALSE(output["results_complete"].get<bool>());
   EXPECT_EQ(output["planned_loops"], 2u);
@@ -227,8 +232,10 @@ TEST(JsonSchemaTest, BenchmarkSchemaV2IncludesCompletionAndNullableMeasurements)
   EXPECT_EQ(measurements["main_read_bandwidth"]["qos_successful_workers"],
             4u);
   EXPECT_EQ(measurements["main_read_bandwidth"]["created_workers"], 4);
+  EXPECT_EQ(measurements["main_read_bandwidth"]["kernel_variant"], "generated");
   EXPECT_EQ(measurements["main_write_bandwidth"]["status"], "interrupted");
   EXPECT_TRUE(measurements["main_write_bandwidth"]["value"].is_null());
+  EXPECT_TRUE(measurements["main_write_bandwidth"]["kernel_variant"].is_null());
   EXPECT_EQ(output["main_memory"]["bandwidth"]["read_gb_s"]["value"], 12.5);
   EXPECT_TRUE(output["main_memory"]["bandwidth"]["write_gb_s"]["value"].is_null());
   EXPECT_FALSE(output.dump().find("page_walk_penalty_ns") != std::string::npos);
@@ -269,6 +276,93 @@ TEST(JsonSchemaTest, BenchmarkAggregateHeadlineUsesMedianAndReportsCvAndMad) {
       10.0);
 }
 
+TEST(JsonSchemaTest, BenchmarkMeasurementsReportCoreFrequencyAndDrift) {
+  BenchmarkConfig config;
+  config.buffer_size = 4096;
+  BenchmarkStatistics stats;
+  stats.status = BenchmarkRunStatus::Complete;
+  stats.planned_loops = 2;
+  stats.completed_loops = 2;
+  for (size_t index = 0; index < 2; ++index) {
+    BenchmarkResults loop;
+    loop.status = BenchmarkRunStatus::Complete;
+    loop.loop_index = index;
+    const double ghz = index == 0 ? 3.2 : 2.4;
+    CoreFrequencySummary frequency;
+    frequency.before_ghz = ghz;
+    frequency.after_ghz = ghz;
+    frequency.min_ghz = ghz;
+    frequency.max_ghz = ghz;
+    frequency.effective_ghz = ghz;
+    set_measurement_value(loop.main_read_bandwidth, 96.0, 0.150);
+    loop.main_read_bandwidth.operation = "read";
+    loop.main_read_bandwidth.core_frequency = frequency;
+    set_measurement_value(loop.main_latency, 100.0, 0.150);
+    loop.main_latency.operation = "latency";
+    loop.main_latency.core_frequency = frequency;
+    stats.loop_results.push_back(loop);
+  }
+
+  const nlohmann::json output = build_results_json(config, stats, 1.0);
+  const nlohmann::json read = output["main_memory"]["bandwidth"]["read_gb_s"];
+  const nlohmann::json& read_frequency = read["measurements"][0]["core_frequency"];
+  EXPECT_DOUBLE_EQ(read_frequency["effective_ghz"].get<double>(), 3.2);
+  EXPECT_DOUBLE_EQ(read_frequency["assumed_adds_per_cycle"].get<double>(), 1.0);
+  EXPECT_DOUBLE_EQ(read_frequency["normalized_value"].get<double>(), 30.0);
+  EXPECT_EQ(read_frequency["normalized_unit"], "bytes-per-cycle");
+  EXPECT_NEAR(read["quality"]["core_frequency_drift_pct"].get<double>(),
+              100.0 / 3.0, 1e-9);
+  EXPECT_TRUE(read["quality"]["core_frequency_drift_warning"].get<bool>());
+
+  const nlohmann::json& latency_frequency =
+      output["loops"][1]["measurements"]["main_latency"]["core_frequency"];
+  EXPECT_DOUBLE_EQ(latency_frequency["normalized_value"].get<double>(), 240.0);
+  EXPECT_EQ(latency_frequency["normalized_unit"], "cycles");
+  EXPECT_FALSE(output["loops"][0]["measurements"].contains(
+      "main_write_bandwidth"));
+}
+
+TEST(JsonSchemaTest, BenchmarkMeasurementsFlagPageFaultsAndLockOutcome) {
+  BenchmarkConfig config;
+  config.buffer_size = 4096;
+  config.lock_buffers = true;
+  BenchmarkStatistics stats;
+  stats.status = BenchmarkRunStatus::Complete;
+  stats.planned_loops = 2;
+  stats.completed_loops = 2;
+  for (size_t index = 0; index < 2; ++index) {
+    BenchmarkResults loop;
+    loop.status = BenchmarkRunStatus::Complete;
+    loop.loop_index = index;
+    BufferLockState lock = make_buffer_lock_state(true);
+    lock.locked = false;
+    lock.error = 12;
+    PageFaultCounts faults;
+    faults.minor = index == 0 ? 0 : 37;
+    set_measurement_value(loop.main_read_bandwidth, 96.0, 0.150);
+    loop.main_read_bandwidth.residency =
+        make_buffer_residency(lock, 256, size_t{256}, std::nullopt, faults);
+    stats.loop_results.push_back(loop);
+  }
+
+  const nlohmann::json output = build_results_json(config, stats, 1.0);
+  EXPECT_TRUE(output["configuration"]["lock_buffers"].get<bool>());
+  const nlohmann::json read = output["main_memory"]["bandwidth"]["read_gb_s"];
+  const nlohmann::json& clean = read["measurements"][0]["residency"];
+  EXPECT_TRUE(clean["lock_requested"].get<bool>());
+  EXPECT_FALSE(clean["locked"].get<bool>());
+  EXPECT_EQ(clean["lock_errno"], 12);
+  EXPECT_EQ(clean["buffer_pages"], 256u);
+  EXPECT_EQ(clean["resident_pages_before"], 256u);
+  EXPECT_TRUE(clean["resident_pages_after"].is_null());
+  EXPECT_FALSE(clean["took_page_faults"].get<bool>());
+  const nlohmann::json& faulted = read["measurements"][1]["residency"];
+  EXPECT_EQ(faulted["minor_faults"], 37u);
+  EXPECT_TRUE(faulted["took_page_faults"].get<bool>());
+  EXPECT_EQ(read["quality"]["page_faulted_loops"], 1u);
+  EXPECT_TRUE(output["loops"][0]["measurements"]["main_read_bandwidth"].contains("residency"));
+}
+
 TEST(JsonSchemaTest, BenchmarkCheckpointAtomicallyProgressesToComplete) {
   const TemporaryJsonFile output_file("benchmark_checkpoint");
   BenchmarkConfig config;
@@ -336,8 +430,8 @@ TEST(JsonSchemaTest, PatternSchemaV3SerializesExactCompletionContract) {
   EXPECT_EQ(output["status_reason"], "");
   EXPECT_EQ(output["planned_loops"], 1u);
   EXPECT_EQ(output["completed_loops"], 1u);
-  EXPECT_EQ(output["planned_measurements"], 21u);
-  EXPECT_EQ(output["completed_measurements"], 21u);
+  EXPECT_EQ(output["planned_measurements"], 48u);
+  EXPECT_EQ(output["completed_measurements"], 48u);
   EXPECT_TRUE(output["results_complete"].get<bool>());
   EXPECT_TRUE(output.contains(JsonKeys::PATTERNS));
 
@@ -351,7 +445,7 @@ TEST(JsonSchemaTest, PatternSchemaV3SerializesExactCompletionContract) {
             Messages::pattern_reason_buffers_allocation_failed());
   EXPECT_EQ(output["planned_loops"], 2u);
   EXPECT_EQ(output["completed_loops"], 0u);
-  EXPECT_EQ(output["planned_measurements"], 42u);
+  EXPECT_EQ(output["planned_measurements"], 96u);
   EXPECT_EQ(output["completed_measurements"], 0u);
   EXPECT_FALSE(output["results_complete"].get<bool>());
   EXPECT_FALSE(output.contains(JsonKeys::PATTERNS));
@@ -359,14 +453,14 @@ TEST(JsonSchemaTest, PatternSchemaV3SerializesExactCompletionContract) {
   statistics.status = PatternRunStatus::Partial;
   statistics.status_reason = "pattern loop incomplete";
   statistics.completed_loops = 1;
-  statistics.completed_measurements = 21;
+  statistics.completed_measurements = 48;
   output = build_pattern_results_json(config, statistics, 0.5);
   EXPECT_EQ(output["status"], "partial");
   EXPECT_EQ(output["status_reason"], "pattern loop incomplete");
   EXPECT_EQ(output["planned_loops"], 2u);
   EXPECT_EQ(output["completed_loops"], 1u);
-  EXPECT_EQ(output["planned_measurements"], 42u);
-  EXPECT_EQ(output["completed_measurements"], 21u);
+  EXPECT_EQ(output["planned_measurements"], 96u);
+  EXPECT_EQ(output["completed_measurements"], 48u);
   EXPECT_FALSE(output["results_complete"].get<bool>());
 
   statistics.status = PatternRunStatus::Interrupted;
@@ -376,8 +470,8 @@ TEST(JsonSchemaTest, PatternSchemaV3SerializesExactCompletionContract) {
   EXPECT_EQ(output["status_reason"], "stop requested");
   EXPECT_EQ(output["planned_loops"], 2u);
   EXPECT_EQ(output["completed_loops"], 1u);
-  EXPECT_EQ(output["planned_measurements"], 42u);
-  EXPECT_EQ(output["completed_measurements"], 21u);
+  EXPECT_EQ(output["planned_measurements"], 96u);
+  EXPECT_EQ(output["completed_measurements"], 48u);
   EXPECT_FALSE(output["results_complete"].get<bool>());
 }
 
@@ -445,6 +539,21 @@ TEST(JsonSchemaTest, PatternMeasurementsIncludeStatusAndMethodologyMetadata) {
   set_pattern_measurement(loop, PatternKind::Random, PatternOperation::Read,
                           std::move(random));
 
+  PatternMeasurement gather = measured;
+  gather.access_size_bytes = Constants::PATTERN_GATHER_ELEMENT_BYTES;
+  gather.indices_per_group = Constants::PATTERN_GATHER_GROUP_INDICES;
+  set_pattern_measurement(loop, PatternKind::GatherScatterNeon,
+                          PatternOperation::Read, std::move(gather));
+
+  PatternMeasurement zipf = measured;
+  PatternSkewParameters zipf_parameters;
+  zipf_parameters.zipf_theta = 0.99;
+  zipf.skew_parameters = zipf_parameters;
+  zipf.l1_hit_ratio_proxy = 0.25;
+  zipf.l2_hit_ratio_proxy = 0.75;
+  set_pattern_measurement(loop, PatternKind::SkewedZipf, PatternOperation::Read,
+                          std::move(zipf));
+
   PatternStatistics statistics;
   initialize_pattern_statistics(statistics, 1);
   collect_pattern_loop_result(statistics, std::move(loop));
@@ -492,6 +601,36 @@ TEST(JsonSchemaTest, PatternMeasurementsIncludeStatusAndMethodologyMetadata) {
   const nlohmann::json random_json =
       output[JsonKeys::PATTERNS][JsonKeys::RANDOM];
   EXPECT_EQ(random_json["seed"], "18446744073709551615");
+
+  const nlohmann::json gather_json =
+      output[JsonKeys::PATTERNS][JsonKeys::GATHER_SCATTER_NEON];
+  EXPECT_EQ(gather_json["kernel"], "neon-register-offset");
+  EXPECT_EQ(gather_json["indices_per_group"], 8u);
+  EXPECT_EQ(gather_json["operation_semantics"]["read"], "gather");
+  const nlohmann::json gather_read =
+      gather_json[JsonKeys::BANDWIDTH][JsonKeys::READ_GB_S]["measurements"][0];
+  EXPECT_EQ(gather_read["access_size_bytes"], 8u);
+  EXPECT_EQ(gather_read["indices_per_group"], 8u);
+  EXPECT_TRUE(random_json[JsonKeys::BANDWIDTH][JsonKeys::READ_GB_S]
+                  ["measurements"][0]["indices_per_group"]
+                      .is_null());
+  EXPECT_EQ(output[JsonKeys::PATTERNS][JsonKeys::GATHER_SCATTER_SCALAR]["kernel"],
+            "scalar");
+
+  const nlohmann::json zipf_json = output[JsonKeys::PATTERNS][JsonKeys::SKEWED_ZIPF];
+  EXPECT_EQ(zipf_json["distribution"], "zipf");
+  EXPECT_EQ(zipf_json["sampling"], "with-replacement");
+  EXPECT_DOUBLE_EQ(zipf_json["zipf_theta"].get<double>(), 0.99);
+  EXPECT_DOUBLE_EQ(zipf_json["l1_hit_ratio_proxy"].get<double>(), 0.25);
+  EXPECT_DOUBLE_EQ(zipf_json[JsonKeys::BANDWIDTH][JsonKeys::READ_GB_S]["measurements"][0]
+                            ["l2_hit_ratio_proxy"]
+                                .get<double>(),
+                   0.75);
+  EXPECT_TRUE(random_json[JsonKeys::BANDWIDTH][JsonKeys::READ_GB_S]
+                  ["measurements"][0]["l1_hit_ratio_proxy"]
+                      .is_null());
+  EXPECT_EQ(output[JsonKeys::PATTERNS][JsonKeys::SKEWED_SHIFTING_HOT_SET]["distribution"],
+            "shifting-hot-set");
 }
 
 TEST(JsonSchemaTest, TlbAnalysisExporterIncludesModeAndCoreCounts) {
@@ -615,7 +754,8 @@ TEST(JsonSchemaTest, TlbAnalysisExporterIncludesModeAndCoreCounts) {
   const TlbWorkEstimate base_work_estimate = estimate_tlb_work(
       1, 1050 * Constants::BYTES_PER_MB, 1, runtime_profile);
   const std::vector<TlbPassExecutionSummary> pass_summaries = {
-      {TlbMeasurementPass::Base, 1, 2, true, true},
+      {TlbMeasurementPass::Base, 1, 2, true, true,
+       TlbScheduleExecutionStatus::Complete, 1},
       {TlbMeasurementPass::Validation, 1, 2, true, true},
       {TlbMeasurementPass::LargeLocality, 1, 2, true, true},
   };
@@ -720,6 +860,16 @@ TEST(JsonSchemaTest, TlbAnalysisExporterIncludesModeAndCoreCounts) {
             2);
   EXPECT_EQ(output_json[JsonKeys::CONFIGURATION]["adaptive_rounds"]["maximum"],
             4);
+  EXPECT_TRUE(output_json[JsonKeys::CONFIGURATION]["adaptive_rounds"].contains(
+      "point_retirement"));
+  EXPECT_EQ(output_json[JsonKeys::CONFIGURATION]["chain_reuse"]
+                       ["layout_identities_per_point"],
+            0);
+  EXPECT_EQ(output_json[JsonKeys::CONFIGURATION]["chain_reuse"]["policy"],
+            "rebuild-every-round");
+  EXPECT_TRUE(output_json[JsonKeys::CONFIGURATION]["chain_reuse"]
+                         ["reuse_unavailable_passes"]
+                             .empty());
   EXPECT_EQ(output_json[JsonKeys::CONFIGURATION]["memory_budget"]["budget_mb"],
             1228);
   EXPECT_EQ(output_json[JsonKeys::CONFIGURATION]["buffer_lock"]["errno"], 0);
@@ -729,6 +879,19 @@ TEST(JsonSchemaTest, TlbAnalysisExporterIncludesModeAndCoreCounts) {
       "maximum_pilot_accesses_per_measurement"));
   EXPECT_TRUE(output_json["tlb_analysis"].contains("private_cache_knee"));
   EXPECT_EQ(output_json["tlb_analysis"]["l1_tlb_detection"]["inferred_entries"], 248);
+  EXPECT_EQ(output_json["tlb_analysis"]["page_granules"][0]["l1_tlb"]
+                       ["inferred_entries"],
+            248);
+  EXPECT_EQ(output_json["tlb_analysis"]["l1_tlb_detection"]
+                       ["effective_reach_bytes"],
+            248 * 16384);
+  EXPECT_FALSE(output_json["tlb_analysis"]["page_granules"][0]["l2_tlb"]
+                          ["detected"]);
+  EXPECT_FALSE(output_json["tlb_analysis"]["page_granules"][1]["analyzed"]);
+  EXPECT_FALSE(output_json["tlb_analysis"]["page_table_footprint_comparison"]
+                          ["available"]);
+  EXPECT_TRUE(output_json["tlb_analysis"]["page_table_footprint_comparison"]
+                  .contains("reason"));
   EXPECT_EQ(output_json["tlb_analysis"]["l1_tlb_detection"]["inferred_entries_method"],
             "validated-bracket-range-midpoint-estimate");
   EXPECT_TRUE(output_json["tlb_analysis"]["l1_tlb_detection"]["discovery"]["passed"]);
@@ -812,8 +975,12 @@ TEST(JsonSchemaTest, TlbAnalysisExporterIncludesModeAndCoreCounts) {
   EXPECT_EQ(output_json["tlb_analysis"]["measurement_records"][0]
                        ["paired_control"]["spread"]["access_count"],
             1000000);
+  EXPECT_FALSE(output_json["tlb_analysis"]["measurement_records"][0]
+                          ["paired_control"]["spread"]["layout_reused"]);
   ASSERT_EQ(output_json["tlb_analysis"]["pass_summaries"].size(), 3u);
   EXPECT_TRUE(output_json["tlb_analysis"]["pass_summaries"][0]["converged"]);
+  EXPECT_EQ(output_json["tlb_analysis"]["pass_summaries"][0]["retired_points"], 1);
+  EXPECT_EQ(output_json["tlb_analysis"]["pass_summaries"][1]["retired_points"], 0);
   EXPECT_EQ(output_json["tlb_analysis"]["sweep"][0]["requested_pages"], 1);
   EXPECT_EQ(output_json["tlb_analysis"]["sweep"][0]["actual_pages"], 1);
   EXPECT_FALSE(output_json["tlb_analysis"]["sweep"][0].contains(
@@ -975,8 +1142,17 @@ TEST(JsonSchemaTest, TlbAnalysisExporterOmitsRemovedAliasesAndHandlesUnavailable
   context.validation_complete = true;
   context.selected_buffer_mb = 256;
   context.can_measure_page_walk_penalty = false;
+  config.tlb_chain_layouts = 4;
+  context.chain_reuse_unavailable_passes = {"base"};
   ASSERT_EQ(save_tlb_analysis_to_json(context), EXIT_SUCCESS);
   const nlohmann::json fallback_json = read_json_file(config.output_file);
+  const nlohmann::json fallback_reuse =
+      fallback_json[JsonKeys::CONFIGURATION]["chain_reuse"];
+  EXPECT_EQ(fallback_reuse["layout_identities_per_point"], 4);
+  EXPECT_EQ(fallback_reuse["policy"],
+            "rebuild-every-round-in-unavailable-passes");
+  EXPECT_EQ(fallback_reuse["reuse_unavailable_passes"],
+            nlohmann::json::array({"base"}));
   const nlohmann::json fallback_large =
       fallback_json["tlb_analysis"]["large_locality_paired_comparison"];
   EXPECT_FALSE(fallback_json["tlb_analysis"]["validation_required"]);
@@ -0,0 +1,152 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file test_kernel_autotune.cpp
+ * @brief Unit tests for kernel autotune CLI parsing, selection, and cache
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "benchmark/kernel_autotune.h"
+#include "core/config/constants.h"
+
+namespace {
+
+int parse_with_args(const std::vector<std::string>& args, KernelAutotuneConfig& config) {
+  std::vector<std::string> mutable_args = args;
+  std::vector<char*> argv;
+  argv.reserve(mutable_args.size());
+  for (std::string& arg : mutable_args) {
+    argv.push_back(arg.data());
+  }
+  testing::internal::CaptureStderr();
+  const int result =
+      parse_kernel_autotune_mode_arguments(static_cast<int>(argv.size()), argv.data(), config);
+  testing::internal::GetCapturedStderr();
+  return result;
+}
+
+KernelAutotuneChoice make_choice(BenchmarkTarget target, BenchmarkOperation operation,
+                                 const std::string& best_kernel) {
+  KernelAutotuneChoice choice;
+  choice.target = target;
+  choice.operation = operation;
+  choice.best_kernel = best_kernel;
+  choice.measured = true;
+  return choice;
+}
+
+}  // namespace
+
+TEST(KernelAutotuneCliTest, ParsesDefaultsAndModeOptions) {
+  KernelAutotuneConfig defaults;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "--autotune-kernels"}, defaults), EXIT_SUCCESS);
+  EXPECT_EQ(defaults.rounds, Constants::KERNEL_AUTOTUNE_DEFAULT_ROUNDS);
+  EXPECT_EQ(defaults.buffer_size_mb, Constants::DEFAULT_BUFFER_SIZE_MB);
+  EXPECT_EQ(defaults.requested_threads, 0);
+  EXPECT_TRUE(defaults.cache_file.empty());
+
+  KernelAutotuneConfig config;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-A", "-b", "256", "-t", "4", "-r", "3", "-o",
+                             "tune.json", "--autotune-cache", "cache.json"},
+                            config),
+            EXIT_SUCCESS);
+  EXPECT_EQ(config.buffer_size_mb, 256u);
+  EXPECT_EQ(config.requested_threads, 4);
+  EXPECT_EQ(config.rounds, 3);
+  EXPECT_EQ(config.output_file, "tune.json");
+  EXPECT_EQ(config.cache_file, "cache.json");
+}
+
+TEST(KernelAutotuneCliTest, RejectsForeignDuplicateAndInvalidOptions) {
+  KernelAutotuneConfig foreign;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-A", "--kernel", "neon"}, foreign), EXIT_FAILURE);
+  KernelAutotuneConfig duplicate;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-A", "-r", "2", "--count", "3"}, duplicate),
+            EXIT_FAILURE);
+  KernelAutotuneConfig zero_rounds;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-A", "-r", "0"}, zero_rounds), EXIT_FAILURE);
+  KernelAutotuneConfig missing_cache;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-A", "--autotune-cache"}, missing_cache),
+            EXIT_FAILURE);
+}
+
+TEST(KernelAutotuneSelectionTest, PicksFastestMedianAndReportsDefaultShortfall) {
+  KernelAutotuneChoice choice;
+  choice.default_kernel = "neon";
+  choice.candidates = {{"neon", {90.0, 80.0, 85.0}, 0.0},
+                       {"generated-u8-w32-nt-pf0", {100.0, 500.0, 98.0}, 0.0},
+                       {"generated-u2-w16-t-pf0", {}, 0.0}};
+
+  ASSERT_TRUE(finalize_kernel_autotune_choice(choice));
+  EXPECT_EQ(choice.best_kernel, "generated-u8-w32-nt-pf0");
+  EXPECT_DOUBLE_EQ(choice.best_bandwidth_gb_s, 100.0);
+  EXPECT_DOUBLE_EQ(choice.default_bandwidth_gb_s, 85.0);
+  EXPECT_DOUBLE_EQ(choice.default_shortfall_pct, 15.0);
+}
+
+TEST(KernelAutotuneSelectionTest, TiesKeepDefaultAndMissingDefaultFails) {
+  KernelAutotuneChoice tie;
+  tie.default_kernel = "neon-cache";
+  tie.candidates = {{"neon-cache", {50.0}, 0.0}, {"neon", {50.0}, 0.0}};
+  ASSERT_TRUE(finalize_kernel_autotune_choice(tie));
+  EXPECT_EQ(tie.best_kernel, "neon-cache");
+  EXPECT_DOUBLE_EQ(tie.default_shortfall_pct, 0.0);
+
+  KernelAutotuneChoice unmeasured_default;
+  unmeasured_default.default_kernel = "neon";
+  unmeasured_default.candidates = {{"neon", {}, 0.0}, {"generated-u8-w32-nt-pf512", {60.0}, 0.0}};
+  EXPECT_FALSE(finalize_kernel_autotune_choice(unmeasured_default));
+  EXPECT_FALSE(unmeasured_default.measured);
+}
+
+TEST(KernelAutotuneCacheTest, MergeKeepsOtherMachinesAndReadsMainMemoryWinners) {
+  const std::string this_cpu = build_kernel_autotune_cpu_identity("Apple M4", 4, 6);
+  const std::string other_cpu = build_kernel_autotune_cpu_identity("Apple M4", 10, 4);
+  EXPECT_NE(this_cpu, other_cpu);
+
+  nlohmann::json cache = "not a cache";
+  merge_kernel_autotune_cache(
+      cache, other_cpu,
+      {make_choice(BenchmarkTarget::MainMemory, BenchmarkOperation::Read, "generated-u2-w16-t-pf0")}, "t0");
+  merge_kernel_autotune_cache(
+      cache, this_cpu,
+      {make_choice(BenchmarkTarget::L1, BenchmarkOperation::Read, "neon"),
+       make_choice(BenchmarkTarget::MainMemory, BenchmarkOperation::Read, "generated-u8-w32-t-pf512"),
+       make_choice(BenchmarkTarget::MainMemory, BenchmarkOperation::Write, "generated-u4-w32-nt-pf0"),
+       make_choice(BenchmarkTarget::MainMemory, BenchmarkOperation::Copy, "neon")},
+      "t1");
+
+  EXPECT_EQ(cache["kernel_autotune_cache_version"], Constants::KERNEL_AUTOTUNE_CACHE_VERSION);
+  EXPECT_TRUE(cache["machines"].contains(other_cpu));
+
+  TunedMemoryKernelNames names;
+  ASSERT_TRUE(find_tuned_memory_kernel_names(cache, this_cpu, names));
+  EXPECT_EQ(names.read, "generated-u8-w32-t-pf512");
+  EXPECT_EQ(names.write, "generated-u4-w32-nt-pf0");
+  EXPECT_EQ(names.copy, "neon");
+
+  // A machine without all three main-memory winners is not usable.
+  TunedMemoryKernelNames partial;
+  EXPECT_FALSE(find_tuned_memory_kernel_names(cache, other_cpu, partial));
+  EXPECT_FALSE(find_tuned_memory_kernel_names(cache, "unknown", partial));
+}
@@ -0,0 +1,261 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file test_linked_structures.cpp
+ * @brief Unit tests for linked-structures CLI parsing, builders, and kernels
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "benchmark/linked_structures.h"
+#include "core/config/constants.h"
+#include "core/memory/memory_utils.h"
+
+namespace {
+
+int parse_with_args(const std::vector<std::string>& args, LinkedStructuresConfig& config) {
+  std::vector<std::string> mutable_args = args;
+  std::vector<char*> argv;
+  argv.reserve(mutable_args.size());
+  for (std::string& arg : mutable_args) {
+    argv.push_back(arg.data());
+  }
+  testing::internal::CaptureStderr();
+  const int result = parse_linked_structures_mode_arguments(static_cast<int>(argv.size()),
+                                                            argv.data(), config);
+  testing::internal::GetCapturedStderr();
+  return result;
+}
+
+// Walks a chain for `count` operations and checks every state is new before it returns to the start.
+void expect_single_cycle(const LinkedStructureLayout& layout, size_t count) {
+  std::set<uint64_t> seen;
+  uint64_t state = layout.start;
+  uint64_t checksum = 0;
+  for (size_t step = 0; step < count; ++step) {
+    EXPECT_TRUE(seen.insert(state).second) << "state repeated at step " << step;
+    state = run_linked_structure_operations(layout, state, 1, checksum);
+  }
+  EXPECT_EQ(state, layout.start);
+}
+
+}  // namespace
+
+TEST(LinkedStructuresCliTest, ParsesDefaultsAndRejectsInvalidShapes) {
+  LinkedStructuresConfig defaults;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "--linked-structures"}, defaults),
+            EXIT_SUCCESS);
+  EXPECT_EQ(defaults.buffer_size_mb, Constants::LINKED_DEFAULT_BUFFER_SIZE_MB);
+  EXPECT_EQ(defaults.operations, Constants::LINKED_DEFAULT_OPERATIONS);
+  EXPECT_EQ(defaults.payload_bytes, Constants::LINKED_DEFAULT_PAYLOAD_BYTES);
+  EXPECT_EQ(defaults.tree_fanout, Constants::LINKED_DEFAULT_TREE_FANOUT);
+  EXPECT_EQ(defaults.tree_node_bytes, Constants::LINKED_DEFAULT_TREE_NODE_BYTES);
+  EXPECT_DOUBLE_EQ(defaults.load_factor, Constants::LINKED_DEFAULT_LOAD_FACTOR);
+  EXPECT_FALSE(defaults.user_specified_seed);
+  EXPECT_NE(defaults.seed, 0u);
+  EXPECT_LE(linked_tree_min_node_bytes(defaults.tree_fanout), defaults.tree_node_bytes);
+
+  LinkedStructuresConfig config;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-K", "-b", "32", "-i", "5000", "-r", "2",
+                             "--seed", "42", "--payload-bytes", "256", "--tree-fanout", "8",
+                             "--tree-node-bytes", "192", "--load-factor", "0.5", "-o",
+                             "linked.json"},
+                            config),
+            EXIT_SUCCESS);
+  EXPECT_EQ(config.buffer_size_mb, 32u);
+  EXPECT_EQ(config.operations, 5000);
+  EXPECT_EQ(config.rounds, 2);
+  EXPECT_TRUE(config.user_specified_seed);
+  EXPECT_EQ(config.seed, 42u);
+  EXPECT_EQ(config.payload_bytes, 256u);
+  EXPECT_EQ(config.tree_fanout, 8u);
+  EXPECT_EQ(config.tree_node_bytes, 192u);
+  EXPECT_DOUBLE_EQ(config.load_factor, 0.5);
+  EXPECT_EQ(config.output_file, "linked.json");
+
+  const std::vector<std::vector<std::string>> invalid_args = {
+      {"--payload-bytes", "12"},     {"--payload-bytes", "0"},
+      {"--payload-bytes", "8192"},   {"--tree-fanout", "1"},
+      {"--tree-fanout", "16"},       {"--tree-node-bytes", "100"},
+      {"--load-factor", "0"},        {"--load-factor", "0.96"},
+      {"--load-factor", " 0.5"},     {"--load-factor", "nan"},
+      {"--seed", "-1"},              {"--threads", "2"},
+  };
+  for (const std::vector<std::string>& extra : invalid_args) {
+    std::vector<std::string> args = {"memory_benchmark", "-K"};
+    args.insert(args.end(), extra.begin(), extra.end());
+    LinkedStructuresConfig invalid;
+    EXPECT_EQ(parse_with_args(args, invalid), EXIT_FAILURE) << extra[0] << " " << extra[1];
+  }
+  LinkedStructuresConfig duplicate;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-K", "--seed", "1", "--seed", "2"}, duplicate),
+            EXIT_FAILURE);
+}
+
+TEST(LinkedStructuresLayoutTest, ChainOrderMatchesSeededPointerChain) {
+  constexpr size_t kStride = 64;
+  constexpr size_t kNodes = 257;
+  std::vector<uint64_t> buffer(kNodes * kStride / sizeof(uint64_t));
+  ASSERT_EQ(setup_latency_chain(buffer.data(), kNodes * kStride, kStride, 0, nullptr,
+                                LatencyChainMode::GlobalRandom, 99),
+            EXIT_SUCCESS);
+  const std::vector<size_t> order =
+      build_latency_chain_order(kNodes, 0, LatencyChainMode::GlobalRandom, 99);
+  ASSERT_EQ(order.size(), kNodes);
+  const uintptr_t base = reinterpret_cast<uintptr_t>(buffer.data());
+  for (size_t position = 0; position < kNodes; ++position) {
+    const uintptr_t node = base + order[position] * kStride;
+    EXPECT_EQ(*reinterpret_cast<const uintptr_t*>(node),
+              base + order[(position + 1) % kNodes] * kStride);
+  }
+  EXPECT_TRUE(build_latency_chain_order(1, 0, LatencyChainMode::GlobalRandom, 99).empty());
+  EXPECT_TRUE(
+      build_latency_chain_order(kNodes, 1, LatencyChainMode::RandomInBoxRandomBox, 99).empty());
+}
+
+TEST(LinkedStructuresLayoutTest, ListVisitsEveryNodeAndReadsPayload) {
+  std::vector<uint64_t> buffer(4096);
+  LinkedStructureLayout list;
+  ASSERT_TRUE(build_linked_list(buffer.data(), buffer.size() * sizeof(uint64_t), 40, 7, list));
+  EXPECT_EQ(list.node_bytes, 48u);
+  EXPECT_EQ(list.element_count, buffer.size() * sizeof(uint64_t) / 48);
+  EXPECT_DOUBLE_EQ(list.bytes_per_operation, 48.0);
+  expect_single_cycle(list, list.element_count);
+
+  // A full cycle reads every node's payload once.
+  uint64_t expected = 0;
+  const char* base = reinterpret_cast<const char*>(buffer.data());
+  for (size_t node = 0; node < list.element_count; ++node) {
+    const uint64_t* words = reinterpret_cast<const uint64_t*>(base + node * list.node_bytes);
+    for (size_t word = 1; word <= 5; ++word) {
+      expected ^= words[word];
+    }
+  }
+  uint64_t checksum = 0;
+  EXPECT_EQ(run_linked_structure_operations(list, list.start, list.element_count, checksum),
+            list.start);
+  EXPECT_EQ(checksum, expected);
+  EXPECT_FALSE(build_linked_list(buffer.data(), 64, 40, 7, list));
+  EXPECT_FALSE(build_linked_list(buffer.data(), 4096, 12, 7, list));
+}
+
+TEST(LinkedStructuresLayoutTest, TreeLookupsCycleKeysAndCountScannedBytes) {
+  constexpr size_t kFanout = 3;
+  constexpr size_t kNodeBytes = 64;
+  std::vector<uint64_t> buffer(100 * kNodeBytes / sizeof(uint64_t));
+  LinkedStructureLayout tree;
+  ASSERT_TRUE(build_linked_tree(buffer.data(), buffer.size() * sizeof(uint64_t), kFanout,
+                                kNodeBytes, 11, tree));
+  EXPECT_GE(tree.levels, 4u);
+  EXPECT_LE(tree.footprint_bytes, buffer.size() * sizeof(uint64_t));
+  EXPECT_EQ(tree.element_count % kFanout, 0u);
+  expect_single_cycle(tree, tree.element_count);
+
+  // Recount the words each lookup reads by walking the built nodes.
+  size_t words = 0;
+  for (uint64_t key = 0; key < tree.element_count; ++key) {
+    const uint64_t* node = static_cast<const uint64_t*>(tree.base);
+    for (;;) {
+      const uint64_t* keys = node + 1;
+      const size_t count = static_cast<size_t>(node[0] & 0xffffffffULL);
+      if ((node[0] >> 32) != 0) {
+        size_t index = 0;
+        while (keys[index] != key) {
+          ++index;
+        }
+        words += 2 + index + 1;
+        break;
+      }
+      size_t index = 1;
+      while (index < count && keys[index] <= key) {
+        ++index;
+      }
+      words += 2 + (index < count ? index : count - 1);
+      node = reinterpret_cast<const uint64_t*>(keys[kFanout + index - 1]);
+    }
+  }
+  EXPECT_DOUBLE_EQ(tree.bytes_per_operation,
+                   static_cast<double>(words * 8) / static_cast<double>(tree.element_count));
+  EXPECT_FALSE(build_linked_tree(buffer.data(), buffer.size() * sizeof(uint64_t), kFanout,
+                                 linked_tree_min_node_bytes(kFanout) - 8, 11, tree));
+}
+
+TEST(LinkedStructuresLayoutTest, HashTablesHoldEveryKeyAndCountProbes) {
+  std::vector<uint64_t> linear_buffer(2 * 1024);
+  std::vector<uint64_t> quadratic_buffer(2 * 1024);
+  LinkedStructureLayout linear;
+  LinkedStructureLayout quadratic;
+  ASSERT_TRUE(build_linked_hash_table(linear_buffer.data(), linear_buffer.size() * 8, 0.9,
+                                      false, 5, linear));
+  ASSERT_TRUE(build_linked_hash_table(quadratic_buffer.data(), quadratic_buffer.size() * 8, 0.9,
+                                      true, 5, quadratic));
+  EXPECT_EQ(linear.slot_count, 1024u);
+  EXPECT_EQ(linear.element_count, 921u);
+  EXPECT_NEAR(linear.load_factor, 0.9, 0.001);
+  expect_single_cycle(linear, linear.element_count);
+  expect_single_cycle(quadratic, quadratic.element_count);
+
+  // Linear probing clusters at high load; both exceed one probe on average.
+  EXPECT_GT(linear.steps_per_operation, 1.0);
+  EXPECT_GT(quadratic.steps_per_operation, 1.0);
+  EXPECT_GT(linear.steps_per_operation, quadratic.steps_per_operation);
+  EXPECT_DOUBLE_EQ(linear.bytes_per_operation, (linear.steps_per_operation + 1.0) * 8.0);
+  EXPECT_FALSE(build_linked_hash_table(linear_buffer.data(), 32, 0.5, false, 5, linear));
+  EXPECT_FALSE(build_linked_hash_table(linear_buffer.data(), 4096, 1.0, false, 5, linear));
+}
+
+TEST(LinkedStructuresJsonTest, ReportsPerOperationCostsAgainstPointerChase) {
+  LinkedStructuresConfig config;
+  config.seed = 123;
+  config.user_specified_seed = true;
+  LinkedStructuresResult result;
+  LinkedStructureMeasurement chase;
+  chase.layout.kind = LinkedStructureKind::PointerChase;
+  chase.layout.bytes_per_operation = 8.0;
+  chase.samples_ns = {100.0, 100.0};
+  LinkedStructureMeasurement hash;
+  hash.layout.kind = LinkedStructureKind::HashLinear;
+  hash.layout.slot_count = 1024;
+  hash.layout.steps_per_operation = 2.5;
+  hash.layout.bytes_per_operation = 28.0;
+  hash.samples_ns = {140.0, 140.0};
+  LinkedStructureMeasurement tree;
+  tree.layout.kind = LinkedStructureKind::TreeLookup;
+  result.structures = {chase, hash, tree};
+  finalize_linked_structures_result(result);
+
+  const nlohmann::ordered_json json = build_linked_structures_json(config, result, "cpu", 1.0);
+  EXPECT_EQ(json["mode"], Constants::LINKED_JSON_MODE_NAME);
+  EXPECT_EQ(json["configuration"]["base_seed_uint64_decimal"], "123");
+  EXPECT_EQ(json["configuration"]["seed_source"], "user");
+  const nlohmann::ordered_json& structures = json["structures"];
+  ASSERT_EQ(structures.size(), 3u);
+  EXPECT_EQ(structures[1]["name"], "hash_linear_probe");
+  EXPECT_DOUBLE_EQ(structures[1]["ns_per_operation"].get<double>(), 140.0);
+  EXPECT_DOUBLE_EQ(structures[1]["probes_per_operation"].get<double>(), 2.5);
+  EXPECT_DOUBLE_EQ(structures[1]["effective_gb_s"].get<double>(), 0.2);
+  EXPECT_DOUBLE_EQ(structures[1]["vs_pointer_chase"].get<double>(), 1.4);
+  EXPECT_TRUE(structures[2]["ns_per_operation"].is_null());
+  EXPECT_TRUE(structures[2]["vs_pointer_chase"].is_null());
+}
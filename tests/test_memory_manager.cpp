@@ -61,6 +61,19 @@ TEST_F(MemoryManagerTest, NonCacheableAllocationRequestsRandomHintAndReleasesMap
   EXPECT_EQ(state.last_unmapped_size, 256u);
 }
 
+TEST_F(MemoryManagerTest, SharedAllocationMapsSharedAnonymousMemory) {
+  {
+    MmapPtr buffer = allocate_shared_buffer(512, "shared");
+    ASSERT_NE(buffer.get(), nullptr);
+    EXPECT_EQ(state.map_calls, 1u);
+    EXPECT_EQ(state.last_map_size, 512u);
+    EXPECT_EQ(state.last_flags, MAP_SHARED | MAP_ANONYMOUS);
+    EXPECT_EQ(state.last_advice, MADV_WILLNEED);
+  }
+  EXPECT_EQ(state.unmap_calls, 1u);
+  EXPECT_EQ(state.last_unmapped_size, 512u);
+}
+
 TEST_F(MemoryManagerTest, MappingFailureReturnsNullWithoutAdviceOrUnmap) {
   state.fail_map_on_call = 1;
   testing::internal::CaptureStderr();
@@ -321,6 +321,14 @@ TEST(MessagesErrorTest, ErrorSweepMessages) {
   EXPECT_NE(parse_failed.find("bad json"), std::string::npos);
 }
 
+TEST(MessagesErrorTest, ErrorKernelAutotuneCacheMissingWinners) {
+  const std::string msg =
+      Messages::error_kernel_autotune_cache_missing_winners("Apple M4 Pro", "/tmp/tuned.json");
+  EXPECT_NE(msg.find("main-memory read/write/copy"), std::string::npos);
+  EXPECT_NE(msg.find("Apple M4 Pro"), std::string::npos);
+  EXPECT_NE(msg.find("/tmp/tuned.json"), std::string::npos);
+}
+
 // ============================================================================
 // Warning Messages Tests
 // ============================================================================
@@ -346,6 +354,14 @@ TEST(MessagesWarningTest, WarningTlbMlockFailureIsBestEffort) {
   EXPECT_NE(msg.find("continuing"), std::string::npos);
 }
 
+TEST(MessagesWarningTest, WarningTlbChainReuseUnavailableNamesPassAndFallback) {
+  const std::string msg =
+      Messages::warning_tlb_chain_reuse_unavailable("validation", 4);
+  EXPECT_NE(msg.find("--tlb-chain-layouts 4"), std::string::npos);
+  EXPECT_NE(msg.find("validation pass"), std::string::npos);
+  EXPECT_NE(msg.find("rebuilding every chain"), std::string::npos);
+}
+
 // ============================================================================
 // Info Messages Tests (using fixture)
 // ============================================================================
@@ -652,6 +668,20 @@ TEST(MessagesFormattingTest, ReportTlbInferredEntriesRange) {
   EXPECT_NE(reach.find("Estimate"), std::string::npos);
   EXPECT_NE(reach.find("~2000"), std::string::npos);
 
+  const std::string effective_reach =
+      Messages::report_tlb_effective_reach(2560 * 1024, 16 * 1024);
+  EXPECT_NE(effective_reach.find("~2560 KiB"), std::string::npos);
+  EXPECT_NE(effective_reach.find("16 KiB pages"), std::string::npos);
+
+  const std::string granule = Messages::report_tlb_page_granule(
+      32 * 1024 * 1024, false, "unavailable");
+  EXPECT_NE(granule.find("32 MiB: not analyzed (unavailable)"),
+            std::string::npos);
+  const std::string& granule_scope = Messages::report_tlb_page_granules_scope();
+  EXPECT_NE(granule_scope.find("Only the base page granule is measured"),
+            std::string::npos);
+  EXPECT_NE(granule_scope.find("not measured"), std::string::npos);
+
   std::string msg = Messages::report_tlb_inferred_entries_range(240, 256);
   EXPECT_NE(msg.find("240-256"), std::string::npos);
   EXPECT_NE(msg.find("entries"), std::string::npos);
@@ -1424,3 +1454,27 @@ TEST(MessagesFormattingTest, CoreToCoreCalibratedAuditMessages) {
   EXPECT_NE(Messages::report_core_to_core_sample_statistics(1000).find("1000 windows"),
             std::string::npos);
 }
+
+TEST(MessagesFormattingTest, WorkloadParseReasons) {
+  EXPECT_EQ(Messages::error_workload_file("mix.wl", Messages::error_workload_no_group()),
+            "Workload file 'mix.wl' defines no group");
+  EXPECT_EQ(Messages::error_workload_line(3, Messages::workload_reason_chase_write()),
+            "has an error on line 3: chase streams only read");
+  EXPECT_EQ(Messages::workload_reason_stride(32),
+            "stride must be a multiple of 32 bytes and at least 64");
+  EXPECT_EQ(Messages::workload_reason_partition_too_small(4, 8192),
+            "each of 4 workers needs at least 8192 bytes of the region");
+}
+
+TEST(MessagesFormattingTest, TraceReplayDecodeReasonsAndRowLabels) {
+  EXPECT_EQ(Messages::error_trace_replay_file("app.trace",
+                                              Messages::trace_replay_reason_no_records()),
+            "Trace file 'app.trace' holds no records");
+  EXPECT_EQ(Messages::error_trace_replay_record(
+                5, Messages::trace_replay_reason_control_byte(224)),
+            "has a malformed record 5: invalid control byte 224");
+  EXPECT_EQ(Messages::trace_replay_reason_too_many_pages(70000, 65536),
+            "touches 70000 pages, more than the 65536-page replay buffer limit");
+  EXPECT_EQ(Messages::report_trace_replay_trace_order_label(), "trace order");
+  EXPECT_EQ(Messages::report_trace_replay_shuffled_label(), "shuffled");
+}
@@ -37,6 +37,50 @@ TEST(ModeSelectorTest, RecognizesEveryShortAndLongPrimaryMode) {
             PrimaryBenchmarkMode::AnalyzeCoreToCore);
   EXPECT_EQ(select({"program", "-G"}).mode,
             PrimaryBenchmarkMode::GpuBandwidth);
+  EXPECT_EQ(select({"program", "-A"}).mode,
+            PrimaryBenchmarkMode::AutotuneKernels);
+  EXPECT_EQ(select({"program", "--autotune-kernels"}).mode,
+            PrimaryBenchmarkMode::AutotuneKernels);
+  EXPECT_EQ(select({"program", "-N"}).mode,
+            PrimaryBenchmarkMode::NoisyNeighbor);
+  EXPECT_EQ(select({"program", "--noisy-neighbor"}).mode,
+            PrimaryBenchmarkMode::NoisyNeighbor);
+  EXPECT_EQ(select({"program", "-U"}).mode,
+            PrimaryBenchmarkMode::CoreScan);
+  EXPECT_EQ(select({"program", "--core-scan"}).mode,
+            PrimaryBenchmarkMode::CoreScan);
+  EXPECT_EQ(select({"program", "-I"}).mode,
+            PrimaryBenchmarkMode::PartitionCompare);
+  EXPECT_EQ(select({"program", "--partition-compare"}).mode,
+            PrimaryBenchmarkMode::PartitionCompare);
+  EXPECT_EQ(select({"program", "-F"}).mode,
+            PrimaryBenchmarkMode::MultiProcess);
+  EXPECT_EQ(select({"program", "--multi-process"}).mode,
+            PrimaryBenchmarkMode::MultiProcess);
+  EXPECT_EQ(select({"program", "-E"}).mode,
+            PrimaryBenchmarkMode::IpcBandwidth);
+  EXPECT_EQ(select({"program", "--ipc-bandwidth"}).mode,
+            PrimaryBenchmarkMode::IpcBandwidth);
+  EXPECT_EQ(select({"program", "-R"}).mode,
+            PrimaryBenchmarkMode::FileIo);
+  EXPECT_EQ(select({"program", "--file-io"}).mode,
+            PrimaryBenchmarkMode::FileIo);
+  EXPECT_EQ(select({"program", "-Q"}).mode,
+            PrimaryBenchmarkMode::RowBuffer);
+  EXPECT_EQ(select({"program", "--row-buffer"}).mode,
+            PrimaryBenchmarkMode::RowBuffer);
+  EXPECT_EQ(select({"program", "-K"}).mode,
+            PrimaryBenchmarkMode::LinkedStructures);
+  EXPECT_EQ(select({"program", "--linked-structures"}).mode,
+            PrimaryBenchmarkMode::LinkedStructures);
+  EXPECT_EQ(select({"program", "-Y", "mix.workload"}).mode,
+            PrimaryBenchmarkMode::Workload);
+  EXPECT_EQ(select({"program", "--workload", "mix.workload"}).mode,
+            PrimaryBenchmarkMode::Workload);
+  EXPECT_EQ(select({"program", "-Z", "service.trace"}).mode,
+            PrimaryBenchmarkMode::TraceReplay);
+  EXPECT_EQ(select({"program", "--trace-replay", "service.trace"}).mode,
+            PrimaryBenchmarkMode::TraceReplay);
 }
 
 TEST(ModeSelectorTest, DistinctModesConflictIndependentOfArgvOrder) {
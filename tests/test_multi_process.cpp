@@ -0,0 +1,129 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file test_multi_process.cpp
+ * @brief Unit tests for multi-process CLI parsing, worker counts, and results
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "benchmark/multi_process.h"
+#include "core/config/constants.h"
+
+namespace {
+
+int parse_with_args(const std::vector<std::string>& args, MultiProcessConfig& config) {
+  std::vector<std::string> mutable_args = args;
+  std::vector<char*> argv;
+  argv.reserve(mutable_args.size());
+  for (std::string& arg : mutable_args) {
+    argv.push_back(arg.data());
+  }
+  testing::internal::CaptureStderr();
+  const int result =
+      parse_multi_process_mode_arguments(static_cast<int>(argv.size()), argv.data(), config);
+  testing::internal::GetCapturedStderr();
+  return result;
+}
+
+}  // namespace
+
+TEST(MultiProcessCliTest, ParsesDefaultsOptionsAndRejectsForeignOptions) {
+  MultiProcessConfig defaults;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "--multi-process"}, defaults), EXIT_SUCCESS);
+  EXPECT_TRUE(defaults.worker_counts.empty());
+  EXPECT_EQ(defaults.memory, MultiProcessMemory::Private);
+  EXPECT_EQ(defaults.rounds, Constants::MULTI_PROCESS_DEFAULT_ROUNDS);
+  EXPECT_EQ(defaults.buffer_size_mb, Constants::MULTI_PROCESS_DEFAULT_BUFFER_SIZE_MB);
+
+  MultiProcessConfig config;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-F", "--workers", "1,4,8", "--process-memory",
+                             "shared", "-b", "64", "-r", "5", "-o", "mp.json"},
+                            config),
+            EXIT_SUCCESS);
+  EXPECT_EQ(config.worker_counts, (std::vector<int>{1, 4, 8}));
+  EXPECT_EQ(config.memory, MultiProcessMemory::Shared);
+  EXPECT_EQ(config.buffer_size_mb, 64UL);
+  EXPECT_EQ(config.rounds, 5);
+  EXPECT_EQ(config.output_file, "mp.json");
+
+  for (const char* workers : {"0", "4,4", "4,", "-2", "x", ""}) {
+    MultiProcessConfig invalid;
+    EXPECT_EQ(parse_with_args({"memory_benchmark", "-F", "--workers", workers}, invalid),
+              EXIT_FAILURE)
+        << workers;
+  }
+  MultiProcessConfig bad_memory;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-F", "--process-memory", "memfd"}, bad_memory),
+            EXIT_FAILURE);
+  MultiProcessConfig foreign;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-F", "--threads", "4"}, foreign),
+            EXIT_FAILURE);
+}
+
+TEST(MultiProcessWorkerCountTest, ResolvesDefaultsCapsAndComparesDirectionally) {
+  EXPECT_EQ(resolve_multi_process_worker_counts({}, 10), (std::vector<int>{1, 10}));
+  EXPECT_EQ(resolve_multi_process_worker_counts({}, 1), (std::vector<int>{1}));
+  EXPECT_EQ(resolve_multi_process_worker_counts({2, 16, 12}, 10), (std::vector<int>{2, 10}));
+
+  EXPECT_NEAR(calculate_multi_process_advantage_pct(MultiProcessOperation::Read, 100.0, 110.0),
+              10.0, 1e-9);
+  // Lower latency is better, so faster processes still read as positive.
+  EXPECT_NEAR(calculate_multi_process_advantage_pct(MultiProcessOperation::Latency, 110.0, 100.0),
+              10.0, 1e-9);
+  EXPECT_DOUBLE_EQ(
+      calculate_multi_process_advantage_pct(MultiProcessOperation::Copy, 0.0, 100.0), 0.0);
+}
+
+TEST(MultiProcessResultTest, ReducesMediansAndSerializesPerOperation) {
+  MultiProcessResult result = make_multi_process_result({1, 4});
+  ASSERT_EQ(result.points.size(), 2u);
+  ASSERT_EQ(result.points[1].operations.size(), MULTI_PROCESS_OPERATION_COUNT);
+  EXPECT_EQ(result.points[1].operations[3].operation, MultiProcessOperation::Latency);
+
+  result.points[1].passes = 6;
+  MultiProcessOperationResult& read = result.points[1].operations[0];
+  read.samples[0] = {100.0, 80.0, 120.0};
+  read.samples[1] = {95.0, 90.0, 85.0};
+  result.points[1].operations[3].samples[0] = {120.0};
+  finalize_multi_process_result(result);
+  EXPECT_DOUBLE_EQ(read.median[0], 100.0);
+  EXPECT_DOUBLE_EQ(read.median[1], 90.0);
+  EXPECT_NEAR(read.process_vs_thread_pct, -10.0, 1e-9);
+  EXPECT_DOUBLE_EQ(result.points[1].operations[3].process_vs_thread_pct, 0.0);
+
+  MultiProcessConfig config;
+  config.memory = MultiProcessMemory::Shared;
+  const nlohmann::ordered_json json = build_multi_process_json(config, result, "cpu", 2.0);
+  EXPECT_EQ(json["mode"], Constants::MULTI_PROCESS_JSON_MODE_NAME);
+  EXPECT_EQ(json["status"], "complete");
+  EXPECT_EQ(json["configuration"]["process_memory"], "shared");
+  ASSERT_EQ(json["points"].size(), 2u);
+  const nlohmann::ordered_json& point = json["points"][1];
+  EXPECT_EQ(point["workers"], 4);
+  EXPECT_EQ(point["passes"], 6u);
+  EXPECT_EQ(point["operations"]["read"]["unit"], "GB/s");
+  EXPECT_EQ(point["operations"]["read"]["threads"]["rounds"].size(), 3u);
+  EXPECT_NEAR(point["operations"]["read"]["process_vs_thread_pct"].get<double>(), -10.0, 1e-9);
+  EXPECT_EQ(point["operations"]["latency"]["unit"], "ns");
+  EXPECT_TRUE(point["operations"]["latency"]["process_vs_thread_pct"].is_null());
+}
@@ -0,0 +1,153 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file test_noisy_neighbor.cpp
+ * @brief Unit tests for noisy-neighbor CLI parsing, reduction, and JSON
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "benchmark/noisy_neighbor.h"
+#include "core/config/constants.h"
+
+namespace {
+
+int parse_with_args(const std::vector<std::string>& args, NoisyNeighborConfig& config) {
+  std::vector<std::string> mutable_args = args;
+  std::vector<char*> argv;
+  argv.reserve(mutable_args.size());
+  for (std::string& arg : mutable_args) {
+    argv.push_back(arg.data());
+  }
+  testing::internal::CaptureStderr();
+  const int result =
+      parse_noisy_neighbor_mode_arguments(static_cast<int>(argv.size()), argv.data(), config);
+  testing::internal::GetCapturedStderr();
+  return result;
+}
+
+void add_samples(NoisyNeighborVictimResult& victim, const std::vector<double>& values,
+                 double aggressor_bandwidth_gb_s) {
+  for (double value : values) {
+    victim.samples.push_back(NoisyNeighborSample{value, aggressor_bandwidth_gb_s});
+  }
+}
+
+}  // namespace
+
+TEST(NoisyNeighborCliTest, ParsesDefaultsAndModeOptions) {
+  NoisyNeighborConfig defaults;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "--noisy-neighbor"}, defaults), EXIT_SUCCESS);
+  EXPECT_EQ(defaults.rounds, Constants::NOISY_NEIGHBOR_DEFAULT_ROUNDS);
+  EXPECT_EQ(defaults.buffer_size_mb, Constants::NOISY_NEIGHBOR_DEFAULT_BUFFER_SIZE_MB);
+  EXPECT_EQ(defaults.requested_aggressors, 0);
+  EXPECT_EQ(defaults.traffic, NoisyNeighborTraffic::StreamingRead);
+  EXPECT_EQ(defaults.duty_cycles_pct, (std::vector<int>{25, 50, 100}));
+
+  NoisyNeighborConfig config;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-N", "--aggressors", "6", "--aggressor-traffic",
+                             "atomic", "--duty-cycle", "100,10", "-b", "64", "-r", "5", "-o",
+                             "noisy.json"},
+                            config),
+            EXIT_SUCCESS);
+  EXPECT_EQ(config.requested_aggressors, 6);
+  EXPECT_EQ(config.traffic, NoisyNeighborTraffic::SharedAtomics);
+  EXPECT_EQ(config.duty_cycles_pct, (std::vector<int>{100, 10}));
+  EXPECT_EQ(config.buffer_size_mb, 64u);
+  EXPECT_EQ(config.rounds, 5);
+  EXPECT_EQ(config.output_file, "noisy.json");
+}
+
+TEST(NoisyNeighborCliTest, RejectsForeignDuplicateAndInvalidOptions) {
+  NoisyNeighborConfig foreign;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-N", "--threads", "4"}, foreign), EXIT_FAILURE);
+  NoisyNeighborConfig duplicate;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-N", "--aggressors", "2", "--aggressors", "3"},
+                            duplicate),
+            EXIT_FAILURE);
+  NoisyNeighborConfig traffic;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-N", "--aggressor-traffic", "copy"}, traffic),
+            EXIT_FAILURE);
+  NoisyNeighborConfig duty;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-N", "--duty-cycle", "0,50"}, duty),
+            EXIT_FAILURE);
+}
+
+TEST(NoisyNeighborOptionsTest, DutyCycleListRequiresDistinctPercentages) {
+  std::vector<int> duty_cycles{7};
+  EXPECT_TRUE(parse_noisy_neighbor_duty_cycles("25,50,100", duty_cycles));
+  EXPECT_EQ(duty_cycles, (std::vector<int>{25, 50, 100}));
+  EXPECT_FALSE(parse_noisy_neighbor_duty_cycles("", duty_cycles));
+  EXPECT_FALSE(parse_noisy_neighbor_duty_cycles("50,", duty_cycles));
+  EXPECT_FALSE(parse_noisy_neighbor_duty_cycles("50,,60", duty_cycles));
+  EXPECT_FALSE(parse_noisy_neighbor_duty_cycles("101", duty_cycles));
+  EXPECT_FALSE(parse_noisy_neighbor_duty_cycles("50,50", duty_cycles));
+  EXPECT_EQ(duty_cycles, (std::vector<int>{25, 50, 100}));
+
+  EXPECT_DOUBLE_EQ(noisy_neighbor_busy_seconds(100), Constants::NOISY_NEIGHBOR_DUTY_PERIOD_SECONDS);
+  EXPECT_DOUBLE_EQ(noisy_neighbor_busy_seconds(25),
+                   Constants::NOISY_NEIGHBOR_DUTY_PERIOD_SECONDS * 0.25);
+}
+
+TEST(NoisyNeighborOptionsTest, AggressorsLeaveCoresForVictims) {
+  EXPECT_EQ(resolve_noisy_neighbor_aggressor_threads(0, 10), 8);
+  EXPECT_EQ(resolve_noisy_neighbor_aggressor_threads(4, 10), 4);
+  EXPECT_EQ(resolve_noisy_neighbor_aggressor_threads(12, 10), 8);
+  EXPECT_EQ(resolve_noisy_neighbor_aggressor_threads(0, 2), 1);
+}
+
+TEST(NoisyNeighborResultTest, SlowdownIsTimePerOperationAgainstBaseline) {
+  NoisyNeighborConfig config;
+  config.duty_cycles_pct = {50};
+  NoisyNeighborResult result = make_noisy_neighbor_result(config, 8);
+  ASSERT_EQ(result.levels.size(), 2u);
+  ASSERT_EQ(result.levels[0].victims.size(), NOISY_NEIGHBOR_VICTIM_COUNT);
+  EXPECT_EQ(result.levels[0].duty_cycle_pct, 0);
+  EXPECT_EQ(result.levels[1].duty_cycle_pct, 50);
+
+  NoisyNeighborLevel& baseline = result.levels[0];
+  NoisyNeighborLevel& loaded = result.levels[1];
+  add_samples(baseline.victims[0], {100.0, 90.0, 110.0}, 0.0);
+  add_samples(baseline.victims[1], {60.0}, 0.0);
+  add_samples(loaded.victims[0], {150.0, 160.0, 140.0}, 40.0);
+  add_samples(loaded.victims[1], {30.0}, 42.0);
+  finalize_noisy_neighbor_result(result);
+
+  EXPECT_DOUBLE_EQ(baseline.victims[0].median_value, 100.0);
+  EXPECT_DOUBLE_EQ(loaded.victims[0].slowdown, 1.5);
+  EXPECT_DOUBLE_EQ(loaded.victims[0].median_aggressor_bandwidth_gb_s, 40.0);
+  EXPECT_DOUBLE_EQ(loaded.victims[1].slowdown, 2.0);
+  EXPECT_FALSE(loaded.victims[2].measured);
+  EXPECT_DOUBLE_EQ(loaded.victims[2].slowdown, 0.0);
+
+  const nlohmann::ordered_json json = build_noisy_neighbor_json(config, result, "Test CPU", 1.0);
+  EXPECT_EQ(json["mode"], Constants::NOISY_NEIGHBOR_JSON_MODE_NAME);
+  EXPECT_EQ(json["configuration"]["aggressor_threads"], 8);
+  EXPECT_EQ(json["configuration"]["aggressor_traffic"], "read");
+  ASSERT_EQ(json["levels"].size(), 2u);
+  EXPECT_TRUE(json["levels"][0]["victims"]["latency"]["slowdown"].is_null());
+  EXPECT_DOUBLE_EQ(json["levels"][1]["victims"]["latency"]["slowdown"].get<double>(), 1.5);
+  EXPECT_DOUBLE_EQ(
+      json["levels"][1]["victims"]["bandwidth"]["median_aggressor_bandwidth_gb_s"].get<double>(),
+      42.0);
+  EXPECT_FALSE(json["levels"][1]["victims"]["core_to_core"]["measured"].get<bool>());
+}
@@ -0,0 +1,167 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file test_partition_compare.cpp
+ * @brief Unit tests for partition-compare CLI parsing, layouts, and results
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "benchmark/partition_compare.h"
+#include "core/config/constants.h"
+
+namespace {
+
+int parse_with_args(const std::vector<std::string>& args, PartitionCompareConfig& config) {
+  std::vector<std::string> mutable_args = args;
+  std::vector<char*> argv;
+  argv.reserve(mutable_args.size());
+  for (std::string& arg : mutable_args) {
+    argv.push_back(arg.data());
+  }
+  testing::internal::CaptureStderr();
+  const int result =
+      parse_partition_compare_mode_arguments(static_cast<int>(argv.size()), argv.data(), config);
+  testing::internal::GetCapturedStderr();
+  return result;
+}
+
+// Every byte of [0, size) must be owned by exactly one worker.
+std::vector<int> coverage(const PartitionWorkerExtents& extents, size_t size) {
+  std::vector<int> owners(size, 0);
+  for (const std::vector<BenchmarkWorkerRange>& worker : extents) {
+    for (const BenchmarkWorkerRange& extent : worker) {
+      for (size_t byte = extent.offset_bytes; byte < extent.offset_bytes + extent.span_bytes;
+           ++byte) {
+        ++owners[byte];
+      }
+    }
+  }
+  return owners;
+}
+
+}  // namespace
+
+TEST(PartitionCompareCliTest, ParsesDefaultsGranulesAndRejectsForeignOptions) {
+  PartitionCompareConfig defaults;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "--partition-compare"}, defaults), EXIT_SUCCESS);
+  EXPECT_EQ(defaults.rounds, Constants::PARTITION_COMPARE_DEFAULT_ROUNDS);
+  EXPECT_EQ(defaults.buffer_size_mb, Constants::PARTITION_COMPARE_DEFAULT_BUFFER_SIZE_MB);
+  EXPECT_EQ(defaults.granules_kb, (std::vector<size_t>{4, 64, 2048}));
+
+  PartitionCompareConfig config;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-I", "-t", "6", "-b", "128", "--granule",
+                             "16,256", "-r", "2", "-o", "partition.json"},
+                            config),
+            EXIT_SUCCESS);
+  EXPECT_EQ(config.requested_threads, 6);
+  EXPECT_EQ(config.buffer_size_mb, 128UL);
+  EXPECT_EQ(config.granules_kb, (std::vector<size_t>{16, 256}));
+  EXPECT_EQ(config.rounds, 2);
+  EXPECT_EQ(config.output_file, "partition.json");
+
+  for (const char* granules : {"2", "4096", "48", "4,4", "4,", ""}) {
+    PartitionCompareConfig invalid;
+    EXPECT_EQ(parse_with_args({"memory_benchmark", "-I", "--granule", granules}, invalid),
+              EXIT_FAILURE)
+        << granules;
+  }
+  PartitionCompareConfig foreign;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-I", "--latency-samples", "4"}, foreign),
+            EXIT_FAILURE);
+}
+
+TEST(PartitionCompareLayoutTest, LayoutsCoverBufferOnceWithExpectedOwnership) {
+  const size_t size = 10 * 4096 + 100;
+  const PartitionWorkerExtents interleaved = build_interleaved_partition(size, 4096, 3);
+  ASSERT_EQ(interleaved.size(), 3u);
+  EXPECT_EQ(coverage(interleaved, size), std::vector<int>(size, 1));
+  ASSERT_EQ(interleaved[1].size(), 4u);
+  EXPECT_EQ(interleaved[1][1].offset_bytes, 4u * 4096);
+  EXPECT_EQ(interleaved[2].back().offset_bytes, 8u * 4096);
+  // The short tail granule lands on worker 10 % 3.
+  EXPECT_EQ(interleaved[1].back().span_bytes, 100u);
+
+  const PartitionWorkerExtents single = build_interleaved_partition(size, 4096, 1);
+  ASSERT_EQ(single.size(), 1u);
+  ASSERT_EQ(single[0].size(), 1u);
+  EXPECT_EQ(single[0][0].span_bytes, size);
+
+  const PartitionWorkerExtents random = build_random_partition(size, 4096, 3, 7);
+  ASSERT_EQ(random.size(), 3u);
+  EXPECT_EQ(coverage(random, size), std::vector<int>(size, 1));
+  for (const std::vector<BenchmarkWorkerRange>& worker : random) {
+    for (size_t index = 1; index < worker.size(); ++index) {
+      EXPECT_GT(worker[index].offset_bytes, worker[index - 1].offset_bytes);
+    }
+  }
+  const PartitionWorkerExtents same_seed = build_random_partition(size, 4096, 3, 7);
+  EXPECT_EQ(coverage(same_seed, size), coverage(random, size));
+  EXPECT_EQ(same_seed[0].front().offset_bytes, random[0].front().offset_bytes);
+
+  const PartitionWorkerExtents contiguous = partition_extents_from_boundaries({0, 64, 64, 200});
+  ASSERT_EQ(contiguous.size(), 3u);
+  EXPECT_TRUE(contiguous[1].empty());
+  EXPECT_EQ(contiguous[2][0].offset_bytes, 64u);
+  EXPECT_EQ(contiguous[2][0].span_bytes, 136u);
+
+  PartitionCompareRow row;
+  record_partition_balance(interleaved, row);
+  EXPECT_EQ(row.min_worker_bytes, 3u * 4096);
+  EXPECT_EQ(row.max_worker_bytes, 4u * 4096);
+
+  EXPECT_TRUE(build_interleaved_partition(size, 0, 3).empty());
+  EXPECT_TRUE(build_random_partition(0, 4096, 3, 7).empty());
+}
+
+TEST(PartitionCompareResultTest, ComparesMediansWithContiguousAndSerializes) {
+  PartitionCompareConfig config;
+  config.granules_kb = {4, 64};
+  PartitionCompareResult result = make_partition_compare_result(config, 8, 1024 * 1024);
+  ASSERT_EQ(result.rows.size(), 5u);
+  EXPECT_EQ(result.rows[0].strategy, PartitionStrategy::Contiguous);
+  EXPECT_EQ(result.rows[1].strategy, PartitionStrategy::Interleaved);
+  EXPECT_EQ(result.rows[1].granule_bytes, 4096u);
+  EXPECT_EQ(result.rows[4].strategy, PartitionStrategy::Random);
+  EXPECT_EQ(result.rows[4].granule_bytes, 65536u);
+
+  result.rows[0].samples_gb_s[0] = {100.0, 90.0, 110.0};
+  result.rows[1].samples_gb_s[0] = {104.0, 106.0, 105.0};
+  result.rows[2].samples_gb_s[0] = {95.0};
+  finalize_partition_compare_result(result);
+  EXPECT_DOUBLE_EQ(result.rows[0].median_gb_s[0], 100.0);
+  EXPECT_NEAR(result.rows[1].vs_contiguous_pct[0], 5.0, 1e-9);
+  EXPECT_NEAR(result.rows[2].vs_contiguous_pct[0], -5.0, 1e-9);
+  EXPECT_DOUBLE_EQ(result.rows[3].vs_contiguous_pct[0], 0.0);
+
+  const nlohmann::ordered_json json = build_partition_compare_json(config, result, "cpu", 1.5);
+  EXPECT_EQ(json["mode"], Constants::PARTITION_COMPARE_JSON_MODE_NAME);
+  EXPECT_EQ(json["configuration"]["threads"], 8);
+  ASSERT_EQ(json["layouts"].size(), 5u);
+  EXPECT_TRUE(json["layouts"][0]["granule_bytes"].is_null());
+  EXPECT_TRUE(json["layouts"][0]["operations"]["read"]["vs_contiguous_pct"].is_null());
+  EXPECT_EQ(json["layouts"][1]["strategy"], "interleaved");
+  EXPECT_NEAR(json["layouts"][1]["operations"]["read"]["vs_contiguous_pct"].get<double>(), 5.0,
+              1e-9);
+  EXPECT_EQ(json["layouts"][1]["operations"]["read"]["rounds_gb_s"].size(), 3u);
+  EXPECT_TRUE(json["layouts"][3]["operations"]["write"]["vs_contiguous_pct"].is_null());
+}
@@ -260,10 +260,14 @@ unsigned char* align_to_cache_line(unsigned char* pointer) {
 }
 
 void expect_core_pattern_bandwidths_positive(const PatternResults& results) {
-  const std::array<PatternKind, 6> core_kinds = {
+  const std::array<PatternKind, 14> core_kinds = {
       PatternKind::SequentialForward, PatternKind::SequentialReverse,
       PatternKind::Strided64, PatternKind::Strided4096,
-      PatternKind::Strided16384, PatternKind::Random};
+      PatternKind::Strided16384, PatternKind::Random,
+      PatternKind::GatherScatterScalar, PatternKind::GatherScatterNeon,
+      PatternKind::SkewedZipf, PatternKind::SkewedHotCold,
+      PatternKind::SkewedShiftingHotSet, PatternKind::MatrixRowMajor,
+      PatternKind::MatrixColumnMajor, PatternKind::MatrixTiled};
   for (PatternKind kind : core_kinds) {
     for (PatternOperation operation : {PatternOperation::Read,
                                        PatternOperation::Write,
@@ -277,6 +281,15 @@ void expect_core_pattern_bandwidths_positive(const PatternResults& results) {
       EXPECT_GT(measurement.total_payload_bytes, 0u);
     }
   }
+  const PatternMeasurement& transpose = get_pattern_measurement(
+      results, PatternKind::MatrixTranspose, PatternOperation::Copy);
+  EXPECT_EQ(transpose.status, PatternMeasurementStatus::Measured);
+  ASSERT_TRUE(transpose.bandwidth_gb_s.has_value());
+  EXPECT_GT(*transpose.bandwidth_gb_s, 0.0);
+  EXPECT_EQ(get_pattern_measurement(results, PatternKind::MatrixTranspose,
+                                    PatternOperation::Read)
+                .status,
+            PatternMeasurementStatus::Skipped);
 }
 
 void expect_2mb_pattern_bandwidths_zero(const PatternResults& results) {
@@ -344,8 +357,8 @@ TEST(PatternBenchmarkTest, LoopSummaryAcceptsMeasuredValuesAndSkippedMeasurement
   const PatternLoopSummary summary = summarize_pattern_loop(results);
   EXPECT_EQ(summary.status, PatternRunStatus::Complete);
   EXPECT_TRUE(summary.status_reason.empty());
-  EXPECT_EQ(summary.planned_measurements, 21u);
-  EXPECT_EQ(summary.completed_measurements, 21u);
+  EXPECT_EQ(summary.planned_measurements, 48u);
+  EXPECT_EQ(summary.completed_measurements, 48u);
 }
 
 TEST(PatternBenchmarkTest, LoopSummaryClassifiesIncompleteInterruptedInvalidAndExecutionFailure) {
@@ -379,7 +392,7 @@ TEST(PatternBenchmarkTest, CompleteLoopWinsLateInterruptionFlag) {
   const PatternLoopSummary summary =
       summarize_pattern_loop(make_complete_pattern_loop(), false, true);
   EXPECT_EQ(summary.status, PatternRunStatus::Complete);
-  EXPECT_EQ(summary.completed_measurements, 21u);
+  EXPECT_EQ(summary.completed_measurements, 48u);
 }
 
 TEST(PatternBenchmarkTest, CollectorSumsExactCompletionCounters) {
@@ -390,15 +403,15 @@ TEST(PatternBenchmarkTest, CollectorSumsExactCompletionCounters) {
   EXPECT_EQ(statistics.status, PatternRunStatus::Partial);
   EXPECT_EQ(statistics.planned_loops, 2u);
   EXPECT_EQ(statistics.completed_loops, 1u);
-  EXPECT_EQ(statistics.planned_measurements, 42u);
-  EXPECT_EQ(statistics.completed_measurements, 21u);
+  EXPECT_EQ(statistics.planned_measurements, 96u);
+  EXPECT_EQ(statistics.completed_measurements, 48u);
 
   PatternResults partial = make_complete_pattern_loop();
   partial.measurements.back().bandwidth_gb_s.reset();
   collect_pattern_loop_result(statistics, std::move(partial));
   EXPECT_EQ(statistics.status, PatternRunStatus::Partial);
   EXPECT_EQ(statistics.completed_loops, 1u);
-  EXPECT_EQ(statistics.completed_measurements, 41u);
+  EXPECT_EQ(statistics.completed_measurements, 95u);
   ASSERT_EQ(statistics.loop_results.size(), 2u);
   EXPECT_EQ(statistics.loop_results[1].status, PatternRunStatus::Partial);
 }
@@ -416,8 +429,8 @@ TEST(PatternBenchmarkTest, LaterCompleteLoopPreservesEarlierPartialReason) {
   EXPECT_EQ(statistics.status_reason, partial_reason);
   EXPECT_EQ(statistics.completed_loops, 1u);
   EXPECT_EQ(statistics.planned_loops, 2u);
-  EXPECT_EQ(statistics.completed_measurements, 41u);
-  EXPECT_EQ(statistics.planned_measurements, 42u);
+  EXPECT_EQ(statistics.completed_measurements, 95u);
+  EXPECT_EQ(statistics.planned_measurements, 96u);
 }
 
 TEST(PatternBenchmarkTest, CoordinatorReportsBufferPreparationFailuresWithPlannedCounts) {
@@ -437,7 +450,7 @@ TEST(PatternBenchmarkTest, CoordinatorReportsBufferPreparationFailuresWithPlanne
             Messages::pattern_reason_buffers_allocation_failed());
   EXPECT_EQ(statistics.planned_loops, 2u);
   EXPECT_EQ(statistics.completed_loops, 0u);
-  EXPECT_EQ(statistics.planned_measurements, 42u);
+  EXPECT_EQ(statistics.planned_measurements, 96u);
   EXPECT_EQ(statistics.completed_measurements, 0u);
   EXPECT_TRUE(statistics.loop_results.empty());
 
@@ -450,7 +463,7 @@ TEST(PatternBenchmarkTest, CoordinatorReportsBufferPreparationFailuresWithPlanne
   EXPECT_EQ(statistics.status, PatternRunStatus::Failed);
   EXPECT_EQ(statistics.status_reason,
             Messages::pattern_reason_buffers_initialization_failed());
-  EXPECT_EQ(statistics.planned_measurements, 42u);
+  EXPECT_EQ(statistics.planned_measurements, 96u);
   EXPECT_EQ(statistics.completed_measurements, 0u);
   EXPECT_TRUE(statistics.loop_results.empty());
 }
@@ -475,7 +488,7 @@ TEST(PatternBenchmarkTest, CoordinatorStopsBeforeFirstLoopWithPlannedCounts) {
             Messages::pattern_reason_loop_interrupted());
   EXPECT_EQ(statistics.planned_loops, 2u);
   EXPECT_EQ(statistics.completed_loops, 0u);
-  EXPECT_EQ(statistics.planned_measurements, 42u);
+  EXPECT_EQ(statistics.planned_measurements, 96u);
   EXPECT_EQ(statistics.completed_measurements, 0u);
   EXPECT_TRUE(statistics.loop_results.empty());
 }
@@ -532,7 +545,7 @@ TEST(PatternBenchmarkTest, CoordinatorContainsPreparationHookExceptions) {
       statistics.status_reason,
       Messages::pattern_reason_coordinator_exception(
           "allocation hook exception"));
-  EXPECT_EQ(statistics.planned_measurements, 42u);
+  EXPECT_EQ(statistics.planned_measurements, 96u);
   EXPECT_TRUE(statistics.loop_results.empty());
 
   hooks = make_pattern_runner_hooks();
@@ -545,7 +558,7 @@ TEST(PatternBenchmarkTest, CoordinatorContainsPreparationHookExceptions) {
   (void)testing::internal::GetCapturedStderr();
   EXPECT_EQ(statistics.status_reason,
             Messages::pattern_reason_unknown_coordinator_exception());
-  EXPECT_EQ(statistics.planned_measurements, 42u);
+  EXPECT_EQ(statistics.planned_measurements, 96u);
   EXPECT_TRUE(statistics.loop_results.empty());
 }
 
@@ -567,7 +580,7 @@ TEST(PatternBenchmarkTest, CoordinatorPreservesFailedAndPartialLoopEvidence) {
   EXPECT_EQ(statistics.status, PatternRunStatus::Failed);
   EXPECT_EQ(statistics.loop_results[0].status, PatternRunStatus::Failed);
   EXPECT_EQ(statistics.completed_loops, 0u);
-  EXPECT_EQ(statistics.completed_measurements, 21u);
+  EXPECT_EQ(statistics.completed_measurements, 48u);
 
   PatternRunnerTestHooks partial = make_pattern_runner_hooks();
   partial.execute_loop = [](const PatternBuffers&, const BenchmarkConfig&,
@@ -648,8 +661,8 @@ TEST(PatternBenchmarkTest, FailedLoopEvidenceIsExcludedFromJsonAggregate) {
   EXPECT_EQ(output["status"], "failed");
   EXPECT_EQ(output["completed_loops"], 1u);
   EXPECT_EQ(output["planned_loops"], 2u);
-  EXPECT_EQ(output["completed_measurements"], 41u);
-  EXPECT_EQ(output["planned_measurements"], 42u);
+  EXPECT_EQ(output["completed_measurements"], 95u);
+  EXPECT_EQ(output["planned_measurements"], 96u);
   EXPECT_FALSE(output["results_complete"].get<bool>());
   const nlohmann::ordered_json& read =
       output[JsonKeys::PATTERNS][JsonKeys::SEQUENTIAL_FORWARD]
@@ -713,13 +726,13 @@ TEST(PatternBenchmarkTest, OneShotLateStopInterruptsOnlyWhenLoopsRemain) {
   const PatternStatistics unfinished = run_with_loop_count(2);
   EXPECT_EQ(unfinished.status, PatternRunStatus::Interrupted);
   EXPECT_EQ(unfinished.completed_loops, 1u);
-  EXPECT_EQ(unfinished.completed_measurements, 21u);
+  EXPECT_EQ(unfinished.completed_measurements, 48u);
 
   const PatternStatistics finished = run_with_loop_count(1);
   EXPECT_EQ(finished.status, PatternRunStatus::Complete);
   EXPECT_TRUE(finished.status_reason.empty());
   EXPECT_EQ(finished.completed_loops, 1u);
-  EXPECT_EQ(finished.completed_measurements, 21u);
+  EXPECT_EQ(finished.completed_measurements, 48u);
 }
 
 TEST(PatternBenchmarkTest, ExecutionOrderIsDeterministicAndRotatesAcrossLoops) {
@@ -772,6 +785,13 @@ TEST(PatternBenchmarkTest, RunPatternBenchmarksCorePatternsIntegration) {
   EXPECT_EQ(random_read.status, PatternMeasurementStatus::Measured);
   EXPECT_TRUE(random_read.has_seed);
   EXPECT_EQ(random_read.seed, config.pattern_seed);
+  const PatternMeasurement& zipf_read = get_pattern_measurement(
+      results, PatternKind::SkewedZipf, PatternOperation::Read);
+  ASSERT_TRUE(zipf_read.skew_parameters.has_value());
+  EXPECT_LT(zipf_read.distinct_address_count, zipf_read.accesses_per_pass);
+  ASSERT_TRUE(zipf_read.l1_hit_ratio_proxy.has_value());
+  ASSERT_TRUE(zipf_read.l2_hit_ratio_proxy.has_value());
+  EXPECT_LE(*zipf_read.l1_hit_ratio_proxy, *zipf_read.l2_hit_ratio_proxy);
 }
 
 TEST(PatternBenchmarkTest, Strided2MiBRouteAndKernelIntegration) {
@@ -947,6 +967,74 @@ TEST(PatternBenchmarkTest, RandomWarmupUsesChunkRelativeWorkerOffsetsIntegration
   }
 }
 
+TEST(PatternBenchmarkTest, GatherScatterNeonKernelsMatchScalarBaselineIntegration) {
+  constexpr size_t buffer_size = 1024;
+  std::vector<uint64_t> source(buffer_size / sizeof(uint64_t));
+  for (size_t element = 0; element < source.size(); ++element) {
+    source[element] = 0x9e3779b97f4a7c15ULL * (element + 1);
+  }
+  const std::vector<size_t> indices = {
+      992, 0, 480, 64, 256, 736, 32, 512, 128, 960, 608, 288, 96, 832, 416, 704};
+
+  const uint64_t scalar_checksum =
+      memory_gather_scalar_loop_asm(source.data(), indices.data(), indices.size());
+  uint64_t expected_checksum = 0;
+  for (size_t offset : indices) expected_checksum ^= source[offset / sizeof(uint64_t)];
+  EXPECT_EQ(scalar_checksum, expected_checksum);
+  EXPECT_EQ(memory_gather_neon_loop_asm(source.data(), indices.data(), indices.size()),
+            scalar_checksum);
+
+  for (auto scatter : {memory_scatter_scalar_loop_asm, memory_scatter_neon_loop_asm}) {
+    std::vector<uint64_t> destination(source.size(), ~0ULL);
+    scatter(destination.data(), indices.data(), indices.size());
+    for (size_t element = 0; element < destination.size(); ++element) {
+      const bool selected =
+          std::find(indices.begin(), indices.end(), element * sizeof(uint64_t)) !=
+          indices.end();
+      EXPECT_EQ(destination[element], selected ? 0u : ~0ULL) << "element=" << element;
+    }
+  }
+
+  for (auto gather_scatter : {memory_gather_scatter_scalar_loop_asm,
+                              memory_gather_scatter_neon_loop_asm}) {
+    std::vector<uint64_t> destination(source.size(), 0);
+    gather_scatter(destination.data(), source.data(), indices.data(), indices.size());
+    for (size_t element = 0; element < destination.size(); ++element) {
+      const bool selected =
+          std::find(indices.begin(), indices.end(), element * sizeof(uint64_t)) !=
+          indices.end();
+      EXPECT_EQ(destination[element], selected ? source[element] : 0u)
+          << "element=" << element;
+    }
+  }
+}
+
+TEST(PatternBenchmarkTest, GatherScatterKernelsPreserveAapcs64RegistersIntegration) {
+  std::vector<uint64_t> source(64, 0xA5A5A5A5A5A5A5A5ULL);
+  std::vector<uint64_t> destination(64, 0);
+  const std::vector<size_t> indices = {0, 8, 16, 24, 32, 40, 48, 56};
+  const uintptr_t src = reinterpret_cast<uintptr_t>(source.data());
+  const uintptr_t dst = reinterpret_cast<uintptr_t>(destination.data());
+  const uintptr_t index_data = reinterpret_cast<uintptr_t>(indices.data());
+
+  for (uintptr_t kernel : {reinterpret_cast<uintptr_t>(&memory_gather_scalar_loop_asm),
+                           reinterpret_cast<uintptr_t>(&memory_gather_neon_loop_asm)}) {
+    EXPECT_EQ(verify_pattern_callee_saved_registers_asm(kernel, src, index_data, 8, 0, 0, 0),
+              1u);
+  }
+  for (uintptr_t kernel : {reinterpret_cast<uintptr_t>(&memory_scatter_scalar_loop_asm),
+                           reinterpret_cast<uintptr_t>(&memory_scatter_neon_loop_asm)}) {
+    EXPECT_EQ(verify_pattern_callee_saved_registers_asm(kernel, dst, index_data, 8, 0, 0, 0),
+              1u);
+  }
+  for (uintptr_t kernel :
+       {reinterpret_cast<uintptr_t>(&memory_gather_scatter_scalar_loop_asm),
+        reinterpret_cast<uintptr_t>(&memory_gather_scatter_neon_loop_asm)}) {
+    EXPECT_EQ(verify_pattern_callee_saved_registers_asm(kernel, dst, src, index_data, 8, 0, 0),
+              1u);
+  }
+}
+
 TEST(PatternBenchmarkTest, PhasedStridedKernelsPreserveAapcs64RegistersIntegration) {
   const std::vector<size_t> strides = {
       Constants::PATTERN_STRIDE_CACHE_LINE,
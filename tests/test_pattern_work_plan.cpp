@@ -15,7 +15,9 @@
 //
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <limits>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "core/config/constants.h"
@@ -152,6 +154,55 @@ TEST(PatternWorkPlanTest, RejectsInvalidRandomPartitionParameters) {
   EXPECT_TRUE(build_random_worker_indices(16, 32, 1, indices).empty());
 }
 
+TEST(PatternWorkPlanTest, GatherPlanUsesWholeGroupsAndElementPayload) {
+  std::vector<PatternRandomWorkerIndices> workers(2);
+  workers[0].offset_bytes = 0;
+  workers[0].span_bytes = 1024;
+  workers[0].indices.assign(19, 0);
+  workers[1].offset_bytes = 1024;
+  workers[1].span_bytes = 1024;
+  workers[1].indices.assign(8, 32);
+
+  const PatternWorkPlan plan = build_gather_pattern_work_plan(
+      workers, Constants::PATTERN_GATHER_ELEMENT_BYTES,
+      Constants::PATTERN_GATHER_GROUP_INDICES, 4);
+
+  ASSERT_EQ(plan.status, PatternMeasurementStatus::Measured);
+  EXPECT_EQ(plan.access_size_bytes, 8u);
+  EXPECT_EQ(plan.indices_per_group, 8u);
+  EXPECT_EQ(plan.requested_threads, 4);
+  EXPECT_EQ(plan.effective_threads, 2);
+  ASSERT_EQ(plan.workers.size(), 2u);
+  EXPECT_EQ(plan.workers[0].accesses_per_pass, 16u);
+  EXPECT_EQ(plan.workers[0].payload_bytes_per_pass, 128u);
+  EXPECT_EQ(plan.workers[1].accesses_per_pass, 8u);
+  EXPECT_EQ(plan.accesses_per_pass, 24u);
+  EXPECT_EQ(plan.payload_bytes_per_pass, 192u);
+  EXPECT_EQ(plan.min_accesses_per_pass, 8u);
+  EXPECT_EQ(plan.max_accesses_per_pass, 16u);
+}
+
+TEST(PatternWorkPlanTest, GatherPlanSkipsWorkerWithoutFullGroup) {
+  std::vector<PatternRandomWorkerIndices> workers(2);
+  workers[0].span_bytes = 1024;
+  workers[0].indices.assign(8, 0);
+  workers[1].offset_bytes = 1024;
+  workers[1].span_bytes = 1024;
+  workers[1].indices.assign(7, 0);
+
+  const PatternWorkPlan skipped = build_gather_pattern_work_plan(workers, 8, 8, 2);
+  EXPECT_EQ(skipped.status, PatternMeasurementStatus::Skipped);
+  EXPECT_FALSE(skipped.status_reason.empty());
+  EXPECT_TRUE(skipped.workers.empty());
+
+  EXPECT_EQ(build_gather_pattern_work_plan(workers, 0, 8, 2).status,
+            PatternMeasurementStatus::Invalid);
+  EXPECT_EQ(build_gather_pattern_work_plan(workers, 8, 8, 1).status,
+            PatternMeasurementStatus::Invalid);
+  EXPECT_EQ(build_gather_pattern_work_plan({}, 8, 8, 1).status,
+            PatternMeasurementStatus::Invalid);
+}
+
 TEST(PatternWorkPlanTest, RotatesPhaseAndCountsEveryAccessExactly) {
   PatternWorkPlan plan =
       build_plan(Constants::PATTERN_STRIDE_CACHE_LINE +
@@ -216,3 +267,182 @@ TEST(PatternWorkPlanTest, RandomPermutationCapsAtAvailableAlignedSlots) {
   EXPECT_EQ(indices.size(), 3u);
   EXPECT_EQ(std::unordered_set<size_t>(indices.begin(), indices.end()).size(), 3u);
 }
+
+TEST(PatternWorkPlanTest, SkewedStreamsAreSeededAlignedAndBounded) {
+  PatternSkewParameters parameters;
+  parameters.zipf_theta = 0.99;
+  parameters.hot_fraction = 0.1;
+  parameters.hot_probability = 0.9;
+  const size_t buffer_size = 64 * 1024;
+  for (PatternSkewDistribution distribution :
+       {PatternSkewDistribution::Zipf, PatternSkewDistribution::HotCold}) {
+    const std::vector<size_t> first =
+        generate_skewed_indices(distribution, buffer_size, 5000, parameters, 42);
+    ASSERT_EQ(first.size(), 5000u);
+    EXPECT_EQ(first, generate_skewed_indices(distribution, buffer_size, 5000, parameters, 42));
+    EXPECT_NE(first, generate_skewed_indices(distribution, buffer_size, 5000, parameters, 43));
+    for (size_t offset : first) {
+      EXPECT_EQ(offset % Constants::PATTERN_ACCESS_SIZE_BYTES, 0u);
+      EXPECT_LE(offset + Constants::PATTERN_ACCESS_SIZE_BYTES, buffer_size);
+    }
+  }
+}
+
+TEST(PatternWorkPlanTest, SkewedStreamsRejectInvalidParameters) {
+  PatternSkewParameters parameters;
+  EXPECT_TRUE(generate_skewed_indices(PatternSkewDistribution::Zipf, 4096, 100,
+                                      parameters, 1)
+                  .empty());
+  parameters.hot_fraction = 1.0;
+  parameters.hot_probability = 0.5;
+  EXPECT_TRUE(generate_skewed_indices(PatternSkewDistribution::HotCold, 4096, 100,
+                                      parameters, 1)
+                  .empty());
+}
+
+TEST(PatternWorkPlanTest, ZipfConcentratesAccessesOnPopularSlots) {
+  PatternSkewParameters parameters;
+  parameters.zipf_theta = 0.99;
+  const size_t slot_count = 1u << 15;
+  const std::vector<size_t> indices = generate_skewed_indices(
+      PatternSkewDistribution::Zipf, slot_count * Constants::PATTERN_ACCESS_SIZE_BYTES,
+      100000, parameters, 7);
+
+  std::unordered_map<size_t, size_t> counts;
+  for (size_t offset : indices) ++counts[offset];
+  size_t top = 0;
+  for (const auto& entry : counts) top = std::max(top, entry.second);
+  // Rank one carries 1/H(n, 0.99), about 9% of a 32K-slot Zipf stream.
+  EXPECT_GT(top, 7000u);
+  EXPECT_LT(top, 11000u);
+  EXPECT_LT(counts.size(), slot_count);
+}
+
+TEST(PatternWorkPlanTest, HotColdHonorsHotProbabilityAndShiftingMovesHotSet) {
+  PatternSkewParameters parameters;
+  parameters.hot_fraction = 0.05;
+  parameters.hot_probability = 0.8;
+  parameters.phases = 4;
+  const size_t buffer_size = 4096 * Constants::PATTERN_ACCESS_SIZE_BYTES;
+  const size_t accesses = 40000;
+  const std::vector<size_t> indices = generate_skewed_indices(
+      PatternSkewDistribution::ShiftingHotSet, buffer_size, accesses, parameters, 11);
+  ASSERT_EQ(indices.size(), accesses);
+
+  // The hot set holds 205 slots; its slots dominate each phase's counts.
+  const size_t phase_length = accesses / parameters.phases;
+  std::vector<std::unordered_set<size_t>> hot_sets;
+  for (size_t phase = 0; phase < parameters.phases; ++phase) {
+    std::unordered_map<size_t, size_t> counts;
+    for (size_t i = phase * phase_length; i < (phase + 1) * phase_length; ++i) {
+      ++counts[indices[i]];
+    }
+    std::vector<std::pair<size_t, size_t>> ranked(counts.begin(), counts.end());
+    std::sort(ranked.begin(), ranked.end(),
+              [](const auto& a, const auto& b) { return a.second > b.second; });
+    std::unordered_set<size_t> hot;
+    size_t hot_hits = 0;
+    for (size_t i = 0; i < 205 && i < ranked.size(); ++i) {
+      hot.insert(ranked[i].first);
+      hot_hits += ranked[i].second;
+    }
+    EXPECT_NEAR(static_cast<double>(hot_hits) / phase_length, 0.8, 0.03);
+    hot_sets.push_back(std::move(hot));
+  }
+  size_t shared = 0;
+  for (size_t slot : hot_sets[0]) shared += hot_sets[1].count(slot);
+  EXPECT_LT(shared, 10u);
+
+  // A per-phase proxy sees the moving hot set; a whole-stream proxy does not.
+  const size_t hot_bytes = 205 * Constants::CACHE_LINE_SIZE_BYTES;
+  const double per_phase = calculate_pattern_hit_ratio_proxy(
+      indices, hot_bytes, Constants::CACHE_LINE_SIZE_BYTES, parameters.phases);
+  const double whole = calculate_pattern_hit_ratio_proxy(
+      indices, hot_bytes, Constants::CACHE_LINE_SIZE_BYTES, 1);
+  EXPECT_GT(per_phase, whole + 0.3);
+}
+
+TEST(PatternWorkPlanTest, HitRatioProxyPinsMostFrequentLines) {
+  const std::vector<size_t> indices = {0, 0, 0, 64, 64, 128, 192, 200};
+  EXPECT_DOUBLE_EQ(calculate_pattern_hit_ratio_proxy(indices, 64, 64), 3.0 / 8.0);
+  // 192 and 200 share one line, tying the 64 line at two accesses.
+  EXPECT_DOUBLE_EQ(calculate_pattern_hit_ratio_proxy(indices, 128, 64), 5.0 / 8.0);
+  EXPECT_DOUBLE_EQ(calculate_pattern_hit_ratio_proxy(indices, 4096, 64), 1.0);
+  EXPECT_DOUBLE_EQ(calculate_pattern_hit_ratio_proxy(indices, 0, 64), 0.0);
+  EXPECT_DOUBLE_EQ(calculate_pattern_hit_ratio_proxy({}, 4096, 64), 0.0);
+  // Two phases of four: {0,0,0,64} and {64,128,192,200}.
+  EXPECT_DOUBLE_EQ(calculate_pattern_hit_ratio_proxy(indices, 64, 64, 2),
+                   (3.0 / 4.0 + 2.0 / 4.0) / 2.0);
+}
+
+TEST(PatternWorkPlanTest, MatrixPlansSplitWholeRowAndTileBands) {
+  // 1 MiB at a 4160-byte pitch holds 252 rows; 16-element tiles keep 240.
+  const size_t buffer_size = 1024 * 1024;
+  const PatternWorkPlan rows = build_matrix_pattern_work_plan(
+      buffer_size, 4096, 4160, 16, PatternMatrixLayout::RowMajor, 7);
+  ASSERT_EQ(rows.status, PatternMeasurementStatus::Measured);
+  EXPECT_EQ(rows.matrix_shape.rows, 240u);
+  EXPECT_EQ(rows.stride_bytes, 4160u);
+  EXPECT_EQ(rows.access_size_bytes, Constants::PATTERN_ACCESS_SIZE_BYTES);
+  EXPECT_EQ(rows.effective_threads, 7);
+  EXPECT_EQ(rows.payload_bytes_per_pass, 240u * 4096u);
+  EXPECT_EQ(rows.logical_working_set_bytes, 240u * 4096u);
+  EXPECT_EQ(rows.accesses_per_pass, 240u * 4096u / Constants::PATTERN_ACCESS_SIZE_BYTES);
+  size_t expected_offset = 0;
+  for (const PatternWorkerRange& worker : rows.workers) {
+    EXPECT_EQ(worker.offset_bytes, expected_offset);
+    EXPECT_EQ(worker.span_bytes % 4160u, 0u);
+    EXPECT_EQ(worker.payload_bytes_per_pass, worker.span_bytes / 4160u * 4096u);
+    expected_offset += worker.span_bytes;
+  }
+  EXPECT_EQ(expected_offset, 240u * 4160u);
+  EXPECT_LE(rows.max_accesses_per_pass - rows.min_accesses_per_pass, 4096u / 32u);
+
+  // Tile-row bands: 15 bands of 16 rows cap the workers and stay tile aligned.
+  const PatternWorkPlan tiles = build_matrix_pattern_work_plan(
+      buffer_size, 4096, 4160, 16, PatternMatrixLayout::Tiled, 64);
+  ASSERT_EQ(tiles.status, PatternMeasurementStatus::Measured);
+  EXPECT_EQ(tiles.effective_threads, 15);
+  for (const PatternWorkerRange& worker : tiles.workers) {
+    EXPECT_EQ(worker.span_bytes, 16u * 4160u);
+  }
+  EXPECT_EQ(tiles.payload_bytes_per_pass, rows.payload_bytes_per_pass);
+
+  // Column-major keeps two rows per worker; transpose counts 8-byte elements.
+  const PatternWorkPlan columns = build_matrix_pattern_work_plan(
+      buffer_size, 4096, 4160, 16, PatternMatrixLayout::ColumnMajor, 1000);
+  ASSERT_EQ(columns.status, PatternMeasurementStatus::Measured);
+  EXPECT_EQ(columns.effective_threads, 120);
+  const PatternWorkPlan transpose = build_matrix_pattern_work_plan(
+      buffer_size, 4096, 4160, 16, PatternMatrixLayout::Transpose, 2);
+  ASSERT_EQ(transpose.status, PatternMeasurementStatus::Measured);
+  EXPECT_EQ(transpose.access_size_bytes, Constants::PATTERN_MATRIX_ELEMENT_BYTES);
+  EXPECT_EQ(transpose.accesses_per_pass, 240u * 512u);
+}
+
+TEST(PatternWorkPlanTest, MatrixPlansRejectInvalidShapesAndSkipTinyBuffers) {
+  // Row bytes not a whole number of tiles, pitch below the row, unaligned pitch,
+  // and a tile edge that is not a multiple of four elements.
+  EXPECT_EQ(build_matrix_pattern_work_plan(1 << 20, 4000, 4096, 16,
+                                           PatternMatrixLayout::RowMajor, 1)
+                .status,
+            PatternMeasurementStatus::Invalid);
+  EXPECT_EQ(build_matrix_pattern_work_plan(1 << 20, 4096, 2048, 16,
+                                           PatternMatrixLayout::RowMajor, 1)
+                .status,
+            PatternMeasurementStatus::Invalid);
+  EXPECT_EQ(build_matrix_pattern_work_plan(1 << 20, 4096, 4100, 16,
+                                           PatternMatrixLayout::RowMajor, 1)
+                .status,
+            PatternMeasurementStatus::Invalid);
+  EXPECT_EQ(build_matrix_pattern_work_plan(1 << 20, 4096, 4096, 6,
+                                           PatternMatrixLayout::Tiled, 1)
+                .status,
+            PatternMeasurementStatus::Invalid);
+
+  const PatternWorkPlan tiny = build_matrix_pattern_work_plan(
+      15 * 4096, 4096, 4096, 16, PatternMatrixLayout::Tiled, 4);
+  EXPECT_EQ(tiny.status, PatternMeasurementStatus::Skipped);
+  EXPECT_TRUE(tiny.workers.empty());
+  EXPECT_EQ(tiny.matrix_shape.pitch_bytes, 4096u);
+}
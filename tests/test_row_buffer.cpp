@@ -0,0 +1,169 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file test_row_buffer.cpp
+ * @brief Unit tests for row-buffer CLI parsing, clustering, and bank functions
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <bitset>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/row_buffer.h"
+#include "core/config/constants.h"
+
+namespace {
+
+constexpr size_t kPageBytes = 16384;
+constexpr uint64_t kPhysicalBase = 0x80000000ULL;
+constexpr uint64_t kBankFunctionA = (1ULL << 14) | (1ULL << 17);
+constexpr uint64_t kBankFunctionB = (1ULL << 15) | (1ULL << 18);
+
+int parse_with_args(const std::vector<std::string>& args, RowBufferConfig& config) {
+  std::vector<std::string> mutable_args = args;
+  std::vector<char*> argv;
+  argv.reserve(mutable_args.size());
+  for (std::string& arg : mutable_args) {
+    argv.push_back(arg.data());
+  }
+  testing::internal::CaptureStderr();
+  const int result =
+      parse_row_buffer_mode_arguments(static_cast<int>(argv.size()), argv.data(), config);
+  testing::internal::GetCapturedStderr();
+  return result;
+}
+
+bool same_bank(uint64_t a, uint64_t b) {
+  const uint64_t difference = a ^ b;
+  return std::bitset<64>(difference & kBankFunctionA).count() % 2 == 0 &&
+         std::bitset<64>(difference & kBankFunctionB).count() % 2 == 0;
+}
+
+}  // namespace
+
+TEST(RowBufferCliTest, ParsesDefaultsAndRejectsForeignOptions) {
+  RowBufferConfig defaults;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "--row-buffer"}, defaults), EXIT_SUCCESS);
+  EXPECT_EQ(defaults.buffer_size_mb, Constants::ROW_BUFFER_DEFAULT_BUFFER_SIZE_MB);
+  EXPECT_EQ(defaults.iterations, Constants::ROW_BUFFER_DEFAULT_ITERATIONS);
+  EXPECT_EQ(defaults.pairs, Constants::ROW_BUFFER_DEFAULT_PAIRS);
+  EXPECT_EQ(defaults.rounds, Constants::ROW_BUFFER_DEFAULT_ROUNDS);
+
+  RowBufferConfig config;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-Q", "-b", "64", "-i", "50", "--row-pairs",
+                             "128", "-r", "2", "-o", "rows.json"},
+                            config),
+            EXIT_SUCCESS);
+  EXPECT_EQ(config.buffer_size_mb, 64u);
+  EXPECT_EQ(config.iterations, 50);
+  EXPECT_EQ(config.pairs, 128);
+  EXPECT_EQ(config.rounds, 2);
+  EXPECT_EQ(config.output_file, "rows.json");
+
+  for (const char* pairs : {"0", "3", "65537"}) {
+    RowBufferConfig invalid;
+    EXPECT_EQ(parse_with_args({"memory_benchmark", "-Q", "--row-pairs", pairs}, invalid),
+              EXIT_FAILURE)
+        << pairs;
+  }
+  RowBufferConfig foreign;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-Q", "--threads", "2"}, foreign),
+            EXIT_FAILURE);
+}
+
+TEST(RowBufferAnalysisTest, ClustersLatenciesAndInfersXorBankFunctions) {
+  const std::vector<double> latencies = {60.0, 61.0, 59.5, 90.0, 60.5, 91.0, 89.5, 60.0};
+  const RowBufferClusters clusters = cluster_row_buffer_latencies(latencies);
+  EXPECT_TRUE(clusters.separated);
+  EXPECT_EQ(clusters.high_count, 3u);
+  EXPECT_NEAR(clusters.low_center_ns, 60.2, 0.01);
+  EXPECT_NEAR(clusters.high_center_ns, 90.17, 0.01);
+  EXPECT_FALSE(cluster_row_buffer_latencies({60.0, 60.5, 61.0, 61.5, 62.0}).separated);
+  EXPECT_FALSE(cluster_row_buffer_latencies({60.0, 90.0}).separated);
+
+  const std::vector<size_t> pages = build_row_buffer_pair_pages(64, 100, 7);
+  EXPECT_EQ(pages.size(), 63u);
+  EXPECT_EQ(std::count(pages.begin(), pages.end(), size_t{0}), 0);
+  EXPECT_EQ(pages, build_row_buffer_pair_pages(64, 100, 7));
+
+  std::vector<std::pair<uint64_t, uint64_t>> same;
+  std::vector<std::pair<uint64_t, uint64_t>> other;
+  for (uint64_t page = 1; page < 512; ++page) {
+    const uint64_t address = kPhysicalBase + page * kPageBytes;
+    (same_bank(kPhysicalBase, address) ? same : other).emplace_back(kPhysicalBase, address);
+  }
+  EXPECT_EQ(infer_row_buffer_bank_functions(same, other, 14, 23),
+            (std::vector<uint64_t>{kBankFunctionA, kBankFunctionB}));
+  EXPECT_TRUE(infer_row_buffer_bank_functions({}, other, 14, 23).empty());
+}
+
+TEST(RowBufferResultTest, ClassifiesProbesWithMockPhysicalAddresses) {
+  RowBufferConfig config;
+  config.buffer_size_mb = 8;
+  RowBufferResult result = make_row_buffer_result(config, kPageBytes);
+  ASSERT_EQ(result.bits.size(), 7u);  // 128 B to 8 KB inside a 16 KB page
+  ASSERT_EQ(result.pairs.size(), 511u);
+
+  std::vector<char> buffer(result.buffer_bytes);
+  const char* base = buffer.data();
+  attach_row_buffer_physical_addresses(result, base, PhysicalAddressProvider{});
+  EXPECT_EQ(result.physical_address_status, PhysicalAddressStatus::Unavailable);
+  attach_row_buffer_physical_addresses(
+      result, base, [](const void*) -> std::optional<uint64_t> { return std::nullopt; });
+  EXPECT_EQ(result.physical_address_status, PhysicalAddressStatus::Hidden);
+  attach_row_buffer_physical_addresses(
+      result, base, [base](const void* address) -> std::optional<uint64_t> {
+        return kPhysicalBase + static_cast<uint64_t>(static_cast<const char*>(address) - base);
+      });
+  ASSERT_EQ(result.physical_address_status, PhysicalAddressStatus::Available);
+
+  result.reference.samples_ns = {30.0};
+  for (RowBufferProbe& probe : result.bits) {
+    probe.samples_ns = {probe.offset_bytes == 8192 ? 61.0 : 40.0};
+  }
+  for (RowBufferProbe& probe : result.pairs) {
+    probe.samples_ns = {same_bank(kPhysicalBase, *probe.physical_address) ? 90.0 : 60.0};
+  }
+  finalize_row_buffer_result(result);
+
+  ASSERT_TRUE(result.clusters.separated);
+  EXPECT_DOUBLE_EQ(*result.row_hit_ns, 40.0);
+  EXPECT_DOUBLE_EQ(*result.row_miss_ns, 60.0);
+  EXPECT_DOUBLE_EQ(*result.row_conflict_ns, 90.0);
+  EXPECT_EQ(result.bits.back().classification, RowBufferClass::RowMiss);
+  EXPECT_EQ(result.estimated_banks, std::optional<size_t>(4));
+  EXPECT_EQ(result.bank_functions, (std::vector<uint64_t>{kBankFunctionA, kBankFunctionB}));
+
+  const nlohmann::ordered_json json = build_row_buffer_json(config, result, "cpu", 1.0);
+  EXPECT_EQ(json["mode"], Constants::ROW_BUFFER_JSON_MODE_NAME);
+  EXPECT_DOUBLE_EQ(json["latencies"]["row_conflict_excess_ns"].get<double>(), 60.0);
+  EXPECT_EQ(json["physical_addresses"]["bank_functions"][0], "0x24000");
+  EXPECT_TRUE(json["physical_addresses"]["reason"].is_null());
+  EXPECT_EQ(json["bits"][0]["class"], "row_hit");
+
+  result.physical_address_status = PhysicalAddressStatus::Hidden;
+  const nlohmann::ordered_json hidden = build_row_buffer_json(config, result, "cpu", 1.0);
+  EXPECT_TRUE(hidden["physical_addresses"]["bank_functions"].is_null());
+  EXPECT_EQ(hidden["physical_addresses"]["reason"],
+            "page frame numbers hidden from this process");
+}
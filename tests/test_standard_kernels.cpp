@@ -12,14 +12,18 @@
 
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
+#include <thread>
 #include <vector>
 
 #include "asm/asm_functions.h"
 #include "benchmark/benchmark_tests.h"
 #include "benchmark/parallel_test_framework.h"
 #include "benchmark/benchmark_work_plan.h"
+#include "benchmark/generated_kernels.h"
+#include "benchmark/memory_kernels.h"
 #include "core/memory/memory_utils.h"
 #include "core/timing/timer.h"
 
@@ -116,6 +120,14 @@ uint64_t expected_random_checksum(const unsigned char* data,
   return checksum;
 }
 
+uint64_t expected_word_xor_checksum(const unsigned char* data, size_t size) {
+  uint64_t checksum = 0;
+  for (size_t index = 0; index < size; ++index) {
+    checksum ^= static_cast<uint64_t>(data[index]) << ((index % 8) * 8);
+  }
+  return checksum;
+}
+
 using ReadKernel = uint64_t (*)(const void*, size_t);
 using WriteKernel = void (*)(void*, size_t);
 using CopyKernel = void (*)(void*, const void*, size_t);
@@ -504,6 +516,59 @@ TEST(PatternKernelIntegrationTest, ReverseAndRandomKernelsPreserveCalleeSavedReg
             1u);
 }
 
+TEST(GeneratedKernelIntegrationTest, MatrixMatchesAsmCoverageAndChecksums) {
+  const std::vector<GeneratedKernel>& kernels = generated_kernels();
+  ASSERT_EQ(kernels.size(), 24u);
+  constexpr size_t kSize = 4096 + 97;
+  std::vector<unsigned char> source(kSize);
+  for (size_t index = 0; index < source.size(); ++index) {
+    source[index] = static_cast<unsigned char>((index * 13 + 3) & 0xff);
+  }
+  const uint64_t asm_checksum = memory_read_loop_asm(source.data(), kSize);
+  std::vector<unsigned char> asm_copy(kSize, 0xa5);
+  memory_copy_loop_asm(asm_copy.data(), source.data(), kSize);
+
+  for (const GeneratedKernel& kernel : kernels) {
+    SCOPED_TRACE(kernel.name);
+    EXPECT_EQ(kernel.name, generated_kernel_name(kernel.shape));
+    verify_read_kernel_boundaries(kernel.read);
+    verify_write_kernel_boundaries(kernel.write);
+    verify_copy_kernel_boundaries(kernel.copy);
+    EXPECT_EQ(kernel.read(source.data(), kSize), asm_checksum);
+    std::vector<unsigned char> generated_copy(kSize, 0xa5);
+    kernel.copy(generated_copy.data(), source.data(), kSize);
+    EXPECT_EQ(generated_copy, asm_copy);
+  }
+}
+
+TEST(GeneratedKernelIntegrationTest, RegistryResolvesGeneratedNamesWithNeonFallbacks) {
+  const MemoryKernelSet* kernels = find_memory_kernel_set("generated-u8-w16-nt-pf512");
+  ASSERT_NE(kernels, nullptr);
+  EXPECT_EQ(kernels->variant, MemoryKernelVariant::Generated);
+  EXPECT_EQ(kernels->indexed_name, "neon");
+  EXPECT_EQ(kernels->read_strided, memory_read_strided_phased_loop_asm);
+  EXPECT_EQ(kernels->copy_random, memory_copy_random_loop_asm);
+  EXPECT_EQ(find_memory_kernel_set("generated-u8-w16-nt-pf256"), nullptr);
+  EXPECT_EQ(&resolve_memory_kernel_set("", MemoryKernelVariant::Neon),
+            &memory_kernel_set(MemoryKernelVariant::Neon));
+  EXPECT_EQ(memory_kernel_registry().size(), 2u + generated_kernels().size());
+}
+
+TEST(GeneratedKernelIntegrationTest, TunedSetTakesEachOperationFromItsWinner) {
+  EXPECT_EQ(install_tuned_memory_kernel_set("neon", "generated-u3-w32-t-pf0", "neon"), nullptr);
+
+  const MemoryKernelSet* tuned = install_tuned_memory_kernel_set(
+      "generated-u8-w32-t-pf512", "generated-u4-w32-nt-pf0", "neon");
+  ASSERT_NE(tuned, nullptr);
+  EXPECT_EQ(find_memory_kernel_set("tuned"), tuned);
+  EXPECT_EQ(tuned->variant, MemoryKernelVariant::Tuned);
+  EXPECT_EQ(tuned->read, find_memory_kernel_set("generated-u8-w32-t-pf512")->read);
+  EXPECT_EQ(tuned->write, find_memory_kernel_set("generated-u4-w32-nt-pf0")->write);
+  EXPECT_EQ(tuned->copy, memory_copy_loop_asm);
+  EXPECT_EQ(tuned->indexed_name, "neon");
+  EXPECT_EQ(tuned->read_random, memory_read_random_loop_asm);
+}
+
 TEST(StandardKernelIntegrationTest, ExecutorConsumesPlannerAccountingExactly) {
   constexpr size_t kSize = 513;
   constexpr size_t kPasses = 3;
@@ -571,3 +636,32 @@ TEST(StandardKernelIntegrationTest, WorkerStartupFailureIsDeterministicAndNotMea
   EXPECT_EQ(metadata.created_workers, 1);
   EXPECT_EQ(metadata.qos_successful_workers + metadata.qos_failed_workers, 1u);
 }
+
+TEST(StandardKernelIntegrationTest, AfterFinishHooksWaitForTheLastWorker) {
+  alignas(64) std::array<unsigned char, 4096> buffer{};
+  auto timer = HighResTimer::create();
+  ASSERT_TRUE(timer.has_value());
+  std::atomic<size_t> finished_workers{0};
+  std::array<size_t, 2> finished_seen_by_hook{};
+  ParallelWorkerBracket bracket;
+  bracket.after_finish = [&](size_t worker_index) {
+    finished_seen_by_hook[worker_index] =
+        finished_workers.load(std::memory_order_acquire);
+  };
+  auto make_work = [&finished_workers](size_t, size_t, int, size_t worker_index) {
+    return [&finished_workers, worker_index] {
+      if (worker_index == 1) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      }
+      finished_workers.fetch_add(1, std::memory_order_release);
+    };
+  };
+
+  const double elapsed = run_parallel_test_common(
+      buffer.data(), buffer.size(), 1, 2, *timer, "after-finish-barrier",
+      make_work, nullptr, nullptr, nullptr, nullptr, &bracket);
+
+  EXPECT_GT(elapsed, 0.0);
+  EXPECT_EQ(finished_seen_by_hook[0], 2u);
+  EXPECT_EQ(finished_seen_by_hook[1], 2u);
+}
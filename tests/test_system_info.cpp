@@ -21,6 +21,7 @@
 #include <gtest/gtest.h>
 
 #include "core/config/constants.h"
+#include "core/memory/memory_utils.h"
 #include "core/system/benchmark_qos.h"
 #include "core/system/page_size.h"
 #include "core/system/system_info.h"
@@ -247,6 +248,23 @@ TEST(SystemInfoTest, CacheQueriesUseDetectedValues) {
   EXPECT_EQ(get_l2_cache_size(provider), static_cast<size_t>(24 * 1024 * 1024));
 }
 
+TEST(SystemInfoTest, EfficiencyCacheQueriesReturnZeroWithoutSecondPerfLevel) {
+  FakeSystemInfoProvider provider;
+  EXPECT_EQ(get_efficiency_l1_cache_size(provider), 0u);
+  EXPECT_EQ(get_efficiency_l2_cache_size(provider), 0u);
+
+  provider.set_sysctl_value<size_t>("hw.perflevel1.l1dcachesize", 64 * 1024);
+  provider.set_sysctl_value<size_t>("hw.perflevel1.l2cachesize", 4 * 1024 * 1024);
+  EXPECT_EQ(get_efficiency_l1_cache_size(provider), static_cast<size_t>(64 * 1024));
+  EXPECT_EQ(get_efficiency_l2_cache_size(provider), static_cast<size_t>(4 * 1024 * 1024));
+}
+
+TEST(SystemInfoTest, MemoryKernelVariantStrings) {
+  EXPECT_STREQ(memory_kernel_variant_to_string(MemoryKernelVariant::Neon), "neon");
+  EXPECT_STREQ(memory_kernel_variant_to_string(MemoryKernelVariant::Generated), "generated");
+  EXPECT_STREQ(memory_kernel_variant_to_string(MemoryKernelVariant::Tuned), "tuned");
+}
+
 TEST(SystemInfoTest, L1CacheUsesCentralizedFallback) {
   FakeSystemInfoProvider provider;
 
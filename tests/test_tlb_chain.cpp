@@ -15,6 +15,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -176,6 +177,77 @@ TEST(TlbChainTest, PackedControlPreservesNodeAndCacheLineCounts) {
   EXPECT_TRUE(packed.diagnostics.integrity_verified);
 }
 
+TEST(TlbChainTest, TableLayoutsHoldDataFootprintAndSeparateDescriptors) {
+  constexpr size_t page_size = kTestPageSizeBytes;
+  constexpr size_t kRequestedPages = 24;
+  PageBuffer buffer(8 * kRequestedPages * page_size);
+  ASSERT_NE(buffer.get(), nullptr);
+  ASSERT_EQ(tlb_table_spread_page_stride(buffer.size(), kRequestedPages,
+                                         page_size),
+            8U);
+
+  const TlbChainBuildResult table_spread = build_tlb_chain(
+      buffer.get(),
+      buffer.size(),
+      kRequestedPages,
+      page_size,
+      64,
+      TlbChainLayout::TableSpread,
+      TlbChainTraversalPolicy::RandomPagesRandomOffsets,
+      333);
+  ASSERT_EQ(table_spread.status, TlbChainBuildStatus::Success);
+  const TlbChainBuildResult table_dense = build_tlb_chain(
+      buffer.get(),
+      buffer.size(),
+      kRequestedPages,
+      page_size,
+      64,
+      TlbChainLayout::TableDense,
+      TlbChainTraversalPolicy::RandomPagesRandomOffsets,
+      444);
+  ASSERT_EQ(table_dense.status, TlbChainBuildStatus::Success);
+
+  EXPECT_EQ(table_spread.diagnostics.actual_pages, kRequestedPages);
+  EXPECT_EQ(table_dense.diagnostics.actual_pages, kRequestedPages);
+  EXPECT_EQ(table_spread.diagnostics.unique_cache_lines,
+            table_dense.diagnostics.unique_cache_lines);
+  EXPECT_EQ(table_spread.diagnostics.page_stride_pages, 8U);
+  EXPECT_EQ(table_dense.diagnostics.page_stride_pages, 1U);
+  EXPECT_EQ(table_spread.diagnostics.leaf_descriptor_lines, kRequestedPages);
+  EXPECT_LE(table_dense.diagnostics.leaf_descriptor_lines,
+            kRequestedPages / 8 + 1);
+  EXPECT_GE(table_spread.diagnostics.byte_span,
+            (kRequestedPages - 2) * 8 * page_size);
+  EXPECT_STREQ(tlb_chain_layout_to_string(TlbChainLayout::TableSpread),
+               "table-spread");
+  EXPECT_NE(derive_tlb_chain_layout_seed(42, TlbChainLayout::TableSpread),
+            derive_tlb_chain_layout_seed(42, TlbChainLayout::TableDense));
+}
+
+TEST(TlbChainTest, TableSpreadRejectsBuffersBelowOneDescriptorLinePerNode) {
+  constexpr size_t page_size = kTestPageSizeBytes;
+  constexpr size_t kRequestedPages = 16;
+  PageBuffer buffer(7 * kRequestedPages * page_size);
+  ASSERT_NE(buffer.get(), nullptr);
+
+  EXPECT_EQ(tlb_table_spread_page_stride(buffer.size(), kRequestedPages,
+                                         page_size),
+            0U);
+  EXPECT_EQ(build_tlb_chain(buffer.get(),
+                            buffer.size(),
+                            kRequestedPages,
+                            page_size,
+                            64,
+                            TlbChainLayout::TableSpread,
+                            TlbChainTraversalPolicy::RandomPagesRandomOffsets,
+                            1)
+                .status,
+            TlbChainBuildStatus::InsufficientBuffer);
+  // The stride is capped at one leaf table of page_size / 8 descriptors.
+  EXPECT_EQ(tlb_table_spread_page_stride(1ULL << 40, 1, page_size),
+            page_size / 8);
+}
+
 TEST(TlbChainTest, PackedControlStaysDenseWithPageSizedRequestedStride) {
   constexpr size_t page_size = kTestPageSizeBytes;
   constexpr size_t kRequestedPages = 32;
@@ -484,10 +556,10 @@ TEST(TlbChainTest, ScratchReusePreservesSemanticsWithoutGrowingCapacity) {
   const size_t offsets_capacity = scratch.physical_offsets.capacity();
   const size_t traversal_capacity = scratch.traversal.capacity();
   const size_t writes_capacity = scratch.physical_writes.capacity();
-  const size_t node_buckets = scratch.visited_nodes.bucket_count();
-  const size_t page_buckets = scratch.visited_pages.bucket_count();
-  const size_t cache_line_buckets = scratch.visited_cache_lines.bucket_count();
-  const size_t per_page_buckets = scratch.nodes_per_page.bucket_count();
+  const size_t line_mask_capacity =
+      scratch.cache_line_word_masks.capacity();
+  const size_t page_count_capacity = scratch.page_node_counts.capacity();
+  const size_t visited_capacity = scratch.visited_offsets.capacity();
 
   const TlbChainBuildResult reused = build_tlb_chain(
       reused_buffer.get(),
@@ -532,10 +604,82 @@ TEST(TlbChainTest, ScratchReusePreservesSemanticsWithoutGrowingCapacity) {
   EXPECT_EQ(scratch.physical_offsets.capacity(), offsets_capacity);
   EXPECT_EQ(scratch.traversal.capacity(), traversal_capacity);
   EXPECT_EQ(scratch.physical_writes.capacity(), writes_capacity);
-  EXPECT_EQ(scratch.visited_nodes.bucket_count(), node_buckets);
-  EXPECT_EQ(scratch.visited_pages.bucket_count(), page_buckets);
-  EXPECT_EQ(scratch.visited_cache_lines.bucket_count(), cache_line_buckets);
-  EXPECT_EQ(scratch.nodes_per_page.bucket_count(), per_page_buckets);
+  EXPECT_EQ(scratch.cache_line_word_masks.capacity(), line_mask_capacity);
+  EXPECT_EQ(scratch.page_node_counts.capacity(), page_count_capacity);
+  EXPECT_EQ(scratch.visited_offsets.capacity(), visited_capacity);
+}
+
+TEST(TlbChainTest, ReservedScratchServesSmallerRegionsWithoutResizing) {
+  constexpr size_t page_size = kTestPageSizeBytes;
+  constexpr size_t kMaximumPages = 64;
+  PageBuffer buffer(kMaximumPages * page_size);
+  ASSERT_NE(buffer.get(), nullptr);
+  TlbChainScratch scratch;
+  ASSERT_TRUE(reserve_tlb_chain_scratch(scratch, buffer.size(), page_size));
+  const size_t line_mask_size = scratch.cache_line_word_masks.size();
+  const size_t page_count_size = scratch.page_node_counts.size();
+  const size_t visited_capacity = scratch.visited_offsets.capacity();
+  EXPECT_EQ(line_mask_size, buffer.size() / 64);
+  EXPECT_EQ(page_count_size, kMaximumPages);
+
+  for (size_t region_pages : {kMaximumPages, size_t{16}, size_t{40}, size_t{8}}) {
+    SCOPED_TRACE(region_pages);
+    const TlbChainBuildResult result = build_tlb_chain(
+        buffer.get(),
+        region_pages * page_size,
+        region_pages,
+        page_size,
+        64,
+        TlbChainLayout::Spread,
+        TlbChainTraversalPolicy::RandomPagesRandomOffsets,
+        91 + region_pages,
+        scratch);
+    ASSERT_EQ(result.status, TlbChainBuildStatus::Success);
+    EXPECT_EQ(scratch.cache_line_word_masks.size(), line_mask_size);
+    EXPECT_EQ(scratch.page_node_counts.size(), page_count_size);
+    EXPECT_EQ(scratch.visited_offsets.capacity(), visited_capacity);
+    EXPECT_TRUE(std::all_of(scratch.cache_line_word_masks.begin(),
+                            scratch.cache_line_word_masks.end(),
+                            [](uint8_t mask) { return mask == 0; }));
+    EXPECT_TRUE(std::all_of(scratch.page_node_counts.begin(),
+                            scratch.page_node_counts.end(),
+                            [](uint32_t count) { return count == 0; }));
+  }
+}
+
+TEST(TlbChainTest, DenseValidationScratchIsClearedAfterEveryBuild) {
+  constexpr size_t page_size = kTestPageSizeBytes;
+  constexpr size_t kRequestedPages = 8;
+  PageBuffer buffer(kRequestedPages * page_size);
+  ASSERT_NE(buffer.get(), nullptr);
+  TlbChainScratch scratch;
+
+  for (TlbChainLayout layout :
+       {TlbChainLayout::Spread, TlbChainLayout::Packed}) {
+    SCOPED_TRACE(tlb_chain_layout_to_string(layout));
+    const TlbChainBuildResult result = build_tlb_chain(
+        buffer.get(),
+        buffer.size(),
+        kRequestedPages,
+        page_size,
+        64,
+        layout,
+        TlbChainTraversalPolicy::RandomPagesRandomOffsets,
+        77,
+        scratch);
+    ASSERT_EQ(result.status, TlbChainBuildStatus::Success);
+    EXPECT_EQ(result.diagnostics.unique_cache_lines, kRequestedPages);
+    EXPECT_EQ(scratch.cache_line_word_masks.size(),
+              buffer.size() / 64);
+    EXPECT_EQ(scratch.page_node_counts.size(), kRequestedPages);
+    EXPECT_TRUE(std::all_of(scratch.cache_line_word_masks.begin(),
+                            scratch.cache_line_word_masks.end(),
+                            [](uint8_t mask) { return mask == 0; }));
+    EXPECT_TRUE(std::all_of(scratch.page_node_counts.begin(),
+                            scratch.page_node_counts.end(),
+                            [](uint32_t count) { return count == 0; }));
+    EXPECT_TRUE(scratch.visited_offsets.empty());
+  }
 }
 
 TEST(TlbChainTest, SpreadAndPackedRunThroughLatencyKernelIntegration) {
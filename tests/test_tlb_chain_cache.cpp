@@ -0,0 +1,122 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "benchmark/tlb_chain_cache.h"
+#include "benchmark/tlb_measurement_scheduler.h"
+
+namespace {
+
+constexpr size_t kTestPageSizeBytes = 16 * 1024;
+
+}  // namespace
+
+TEST(TlbChainCacheTest, LayoutIdentitiesCycleRoundsOrDisableReuse) {
+  EXPECT_EQ(tlb_chain_layout_identity(0, 0), 0u);
+  EXPECT_EQ(tlb_chain_layout_identity(7, 0), 7u);
+  EXPECT_EQ(tlb_chain_layout_identity(0, 3), 0u);
+  EXPECT_EQ(tlb_chain_layout_identity(4, 3), 1u);
+  EXPECT_EQ(tlb_chain_layout_identity(5, 1), 0u);
+}
+
+TEST(TlbChainCacheTest, IdentitySeedsMatchFreshRoundSeeds) {
+  for (size_t identity = 0; identity < 4; ++identity) {
+    EXPECT_EQ(derive_tlb_layout_identity_seed(
+                  99, TlbMeasurementPass::Refinement, identity, 5),
+              derive_tlb_measurement_seed(
+                  99, TlbMeasurementPass::Refinement, identity, 5));
+  }
+  EXPECT_NE(derive_tlb_layout_identity_seed(99, TlbMeasurementPass::Base, 0, 5),
+            derive_tlb_layout_identity_seed(99, TlbMeasurementPass::Base, 1, 5));
+}
+
+TEST(TlbChainCacheTest, RegionBytesArePageRounded) {
+  EXPECT_EQ(tlb_chain_region_bytes(8, kTestPageSizeBytes, TlbChainLayout::Spread),
+            8 * kTestPageSizeBytes);
+  EXPECT_EQ(tlb_chain_region_bytes(8, kTestPageSizeBytes, TlbChainLayout::Packed),
+            kTestPageSizeBytes);
+  EXPECT_EQ(tlb_chain_region_bytes(300, kTestPageSizeBytes, TlbChainLayout::Packed),
+            2 * kTestPageSizeBytes);
+  EXPECT_EQ(tlb_chain_region_bytes(0, kTestPageSizeBytes, TlbChainLayout::Spread),
+            0u);
+}
+
+TEST(TlbChainCacheTest, ResetRejectsDisabledOrOversizedTransientRegion) {
+  TlbChainCache cache;
+  EXPECT_FALSE(reset_tlb_chain_cache(
+      cache, 0, 16 * kTestPageSizeBytes, kTestPageSizeBytes,
+      4 * kTestPageSizeBytes));
+  EXPECT_FALSE(reset_tlb_chain_cache(
+      cache, 2, 4 * kTestPageSizeBytes, kTestPageSizeBytes,
+      5 * kTestPageSizeBytes));
+  EXPECT_EQ(cache.layout_identities, 0u);
+  EXPECT_TRUE(cache.entries.empty());
+}
+
+TEST(TlbChainCacheTest, RetainedRegionsAreDisjointAndFallBackToTransient) {
+  TlbChainCache cache;
+  ASSERT_TRUE(reset_tlb_chain_cache(
+      cache, 2, 16 * kTestPageSizeBytes, kTestPageSizeBytes,
+      4 * kTestPageSizeBytes));
+  EXPECT_EQ(cache.arena_bytes, 12 * kTestPageSizeBytes);
+  EXPECT_EQ(cache.transient_offset_bytes, 12 * kTestPageSizeBytes);
+
+  bool retained = false;
+  EXPECT_EQ(reserve_tlb_chain_region(cache, 4 * kTestPageSizeBytes, retained),
+            0u);
+  EXPECT_TRUE(retained);
+  EXPECT_EQ(reserve_tlb_chain_region(cache, 1, retained), 4 * kTestPageSizeBytes);
+  EXPECT_TRUE(retained);
+  EXPECT_EQ(reserve_tlb_chain_region(cache, 4 * kTestPageSizeBytes, retained),
+            5 * kTestPageSizeBytes);
+  EXPECT_TRUE(retained);
+  EXPECT_EQ(reserve_tlb_chain_region(cache, 4 * kTestPageSizeBytes, retained),
+            cache.transient_offset_bytes);
+  EXPECT_FALSE(retained);
+  EXPECT_EQ(reserve_tlb_chain_region(cache, 3 * kTestPageSizeBytes, retained),
+            9 * kTestPageSizeBytes);
+  EXPECT_TRUE(retained);
+  EXPECT_EQ(cache.arena_used_bytes, cache.arena_bytes);
+}
+
+TEST(TlbChainCacheTest, LookupMatchesLayoutPointAndIdentity) {
+  TlbChainCache cache;
+  ASSERT_TRUE(reset_tlb_chain_cache(
+      cache, 2, 16 * kTestPageSizeBytes, kTestPageSizeBytes,
+      4 * kTestPageSizeBytes));
+  TlbChainCacheEntry entry;
+  entry.layout = TlbChainLayout::Spread;
+  entry.point_index = 3;
+  entry.layout_identity = 1;
+  cache.entries.push_back(entry);
+
+  EXPECT_NE(find_tlb_chain_cache_entry(cache, TlbChainLayout::Spread, 3, 1),
+            nullptr);
+  EXPECT_EQ(find_tlb_chain_cache_entry(cache, TlbChainLayout::Packed, 3, 1),
+            nullptr);
+  EXPECT_EQ(find_tlb_chain_cache_entry(cache, TlbChainLayout::Spread, 2, 1),
+            nullptr);
+  EXPECT_EQ(find_tlb_chain_cache_entry(cache, TlbChainLayout::Spread, 3, 0),
+            nullptr);
+
+  ASSERT_TRUE(reset_tlb_chain_cache(
+      cache, 2, 16 * kTestPageSizeBytes, kTestPageSizeBytes,
+      4 * kTestPageSizeBytes));
+  EXPECT_TRUE(cache.entries.empty());
+}
@@ -0,0 +1,135 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <sys/mman.h>
+
+#include "benchmark/tlb_chain.h"
+#include "benchmark/tlb_chain_prebuilder.h"
+
+namespace {
+
+constexpr size_t kTestPageSizeBytes = 16 * 1024;
+constexpr size_t kRequestedPages = 32;
+
+class PageBuffer {
+ public:
+  explicit PageBuffer(size_t size_bytes) : size_bytes_(size_bytes) {
+    pointer_ = mmap(nullptr,
+                    size_bytes_,
+                    PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS,
+                    -1,
+                    0);
+    if (pointer_ == MAP_FAILED) {
+      pointer_ = nullptr;
+    }
+  }
+
+  ~PageBuffer() {
+    if (pointer_ != nullptr) {
+      (void)munmap(pointer_, size_bytes_);
+    }
+  }
+
+  char* get() const { return static_cast<char*>(pointer_); }
+
+ private:
+  void* pointer_ = nullptr;
+  size_t size_bytes_ = 0;
+};
+
+TlbChainBuildRequest make_request(char* buffer,
+                                  TlbChainLayout layout,
+                                  uint64_t seed) {
+  return TlbChainBuildRequest{
+      buffer,
+      kRequestedPages * kTestPageSizeBytes,
+      kRequestedPages,
+      kTestPageSizeBytes,
+      64,
+      layout,
+      TlbChainTraversalPolicy::RandomPagesRandomOffsets,
+      seed,
+  };
+}
+
+}  // namespace
+
+TEST(TlbChainPrebuilderTest, WaitWithoutSubmitReturnsInvalidArgument) {
+  TlbChainPrebuilder prebuilder;
+  EXPECT_EQ(prebuilder.wait().status, TlbChainBuildStatus::InvalidArgument);
+}
+
+TEST(TlbChainPrebuilderTest, HelperBuildMatchesSerialBuild) {
+  PageBuffer helper_buffer(kRequestedPages * kTestPageSizeBytes);
+  PageBuffer serial_buffer(kRequestedPages * kTestPageSizeBytes);
+  ASSERT_NE(helper_buffer.get(), nullptr);
+  ASSERT_NE(serial_buffer.get(), nullptr);
+
+  TlbChainPrebuilder prebuilder;
+  ASSERT_TRUE(prebuilder.submit(
+      make_request(helper_buffer.get(), TlbChainLayout::Spread, 42)));
+  const TlbChainBuildResult helper = prebuilder.wait();
+
+  TlbChainScratch scratch;
+  const TlbChainBuildResult serial = build_tlb_chain_request(
+      make_request(serial_buffer.get(), TlbChainLayout::Spread, 42), scratch);
+
+  ASSERT_EQ(helper.status, TlbChainBuildStatus::Success);
+  ASSERT_EQ(serial.status, TlbChainBuildStatus::Success);
+  EXPECT_EQ(static_cast<char*>(helper.chain_head) - helper_buffer.get(),
+            static_cast<char*>(serial.chain_head) - serial_buffer.get());
+  EXPECT_EQ(helper.diagnostics.node_count, serial.diagnostics.node_count);
+  EXPECT_EQ(helper.diagnostics.actual_pages, serial.diagnostics.actual_pages);
+}
+
+TEST(TlbChainPrebuilderTest, ConcurrentBuildsInDisjointRegionsBothValidate) {
+  PageBuffer buffer(2 * kRequestedPages * kTestPageSizeBytes);
+  ASSERT_NE(buffer.get(), nullptr);
+  char* second_region = buffer.get() + kRequestedPages * kTestPageSizeBytes;
+
+  TlbChainPrebuilder prebuilder;
+  for (uint64_t seed = 1; seed <= 4; ++seed) {
+    ASSERT_TRUE(prebuilder.submit(
+        make_request(second_region, TlbChainLayout::Packed, seed)));
+    TlbChainScratch scratch;
+    const TlbChainBuildResult first = build_tlb_chain_request(
+        make_request(buffer.get(), TlbChainLayout::Spread, seed), scratch);
+    const TlbChainBuildResult second = prebuilder.wait();
+
+    EXPECT_EQ(first.status, TlbChainBuildStatus::Success);
+    EXPECT_EQ(second.status, TlbChainBuildStatus::Success);
+    EXPECT_EQ(second.validation_status, TlbChainValidationStatus::Valid);
+    EXPECT_GE(static_cast<char*>(second.chain_head), second_region);
+  }
+}
+
+TEST(TlbChainPrebuilderTest, SubmitRejectsSecondPendingRequest) {
+  PageBuffer buffer(kRequestedPages * kTestPageSizeBytes);
+  ASSERT_NE(buffer.get(), nullptr);
+
+  TlbChainPrebuilder prebuilder;
+  ASSERT_TRUE(prebuilder.submit(
+      make_request(buffer.get(), TlbChainLayout::Spread, 7)));
+  EXPECT_FALSE(prebuilder.submit(
+      make_request(buffer.get(), TlbChainLayout::Spread, 8)));
+  EXPECT_EQ(prebuilder.wait().status, TlbChainBuildStatus::Success);
+  EXPECT_EQ(prebuilder.wait().status, TlbChainBuildStatus::InvalidArgument);
+}
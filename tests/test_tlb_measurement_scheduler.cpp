@@ -15,6 +15,8 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <set>
 #include <vector>
 
@@ -121,17 +123,19 @@ TEST(TlbMeasurementSchedulerTest, SchedulePreservesPlannerPointIdentifiers) {
 }
 
 TEST(TlbMeasurementSchedulerTest, StopBeforeFirstTaskProducesNoRecordsOrRounds) {
-  const std::vector<TlbMeasurementTask> schedule = build_tlb_measurement_schedule(
-      make_points(3), 2, 99, TlbMeasurementPass::Base);
   size_t measure_calls = 0;
 
-  const TlbScheduleExecutionResult result = execute_tlb_measurement_schedule(
-      schedule,
+  const TlbScheduleExecutionResult result = execute_tlb_sequential_schedule(
+      make_points(3),
+      2,
+      99,
+      TlbMeasurementPass::Base,
       []() { return true; },
       [&measure_calls](const TlbMeasurementTask&, TlbMeasurementSample&) {
         ++measure_calls;
         return TlbTaskMeasureStatus::Success;
-      });
+      },
+      {});
 
   EXPECT_EQ(result.status, TlbScheduleExecutionStatus::Interrupted);
   EXPECT_EQ(measure_calls, 0u);
@@ -141,19 +145,21 @@ TEST(TlbMeasurementSchedulerTest, StopBeforeFirstTaskProducesNoRecordsOrRounds)
 }
 
 TEST(TlbMeasurementSchedulerTest, StopMidRoundRetainsOnlyValidPartialRecords) {
-  const std::vector<TlbMeasurementTask> schedule = build_tlb_measurement_schedule(
-      make_points(4), 3, 99, TlbMeasurementPass::Refinement);
   size_t measured_count = 0;
 
-  const TlbScheduleExecutionResult result = execute_tlb_measurement_schedule(
-      schedule,
+  const TlbScheduleExecutionResult result = execute_tlb_sequential_schedule(
+      make_points(4),
+      3,
+      99,
+      TlbMeasurementPass::Refinement,
       [&measured_count]() { return measured_count >= 2; },
       [&measured_count](const TlbMeasurementTask&,
                         TlbMeasurementSample& sample) {
         ++measured_count;
         sample.latency_ns = static_cast<double>(measured_count);
         return TlbTaskMeasureStatus::Success;
-      });
+      },
+      {});
 
   EXPECT_EQ(result.status, TlbScheduleExecutionStatus::Interrupted);
   ASSERT_EQ(result.records.size(), 2u);
@@ -162,37 +168,17 @@ TEST(TlbMeasurementSchedulerTest, StopMidRoundRetainsOnlyValidPartialRecords) {
   EXPECT_FALSE(result.converged);
 }
 
-TEST(TlbMeasurementSchedulerTest, StopAfterCompleteRoundCountsThatRoundExactlyOnce) {
-  const std::vector<TlbMeasurementTask> schedule = build_tlb_measurement_schedule(
-      make_points(3), 3, 99, TlbMeasurementPass::Validation);
-  size_t measured_count = 0;
-
-  const TlbScheduleExecutionResult result = execute_tlb_measurement_schedule(
-      schedule,
-      [&measured_count]() { return measured_count >= 3; },
-      [&measured_count](const TlbMeasurementTask&,
-                        TlbMeasurementSample& sample) {
-        ++measured_count;
-        sample.latency_ns = static_cast<double>(measured_count);
-        return TlbTaskMeasureStatus::Success;
-      });
-
-  EXPECT_EQ(result.status, TlbScheduleExecutionStatus::Interrupted);
-  EXPECT_EQ(result.records.size(), 3u);
-  EXPECT_EQ(result.rounds_completed, 1u);
-  EXPECT_FALSE(result.converged);
-}
-
 TEST(TlbMeasurementSchedulerTest, MeasurementErrorStopsWithoutAppendingInvalidRecord) {
-  const std::vector<TlbMeasurementTask> schedule = build_tlb_measurement_schedule(
-      make_points(2), 2, 7, TlbMeasurementPass::Base);
-
-  const TlbScheduleExecutionResult result = execute_tlb_measurement_schedule(
-      schedule,
+  const TlbScheduleExecutionResult result = execute_tlb_sequential_schedule(
+      make_points(2),
+      2,
+      7,
+      TlbMeasurementPass::Base,
       []() { return false; },
       [](const TlbMeasurementTask&, TlbMeasurementSample&) {
         return TlbTaskMeasureStatus::Error;
-      });
+      },
+      {});
 
   EXPECT_EQ(result.status, TlbScheduleExecutionStatus::Error);
   EXPECT_TRUE(result.records.empty());
@@ -200,12 +186,13 @@ TEST(TlbMeasurementSchedulerTest, MeasurementErrorStopsWithoutAppendingInvalidRe
 }
 
 TEST(TlbMeasurementSchedulerTest, MeasurementErrorAfterRecordsPreservesValidPrefix) {
-  const std::vector<TlbMeasurementTask> schedule = build_tlb_measurement_schedule(
-      make_points(3), 2, 7, TlbMeasurementPass::Base);
   size_t measure_calls = 0;
 
-  const TlbScheduleExecutionResult result = execute_tlb_measurement_schedule(
-      schedule,
+  const TlbScheduleExecutionResult result = execute_tlb_sequential_schedule(
+      make_points(3),
+      2,
+      7,
+      TlbMeasurementPass::Base,
       []() { return false; },
       [&measure_calls](const TlbMeasurementTask&,
                        TlbMeasurementSample& sample) {
@@ -215,7 +202,8 @@ TEST(TlbMeasurementSchedulerTest, MeasurementErrorAfterRecordsPreservesValidPref
         }
         sample.latency_ns = static_cast<double>(measure_calls);
         return TlbTaskMeasureStatus::Success;
-      });
+      },
+      {});
 
   EXPECT_EQ(result.status, TlbScheduleExecutionStatus::Error);
   ASSERT_EQ(result.records.size(), 2u);
@@ -225,11 +213,14 @@ TEST(TlbMeasurementSchedulerTest, MeasurementErrorAfterRecordsPreservesValidPref
   EXPECT_FALSE(result.converged);
 }
 
-TEST(TlbMeasurementSchedulerTest, EmptyScheduleIsACompleteNoOp) {
+TEST(TlbMeasurementSchedulerTest, EmptyPointSetIsACompleteNoOp) {
   size_t stop_calls = 0;
   size_t measure_calls = 0;
-  const TlbScheduleExecutionResult result = execute_tlb_measurement_schedule(
+  const TlbScheduleExecutionResult result = execute_tlb_sequential_schedule(
       {},
+      3,
+      7,
+      TlbMeasurementPass::Base,
       [&stop_calls]() {
         ++stop_calls;
         return false;
@@ -237,7 +228,8 @@ TEST(TlbMeasurementSchedulerTest, EmptyScheduleIsACompleteNoOp) {
       [&measure_calls](const TlbMeasurementTask&, TlbMeasurementSample&) {
         ++measure_calls;
         return TlbTaskMeasureStatus::Success;
-      });
+      },
+      {});
 
   EXPECT_EQ(result.status, TlbScheduleExecutionStatus::Complete);
   EXPECT_EQ(stop_calls, 0u);
@@ -247,113 +239,211 @@ TEST(TlbMeasurementSchedulerTest, EmptyScheduleIsACompleteNoOp) {
 }
 
 TEST(TlbMeasurementSchedulerTest, MissingMeasureCallbackIsAnErrorForNonEmptySchedule) {
-  const std::vector<TlbMeasurementTask> schedule = build_tlb_measurement_schedule(
-      make_points(1), 1, 7, TlbMeasurementPass::Base);
-
-  const TlbScheduleExecutionResult result = execute_tlb_measurement_schedule(
-      schedule, {}, {});
+  const TlbScheduleExecutionResult result = execute_tlb_sequential_schedule(
+      make_points(1), 1, 7, TlbMeasurementPass::Base, {}, {}, {});
 
   EXPECT_EQ(result.status, TlbScheduleExecutionStatus::Error);
   EXPECT_TRUE(result.records.empty());
   EXPECT_EQ(result.rounds_completed, 0u);
 }
 
-TEST(TlbMeasurementSchedulerTest, EmptyOptionalCallbacksAllowFullExecution) {
-  const std::vector<TlbMeasurementTask> schedule = build_tlb_measurement_schedule(
-      make_points(2), 1, 7, TlbMeasurementPass::Base);
-
-  const TlbScheduleExecutionResult result = execute_tlb_measurement_schedule(
-      schedule,
-      {},
+TEST(TlbMeasurementSchedulerTest, PreservesPairedMeasurementMetadata) {
+  const TlbScheduleExecutionResult result = execute_tlb_sequential_schedule(
+      make_points(1),
+      1,
+      7,
+      TlbMeasurementPass::Base,
+      []() { return false; },
       [](const TlbMeasurementTask&, TlbMeasurementSample& sample) {
-        sample.latency_ns = 1.0;
+        sample.latency_ns = 12.0;
+        sample.paired.available = true;
+        sample.paired.spread.seed = 101;
+        sample.paired.spread.latency_ns = 12.0;
+        sample.paired.packed.seed = 202;
+        sample.paired.packed.latency_ns = 7.5;
+        sample.paired.translation_delta_ns = 4.5;
         return TlbTaskMeasureStatus::Success;
       },
       {});
 
-  EXPECT_EQ(result.status, TlbScheduleExecutionStatus::Complete);
-  EXPECT_EQ(result.records.size(), 2u);
-  EXPECT_EQ(result.rounds_completed, 1u);
-  EXPECT_FALSE(result.converged);
+  ASSERT_EQ(result.status, TlbScheduleExecutionStatus::Complete);
+  ASSERT_EQ(result.records.size(), 1U);
+  EXPECT_TRUE(result.records[0].paired.available);
+  EXPECT_EQ(result.records[0].paired.spread.seed, 101U);
+  EXPECT_EQ(result.records[0].paired.packed.seed, 202U);
+  EXPECT_DOUBLE_EQ(result.records[0].paired.translation_delta_ns, 4.5);
 }
 
-TEST(TlbMeasurementSchedulerTest, ConvergenceCallbackStopsOnlyAfterCompleteRound) {
-  const std::vector<TlbMeasurementTask> schedule = build_tlb_measurement_schedule(
-      make_points(3), 5, 7, TlbMeasurementPass::Base);
+TEST(TlbMeasurementSchedulerTest, PairOrderAlternatesAcrossRoundAndOrderParity) {
+  TlbMeasurementTask task;
+  task.round_index = 0;
+  task.order_index = 0;
+  EXPECT_TRUE(tlb_measure_spread_first(task));
+  task.order_index = 1;
+  EXPECT_FALSE(tlb_measure_spread_first(task));
+  task.round_index = 1;
+  EXPECT_TRUE(tlb_measure_spread_first(task));
+}
 
-  const TlbScheduleExecutionResult result = execute_tlb_measurement_schedule(
-      schedule,
+TEST(TlbMeasurementSchedulerTest, FullyActiveRoundMatchesCyclicSchedule) {
+  const std::vector<TlbSweepPoint> points = make_points(5);
+  const std::vector<TlbMeasurementTask> schedule =
+      build_tlb_measurement_schedule(points, 3, 42, TlbMeasurementPass::Base);
+  const std::vector<uint8_t> active(points.size(), 1);
+
+  for (size_t round = 0; round < 3; ++round) {
+    const std::vector<TlbMeasurementTask> active_round =
+        build_tlb_active_round_schedule(
+            points, active, round, 42, TlbMeasurementPass::Base);
+    expect_same_schedule(
+        active_round,
+        std::vector<TlbMeasurementTask>(
+            schedule.begin() + static_cast<std::ptrdiff_t>(round * points.size()),
+            schedule.begin() +
+                static_cast<std::ptrdiff_t>((round + 1) * points.size())));
+  }
+}
+
+TEST(TlbMeasurementSchedulerTest, ActiveRoundsBalanceOrderAmongRemainingPoints) {
+  const std::vector<TlbSweepPoint> points = make_points(6);
+  std::vector<uint8_t> active(points.size(), 1);
+  active[1] = 0;
+  active[4] = 0;
+  const size_t active_count = 4;
+
+  std::vector<std::set<size_t>> positions_by_point(points.size());
+  for (size_t round = 0; round < active_count; ++round) {
+    const std::vector<TlbMeasurementTask> tasks = build_tlb_active_round_schedule(
+        points, active, round, 42, TlbMeasurementPass::Base);
+    ASSERT_EQ(tasks.size(), active_count);
+    for (const TlbMeasurementTask& task : tasks) {
+      EXPECT_NE(task.point_index, 1u);
+      EXPECT_NE(task.point_index, 4u);
+      EXPECT_EQ(task.seed, derive_tlb_measurement_seed(
+                               42, TlbMeasurementPass::Base, round,
+                               task.point_index));
+      positions_by_point[task.point_index].insert(task.order_index);
+    }
+  }
+  for (size_t point = 0; point < points.size(); ++point) {
+    EXPECT_EQ(positions_by_point[point].size(), active[point] != 0 ? active_count : 0u);
+  }
+}
+
+TEST(TlbMeasurementSchedulerTest, SequentialScheduleStopsMeasuringRetiredPoints) {
+  const std::vector<TlbSweepPoint> points = make_points(3);
+  std::vector<size_t> measurements_by_point(points.size(), 0);
+
+  const TlbScheduleExecutionResult result = execute_tlb_sequential_schedule(
+      points,
+      6,
+      7,
+      TlbMeasurementPass::Base,
       []() { return false; },
-      [](const TlbMeasurementTask&, TlbMeasurementSample& sample) {
+      [&](const TlbMeasurementTask& task, TlbMeasurementSample& sample) {
+        ++measurements_by_point[task.point_index];
         sample.latency_ns = 1.0;
         return TlbTaskMeasureStatus::Success;
       },
       [](size_t completed_rounds,
-         const std::vector<TlbMeasurementRecord>& records) {
-        EXPECT_EQ(records.size(), completed_rounds * 3);
-        return completed_rounds == 2;
+         const std::vector<TlbMeasurementRecord>&,
+         std::vector<uint8_t>& active_points) {
+        if (completed_rounds == 2) {
+          active_points[0] = 0;
+        } else if (completed_rounds == 4) {
+          active_points[1] = 0;
+          active_points[2] = 0;
+        }
       });
 
   EXPECT_EQ(result.status, TlbScheduleExecutionStatus::Complete);
   EXPECT_TRUE(result.converged);
-  EXPECT_EQ(result.rounds_completed, 2u);
-  EXPECT_EQ(result.records.size(), 6u);
+  EXPECT_EQ(result.rounds_completed, 4u);
+  EXPECT_EQ(result.retired_points, 3u);
+  EXPECT_EQ(measurements_by_point, (std::vector<size_t>{2, 4, 4}));
+  EXPECT_EQ(result.records.size(), 10u);
 }
 
-TEST(TlbMeasurementSchedulerTest, ReportsMaximumRoundsWithoutConvergence) {
-  const std::vector<TlbMeasurementTask> schedule = build_tlb_measurement_schedule(
-      make_points(2), 3, 7, TlbMeasurementPass::Base);
-
-  const TlbScheduleExecutionResult result = execute_tlb_measurement_schedule(
-      schedule,
-      []() { return false; },
+TEST(TlbMeasurementSchedulerTest, SequentialScheduleRunsMaximumRoundsWithoutRetirement) {
+  const TlbScheduleExecutionResult result = execute_tlb_sequential_schedule(
+      make_points(2),
+      3,
+      7,
+      TlbMeasurementPass::Validation,
+      {},
       [](const TlbMeasurementTask&, TlbMeasurementSample& sample) {
         sample.latency_ns = 1.0;
         return TlbTaskMeasureStatus::Success;
       },
-      [](size_t, const std::vector<TlbMeasurementRecord>&) {
-        return false;
-      });
+      {});
 
   EXPECT_EQ(result.status, TlbScheduleExecutionStatus::Complete);
   EXPECT_FALSE(result.converged);
   EXPECT_EQ(result.rounds_completed, 3u);
+  EXPECT_EQ(result.retired_points, 0u);
   EXPECT_EQ(result.records.size(), 6u);
 }
 
-TEST(TlbMeasurementSchedulerTest, PreservesPairedMeasurementMetadata) {
-  const std::vector<TlbMeasurementTask> schedule = build_tlb_measurement_schedule(
-      make_points(1), 1, 7, TlbMeasurementPass::Base);
+TEST(TlbMeasurementSchedulerTest, SequentialScheduleCountsRoundBeforeStopRequest) {
+  size_t measured_count = 0;
+  const TlbScheduleExecutionResult result = execute_tlb_sequential_schedule(
+      make_points(3),
+      3,
+      99,
+      TlbMeasurementPass::Base,
+      [&measured_count]() { return measured_count >= 3; },
+      [&measured_count](const TlbMeasurementTask&,
+                        TlbMeasurementSample& sample) {
+        ++measured_count;
+        sample.latency_ns = 1.0;
+        return TlbTaskMeasureStatus::Success;
+      },
+      {});
 
-  const TlbScheduleExecutionResult result = execute_tlb_measurement_schedule(
-      schedule,
-      []() { return false; },
-      [](const TlbMeasurementTask&, TlbMeasurementSample& sample) {
-        sample.latency_ns = 12.0;
-        sample.paired.available = true;
-        sample.paired.spread.seed = 101;
-        sample.paired.spread.latency_ns = 12.0;
-        sample.paired.packed.seed = 202;
-        sample.paired.packed.latency_ns = 7.5;
-        sample.paired.translation_delta_ns = 4.5;
+  EXPECT_EQ(result.status, TlbScheduleExecutionStatus::Interrupted);
+  EXPECT_EQ(result.records.size(), 3u);
+  EXPECT_EQ(result.rounds_completed, 1u);
+  EXPECT_FALSE(result.converged);
+}
+
+TEST(TlbMeasurementSchedulerTest, SequentialScheduleAnnouncesNextTaskWithinRound) {
+  std::vector<TlbMeasurementTask> measured;
+  std::vector<const TlbMeasurementTask*> announced;
+  std::vector<TlbMeasurementTask> announced_tasks;
+
+  const TlbScheduleExecutionResult result = execute_tlb_sequential_schedule(
+      make_points(3),
+      2,
+      11,
+      TlbMeasurementPass::Base,
+      {},
+      [&measured](const TlbMeasurementTask& task, TlbMeasurementSample& sample) {
+        measured.push_back(task);
+        sample.latency_ns = 1.0;
         return TlbTaskMeasureStatus::Success;
+      },
+      {},
+      [&](const TlbMeasurementTask* next_task) {
+        announced.push_back(next_task);
+        if (next_task != nullptr) {
+          announced_tasks.push_back(*next_task);
+        }
       });
 
   ASSERT_EQ(result.status, TlbScheduleExecutionStatus::Complete);
-  ASSERT_EQ(result.records.size(), 1U);
-  EXPECT_TRUE(result.records[0].paired.available);
-  EXPECT_EQ(result.records[0].paired.spread.seed, 101U);
-  EXPECT_EQ(result.records[0].paired.packed.seed, 202U);
-  EXPECT_DOUBLE_EQ(result.records[0].paired.translation_delta_ns, 4.5);
-}
-
-TEST(TlbMeasurementSchedulerTest, PairOrderAlternatesAcrossRoundAndOrderParity) {
-  TlbMeasurementTask task;
-  task.round_index = 0;
-  task.order_index = 0;
-  EXPECT_TRUE(tlb_measure_spread_first(task));
-  task.order_index = 1;
-  EXPECT_FALSE(tlb_measure_spread_first(task));
-  task.round_index = 1;
-  EXPECT_TRUE(tlb_measure_spread_first(task));
+  ASSERT_EQ(measured.size(), 6u);
+  ASSERT_EQ(announced.size(), measured.size());
+  size_t announced_index = 0;
+  for (size_t i = 0; i < measured.size(); ++i) {
+    const bool last_in_round = (i % 3) == 2;
+    if (last_in_round) {
+      EXPECT_EQ(announced[i], nullptr);
+      continue;
+    }
+    ASSERT_NE(announced[i], nullptr);
+    const TlbMeasurementTask& next = announced_tasks[announced_index++];
+    EXPECT_EQ(next.point_index, measured[i + 1].point_index);
+    EXPECT_EQ(next.round_index, measured[i + 1].round_index);
+    EXPECT_EQ(next.seed, measured[i + 1].seed);
+  }
 }
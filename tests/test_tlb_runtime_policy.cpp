@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
 #include <limits>
 #include <vector>
 
@@ -61,29 +62,28 @@ TEST(TlbRuntimePolicyTest, CalibrationRejectsInvalidPilotAndAvoidsOverflow) {
             0u);
 }
 
-TEST(TlbRuntimePolicyTest, QuietSamplesConvergeAndNoisySamplesDoNot) {
+TEST(TlbRuntimePolicyTest, RetirementIsDeterministicForAFixedSeed) {
   const TlbRuntimeProfile profile =
       tlb_runtime_profile_for_density(TlbSweepDensity::Low);
-  std::vector<std::vector<double>> quiet(3);
-  std::vector<std::vector<double>> noisy(3);
+  const std::vector<size_t> localities = {16384, 32768, 65536};
+  std::vector<std::vector<double>> samples(3);
   for (size_t point = 0; point < 3; ++point) {
     for (size_t round = 0; round < profile.min_rounds; ++round) {
-      quiet[point].push_back(1.0 + 0.01 * static_cast<double>(round % 2));
-      noisy[point].push_back((round % 2) == 0 ? 0.0 : 4.0);
+      samples[point].push_back(1.0 + 0.01 * static_cast<double>(round % 2));
     }
   }
+  std::vector<uint8_t> active(3, 1);
+  std::vector<uint8_t> repeated_active(3, 1);
 
-  const TlbConvergenceSummary quiet_summary =
-      evaluate_tlb_convergence(quiet, profile, 123);
-  const TlbConvergenceSummary repeated_summary =
-      evaluate_tlb_convergence(quiet, profile, 123);
-  const TlbConvergenceSummary noisy_summary =
-      evaluate_tlb_convergence(noisy, profile, 123);
+  const TlbConvergenceSummary summary = update_tlb_active_points(
+      localities, samples, profile, 123, active);
+  const TlbConvergenceSummary repeated_summary = update_tlb_active_points(
+      localities, samples, profile, 123, repeated_active);
 
-  EXPECT_TRUE(quiet_summary.converged);
-  EXPECT_DOUBLE_EQ(quiet_summary.maximum_ci_width_ns,
+  EXPECT_TRUE(summary.converged);
+  EXPECT_EQ(active, repeated_active);
+  EXPECT_DOUBLE_EQ(summary.maximum_ci_width_ns,
                    repeated_summary.maximum_ci_width_ns);
-  EXPECT_FALSE(noisy_summary.converged);
 }
 
 TEST(TlbRuntimePolicyTest, MemoryBudgetSelectsOnlySafePeakFootprints) {
@@ -105,6 +105,17 @@ TEST(TlbRuntimePolicyTest, MemoryBudgetSelectsOnlySafePeakFootprints) {
       256, page_size, calculate_tlb_memory_budget_mb(512), peak_bytes));
 }
 
+TEST(TlbRuntimePolicyTest, PeakMemoryCountsBothChainScratchesAndPageCounters) {
+  const size_t buffer_bytes = 256 * Constants::BYTES_PER_MB;
+  const size_t node_count = buffer_bytes / (16 * Constants::BYTES_PER_KB);
+  const size_t per_scratch_bytes =
+      estimate_tlb_scratch_bytes(node_count) +
+      buffer_bytes / Constants::CACHE_LINE_SIZE_BYTES +
+      node_count * sizeof(uint32_t);
+  EXPECT_EQ(estimate_tlb_peak_memory_bytes(buffer_bytes, node_count),
+            buffer_bytes + 2 * per_scratch_bytes);
+}
+
 TEST(TlbRuntimePolicyTest, WorkEstimateIncludesPairsRoundsAndPeakMemory) {
   const TlbRuntimeProfile profile =
       tlb_runtime_profile_for_density(TlbSweepDensity::Medium);
@@ -140,3 +151,93 @@ TEST(TlbRuntimePolicyTest, WorkEstimateHonorsWholeChainCycleFloor) {
                 (estimate.maximum_pilot_accesses_per_measurement +
                  estimate.maximum_accesses_per_measurement));
 }
+
+TEST(TlbRuntimePolicyTest, QuietPointsRetireWhileNoisyPointsStayActive) {
+  const TlbRuntimeProfile profile =
+      tlb_runtime_profile_for_density(TlbSweepDensity::Low);
+  const std::vector<size_t> localities = {16384, 32768, 65536};
+  std::vector<std::vector<double>> samples(3);
+  for (size_t round = 0; round < profile.min_rounds; ++round) {
+    samples[0].push_back(1.0 + 0.01 * static_cast<double>(round % 2));
+    samples[1].push_back((round % 2) == 0 ? 0.0 : 4.0);
+    samples[2].push_back(1.0 + 0.01 * static_cast<double>(round % 2));
+  }
+  std::vector<uint8_t> active(3, 1);
+
+  const TlbConvergenceSummary summary = update_tlb_active_points(
+      localities, samples, profile, 123, active);
+
+  EXPECT_FALSE(summary.converged);
+  EXPECT_EQ(summary.evaluated_points, 3u);
+  EXPECT_EQ(active, (std::vector<uint8_t>{0, 1, 0}));
+
+  samples[1].assign(profile.min_rounds, 1.0);
+  const TlbConvergenceSummary final_summary = update_tlb_active_points(
+      localities, samples, profile, 123, active);
+  EXPECT_TRUE(final_summary.converged);
+  EXPECT_EQ(final_summary.evaluated_points, 1u);
+  EXPECT_EQ(active, (std::vector<uint8_t>{0, 0, 0}));
+}
+
+TEST(TlbRuntimePolicyTest, BoundaryWindowRequiresStepResolvingCi) {
+  const TlbRuntimeProfile profile =
+      tlb_runtime_profile_for_density(TlbSweepDensity::Low);
+  // Unsorted localities: the step lies between 32 KB and 64 KB.
+  const std::vector<size_t> localities = {65536, 16384, 32768, 131072, 262144,
+                                          524288};
+  std::vector<std::vector<double>> samples(localities.size());
+  for (size_t round = 0; round < profile.min_rounds; ++round) {
+    const double jitter = 0.4 * static_cast<double>(round % 2);
+    samples[0].push_back(0.6 + jitter);
+    samples[1].push_back(0.0 + jitter);
+    samples[2].push_back(0.0 + jitter);
+    samples[3].push_back(0.6 + jitter);
+    samples[4].push_back(0.6 + jitter);
+    samples[5].push_back(0.6 + jitter);
+  }
+  std::vector<uint8_t> active(localities.size(), 1);
+
+  (void)update_tlb_active_points(localities, samples, profile, 7, active);
+
+  // 16 KB and 512 KB are outside the 32 KB..256 KB boundary window.
+  EXPECT_EQ(active, (std::vector<uint8_t>{1, 0, 1, 1, 1, 0}));
+}
+
+TEST(TlbRuntimePolicyTest, LaterBoundaryStepReactivatesRetiredNeighbour) {
+  const TlbRuntimeProfile profile =
+      tlb_runtime_profile_for_density(TlbSweepDensity::Low);
+  const std::vector<size_t> localities = {16384, 32768, 65536};
+  std::vector<std::vector<double>> samples(localities.size());
+  for (size_t round = 0; round < profile.min_rounds; ++round) {
+    const double jitter = 0.4 * static_cast<double>(round % 2);
+    samples[0].push_back(0.0 + jitter);
+    samples[1].push_back(0.0 + jitter);
+    samples[2].push_back(0.0 + jitter);
+  }
+  std::vector<uint8_t> active(localities.size(), 1);
+  (void)update_tlb_active_points(localities, samples, profile, 7, active);
+  ASSERT_EQ(active, (std::vector<uint8_t>{0, 0, 0}));
+
+  // A step appears at 64 KB after 32 KB already retired on the looser target.
+  for (double& sample : samples[2]) {
+    sample += 0.6;
+  }
+  const TlbConvergenceSummary summary =
+      update_tlb_active_points(localities, samples, profile, 7, active);
+
+  EXPECT_FALSE(summary.converged);
+  EXPECT_EQ(summary.reactivated_points, 2u);
+  EXPECT_EQ(active, (std::vector<uint8_t>{0, 1, 1}));
+}
+
+TEST(TlbRuntimePolicyTest, PointsBelowMinimumRoundsAreNotRetired) {
+  const TlbRuntimeProfile profile =
+      tlb_runtime_profile_for_density(TlbSweepDensity::Low);
+  std::vector<uint8_t> active(1, 1);
+  const TlbConvergenceSummary summary = update_tlb_active_points(
+      {16384}, {{1.0, 1.0}}, profile, 1, active);
+
+  EXPECT_FALSE(summary.converged);
+  EXPECT_EQ(summary.evaluated_points, 0u);
+  EXPECT_EQ(active[0], 1u);
+}
@@ -16,9 +16,12 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <limits>
+#include <vector>
 
 #include "benchmark/tlb_sweep_planner.h"
 #include "core/config/constants.h"
+#include "output/console/messages/messages_api.h"
 
 TEST(TlbSweepPlannerTest, HighDensityBasePlanIsPageConsistent) {
   const size_t page_size = 16 * Constants::BYTES_PER_KB;
@@ -130,3 +133,29 @@ TEST(TlbSweepPlannerTest, RefinementExcludesMeasuredHardwareRegressionPoint) {
                          }),
             refinement_points.end());
 }
+
+TEST(TlbSweepPlannerTest, PageGranulesListBaseAndUnanalyzedBlockMapping) {
+  const std::vector<TlbPageGranule> granules =
+      build_tlb_page_granules(16 * Constants::BYTES_PER_KB);
+
+  ASSERT_EQ(granules.size(), 2u);
+  EXPECT_EQ(granules[0].page_size_bytes, 16 * Constants::BYTES_PER_KB);
+  EXPECT_TRUE(granules[0].analyzed);
+  EXPECT_EQ(granules[1].page_size_bytes, 32 * Constants::BYTES_PER_MB);
+  EXPECT_FALSE(granules[1].analyzed);
+  EXPECT_EQ(granules[1].reason, Messages::tlb_page_granule_reason_block_mapping());
+
+  EXPECT_EQ(build_tlb_page_granules(4 * Constants::BYTES_PER_KB)[1]
+                .page_size_bytes,
+            2 * Constants::BYTES_PER_MB);
+  EXPECT_TRUE(build_tlb_page_granules(0).empty());
+}
+
+TEST(TlbSweepPlannerTest, EffectiveReachScalesEntriesAndSaturates) {
+  EXPECT_EQ(tlb_effective_reach_bytes(160, 16 * Constants::BYTES_PER_KB),
+            2560 * Constants::BYTES_PER_KB);
+  EXPECT_EQ(tlb_effective_reach_bytes(0, 16 * Constants::BYTES_PER_KB), 0u);
+  EXPECT_EQ(tlb_effective_reach_bytes(std::numeric_limits<size_t>::max(), 2),
+            std::numeric_limits<size_t>::max());
+}
+
@@ -0,0 +1,295 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file test_trace_replay.cpp
+ * @brief Unit tests for the trace format, page packing, controls, and JSON of trace replay mode
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "benchmark/trace_replay.h"
+#include "core/config/constants.h"
+
+namespace {
+
+constexpr uint64_t kPage = Constants::TRACE_REPLAY_PAGE_BYTES;
+
+TraceReplayRecord make_record(uint32_t thread_id, uint64_t address, unsigned size_log2,
+                              bool write = false, bool dependent = false) {
+  TraceReplayRecord record;
+  record.thread_id = thread_id;
+  record.address = address;
+  record.size_log2 = size_log2;
+  record.write = write;
+  record.dependent = dependent;
+  return record;
+}
+
+bool decode(const std::vector<unsigned char>& bytes, TraceReplayTrace& trace, std::string& error) {
+  return decode_trace_replay(bytes.data(), bytes.size(), trace, error);
+}
+
+int parse_with_args(const std::vector<std::string>& args, TraceReplayConfig& config) {
+  std::vector<std::string> mutable_args = args;
+  std::vector<char*> argv;
+  argv.reserve(mutable_args.size());
+  for (std::string& arg : mutable_args) {
+    argv.push_back(arg.data());
+  }
+  testing::internal::CaptureStderr();
+  const int result =
+      parse_trace_replay_mode_arguments(static_cast<int>(argv.size()), argv.data(), config);
+  testing::internal::GetCapturedStderr();
+  return result;
+}
+
+}  // namespace
+
+TEST(TraceReplayFormatTest, RoundTripsRecordsAndPacksTouchedPages) {
+  // Heap and stack a terabyte apart; both threads step backwards at least once.
+  const uint64_t heap = 0x100000000ULL;
+  const uint64_t stack = 0x10000000000ULL;
+  const std::vector<TraceReplayRecord> records = {
+      make_record(7, heap + 3 * kPage + 72, 3),
+      make_record(2, stack + 40, 6, true),
+      make_record(7, heap + 100, 2, false, true),
+      make_record(7, heap + 3 * kPage + 4097, 0),
+      make_record(2, stack + kPage + 8, 4, false, true),
+  };
+  const std::vector<unsigned char> bytes = encode_trace_replay(records);
+  // Header plus five records of at most a control byte, a 1-byte id, and a short delta.
+  ASSERT_GT(bytes.size(), Constants::TRACE_REPLAY_HEADER_BYTES);
+  EXPECT_LT(bytes.size(), Constants::TRACE_REPLAY_HEADER_BYTES + 5 * 8);
+
+  TraceReplayTrace trace;
+  std::string error;
+  ASSERT_TRUE(decode(bytes, trace, error)) << error;
+  EXPECT_EQ(trace.record_count, 5u);
+  EXPECT_EQ(trace.total_bytes, 8u + 64u + 4u + 1u + 16u);
+  EXPECT_EQ(trace.address_span_bytes, stack + kPage + 8 + 16 - (heap + 100));
+  // Pages heap+0, heap+3, stack+0, stack+1 pack to 0..3 in address order.
+  EXPECT_EQ(trace.touched_pages, 4u);
+  EXPECT_EQ(trace.buffer_bytes, 4 * kPage);
+
+  ASSERT_EQ(trace.threads.size(), 2u);
+  const TraceReplayThread& stack_thread = trace.threads[0];
+  const TraceReplayThread& heap_thread = trace.threads[1];
+  EXPECT_EQ(stack_thread.thread_id, 2u);
+  EXPECT_EQ(heap_thread.thread_id, 7u);
+
+  ASSERT_EQ(heap_thread.ops.size(), 3u);
+  EXPECT_EQ(heap_thread.ops[0].offset, kPage + 72);
+  EXPECT_EQ(heap_thread.ops[0].words, 1u);
+  // Narrow accesses widen to their aligned 8-byte word.
+  EXPECT_EQ(heap_thread.ops[1].offset, 96u);
+  EXPECT_EQ(heap_thread.ops[1].dependent, 1u);
+  EXPECT_EQ(heap_thread.ops[2].offset, kPage + 4096);
+  EXPECT_EQ(heap_thread.bytes, 13u);
+  EXPECT_EQ(heap_thread.dependent_accesses, 1u);
+
+  ASSERT_EQ(stack_thread.ops.size(), 2u);
+  // A 64-byte write aligns down to its line and covers eight words.
+  EXPECT_EQ(stack_thread.ops[0].offset, 2 * kPage);
+  EXPECT_EQ(stack_thread.ops[0].words, 8u);
+  EXPECT_EQ(stack_thread.ops[0].write, 1u);
+  EXPECT_EQ(stack_thread.ops[1].offset, 3 * kPage);
+  EXPECT_EQ(stack_thread.ops[1].words, 2u);
+  EXPECT_EQ(stack_thread.writes, 1u);
+  for (const TraceReplayThread& thread : trace.threads) {
+    for (const TraceReplayOp& op : thread.ops) {
+      EXPECT_LE(op.offset + op.words * sizeof(uint64_t), trace.buffer_bytes);
+      EXPECT_EQ(op.offset / kPage, (op.offset + op.words * sizeof(uint64_t) - 1) / kPage);
+    }
+  }
+}
+
+TEST(TraceReplayFormatTest, RejectsMalformedHeadersAndRecords) {
+  const std::vector<unsigned char> valid = encode_trace_replay({make_record(1, 4096, 3)});
+  TraceReplayTrace trace;
+  std::string error;
+  ASSERT_TRUE(decode(valid, trace, error)) << error;
+
+  const auto expect_error = [&trace, &error](const std::vector<unsigned char>& bytes,
+                                             const std::string& fragment) {
+    EXPECT_FALSE(decode(bytes, trace, error)) << fragment;
+    EXPECT_NE(error.find(fragment), std::string::npos) << error;
+  };
+  expect_error(std::vector<unsigned char>(valid.begin(), valid.begin() + 20), "32-byte");
+  std::vector<unsigned char> bad_magic = valid;
+  bad_magic[0] = 'X';
+  expect_error(bad_magic, "MBTRACE1");
+  std::vector<unsigned char> bad_version = valid;
+  bad_version[8] = 2;
+  expect_error(bad_version, "format version 2");
+  std::vector<unsigned char> reserved = valid;
+  reserved[12] = 1;
+  expect_error(reserved, "reserved");
+  expect_error(encode_trace_replay({}), "no records");
+
+  std::vector<unsigned char> bad_control = valid;
+  bad_control[Constants::TRACE_REPLAY_HEADER_BYTES] = 7U << 2;  // 128-byte access
+  expect_error(bad_control, "record 1: invalid control byte");
+  expect_error(std::vector<unsigned char>(valid.begin(), valid.end() - 1),
+               "record 1: truncated or oversized address delta");
+  std::vector<unsigned char> missing = valid;
+  missing[16] = 2;  // Claims a second record
+  expect_error(missing, "record 2: the file ends before it");
+  std::vector<unsigned char> trailing = valid;
+  trailing.push_back(0);
+  expect_error(trailing, "1 bytes after its last record");
+
+  std::vector<TraceReplayRecord> many_threads;
+  for (uint32_t thread = 0; thread <= Constants::TRACE_REPLAY_MAX_THREADS; ++thread) {
+    many_threads.push_back(make_record(thread, 64, 3));
+  }
+  expect_error(encode_trace_replay(many_threads), "more than 256 threads");
+}
+
+TEST(TraceReplayFormatTest, LoadsTraceFilesThroughTheirMapping) {
+  const std::string path = testing::TempDir() + "trace_replay_load_test.trace";
+  const std::vector<unsigned char> bytes =
+      encode_trace_replay({make_record(0, 8192, 3), make_record(0, 8200, 3, true)});
+  std::ofstream(path, std::ios::binary)
+      .write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+
+  TraceReplayTrace trace;
+  std::string error;
+  ASSERT_TRUE(load_trace_replay_file(path, trace, error)) << error;
+  EXPECT_EQ(trace.record_count, 2u);
+  EXPECT_EQ(trace.buffer_bytes, kPage);
+
+  std::ofstream(path, std::ios::binary | std::ios::trunc).close();
+  EXPECT_FALSE(load_trace_replay_file(path, trace, error));
+  EXPECT_NE(error.find("32-byte"), std::string::npos) << error;
+  std::remove(path.c_str());
+  EXPECT_FALSE(load_trace_replay_file(path, trace, error));
+  EXPECT_NE(error.find("cannot be opened"), std::string::npos) << error;
+}
+
+TEST(TraceReplayControlTest, ShufflesTheSameAccessesDeterministically) {
+  std::vector<TraceReplayOp> ops(512);
+  for (size_t index = 0; index < ops.size(); ++index) {
+    ops[index].offset = index * 64;
+    ops[index].write = static_cast<uint8_t>(index % 3 == 0);
+  }
+  const std::vector<TraceReplayOp> control = build_trace_replay_control(ops, 11);
+  const std::vector<TraceReplayOp> again = build_trace_replay_control(ops, 11);
+  ASSERT_EQ(control.size(), ops.size());
+  size_t moved = 0;
+  for (size_t index = 0; index < ops.size(); ++index) {
+    EXPECT_EQ(control[index].offset, again[index].offset);
+    EXPECT_EQ(control[index].write, static_cast<uint8_t>(control[index].offset / 64 % 3 == 0));
+    moved += control[index].offset != ops[index].offset ? 1 : 0;
+  }
+  EXPECT_GT(moved, ops.size() / 2);
+
+  std::vector<uint64_t> offsets;
+  for (const TraceReplayOp& op : control) {
+    offsets.push_back(op.offset);
+  }
+  std::sort(offsets.begin(), offsets.end());
+  for (size_t index = 0; index < offsets.size(); ++index) {
+    EXPECT_EQ(offsets[index], index * 64);
+  }
+}
+
+TEST(TraceReplayJsonTest, ReportsTraceShapeBothOrdersAndSpeedup) {
+  TraceReplayTrace trace;
+  std::string error;
+  ASSERT_TRUE(decode(encode_trace_replay({make_record(3, 0, 6), make_record(3, 64, 6, false, true),
+                                          make_record(5, 1 << 20, 3, false, true)}),
+                     trace, error))
+      << error;
+
+  TraceReplayConfig config;
+  config.trace_file = "service.trace";
+  config.rounds = 2;
+  config.speed_of_light = true;
+  TraceReplayResult result;
+  result.passes = 1000;
+  // 136 bytes and 3 accesses per pass.
+  record_trace_replay_sample(trace, 68000.0, 136000.0, result);
+  record_trace_replay_sample(trace, 34000.0, 102000.0, result);
+  finalize_trace_replay_result(result);
+  EXPECT_DOUBLE_EQ(result.trace.median_gb_s, 3.0);
+  EXPECT_DOUBLE_EQ(result.control.median_gb_s, (1.0 + 136000.0 / 102000.0) / 2.0);
+  EXPECT_NEAR(result.trace.median_mops, (3000.0 / 68000.0 + 3000.0 / 34000.0) * 1e3 / 2.0, 1e-9);
+  EXPECT_DOUBLE_EQ(result.median_order_speedup, 2.5);
+
+  const nlohmann::ordered_json json = build_trace_replay_json(config, trace, result, "Test CPU", 1.5);
+  EXPECT_EQ(json["mode"], Constants::TRACE_REPLAY_JSON_MODE_NAME);
+  EXPECT_EQ(json["status"], "complete");
+  EXPECT_EQ(json["configuration"]["speed_of_light"], true);
+  EXPECT_EQ(json["configuration"]["passes_per_sample"], 1000);
+  EXPECT_EQ(json["trace"]["records"], 3u);
+  EXPECT_EQ(json["trace"]["touched_pages"], 2u);
+  ASSERT_EQ(json["trace"]["threads"].size(), 2u);
+  EXPECT_EQ(json["trace"]["threads"][0]["thread_id"], 3u);
+  EXPECT_EQ(json["trace"]["threads"][0]["writes"], 0u);
+  EXPECT_EQ(json["trace"]["threads"][1]["dependent_accesses"], 1u);
+  EXPECT_DOUBLE_EQ(json["results"]["trace_order"]["gb_s"].get<double>(), 3.0);
+  EXPECT_EQ(json["results"]["shuffled_control"]["samples_gb_s"].size(), 2u);
+  EXPECT_DOUBLE_EQ(json["results"]["order_speedup"].get<double>(), 2.5);
+
+  const nlohmann::ordered_json empty =
+      build_trace_replay_json(config, trace, TraceReplayResult{}, "Test CPU", 0.0);
+  EXPECT_TRUE(empty["results"]["trace_order"]["gb_s"].is_null());
+  EXPECT_TRUE(empty["results"]["order_speedup"].is_null());
+}
+
+TEST(TraceReplayCliTest, AcceptsReplayOptionsAndRejectsOthers) {
+  TraceReplayConfig config;
+  ASSERT_EQ(parse_with_args({"memory_benchmark", "--trace-replay", "service.trace", "-r", "4",
+                             "--sample-ms", "50", "--speed-of-light", "-o", "replay.json"},
+                            config),
+            EXIT_SUCCESS);
+  EXPECT_EQ(config.trace_file, "service.trace");
+  EXPECT_EQ(config.rounds, 4);
+  EXPECT_EQ(config.sample_ms, 50);
+  EXPECT_TRUE(config.speed_of_light);
+  EXPECT_EQ(config.output_file, "replay.json");
+
+  TraceReplayConfig defaults;
+  ASSERT_EQ(parse_with_args({"memory_benchmark", "-Z", "service.trace"}, defaults), EXIT_SUCCESS);
+  EXPECT_EQ(defaults.rounds, Constants::TRACE_REPLAY_DEFAULT_ROUNDS);
+  EXPECT_EQ(defaults.sample_ms, Constants::TRACE_REPLAY_DEFAULT_SAMPLE_MS);
+  EXPECT_FALSE(defaults.speed_of_light);
+
+  const std::vector<std::vector<std::string>> invalid_args = {
+      {"-Z"},
+      {"-Z", "a.trace", "--sample-ms", "0"},
+      {"-Z", "a.trace", "--sample-ms", "60001"},
+      {"-Z", "a.trace", "--speed-of-light", "--speed-of-light"},
+      {"-Z", "a.trace", "-Z", "b.trace"},
+      {"-Z", "a.trace", "--seed", "1"},
+      {"--speed-of-light"},
+  };
+  for (const std::vector<std::string>& extra : invalid_args) {
+    std::vector<std::string> args = {"memory_benchmark"};
+    args.insert(args.end(), extra.begin(), extra.end());
+    TraceReplayConfig invalid;
+    EXPECT_EQ(parse_with_args(args, invalid), EXIT_FAILURE) << extra.back();
+  }
+}
@@ -0,0 +1,280 @@
+// Copyright 2026 Timo Heimonen <timo.heimonen@proton.me>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+//
+
+/**
+ * @file test_workload.cpp
+ * @brief Unit tests for workload file parsing, schedule compilation, and JSON
+ * @author Timo Heimonen <timo.heimonen@proton.me>
+ * @date 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "benchmark/workload.h"
+#include "core/config/constants.h"
+
+namespace {
+
+constexpr const char* kExampleWorkload =
+    "# Request path plus a pointer walker\n"
+    "group service threads=4\n"
+    "stream scan  read  sequential region=1GiB   weight=70\n"
+    "stream cache write zipf       region=256MiB weight=30 theta=0.8\n"
+    "\n"
+    "group walker   # defaults to one thread\n"
+    "stream chain read chase region=64MiB\n"
+    "stream column read strided region=8M stride=4KiB\n";
+
+int parse_with_args(const std::vector<std::string>& args, WorkloadConfig& config) {
+  std::vector<std::string> mutable_args = args;
+  std::vector<char*> argv;
+  argv.reserve(mutable_args.size());
+  for (std::string& arg : mutable_args) {
+    argv.push_back(arg.data());
+  }
+  testing::internal::CaptureStderr();
+  const int result =
+      parse_workload_mode_arguments(static_cast<int>(argv.size()), argv.data(), config);
+  testing::internal::GetCapturedStderr();
+  return result;
+}
+
+}  // namespace
+
+TEST(WorkloadSpecTest, ParsesGroupsStreamsSizesAndDefaults) {
+  WorkloadSpec spec;
+  std::string error;
+  ASSERT_TRUE(parse_workload_spec(kExampleWorkload, spec, error)) << error;
+  ASSERT_EQ(spec.groups.size(), 2u);
+
+  const WorkloadGroupSpec& service = spec.groups[0];
+  EXPECT_EQ(service.name, "service");
+  EXPECT_EQ(service.threads, 4);
+  ASSERT_EQ(service.streams.size(), 2u);
+  EXPECT_EQ(service.streams[0].operation, WorkloadOperation::Read);
+  EXPECT_EQ(service.streams[0].pattern, WorkloadPattern::Sequential);
+  EXPECT_EQ(service.streams[0].region_bytes, 1024u * Constants::BYTES_PER_MB);
+  EXPECT_EQ(service.streams[0].weight, 70u);
+  EXPECT_EQ(service.streams[1].operation, WorkloadOperation::Write);
+  EXPECT_EQ(service.streams[1].pattern, WorkloadPattern::Zipf);
+  EXPECT_DOUBLE_EQ(service.streams[1].zipf_theta, 0.8);
+  EXPECT_EQ(service.streams[1].line, 4u);
+
+  const WorkloadGroupSpec& walker = spec.groups[1];
+  EXPECT_EQ(walker.threads, 1);
+  ASSERT_EQ(walker.streams.size(), 2u);
+  EXPECT_EQ(walker.streams[0].pattern, WorkloadPattern::Chase);
+  EXPECT_EQ(walker.streams[0].weight, 1u);
+  EXPECT_EQ(walker.streams[1].region_bytes, 8u * Constants::BYTES_PER_MB);
+  EXPECT_EQ(walker.streams[1].stride_bytes, 4096u);
+}
+
+TEST(WorkloadSpecTest, RejectsMalformedWorkloadsWithLineNumbers) {
+  const std::vector<std::pair<std::string, std::string>> invalid = {
+      {"stream s read sequential region=1MiB\n", "line 1"},
+      {"group g\nstream s read sequential\n", "region"},
+      {"group g\nstream s read sequential region=0\n", "line 2"},
+      {"group g\nstream s read sequential region=1TB\n", "region"},
+      {"group g\nstream s copy sequential region=1MiB\n", "operation"},
+      {"group g\nstream s read gather region=1MiB\n", "pattern"},
+      {"group g\nstream s write chase region=1MiB\n", "chase"},
+      {"group g\nstream s read strided region=1MiB\n", "stride"},
+      {"group g\nstream s read strided region=1MiB stride=48\n", "stride"},
+      {"group g\nstream s read sequential region=1MiB stride=64\n", "stride"},
+      {"group g\nstream s read random region=1MiB theta=0.5\n", "theta"},
+      {"group g\nstream s read zipf region=1MiB theta=0\n", "theta"},
+      {"group g\nstream s read sequential region=1MiB weight=0\n", "weight"},
+      {"group g\nstream s read sequential region=1MiB region=2MiB\n", "region"},
+      {"group g\nstream s read sequential region=1MiB\nstream s read random region=1MiB\n",
+       "line 3"},
+      {"group g threads=0\nstream s read sequential region=1MiB\n", "threads"},
+      {"group g threads=200\ngroup h threads=100\n", "line 2"},
+      {"group g\ngroup g\n", "already defined"},
+      {"group g\ngroup h\nstream s read random region=1MiB\n", "line 1"},
+      {"group g/x\n", "line 1"},
+      {"thread g\n", "unknown directive"},
+      {"# nothing\n\n", "no group"},
+  };
+  for (const auto& [text, expected] : invalid) {
+    WorkloadSpec spec;
+    std::string error;
+    EXPECT_FALSE(parse_workload_spec(text, spec, error)) << text;
+    EXPECT_NE(error.find(expected), std::string::npos) << text << " -> " << error;
+  }
+}
+
+TEST(WorkloadPlanTest, WeightedCycleReducesWeightsAndSpreadsHeavyStreams) {
+  const std::vector<size_t> cycle = build_workload_weighted_cycle({70, 30});
+  ASSERT_EQ(cycle.size(), 10u);
+  EXPECT_EQ(std::count(cycle.begin(), cycle.end(), 0u), 7);
+  EXPECT_EQ(std::count(cycle.begin(), cycle.end(), 1u), 3);
+  size_t longest_run = 0;
+  size_t run = 0;
+  for (size_t index = 0; index < cycle.size(); ++index) {
+    run = index > 0 && cycle[index] == cycle[index - 1] ? run + 1 : 1;
+    longest_run = std::max(longest_run, run);
+  }
+  EXPECT_LE(longest_run, 3u);
+
+  EXPECT_EQ(build_workload_weighted_cycle({5}), std::vector<size_t>({0}));
+  EXPECT_EQ(build_workload_weighted_cycle({4, 4, 8}).size(), 4u);
+  EXPECT_TRUE(build_workload_weighted_cycle({}).empty());
+}
+
+TEST(WorkloadPlanTest, CompilesPartitionsSliceShapesAndRotatedSchedules) {
+  WorkloadSpec spec;
+  std::string error;
+  ASSERT_TRUE(parse_workload_spec(kExampleWorkload, spec, error)) << error;
+  WorkloadPlan plan;
+  ASSERT_TRUE(compile_workload_plan(spec, plan, error)) << error;
+  ASSERT_EQ(plan.streams.size(), 4u);
+  ASSERT_EQ(plan.workers.size(), 5u);
+  EXPECT_EQ(plan.total_region_bytes, (1024u + 256u + 64u + 8u) * Constants::BYTES_PER_MB);
+
+  const WorkloadStreamPlan& scan = plan.streams[0];
+  EXPECT_EQ(scan.partition_bytes, 256u * Constants::BYTES_PER_MB);
+  EXPECT_EQ(scan.slice_span_bytes, Constants::WORKLOAD_SLICE_BYTES);
+  EXPECT_EQ(scan.slice_accesses * scan.access_bytes, Constants::WORKLOAD_SLICE_BYTES);
+  EXPECT_DOUBLE_EQ(scan.weight_share, 0.7);
+
+  const WorkloadStreamPlan& cache = plan.streams[1];
+  EXPECT_EQ(cache.partition_bytes, 256u * Constants::BYTES_PER_MB);
+  EXPECT_EQ(cache.slice_span_bytes, 0u);
+
+  const WorkloadStreamPlan& chain = plan.streams[2];
+  EXPECT_EQ(chain.group_index, 1u);
+  EXPECT_EQ(chain.access_bytes, sizeof(uintptr_t));
+  EXPECT_EQ(chain.partition_bytes, 64u * Constants::BYTES_PER_MB);
+
+  // 2048 accesses of 32 bytes, one per 4 KiB stride: 8 MiB per slice, one slice per share.
+  const WorkloadStreamPlan& column = plan.streams[3];
+  EXPECT_EQ(column.slice_span_bytes, 8u * Constants::BYTES_PER_MB);
+  EXPECT_EQ(column.partition_bytes, column.slice_span_bytes);
+
+  for (size_t worker = 0; worker < 4; ++worker) {
+    const WorkloadWorkerPlan& worker_plan = plan.workers[worker];
+    EXPECT_EQ(worker_plan.group_index, 0u);
+    EXPECT_EQ(worker_plan.group_worker, worker);
+    ASSERT_EQ(worker_plan.schedule.size(), 10u);
+    EXPECT_EQ(std::count(worker_plan.schedule.begin(), worker_plan.schedule.end(), 0u), 7);
+    EXPECT_EQ(std::count(worker_plan.schedule.begin(), worker_plan.schedule.end(), 1u), 3);
+  }
+  EXPECT_NE(plan.workers[0].schedule, plan.workers[1].schedule);
+  EXPECT_EQ(plan.workers[4].schedule, std::vector<size_t>({2, 3}));
+
+  WorkloadSpec crowded;
+  ASSERT_TRUE(parse_workload_spec("group g threads=32\nstream s read sequential region=1MiB\n",
+                                  crowded, error));
+  EXPECT_FALSE(compile_workload_plan(crowded, plan, error));
+  EXPECT_NE(error.find("g/s"), std::string::npos) << error;
+  EXPECT_NE(error.find("line 2"), std::string::npos) << error;
+}
+
+TEST(WorkloadJsonTest, ReportsStreamSharesBandwidthAndChaseLatency) {
+  WorkloadConfig config;
+  config.workload_file = "service.workload";
+  config.seed = 99;
+  std::string error;
+  ASSERT_TRUE(parse_workload_spec(kExampleWorkload, config.spec, error)) << error;
+  WorkloadPlan plan;
+  ASSERT_TRUE(compile_workload_plan(config.spec, plan, error)) << error;
+
+  // 1 ms wall: 700 + 300 bytes/us for the service, 1 KB chased in 10 us of loads.
+  std::vector<WorkloadStreamTotals> totals(4);
+  totals[0] = {700000, 21875, 4.0e6};
+  totals[1] = {300000, 9375, 4.0e6};
+  totals[2] = {1000, 125, 10000.0};
+  totals[3] = {0, 0, 0.0};
+  WorkloadResult result;
+  record_workload_sample(plan, totals, 1.0e6, result);
+  record_workload_sample(plan, totals, 1.0e6, result);
+  finalize_workload_result(result);
+
+  ASSERT_EQ(result.streams.size(), 4u);
+  EXPECT_DOUBLE_EQ(result.streams[0].median_byte_share, 0.7);
+  EXPECT_DOUBLE_EQ(result.streams[0].median_gb_s, 0.7);
+  EXPECT_DOUBLE_EQ(result.median_aggregate_gb_s, 1.001);
+  EXPECT_DOUBLE_EQ(result.median_chase_ns, 80.0);
+
+  const nlohmann::ordered_json json = build_workload_json(config, plan, result, "cpu", 1.0);
+  EXPECT_EQ(json["mode"], Constants::WORKLOAD_JSON_MODE_NAME);
+  EXPECT_EQ(json["configuration"]["workload_file"], "service.workload");
+  EXPECT_EQ(json["configuration"]["total_threads"], 5u);
+  EXPECT_EQ(json["configuration"]["seed_source"], "generated");
+  ASSERT_EQ(json["groups"].size(), 2u);
+  const nlohmann::ordered_json& cache = json["groups"][0]["streams"][1];
+  EXPECT_EQ(cache["pattern"], "zipf");
+  EXPECT_EQ(cache["region_sharing"], "shared");
+  EXPECT_DOUBLE_EQ(cache["zipf_theta"].get<double>(), 0.8);
+  EXPECT_DOUBLE_EQ(cache["achieved_byte_share"].get<double>(), 0.3);
+  EXPECT_DOUBLE_EQ(cache["ns_per_access"].get<double>(), 4.0e6 / 9375.0);
+  const nlohmann::ordered_json& column = json["groups"][1]["streams"][1];
+  EXPECT_EQ(column["region_sharing"], "partitioned");
+  EXPECT_EQ(column["stride_bytes"], 4096u);
+  EXPECT_DOUBLE_EQ(json["aggregate"]["chase_ns_per_load"].get<double>(), 80.0);
+  EXPECT_EQ(json["aggregate"]["samples_gb_s"].size(), 2u);
+}
+
+TEST(WorkloadCliTest, LoadsTheWorkloadFileAndRejectsOtherOptions) {
+  const std::string path = testing::TempDir() + "workload_cli_test.workload";
+  std::ofstream(path) << kExampleWorkload;
+
+  WorkloadConfig config;
+  ASSERT_EQ(parse_with_args({"memory_benchmark", "--workload", path, "-r", "5", "--sample-ms",
+                             "100", "--seed", "7", "-o", "workload.json"},
+                            config),
+            EXIT_SUCCESS);
+  EXPECT_EQ(config.workload_file, path);
+  EXPECT_EQ(config.spec.groups.size(), 2u);
+  EXPECT_EQ(config.rounds, 5);
+  EXPECT_EQ(config.sample_ms, 100);
+  EXPECT_TRUE(config.user_specified_seed);
+  EXPECT_EQ(config.seed, 7u);
+  EXPECT_EQ(config.output_file, "workload.json");
+
+  WorkloadConfig defaults;
+  ASSERT_EQ(parse_with_args({"memory_benchmark", "-Y", path}, defaults), EXIT_SUCCESS);
+  EXPECT_EQ(defaults.rounds, Constants::WORKLOAD_DEFAULT_ROUNDS);
+  EXPECT_EQ(defaults.sample_ms, Constants::WORKLOAD_DEFAULT_SAMPLE_MS);
+  EXPECT_FALSE(defaults.user_specified_seed);
+
+  const std::vector<std::vector<std::string>> invalid_args = {
+      {"-Y"},
+      {"-Y", path + ".missing"},
+      {"-Y", path, "--sample-ms", "0"},
+      {"-Y", path, "--sample-ms", "60001"},
+      {"-Y", path, "-Y", path},
+      {"-Y", path, "--threads", "2"},
+      {"-r", "2"},
+  };
+  for (const std::vector<std::string>& extra : invalid_args) {
+    std::vector<std::string> args = {"memory_benchmark"};
+    args.insert(args.end(), extra.begin(), extra.end());
+    WorkloadConfig invalid;
+    EXPECT_EQ(parse_with_args(args, invalid), EXIT_FAILURE) << extra.back();
+  }
+
+  std::ofstream(path) << "group g\nstream s read sequential\n";
+  WorkloadConfig malformed;
+  EXPECT_EQ(parse_with_args({"memory_benchmark", "-Y", path}, malformed), EXIT_FAILURE);
+  std::remove(path.c_str());
+}